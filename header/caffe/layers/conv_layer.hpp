@@ -14,6 +14,9 @@
 class ConvolutionLayer : public Layer {
   friend class ConvNetAcc;
   friend class VerilogCompiler;
+  friend class ParallelismAllocator;
+  friend class TlmConvNetAcc;
+  friend class ThroughputAnalyzer;
   public:
     // Constructor
     explicit ConvolutionLayer(const caffe::LayerParameter& param)
@@ -14,6 +14,9 @@
 class InnerProductLayer : public Layer {
   friend class ConvNetAcc;
   friend class VerilogCompiler;
+  friend class ParallelismAllocator;
+  friend class TlmConvNetAcc;
+  friend class ThroughputAnalyzer;
   public:
     // Constructor
     explicit InnerProductLayer(const caffe::LayerParameter& param)
@@ -14,6 +14,9 @@
 class PoolingLayer : public Layer {
   friend class ConvNetAcc;
   friend class VerilogCompiler;
+  friend class ParallelismAllocator;
+  friend class TlmConvNetAcc;
+  friend class ThroughputAnalyzer;
   public:
     // Constructor
     explicit PoolingLayer(const caffe::LayerParameter& param)
@@ -26,6 +29,12 @@ class PoolingLayer : public Layer {
     void ComputationComplexity(const std::vector<std::vector<int>* >&
         bottom_shape, const std::vector<std::vector<int>* >& top_shape);
 
+    // whether the window covers the entire unpadded input feature map, i.e.
+    // global_pooling or an equivalent kernel size (e.g. 7x7 over 7x7)
+    inline bool global_pooling() const {
+      return kh_ == h_ && kw_ == w_ && pad_h_ == 0 && pad_w_ == 0;
+    }
+
   private:
     // input feature map shape
     int batch_num_;
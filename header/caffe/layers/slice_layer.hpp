@@ -0,0 +1,30 @@
+/*
+ * Filename: slice_layer.hpp
+ * --------------------------
+ * This file exports the class SliceLayer, which slices the bottom blob along
+ * the channels into the top blobs, e.g. the demultiplexer of the fused sibling
+ * convolutions.
+ */
+
+#ifndef __SLICE_LAYER_HPP__
+#define __SLICE_LAYER_HPP__
+
+#include "proto/caffe.pb.h"
+#include "header/caffe/layer.hpp"
+#include <vector>
+
+class SliceLayer : public Layer {
+  public:
+    // Constructor
+    explicit SliceLayer(const caffe::LayerParameter& param)
+      : Layer(param) {}
+    ~SliceLayer() {}
+
+    void SetUp(const std::vector<std::vector<int>* >& bottom_shape,
+        const std::vector<std::vector<int>* >& top_shape);
+
+    void ComputationComplexity(const std::vector<std::vector<int>* >&
+        bottom_shape, const std::vector<std::vector<int>* >& top_shape);
+};
+
+#endif
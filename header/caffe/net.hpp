@@ -19,6 +19,16 @@ class Net {
   friend class ConvNetAcc;
   // friend class of VerilogCompiler
   friend class VerilogCompiler;
+  // friend class of ParallelismAllocator
+  friend class ParallelismAllocator;
+  // friend class of TlmConvNetAcc
+  friend class TlmConvNetAcc;
+  // friend class of ThroughputAnalyzer
+  friend class ThroughputAnalyzer;
+  // friend class of LayerPrecision
+  friend class LayerPrecision;
+  // friend class of NetPartitioner
+  friend class NetPartitioner;
   public:
     /*
      * Constructor: Net
@@ -26,10 +36,19 @@ class Net {
      *        Net network(param_file);
      * --------------------------------
      * Initialize the neural network from the network parameter, either from the
-     * explicit settings of parameters or from the prototxt file.
+     * explicit settings of parameters or from the prototxt file. The sibling
+     * 1x1 convolutions are fused if fuse_sibling_convs is set, and only the
+     * ones of the same fusion tag (keyed by the layer name, see
+     * LayerPrecision::FusionTags) are grouped together.
      */
-    explicit Net(const caffe::NetParameter& param);
-    explicit Net(const std::string& param_file);
+    explicit Net(const caffe::NetParameter& param,
+        bool fuse_sibling_convs = false,
+        const std::map<std::string, std::string>& fusion_tags =
+        std::map<std::string, std::string>());
+    explicit Net(const std::string& param_file,
+        bool fuse_sibling_convs = false,
+        const std::map<std::string, std::string>& fusion_tags =
+        std::map<std::string, std::string>());
 
     // Destructor
     ~Net() {}
@@ -68,14 +87,30 @@ class Net {
       return result;
     }
 
+    /*
+     * Method: SourceLayers
+     * ---------------------
+     * Returns the names of the layers in the prototxt file the layer is built
+     * from: the fused sibling convolutions in the order of their outputs, or
+     * the layer itself.
+     */
+    std::vector<std::string> SourceLayers(const std::string& layer_name) const;
+
   private:
     // Initialize a network with a netparameter
-    void Init(const caffe::NetParameter& in_param);
+    void Init(const caffe::NetParameter& in_param, bool fuse_sibling_convs,
+        const std::map<std::string, std::string>& fusion_tags);
 
     // Filter layers only in the test phase
     void FilterTestLayers(const caffe::NetParameter& param,
         caffe::NetParameter* param_filtered);
 
+    // Fuse the sibling 1x1 convolutions of the same bottom blob into one
+    // convolution followed by a slice layer
+    void FuseSiblingConvs(const caffe::NetParameter& param,
+        const std::map<std::string, std::string>& fusion_tags,
+        caffe::NetParameter* param_fused);
+
     // Insert the split layer to the network parameter
     void InsertSplits(const caffe::NetParameter& param,
         caffe::NetParameter* param_split);
@@ -119,6 +154,9 @@ class Net {
     // blob name to index map
     std::map<std::string, int> blobs_name_to_idx_;
 
+    // fused convolution name to the names of its sibling convolutions
+    std::map<std::string, std::vector<std::string> > fused_layers_;
+
   public:
     /*
      * Method: MaxBlobShapeVolume, MinBlobShapeVolume
@@ -0,0 +1,65 @@
+/*
+ * Filename: weight_loader.hpp
+ * ----------------------------
+ * This file exports the class WeightLoader, which reads the trained weights
+ * from the binary caffemodel (NetParameter). The file is memory-mapped and only
+ * indexed by the layer name: the packed float data of each blob is decoded in
+ * place when the layer is quantized, so the model is never copied into the
+ * protobuf objects.
+ */
+
+#ifndef __WEIGHT_LOADER_HPP__
+#define __WEIGHT_LOADER_HPP__
+
+#include <string>
+#include <vector>
+#include <map>
+#include <stdint.h>
+#include <stddef.h>
+
+class WeightLoader {
+  public:
+    // constructor: map the caffemodel & index the blobs of each layer
+    explicit WeightLoader(const std::string& filename);
+    // destructor: unmap the caffemodel
+    ~WeightLoader();
+
+    // returns true if the caffemodel contains the weights of the layer
+    bool HasWeights(const std::string& layer_name) const;
+
+    /*
+     * Method: QuantizeWeights
+     * ------------------------
+     * Quantize the weights (blob 0) of the layers to the signed fixed-point
+     * number of bit_width bits, in the order of (Nout, Nin, kernel_size). The
+     * weights of multiple layers (the fused sibling convolutions) are
+     * concatenated along the outputs. The weights of a grouped convolution are
+     * expanded to all the Nin input channels with zeros. The no. of fraction
+     * bits is the max one covering the largest magnitude, which is returned.
+     */
+    int QuantizeWeights(const std::vector<std::string>& layer_names, int Nout,
+        int Nin, int kernel_size, int group, int bit_width,
+        std::vector<int>& weights) const;
+
+  private:
+    // packed float data of one blob within the mapped file
+    struct BlobData {
+      const uint8_t* data;  // little-endian IEEE 754 floats
+      int count;            // no. of floats
+    };
+
+    // index the layers of the NetParameter
+    void IndexNet(const uint8_t* buffer, int size);
+    // index the blobs of the LayerParameter
+    void IndexLayer(const uint8_t* buffer, int size);
+    // locate the packed float data of the BlobProto
+    static BlobData IndexBlob(const uint8_t* buffer, int size);
+
+    std::string filename_;
+    void* addr_;          // mapped caffemodel
+    size_t size_;
+    // blobs of each layer, key: layer name
+    std::map<std::string, std::vector<BlobData> > layer_blobs_;
+};
+
+#endif
@@ -9,6 +9,7 @@
 #define __CMD_PARSER_HPP__
 
 #include <string>
+#include <vector>
 #include <getopt.h>
 #include "proto/config.pb.h"
 
@@ -16,7 +17,7 @@ class CmdParser {
   public:
     // Constructor
     explicit CmdParser(int argc, char *argv[])
-      : argc_(argc), argv_(argv) {}
+      : output_filename("batch_result.csv"), argc_(argc), argv_(argv) {}
     ~CmdParser() {}
 
     // main parse method
@@ -33,6 +34,13 @@ class CmdParser {
     std::string model_filename;   // neural net model filename
     config::ConfigParameter config_param; // parsed configuration parameter
 
+    // batch mode: multiple design points in one run
+    std::string batch_path;       // batch directory or batch prototxt file
+    std::string output_filename;  // batch result records filename
+    std::vector<std::string> batch_config_name;   // name of each design point
+    std::vector<config::ConfigParameter> batch_config_param;
+    inline bool batch_mode() const { return !batch_config_param.empty(); }
+
   private:
     // command option configurations
     // short options
@@ -42,6 +50,8 @@ class CmdParser {
 
     // print usage
     void PrintUsage() const;
+    // parse the configurations of batch mode
+    void ParseBatch();
 
   private:
     // instance variables for command arguments
@@ -0,0 +1,88 @@
+/*
+ * Filename: design_space_explorer.hpp
+ * ------------------------------------
+ * This file exports the class DesignSpaceExplorer, which sweeps the design
+ * points defined by DseParameter. Each design point is evaluated analytically
+ * by the ParallelismAllocator without elaborating the SystemC model, and the
+ * design points are distributed over a pool of worker threads. The Pareto front
+ * of area vs. throughput is marked among all design points.
+ */
+
+#ifndef __DESIGN_SPACE_EXPLORER_HPP__
+#define __DESIGN_SPACE_EXPLORER_HPP__
+
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include "header/caffe/net.hpp"
+#include "proto/config.pb.h"
+
+class DesignSpaceExplorer {
+  public:
+    // evaluation result of one design point
+    struct DesignPoint {
+      config::ConfigParameter config_param;
+      long int max_inference_rate;  // bottleneck layer inference rate [cycle]
+      double throughput;            // [frame/s]
+      int num_mults;                // number of multipliers
+      double area;                  // [um2]
+      double static_power;          // [uW]
+      bool pareto;                  // on the Pareto front of area & throughput
+    };
+
+    // constructor: enumerate the design points of the swept parameters, the
+    // network is shared (read-only) by all design points
+    explicit DesignSpaceExplorer(const Net& net,
+        const config::DseParameter& dse_param);
+    ~DesignSpaceExplorer();
+
+    /*
+     * Method: Explore
+     * Usage: explorer.Explore(8);
+     * ----------------------------
+     * Evaluate all design points with num_threads worker threads, and mark the
+     * Pareto front afterwards.
+     */
+    void Explore(int num_threads);
+
+    // outputs the design points on the Pareto front
+    void Summary(std::ostream& os=std::cout) const;
+    // outputs one comma-separated record per design point
+    void WriteRecords(std::ostream& os) const;
+
+    inline const std::vector<DesignPoint>& design_points() const {
+      return design_points_;
+    }
+
+    /*
+     * Method: FusionTags
+     * Usage: DesignSpaceExplorer::FusionTags(dse_param, &fusion_tags);
+     * -----------------------------------------------------------------
+     * The fusion tags of LayerPrecision::FusionTags at all the swept bit
+     * widths, so that the network shared by all design points only fuses the
+     * sibling convolutions of the same precision at each of them.
+     */
+    static void FusionTags(const config::DseParameter& dse_param,
+        std::map<std::string, std::string>* fusion_tags);
+
+  private:
+    // values of the swept parameter within the range
+    static void ExpandRange(const config::IntRange& range,
+        std::vector<int>* values);
+    // entry of the worker thread: evaluate the design points until none is left
+    static void* Worker(void* explorer);
+    // evaluate the parallelism, area & static power of one design point
+    void Evaluate(DesignPoint* point) const;
+    // mark the design points not dominated in both area & throughput
+    void MarkParetoFront();
+
+    const Net& net_;
+    std::vector<DesignPoint> design_points_;
+    // index of the next design point to be evaluated, guarded by mutex_
+    size_t next_point_;
+    pthread_mutex_t mutex_;
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Filename: layer_precision.hpp
+ * ------------------------------
+ * This file exports the class LayerPrecision, which resolves the bit width of
+ * each processing element (Convolution, InnerProduct & Pooling) from the
+ * layer_bit_width overrides of the configuration, and the bit width of each
+ * blob between them. A blob is transmitted at the bit width of the processing
+ * elements consuming it (through the Split, Concat, Eltwise & bypassed
+ * layers), so the pixels of a processing element are requantized once at its
+ * inter-layer channel buffer. The network input & output blobs stay at the bit_width.
+ */
+
+#ifndef __LAYER_PRECISION_HPP__
+#define __LAYER_PRECISION_HPP__
+
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include "header/caffe/net.hpp"
+#include "proto/config.pb.h"
+
+class LayerPrecision {
+  public:
+    // constructor: resolve the bit width of all the layers & blobs, exits if
+    // one blob is consumed at different bit widths
+    explicit LayerPrecision(const Net& net,
+        const config::ConfigParameter& config_param);
+    ~LayerPrecision() {}
+
+    // bit width of the processing element of the layer (the default bit width
+    // for the remaining layers)
+    int LayerBitWidth(int layer_id) const;
+    // bit width of the blob consumed by the next layers
+    int BlobBitWidth(const std::string& blob_name) const;
+    // max bit width over all the processing elements
+    int MaxBitWidth() const;
+    // returns true if any processing element overrides the bit width
+    bool mixed() const;
+
+    inline int default_bit_width() const { return default_bit_width_; }
+
+    /*
+     * Method: FusionTags
+     * Usage: LayerPrecision::FusionTags(config_param, &fusion_tags);
+     * ---------------------------------------------------------------
+     * Append the bit width of each convolution of the unfused model file and
+     * the one of its top blob (i.e. required by its consumers) to the fusion
+     * tag of the convolution, so that Net only fuses the siblings of the same
+     * precision. Nothing is appended if fuse_sibling_convs is not set.
+     */
+    static void FusionTags(const config::ConfigParameter& config_param,
+        std::map<std::string, std::string>* fusion_tags);
+
+  private:
+    // bit width of the first pattern matching the layer name
+    int MatchBitWidth(const std::string& layer_name) const;
+    // bit width of the layer built from the source layers of the prototxt
+    // file, exits if they do not match the same bit width
+    int SourceBitWidth(const std::vector<std::string>& source_layers,
+        const std::string& layer_name) const;
+    // record the bit width of the blob required by the consumer layer
+    void RequireBlobBitWidth(const std::string& blob_name, int bit_width,
+        const std::string& layer_name);
+
+    int default_bit_width_;
+    // layer name pattern & bit width of the overrides
+    std::vector<std::pair<std::string, int> > patterns_;
+    // key: layer index of the processing element
+    std::map<int, int> layer_bit_width_;
+    // key: blob name, absent if no processing element consumes it
+    std::map<std::string, int> blob_bit_width_;
+};
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Filename: logger.hpp
+ * ---------------------
+ * This file exports the class Logger, the per-module verbosity of the log
+ * messages, and the LOG macro writing one message:
+ *
+ *  LOG(TESTBENCH, TRACE) << "@" << sc_time_stamp() << " sends data" << endl;
+ *
+ * A message is formatted only if its level is enabled for the module, and is
+ * stripped at compile time if its level is above LOG_MAX_LEVEL. The messages
+ * of multiple statements are guarded by LOG_ENABLED(module, level).
+ */
+
+#ifndef __LOGGER_HPP__
+#define __LOGGER_HPP__
+
+#include "proto/config.pb.h"
+#include <iostream>
+
+// max level of the compiled log messages: 0 (SILENT) to 3 (TRACE)
+#ifndef LOG_MAX_LEVEL
+#define LOG_MAX_LEVEL 3
+#endif
+
+// whether the messages of the level are compiled & enabled for the module,
+// which guards the multi-statement messages
+#define LOG_ENABLED(module, level) \
+  (Logger::level <= LOG_MAX_LEVEL && \
+   Logger::Enabled(Logger::module, Logger::level))
+
+#define LOG(module, level) \
+  if (!LOG_ENABLED(module, level)) ; else std::cout
+
+class Logger {
+  public:
+    // verbosity level, consistent with the ConfigParameter::LogLevel
+    enum Level {
+      SILENT = 0,
+      INFO = 1,       // summaries
+      DETAIL = 2,     // per-layer & per-connection elaboration
+      TRACE = 3       // per-cycle simulation
+    };
+    enum Module {
+      NET = 0,
+      CONVNET_ACC,
+      TESTBENCH,
+      MULT_ARRAY,
+      POOL_ARRAY,
+      TLM,
+      NUM_MODULES
+    };
+
+    // set the verbosity of all modules from the configuration
+    static void Configure(const config::ConfigParameter& config_param);
+    // whether the messages of the level are written for the module
+    static inline bool Enabled(Module module, Level level) {
+      return level <= levels_[module];
+    }
+
+  private:
+    static int levels_[NUM_MODULES];
+    // module name in the configuration
+    static const char* const module_names_[NUM_MODULES];
+};
+
+#endif
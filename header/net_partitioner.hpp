@@ -0,0 +1,66 @@
+/*
+ * Filename: net_partitioner.hpp
+ * ------------------------------
+ * This file exports the class NetPartitioner, which cuts the Net into
+ * contiguous segments to be simulated independently. A cut is legal after a
+ * layer if exactly one (4-D) blob is alive across it, e.g. the top of a Concat
+ * before the Split feeding the next inception module, so each segment is a
+ * standalone network with that blob as its input. The cuts are chosen to
+ * minimize the max no. of processing elements (Convolution, InnerProduct &
+ * Pooling) over the segments.
+ */
+
+#ifndef __NET_PARTITIONER_HPP__
+#define __NET_PARTITIONER_HPP__
+
+#include "header/caffe/net.hpp"
+#include "proto/caffe.pb.h"
+#include <string>
+#include <vector>
+
+class NetPartitioner {
+  public:
+    struct Segment {
+      int first_layer;        // first layer id in the Net
+      int last_layer;         // last layer id in the Net (included)
+      std::string input_blob; // input blob name
+      int input_spatial_dim;  // input blob h*w
+      int num_pe;             // no. of processing elements
+    };
+
+    // constructor: cut the net into at most max_segments segments
+    explicit NetPartitioner(const Net& net, int max_segments);
+    ~NetPartitioner() {}
+
+    /*
+     * Method: SegmentParam
+     * ---------------------
+     * Network parameter of the segment: the Input layer of its input blob
+     * followed by the layers of the segment.
+     */
+    void SegmentParam(int segment_id, caffe::NetParameter* param) const;
+
+    // outputs the summary of the segments
+    void Summary() const;
+
+    // getters
+    inline const std::vector<Segment>& segments() const { return segments_; }
+
+  private:
+    // segments of the greedy partition with at most max_cost processing
+    // elements each, where possible
+    void Partition(const std::vector<int>& cuts, int max_cost,
+        std::vector<int>* result) const;
+    // no. of processing elements in the layers [0, layer_id]
+    inline int PrefixCost(int layer_id) const {
+      return (layer_id < 0) ? 0 : prefix_cost_[layer_id];
+    }
+
+    const Net* net_;
+    std::vector<int> prefix_cost_;
+    // the only blob alive after each layer, empty if not a legal cut
+    std::vector<std::string> cut_blob_;
+    std::vector<Segment> segments_;
+};
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * Filename: parallelism_solver.hpp
+ * ---------------------------------
+ * This file exports the parallelism solver shared by the SystemC model and the
+ * Verilog compiler. Given the layer dimension and the target pixel inference
+ * rate, it searches for the tuple (Pin, Pout, Pk) such that
+ *
+ *  ceil(Nin/Pin) * ceil(Nout/Pout) * ceil(K/Pk)
+ *
+ * is the closest to the target rate.
+ */
+
+#ifndef __PARALLELISM_SOLVER_HPP__
+#define __PARALLELISM_SOLVER_HPP__
+
+#include <vector>
+#include <utility>
+#include <limits>
+
+/*
+ * Function: CeilQuotientCandidates
+ * Usage: CeilQuotientCandidates(N, &candidates);
+ * -----------------------------------------------
+ * Enumerate the distinct values of ceil(N/P) for P in [1, N]. Each candidate is
+ * stored as (ceil(N/P), smallest P achieving it), in the order of increasing P.
+ * There are at most 2*sqrt(N) candidates.
+ */
+void CeilQuotientCandidates(int N,
+    std::vector<std::pair<int, int> >* candidates);
+
+/*
+ * Function: SolveParallelism
+ * Usage: parallelism = SolveParallelism(Nin, Nout, K, true, rate);
+ * -----------------------------------------------------------------
+ * Return ((Pin, Pout), Pk) minimizing |ceil(Nin/Pin)*ceil(Nout/Pout)*ceil(K/Pk)
+ * - rate|. Pk is fixed to K if kernel_unrolling is false. Only the tuples with
+ * ceil(Nout/Pout) >= min_out_iter and an error below max_error are accepted.
+ * Ties are resolved to the smallest Pin, then Pout, then Pk, which is identical
+ * to an exhaustive search in that loop order. ((1, 1), 1) is returned if no
+ * tuple is accepted.
+ */
+std::pair<std::pair<int, int>, int> SolveParallelism(int Nin, int Nout, int K,
+    bool kernel_unrolling, double rate, int min_out_iter = 1,
+    double max_error = std::numeric_limits<double>::max());
+
+#endif
@@ -54,6 +54,12 @@ class AddArray : public sc_module {
     double TotalPower() const;
 
   private:
+    // sum of the Pin*Pk products of output o, where the kernel parallelism PK
+    // is known at compile time (Pk_ if 0)
+    template <int PK> Payload SumProducts(int o) const;
+    // SumProducts of the kernel parallelism selected at elaboration
+    Payload (AddArray::*sum_products_)(int o) const;
+
     int Kh_, Kw_;     // spatial dimension of kernel
     int Pin_, Pout_;  // input parallelism & output parallelism
     int Pk_;          // kernel parallelism
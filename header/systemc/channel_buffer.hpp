@@ -8,11 +8,13 @@
 #ifndef __CHANNEL_BUFFER_HPP__
 #define __CHANNEL_BUFFER_HPP__
 
+#include "header/systemc/checkpoint.hpp"
 #include "header/systemc/data_type.hpp"
 #include "header/systemc/models/memory_model.hpp"
-#include <queue>
+#include "header/systemc/payload_fifo.hpp"
 #include <limits.h>
 #include <systemc.h>
+#include <vector>
 
 class ChannelBuffer : public sc_module {
   // ports
@@ -22,17 +24,17 @@ class ChannelBuffer : public sc_module {
     // input data from the previous layer
     sc_in<bool> prev_layer_valid;
     sc_out<bool> prev_layer_rdy;
-    sc_in<Payload>* prev_layer_data;
+    sc_in<PayloadBus> prev_layer_data;
 
     // output data to the next layer
     sc_in<bool> next_layer_rdy;
     sc_out<bool> next_layer_valid;
-    sc_out<Payload>* next_layer_data;
+    sc_out<PayloadBus> next_layer_data;
 
     SC_HAS_PROCESS(ChannelBuffer);
 
     inline int BufferSize() const {
-      return buffer_[0].size();
+      return buffer_.size();
     }
 
     inline int MaxBufferSize() const {
@@ -54,8 +56,14 @@ class ChannelBuffer : public sc_module {
   private:
     int Nin_;                 // input channel depth
     int capacity_;            // max channel buffer capacity
-    std::queue<Payload>* buffer_;
+    PayloadFifo buffer_;
+    PayloadBus zero_data_;    // all-zero output when no data is transmitted
+    PayloadBus front_data_;   // front pixel of the buffer to be transmitted
     int max_buffer_size_;     // max buffer size in the simulation
+    // pixels loaded on reset (one after another): empty unless restored from
+    // the checkpoint
+    std::vector<Payload> reset_pixels_;
+    int reset_max_buffer_size_;
     // memory hardware model
     static const int INIT_MEM_DEPTH = 1024;
     MemoryModel* memory_model_;
@@ -79,6 +87,11 @@ class ChannelBuffer : public sc_module {
     void ChannelBufferCombLogic();
 
     void ChannelBufferMonitor();
+
+    // checkpoint of the buffered pixels & the max buffer size, where the
+    // restored state is loaded on reset
+    void SaveState(Checkpoint* checkpoint) const;
+    void RestoreState(Checkpoint* checkpoint);
 };
 
 #endif
@@ -0,0 +1,73 @@
+/*
+ * Filename: checkpoint.hpp
+ * -------------------------
+ * This file exports the class Checkpoint, which holds the serialized state of
+ * the modules in a compact binary file. Each module writes its state into the
+ * record of its hierarchical name, and reads it back in the same order when
+ * it is restored. The values are copied as raw bytes, so the checkpoint is
+ * only restored by the same build (e.g. PAYLOAD_BIT_WIDTH) & configuration.
+ */
+
+#ifndef __CHECKPOINT_HPP__
+#define __CHECKPOINT_HPP__
+
+#include <map>
+#include <string>
+#include <vector>
+
+class Checkpoint {
+  public:
+    // constructor
+    Checkpoint() {}
+    // destructor
+    ~Checkpoint() {}
+
+    // appends the value to the record of the module
+    template <typename T>
+    void Write(const std::string& module, const T& value) {
+      WriteBytes(module, &value, sizeof(T));
+    }
+    template <typename T>
+    void WriteVector(const std::string& module, const std::vector<T>& values) {
+      Write(module, static_cast<int>(values.size()));
+      if (!values.empty()) {
+        WriteBytes(module, &values[0], values.size()*sizeof(T));
+      }
+    }
+
+    // reads the next value from the record of the module
+    template <typename T>
+    void Read(const std::string& module, T* value) {
+      ReadBytes(module, value, sizeof(T));
+    }
+    template <typename T>
+    void ReadVector(const std::string& module, std::vector<T>* values) {
+      int size;
+      Read(module, &size);
+      values->resize(size);
+      if (size > 0) {
+        ReadBytes(module, &(*values)[0], size*sizeof(T));
+      }
+    }
+
+    // whether the module has a record in the checkpoint
+    bool HasRecord(const std::string& module) const;
+
+    // write to & read from the binary file
+    void Save(const std::string& filename) const;
+    void Load(const std::string& filename);
+
+  private:
+    void WriteBytes(const std::string& module, const void* data, size_t size);
+    void ReadBytes(const std::string& module, void* data, size_t size);
+
+    // magic number of the binary file
+    static const char MAGIC[8];
+
+    // serialized state of each module
+    std::map<std::string, std::vector<char> > records_;
+    // read position in each record
+    std::map<std::string, size_t> read_pos_;
+};
+
+#endif
@@ -19,11 +19,11 @@ class ConcatPe : public sc_module {
     // input data of the multiple bottom blobs
     sc_in<bool>* prev_layer_valid;
     sc_out<bool>* prev_layer_rdy;
-    sc_in<Payload>* prev_layer_data;
+    sc_in<PayloadBus>* prev_layer_data;
     // output data of the single top blob
     sc_in<bool> next_layer_rdy;
     sc_out<bool> next_layer_valid;
-    sc_out<Payload>* next_layer_data;
+    sc_out<PayloadBus> next_layer_data;
 
     SC_HAS_PROCESS(ConcatPe);
 
@@ -31,6 +31,7 @@ class ConcatPe : public sc_module {
     // instance variables
     int Nin_;         // concatenated feature map depth
     int numSplits_;   // the number of input splits
+    PayloadBus concat_data_;  // concatenation of the bottom blob data
 
   public:
     // constructor
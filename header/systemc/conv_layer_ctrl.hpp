@@ -5,14 +5,18 @@
  * of the convolutional layer. It coordinates the different components in the
  * current convolutional layer computation as well as provides the handshake
  * protocol (valid-ready pair) to notify the downstreaming & upstreaming whether
- * the computation is finished or not.
+ * the computation is finished or not. With the spatial parallelism Pw > 1, it
+ * accepts up to Pw*Stride_w input pixels per handshake and computes the output
+ * pixels of Pw adjacent columns in one pass.
  */
 
 #ifndef __CONV_LAYER_CTRL_HPP__
 #define __CONV_LAYER_CTRL_HPP__
 
+#include "header/systemc/checkpoint.hpp"
 #include <systemc.h>
 #include <utility>
+#include <vector>
 
 class ConvLayerCtrl : public sc_module {
   // ports
@@ -30,6 +34,8 @@ class ConvLayerCtrl : public sc_module {
     // line buffer
     sc_out<bool> line_buffer_valid;
     sc_out<bool> line_buffer_zero_in;
+    sc_out<int> line_buffer_pixel_num;
+    sc_out<int> line_buffer_window_offset;
     // line buffer mux
     sc_out<bool> line_buffer_mux_en;
     sc_out<int> line_buffer_mux_select;
@@ -50,6 +56,8 @@ class ConvLayerCtrl : public sc_module {
     sc_out<bool> demux_out_reg_clear;
     sc_out<bool> demux_out_reg_enable;
     sc_out<int> demux_select;
+    // output column (lane) sent to the next layer
+    sc_out<int> out_lane_select;
 
     SC_HAS_PROCESS(ConvLayerCtrl);
 
@@ -58,18 +66,55 @@ class ConvLayerCtrl : public sc_module {
     explicit ConvLayerCtrl(sc_module_name module_name, int Kh, int Kw, int h,
         int w, int Nin, int Nout, int Pin, int Pout, int Pk, int Pad_h=0,
         int Pad_w=0, int Stride_h=1, int Stride_w=1,
-        int extra_pipeline_stage=0);
+        int extra_pipeline_stage=0, int Pw=1);
     // destructor
     ~ConvLayerCtrl();
 
     // main process of the ConvLayerCtrl
     void ConvLayerCtrlProc();   // main control process
+    void PointwiseCtrlProc();   // main control process of the 1x1 kernel
+    void MultiPixelCtrlProc();  // main control process of Pw > 1
     void MultArrayCtrlProc();   // mult array control process
     void AddArrayCtrlProc();    // add array control process
     void DemuxOutRegCtrlProc(); // demux output register control process
     void LineBufferValid();     // combination logic for line buffer valid
 
+    // pipeline stages: Line buffer Mux, MULT, ADD, Demux
+    static const int PIPELINE_STAGE = 4;
+
+    // whether the layer is computed by the pointwise PE: the 1x1 kernel
+    // without padding takes the pixels from the PixelMux rather than the
+    // LineBufferArray, which is loaded by line_buffer_valid
+    static inline bool IsPointwise(int Kh, int Kw, int Pad_h, int Pad_w) {
+      return Kh == 1 && Kw == 1 && Pad_h == 0 && Pad_w == 0;
+    }
+
+    // schedule only the (input, output) tiles of non-zero weights, given in
+    // the compressed sparse row format of the WeightMem: the output tiles of
+    // the ith input tile are tile_col_idx[tile_row_ptr[i]:tile_row_ptr[i+1]]
+    void SetTileSchedule(const std::vector<int>& tile_row_ptr,
+        const std::vector<int>& tile_col_idx);
+
+    // whether the controller waits for the input pixel that is not valid yet,
+    // i.e. the layer is drained
+    inline bool WaitingInput() const {
+      return waiting_input_ && !prev_layer_valid.read();
+    }
+    // checkpoint of the feature map counter, where the restored counter is
+    // loaded on reset
+    void SaveState(Checkpoint* checkpoint) const;
+    void RestoreState(Checkpoint* checkpoint);
+
   private:
+    // reset the outputs & the pipeline state of the main control process
+    void ResetCtrl();
+    // whether the pixel streamed in as the counter-th one of the padded
+    // feature map completes a sliding window of the output (not strided over)
+    bool CompletesWindow(int counter) const;
+    // compute the scheduled tiles of one output pixel (of each lane) & send it
+    // to the next layer
+    void ComputeOutputPixel();
+
     int Kh_, Kw_;               // kernel spatial dimension
     int h_, w_;                 // input feature map spatial dimension
     int Nin_, Nout_;            // channel depth for input & output feature map
@@ -77,10 +122,14 @@ class ConvLayerCtrl : public sc_module {
     int Pk_;                    // kernel parallelism
     int Pad_h_, Pad_w_;         // pad dimension
     int Stride_h_, Stride_w_;   // stride dimension
+    int Pw_;                    // output columns (lanes) per pass
+    int pixels_;                // max input pixels per handshake
+    bool pointwise_;            // 1x1 kernel without padding
+    // lanes of valid output pixels in the current pass, i.e. the sliding
+    // windows completed by the last write of the line buffer
+    int num_lanes_;
 
     // internal pipeline stage variables
-    // Line buffer Mux, MULT, ADD, Demux
-    static const int PIPELINE_STAGE = 4;
     // extra pipeline stage in CONV PE (model the fact that MULT, ADD may take
     // multiple clock cycles)
     int extra_pipeline_stage_;
@@ -94,6 +143,11 @@ class ConvLayerCtrl : public sc_module {
     std::pair<int, int> feat_map_loc_;
     // additional unrolled kernel index location
     int kernel_loc_;
+    // scheduled (input, output) tiles in compressed sparse row format, where
+    // the pth tile occupies the weight memory address [p*ceil(Kh*Kw/Pk),
+    // (p+1)*ceil(Kh*Kw/Pk)) (all tiles by default)
+    std::vector<int> tile_row_ptr_;
+    std::vector<int> tile_col_idx_;
 
     // output feature map index (used by AddArrayCtrlProc)
     int out_feat_idx_add_ctrl_;
@@ -101,6 +155,12 @@ class ConvLayerCtrl : public sc_module {
 
     // output feature map index (used by DemuxOutCtrlReg)
     int out_feat_idx_demux_out_ctrl_;
+
+    // received & padded pixels of the current feature map, which is
+    // reset_feat_pixel_counter_ on reset (0 unless restored)
+    int feat_pixel_counter_;
+    int reset_feat_pixel_counter_;
+    bool waiting_input_;
 };
 
 #endif
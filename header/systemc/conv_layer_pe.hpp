@@ -20,6 +20,12 @@
  * f) AddArray: adder tree (array).
  *
  * g) DemuxOutReg: output register holding the partial results.
+ *
+ * The pointwise layer (1x1 kernel without padding) has neither the zero padding
+ * nor the sliding window, so the PixelMux takes the place of b) & c).
+ *
+ * With the spatial parallelism Pw > 1, there are Pw lanes of c), e), f) & g),
+ * one per output column of the pass, sharing a), b) & d).
  */
 
 #ifndef __CONV_LAYER_PE_HPP__
@@ -29,12 +35,14 @@
 #include "header/systemc/conv_layer_ctrl.hpp"
 #include "header/systemc/line_buffer_array.hpp"
 #include "header/systemc/line_buffer_mux.hpp"
+#include "header/systemc/pixel_mux.hpp"
 #include "header/systemc/weight_mem.hpp"
 #include "header/systemc/mult_array.hpp"
 #include "header/systemc/add_array.hpp"
 #include "header/systemc/demux_out_reg.hpp"
 #include "proto/config.pb.h"
 #include <systemc.h>
+#include <vector>
 
 class ConvLayerPe : public sc_module {
   friend class Top;
@@ -45,12 +53,12 @@ class ConvLayerPe : public sc_module {
     // input data from the previous layer
     sc_in<bool> prev_layer_valid;
     sc_out<bool> prev_layer_rdy;
-    sc_in<Payload>* prev_layer_data;
+    sc_in<PayloadBus> prev_layer_data;
 
     // output data to the next layer
     sc_in<bool> next_layer_rdy;
     sc_out<bool> next_layer_valid;
-    sc_out<Payload>* next_layer_data;
+    sc_out<PayloadBus> next_layer_data;
 
     SC_HAS_PROCESS(ConvLayerPe);
 
@@ -59,15 +67,23 @@ class ConvLayerPe : public sc_module {
     double DynamicPower() const;
     double TotalPower() const;
 
+    // initialize the weight memory with the quantized weights in the order of
+    // (Nout, Nin, Kh*Kw), where the all-zero weight tiles are skipped in zero
+    // skipping mode
+    void LoadWeights(const std::vector<int>& weights);
+    // fraction of the multiplications gated by a zero operand
+    double GatedMultRatio() const;
+
   private:
     // internal modules
     ConvLayerCtrl* conv_layer_ctrl_;
     LineBufferArray* line_buffer_array_;
-    LineBufferMux* line_buffer_mux_;
+    std::vector<LineBufferMux*> line_buffer_mux_;   // one per lane
+    PixelMux* pixel_mux_;     // in place of the above two if pointwise_
     WeightMem* weight_mem_;
-    MultArray* mult_array_;
-    AddArray* add_array_;
-    DemuxOutReg* demux_out_reg_;
+    std::vector<MultArray*> mult_array_;            // one per lane
+    std::vector<AddArray*> add_array_;              // one per lane
+    std::vector<DemuxOutReg*> demux_out_reg_;       // one per lane
 
   private:
     int Nin_;     // input feature map depth
@@ -75,11 +91,19 @@ class ConvLayerPe : public sc_module {
     int Pout_;    // parallelism of output feature map
     int Pin_;     // parallelism of input feature map
     int Pk_;      // parallelism of the kernel
+    int Pw_;      // output columns (lanes) per pass
+    // skip the all-zero weight tiles & gate the zero multiplications
+    bool zero_skipping_;
+    bool pointwise_;  // 1x1 kernel without padding
+    PayloadBus next_data_;  // output registers gathered on the output bus
+    PayloadBus zero_data_;  // zero padding of the line buffer input
   public:
     // internal interconnections
     sc_signal<bool> line_buffer_valid_;
-    sc_signal<Payload>* line_buffer_in_data_;
+    PayloadBusSignal* line_buffer_in_data_;
     sc_signal<bool> line_buffer_zero_in_;
+    sc_signal<int> line_buffer_pixel_num_;
+    sc_signal<int> line_buffer_window_offset_;
     sc_signal<bool> line_buffer_mux_en_;
     sc_signal<int> line_buffer_mux_select_;
     sc_signal<bool> weight_mem_rd_en_;
@@ -102,6 +126,7 @@ class ConvLayerPe : public sc_module {
     sc_signal<bool> demux_out_reg_enable_;
     sc_signal<int> demux_select_;
     sc_signal<Payload>* out_reg_data_;
+    sc_signal<int> out_lane_select_;
 
   public:
     // constructor
@@ -110,7 +135,8 @@ class ConvLayerPe : public sc_module {
         int Pad_w=0, int Stride_h=1, int Stride_w=1,
         config::ConfigParameter_MemoryType memory_type=
         config::ConfigParameter_MemoryType_ROM, int bit_width=8,
-        int tech_node=28, double clk_freq=1.);
+        int tech_node=28, double clk_freq=1., bool zero_skipping=false,
+        int Pw=1);
     // destructor
     ~ConvLayerPe();
 
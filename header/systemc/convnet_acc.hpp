@@ -16,10 +16,16 @@
 #include "header/systemc/data_type.hpp"
 #include "header/systemc/conv_layer_pe.hpp"
 #include "header/systemc/pool_layer_pe.hpp"
+#include "header/systemc/global_pool_pe.hpp"
 #include "header/systemc/split_pe.hpp"
+#include "header/systemc/slice_pe.hpp"
 #include "header/systemc/concat_pe.hpp"
+#include "header/systemc/eltwise_pe.hpp"
 #include "header/systemc/channel_buffer.hpp"
+#include "header/systemc/parallelism_allocator.hpp"
 #include "header/caffe/net.hpp"
+#include "header/caffe/util/weight_loader.hpp"
+#include "header/layer_precision.hpp"
 #include "proto/config.pb.h"
 
 class ConvNetAcc : public sc_module {
@@ -31,11 +37,11 @@ class ConvNetAcc : public sc_module {
     // data path of the first input layer
     sc_in<bool> input_layer_valid;
     sc_out<bool> input_layer_rdy;
-    sc_in<Payload>* input_layer_data;
+    sc_in<PayloadBus> input_layer_data;
     // data path of the final output layer
     sc_in<bool> output_layer_rdy;
     sc_out<bool> output_layer_valid;
-    sc_out<Payload>* output_layer_data;
+    sc_out<PayloadBus> output_layer_data;
 
     SC_HAS_PROCESS(ConvNetAcc);
 
@@ -45,17 +51,23 @@ class ConvNetAcc : public sc_module {
     std::vector<ConvLayerPe *> conv_layer_pe_;
     // pooling layer processing elements
     std::vector<PoolLayerPe *> pool_layer_pe_;
+    // global pooling layer processing elements
+    std::vector<GlobalPoolPe *> global_pool_pe_;
     // split layer processing elements
     std::vector<SplitPe *> split_layer_pe_;
+    // slice layer processing elements (of the fused sibling convolutions)
+    std::vector<SlicePe *> slice_layer_pe_;
     // concatenation layer processing elements
     std::vector<ConcatPe *> concat_layer_pe_;
+    // element-wise layer processing elements
+    std::vector<EltwisePe *> eltwise_layer_pe_;
     // channel buffer unit
     std::vector<ChannelBuffer *> channel_buffer_;
 
     // internal connections
     std::vector< sc_signal<bool> * > layer_valid_;
     std::vector< sc_signal<bool> * > layer_rdy_;
-    std::vector< sc_signal<Payload> * > layer_data_;
+    std::vector< PayloadBusSignal * > layer_data_;
 
   public:
     int Nin_;             // input channel depth
@@ -64,13 +76,18 @@ class ConvNetAcc : public sc_module {
     int output_blob_idx_; // output connection blob index
     int append_buffer_capacity_;
     int input_spatial_dim_; // input spatial dimension
-    int bit_width_;       // bit width of each number
+    int input_width_;     // input width
+    int input_pixels_;    // input pixels per handshake of the input layer
+    int output_spatial_dim_; // output spatial dimension
+    int bit_width_;       // default bit width of each number
     int tech_node_;       // technology node
     double clk_freq_;     // clock frequency [GHz]
     // weight (kernel) memory type
     config::ConfigParameter_MemoryType memory_type_;
     // kernel unrolling flag
     bool kernel_unrolling_flag_;
+    // skip the zero weight tiles & gate the zero multiplications
+    bool zero_skipping_;
 
   public:
     // constructor
@@ -92,16 +109,15 @@ class ConvNetAcc : public sc_module {
     double DynamicPower() const;
     double TotalPower() const;
 
-    void InitParallelism(const Net& net, int pixel_inference_rate);
+    // initialize the parallelism from the target pixel inference rate
+    void InitParallelism(const Net& net,
+        const config::ConfigParameter& config_param);
+    // initialize the parallelism jointly under the multiplier/area budget
+    void InitParallelismUnderBudget(const Net& net,
+        const config::ConfigParameter& config_param);
   private:
     // pipeline stage for within processing unit
-    static const int pipeline_stage_ = 6;
-    // helper function to set the parallelism input & parallelism output
-    std::pair<std::pair<int, int>, int> CalculateParallelsim(int Nin, int Nout,
-        int Kh, int Kw, int h, int w, int layer_inference_rate) const;
-    // brute force search of the parallelism of the CONV
-    std::pair<std::pair<int, int>, int> CalculateParallelsimBruteForce(int Nin,
-        int Nout, int Kh, int Kw, double rate) const;
+    static const int pipeline_stage_ = ParallelismAllocator::PIPELINE_STAGE;
 
   private:
     // initialize the modules & interconnections based on the ConvNet
@@ -128,13 +144,24 @@ class ConvNetAcc : public sc_module {
     // split layer processing unit (split the handshake signals)
     void InitSplitLayer(const Net& net, int layer_id);
 
+    // helper function to instantiate the layer with layer_id as the
+    // slice layer processing unit (demultiplex the output channels of the
+    // fused convolution)
+    void InitSliceLayer(const Net& net, int layer_id);
+
     // helper function to instantiate the layer with layer_id as the
     // concatenation layer (automatically append the channel buffer for each
     // path)
     void InitConcatLayer(const Net& net, int layer_id);
 
+    // helper function to instantiate the layer with layer_id as the
+    // element-wise layer of the residual block (prepend the skip channel
+    // buffer for the shortcut & the residual branch)
+    void InitEltwiseLayer(const Net& net, int layer_id);
+
     // helper function to prepend the channel buffer to the bottom blob
-    // it is utilized in the inception module (prepend in the SplitLayer)
+    // it is utilized in the inception module (prepend in the SplitLayer) and
+    // the residual block
     void PrependChannelBuffer(const Net& net, int layer_id, int blob_id,
         int capacity=INT_MAX);
 
@@ -146,6 +173,12 @@ class ConvNetAcc : public sc_module {
     // helper function bypass the trival layers, we will not consider such layer
     // in the hardware modeling
     void BypassLayer(const Net& net, int layer_id);
+    // helper function to load the quantized weights of the layer (or the
+    // sibling layers it is fused from) to the convolution processing element
+    // if the caffemodel is specified
+    void LoadWeights(const std::vector<std::string>& layer_names,
+        ConvLayerPe* layer_pe, int Nin, int Nout, int kernel_size,
+        int bit_width, int group=1);
 
     // map of the interconnections to index, where key is the name of feature
     // map (blob in caffe), and value is the index of interconnections
@@ -153,9 +186,16 @@ class ConvNetAcc : public sc_module {
 
     // parallelism for each layer, key: layer index; value: <Pin, Pout, Pk>
     std::map<int, std::pair<std::pair<int, int>, int> > parallelism_;
+    // spatial parallelism Pw of the layers computing multiple output columns
+    // per pass, key: layer index; value: Pw (1 if absent)
+    std::map<int, int> spatial_parallelism_;
 
     // trace file
     sc_trace_file* tf_;
+    // trained weights, only available during the initialization
+    WeightLoader* weight_loader_;
+    // per-layer bit width, only available during the initialization
+    LayerPrecision* layer_precision_;
 };
 
 #endif
@@ -10,13 +10,19 @@
 #include <iostream>
 #include <systemc.h>
 #include <string>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+#ifndef PAYLOAD_BIT_WIDTH
 
 /*
  * Struct: Payload
  * ----------------
  * Payload data type, representing the format for each activation in the feature
  * map. It is necessary to export the overload functions for user-defined data
- * type for systemc utility.
+ * type for systemc utility. The floating-point payload is used unless the
+ * fixed-point bit width PAYLOAD_BIT_WIDTH is defined at compile time.
  */
 struct Payload {
   double data;    // presumably using double, can be changed
@@ -25,6 +31,9 @@ struct Payload {
   Payload(double d=0.0) : data(d) {}
   ~Payload() {}
 
+  // numerical value of the payload
+  inline double value() const { return data; }
+
   // overload operator functions
   inline const Payload operator+(const Payload& other) const {
     Payload result = *this;
@@ -92,4 +101,215 @@ struct Payload {
   }
 };
 
+#else
+
+/*
+ * Struct: PayloadStorage
+ * -----------------------
+ * The narrowest signed integer holding BITS bits (BITS rounded up to 8, 16, 32
+ * or 64).
+ */
+template <int BITS> struct PayloadStorage {};
+template <> struct PayloadStorage<8> { typedef int8_t type; };
+template <> struct PayloadStorage<16> { typedef int16_t type; };
+template <> struct PayloadStorage<32> { typedef int32_t type; };
+template <> struct PayloadStorage<64> { typedef int64_t type; };
+
+/*
+ * Struct: FixedPayload
+ * ---------------------
+ * Signed fixed-point payload of BITS bits, consistent with the data path of the
+ * generated RTL: the multiplier keeps the lower BITS bits of the 2*BITS product
+ * and the adders wrap around on overflow, i.e. every operation is computed
+ * modulo 2^BITS in two's complement. The payload only occupies the storage of
+ * the narrowest integer type, which shrinks the signal arrays in the
+ * processing elements compared to the floating-point Payload.
+ */
+template <int BITS>
+struct FixedPayload {
+  typedef typename PayloadStorage<(BITS <= 8) ? 8 : (BITS <= 16) ? 16 :
+    (BITS <= 32) ? 32 : 64>::type storage_type;
+
+  storage_type data;
+
+  // constructor: the value is truncated to an integer & wrapped to BITS bits
+  FixedPayload(double d=0.0)
+    : data(Wrap(static_cast<uint64_t>(static_cast<int64_t>(d)))) {}
+  ~FixedPayload() {}
+
+  // numerical value of the payload
+  inline double value() const { return data; }
+
+  // keep the lower BITS bits and sign-extend, as the truncation in RTL
+  // (computed on unsigned integers, where the overflow is well defined)
+  static inline storage_type Wrap(uint64_t value) {
+    const int shift = 64 - BITS;
+    return static_cast<storage_type>(static_cast<int64_t>(value << shift) >>
+        shift);
+  }
+
+  // overload operator functions
+  inline const FixedPayload operator+(const FixedPayload& other) const {
+    FixedPayload result;
+    result.data = Wrap(static_cast<uint64_t>(data) +
+        static_cast<uint64_t>(other.data));
+    return result;
+  }
+
+  inline const FixedPayload operator-(const FixedPayload& other) const {
+    FixedPayload result;
+    result.data = Wrap(static_cast<uint64_t>(data) -
+        static_cast<uint64_t>(other.data));
+    return result;
+  }
+
+  inline const FixedPayload operator*(const FixedPayload& other) const {
+    FixedPayload result;
+    result.data = Wrap(static_cast<uint64_t>(data) *
+        static_cast<uint64_t>(other.data));
+    return result;
+  }
+
+  inline const FixedPayload operator/(const FixedPayload& other) const {
+    FixedPayload result;
+    result.data = (other.data == 0) ? 0 :
+      Wrap(static_cast<uint64_t>(static_cast<int64_t>(data) / other.data));
+    return result;
+  }
+
+  inline FixedPayload& operator=(const FixedPayload& rhs) {
+    data = rhs.data;
+    return *this;
+  }
+
+  inline bool operator<(const FixedPayload& rhs) const {
+    return data < rhs.data;
+  }
+
+  inline bool operator>(const FixedPayload& rhs) const {
+    return data > rhs.data;
+  }
+
+  inline bool operator<=(const FixedPayload& rhs) const {
+    return data <= rhs.data;
+  }
+
+  inline bool operator>=(const FixedPayload& rhs) const {
+    return data >= rhs.data;
+  }
+
+  inline bool operator==(const FixedPayload& rhs) const {
+    return data == rhs.data;
+  }
+
+  inline bool operator!=(const FixedPayload& rhs) const {
+    return data != rhs.data;
+  }
+
+  inline friend std::ostream& operator<<(std::ostream& os,
+      const FixedPayload& payload) {
+    os << "Payload: " << static_cast<int64_t>(payload.data);
+    return os;
+  }
+
+  // trace overload: traced as a BITS-bit vector of the same storage
+  inline friend void sc_trace(sc_trace_file* tf, const FixedPayload& payload,
+      const std::string& name) {
+    TraceStorage(tf, payload.data, name+".data");
+  }
+
+  private:
+    static inline void TraceStorage(sc_trace_file* tf, const int8_t& data,
+        const std::string& name) {
+      sc_trace(tf, reinterpret_cast<const char&>(data), name, BITS);
+    }
+    static inline void TraceStorage(sc_trace_file* tf, const int16_t& data,
+        const std::string& name) {
+      sc_trace(tf, reinterpret_cast<const short&>(data), name, BITS);
+    }
+    static inline void TraceStorage(sc_trace_file* tf, const int32_t& data,
+        const std::string& name) {
+      sc_trace(tf, reinterpret_cast<const int&>(data), name, BITS);
+    }
+    static inline void TraceStorage(sc_trace_file* tf, const int64_t& data,
+        const std::string& name) {
+      sc_trace(tf, reinterpret_cast<const sc_dt::int64&>(data), name, BITS);
+    }
+};
+
+// the payload of the SystemC data path with the compile-time bit width
+typedef FixedPayload<PAYLOAD_BIT_WIDTH> Payload;
+
+#endif
+
+/*
+ * Struct: PayloadBus
+ * -------------------
+ * Payloads of all channels of one feature map pixel, which are transferred as a
+ * whole between the layers (as the flattened data bus of the RTL). A single
+ * sc_signal of PayloadBus replaces the array of per-channel signals, so that
+ * one handshake only triggers one update & one event regardless of the channel
+ * depth.
+ */
+struct PayloadBus {
+  std::vector<Payload> data;
+
+  // constructor
+  explicit PayloadBus(int width=0, const Payload& value=Payload(0))
+    : data(width, value) {}
+  ~PayloadBus() {}
+
+  // number of channels on the bus
+  inline int width() const { return static_cast<int>(data.size()); }
+
+  inline Payload& operator[](int i) { return data[i]; }
+  inline const Payload& operator[](int i) const { return data[i]; }
+
+  inline bool operator==(const PayloadBus& rhs) const {
+    return data == rhs.data;
+  }
+
+  inline bool operator!=(const PayloadBus& rhs) const {
+    return data != rhs.data;
+  }
+
+  inline friend std::ostream& operator<<(std::ostream& os,
+      const PayloadBus& bus) {
+    os << "PayloadBus:";
+    for (int i = 0; i < bus.width(); ++i) {
+      os << " " << bus.data[i].value();
+    }
+    return os;
+  }
+
+  // trace overload: each channel is traced as name_<channel index>
+  inline friend void sc_trace(sc_trace_file* tf, const PayloadBus& bus,
+      const std::string& name) {
+    char index[16];
+    for (int i = 0; i < bus.width(); ++i) {
+      sprintf(index, "_%d", i);
+      sc_trace(tf, bus.data[i], name+index);
+    }
+  }
+};
+
+/*
+ * Class: PayloadBusSignal
+ * ------------------------
+ * Signal of PayloadBus with the bus width fixed at the elaboration. The current
+ * value is sized in the constructor, so that the processes reading the channels
+ * at the initialization & the trace file (holding the references of the
+ * channels) see the full width. All writers MUST keep the same width.
+ */
+class PayloadBusSignal : public sc_signal<PayloadBus> {
+  public:
+    explicit PayloadBusSignal(int width) : sc_signal<PayloadBus>() {
+      m_cur_val = m_new_val = PayloadBus(width);
+    }
+    PayloadBusSignal(const char* name, int width)
+      : sc_signal<PayloadBus>(name) {
+      m_cur_val = m_new_val = PayloadBus(width);
+    }
+};
+
 #endif
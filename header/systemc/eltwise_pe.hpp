@@ -0,0 +1,54 @@
+/*
+ * Filename: eltwise_pe.hpp
+ * -------------------------
+ * This file exports the class EltwisePe, which merges the residual branch with
+ * the shortcut of the residual block. Each output channel combines the same
+ * channel of all the bottom blobs (sum, product or max), and the handshake
+ * protocols are merged as the ConcatPe.
+ */
+
+#ifndef __ELTWISE_PE_HPP__
+#define __ELTWISE_PE_HPP__
+
+#include "header/systemc/data_type.hpp"
+#include "proto/caffe.pb.h"
+#include <systemc.h>
+
+class EltwisePe : public sc_module {
+  // ports
+  public:
+    // input data of the multiple bottom blobs
+    sc_in<bool>* prev_layer_valid;
+    sc_out<bool>* prev_layer_rdy;
+    sc_in<PayloadBus>* prev_layer_data;
+    // output data of the single top blob
+    sc_in<bool> next_layer_rdy;
+    sc_out<bool> next_layer_valid;
+    sc_out<PayloadBus> next_layer_data;
+
+    SC_HAS_PROCESS(EltwisePe);
+
+  private:
+    // instance variables
+    int Nin_;         // feature map depth of each bottom blob
+    int numInputs_;   // the number of bottom blobs
+    caffe::EltwiseParameter_EltwiseOp op_;  // element-wise operation
+    PayloadBus eltwise_data_;   // combined data of the bottom blobs
+
+  public:
+    // constructor
+    explicit EltwisePe(sc_module_name module_name, int Nin, int numInputs,
+        caffe::EltwiseParameter_EltwiseOp op);
+    // destructor
+    ~EltwisePe();
+
+    // main process
+    void EltwisePeNextData();
+    void EltwisePeNextValid();
+    void EltwisePePreRdy();
+
+    // helper function to detect all valid
+    bool PrevLayerAllValid() const;
+};
+
+#endif
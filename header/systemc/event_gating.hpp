@@ -0,0 +1,37 @@
+/*
+ * Filename: event_gating.hpp
+ * ---------------------------
+ * This file exports the helpers of the event-driven gating of the datapath
+ * units, whose SC_METHODs are sensitive to the clock edge & reset but do
+ * nothing while disabled. A disabled unit sleeps until its enable rises (or
+ * reset changes) instead of waking up on every clock edge. The enable rises
+ * in a delta cycle after the clock edge it is written at, so the woken unit
+ * only restores the clock sensitivity, and samples the enable at the next
+ * edge as before. The outputs & the dynamic energy are unchanged.
+ */
+
+#ifndef __EVENT_GATING_HPP__
+#define __EVENT_GATING_HPP__
+
+#include <systemc.h>
+
+// whether the process is woken up by the enable rather than the clock edge or
+// reset, in which case it is triggered again by the next clock edge
+inline bool WokenUpByEnable(const sc_in<bool>& clock,
+    const sc_in<bool>& reset) {
+  if (reset.read() || clock.posedge()) {
+    return false;
+  }
+  next_trigger();
+  return true;
+}
+
+// sleep until the enable rises if it is deasserted
+inline void SleepUntilEnabled(const sc_in<bool>& enable,
+    const sc_in<bool>& reset) {
+  if (!enable.read()) {
+    next_trigger(enable.posedge_event() | reset.value_changed_event());
+  }
+}
+
+#endif
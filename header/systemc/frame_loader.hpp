@@ -0,0 +1,47 @@
+/*
+ * Filename: frame_loader.hpp
+ * ---------------------------
+ * This file exports the class FrameLoader, which reads one input frame of the
+ * ConvNetAcc from an image file, either a NumPy .npy array (float32, float64,
+ * uint8 or int8) or a raw file of little-endian float32. Both are in the
+ * (C, H, W) order of caffe, and the pixels are returned channel-interleaved,
+ * i.e. in the streaming order of the input layer.
+ */
+
+#ifndef __FRAME_LOADER_HPP__
+#define __FRAME_LOADER_HPP__
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+class FrameLoader {
+  public:
+    // constructor: frame of Nin channels & spatial_dim pixels per channel
+    explicit FrameLoader(int Nin, int spatial_dim) : Nin_(Nin),
+      spatial_dim_(spatial_dim) {}
+    ~FrameLoader() {}
+
+    /*
+     * Method: Load
+     * -------------
+     * Read the frame file to pixels, where the cth channel of the pth pixel is
+     * pixels[p*Nin+c]. Exits if the file does not hold exactly one frame.
+     */
+    void Load(const std::string& filename, std::vector<double>* pixels) const;
+
+  private:
+    // parse the header of the .npy file, returns the offset of the data and
+    // sets the element type descriptor & the no. of elements
+    static size_t ParseNpyHeader(const std::string& filename,
+        const std::vector<uint8_t>& buffer, std::string* descr,
+        long int* count);
+    // decode the ith little-endian element of the type descriptor
+    static double Decode(const uint8_t* data, const std::string& descr,
+        long int i);
+
+    int Nin_;           // input channel depth
+    int spatial_dim_;   // no. of pixels per channel
+};
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Filename: global_pool_array.hpp
+ * --------------------------------
+ * This file exports the class GlobalPoolArray. It folds the input tiles of
+ * each pixel into the per channel accumulators of the global pooling layer
+ * (MAX or AVG), so the state is one accumulator per channel rather than the
+ * sliding window of the entire feature map.
+ */
+
+#ifndef __GLOBAL_POOL_ARRAY_HPP__
+#define __GLOBAL_POOL_ARRAY_HPP__
+
+#include "header/systemc/data_type.hpp"
+#include "header/systemc/checkpoint.hpp"
+#include "header/systemc/pool_array.hpp"
+#include "header/systemc/models/adder_model.hpp"
+#include "header/systemc/models/comparator_model.hpp"
+#include "header/systemc/models/memory_model.hpp"
+#include <systemc.h>
+#include <vector>
+
+class GlobalPoolArray : public sc_module {
+  // ports
+  public:
+    sc_in<bool> clock;
+    sc_in<bool> reset;
+
+    // pool array enable
+    sc_in<bool> pool_array_en;
+    // input tile index of the accumulators
+    sc_in<int> pool_array_select;
+    // first pixel (load the accumulators) & last pixel (output the results)
+    sc_in<bool> pool_array_first;
+    sc_in<bool> pool_array_last;
+    // pool array input data
+    sc_in<Payload>* pool_array_in_data;
+    // pool array output data
+    sc_out<Payload>* pool_array_out_data;
+
+    SC_HAS_PROCESS(GlobalPoolArray);
+
+    // area model of the pool array
+    double Area() const;
+    // power model of the pool array
+    double StaticPower() const;
+    double DynamicPower() const;
+    double TotalPower() const;
+
+    // memory size of the accumulators
+    inline int MemoryDepth() const { return acc_model_->memory_depth(); }
+    inline int MemoryWidth() const { return acc_model_->memory_width(); }
+
+    // checkpoint of the accumulators, where the restored accumulators are
+    // loaded on reset
+    void SaveState(Checkpoint* checkpoint) const;
+    void RestoreState(Checkpoint* checkpoint);
+
+  public:
+    // constructor
+    explicit GlobalPoolArray(sc_module_name module_name, int h, int w, int Nin,
+        int Pin, PoolArray::PoolMethod pool_method=PoolArray::MAX,
+        int bit_width=8, int tech_node=28, double clk_freq=1.);
+    // destructor
+    ~GlobalPoolArray();
+
+    // main process of the GlobalPoolArray
+    void GlobalPoolArrayProc();
+
+  private:
+    int h_, w_;               // input feature map spatial dimension
+    int Nin_;                 // input feature map channel number
+    int Pin_;                 // input parallelism
+    PoolArray::PoolMethod pool_method_; // pool method: max or avg
+
+    // accumulator of each channel (sum or max), wide enough for the sum of
+    // the frame
+    std::vector<double> acc_;
+    std::vector<double> reset_acc_;
+
+    // adder or comparator model of the accumulation
+    AdderModel* adder_model_;
+    ComparatorModel* comparator_model_;
+    // accumulator memory model: ceil(Nin/Pin) tiles of Pin accumulators
+    MemoryModel* acc_model_;
+    double dynamic_energy_;
+};
+
+#endif
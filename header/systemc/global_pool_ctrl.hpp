@@ -0,0 +1,98 @@
+/*
+ * Filename: global_pool_ctrl.hpp
+ * -------------------------------
+ * This file exports the class GlobalPoolCtrl, which is the control module of
+ * the global pooling layer, i.e. the pooling window covers the entire input
+ * feature map without padding. Each accepted pixel is folded into the per
+ * channel accumulators right away, tile by tile, and the only output pixel of
+ * the frame is sent after the last input pixel.
+ */
+
+#ifndef __GLOBAL_POOL_CTRL_HPP__
+#define __GLOBAL_POOL_CTRL_HPP__
+
+#include "header/systemc/checkpoint.hpp"
+#include <systemc.h>
+
+class GlobalPoolCtrl : public sc_module {
+  // ports
+  public:
+    sc_in<bool> clock;
+    sc_in<bool> reset;
+    // handshake for the previous layer
+    sc_in<bool> prev_layer_valid;
+    sc_out<bool> prev_layer_rdy;
+    // handshake for the next layer
+    sc_in<bool> next_layer_rdy;
+    sc_out<bool> next_layer_valid;
+
+    // control signal for each arithmetic unit
+    // pixel mux
+    sc_out<bool> pixel_load;
+    sc_out<bool> pixel_mux_en;
+    sc_out<int> pixel_mux_select;
+    // global pool array
+    sc_out<bool> pool_array_en;
+    sc_out<int> pool_array_select;
+    sc_out<bool> pool_array_first;
+    sc_out<bool> pool_array_last;
+    // demux output register
+    sc_out<bool> demux_out_reg_enable;
+    sc_out<int> demux_select;
+
+    SC_HAS_PROCESS(GlobalPoolCtrl);
+
+  public:
+    // constructor
+    explicit GlobalPoolCtrl(sc_module_name module_name, int h, int w, int Nin,
+        int Pin, int extra_pipeline_stage=0);
+    // destructor
+    ~GlobalPoolCtrl() {}
+
+    // main process of the GlobalPoolCtrl
+    void GlobalPoolCtrlProc();    // main control process
+    void PoolArrayCtrlProc();     // pool array control process
+    void DemuxOutRegCtrlProc();   // demux output register control process
+    void PixelLoad();             // combination logic for pixel load
+
+    // pipeline stages: Pixel Mux, POOL, Demux
+    static const int PIPELINE_STAGE = 3;
+
+    // whether the controller waits for the input pixel that is not valid yet,
+    // i.e. the layer is drained
+    inline bool WaitingInput() const {
+      return waiting_input_ && !prev_layer_valid.read();
+    }
+    // checkpoint of the feature map counter, where the restored counter is
+    // loaded on reset
+    void SaveState(Checkpoint* checkpoint) const;
+    void RestoreState(Checkpoint* checkpoint);
+
+  private:
+    int h_, w_;                 // input feature map spatial dimension
+    int Nin_;                   // channel depth for input feature map
+    int Pin_;                   // input parallelism
+
+    // extra pipeline stage (model the fact that ADD, MUX may take multiple
+    // clock cycles)
+    int extra_pipeline_stage_;
+    // flag for each pipeline stage
+    bool pipeline_flags_[PIPELINE_STAGE];
+
+    // temporary variables used for pipelining
+    // input tile index & first / last pixel (used by PoolArrayCtrlProc)
+    int tile_idx_pool_ctrl_;
+    bool first_pixel_pool_ctrl_;
+    bool last_pixel_pool_ctrl_;
+    // input tile index & last pixel (used by DemuxOutRegCtrlProc)
+    int tile_idx_demux_out_ctrl_;
+    bool last_pixel_demux_out_ctrl_;
+
+    // received pixels of the current feature map, which is
+    // reset_feat_pixel_counter_ on reset (0 unless restored)
+    int feat_pixel_counter_;
+    int reset_feat_pixel_counter_;
+    bool waiting_input_;
+};
+
+#endif
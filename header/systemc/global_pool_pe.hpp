@@ -0,0 +1,93 @@
+/*
+ * Filename: global_pool_pe.hpp
+ * -----------------------------
+ * This file exports the class GlobalPoolPe, which is the processing element of
+ * the global pooling layer, i.e. the pooling window covers the entire input
+ * feature map without padding. Instead of buffering the feature map, it keeps
+ * one accumulator per channel across the frame. The module mainly contains:
+ *
+ * a) GlobalPoolCtrl: FSM control module folding each accepted pixel into the
+ *    accumulators, and sending the output pixel once per frame.
+ *
+ * b) PixelMux: holds the accepted pixel and selects its input tiles.
+ *
+ * c) GlobalPoolArray: max / avg accumulators of all input channels.
+ *
+ * d) DemuxOutReg: output register holding the results of the frame.
+ */
+
+#ifndef __GLOBAL_POOL_PE_HPP__
+#define __GLOBAL_POOL_PE_HPP__
+
+#include "header/systemc/data_type.hpp"
+#include "header/systemc/global_pool_ctrl.hpp"
+#include "header/systemc/pixel_mux.hpp"
+#include "header/systemc/global_pool_array.hpp"
+#include "header/systemc/demux_out_reg.hpp"
+#include <systemc.h>
+
+class GlobalPoolPe : public sc_module {
+  friend class Top;
+  // ports
+  public:
+    sc_in<bool> clock;
+    sc_in<bool> reset;
+    // input data from the previous layer
+    sc_in<bool> prev_layer_valid;
+    sc_out<bool> prev_layer_rdy;
+    sc_in<PayloadBus> prev_layer_data;
+
+    // output to the next layer
+    sc_in<bool> next_layer_rdy;
+    sc_out<bool> next_layer_valid;
+    sc_out<PayloadBus> next_layer_data;
+
+    SC_HAS_PROCESS(GlobalPoolPe);
+
+    double Area() const;
+    double StaticPower() const;
+    double DynamicPower() const;
+    double TotalPower() const;
+
+  private:
+    // internal modules
+    GlobalPoolCtrl* global_pool_ctrl_;
+    PixelMux* pixel_mux_;
+    GlobalPoolArray* global_pool_array_;
+    DemuxOutReg* demux_out_reg_;
+
+  private:
+    int Nin_;     // input feature map channel number
+    int Pin_;     // input parallelism
+    PayloadBus next_data_;  // output registers gathered on the output bus
+
+  public:
+    // internal interconnections
+    sc_signal<bool> pixel_load_;
+    sc_signal<bool> pixel_mux_en_;
+    sc_signal<int> pixel_mux_select_;
+    sc_signal<Payload>* pixel_mux_out_data_;
+    sc_signal<bool> pool_array_en_;
+    sc_signal<int> pool_array_select_;
+    sc_signal<bool> pool_array_first_;
+    sc_signal<bool> pool_array_last_;
+    sc_signal<Payload>* pool_array_out_data_;
+    // the output register holds the results until the next frame
+    sc_signal<bool> demux_out_reg_clear_;
+    sc_signal<bool> demux_out_reg_enable_;
+    sc_signal<int> demux_select_;
+    sc_signal<Payload>* out_reg_data_;
+
+  public:
+    // constructor
+    explicit GlobalPoolPe(sc_module_name module_name, int h, int w, int Nin,
+        int Pin, PoolArray::PoolMethod pool_method=PoolArray::MAX,
+        int bit_width=8, int tech_node=28, double clk_freq=1.);
+    // destructor
+    ~GlobalPoolPe();
+
+    // next_layer_data connection
+    void NextLayerDataConnect();
+};
+
+#endif
@@ -2,16 +2,20 @@
  * Filename: line_buffer_array.hpp
  * --------------------------------
  * This file exports the behavior model of LineBufferArray. It is the
- * aggregation of the Nin line buffers.
+ * aggregation of the Nin line buffers, which are modeled by one circular buffer
+ * holding the recent pixels of all Nin channels. With the spatial parallelism
+ * Pw > 1, it accepts up to Pw*Stride_w pixels per write and exposes the Pw
+ * sliding windows of adjacent output columns.
  */
 
 #ifndef __LINE_BUFFER_ARRAY_HPP__
 #define __LINE_BUFFER_ARRAY_HPP__
 
+#include "header/systemc/checkpoint.hpp"
 #include "header/systemc/data_type.hpp"
 #include "header/systemc/models/memory_model.hpp"
-#include "header/systemc/line_buffer.hpp"
 #include <systemc.h>
+#include <vector>
 
 class LineBufferArray : public sc_module {
   // ports
@@ -20,13 +24,16 @@ class LineBufferArray : public sc_module {
     sc_in<bool> reset;
     // input data & valid
     sc_in<bool> input_data_valid;
-    sc_in<Payload>* input_data;
-    // output data: expose Nin * Kh * Kw data
+    sc_in<PayloadBus> input_data;
+    // no. of pixels of the input data (only read if Pw*Stride_w > 1)
+    sc_in<int> input_pixel_num;
+    // pixels streamed in after the last pixel of the newest window (only read
+    // if Pw > 1)
+    sc_in<int> output_window_offset;
+    // output data: expose Pw * Nin * Kh * Kw data, where the window of output
+    // column k lies Stride_w*k pixels before the one of column 0
     sc_out<Payload>* output_data;
 
-    // line buffer
-    LineBuffer** line_buffer_;
-
     SC_HAS_PROCESS(LineBufferArray);
 
     MemoryModel* memory_model_;
@@ -47,16 +54,39 @@ class LineBufferArray : public sc_module {
   public:
     // constructor
     explicit LineBufferArray(sc_module_name module_name, int Kh, int Kw, int h,
-        int w, int Nin, int bit_width=8, int tech_node=28, double clk_freq=1.);
+        int w, int Nin, int bit_width=8, int tech_node=28, double clk_freq=1.,
+        int Pw=1, int Stride_w=1);
     ~LineBufferArray();
 
-    // dynamic power management
-    void PowerManagement();
+    // main process of the line buffer array
+    void LineBufferArrayProc();
+
+    // checkpoint of the circular buffer, where the restored state is loaded
+    // on reset
+    void SaveState(Checkpoint* checkpoint) const;
+    void RestoreState(Checkpoint* checkpoint);
 
   private:
+    // write the sliding window of Kh*Kw pixels to the output data
+    void WriteWindow();
+
     int Kh_, Kw_;     // kernel spatial dimension
     int h_, w_;       // input feature map dimension
     int Nin_;         // input feature map number
+    int Pw_;          // output columns of the sliding windows
+    int Stride_w_;    // horizontal stride between the windows
+    int pixels_;      // max pixels per write: Pw*Stride_w if Pw > 1, 1 else
+    int sram_depth_;  // sram depth between two rows of DFFs
+
+    // circular buffer of the last ring_size_ pixels, each of Nin payloads,
+    // where the ith last streamed pixel is at slot (head_+i) % ring_size_
+    std::vector<Payload> ring_;
+    int window_size_; // pixels spanned by one sliding window
+    int ring_size_;   // window_size_ + pixels_ - 1
+    int head_;
+    // state loaded on reset: all zeros unless restored from the checkpoint
+    std::vector<Payload> reset_ring_;
+    int reset_head_;
 };
 
 #endif
@@ -49,6 +49,12 @@ class LineBufferMux : public sc_module {
     double TotalPower() const;
 
   private:
+    // select the sliding windows of Pin input channels, where the window size
+    // KERNEL_SIZE is known at compile time (Kh_*Kw_ if 0)
+    template <int KERNEL_SIZE> void SelectWindows(int select);
+    // SelectWindows of the kernel size selected at elaboration
+    void (LineBufferMux::*select_windows_)(int select);
+
     int Kh_, Kw_;   // spatial dimension of the kernel
     int Nin_;       // no. input feature map
     int Pin_;       // input parallelism
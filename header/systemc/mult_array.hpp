@@ -33,7 +33,7 @@ class MultArray : public sc_module {
     // constructor
     explicit MultArray(sc_module_name module_name, int Kh, int Kw, int Pin,
         int Pout, int Pk, int bit_width=8, int tech_node=28,
-        double clk_freq=1.);
+        double clk_freq=1., bool zero_gating=false);
     // destructor
     ~MultArray();
 
@@ -47,13 +47,27 @@ class MultArray : public sc_module {
     double DynamicPower() const;
     double TotalPower() const;
 
+    // no. of valid multiplications & the ones gated by a zero operand
+    inline long int num_ops() const { return num_ops_; }
+    inline long int num_gated_ops() const { return num_gated_ops_; }
+
   private:
+    // multiply the Pin sliding windows with the weights of Pout outputs,
+    // where the kernel parallelism PK is known at compile time (Pk_ if 0)
+    template <int PK> void Multiply();
+    // Multiply of the kernel parallelism selected at elaboration
+    void (MultArray::*multiply_)();
+
     int Kh_, Kw_;     // spatial dimension of kernel
     int Pin_, Pout_;  // input parallelism & output parallelism
     int Pk_;          // kernel parallelism
     // multipler model
     MultModel* mult_model_;
     double dynamic_energy_;
+    // gate the multiplier with a zero operand (no dynamic energy)
+    bool zero_gating_;
+    long int num_ops_;
+    long int num_gated_ops_;
 };
 
 #endif
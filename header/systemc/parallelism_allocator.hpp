@@ -0,0 +1,162 @@
+/*
+ * Filename: parallelism_allocator.hpp
+ * ------------------------------------
+ * This file exports the class ParallelismAllocator, which determines the
+ * parallelism (Pin, Pout, Pk) of all layers of the ConvNet, either from the
+ * target pixel inference rate or under a global multiplier or area budget. The
+ * convolution fed by the input layer may further compute Pw adjacent output
+ * columns per pass (spatial parallelism) if its few input channels cannot meet
+ * the rate otherwise. It also estimates the area & static power of the
+ * resulted accelerator analytically, without elaborating the SystemC model.
+ */
+
+#ifndef __PARALLELISM_ALLOCATOR_HPP__
+#define __PARALLELISM_ALLOCATOR_HPP__
+
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include "header/caffe/net.hpp"
+#include "proto/config.pb.h"
+
+class ParallelismAllocator {
+  public:
+    // budget type of the allocation
+    enum BudgetType { MULTIPLIER, AREA };
+
+    // pipeline stage within the processing element of ConvNetAcc
+    static const int PIPELINE_STAGE = 6;
+
+    // layer dimension required to determine the parallelism
+    struct LayerDim {
+      int layer_id;
+      std::string name;
+      std::string type;     // {Convolution, InnerProduct, Pooling}
+      int Nin, Nout;        // Nout = 0 for pooling layer
+      int Kh, Kw;           // kernel size
+      int h, w;             // output spatial dimension
+      bool max_pool;        // MAX (true) or AVG (false) for pooling layer
+      // global pooling layer, which is paced by its input pixels
+      bool global_pool;
+      // line buffer dimension: input spatial dimension & padding
+      int in_h, in_w;
+      int pad_h, pad_w;
+      int stride_w;         // horizontal stride (CONV)
+      // the convolution (with line buffer) reads the input layer directly, so
+      // that it can take several input pixels per handshake
+      bool spatial_unrolling;
+      // bit width of the processing element & its appended channel buffer
+      int bit_width, out_bit_width;
+    };
+
+    // allocation result of one layer
+    struct LayerAllocation {
+      int Pin, Pout, Pk;
+      int Pw;                   // output columns per pass
+      long int inference_rate;  // layer inference rate [cycle]
+      int num_mults;            // number of multipliers
+      double area;              // parallelism dependent area [um2]
+    };
+
+    // constructor: extract the layer dimension from the parsed network. The
+    // VerilogCompiler constrains the budget allocation to its RTL datapath:
+    // at least min_out_iter output tiles per CONV & FC layer, and no spatial
+    // unrolling.
+    explicit ParallelismAllocator(const Net& net, const config::ConfigParameter&
+        config_param, int pipeline_stage=PIPELINE_STAGE, int min_out_iter=1,
+        bool spatial_unrolling=true);
+    ~ParallelismAllocator() {}
+
+    /*
+     * Method: AllocateByRate
+     * Usage: allocator.AllocateByRate(pixel_inference_rate);
+     * -------------------------------------------------------
+     * Determine the parallelism of each layer independently, such that each
+     * layer inference rate is close to the input layer inference rate, i.e.
+     * the pixel_inference_rate times the input spatial dimension.
+     */
+    void AllocateByRate(int pixel_inference_rate);
+
+    /*
+     * Method: Allocate
+     * Usage: allocator.Allocate(ParallelismAllocator::AREA, 1e7);
+     * ------------------------------------------------------------
+     * Search for the minimum bottleneck layer inference rate such that the
+     * total cost does not exceed the budget, and allocate the cheapest
+     * parallelism meeting that rate to each layer. Exits if the budget cannot
+     * even afford the fully sequential design.
+     */
+    void Allocate(BudgetType budget_type, double budget);
+
+    // outputs the per-layer allocation table
+    void Summary(std::ostream& os=std::cout) const;
+
+    // analytical area [um2] & static power [uW] of the allocated accelerator,
+    // consistent with the Area() & StaticPower() of the SystemC modules. The
+    // appended channel buffers are counted at their full capacity, and the
+    // unbounded inception buffers (sized by simulation) are excluded.
+    double Area() const;
+    double StaticPower() const;
+
+    // getters
+    inline const std::vector<LayerDim>& layers() const { return layers_; }
+    inline const std::map<int, LayerAllocation>& allocation() const {
+      return allocation_;
+    }
+    inline int input_spatial_dim() const { return input_spatial_dim_; }
+    inline int output_spatial_dim() const { return output_spatial_dim_; }
+    inline long int max_inference_rate() const { return max_inference_rate_; }
+    inline int input_width() const { return input_width_; }
+
+    // no. of input pixels per handshake of the input layer: Pw*stride_w of
+    // the spatially unrolled layer, 1 otherwise
+    int InputPixels() const;
+
+  private:
+    // parallelism of one layer approaching the target layer inference rate
+    void CalculateParallelsim(const LayerDim& layer, int layer_inference_rate,
+        LayerAllocation* result) const;
+    // area or static power of one layer's processing element & appended buffer
+    double LayerMetric(const LayerDim& layer, const LayerAllocation&
+        allocation, bool area) const;
+    // cheapest allocation of one layer with inference rate no more than
+    // max_rate, returns false if the rate is not achievable
+    bool AllocateLayer(const LayerDim& layer, long int max_rate,
+        BudgetType budget_type, LayerAllocation* result) const;
+    // parallelism dependent area of one layer
+    double LayerArea(const LayerDim& layer, int Pin, int Pout, int Pk,
+        int Pw=1) const;
+    // layer inference rate of iter cycles per pass, where each pass computes
+    // Pw adjacent output columns and sends them in Pw handshakes
+    long int LayerRate(const LayerDim& layer, long int iter, int Pw) const;
+    // max Pw of the layer: its output width if spatially unrolled, 1 otherwise
+    inline int MaxSpatialParallelism(const LayerDim& layer) const {
+      return layer.spatial_unrolling ? layer.w : 1;
+    }
+    // total cost of all layers with inference rate no more than max_rate,
+    // returns a negative cost if the rate is not achievable
+    double TotalCost(long int max_rate, BudgetType budget_type) const;
+
+    std::vector<LayerDim> layers_;
+    std::map<int, LayerAllocation> allocation_;
+    int input_spatial_dim_;
+    int input_width_;
+    int output_spatial_dim_;
+    long int max_inference_rate_;
+
+    // hardware settings
+    int pipeline_stage_;
+    int min_out_iter_;
+    int tech_node_;
+    double clk_freq_;
+    config::ConfigParameter_MemoryType memory_type_;
+    bool kernel_unrolling_flag_;
+    int append_buffer_capacity_;
+    // area of the arithmetic units [um2], key: bit width
+    std::map<int, double> mult_area_;
+    std::map<int, double> adder_area_;
+    std::map<int, double> comparator_area_;
+};
+
+#endif
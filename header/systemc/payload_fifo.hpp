@@ -0,0 +1,62 @@
+/*
+ * Filename: payload_fifo.hpp
+ * ---------------------------
+ * This file exports the class PayloadFifo, the FIFO of the pixels in the
+ * ChannelBuffer. The pixels (each of width payloads) are stored in one
+ * contiguous ring indexed by the head & size, so pushing & popping a pixel is
+ * a block copy without allocation. The ring of a bounded FIFO is allocated to
+ * its capacity up front; the unbounded FIFO (capacity INT_MAX) doubles its
+ * ring when it is full.
+ */
+
+#ifndef __PAYLOAD_FIFO_HPP__
+#define __PAYLOAD_FIFO_HPP__
+
+#include "header/systemc/data_type.hpp"
+#include <vector>
+
+class PayloadFifo {
+  public:
+    // constructor: FIFO of at most capacity pixels
+    explicit PayloadFifo(int width, int capacity);
+    ~PayloadFifo() {}
+
+    // push one pixel of width payloads to the back
+    void Push(const Payload* pixel);
+    // copy the front pixel to *pixel, which is of width payloads
+    void Front(PayloadBus* pixel) const;
+    // pop the front pixel
+    void Pop();
+    // remove all pixels
+    inline void Clear() { head_ = size_ = 0; }
+
+    // ith pixel from the front
+    inline const Payload* At(int i) const {
+      int slot = head_ + i;
+      if (slot >= num_slots_) {
+        slot -= num_slots_;
+      }
+      return &ring_[static_cast<long int>(slot)*width_];
+    }
+
+    // getters
+    inline int size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+    inline int width() const { return width_; }
+
+  private:
+    // double the slots of the unbounded FIFO
+    void Grow();
+
+    // initial no. of slots of the unbounded FIFO
+    static const int INIT_SLOTS = 16;
+
+    int width_;       // payloads per pixel
+    int capacity_;    // max no. of pixels
+    int num_slots_;   // no. of pixels allocated
+    std::vector<Payload> ring_;
+    int head_;        // slot of the front pixel
+    int size_;        // no. of pixels
+};
+
+#endif
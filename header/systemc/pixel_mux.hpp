@@ -0,0 +1,68 @@
+/*
+ * Filename: pixel_mux.hpp
+ * ------------------------
+ * This file exports the PixelMux stage of the pointwise (1x1 kernel without
+ * padding) convolutional layer, which replaces the LineBufferArray & the
+ * LineBufferMux. The first Pin channels of the accepted pixel are loaded into
+ * the output registers in the handshake cycle, and the remaining channels are
+ * held in the pixel register to be selected by the following input tiles.
+ */
+
+#ifndef __PIXEL_MUX_HPP__
+#define __PIXEL_MUX_HPP__
+
+#include "header/systemc/data_type.hpp"
+#include "header/systemc/models/mux_model.hpp"
+#include <systemc.h>
+#include <vector>
+
+class PixelMux : public sc_module {
+  // ports
+  public:
+    sc_in<bool> clock;
+    sc_in<bool> reset;
+
+    // load the input pixel (handshake with the previous layer)
+    sc_in<bool> pixel_load;
+    sc_in<PayloadBus> pixel_data;
+    // mux enable & selector of the input tile
+    sc_in<bool> mux_en;
+    sc_in<int> mux_select;
+    // output data to the multiplier array (Pin)
+    sc_out<Payload>* mux_data_out;
+
+    SC_HAS_PROCESS(PixelMux);
+
+  public:
+    // constructor
+    explicit PixelMux(sc_module_name module_name, int Nin, int Pin,
+        int bit_width=8, int tech_node=28, double clk_freq=1.);
+    // destructor
+    ~PixelMux();
+
+    // main process of the pixel mux
+    void PixelMuxProc();
+
+    // area model of the pixel mux
+    double Area() const;
+    // power model of the pixel mux
+    double StaticPower() const;
+    double DynamicPower() const;
+    double TotalPower() const;
+
+  private:
+    // write the channels of the ith input tile from the pixel to the outputs
+    void SelectTile(const std::vector<Payload>& pixel, int select);
+
+    int Nin_;       // no. input feature map
+    int Pin_;       // input parallelism
+
+    // accepted pixel, whose first Pin channels are not read after loaded
+    std::vector<Payload> pixel_;
+
+    // mux model
+    MuxModel* mux_model_;
+    double dynamic_energy_;
+};
+
+#endif
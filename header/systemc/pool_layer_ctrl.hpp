@@ -11,6 +11,7 @@
 #ifndef __POOL_LAYER_CTRL_HPP__
 #define __POOL_LAYER_CTRL_HPP__
 
+#include "header/systemc/checkpoint.hpp"
 #include <systemc.h>
 #include <utility>
 
@@ -57,6 +58,19 @@ class PoolLayerCtrl : public sc_module {
     void DemuxOutRegCtrlProc(); // demux output register control process
     void LineBufferValid();     // combination logic for line buffer valid
 
+    // pipeline stages: Line buffer Mux, POOL, Demux
+    static const int PIPELINE_STAGE = 3;
+
+    // whether the controller waits for the input pixel that is not valid yet,
+    // i.e. the layer is drained
+    inline bool WaitingInput() const {
+      return waiting_input_ && !prev_layer_valid.read();
+    }
+    // checkpoint of the feature map counter, where the restored counter is
+    // loaded on reset
+    void SaveState(Checkpoint* checkpoint) const;
+    void RestoreState(Checkpoint* checkpoint);
+
   private:
     int Kh_, Kw_;               // kernel spatial dimension
     int h_, w_;                 // input feature map spatial dimension
@@ -66,7 +80,6 @@ class PoolLayerCtrl : public sc_module {
     int Stride_h_, Stride_w_;   // stride dimension
 
     // internal pipeline stage variables
-    static const int PIPELINE_STAGE = 3;
     // extra pipeline stage in POOL PE (model the fact that ADD, MUX may take
     // multiple clock cycles)
     int extra_pipeline_stage_;
@@ -78,6 +91,12 @@ class PoolLayerCtrl : public sc_module {
     int in_feat_idx_pool_ctrl_;
     // input feature map index (used by DemuxOutRegCtrlProc)
     int in_feat_idx_demux_out_ctrl_;
+
+    // received & padded pixels of the current feature map, which is
+    // reset_feat_pixel_counter_ on reset (0 unless restored)
+    int feat_pixel_counter_;
+    int reset_feat_pixel_counter_;
+    bool waiting_input_;
 };
 
 #endif
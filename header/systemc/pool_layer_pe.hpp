@@ -39,12 +39,12 @@ class PoolLayerPe : public sc_module {
     // input data from the previous layer
     sc_in<bool> prev_layer_valid;
     sc_out<bool> prev_layer_rdy;
-    sc_in<Payload>* prev_layer_data;
+    sc_in<PayloadBus> prev_layer_data;
 
     // output to the next layer
     sc_in<bool> next_layer_rdy;
     sc_out<bool> next_layer_valid;
-    sc_out<Payload>* next_layer_data;
+    sc_out<PayloadBus> next_layer_data;
 
     SC_HAS_PROCESS(PoolLayerPe);
 
@@ -64,12 +64,17 @@ class PoolLayerPe : public sc_module {
   private:
     int Nin_;     // input feature map channel number
     int Pin_;     // input parallelism
+    PayloadBus next_data_;  // output registers gathered on the output bus
+    PayloadBus zero_data_;  // zero padding of the line buffer input
 
   public:
     // internal interconnections
     sc_signal<bool> line_buffer_valid_;
-    sc_signal<Payload>* line_buffer_in_data_;
+    PayloadBusSignal* line_buffer_in_data_;
     sc_signal<bool> line_buffer_zero_in_;
+    // one pixel per write & one sliding window
+    sc_signal<int> line_buffer_pixel_num_;
+    sc_signal<int> line_buffer_window_offset_;
     sc_signal<Payload>* line_buffer_out_data_;
     sc_signal<bool> line_buffer_mux_en_;
     sc_signal<int> line_buffer_mux_select_;
@@ -80,6 +85,7 @@ class PoolLayerPe : public sc_module {
     sc_signal<bool> demux_out_reg_clear_;
     sc_signal<bool> demux_out_reg_enable_;
     sc_signal<int> demux_select_;
+    sc_signal<Payload>* out_reg_data_;
 
   public:
     // constructor
@@ -92,6 +98,9 @@ class PoolLayerPe : public sc_module {
 
     // line buffer zero padding mux
     void LineBufferInMux();
+
+    // next_layer_data connection
+    void NextLayerDataConnect();
 };
 
 #endif
@@ -0,0 +1,53 @@
+/*
+ * Filename: slice_pe.hpp
+ * -----------------------
+ * This file exports the class SlicePe, which demultiplexes the output channels
+ * of the fused sibling convolutions into the branch blobs. The handshake is the
+ * one of the SplitPe, while each top blob only takes its channel range of the
+ * bottom data.
+ */
+
+#ifndef __SLICE_PE_HPP__
+#define __SLICE_PE_HPP__
+
+#include "header/systemc/data_type.hpp"
+#include <systemc.h>
+#include <vector>
+
+class SlicePe : public sc_module {
+  // port
+  public:
+    // input data of the single bottom blob
+    sc_in<bool> prev_layer_valid;
+    sc_out<bool> prev_layer_rdy;
+    sc_in<PayloadBus> prev_layer_data;
+    // output data of the multiple top blobs
+    sc_in<bool>* next_layer_rdy;
+    sc_out<bool>* next_layer_valid;
+    sc_out<PayloadBus>* next_layer_data;
+
+    SC_HAS_PROCESS(SlicePe);
+
+  private:
+    // instance variables
+    int Nin_;         // input feature map depth
+    int numSlices_;   // the number of output slices
+    std::vector<PayloadBus> slice_data_;  // channel range of each top blob
+
+  public:
+    // constructor: Nout[i] channels of the ith top blob, which sum up to Nin
+    explicit SlicePe(sc_module_name module_name, int Nin,
+        const std::vector<int>& Nout);
+    // destructor
+    ~SlicePe();
+
+    // main process
+    void SlicePeNextData();
+    void SlicePeNextValid();
+    void SlicePePrevRdy();
+
+    // helper function to detect all ready
+    bool NextLayerAllReady() const;
+};
+
+#endif
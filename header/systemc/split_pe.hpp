@@ -18,11 +18,11 @@ class SplitPe : public sc_module {
     // input data of the single bottom blob
     sc_in<bool> prev_layer_valid;
     sc_out<bool> prev_layer_rdy;
-    sc_in<Payload>* prev_layer_data;
+    sc_in<PayloadBus> prev_layer_data;
     // output data of the multiple top blobs
     sc_in<bool>* next_layer_rdy;
     sc_out<bool>* next_layer_valid;
-    sc_out<Payload>* next_layer_data;
+    sc_out<PayloadBus>* next_layer_data;
 
     SC_HAS_PROCESS(SplitPe);
 
@@ -0,0 +1,106 @@
+/*
+ * Filename: stream_statistics.hpp
+ * --------------------------------
+ * This file exports the class StreamStatistics, the running statistics of the
+ * pixel stream shared by the Testbench & TlmTestbench. The memory is bounded
+ * regardless of the simulation length: the injection intervals keep the
+ * min/max and the first & last injection only, and the frame latencies (from
+ * the injection of the first input pixel to the reception of the last output
+ * pixel of the frame) are binned into a histogram, whose bins keep the
+ * PRECISION_BITS most significant bits of the latency.
+ */
+
+#ifndef __STREAM_STATISTICS_HPP__
+#define __STREAM_STATISTICS_HPP__
+
+#include <systemc.h>
+#include <deque>
+#include <map>
+#include <iostream>
+
+class StreamStatistics {
+  public:
+    // relative precision of the latency histogram: 2^-(PRECISION_BITS-1)
+    static const int PRECISION_BITS = 7;
+
+    // constructor: no. of input & output pixels per frame
+    explicit StreamStatistics(int input_frame_pixels, int output_frame_pixels);
+    ~StreamStatistics() {}
+
+    // record the injection of one input pixel
+    void RecordInjection(const sc_time& time);
+    // record the reception of one output pixel
+    void RecordOutput(const sc_time& time);
+
+    /*
+     * Method: Resume
+     * ---------------
+     * Resume the stream restored from a checkpoint, where injected_pixels &
+     * output_pixels were sent & received before. The frames in flight at the
+     * checkpoint are output in order but not recorded, since their start time
+     * is lost.
+     */
+    void Resume(long int injected_pixels, long int output_pixels);
+
+    /*
+     * Method: Report
+     * ---------------
+     * Report the injection intervals & the frame latency percentiles in
+     * cycles. The throughput is measured between the start & end of frame if
+     * early stopped (both non-zero), over all the injections otherwise.
+     */
+    void Report(const sc_time& clock_period, const sc_time& start_of_frame,
+        const sc_time& end_of_frame, int frame_pixels,
+        std::ostream& os=std::cout) const;
+
+    // avg injection interval, measured in the same way as the Report
+    sc_time AvgInterval(const sc_time& start_of_frame,
+        const sc_time& end_of_frame, int frame_pixels) const;
+    // avg frame latency, zero if no frame is completed
+    sc_time AvgLatency() const;
+
+    // getters
+    inline long int num_injections() const { return num_injections_; }
+    inline long int num_output_pixels() const { return num_output_pixels_; }
+    inline int completed_frames() const { return completed_frames_; }
+    // output pixels & frames of the stream, including the ones before the
+    // checkpoint resumed
+    inline long int stream_output_pixels() const {
+      return output_offset_ + num_output_pixels_;
+    }
+    inline long int stream_output_frames() const {
+      return stream_output_pixels() / output_frame_pixels_;
+    }
+
+  private:
+    // latency at the pth percentile, in the unit of the time resolution
+    sc_dt::uint64 LatencyPercentile(double p) const;
+
+    int input_frame_pixels_;
+    int output_frame_pixels_;
+
+    // injection intervals
+    long int num_injections_;
+    sc_time first_injection_;
+    sc_time last_injection_;
+    sc_time min_interval_;
+    sc_time max_interval_;
+
+    // injection time of the first pixel of the frames in flight
+    std::deque<sc_time> frame_start_;
+    long int num_output_pixels_;
+    int completed_frames_;
+    // pixels of the stream before the checkpoint resumed
+    long int injection_offset_;
+    long int output_offset_;
+    // frames in flight at the checkpoint, which are not recorded
+    int untracked_frames_;
+    // frame latency histogram: bin (lower bound) -> count, in the unit of the
+    // time resolution
+    std::map<sc_dt::uint64, long int> latency_histogram_;
+    sc_time min_latency_;
+    sc_time max_latency_;
+    sc_time total_latency_;
+};
+
+#endif
@@ -2,14 +2,21 @@
  * Filename: testbench.hpp
  * ------------------------
  * This file exports the class Testbench, which provides the input stimulus &
- * monitors output signals.
+ * monitors output signals. The stimulus is a stream of num_frames frames read
+ * from the input files in turn (synthetic pixels if none), and the latency of
+ * each frame is recorded by the StreamStatistics. Each handshake carries up to
+ * input_pixels adjacent pixels of an image row.
  */
 
 #ifndef __TESTBENCH_HPP__
 #define __TESTBENCH_HPP__
 
+#include "header/systemc/checkpoint.hpp"
 #include "header/systemc/data_type.hpp"
+#include "header/systemc/frame_loader.hpp"
+#include "header/systemc/stream_statistics.hpp"
 #include <systemc.h>
+#include <string>
 #include <vector>
 
 class Testbench : public sc_module {
@@ -20,25 +27,31 @@ class Testbench : public sc_module {
     // handshake input signals for ConvNetAcc
     sc_out<bool> input_layer_valid;
     sc_in<bool> input_layer_rdy;
-    sc_out<Payload>* input_layer_data;
+    sc_out<PayloadBus> input_layer_data;
     // handshake output signals for ConvNetAcc
     sc_out<bool> output_layer_rdy;
     sc_in<bool> output_layer_valid;
-    sc_in<Payload>* output_layer_data;
+    sc_in<PayloadBus> output_layer_data;
 
     SC_HAS_PROCESS(Testbench);
 
 
   public:
-    // constructor
+    // constructor: early stop after early_stop_frame_size frames if
+    // num_frames is non-positive
     explicit Testbench(sc_module_name module_name, int Nin, int Nout,
-        int input_spatial_dim, int early_stop_frame_size) :
+        int input_spatial_dim, int output_spatial_dim,
+        int early_stop_frame_size, int num_frames,
+        const std::vector<std::string>& input_files, int input_width=1,
+        int input_pixels=1) :
       sc_module(module_name), Nin_(Nin), Nout_(Nout),
-      input_spatial_dim_(input_spatial_dim),
-      early_stop_frame_size_(early_stop_frame_size) {
-      input_layer_data = new sc_out<Payload> [Nin];
-      output_layer_data = new sc_in<Payload> [Nout];
-
+      input_spatial_dim_(input_spatial_dim), input_width_(input_width),
+      input_pixels_(input_pixels),
+      statistics_(input_spatial_dim, output_spatial_dim),
+      frame_loader_(Nin, input_spatial_dim), input_files_(input_files),
+      num_frames_(num_frames), reset_data_(0), reset_received_output_(false),
+      early_stop_frame_size_(early_stop_frame_size),
+      pause_after_warm_up_(false), paused_(false) {
       SC_CTHREAD(InputLayerProc, clock.pos());
       reset_signal_is(reset, true);
 
@@ -46,7 +59,7 @@ class Testbench : public sc_module {
       reset_signal_is(reset, true);
     }
     // destructor
-    ~Testbench() { delete [] input_layer_data; delete [] output_layer_data; }
+    ~Testbench() {}
 
     // main process for Testbench
     void InputLayerProc();      // input layer process
@@ -55,12 +68,32 @@ class Testbench : public sc_module {
     // report the statistics after the simulation
     void ReportStatistics() const;
 
+    // pause the input stream after the first output is received, until it is
+    // resumed (e.g. after the drained pipeline is checkpointed)
+    inline void PauseAfterWarmUp() { pause_after_warm_up_ = true; }
+    inline bool Paused() const { return paused_; }
+    inline void Resume() { paused_ = false; }
+
+    // checkpoint of the stream progress, where the restored stream goes on
+    // from the next pixel after reset
+    void SaveState(Checkpoint* checkpoint) const;
+    void RestoreState(Checkpoint* checkpoint);
+
   private:
     int Nin_;                   // input feature map depth
     int Nout_;                  // output feature map depth
     int input_spatial_dim_;     // input image spatial dimension
-    // injection time for each pixel
-    std::vector<sc_time> inject_time_;
+    int input_width_;           // input image width
+    int input_pixels_;          // max pixels per handshake
+    // running statistics of the injections & frame latencies
+    StreamStatistics statistics_;
+    // input frames
+    FrameLoader frame_loader_;
+    std::vector<std::string> input_files_;
+    int num_frames_;            // no. of frames, unbounded if non-positive
+    // synthetic data (i.e. no. of pixels sent), which is reset_data_ on reset
+    int data_;
+    int reset_data_;
 
     // data record for early stop
     // time slot for start of 2nd frame & end of 2nd frame
@@ -70,8 +103,12 @@ class Testbench : public sc_module {
     int start_frame_data_;
     // flag for received output data
     bool received_output_;
+    bool reset_received_output_;
     // early stop frame size
     int early_stop_frame_size_;
+    // flags for the pause after warm up
+    bool pause_after_warm_up_;
+    bool paused_;
 };
 
 #endif
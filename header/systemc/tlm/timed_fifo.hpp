@@ -0,0 +1,66 @@
+/*
+ * Filename: timed_fifo.hpp
+ * -------------------------
+ * This file exports the class TimedFifo, which replaces the ChannelBuffer (and
+ * the valid-rdy handshake) between two processing elements in the
+ * transaction-level model. It only counts the feature map pixels in flight;
+ * the timing is annotated by the processing elements on both sides.
+ */
+
+#ifndef __TIMED_FIFO_HPP__
+#define __TIMED_FIFO_HPP__
+
+#include <string>
+#include <systemc.h>
+
+class TimedFifo {
+  public:
+    // constructor: capacity 0 models the combinational handshake (the writer
+    // blocks until the pixel is read), INT_MAX models the unbounded buffer
+    explicit TimedFifo(const std::string& name, int capacity=0);
+    ~TimedFifo() {}
+
+    /*
+     * Method: Write
+     * Usage: fifo.Write();
+     * ---------------------
+     * Push one pixel into the fifo. It blocks the calling thread while the fifo
+     * is full, or until the pixel is read if the fifo has no capacity.
+     */
+    void Write();
+
+    /*
+     * Method: WaitForData
+     * Usage: fifo.WaitForData();
+     * ---------------------------
+     * Block the calling thread until at least one pixel is in the fifo.
+     */
+    void WaitForData();
+    // pop one pixel from the non-empty fifo
+    void Pop();
+    // blocking read of one pixel
+    inline void Read() {
+      WaitForData();
+      Pop();
+    }
+
+    inline const std::string& name() const { return name_; }
+    inline int capacity() const { return capacity_; }
+    inline void set_capacity(int capacity) { capacity_ = capacity; }
+    inline int size() const { return size_; }
+    // max no. of buffered pixels, i.e. the depth required by the channel buffer
+    inline int max_size() const { return max_size_; }
+
+  private:
+    std::string name_;
+    int capacity_;
+    int size_;                  // no. of pixels in the fifo
+    int max_size_;
+    long int num_written_;      // total no. of written pixels
+    long int num_read_;         // total no. of read pixels
+    bool reader_waiting_;       // reader is blocked on the empty fifo
+    sc_event write_event_;
+    sc_event read_event_;
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Filename: tlm_concat_pe.hpp
+ * ----------------------------
+ * This file exports the class TlmConcatPe, the transaction-level model of the
+ * ConcatPe. Each bottom blob is buffered in its own fifo (as the prepended
+ * channel buffers of the ConcatPe), and the concatenated pixel is sent once all
+ * the bottom blobs are available.
+ */
+
+#ifndef __TLM_CONCAT_PE_HPP__
+#define __TLM_CONCAT_PE_HPP__
+
+#include "header/systemc/tlm/timed_fifo.hpp"
+#include <systemc.h>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+#include <vector>
+
+class TlmConcatPe : public sc_module {
+  // sockets
+  public:
+    // input pixels of the multiple bottom blobs
+    tlm_utils::simple_target_socket_tagged<TlmConcatPe>* prev_layer_socket;
+    // output pixel of the single top blob
+    tlm_utils::simple_initiator_socket<TlmConcatPe> next_layer_socket;
+
+    SC_HAS_PROCESS(TlmConcatPe);
+
+  private:
+    int numSplits_;   // the number of input splits
+    // input pixels of each bottom blob
+    std::vector<TimedFifo*> input_fifo_;
+
+  public:
+    // constructor
+    explicit TlmConcatPe(sc_module_name module_name, int numSplits,
+        int buffer_capacity);
+    // destructor
+    ~TlmConcatPe();
+
+    // main process of the TlmConcatPe
+    void TlmConcatPeProc();
+    // blocking transport of the previous layer pixel from the bottom blob id
+    void PrevLayerTransport(int id, tlm::tlm_generic_payload& trans,
+        sc_time& delay);
+
+    inline TimedFifo& input_fifo(int id) { return *input_fifo_[id]; }
+};
+
+#endif
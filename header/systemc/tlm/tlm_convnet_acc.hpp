@@ -0,0 +1,115 @@
+/*
+ * Filename: tlm_convnet_acc.hpp
+ * ------------------------------
+ * This file exports the class TlmConvNetAcc, the loosely-timed
+ * transaction-level model of the ConvNetAcc for the fast throughput
+ * estimation. The network is elaborated with the same parallelism & channel
+ * buffers as the ConvNetAcc, but each processing element is a TLM-2.0 target
+ * consuming one pixel per transaction, and each channel buffer becomes a
+ * TimedFifo at the input of the next processing element. No data path is
+ * modeled.
+ */
+
+#ifndef __TLM_CONVNET_ACC_HPP__
+#define __TLM_CONVNET_ACC_HPP__
+
+#include <systemc.h>
+#include <tlm.h>
+#include <vector>
+#include <map>
+#include <string>
+#include <iostream>
+#include "header/systemc/tlm/timed_fifo.hpp"
+#include "header/systemc/tlm/tlm_layer_pe.hpp"
+#include "header/systemc/tlm/tlm_split_pe.hpp"
+#include "header/systemc/tlm/tlm_concat_pe.hpp"
+#include "header/systemc/parallelism_allocator.hpp"
+#include "header/caffe/net.hpp"
+#include "proto/config.pb.h"
+
+class TlmConvNetAcc : public sc_module {
+  // sockets
+  public:
+    // input pixel of the first input layer
+    tlm::tlm_target_socket<> input_layer_socket;
+    // output pixel of the final output layer
+    tlm::tlm_initiator_socket<> output_layer_socket;
+
+  private:
+    // internal modules
+    // convolutional, inner product & pooling layer processing elements
+    std::vector<TlmLayerPe *> layer_pe_;
+    // split layer processing elements
+    std::vector<TlmSplitPe *> split_layer_pe_;
+    // concatenation layer processing elements
+    std::vector<TlmConcatPe *> concat_layer_pe_;
+
+    // interconnection (blob in caffe) from the producer to the consumer
+    struct Interconnection {
+      // initiator socket of the producer, NULL for the input layer
+      tlm::tlm_initiator_socket<>* socket;
+      // capacity of the appended channel buffer, 0 if not appended
+      int buffer_capacity;
+    };
+    // map of the feature map name to the interconnection
+    std::map<std::string, Interconnection> interconnections_;
+    // fifos modeling the channel buffers with the driving interconnection
+    std::vector<std::pair<std::string, TimedFifo *> > channel_buffers_;
+
+  public:
+    int input_spatial_dim_; // input spatial dimension
+    int input_width_;       // input width
+    int input_pixels_;      // input pixels per cycle
+    int output_spatial_dim_; // output spatial dimension
+    int append_buffer_capacity_;
+    std::string output_connection_; // output connection blob name
+    sc_time clock_period_;
+
+  public:
+    // constructor
+    explicit TlmConvNetAcc(sc_module_name module_name, const Net& net,
+        const config::ConfigParameter& config_param);
+    // destructor
+    ~TlmConvNetAcc();
+
+    // report the max buffer depth of each channel buffer after the simulation
+    void ReportBufferDepth(std::ostream& os=std::cout) const;
+
+  private:
+    // initialize the parallelism as the ConvNetAcc
+    void InitParallelism(const Net& net,
+        const config::ConfigParameter& config_param);
+
+    // initialize the modules & interconnections based on the ConvNet
+    // achitecture
+    void Init(const Net& net);
+
+    // helper functions to instantiate the layer with layer_id, following the
+    // ConvNetAcc
+    void InitInputLayer(const Net& net, int layer_id);
+    void InitConvolutionPe(const Net& net, int layer_id);
+    void InitPoolingPe(const Net& net, int layer_id);
+    void InitInnerProductLayer(const Net& net, int layer_id);
+    void InitSplitLayer(const Net& net, int layer_id);
+    void InitConcatLayer(const Net& net, int layer_id);
+    void BypassLayer(const Net& net, int layer_id);
+
+    // helper function to instantiate the layer pe & make its connections
+    void InitLayerPe(const Net& net, int layer_id, int Kh, int Kw, int h, int w,
+        int Pad_h, int Pad_w, int Stride_h, int Stride_w, int latency,
+        int pixel_latency=0, int Pw=1);
+
+    // helper function to bind the previous layer connection to the target
+    // socket of the consumer, whose input fifo models the channel buffer
+    void ConnectPrevLayer(const std::string& prev_connection,
+        tlm::tlm_target_socket<>& target_socket, TimedFifo* fifo,
+        bool prepend_buffer=false);
+
+    // parallelism for each layer, key: layer index; value: <Pin, Pout, Pk>
+    std::map<int, std::pair<std::pair<int, int>, int> > parallelism_;
+    // spatial parallelism for each layer, key: layer index; value: Pw (1 if
+    // absent)
+    std::map<int, int> spatial_parallelism_;
+};
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Filename: tlm_layer_pe.hpp
+ * ---------------------------
+ * This file exports the class TlmLayerPe, the transaction-level model of the
+ * ConvLayerPe (also for the InnerProduct layer) and the PoolLayerPe. The PE
+ * receives one pixel per transaction, follows the same schedule of padding,
+ * warm-up & stride as the layer controller, and annotates the computation
+ * latency of each output pixel on the outgoing transaction. With the spatial
+ * parallelism Pw > 1, a group of up to Pw*Stride_w pixels is received per
+ * cycle as the ConvLayerCtrl does.
+ */
+
+#ifndef __TLM_LAYER_PE_HPP__
+#define __TLM_LAYER_PE_HPP__
+
+#include "header/systemc/tlm/timed_fifo.hpp"
+#include <systemc.h>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+
+class TlmLayerPe : public sc_module {
+  // sockets
+  public:
+    // input pixel from the previous layer
+    tlm_utils::simple_target_socket<TlmLayerPe> prev_layer_socket;
+    // output pixel to the next layer
+    tlm_utils::simple_initiator_socket<TlmLayerPe> next_layer_socket;
+
+    SC_HAS_PROCESS(TlmLayerPe);
+
+  public:
+    // constructor: latency is the no. of cycles from the last input pixel of
+    // the sliding window to the output pixel, i.e. the computation cycles plus
+    // the pipeline stages; pixel_latency is the no. of cycles computing each
+    // input pixel before the next one is accepted (the global pooling)
+    explicit TlmLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
+        int w, int Pad_h, int Pad_w, int Stride_h, int Stride_w, int latency,
+        const sc_time& clock_period, int buffer_capacity=0,
+        int pixel_latency=0, int Pw=1);
+    // destructor
+    ~TlmLayerPe() {}
+
+    // main process of the TlmLayerPe
+    void TlmLayerPeProc();
+    // blocking transport of the previous layer pixel
+    void PrevLayerTransport(tlm::tlm_generic_payload& trans, sc_time& delay);
+
+    inline TimedFifo& input_fifo() { return input_fifo_; }
+
+  private:
+    // the pixel at the counter position is a padding zero
+    bool IsPadding(int feat_pixel_counter) const;
+    // the pixel at the counter position completes a (strided) sliding window
+    bool IsOutputPixel(int feat_pixel_counter) const;
+
+    int Kh_, Kw_;               // kernel spatial dimension
+    int h_, w_;                 // input feature map spatial dimension
+    int Pad_h_, Pad_w_;         // pad dimension
+    int Stride_h_, Stride_w_;   // stride dimension
+    int latency_;               // output pixel latency [cycle]
+    int pixel_latency_;         // input pixel latency [cycle]
+    int Pw_;                    // output columns per pass
+    sc_time clock_period_;
+
+    // input pixels from the previous layer
+    TimedFifo input_fifo_;
+};
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * Filename: tlm_split_pe.hpp
+ * ---------------------------
+ * This file exports the class TlmSplitPe, the transaction-level model of the
+ * SplitPe. The incoming pixel is forwarded to all the top blobs before the
+ * transaction completes.
+ */
+
+#ifndef __TLM_SPLIT_PE_HPP__
+#define __TLM_SPLIT_PE_HPP__
+
+#include <systemc.h>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+
+class TlmSplitPe : public sc_module {
+  // sockets
+  public:
+    // input pixel of the single bottom blob
+    tlm_utils::simple_target_socket<TlmSplitPe> prev_layer_socket;
+    // output pixels of the multiple top blobs
+    tlm_utils::simple_initiator_socket<TlmSplitPe>* next_layer_socket;
+
+  private:
+    int numSplits_;   // the number of output splits
+
+  public:
+    // constructor
+    explicit TlmSplitPe(sc_module_name module_name, int numSplits);
+    // destructor
+    ~TlmSplitPe();
+
+    // blocking transport of the previous layer pixel
+    void PrevLayerTransport(tlm::tlm_generic_payload& trans, sc_time& delay);
+};
+
+#endif
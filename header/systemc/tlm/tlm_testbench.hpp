@@ -0,0 +1,69 @@
+/*
+ * Filename: tlm_testbench.hpp
+ * ----------------------------
+ * This file exports the class TlmTestbench, the transaction-level counterpart
+ * of the Testbench. It injects the input pixels as fast as the TlmConvNetAcc
+ * accepts them, and records the injection & output time for the same
+ * statistics. The pixel values are not modeled, so the input files of the
+ * Testbench are not read.
+ */
+
+#ifndef __TLM_TESTBENCH_HPP__
+#define __TLM_TESTBENCH_HPP__
+
+#include <systemc.h>
+#include <tlm.h>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+#include "header/systemc/stream_statistics.hpp"
+
+class TlmTestbench : public sc_module {
+  // sockets
+  public:
+    // input pixel to the TlmConvNetAcc
+    tlm_utils::simple_initiator_socket<TlmTestbench> input_layer_socket;
+    // output pixel from the TlmConvNetAcc
+    tlm_utils::simple_target_socket<TlmTestbench> output_layer_socket;
+
+    SC_HAS_PROCESS(TlmTestbench);
+
+  public:
+    // constructor: early stop after early_stop_frame_size frames if
+    // num_frames is non-positive; up to input_pixels adjacent pixels of a row
+    // of input_width are injected per cycle
+    explicit TlmTestbench(sc_module_name module_name, int input_spatial_dim,
+        int output_spatial_dim, int early_stop_frame_size, int num_frames,
+        const sc_time& clock_period, int input_width=1, int input_pixels=1);
+    // destructor
+    ~TlmTestbench() {}
+
+    // main process for TlmTestbench
+    void InputLayerProc();      // input layer process
+    // blocking transport of the output layer pixel
+    void OutputLayerTransport(tlm::tlm_generic_payload& trans, sc_time& delay);
+
+    // report the statistics after the simulation
+    void ReportStatistics() const;
+    // avg injection interval (throughput) & avg frame latency [cycles]
+    double AvgInjectionInterval() const;
+    double AvgFrameLatency() const;
+
+  private:
+    int input_spatial_dim_;     // input image spatial dimension
+    int input_width_;           // input image width
+    int input_pixels_;          // max pixels per cycle
+    int early_stop_frame_size_; // early stop frame size
+    int num_frames_;            // no. of frames, unbounded if non-positive
+    sc_time clock_period_;
+    // running statistics of the injections & frame latencies
+    StreamStatistics statistics_;
+    // time slot for start of 2nd frame & end of 2nd frame
+    sc_time start_of_frame_;
+    sc_time end_of_frame_;
+    // pixel index @ start frame
+    int start_frame_data_;
+    // flag for received output data
+    bool received_output_;
+};
+
+#endif
@@ -2,12 +2,14 @@
  * Filename: top.hpp
  * ------------------
  * This file implements the class Top, which consists of the Testbench and
- * ConvNetAcc in it.
+ * ConvNetAcc in it. The warmed-up state of the ConvNetAcc & the Testbench is
+ * saved to the checkpoint_file, and restored from the restore_file on reset.
  */
 
 #ifndef __TOP_HPP__
 #define __TOP_HPP__
 
+#include "header/systemc/checkpoint.hpp"
 #include "header/systemc/data_type.hpp"
 #include "header/systemc/convnet_acc.hpp"
 #include "header/systemc/testbench.hpp"
@@ -24,15 +26,17 @@ class Top : public sc_module {
     // interconnections
     sc_signal<bool> input_layer_valid;
     sc_signal<bool> input_layer_rdy;
-    sc_signal<Payload>* input_layer_data;
+    PayloadBusSignal* input_layer_data;
     sc_signal<bool> output_layer_rdy;
     sc_signal<bool> output_layer_valid;
-    sc_signal<Payload>* output_layer_data;
+    PayloadBusSignal* output_layer_data;
 
     // modules
     Testbench* testbench;
     ConvNetAcc* convnet_acc;
 
+    SC_HAS_PROCESS(Top);
+
   public:
     // constructor
     Top(sc_module_name module_name, const Net& net,
@@ -58,6 +62,19 @@ class Top : public sc_module {
     void ReportAreaBreakdown() const;
     void ReportPowerBreakdown() const;
     void ReportMemoryDistribution() const;
+
+    // checkpoint process: save the state once the stream paused after warm up
+    // is drained
+    void CheckpointProc();
+
+  private:
+    // whether all the controllers wait for the input that is not valid yet
+    bool Drained() const;
+    // save & restore the state of all the modules
+    void SaveCheckpoint(const std::string& filename) const;
+    void RestoreCheckpoint(const std::string& filename);
+
+    std::string checkpoint_file_;
 };
 
 #endif
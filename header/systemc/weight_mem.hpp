@@ -49,6 +49,22 @@ class WeightMem : public sc_module {
     // main process of the weight memory
     void WeightMemProc();
 
+    // initialize the memory with the quantized weights in the order of (Nout,
+    // Nin, Kh*Kw) instead of full ones. With zero skipping, only the (input,
+    // output) tiles containing non-zero weights are stored
+    void LoadWeights(const std::vector<int>& weights,
+        bool zero_skipping=false);
+    // stored (input, output) tiles in compressed sparse row format: the output
+    // tiles of the ith input tile are tile_col_idx[tile_row_ptr[i]:
+    // tile_row_ptr[i+1]], and the pth tile starts at address
+    // p*ceil(Kh*Kw/Pk)
+    inline const std::vector<int>& tile_row_ptr() const {
+      return tile_row_ptr_;
+    }
+    inline const std::vector<int>& tile_col_idx() const {
+      return tile_col_idx_;
+    }
+
   private:
     int Kh_, Kw_;     // spatial dimension of the kernel
     int Pin_, Pout_;  // input parallelism & output parallelism
@@ -59,6 +75,9 @@ class WeightMem : public sc_module {
 
     // real memory storage
     std::vector<Payload> mem_;
+    // stored tiles in compressed sparse row format
+    std::vector<int> tile_row_ptr_;
+    std::vector<int> tile_col_idx_;
     // memory model
     MemoryModel* memory_model_;
     double dynamic_energy_;
@@ -0,0 +1,103 @@
+/*
+ * Filename: throughput_analyzer.hpp
+ * ----------------------------------
+ * This file exports the class ThroughputAnalyzer, which predicts the
+ * steady-state throughput and the channel buffer depths of the accelerator
+ * from the network graph without any simulation. Each processing element
+ * streams one feature map pixel per cycle and stalls for the output pixel
+ * latency at each sliding window, so its frame period is
+ *
+ *  (h+2*Pad_h)*(w+2*Pad_w) + out_h*out_w*(latency+1)
+ *
+ * and the accelerator runs at the frame period of the bottleneck layer. The
+ * global pooling layer stalls for its latency at each input pixel instead,
+ * i.e. h*w*(latency+1), where the latency is the computation of one pixel. The
+ * arrival time of the first pixel is propagated through the line buffer
+ * warm-up of each layer and through the Split, Concat & Eltwise layers, which
+ * yields the skew the inception channel buffers (and the skip channel buffers
+ * of the residual blocks) have to absorb.
+ */
+
+#ifndef __THROUGHPUT_ANALYZER_HPP__
+#define __THROUGHPUT_ANALYZER_HPP__
+
+#include <string>
+#include <map>
+#include <utility>
+#include <iostream>
+#include "header/caffe/net.hpp"
+
+class ThroughputAnalyzer {
+  public:
+    // constructor: analyze the network given the output pixel latency [cycle]
+    // (computation & pipeline stages) of each convolution, inner product and
+    // pooling layer, keyed by the layer index (the input pixel latency of the
+    // global pooling layer)
+    explicit ThroughputAnalyzer(const Net& net,
+        const std::map<int, int>& layer_latency);
+    ~ThroughputAnalyzer() {}
+
+    // outputs the frame period of each layer & the predicted buffer depths
+    void Summary(std::ostream& os=std::cout) const;
+
+    // steady-state frame period of the accelerator [cycle]
+    inline long int frame_period() const { return frame_period_; }
+    // steady-state injection interval [cycle/pixel]
+    inline double injection_interval() const {
+      return static_cast<double>(frame_period_) / input_spatial_dim_;
+    }
+    // min depth of the channel buffer appended to the layer (0 if no buffer is
+    // required to avoid the back pressure)
+    int InterLayerBufferDepth(int layer_id) const;
+    // min depth of the inception channel buffer prepended to the bottom blob
+    // of the concat layer
+    int InceptionBufferDepth(int layer_id, int blob_id) const;
+    // min depth of the skip channel buffer prepended to the bottom blob of the
+    // eltwise layer
+    int SkipBufferDepth(int layer_id, int blob_id) const;
+
+  private:
+    // timing of the feature map (blob in caffe) in the steady state
+    struct BlobTiming {
+      double first_pixel;   // arrival time of the first pixel [cycle]
+      int pixels;           // no. of pixels per frame
+      int producer;         // layer index of the last appended channel buffer
+    };
+
+    // dimension of the layer streaming through the line buffer
+    struct LayerDim {
+      int Kh, Kw;           // kernel size
+      int h, w;             // input spatial dimension
+      int pad_h, pad_w;     // padding
+      int out_pixels;       // no. of output pixels per frame
+      bool global_pool;     // global pooling without line buffer
+    };
+
+    // extract the dimension of the convolution, inner product & pooling layer
+    LayerDim ExtractLayerDim(int layer_id) const;
+    // no. of input pixels (excluding padding) to fill the first sliding window
+    static int WarmUpPixels(const LayerDim& dim);
+    // align the bottom blobs of the concat or eltwise layer to the latest one,
+    // records the depth of the buffer prepended to each bottom blob & returns
+    // the arrival time of the first pixel of the top blob
+    double AlignBottomBlobs(int layer_id,
+        std::map<std::pair<int, int>, int>* buffer_depth);
+    // timing of the bottom blob, exits if it is undefined
+    const BlobTiming& BottomTiming(int layer_id, int blob_id) const;
+
+    const Net& net_;
+    std::map<int, int> layer_latency_;
+    int input_spatial_dim_;
+    long int frame_period_;
+    int bottleneck_layer_;
+    // frame period of each processing element [cycle]
+    std::map<int, long int> layer_frame_period_;
+    // timing of each blob, where the bypassed layers share the bottom timing
+    std::map<std::string, BlobTiming> blob_timing_;
+    // predicted buffer depths
+    std::map<int, int> inter_layer_buffer_depth_;
+    std::map<std::pair<int, int>, int> inception_buffer_depth_;
+    std::map<std::pair<int, int>, int> skip_buffer_depth_;
+};
+
+#endif
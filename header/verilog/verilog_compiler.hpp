@@ -15,6 +15,8 @@
 #include <set>
 #include <map>
 #include "header/caffe/net.hpp"
+#include "header/caffe/util/weight_loader.hpp"
+#include "header/layer_precision.hpp"
 #include "proto/config.pb.h"
 
 class VerilogCompiler {
@@ -54,23 +56,38 @@ class VerilogCompiler {
     void GenerateSim(const std::string& folder) const;
     // Generate the top simulation file
     void GenerateSimRTL(const std::string& filename) const;
+    // Generate the kernel rom init files from the caffemodel
+    void GenerateWeightInit(const std::string& folder) const;
+
+    // max (bottleneck) layer inference rate of the resource allocation
+    inline int max_layer_inference_rate() const {
+      return max_layer_inference_rate_;
+    }
 
   private:
-    // channel buffer module name
-    std::vector<std::string> channel_buffer_module_;
+    // channel buffer module name & its buffer depth
+    std::vector<std::pair<std::string, int> > channel_buffer_module_;
 
   private:
     // parallelism determined (modified from the systemC)
     // instance variable: layer idx -> Pin & Pout
     std::map<int, std::pair<int, int> > parallelism_;
-    // initialize the parallelism_ of each layer with the specified inference
-    // rate in the ConvNet
-    void InitParallelism(const Net& net, int pixel_inference_rate);
+    // max layer inference rate of the determined parallelism
+    int max_layer_inference_rate_;
+    // initialize the parallelism_ of each layer in the ConvNet, either under
+    // the multiplier/area budget or with the specified pixel inference rate
+    void InitParallelism(const Net& net,
+        const config::ConfigParameter& config_param);
+    // Pin & Pout of each layer allocated under the multiplier/area budget by
+    // the ParallelismAllocator, consistent with the SystemC models
+    void AllocateParallelism(const Net& net,
+        const config::ConfigParameter& config_param,
+        std::map<int, std::pair<int, int> >* allocation) const;
     // Return the Pin & Pout given the specified layer parameters
     std::pair<int, int> CalculateParallelsim(int Nin, int Nout, int h, int w,
         int layer_inference_rate) const;
-    // Calculate parallelsim using brute force
-    std::pair<int, int> CalculateParallelsimBruteForce(int Nin, int Nout,
+    // Search for the parallelism closest to the target rate
+    std::pair<int, int> CalculateParallelsimSearch(int Nin, int Nout,
         double rate) const;
 
   private:
@@ -78,7 +95,10 @@ class VerilogCompiler {
     std::string convnet_name_;    // convnet name
     int Nin_;                     // input feature map depth
     int Nout_;                    // output feature map depth
-    int bit_width_;               // bit width of the data path
+    int bit_width_;               // bit width of the primary input & output
+    std::string weight_file_;     // trained caffemodel (empty for full ones)
+    // bit width of each processing element & interconnection
+    LayerPrecision* layer_precision_;
     const Net* net_;
 
     // pipeline stage for ALU datapath
@@ -89,6 +109,18 @@ class VerilogCompiler {
     // inter-channel & inception synchronous buffer depth
     int inter_layer_buffer_depth_;
     int inception_buffer_depth_;
+    // buffer depth of each channel buffer module overriding the global ones
+    std::map<std::string, int> channel_buffer_depth_;
+    // predict the buffer depth of each channel buffer module (or only the
+    // skip channel buffers) by the ThroughputAnalyzer with the determined
+    // parallelism
+    void InitBufferDepth(const Net& net, bool predict_all);
+    // resize the channel buffer modules listed in the buffer depth file of a
+    // profiling run to the measured max depth plus the margin
+    void LoadBufferDepth(const std::string& filename, int margin);
+    // Return the buffer depth of the channel buffer module
+    int ChannelBufferDepth(const std::string& module_name,
+        int default_depth) const;
 
     // interconnections between layer and layer
     // unique interconnections name
@@ -107,12 +139,20 @@ class VerilogCompiler {
         int blob_id);
     void GenerateInceptionChannelBuffer(std::ostream& os, int layer_id,
         int blob_id);
+    void GenerateSkipChannelBuffer(std::ostream& os, int layer_id,
+        int blob_id);
     void GenerateConvolutionLayer(std::ostream& os, int layer_id) const;
     void GeneratePoolingLayer(std::ostream& os, int layer_id) const;
     void GenerateInnerProductLayer(std::ostream& os, int layer_id) const;
     void GenerateSplitLayer(std::ostream& os, int layer_id) const;
+    void GenerateSliceLayer(std::ostream& os, int layer_id) const;
     void GenerateConcatLayer(std::ostream& os, int layer_id) const;
+    void GenerateEltwiseLayer(std::ostream& os, int layer_id) const;
     void GenerateOutputLayer(std::ostream& os, int layer_id) const;
+    // kernel rom init files of the convolution & inner product layer
+    void GenerateWeightInit(const std::string& folder, const WeightLoader&
+        weight_loader, const std::string& layer_name, int Nin, int Nout,
+        int Kh, int Kw, int group, int Pin, int Pout, int bit_width) const;
 
     // input spatial 2D dimension
     int input_spatial_dim_;
@@ -1,25042 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: caffe.proto
-
-#ifndef PROTOBUF_caffe_2eproto__INCLUDED
-#define PROTOBUF_caffe_2eproto__INCLUDED
-
-#include <string>
-
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2006000
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
-#error your headers.
-#endif
-#if 2006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
-#include <google/protobuf/generated_enum_reflection.h>
-#include <google/protobuf/unknown_field_set.h>
-// @@protoc_insertion_point(includes)
-
-namespace caffe {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_caffe_2eproto();
-void protobuf_AssignDesc_caffe_2eproto();
-void protobuf_ShutdownFile_caffe_2eproto();
-
-class BlobShape;
-class BlobProto;
-class BlobProtoVector;
-class Datum;
-class FillerParameter;
-class NetParameter;
-class SolverParameter;
-class SolverState;
-class NetState;
-class NetStateRule;
-class ParamSpec;
-class LayerParameter;
-class TransformationParameter;
-class LossParameter;
-class AccuracyParameter;
-class ArgMaxParameter;
-class ConcatParameter;
-class BatchNormParameter;
-class BiasParameter;
-class ContrastiveLossParameter;
-class ConvolutionParameter;
-class CropParameter;
-class DataParameter;
-class DropoutParameter;
-class DummyDataParameter;
-class EltwiseParameter;
-class ELUParameter;
-class EmbedParameter;
-class ExpParameter;
-class FlattenParameter;
-class HDF5DataParameter;
-class HDF5OutputParameter;
-class HingeLossParameter;
-class ImageDataParameter;
-class InfogainLossParameter;
-class InnerProductParameter;
-class InputParameter;
-class LogParameter;
-class LRNParameter;
-class MemoryDataParameter;
-class MVNParameter;
-class ParameterParameter;
-class PoolingParameter;
-class PowerParameter;
-class PythonParameter;
-class RecurrentParameter;
-class ReductionParameter;
-class ReLUParameter;
-class ReshapeParameter;
-class ScaleParameter;
-class SigmoidParameter;
-class SliceParameter;
-class SoftmaxParameter;
-class TanHParameter;
-class TileParameter;
-class ThresholdParameter;
-class WindowDataParameter;
-class SPPParameter;
-class V1LayerParameter;
-class V0LayerParameter;
-class PReLUParameter;
-class QuantizationParameter;
-
-enum FillerParameter_VarianceNorm {
-  FillerParameter_VarianceNorm_FAN_IN = 0,
-  FillerParameter_VarianceNorm_FAN_OUT = 1,
-  FillerParameter_VarianceNorm_AVERAGE = 2
-};
-bool FillerParameter_VarianceNorm_IsValid(int value);
-const FillerParameter_VarianceNorm FillerParameter_VarianceNorm_VarianceNorm_MIN = FillerParameter_VarianceNorm_FAN_IN;
-const FillerParameter_VarianceNorm FillerParameter_VarianceNorm_VarianceNorm_MAX = FillerParameter_VarianceNorm_AVERAGE;
-const int FillerParameter_VarianceNorm_VarianceNorm_ARRAYSIZE = FillerParameter_VarianceNorm_VarianceNorm_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* FillerParameter_VarianceNorm_descriptor();
-inline const ::std::string& FillerParameter_VarianceNorm_Name(FillerParameter_VarianceNorm value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    FillerParameter_VarianceNorm_descriptor(), value);
-}
-inline bool FillerParameter_VarianceNorm_Parse(
-    const ::std::string& name, FillerParameter_VarianceNorm* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<FillerParameter_VarianceNorm>(
-    FillerParameter_VarianceNorm_descriptor(), name, value);
-}
-enum SolverParameter_SnapshotFormat {
-  SolverParameter_SnapshotFormat_HDF5 = 0,
-  SolverParameter_SnapshotFormat_BINARYPROTO = 1
-};
-bool SolverParameter_SnapshotFormat_IsValid(int value);
-const SolverParameter_SnapshotFormat SolverParameter_SnapshotFormat_SnapshotFormat_MIN = SolverParameter_SnapshotFormat_HDF5;
-const SolverParameter_SnapshotFormat SolverParameter_SnapshotFormat_SnapshotFormat_MAX = SolverParameter_SnapshotFormat_BINARYPROTO;
-const int SolverParameter_SnapshotFormat_SnapshotFormat_ARRAYSIZE = SolverParameter_SnapshotFormat_SnapshotFormat_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SolverParameter_SnapshotFormat_descriptor();
-inline const ::std::string& SolverParameter_SnapshotFormat_Name(SolverParameter_SnapshotFormat value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SolverParameter_SnapshotFormat_descriptor(), value);
-}
-inline bool SolverParameter_SnapshotFormat_Parse(
-    const ::std::string& name, SolverParameter_SnapshotFormat* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SolverParameter_SnapshotFormat>(
-    SolverParameter_SnapshotFormat_descriptor(), name, value);
-}
-enum SolverParameter_SolverMode {
-  SolverParameter_SolverMode_CPU = 0,
-  SolverParameter_SolverMode_GPU = 1
-};
-bool SolverParameter_SolverMode_IsValid(int value);
-const SolverParameter_SolverMode SolverParameter_SolverMode_SolverMode_MIN = SolverParameter_SolverMode_CPU;
-const SolverParameter_SolverMode SolverParameter_SolverMode_SolverMode_MAX = SolverParameter_SolverMode_GPU;
-const int SolverParameter_SolverMode_SolverMode_ARRAYSIZE = SolverParameter_SolverMode_SolverMode_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SolverParameter_SolverMode_descriptor();
-inline const ::std::string& SolverParameter_SolverMode_Name(SolverParameter_SolverMode value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SolverParameter_SolverMode_descriptor(), value);
-}
-inline bool SolverParameter_SolverMode_Parse(
-    const ::std::string& name, SolverParameter_SolverMode* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SolverParameter_SolverMode>(
-    SolverParameter_SolverMode_descriptor(), name, value);
-}
-enum SolverParameter_SolverType {
-  SolverParameter_SolverType_SGD = 0,
-  SolverParameter_SolverType_NESTEROV = 1,
-  SolverParameter_SolverType_ADAGRAD = 2,
-  SolverParameter_SolverType_RMSPROP = 3,
-  SolverParameter_SolverType_ADADELTA = 4,
-  SolverParameter_SolverType_ADAM = 5
-};
-bool SolverParameter_SolverType_IsValid(int value);
-const SolverParameter_SolverType SolverParameter_SolverType_SolverType_MIN = SolverParameter_SolverType_SGD;
-const SolverParameter_SolverType SolverParameter_SolverType_SolverType_MAX = SolverParameter_SolverType_ADAM;
-const int SolverParameter_SolverType_SolverType_ARRAYSIZE = SolverParameter_SolverType_SolverType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SolverParameter_SolverType_descriptor();
-inline const ::std::string& SolverParameter_SolverType_Name(SolverParameter_SolverType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SolverParameter_SolverType_descriptor(), value);
-}
-inline bool SolverParameter_SolverType_Parse(
-    const ::std::string& name, SolverParameter_SolverType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SolverParameter_SolverType>(
-    SolverParameter_SolverType_descriptor(), name, value);
-}
-enum ParamSpec_DimCheckMode {
-  ParamSpec_DimCheckMode_STRICT = 0,
-  ParamSpec_DimCheckMode_PERMISSIVE = 1
-};
-bool ParamSpec_DimCheckMode_IsValid(int value);
-const ParamSpec_DimCheckMode ParamSpec_DimCheckMode_DimCheckMode_MIN = ParamSpec_DimCheckMode_STRICT;
-const ParamSpec_DimCheckMode ParamSpec_DimCheckMode_DimCheckMode_MAX = ParamSpec_DimCheckMode_PERMISSIVE;
-const int ParamSpec_DimCheckMode_DimCheckMode_ARRAYSIZE = ParamSpec_DimCheckMode_DimCheckMode_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ParamSpec_DimCheckMode_descriptor();
-inline const ::std::string& ParamSpec_DimCheckMode_Name(ParamSpec_DimCheckMode value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ParamSpec_DimCheckMode_descriptor(), value);
-}
-inline bool ParamSpec_DimCheckMode_Parse(
-    const ::std::string& name, ParamSpec_DimCheckMode* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ParamSpec_DimCheckMode>(
-    ParamSpec_DimCheckMode_descriptor(), name, value);
-}
-enum LossParameter_NormalizationMode {
-  LossParameter_NormalizationMode_FULL = 0,
-  LossParameter_NormalizationMode_VALID = 1,
-  LossParameter_NormalizationMode_BATCH_SIZE = 2,
-  LossParameter_NormalizationMode_NONE = 3
-};
-bool LossParameter_NormalizationMode_IsValid(int value);
-const LossParameter_NormalizationMode LossParameter_NormalizationMode_NormalizationMode_MIN = LossParameter_NormalizationMode_FULL;
-const LossParameter_NormalizationMode LossParameter_NormalizationMode_NormalizationMode_MAX = LossParameter_NormalizationMode_NONE;
-const int LossParameter_NormalizationMode_NormalizationMode_ARRAYSIZE = LossParameter_NormalizationMode_NormalizationMode_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* LossParameter_NormalizationMode_descriptor();
-inline const ::std::string& LossParameter_NormalizationMode_Name(LossParameter_NormalizationMode value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    LossParameter_NormalizationMode_descriptor(), value);
-}
-inline bool LossParameter_NormalizationMode_Parse(
-    const ::std::string& name, LossParameter_NormalizationMode* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<LossParameter_NormalizationMode>(
-    LossParameter_NormalizationMode_descriptor(), name, value);
-}
-enum ConvolutionParameter_Engine {
-  ConvolutionParameter_Engine_DEFAULT = 0,
-  ConvolutionParameter_Engine_CAFFE = 1,
-  ConvolutionParameter_Engine_CUDNN = 2
-};
-bool ConvolutionParameter_Engine_IsValid(int value);
-const ConvolutionParameter_Engine ConvolutionParameter_Engine_Engine_MIN = ConvolutionParameter_Engine_DEFAULT;
-const ConvolutionParameter_Engine ConvolutionParameter_Engine_Engine_MAX = ConvolutionParameter_Engine_CUDNN;
-const int ConvolutionParameter_Engine_Engine_ARRAYSIZE = ConvolutionParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ConvolutionParameter_Engine_descriptor();
-inline const ::std::string& ConvolutionParameter_Engine_Name(ConvolutionParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ConvolutionParameter_Engine_descriptor(), value);
-}
-inline bool ConvolutionParameter_Engine_Parse(
-    const ::std::string& name, ConvolutionParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ConvolutionParameter_Engine>(
-    ConvolutionParameter_Engine_descriptor(), name, value);
-}
-enum DataParameter_DB {
-  DataParameter_DB_LEVELDB = 0,
-  DataParameter_DB_LMDB = 1
-};
-bool DataParameter_DB_IsValid(int value);
-const DataParameter_DB DataParameter_DB_DB_MIN = DataParameter_DB_LEVELDB;
-const DataParameter_DB DataParameter_DB_DB_MAX = DataParameter_DB_LMDB;
-const int DataParameter_DB_DB_ARRAYSIZE = DataParameter_DB_DB_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* DataParameter_DB_descriptor();
-inline const ::std::string& DataParameter_DB_Name(DataParameter_DB value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    DataParameter_DB_descriptor(), value);
-}
-inline bool DataParameter_DB_Parse(
-    const ::std::string& name, DataParameter_DB* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<DataParameter_DB>(
-    DataParameter_DB_descriptor(), name, value);
-}
-enum EltwiseParameter_EltwiseOp {
-  EltwiseParameter_EltwiseOp_PROD = 0,
-  EltwiseParameter_EltwiseOp_SUM = 1,
-  EltwiseParameter_EltwiseOp_MAX = 2
-};
-bool EltwiseParameter_EltwiseOp_IsValid(int value);
-const EltwiseParameter_EltwiseOp EltwiseParameter_EltwiseOp_EltwiseOp_MIN = EltwiseParameter_EltwiseOp_PROD;
-const EltwiseParameter_EltwiseOp EltwiseParameter_EltwiseOp_EltwiseOp_MAX = EltwiseParameter_EltwiseOp_MAX;
-const int EltwiseParameter_EltwiseOp_EltwiseOp_ARRAYSIZE = EltwiseParameter_EltwiseOp_EltwiseOp_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* EltwiseParameter_EltwiseOp_descriptor();
-inline const ::std::string& EltwiseParameter_EltwiseOp_Name(EltwiseParameter_EltwiseOp value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    EltwiseParameter_EltwiseOp_descriptor(), value);
-}
-inline bool EltwiseParameter_EltwiseOp_Parse(
-    const ::std::string& name, EltwiseParameter_EltwiseOp* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<EltwiseParameter_EltwiseOp>(
-    EltwiseParameter_EltwiseOp_descriptor(), name, value);
-}
-enum HingeLossParameter_Norm {
-  HingeLossParameter_Norm_L1 = 1,
-  HingeLossParameter_Norm_L2 = 2
-};
-bool HingeLossParameter_Norm_IsValid(int value);
-const HingeLossParameter_Norm HingeLossParameter_Norm_Norm_MIN = HingeLossParameter_Norm_L1;
-const HingeLossParameter_Norm HingeLossParameter_Norm_Norm_MAX = HingeLossParameter_Norm_L2;
-const int HingeLossParameter_Norm_Norm_ARRAYSIZE = HingeLossParameter_Norm_Norm_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* HingeLossParameter_Norm_descriptor();
-inline const ::std::string& HingeLossParameter_Norm_Name(HingeLossParameter_Norm value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    HingeLossParameter_Norm_descriptor(), value);
-}
-inline bool HingeLossParameter_Norm_Parse(
-    const ::std::string& name, HingeLossParameter_Norm* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<HingeLossParameter_Norm>(
-    HingeLossParameter_Norm_descriptor(), name, value);
-}
-enum LRNParameter_NormRegion {
-  LRNParameter_NormRegion_ACROSS_CHANNELS = 0,
-  LRNParameter_NormRegion_WITHIN_CHANNEL = 1
-};
-bool LRNParameter_NormRegion_IsValid(int value);
-const LRNParameter_NormRegion LRNParameter_NormRegion_NormRegion_MIN = LRNParameter_NormRegion_ACROSS_CHANNELS;
-const LRNParameter_NormRegion LRNParameter_NormRegion_NormRegion_MAX = LRNParameter_NormRegion_WITHIN_CHANNEL;
-const int LRNParameter_NormRegion_NormRegion_ARRAYSIZE = LRNParameter_NormRegion_NormRegion_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* LRNParameter_NormRegion_descriptor();
-inline const ::std::string& LRNParameter_NormRegion_Name(LRNParameter_NormRegion value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    LRNParameter_NormRegion_descriptor(), value);
-}
-inline bool LRNParameter_NormRegion_Parse(
-    const ::std::string& name, LRNParameter_NormRegion* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<LRNParameter_NormRegion>(
-    LRNParameter_NormRegion_descriptor(), name, value);
-}
-enum LRNParameter_Engine {
-  LRNParameter_Engine_DEFAULT = 0,
-  LRNParameter_Engine_CAFFE = 1,
-  LRNParameter_Engine_CUDNN = 2
-};
-bool LRNParameter_Engine_IsValid(int value);
-const LRNParameter_Engine LRNParameter_Engine_Engine_MIN = LRNParameter_Engine_DEFAULT;
-const LRNParameter_Engine LRNParameter_Engine_Engine_MAX = LRNParameter_Engine_CUDNN;
-const int LRNParameter_Engine_Engine_ARRAYSIZE = LRNParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* LRNParameter_Engine_descriptor();
-inline const ::std::string& LRNParameter_Engine_Name(LRNParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    LRNParameter_Engine_descriptor(), value);
-}
-inline bool LRNParameter_Engine_Parse(
-    const ::std::string& name, LRNParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<LRNParameter_Engine>(
-    LRNParameter_Engine_descriptor(), name, value);
-}
-enum PoolingParameter_PoolMethod {
-  PoolingParameter_PoolMethod_MAX = 0,
-  PoolingParameter_PoolMethod_AVE = 1,
-  PoolingParameter_PoolMethod_STOCHASTIC = 2
-};
-bool PoolingParameter_PoolMethod_IsValid(int value);
-const PoolingParameter_PoolMethod PoolingParameter_PoolMethod_PoolMethod_MIN = PoolingParameter_PoolMethod_MAX;
-const PoolingParameter_PoolMethod PoolingParameter_PoolMethod_PoolMethod_MAX = PoolingParameter_PoolMethod_STOCHASTIC;
-const int PoolingParameter_PoolMethod_PoolMethod_ARRAYSIZE = PoolingParameter_PoolMethod_PoolMethod_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* PoolingParameter_PoolMethod_descriptor();
-inline const ::std::string& PoolingParameter_PoolMethod_Name(PoolingParameter_PoolMethod value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    PoolingParameter_PoolMethod_descriptor(), value);
-}
-inline bool PoolingParameter_PoolMethod_Parse(
-    const ::std::string& name, PoolingParameter_PoolMethod* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<PoolingParameter_PoolMethod>(
-    PoolingParameter_PoolMethod_descriptor(), name, value);
-}
-enum PoolingParameter_Engine {
-  PoolingParameter_Engine_DEFAULT = 0,
-  PoolingParameter_Engine_CAFFE = 1,
-  PoolingParameter_Engine_CUDNN = 2
-};
-bool PoolingParameter_Engine_IsValid(int value);
-const PoolingParameter_Engine PoolingParameter_Engine_Engine_MIN = PoolingParameter_Engine_DEFAULT;
-const PoolingParameter_Engine PoolingParameter_Engine_Engine_MAX = PoolingParameter_Engine_CUDNN;
-const int PoolingParameter_Engine_Engine_ARRAYSIZE = PoolingParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* PoolingParameter_Engine_descriptor();
-inline const ::std::string& PoolingParameter_Engine_Name(PoolingParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    PoolingParameter_Engine_descriptor(), value);
-}
-inline bool PoolingParameter_Engine_Parse(
-    const ::std::string& name, PoolingParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<PoolingParameter_Engine>(
-    PoolingParameter_Engine_descriptor(), name, value);
-}
-enum ReductionParameter_ReductionOp {
-  ReductionParameter_ReductionOp_SUM = 1,
-  ReductionParameter_ReductionOp_ASUM = 2,
-  ReductionParameter_ReductionOp_SUMSQ = 3,
-  ReductionParameter_ReductionOp_MEAN = 4
-};
-bool ReductionParameter_ReductionOp_IsValid(int value);
-const ReductionParameter_ReductionOp ReductionParameter_ReductionOp_ReductionOp_MIN = ReductionParameter_ReductionOp_SUM;
-const ReductionParameter_ReductionOp ReductionParameter_ReductionOp_ReductionOp_MAX = ReductionParameter_ReductionOp_MEAN;
-const int ReductionParameter_ReductionOp_ReductionOp_ARRAYSIZE = ReductionParameter_ReductionOp_ReductionOp_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ReductionParameter_ReductionOp_descriptor();
-inline const ::std::string& ReductionParameter_ReductionOp_Name(ReductionParameter_ReductionOp value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ReductionParameter_ReductionOp_descriptor(), value);
-}
-inline bool ReductionParameter_ReductionOp_Parse(
-    const ::std::string& name, ReductionParameter_ReductionOp* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ReductionParameter_ReductionOp>(
-    ReductionParameter_ReductionOp_descriptor(), name, value);
-}
-enum ReLUParameter_Engine {
-  ReLUParameter_Engine_DEFAULT = 0,
-  ReLUParameter_Engine_CAFFE = 1,
-  ReLUParameter_Engine_CUDNN = 2
-};
-bool ReLUParameter_Engine_IsValid(int value);
-const ReLUParameter_Engine ReLUParameter_Engine_Engine_MIN = ReLUParameter_Engine_DEFAULT;
-const ReLUParameter_Engine ReLUParameter_Engine_Engine_MAX = ReLUParameter_Engine_CUDNN;
-const int ReLUParameter_Engine_Engine_ARRAYSIZE = ReLUParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ReLUParameter_Engine_descriptor();
-inline const ::std::string& ReLUParameter_Engine_Name(ReLUParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ReLUParameter_Engine_descriptor(), value);
-}
-inline bool ReLUParameter_Engine_Parse(
-    const ::std::string& name, ReLUParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ReLUParameter_Engine>(
-    ReLUParameter_Engine_descriptor(), name, value);
-}
-enum SigmoidParameter_Engine {
-  SigmoidParameter_Engine_DEFAULT = 0,
-  SigmoidParameter_Engine_CAFFE = 1,
-  SigmoidParameter_Engine_CUDNN = 2
-};
-bool SigmoidParameter_Engine_IsValid(int value);
-const SigmoidParameter_Engine SigmoidParameter_Engine_Engine_MIN = SigmoidParameter_Engine_DEFAULT;
-const SigmoidParameter_Engine SigmoidParameter_Engine_Engine_MAX = SigmoidParameter_Engine_CUDNN;
-const int SigmoidParameter_Engine_Engine_ARRAYSIZE = SigmoidParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SigmoidParameter_Engine_descriptor();
-inline const ::std::string& SigmoidParameter_Engine_Name(SigmoidParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SigmoidParameter_Engine_descriptor(), value);
-}
-inline bool SigmoidParameter_Engine_Parse(
-    const ::std::string& name, SigmoidParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SigmoidParameter_Engine>(
-    SigmoidParameter_Engine_descriptor(), name, value);
-}
-enum SoftmaxParameter_Engine {
-  SoftmaxParameter_Engine_DEFAULT = 0,
-  SoftmaxParameter_Engine_CAFFE = 1,
-  SoftmaxParameter_Engine_CUDNN = 2
-};
-bool SoftmaxParameter_Engine_IsValid(int value);
-const SoftmaxParameter_Engine SoftmaxParameter_Engine_Engine_MIN = SoftmaxParameter_Engine_DEFAULT;
-const SoftmaxParameter_Engine SoftmaxParameter_Engine_Engine_MAX = SoftmaxParameter_Engine_CUDNN;
-const int SoftmaxParameter_Engine_Engine_ARRAYSIZE = SoftmaxParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SoftmaxParameter_Engine_descriptor();
-inline const ::std::string& SoftmaxParameter_Engine_Name(SoftmaxParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SoftmaxParameter_Engine_descriptor(), value);
-}
-inline bool SoftmaxParameter_Engine_Parse(
-    const ::std::string& name, SoftmaxParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SoftmaxParameter_Engine>(
-    SoftmaxParameter_Engine_descriptor(), name, value);
-}
-enum TanHParameter_Engine {
-  TanHParameter_Engine_DEFAULT = 0,
-  TanHParameter_Engine_CAFFE = 1,
-  TanHParameter_Engine_CUDNN = 2
-};
-bool TanHParameter_Engine_IsValid(int value);
-const TanHParameter_Engine TanHParameter_Engine_Engine_MIN = TanHParameter_Engine_DEFAULT;
-const TanHParameter_Engine TanHParameter_Engine_Engine_MAX = TanHParameter_Engine_CUDNN;
-const int TanHParameter_Engine_Engine_ARRAYSIZE = TanHParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* TanHParameter_Engine_descriptor();
-inline const ::std::string& TanHParameter_Engine_Name(TanHParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    TanHParameter_Engine_descriptor(), value);
-}
-inline bool TanHParameter_Engine_Parse(
-    const ::std::string& name, TanHParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<TanHParameter_Engine>(
-    TanHParameter_Engine_descriptor(), name, value);
-}
-enum SPPParameter_PoolMethod {
-  SPPParameter_PoolMethod_MAX = 0,
-  SPPParameter_PoolMethod_AVE = 1,
-  SPPParameter_PoolMethod_STOCHASTIC = 2
-};
-bool SPPParameter_PoolMethod_IsValid(int value);
-const SPPParameter_PoolMethod SPPParameter_PoolMethod_PoolMethod_MIN = SPPParameter_PoolMethod_MAX;
-const SPPParameter_PoolMethod SPPParameter_PoolMethod_PoolMethod_MAX = SPPParameter_PoolMethod_STOCHASTIC;
-const int SPPParameter_PoolMethod_PoolMethod_ARRAYSIZE = SPPParameter_PoolMethod_PoolMethod_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SPPParameter_PoolMethod_descriptor();
-inline const ::std::string& SPPParameter_PoolMethod_Name(SPPParameter_PoolMethod value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SPPParameter_PoolMethod_descriptor(), value);
-}
-inline bool SPPParameter_PoolMethod_Parse(
-    const ::std::string& name, SPPParameter_PoolMethod* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SPPParameter_PoolMethod>(
-    SPPParameter_PoolMethod_descriptor(), name, value);
-}
-enum SPPParameter_Engine {
-  SPPParameter_Engine_DEFAULT = 0,
-  SPPParameter_Engine_CAFFE = 1,
-  SPPParameter_Engine_CUDNN = 2
-};
-bool SPPParameter_Engine_IsValid(int value);
-const SPPParameter_Engine SPPParameter_Engine_Engine_MIN = SPPParameter_Engine_DEFAULT;
-const SPPParameter_Engine SPPParameter_Engine_Engine_MAX = SPPParameter_Engine_CUDNN;
-const int SPPParameter_Engine_Engine_ARRAYSIZE = SPPParameter_Engine_Engine_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SPPParameter_Engine_descriptor();
-inline const ::std::string& SPPParameter_Engine_Name(SPPParameter_Engine value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SPPParameter_Engine_descriptor(), value);
-}
-inline bool SPPParameter_Engine_Parse(
-    const ::std::string& name, SPPParameter_Engine* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SPPParameter_Engine>(
-    SPPParameter_Engine_descriptor(), name, value);
-}
-enum V1LayerParameter_LayerType {
-  V1LayerParameter_LayerType_NONE = 0,
-  V1LayerParameter_LayerType_ABSVAL = 35,
-  V1LayerParameter_LayerType_ACCURACY = 1,
-  V1LayerParameter_LayerType_ARGMAX = 30,
-  V1LayerParameter_LayerType_BNLL = 2,
-  V1LayerParameter_LayerType_CONCAT = 3,
-  V1LayerParameter_LayerType_CONTRASTIVE_LOSS = 37,
-  V1LayerParameter_LayerType_CONVOLUTION = 4,
-  V1LayerParameter_LayerType_DATA = 5,
-  V1LayerParameter_LayerType_DECONVOLUTION = 39,
-  V1LayerParameter_LayerType_DROPOUT = 6,
-  V1LayerParameter_LayerType_DUMMY_DATA = 32,
-  V1LayerParameter_LayerType_EUCLIDEAN_LOSS = 7,
-  V1LayerParameter_LayerType_ELTWISE = 25,
-  V1LayerParameter_LayerType_EXP = 38,
-  V1LayerParameter_LayerType_FLATTEN = 8,
-  V1LayerParameter_LayerType_HDF5_DATA = 9,
-  V1LayerParameter_LayerType_HDF5_OUTPUT = 10,
-  V1LayerParameter_LayerType_HINGE_LOSS = 28,
-  V1LayerParameter_LayerType_IM2COL = 11,
-  V1LayerParameter_LayerType_IMAGE_DATA = 12,
-  V1LayerParameter_LayerType_INFOGAIN_LOSS = 13,
-  V1LayerParameter_LayerType_INNER_PRODUCT = 14,
-  V1LayerParameter_LayerType_LRN = 15,
-  V1LayerParameter_LayerType_MEMORY_DATA = 29,
-  V1LayerParameter_LayerType_MULTINOMIAL_LOGISTIC_LOSS = 16,
-  V1LayerParameter_LayerType_MVN = 34,
-  V1LayerParameter_LayerType_POOLING = 17,
-  V1LayerParameter_LayerType_POWER = 26,
-  V1LayerParameter_LayerType_RELU = 18,
-  V1LayerParameter_LayerType_SIGMOID = 19,
-  V1LayerParameter_LayerType_SIGMOID_CROSS_ENTROPY_LOSS = 27,
-  V1LayerParameter_LayerType_SILENCE = 36,
-  V1LayerParameter_LayerType_SOFTMAX = 20,
-  V1LayerParameter_LayerType_SOFTMAX_LOSS = 21,
-  V1LayerParameter_LayerType_SPLIT = 22,
-  V1LayerParameter_LayerType_SLICE = 33,
-  V1LayerParameter_LayerType_TANH = 23,
-  V1LayerParameter_LayerType_WINDOW_DATA = 24,
-  V1LayerParameter_LayerType_THRESHOLD = 31
-};
-bool V1LayerParameter_LayerType_IsValid(int value);
-const V1LayerParameter_LayerType V1LayerParameter_LayerType_LayerType_MIN = V1LayerParameter_LayerType_NONE;
-const V1LayerParameter_LayerType V1LayerParameter_LayerType_LayerType_MAX = V1LayerParameter_LayerType_DECONVOLUTION;
-const int V1LayerParameter_LayerType_LayerType_ARRAYSIZE = V1LayerParameter_LayerType_LayerType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* V1LayerParameter_LayerType_descriptor();
-inline const ::std::string& V1LayerParameter_LayerType_Name(V1LayerParameter_LayerType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    V1LayerParameter_LayerType_descriptor(), value);
-}
-inline bool V1LayerParameter_LayerType_Parse(
-    const ::std::string& name, V1LayerParameter_LayerType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<V1LayerParameter_LayerType>(
-    V1LayerParameter_LayerType_descriptor(), name, value);
-}
-enum V1LayerParameter_DimCheckMode {
-  V1LayerParameter_DimCheckMode_STRICT = 0,
-  V1LayerParameter_DimCheckMode_PERMISSIVE = 1
-};
-bool V1LayerParameter_DimCheckMode_IsValid(int value);
-const V1LayerParameter_DimCheckMode V1LayerParameter_DimCheckMode_DimCheckMode_MIN = V1LayerParameter_DimCheckMode_STRICT;
-const V1LayerParameter_DimCheckMode V1LayerParameter_DimCheckMode_DimCheckMode_MAX = V1LayerParameter_DimCheckMode_PERMISSIVE;
-const int V1LayerParameter_DimCheckMode_DimCheckMode_ARRAYSIZE = V1LayerParameter_DimCheckMode_DimCheckMode_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* V1LayerParameter_DimCheckMode_descriptor();
-inline const ::std::string& V1LayerParameter_DimCheckMode_Name(V1LayerParameter_DimCheckMode value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    V1LayerParameter_DimCheckMode_descriptor(), value);
-}
-inline bool V1LayerParameter_DimCheckMode_Parse(
-    const ::std::string& name, V1LayerParameter_DimCheckMode* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<V1LayerParameter_DimCheckMode>(
-    V1LayerParameter_DimCheckMode_descriptor(), name, value);
-}
-enum V0LayerParameter_PoolMethod {
-  V0LayerParameter_PoolMethod_MAX = 0,
-  V0LayerParameter_PoolMethod_AVE = 1,
-  V0LayerParameter_PoolMethod_STOCHASTIC = 2
-};
-bool V0LayerParameter_PoolMethod_IsValid(int value);
-const V0LayerParameter_PoolMethod V0LayerParameter_PoolMethod_PoolMethod_MIN = V0LayerParameter_PoolMethod_MAX;
-const V0LayerParameter_PoolMethod V0LayerParameter_PoolMethod_PoolMethod_MAX = V0LayerParameter_PoolMethod_STOCHASTIC;
-const int V0LayerParameter_PoolMethod_PoolMethod_ARRAYSIZE = V0LayerParameter_PoolMethod_PoolMethod_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* V0LayerParameter_PoolMethod_descriptor();
-inline const ::std::string& V0LayerParameter_PoolMethod_Name(V0LayerParameter_PoolMethod value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    V0LayerParameter_PoolMethod_descriptor(), value);
-}
-inline bool V0LayerParameter_PoolMethod_Parse(
-    const ::std::string& name, V0LayerParameter_PoolMethod* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<V0LayerParameter_PoolMethod>(
-    V0LayerParameter_PoolMethod_descriptor(), name, value);
-}
-enum QuantizationParameter_RoundMethod {
-  QuantizationParameter_RoundMethod_ROUND = 0,
-  QuantizationParameter_RoundMethod_FLOOR = 1,
-  QuantizationParameter_RoundMethod_CEIL = 2,
-  QuantizationParameter_RoundMethod_TRUNC = 3
-};
-bool QuantizationParameter_RoundMethod_IsValid(int value);
-const QuantizationParameter_RoundMethod QuantizationParameter_RoundMethod_RoundMethod_MIN = QuantizationParameter_RoundMethod_ROUND;
-const QuantizationParameter_RoundMethod QuantizationParameter_RoundMethod_RoundMethod_MAX = QuantizationParameter_RoundMethod_TRUNC;
-const int QuantizationParameter_RoundMethod_RoundMethod_ARRAYSIZE = QuantizationParameter_RoundMethod_RoundMethod_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* QuantizationParameter_RoundMethod_descriptor();
-inline const ::std::string& QuantizationParameter_RoundMethod_Name(QuantizationParameter_RoundMethod value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    QuantizationParameter_RoundMethod_descriptor(), value);
-}
-inline bool QuantizationParameter_RoundMethod_Parse(
-    const ::std::string& name, QuantizationParameter_RoundMethod* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<QuantizationParameter_RoundMethod>(
-    QuantizationParameter_RoundMethod_descriptor(), name, value);
-}
-enum QuantizationParameter_RoundStrategy {
-  QuantizationParameter_RoundStrategy_CONSERVATIVE = 0,
-  QuantizationParameter_RoundStrategy_NEUTRAL = 1,
-  QuantizationParameter_RoundStrategy_AGGRESSIVE = 2
-};
-bool QuantizationParameter_RoundStrategy_IsValid(int value);
-const QuantizationParameter_RoundStrategy QuantizationParameter_RoundStrategy_RoundStrategy_MIN = QuantizationParameter_RoundStrategy_CONSERVATIVE;
-const QuantizationParameter_RoundStrategy QuantizationParameter_RoundStrategy_RoundStrategy_MAX = QuantizationParameter_RoundStrategy_AGGRESSIVE;
-const int QuantizationParameter_RoundStrategy_RoundStrategy_ARRAYSIZE = QuantizationParameter_RoundStrategy_RoundStrategy_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* QuantizationParameter_RoundStrategy_descriptor();
-inline const ::std::string& QuantizationParameter_RoundStrategy_Name(QuantizationParameter_RoundStrategy value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    QuantizationParameter_RoundStrategy_descriptor(), value);
-}
-inline bool QuantizationParameter_RoundStrategy_Parse(
-    const ::std::string& name, QuantizationParameter_RoundStrategy* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<QuantizationParameter_RoundStrategy>(
-    QuantizationParameter_RoundStrategy_descriptor(), name, value);
-}
-enum Phase {
-  TRAIN = 0,
-  TEST = 1
-};
-bool Phase_IsValid(int value);
-const Phase Phase_MIN = TRAIN;
-const Phase Phase_MAX = TEST;
-const int Phase_ARRAYSIZE = Phase_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Phase_descriptor();
-inline const ::std::string& Phase_Name(Phase value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Phase_descriptor(), value);
-}
-inline bool Phase_Parse(
-    const ::std::string& name, Phase* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Phase>(
-    Phase_descriptor(), name, value);
-}
-// ===================================================================
-
-class BlobShape : public ::google::protobuf::Message {
- public:
-  BlobShape();
-  virtual ~BlobShape();
-
-  BlobShape(const BlobShape& from);
-
-  inline BlobShape& operator=(const BlobShape& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BlobShape& default_instance();
-
-  void Swap(BlobShape* other);
-
-  // implements Message ----------------------------------------------
-
-  BlobShape* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BlobShape& from);
-  void MergeFrom(const BlobShape& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // repeated int64 dim = 1 [packed = true];
-  inline int dim_size() const;
-  inline void clear_dim();
-  static const int kDimFieldNumber = 1;
-  inline ::google::protobuf::int64 dim(int index) const;
-  inline void set_dim(int index, ::google::protobuf::int64 value);
-  inline void add_dim(::google::protobuf::int64 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
-      dim() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
-      mutable_dim();
-
-  // @@protoc_insertion_point(class_scope:caffe.BlobShape)
- private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > dim_;
-  mutable int _dim_cached_byte_size_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static BlobShape* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class BlobProto : public ::google::protobuf::Message {
- public:
-  BlobProto();
-  virtual ~BlobProto();
-
-  BlobProto(const BlobProto& from);
-
-  inline BlobProto& operator=(const BlobProto& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BlobProto& default_instance();
-
-  void Swap(BlobProto* other);
-
-  // implements Message ----------------------------------------------
-
-  BlobProto* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BlobProto& from);
-  void MergeFrom(const BlobProto& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.BlobShape shape = 7;
-  inline bool has_shape() const;
-  inline void clear_shape();
-  static const int kShapeFieldNumber = 7;
-  inline const ::caffe::BlobShape& shape() const;
-  inline ::caffe::BlobShape* mutable_shape();
-  inline ::caffe::BlobShape* release_shape();
-  inline void set_allocated_shape(::caffe::BlobShape* shape);
-
-  // repeated float data = 5 [packed = true];
-  inline int data_size() const;
-  inline void clear_data();
-  static const int kDataFieldNumber = 5;
-  inline float data(int index) const;
-  inline void set_data(int index, float value);
-  inline void add_data(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      data() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_data();
-
-  // repeated float diff = 6 [packed = true];
-  inline int diff_size() const;
-  inline void clear_diff();
-  static const int kDiffFieldNumber = 6;
-  inline float diff(int index) const;
-  inline void set_diff(int index, float value);
-  inline void add_diff(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      diff() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_diff();
-
-  // repeated double double_data = 8 [packed = true];
-  inline int double_data_size() const;
-  inline void clear_double_data();
-  static const int kDoubleDataFieldNumber = 8;
-  inline double double_data(int index) const;
-  inline void set_double_data(int index, double value);
-  inline void add_double_data(double value);
-  inline const ::google::protobuf::RepeatedField< double >&
-      double_data() const;
-  inline ::google::protobuf::RepeatedField< double >*
-      mutable_double_data();
-
-  // repeated double double_diff = 9 [packed = true];
-  inline int double_diff_size() const;
-  inline void clear_double_diff();
-  static const int kDoubleDiffFieldNumber = 9;
-  inline double double_diff(int index) const;
-  inline void set_double_diff(int index, double value);
-  inline void add_double_diff(double value);
-  inline const ::google::protobuf::RepeatedField< double >&
-      double_diff() const;
-  inline ::google::protobuf::RepeatedField< double >*
-      mutable_double_diff();
-
-  // optional int32 num = 1 [default = 0];
-  inline bool has_num() const;
-  inline void clear_num();
-  static const int kNumFieldNumber = 1;
-  inline ::google::protobuf::int32 num() const;
-  inline void set_num(::google::protobuf::int32 value);
-
-  // optional int32 channels = 2 [default = 0];
-  inline bool has_channels() const;
-  inline void clear_channels();
-  static const int kChannelsFieldNumber = 2;
-  inline ::google::protobuf::int32 channels() const;
-  inline void set_channels(::google::protobuf::int32 value);
-
-  // optional int32 height = 3 [default = 0];
-  inline bool has_height() const;
-  inline void clear_height();
-  static const int kHeightFieldNumber = 3;
-  inline ::google::protobuf::int32 height() const;
-  inline void set_height(::google::protobuf::int32 value);
-
-  // optional int32 width = 4 [default = 0];
-  inline bool has_width() const;
-  inline void clear_width();
-  static const int kWidthFieldNumber = 4;
-  inline ::google::protobuf::int32 width() const;
-  inline void set_width(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.BlobProto)
- private:
-  inline void set_has_shape();
-  inline void clear_has_shape();
-  inline void set_has_num();
-  inline void clear_has_num();
-  inline void set_has_channels();
-  inline void clear_has_channels();
-  inline void set_has_height();
-  inline void clear_has_height();
-  inline void set_has_width();
-  inline void clear_has_width();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::caffe::BlobShape* shape_;
-  ::google::protobuf::RepeatedField< float > data_;
-  mutable int _data_cached_byte_size_;
-  ::google::protobuf::RepeatedField< float > diff_;
-  mutable int _diff_cached_byte_size_;
-  ::google::protobuf::RepeatedField< double > double_data_;
-  mutable int _double_data_cached_byte_size_;
-  ::google::protobuf::RepeatedField< double > double_diff_;
-  mutable int _double_diff_cached_byte_size_;
-  ::google::protobuf::int32 num_;
-  ::google::protobuf::int32 channels_;
-  ::google::protobuf::int32 height_;
-  ::google::protobuf::int32 width_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static BlobProto* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class BlobProtoVector : public ::google::protobuf::Message {
- public:
-  BlobProtoVector();
-  virtual ~BlobProtoVector();
-
-  BlobProtoVector(const BlobProtoVector& from);
-
-  inline BlobProtoVector& operator=(const BlobProtoVector& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BlobProtoVector& default_instance();
-
-  void Swap(BlobProtoVector* other);
-
-  // implements Message ----------------------------------------------
-
-  BlobProtoVector* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BlobProtoVector& from);
-  void MergeFrom(const BlobProtoVector& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // repeated .caffe.BlobProto blobs = 1;
-  inline int blobs_size() const;
-  inline void clear_blobs();
-  static const int kBlobsFieldNumber = 1;
-  inline const ::caffe::BlobProto& blobs(int index) const;
-  inline ::caffe::BlobProto* mutable_blobs(int index);
-  inline ::caffe::BlobProto* add_blobs();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-      mutable_blobs();
-
-  // @@protoc_insertion_point(class_scope:caffe.BlobProtoVector)
- private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto > blobs_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static BlobProtoVector* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class Datum : public ::google::protobuf::Message {
- public:
-  Datum();
-  virtual ~Datum();
-
-  Datum(const Datum& from);
-
-  inline Datum& operator=(const Datum& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Datum& default_instance();
-
-  void Swap(Datum* other);
-
-  // implements Message ----------------------------------------------
-
-  Datum* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Datum& from);
-  void MergeFrom(const Datum& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 channels = 1;
-  inline bool has_channels() const;
-  inline void clear_channels();
-  static const int kChannelsFieldNumber = 1;
-  inline ::google::protobuf::int32 channels() const;
-  inline void set_channels(::google::protobuf::int32 value);
-
-  // optional int32 height = 2;
-  inline bool has_height() const;
-  inline void clear_height();
-  static const int kHeightFieldNumber = 2;
-  inline ::google::protobuf::int32 height() const;
-  inline void set_height(::google::protobuf::int32 value);
-
-  // optional int32 width = 3;
-  inline bool has_width() const;
-  inline void clear_width();
-  static const int kWidthFieldNumber = 3;
-  inline ::google::protobuf::int32 width() const;
-  inline void set_width(::google::protobuf::int32 value);
-
-  // optional bytes data = 4;
-  inline bool has_data() const;
-  inline void clear_data();
-  static const int kDataFieldNumber = 4;
-  inline const ::std::string& data() const;
-  inline void set_data(const ::std::string& value);
-  inline void set_data(const char* value);
-  inline void set_data(const void* value, size_t size);
-  inline ::std::string* mutable_data();
-  inline ::std::string* release_data();
-  inline void set_allocated_data(::std::string* data);
-
-  // optional int32 label = 5;
-  inline bool has_label() const;
-  inline void clear_label();
-  static const int kLabelFieldNumber = 5;
-  inline ::google::protobuf::int32 label() const;
-  inline void set_label(::google::protobuf::int32 value);
-
-  // repeated float float_data = 6;
-  inline int float_data_size() const;
-  inline void clear_float_data();
-  static const int kFloatDataFieldNumber = 6;
-  inline float float_data(int index) const;
-  inline void set_float_data(int index, float value);
-  inline void add_float_data(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      float_data() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_float_data();
-
-  // optional bool encoded = 7 [default = false];
-  inline bool has_encoded() const;
-  inline void clear_encoded();
-  static const int kEncodedFieldNumber = 7;
-  inline bool encoded() const;
-  inline void set_encoded(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.Datum)
- private:
-  inline void set_has_channels();
-  inline void clear_has_channels();
-  inline void set_has_height();
-  inline void clear_has_height();
-  inline void set_has_width();
-  inline void clear_has_width();
-  inline void set_has_data();
-  inline void clear_has_data();
-  inline void set_has_label();
-  inline void clear_has_label();
-  inline void set_has_encoded();
-  inline void clear_has_encoded();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 channels_;
-  ::google::protobuf::int32 height_;
-  ::std::string* data_;
-  ::google::protobuf::int32 width_;
-  ::google::protobuf::int32 label_;
-  ::google::protobuf::RepeatedField< float > float_data_;
-  bool encoded_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static Datum* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class FillerParameter : public ::google::protobuf::Message {
- public:
-  FillerParameter();
-  virtual ~FillerParameter();
-
-  FillerParameter(const FillerParameter& from);
-
-  inline FillerParameter& operator=(const FillerParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const FillerParameter& default_instance();
-
-  void Swap(FillerParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  FillerParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const FillerParameter& from);
-  void MergeFrom(const FillerParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef FillerParameter_VarianceNorm VarianceNorm;
-  static const VarianceNorm FAN_IN = FillerParameter_VarianceNorm_FAN_IN;
-  static const VarianceNorm FAN_OUT = FillerParameter_VarianceNorm_FAN_OUT;
-  static const VarianceNorm AVERAGE = FillerParameter_VarianceNorm_AVERAGE;
-  static inline bool VarianceNorm_IsValid(int value) {
-    return FillerParameter_VarianceNorm_IsValid(value);
-  }
-  static const VarianceNorm VarianceNorm_MIN =
-    FillerParameter_VarianceNorm_VarianceNorm_MIN;
-  static const VarianceNorm VarianceNorm_MAX =
-    FillerParameter_VarianceNorm_VarianceNorm_MAX;
-  static const int VarianceNorm_ARRAYSIZE =
-    FillerParameter_VarianceNorm_VarianceNorm_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  VarianceNorm_descriptor() {
-    return FillerParameter_VarianceNorm_descriptor();
-  }
-  static inline const ::std::string& VarianceNorm_Name(VarianceNorm value) {
-    return FillerParameter_VarianceNorm_Name(value);
-  }
-  static inline bool VarianceNorm_Parse(const ::std::string& name,
-      VarianceNorm* value) {
-    return FillerParameter_VarianceNorm_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional string type = 1 [default = "constant"];
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline const ::std::string& type() const;
-  inline void set_type(const ::std::string& value);
-  inline void set_type(const char* value);
-  inline void set_type(const char* value, size_t size);
-  inline ::std::string* mutable_type();
-  inline ::std::string* release_type();
-  inline void set_allocated_type(::std::string* type);
-
-  // optional float value = 2 [default = 0];
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 2;
-  inline float value() const;
-  inline void set_value(float value);
-
-  // optional float min = 3 [default = 0];
-  inline bool has_min() const;
-  inline void clear_min();
-  static const int kMinFieldNumber = 3;
-  inline float min() const;
-  inline void set_min(float value);
-
-  // optional float max = 4 [default = 1];
-  inline bool has_max() const;
-  inline void clear_max();
-  static const int kMaxFieldNumber = 4;
-  inline float max() const;
-  inline void set_max(float value);
-
-  // optional float mean = 5 [default = 0];
-  inline bool has_mean() const;
-  inline void clear_mean();
-  static const int kMeanFieldNumber = 5;
-  inline float mean() const;
-  inline void set_mean(float value);
-
-  // optional float std = 6 [default = 1];
-  inline bool has_std() const;
-  inline void clear_std();
-  static const int kStdFieldNumber = 6;
-  inline float std() const;
-  inline void set_std(float value);
-
-  // optional int32 sparse = 7 [default = -1];
-  inline bool has_sparse() const;
-  inline void clear_sparse();
-  static const int kSparseFieldNumber = 7;
-  inline ::google::protobuf::int32 sparse() const;
-  inline void set_sparse(::google::protobuf::int32 value);
-
-  // optional .caffe.FillerParameter.VarianceNorm variance_norm = 8 [default = FAN_IN];
-  inline bool has_variance_norm() const;
-  inline void clear_variance_norm();
-  static const int kVarianceNormFieldNumber = 8;
-  inline ::caffe::FillerParameter_VarianceNorm variance_norm() const;
-  inline void set_variance_norm(::caffe::FillerParameter_VarianceNorm value);
-
-  // @@protoc_insertion_point(class_scope:caffe.FillerParameter)
- private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_value();
-  inline void clear_has_value();
-  inline void set_has_min();
-  inline void clear_has_min();
-  inline void set_has_max();
-  inline void clear_has_max();
-  inline void set_has_mean();
-  inline void clear_has_mean();
-  inline void set_has_std();
-  inline void clear_has_std();
-  inline void set_has_sparse();
-  inline void clear_has_sparse();
-  inline void set_has_variance_norm();
-  inline void clear_has_variance_norm();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  static ::std::string* _default_type_;
-  ::std::string* type_;
-  float value_;
-  float min_;
-  float max_;
-  float mean_;
-  float std_;
-  ::google::protobuf::int32 sparse_;
-  int variance_norm_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static FillerParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class NetParameter : public ::google::protobuf::Message {
- public:
-  NetParameter();
-  virtual ~NetParameter();
-
-  NetParameter(const NetParameter& from);
-
-  inline NetParameter& operator=(const NetParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NetParameter& default_instance();
-
-  void Swap(NetParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  NetParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const NetParameter& from);
-  void MergeFrom(const NetParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
-  // repeated string input = 3;
-  inline int input_size() const;
-  inline void clear_input();
-  static const int kInputFieldNumber = 3;
-  inline const ::std::string& input(int index) const;
-  inline ::std::string* mutable_input(int index);
-  inline void set_input(int index, const ::std::string& value);
-  inline void set_input(int index, const char* value);
-  inline void set_input(int index, const char* value, size_t size);
-  inline ::std::string* add_input();
-  inline void add_input(const ::std::string& value);
-  inline void add_input(const char* value);
-  inline void add_input(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& input() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_input();
-
-  // repeated .caffe.BlobShape input_shape = 8;
-  inline int input_shape_size() const;
-  inline void clear_input_shape();
-  static const int kInputShapeFieldNumber = 8;
-  inline const ::caffe::BlobShape& input_shape(int index) const;
-  inline ::caffe::BlobShape* mutable_input_shape(int index);
-  inline ::caffe::BlobShape* add_input_shape();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-      input_shape() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
-      mutable_input_shape();
-
-  // repeated int32 input_dim = 4;
-  inline int input_dim_size() const;
-  inline void clear_input_dim();
-  static const int kInputDimFieldNumber = 4;
-  inline ::google::protobuf::int32 input_dim(int index) const;
-  inline void set_input_dim(int index, ::google::protobuf::int32 value);
-  inline void add_input_dim(::google::protobuf::int32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      input_dim() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_input_dim();
-
-  // optional bool force_backward = 5 [default = false];
-  inline bool has_force_backward() const;
-  inline void clear_force_backward();
-  static const int kForceBackwardFieldNumber = 5;
-  inline bool force_backward() const;
-  inline void set_force_backward(bool value);
-
-  // optional .caffe.NetState state = 6;
-  inline bool has_state() const;
-  inline void clear_state();
-  static const int kStateFieldNumber = 6;
-  inline const ::caffe::NetState& state() const;
-  inline ::caffe::NetState* mutable_state();
-  inline ::caffe::NetState* release_state();
-  inline void set_allocated_state(::caffe::NetState* state);
-
-  // optional bool debug_info = 7 [default = false];
-  inline bool has_debug_info() const;
-  inline void clear_debug_info();
-  static const int kDebugInfoFieldNumber = 7;
-  inline bool debug_info() const;
-  inline void set_debug_info(bool value);
-
-  // repeated .caffe.LayerParameter layer = 100;
-  inline int layer_size() const;
-  inline void clear_layer();
-  static const int kLayerFieldNumber = 100;
-  inline const ::caffe::LayerParameter& layer(int index) const;
-  inline ::caffe::LayerParameter* mutable_layer(int index);
-  inline ::caffe::LayerParameter* add_layer();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >&
-      layer() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >*
-      mutable_layer();
-
-  // repeated .caffe.V1LayerParameter layers = 2;
-  inline int layers_size() const;
-  inline void clear_layers();
-  static const int kLayersFieldNumber = 2;
-  inline const ::caffe::V1LayerParameter& layers(int index) const;
-  inline ::caffe::V1LayerParameter* mutable_layers(int index);
-  inline ::caffe::V1LayerParameter* add_layers();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >&
-      layers() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >*
-      mutable_layers();
-
-  // @@protoc_insertion_point(class_scope:caffe.NetParameter)
- private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_force_backward();
-  inline void clear_has_force_backward();
-  inline void set_has_state();
-  inline void clear_has_state();
-  inline void set_has_debug_info();
-  inline void clear_has_debug_info();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* name_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> input_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape > input_shape_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > input_dim_;
-  ::caffe::NetState* state_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter > layer_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter > layers_;
-  bool force_backward_;
-  bool debug_info_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static NetParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class SolverParameter : public ::google::protobuf::Message {
- public:
-  SolverParameter();
-  virtual ~SolverParameter();
-
-  SolverParameter(const SolverParameter& from);
-
-  inline SolverParameter& operator=(const SolverParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SolverParameter& default_instance();
-
-  void Swap(SolverParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  SolverParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SolverParameter& from);
-  void MergeFrom(const SolverParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef SolverParameter_SnapshotFormat SnapshotFormat;
-  static const SnapshotFormat HDF5 = SolverParameter_SnapshotFormat_HDF5;
-  static const SnapshotFormat BINARYPROTO = SolverParameter_SnapshotFormat_BINARYPROTO;
-  static inline bool SnapshotFormat_IsValid(int value) {
-    return SolverParameter_SnapshotFormat_IsValid(value);
-  }
-  static const SnapshotFormat SnapshotFormat_MIN =
-    SolverParameter_SnapshotFormat_SnapshotFormat_MIN;
-  static const SnapshotFormat SnapshotFormat_MAX =
-    SolverParameter_SnapshotFormat_SnapshotFormat_MAX;
-  static const int SnapshotFormat_ARRAYSIZE =
-    SolverParameter_SnapshotFormat_SnapshotFormat_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  SnapshotFormat_descriptor() {
-    return SolverParameter_SnapshotFormat_descriptor();
-  }
-  static inline const ::std::string& SnapshotFormat_Name(SnapshotFormat value) {
-    return SolverParameter_SnapshotFormat_Name(value);
-  }
-  static inline bool SnapshotFormat_Parse(const ::std::string& name,
-      SnapshotFormat* value) {
-    return SolverParameter_SnapshotFormat_Parse(name, value);
-  }
-
-  typedef SolverParameter_SolverMode SolverMode;
-  static const SolverMode CPU = SolverParameter_SolverMode_CPU;
-  static const SolverMode GPU = SolverParameter_SolverMode_GPU;
-  static inline bool SolverMode_IsValid(int value) {
-    return SolverParameter_SolverMode_IsValid(value);
-  }
-  static const SolverMode SolverMode_MIN =
-    SolverParameter_SolverMode_SolverMode_MIN;
-  static const SolverMode SolverMode_MAX =
-    SolverParameter_SolverMode_SolverMode_MAX;
-  static const int SolverMode_ARRAYSIZE =
-    SolverParameter_SolverMode_SolverMode_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  SolverMode_descriptor() {
-    return SolverParameter_SolverMode_descriptor();
-  }
-  static inline const ::std::string& SolverMode_Name(SolverMode value) {
-    return SolverParameter_SolverMode_Name(value);
-  }
-  static inline bool SolverMode_Parse(const ::std::string& name,
-      SolverMode* value) {
-    return SolverParameter_SolverMode_Parse(name, value);
-  }
-
-  typedef SolverParameter_SolverType SolverType;
-  static const SolverType SGD = SolverParameter_SolverType_SGD;
-  static const SolverType NESTEROV = SolverParameter_SolverType_NESTEROV;
-  static const SolverType ADAGRAD = SolverParameter_SolverType_ADAGRAD;
-  static const SolverType RMSPROP = SolverParameter_SolverType_RMSPROP;
-  static const SolverType ADADELTA = SolverParameter_SolverType_ADADELTA;
-  static const SolverType ADAM = SolverParameter_SolverType_ADAM;
-  static inline bool SolverType_IsValid(int value) {
-    return SolverParameter_SolverType_IsValid(value);
-  }
-  static const SolverType SolverType_MIN =
-    SolverParameter_SolverType_SolverType_MIN;
-  static const SolverType SolverType_MAX =
-    SolverParameter_SolverType_SolverType_MAX;
-  static const int SolverType_ARRAYSIZE =
-    SolverParameter_SolverType_SolverType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  SolverType_descriptor() {
-    return SolverParameter_SolverType_descriptor();
-  }
-  static inline const ::std::string& SolverType_Name(SolverType value) {
-    return SolverParameter_SolverType_Name(value);
-  }
-  static inline bool SolverType_Parse(const ::std::string& name,
-      SolverType* value) {
-    return SolverParameter_SolverType_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional string net = 24;
-  inline bool has_net() const;
-  inline void clear_net();
-  static const int kNetFieldNumber = 24;
-  inline const ::std::string& net() const;
-  inline void set_net(const ::std::string& value);
-  inline void set_net(const char* value);
-  inline void set_net(const char* value, size_t size);
-  inline ::std::string* mutable_net();
-  inline ::std::string* release_net();
-  inline void set_allocated_net(::std::string* net);
-
-  // optional .caffe.NetParameter net_param = 25;
-  inline bool has_net_param() const;
-  inline void clear_net_param();
-  static const int kNetParamFieldNumber = 25;
-  inline const ::caffe::NetParameter& net_param() const;
-  inline ::caffe::NetParameter* mutable_net_param();
-  inline ::caffe::NetParameter* release_net_param();
-  inline void set_allocated_net_param(::caffe::NetParameter* net_param);
-
-  // optional string train_net = 1;
-  inline bool has_train_net() const;
-  inline void clear_train_net();
-  static const int kTrainNetFieldNumber = 1;
-  inline const ::std::string& train_net() const;
-  inline void set_train_net(const ::std::string& value);
-  inline void set_train_net(const char* value);
-  inline void set_train_net(const char* value, size_t size);
-  inline ::std::string* mutable_train_net();
-  inline ::std::string* release_train_net();
-  inline void set_allocated_train_net(::std::string* train_net);
-
-  // repeated string test_net = 2;
-  inline int test_net_size() const;
-  inline void clear_test_net();
-  static const int kTestNetFieldNumber = 2;
-  inline const ::std::string& test_net(int index) const;
-  inline ::std::string* mutable_test_net(int index);
-  inline void set_test_net(int index, const ::std::string& value);
-  inline void set_test_net(int index, const char* value);
-  inline void set_test_net(int index, const char* value, size_t size);
-  inline ::std::string* add_test_net();
-  inline void add_test_net(const ::std::string& value);
-  inline void add_test_net(const char* value);
-  inline void add_test_net(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& test_net() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_test_net();
-
-  // optional .caffe.NetParameter train_net_param = 21;
-  inline bool has_train_net_param() const;
-  inline void clear_train_net_param();
-  static const int kTrainNetParamFieldNumber = 21;
-  inline const ::caffe::NetParameter& train_net_param() const;
-  inline ::caffe::NetParameter* mutable_train_net_param();
-  inline ::caffe::NetParameter* release_train_net_param();
-  inline void set_allocated_train_net_param(::caffe::NetParameter* train_net_param);
-
-  // repeated .caffe.NetParameter test_net_param = 22;
-  inline int test_net_param_size() const;
-  inline void clear_test_net_param();
-  static const int kTestNetParamFieldNumber = 22;
-  inline const ::caffe::NetParameter& test_net_param(int index) const;
-  inline ::caffe::NetParameter* mutable_test_net_param(int index);
-  inline ::caffe::NetParameter* add_test_net_param();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >&
-      test_net_param() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >*
-      mutable_test_net_param();
-
-  // optional .caffe.NetState train_state = 26;
-  inline bool has_train_state() const;
-  inline void clear_train_state();
-  static const int kTrainStateFieldNumber = 26;
-  inline const ::caffe::NetState& train_state() const;
-  inline ::caffe::NetState* mutable_train_state();
-  inline ::caffe::NetState* release_train_state();
-  inline void set_allocated_train_state(::caffe::NetState* train_state);
-
-  // repeated .caffe.NetState test_state = 27;
-  inline int test_state_size() const;
-  inline void clear_test_state();
-  static const int kTestStateFieldNumber = 27;
-  inline const ::caffe::NetState& test_state(int index) const;
-  inline ::caffe::NetState* mutable_test_state(int index);
-  inline ::caffe::NetState* add_test_state();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetState >&
-      test_state() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::NetState >*
-      mutable_test_state();
-
-  // repeated int32 test_iter = 3;
-  inline int test_iter_size() const;
-  inline void clear_test_iter();
-  static const int kTestIterFieldNumber = 3;
-  inline ::google::protobuf::int32 test_iter(int index) const;
-  inline void set_test_iter(int index, ::google::protobuf::int32 value);
-  inline void add_test_iter(::google::protobuf::int32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      test_iter() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_test_iter();
-
-  // optional int32 test_interval = 4 [default = 0];
-  inline bool has_test_interval() const;
-  inline void clear_test_interval();
-  static const int kTestIntervalFieldNumber = 4;
-  inline ::google::protobuf::int32 test_interval() const;
-  inline void set_test_interval(::google::protobuf::int32 value);
-
-  // optional bool test_compute_loss = 19 [default = false];
-  inline bool has_test_compute_loss() const;
-  inline void clear_test_compute_loss();
-  static const int kTestComputeLossFieldNumber = 19;
-  inline bool test_compute_loss() const;
-  inline void set_test_compute_loss(bool value);
-
-  // optional bool test_initialization = 32 [default = true];
-  inline bool has_test_initialization() const;
-  inline void clear_test_initialization();
-  static const int kTestInitializationFieldNumber = 32;
-  inline bool test_initialization() const;
-  inline void set_test_initialization(bool value);
-
-  // optional float base_lr = 5;
-  inline bool has_base_lr() const;
-  inline void clear_base_lr();
-  static const int kBaseLrFieldNumber = 5;
-  inline float base_lr() const;
-  inline void set_base_lr(float value);
-
-  // optional int32 display = 6;
-  inline bool has_display() const;
-  inline void clear_display();
-  static const int kDisplayFieldNumber = 6;
-  inline ::google::protobuf::int32 display() const;
-  inline void set_display(::google::protobuf::int32 value);
-
-  // optional int32 average_loss = 33 [default = 1];
-  inline bool has_average_loss() const;
-  inline void clear_average_loss();
-  static const int kAverageLossFieldNumber = 33;
-  inline ::google::protobuf::int32 average_loss() const;
-  inline void set_average_loss(::google::protobuf::int32 value);
-
-  // optional int32 max_iter = 7;
-  inline bool has_max_iter() const;
-  inline void clear_max_iter();
-  static const int kMaxIterFieldNumber = 7;
-  inline ::google::protobuf::int32 max_iter() const;
-  inline void set_max_iter(::google::protobuf::int32 value);
-
-  // optional int32 iter_size = 36 [default = 1];
-  inline bool has_iter_size() const;
-  inline void clear_iter_size();
-  static const int kIterSizeFieldNumber = 36;
-  inline ::google::protobuf::int32 iter_size() const;
-  inline void set_iter_size(::google::protobuf::int32 value);
-
-  // optional string lr_policy = 8;
-  inline bool has_lr_policy() const;
-  inline void clear_lr_policy();
-  static const int kLrPolicyFieldNumber = 8;
-  inline const ::std::string& lr_policy() const;
-  inline void set_lr_policy(const ::std::string& value);
-  inline void set_lr_policy(const char* value);
-  inline void set_lr_policy(const char* value, size_t size);
-  inline ::std::string* mutable_lr_policy();
-  inline ::std::string* release_lr_policy();
-  inline void set_allocated_lr_policy(::std::string* lr_policy);
-
-  // optional float gamma = 9;
-  inline bool has_gamma() const;
-  inline void clear_gamma();
-  static const int kGammaFieldNumber = 9;
-  inline float gamma() const;
-  inline void set_gamma(float value);
-
-  // optional float power = 10;
-  inline bool has_power() const;
-  inline void clear_power();
-  static const int kPowerFieldNumber = 10;
-  inline float power() const;
-  inline void set_power(float value);
-
-  // optional float momentum = 11;
-  inline bool has_momentum() const;
-  inline void clear_momentum();
-  static const int kMomentumFieldNumber = 11;
-  inline float momentum() const;
-  inline void set_momentum(float value);
-
-  // optional float weight_decay = 12;
-  inline bool has_weight_decay() const;
-  inline void clear_weight_decay();
-  static const int kWeightDecayFieldNumber = 12;
-  inline float weight_decay() const;
-  inline void set_weight_decay(float value);
-
-  // optional string regularization_type = 29 [default = "L2"];
-  inline bool has_regularization_type() const;
-  inline void clear_regularization_type();
-  static const int kRegularizationTypeFieldNumber = 29;
-  inline const ::std::string& regularization_type() const;
-  inline void set_regularization_type(const ::std::string& value);
-  inline void set_regularization_type(const char* value);
-  inline void set_regularization_type(const char* value, size_t size);
-  inline ::std::string* mutable_regularization_type();
-  inline ::std::string* release_regularization_type();
-  inline void set_allocated_regularization_type(::std::string* regularization_type);
-
-  // optional int32 stepsize = 13;
-  inline bool has_stepsize() const;
-  inline void clear_stepsize();
-  static const int kStepsizeFieldNumber = 13;
-  inline ::google::protobuf::int32 stepsize() const;
-  inline void set_stepsize(::google::protobuf::int32 value);
-
-  // repeated int32 stepvalue = 34;
-  inline int stepvalue_size() const;
-  inline void clear_stepvalue();
-  static const int kStepvalueFieldNumber = 34;
-  inline ::google::protobuf::int32 stepvalue(int index) const;
-  inline void set_stepvalue(int index, ::google::protobuf::int32 value);
-  inline void add_stepvalue(::google::protobuf::int32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      stepvalue() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_stepvalue();
-
-  // optional float clip_gradients = 35 [default = -1];
-  inline bool has_clip_gradients() const;
-  inline void clear_clip_gradients();
-  static const int kClipGradientsFieldNumber = 35;
-  inline float clip_gradients() const;
-  inline void set_clip_gradients(float value);
-
-  // optional int32 snapshot = 14 [default = 0];
-  inline bool has_snapshot() const;
-  inline void clear_snapshot();
-  static const int kSnapshotFieldNumber = 14;
-  inline ::google::protobuf::int32 snapshot() const;
-  inline void set_snapshot(::google::protobuf::int32 value);
-
-  // optional string snapshot_prefix = 15;
-  inline bool has_snapshot_prefix() const;
-  inline void clear_snapshot_prefix();
-  static const int kSnapshotPrefixFieldNumber = 15;
-  inline const ::std::string& snapshot_prefix() const;
-  inline void set_snapshot_prefix(const ::std::string& value);
-  inline void set_snapshot_prefix(const char* value);
-  inline void set_snapshot_prefix(const char* value, size_t size);
-  inline ::std::string* mutable_snapshot_prefix();
-  inline ::std::string* release_snapshot_prefix();
-  inline void set_allocated_snapshot_prefix(::std::string* snapshot_prefix);
-
-  // optional bool snapshot_diff = 16 [default = false];
-  inline bool has_snapshot_diff() const;
-  inline void clear_snapshot_diff();
-  static const int kSnapshotDiffFieldNumber = 16;
-  inline bool snapshot_diff() const;
-  inline void set_snapshot_diff(bool value);
-
-  // optional .caffe.SolverParameter.SnapshotFormat snapshot_format = 37 [default = BINARYPROTO];
-  inline bool has_snapshot_format() const;
-  inline void clear_snapshot_format();
-  static const int kSnapshotFormatFieldNumber = 37;
-  inline ::caffe::SolverParameter_SnapshotFormat snapshot_format() const;
-  inline void set_snapshot_format(::caffe::SolverParameter_SnapshotFormat value);
-
-  // optional .caffe.SolverParameter.SolverMode solver_mode = 17 [default = GPU];
-  inline bool has_solver_mode() const;
-  inline void clear_solver_mode();
-  static const int kSolverModeFieldNumber = 17;
-  inline ::caffe::SolverParameter_SolverMode solver_mode() const;
-  inline void set_solver_mode(::caffe::SolverParameter_SolverMode value);
-
-  // optional int32 device_id = 18 [default = 0];
-  inline bool has_device_id() const;
-  inline void clear_device_id();
-  static const int kDeviceIdFieldNumber = 18;
-  inline ::google::protobuf::int32 device_id() const;
-  inline void set_device_id(::google::protobuf::int32 value);
-
-  // optional int64 random_seed = 20 [default = -1];
-  inline bool has_random_seed() const;
-  inline void clear_random_seed();
-  static const int kRandomSeedFieldNumber = 20;
-  inline ::google::protobuf::int64 random_seed() const;
-  inline void set_random_seed(::google::protobuf::int64 value);
-
-  // optional string type = 40 [default = "SGD"];
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 40;
-  inline const ::std::string& type() const;
-  inline void set_type(const ::std::string& value);
-  inline void set_type(const char* value);
-  inline void set_type(const char* value, size_t size);
-  inline ::std::string* mutable_type();
-  inline ::std::string* release_type();
-  inline void set_allocated_type(::std::string* type);
-
-  // optional float delta = 31 [default = 1e-08];
-  inline bool has_delta() const;
-  inline void clear_delta();
-  static const int kDeltaFieldNumber = 31;
-  inline float delta() const;
-  inline void set_delta(float value);
-
-  // optional float momentum2 = 39 [default = 0.999];
-  inline bool has_momentum2() const;
-  inline void clear_momentum2();
-  static const int kMomentum2FieldNumber = 39;
-  inline float momentum2() const;
-  inline void set_momentum2(float value);
-
-  // optional float rms_decay = 38 [default = 0.99];
-  inline bool has_rms_decay() const;
-  inline void clear_rms_decay();
-  static const int kRmsDecayFieldNumber = 38;
-  inline float rms_decay() const;
-  inline void set_rms_decay(float value);
-
-  // optional bool debug_info = 23 [default = false];
-  inline bool has_debug_info() const;
-  inline void clear_debug_info();
-  static const int kDebugInfoFieldNumber = 23;
-  inline bool debug_info() const;
-  inline void set_debug_info(bool value);
-
-  // optional bool snapshot_after_train = 28 [default = true];
-  inline bool has_snapshot_after_train() const;
-  inline void clear_snapshot_after_train();
-  static const int kSnapshotAfterTrainFieldNumber = 28;
-  inline bool snapshot_after_train() const;
-  inline void set_snapshot_after_train(bool value);
-
-  // optional .caffe.SolverParameter.SolverType solver_type = 30 [default = SGD];
-  inline bool has_solver_type() const;
-  inline void clear_solver_type();
-  static const int kSolverTypeFieldNumber = 30;
-  inline ::caffe::SolverParameter_SolverType solver_type() const;
-  inline void set_solver_type(::caffe::SolverParameter_SolverType value);
-
-  // @@protoc_insertion_point(class_scope:caffe.SolverParameter)
- private:
-  inline void set_has_net();
-  inline void clear_has_net();
-  inline void set_has_net_param();
-  inline void clear_has_net_param();
-  inline void set_has_train_net();
-  inline void clear_has_train_net();
-  inline void set_has_train_net_param();
-  inline void clear_has_train_net_param();
-  inline void set_has_train_state();
-  inline void clear_has_train_state();
-  inline void set_has_test_interval();
-  inline void clear_has_test_interval();
-  inline void set_has_test_compute_loss();
-  inline void clear_has_test_compute_loss();
-  inline void set_has_test_initialization();
-  inline void clear_has_test_initialization();
-  inline void set_has_base_lr();
-  inline void clear_has_base_lr();
-  inline void set_has_display();
-  inline void clear_has_display();
-  inline void set_has_average_loss();
-  inline void clear_has_average_loss();
-  inline void set_has_max_iter();
-  inline void clear_has_max_iter();
-  inline void set_has_iter_size();
-  inline void clear_has_iter_size();
-  inline void set_has_lr_policy();
-  inline void clear_has_lr_policy();
-  inline void set_has_gamma();
-  inline void clear_has_gamma();
-  inline void set_has_power();
-  inline void clear_has_power();
-  inline void set_has_momentum();
-  inline void clear_has_momentum();
-  inline void set_has_weight_decay();
-  inline void clear_has_weight_decay();
-  inline void set_has_regularization_type();
-  inline void clear_has_regularization_type();
-  inline void set_has_stepsize();
-  inline void clear_has_stepsize();
-  inline void set_has_clip_gradients();
-  inline void clear_has_clip_gradients();
-  inline void set_has_snapshot();
-  inline void clear_has_snapshot();
-  inline void set_has_snapshot_prefix();
-  inline void clear_has_snapshot_prefix();
-  inline void set_has_snapshot_diff();
-  inline void clear_has_snapshot_diff();
-  inline void set_has_snapshot_format();
-  inline void clear_has_snapshot_format();
-  inline void set_has_solver_mode();
-  inline void clear_has_solver_mode();
-  inline void set_has_device_id();
-  inline void clear_has_device_id();
-  inline void set_has_random_seed();
-  inline void clear_has_random_seed();
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_delta();
-  inline void clear_has_delta();
-  inline void set_has_momentum2();
-  inline void clear_has_momentum2();
-  inline void set_has_rms_decay();
-  inline void clear_has_rms_decay();
-  inline void set_has_debug_info();
-  inline void clear_has_debug_info();
-  inline void set_has_snapshot_after_train();
-  inline void clear_has_snapshot_after_train();
-  inline void set_has_solver_type();
-  inline void clear_has_solver_type();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[2];
-  ::std::string* net_;
-  ::caffe::NetParameter* net_param_;
-  ::std::string* train_net_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> test_net_;
-  ::caffe::NetParameter* train_net_param_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter > test_net_param_;
-  ::caffe::NetState* train_state_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::NetState > test_state_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > test_iter_;
-  ::google::protobuf::int32 test_interval_;
-  float base_lr_;
-  ::google::protobuf::int32 display_;
-  ::google::protobuf::int32 average_loss_;
-  ::google::protobuf::int32 max_iter_;
-  ::google::protobuf::int32 iter_size_;
-  ::std::string* lr_policy_;
-  float gamma_;
-  float power_;
-  float momentum_;
-  float weight_decay_;
-  bool test_compute_loss_;
-  bool test_initialization_;
-  bool snapshot_diff_;
-  bool debug_info_;
-  ::google::protobuf::int32 stepsize_;
-  static ::std::string* _default_regularization_type_;
-  ::std::string* regularization_type_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > stepvalue_;
-  float clip_gradients_;
-  ::google::protobuf::int32 snapshot_;
-  ::std::string* snapshot_prefix_;
-  int snapshot_format_;
-  int solver_mode_;
-  ::google::protobuf::int64 random_seed_;
-  ::google::protobuf::int32 device_id_;
-  float delta_;
-  static ::std::string* _default_type_;
-  ::std::string* type_;
-  float momentum2_;
-  float rms_decay_;
-  bool snapshot_after_train_;
-  int solver_type_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static SolverParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class SolverState : public ::google::protobuf::Message {
- public:
-  SolverState();
-  virtual ~SolverState();
-
-  SolverState(const SolverState& from);
-
-  inline SolverState& operator=(const SolverState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SolverState& default_instance();
-
-  void Swap(SolverState* other);
-
-  // implements Message ----------------------------------------------
-
-  SolverState* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SolverState& from);
-  void MergeFrom(const SolverState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 iter = 1;
-  inline bool has_iter() const;
-  inline void clear_iter();
-  static const int kIterFieldNumber = 1;
-  inline ::google::protobuf::int32 iter() const;
-  inline void set_iter(::google::protobuf::int32 value);
-
-  // optional string learned_net = 2;
-  inline bool has_learned_net() const;
-  inline void clear_learned_net();
-  static const int kLearnedNetFieldNumber = 2;
-  inline const ::std::string& learned_net() const;
-  inline void set_learned_net(const ::std::string& value);
-  inline void set_learned_net(const char* value);
-  inline void set_learned_net(const char* value, size_t size);
-  inline ::std::string* mutable_learned_net();
-  inline ::std::string* release_learned_net();
-  inline void set_allocated_learned_net(::std::string* learned_net);
-
-  // repeated .caffe.BlobProto history = 3;
-  inline int history_size() const;
-  inline void clear_history();
-  static const int kHistoryFieldNumber = 3;
-  inline const ::caffe::BlobProto& history(int index) const;
-  inline ::caffe::BlobProto* mutable_history(int index);
-  inline ::caffe::BlobProto* add_history();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      history() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-      mutable_history();
-
-  // optional int32 current_step = 4 [default = 0];
-  inline bool has_current_step() const;
-  inline void clear_current_step();
-  static const int kCurrentStepFieldNumber = 4;
-  inline ::google::protobuf::int32 current_step() const;
-  inline void set_current_step(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.SolverState)
- private:
-  inline void set_has_iter();
-  inline void clear_has_iter();
-  inline void set_has_learned_net();
-  inline void clear_has_learned_net();
-  inline void set_has_current_step();
-  inline void clear_has_current_step();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* learned_net_;
-  ::google::protobuf::int32 iter_;
-  ::google::protobuf::int32 current_step_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto > history_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static SolverState* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class NetState : public ::google::protobuf::Message {
- public:
-  NetState();
-  virtual ~NetState();
-
-  NetState(const NetState& from);
-
-  inline NetState& operator=(const NetState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NetState& default_instance();
-
-  void Swap(NetState* other);
-
-  // implements Message ----------------------------------------------
-
-  NetState* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const NetState& from);
-  void MergeFrom(const NetState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.Phase phase = 1 [default = TEST];
-  inline bool has_phase() const;
-  inline void clear_phase();
-  static const int kPhaseFieldNumber = 1;
-  inline ::caffe::Phase phase() const;
-  inline void set_phase(::caffe::Phase value);
-
-  // optional int32 level = 2 [default = 0];
-  inline bool has_level() const;
-  inline void clear_level();
-  static const int kLevelFieldNumber = 2;
-  inline ::google::protobuf::int32 level() const;
-  inline void set_level(::google::protobuf::int32 value);
-
-  // repeated string stage = 3;
-  inline int stage_size() const;
-  inline void clear_stage();
-  static const int kStageFieldNumber = 3;
-  inline const ::std::string& stage(int index) const;
-  inline ::std::string* mutable_stage(int index);
-  inline void set_stage(int index, const ::std::string& value);
-  inline void set_stage(int index, const char* value);
-  inline void set_stage(int index, const char* value, size_t size);
-  inline ::std::string* add_stage();
-  inline void add_stage(const ::std::string& value);
-  inline void add_stage(const char* value);
-  inline void add_stage(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& stage() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_stage();
-
-  // @@protoc_insertion_point(class_scope:caffe.NetState)
- private:
-  inline void set_has_phase();
-  inline void clear_has_phase();
-  inline void set_has_level();
-  inline void clear_has_level();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int phase_;
-  ::google::protobuf::int32 level_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> stage_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static NetState* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class NetStateRule : public ::google::protobuf::Message {
- public:
-  NetStateRule();
-  virtual ~NetStateRule();
-
-  NetStateRule(const NetStateRule& from);
-
-  inline NetStateRule& operator=(const NetStateRule& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NetStateRule& default_instance();
-
-  void Swap(NetStateRule* other);
-
-  // implements Message ----------------------------------------------
-
-  NetStateRule* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const NetStateRule& from);
-  void MergeFrom(const NetStateRule& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.Phase phase = 1;
-  inline bool has_phase() const;
-  inline void clear_phase();
-  static const int kPhaseFieldNumber = 1;
-  inline ::caffe::Phase phase() const;
-  inline void set_phase(::caffe::Phase value);
-
-  // optional int32 min_level = 2;
-  inline bool has_min_level() const;
-  inline void clear_min_level();
-  static const int kMinLevelFieldNumber = 2;
-  inline ::google::protobuf::int32 min_level() const;
-  inline void set_min_level(::google::protobuf::int32 value);
-
-  // optional int32 max_level = 3;
-  inline bool has_max_level() const;
-  inline void clear_max_level();
-  static const int kMaxLevelFieldNumber = 3;
-  inline ::google::protobuf::int32 max_level() const;
-  inline void set_max_level(::google::protobuf::int32 value);
-
-  // repeated string stage = 4;
-  inline int stage_size() const;
-  inline void clear_stage();
-  static const int kStageFieldNumber = 4;
-  inline const ::std::string& stage(int index) const;
-  inline ::std::string* mutable_stage(int index);
-  inline void set_stage(int index, const ::std::string& value);
-  inline void set_stage(int index, const char* value);
-  inline void set_stage(int index, const char* value, size_t size);
-  inline ::std::string* add_stage();
-  inline void add_stage(const ::std::string& value);
-  inline void add_stage(const char* value);
-  inline void add_stage(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& stage() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_stage();
-
-  // repeated string not_stage = 5;
-  inline int not_stage_size() const;
-  inline void clear_not_stage();
-  static const int kNotStageFieldNumber = 5;
-  inline const ::std::string& not_stage(int index) const;
-  inline ::std::string* mutable_not_stage(int index);
-  inline void set_not_stage(int index, const ::std::string& value);
-  inline void set_not_stage(int index, const char* value);
-  inline void set_not_stage(int index, const char* value, size_t size);
-  inline ::std::string* add_not_stage();
-  inline void add_not_stage(const ::std::string& value);
-  inline void add_not_stage(const char* value);
-  inline void add_not_stage(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& not_stage() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_not_stage();
-
-  // @@protoc_insertion_point(class_scope:caffe.NetStateRule)
- private:
-  inline void set_has_phase();
-  inline void clear_has_phase();
-  inline void set_has_min_level();
-  inline void clear_has_min_level();
-  inline void set_has_max_level();
-  inline void clear_has_max_level();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int phase_;
-  ::google::protobuf::int32 min_level_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> stage_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> not_stage_;
-  ::google::protobuf::int32 max_level_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static NetStateRule* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ParamSpec : public ::google::protobuf::Message {
- public:
-  ParamSpec();
-  virtual ~ParamSpec();
-
-  ParamSpec(const ParamSpec& from);
-
-  inline ParamSpec& operator=(const ParamSpec& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ParamSpec& default_instance();
-
-  void Swap(ParamSpec* other);
-
-  // implements Message ----------------------------------------------
-
-  ParamSpec* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ParamSpec& from);
-  void MergeFrom(const ParamSpec& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef ParamSpec_DimCheckMode DimCheckMode;
-  static const DimCheckMode STRICT = ParamSpec_DimCheckMode_STRICT;
-  static const DimCheckMode PERMISSIVE = ParamSpec_DimCheckMode_PERMISSIVE;
-  static inline bool DimCheckMode_IsValid(int value) {
-    return ParamSpec_DimCheckMode_IsValid(value);
-  }
-  static const DimCheckMode DimCheckMode_MIN =
-    ParamSpec_DimCheckMode_DimCheckMode_MIN;
-  static const DimCheckMode DimCheckMode_MAX =
-    ParamSpec_DimCheckMode_DimCheckMode_MAX;
-  static const int DimCheckMode_ARRAYSIZE =
-    ParamSpec_DimCheckMode_DimCheckMode_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  DimCheckMode_descriptor() {
-    return ParamSpec_DimCheckMode_descriptor();
-  }
-  static inline const ::std::string& DimCheckMode_Name(DimCheckMode value) {
-    return ParamSpec_DimCheckMode_Name(value);
-  }
-  static inline bool DimCheckMode_Parse(const ::std::string& name,
-      DimCheckMode* value) {
-    return ParamSpec_DimCheckMode_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
-  // optional .caffe.ParamSpec.DimCheckMode share_mode = 2;
-  inline bool has_share_mode() const;
-  inline void clear_share_mode();
-  static const int kShareModeFieldNumber = 2;
-  inline ::caffe::ParamSpec_DimCheckMode share_mode() const;
-  inline void set_share_mode(::caffe::ParamSpec_DimCheckMode value);
-
-  // optional float lr_mult = 3 [default = 1];
-  inline bool has_lr_mult() const;
-  inline void clear_lr_mult();
-  static const int kLrMultFieldNumber = 3;
-  inline float lr_mult() const;
-  inline void set_lr_mult(float value);
-
-  // optional float decay_mult = 4 [default = 1];
-  inline bool has_decay_mult() const;
-  inline void clear_decay_mult();
-  static const int kDecayMultFieldNumber = 4;
-  inline float decay_mult() const;
-  inline void set_decay_mult(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ParamSpec)
- private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_share_mode();
-  inline void clear_has_share_mode();
-  inline void set_has_lr_mult();
-  inline void clear_has_lr_mult();
-  inline void set_has_decay_mult();
-  inline void clear_has_decay_mult();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* name_;
-  int share_mode_;
-  float lr_mult_;
-  float decay_mult_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ParamSpec* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class LayerParameter : public ::google::protobuf::Message {
- public:
-  LayerParameter();
-  virtual ~LayerParameter();
-
-  LayerParameter(const LayerParameter& from);
-
-  inline LayerParameter& operator=(const LayerParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LayerParameter& default_instance();
-
-  void Swap(LayerParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  LayerParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LayerParameter& from);
-  void MergeFrom(const LayerParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
-  // optional string type = 2;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 2;
-  inline const ::std::string& type() const;
-  inline void set_type(const ::std::string& value);
-  inline void set_type(const char* value);
-  inline void set_type(const char* value, size_t size);
-  inline ::std::string* mutable_type();
-  inline ::std::string* release_type();
-  inline void set_allocated_type(::std::string* type);
-
-  // repeated string bottom = 3;
-  inline int bottom_size() const;
-  inline void clear_bottom();
-  static const int kBottomFieldNumber = 3;
-  inline const ::std::string& bottom(int index) const;
-  inline ::std::string* mutable_bottom(int index);
-  inline void set_bottom(int index, const ::std::string& value);
-  inline void set_bottom(int index, const char* value);
-  inline void set_bottom(int index, const char* value, size_t size);
-  inline ::std::string* add_bottom();
-  inline void add_bottom(const ::std::string& value);
-  inline void add_bottom(const char* value);
-  inline void add_bottom(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& bottom() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_bottom();
-
-  // repeated string top = 4;
-  inline int top_size() const;
-  inline void clear_top();
-  static const int kTopFieldNumber = 4;
-  inline const ::std::string& top(int index) const;
-  inline ::std::string* mutable_top(int index);
-  inline void set_top(int index, const ::std::string& value);
-  inline void set_top(int index, const char* value);
-  inline void set_top(int index, const char* value, size_t size);
-  inline ::std::string* add_top();
-  inline void add_top(const ::std::string& value);
-  inline void add_top(const char* value);
-  inline void add_top(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& top() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_top();
-
-  // optional .caffe.Phase phase = 10;
-  inline bool has_phase() const;
-  inline void clear_phase();
-  static const int kPhaseFieldNumber = 10;
-  inline ::caffe::Phase phase() const;
-  inline void set_phase(::caffe::Phase value);
-
-  // repeated float loss_weight = 5;
-  inline int loss_weight_size() const;
-  inline void clear_loss_weight();
-  static const int kLossWeightFieldNumber = 5;
-  inline float loss_weight(int index) const;
-  inline void set_loss_weight(int index, float value);
-  inline void add_loss_weight(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      loss_weight() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_loss_weight();
-
-  // repeated .caffe.ParamSpec param = 6;
-  inline int param_size() const;
-  inline void clear_param();
-  static const int kParamFieldNumber = 6;
-  inline const ::caffe::ParamSpec& param(int index) const;
-  inline ::caffe::ParamSpec* mutable_param(int index);
-  inline ::caffe::ParamSpec* add_param();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >&
-      param() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >*
-      mutable_param();
-
-  // repeated .caffe.BlobProto blobs = 7;
-  inline int blobs_size() const;
-  inline void clear_blobs();
-  static const int kBlobsFieldNumber = 7;
-  inline const ::caffe::BlobProto& blobs(int index) const;
-  inline ::caffe::BlobProto* mutable_blobs(int index);
-  inline ::caffe::BlobProto* add_blobs();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-      mutable_blobs();
-
-  // repeated bool propagate_down = 11;
-  inline int propagate_down_size() const;
-  inline void clear_propagate_down();
-  static const int kPropagateDownFieldNumber = 11;
-  inline bool propagate_down(int index) const;
-  inline void set_propagate_down(int index, bool value);
-  inline void add_propagate_down(bool value);
-  inline const ::google::protobuf::RepeatedField< bool >&
-      propagate_down() const;
-  inline ::google::protobuf::RepeatedField< bool >*
-      mutable_propagate_down();
-
-  // repeated .caffe.NetStateRule include = 8;
-  inline int include_size() const;
-  inline void clear_include();
-  static const int kIncludeFieldNumber = 8;
-  inline const ::caffe::NetStateRule& include(int index) const;
-  inline ::caffe::NetStateRule* mutable_include(int index);
-  inline ::caffe::NetStateRule* add_include();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      include() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-      mutable_include();
-
-  // repeated .caffe.NetStateRule exclude = 9;
-  inline int exclude_size() const;
-  inline void clear_exclude();
-  static const int kExcludeFieldNumber = 9;
-  inline const ::caffe::NetStateRule& exclude(int index) const;
-  inline ::caffe::NetStateRule* mutable_exclude(int index);
-  inline ::caffe::NetStateRule* add_exclude();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      exclude() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-      mutable_exclude();
-
-  // optional .caffe.TransformationParameter transform_param = 100;
-  inline bool has_transform_param() const;
-  inline void clear_transform_param();
-  static const int kTransformParamFieldNumber = 100;
-  inline const ::caffe::TransformationParameter& transform_param() const;
-  inline ::caffe::TransformationParameter* mutable_transform_param();
-  inline ::caffe::TransformationParameter* release_transform_param();
-  inline void set_allocated_transform_param(::caffe::TransformationParameter* transform_param);
-
-  // optional .caffe.LossParameter loss_param = 101;
-  inline bool has_loss_param() const;
-  inline void clear_loss_param();
-  static const int kLossParamFieldNumber = 101;
-  inline const ::caffe::LossParameter& loss_param() const;
-  inline ::caffe::LossParameter* mutable_loss_param();
-  inline ::caffe::LossParameter* release_loss_param();
-  inline void set_allocated_loss_param(::caffe::LossParameter* loss_param);
-
-  // optional .caffe.AccuracyParameter accuracy_param = 102;
-  inline bool has_accuracy_param() const;
-  inline void clear_accuracy_param();
-  static const int kAccuracyParamFieldNumber = 102;
-  inline const ::caffe::AccuracyParameter& accuracy_param() const;
-  inline ::caffe::AccuracyParameter* mutable_accuracy_param();
-  inline ::caffe::AccuracyParameter* release_accuracy_param();
-  inline void set_allocated_accuracy_param(::caffe::AccuracyParameter* accuracy_param);
-
-  // optional .caffe.ArgMaxParameter argmax_param = 103;
-  inline bool has_argmax_param() const;
-  inline void clear_argmax_param();
-  static const int kArgmaxParamFieldNumber = 103;
-  inline const ::caffe::ArgMaxParameter& argmax_param() const;
-  inline ::caffe::ArgMaxParameter* mutable_argmax_param();
-  inline ::caffe::ArgMaxParameter* release_argmax_param();
-  inline void set_allocated_argmax_param(::caffe::ArgMaxParameter* argmax_param);
-
-  // optional .caffe.BatchNormParameter batch_norm_param = 139;
-  inline bool has_batch_norm_param() const;
-  inline void clear_batch_norm_param();
-  static const int kBatchNormParamFieldNumber = 139;
-  inline const ::caffe::BatchNormParameter& batch_norm_param() const;
-  inline ::caffe::BatchNormParameter* mutable_batch_norm_param();
-  inline ::caffe::BatchNormParameter* release_batch_norm_param();
-  inline void set_allocated_batch_norm_param(::caffe::BatchNormParameter* batch_norm_param);
-
-  // optional .caffe.BiasParameter bias_param = 141;
-  inline bool has_bias_param() const;
-  inline void clear_bias_param();
-  static const int kBiasParamFieldNumber = 141;
-  inline const ::caffe::BiasParameter& bias_param() const;
-  inline ::caffe::BiasParameter* mutable_bias_param();
-  inline ::caffe::BiasParameter* release_bias_param();
-  inline void set_allocated_bias_param(::caffe::BiasParameter* bias_param);
-
-  // optional .caffe.ConcatParameter concat_param = 104;
-  inline bool has_concat_param() const;
-  inline void clear_concat_param();
-  static const int kConcatParamFieldNumber = 104;
-  inline const ::caffe::ConcatParameter& concat_param() const;
-  inline ::caffe::ConcatParameter* mutable_concat_param();
-  inline ::caffe::ConcatParameter* release_concat_param();
-  inline void set_allocated_concat_param(::caffe::ConcatParameter* concat_param);
-
-  // optional .caffe.ContrastiveLossParameter contrastive_loss_param = 105;
-  inline bool has_contrastive_loss_param() const;
-  inline void clear_contrastive_loss_param();
-  static const int kContrastiveLossParamFieldNumber = 105;
-  inline const ::caffe::ContrastiveLossParameter& contrastive_loss_param() const;
-  inline ::caffe::ContrastiveLossParameter* mutable_contrastive_loss_param();
-  inline ::caffe::ContrastiveLossParameter* release_contrastive_loss_param();
-  inline void set_allocated_contrastive_loss_param(::caffe::ContrastiveLossParameter* contrastive_loss_param);
-
-  // optional .caffe.ConvolutionParameter convolution_param = 106;
-  inline bool has_convolution_param() const;
-  inline void clear_convolution_param();
-  static const int kConvolutionParamFieldNumber = 106;
-  inline const ::caffe::ConvolutionParameter& convolution_param() const;
-  inline ::caffe::ConvolutionParameter* mutable_convolution_param();
-  inline ::caffe::ConvolutionParameter* release_convolution_param();
-  inline void set_allocated_convolution_param(::caffe::ConvolutionParameter* convolution_param);
-
-  // optional .caffe.CropParameter crop_param = 144;
-  inline bool has_crop_param() const;
-  inline void clear_crop_param();
-  static const int kCropParamFieldNumber = 144;
-  inline const ::caffe::CropParameter& crop_param() const;
-  inline ::caffe::CropParameter* mutable_crop_param();
-  inline ::caffe::CropParameter* release_crop_param();
-  inline void set_allocated_crop_param(::caffe::CropParameter* crop_param);
-
-  // optional .caffe.DataParameter data_param = 107;
-  inline bool has_data_param() const;
-  inline void clear_data_param();
-  static const int kDataParamFieldNumber = 107;
-  inline const ::caffe::DataParameter& data_param() const;
-  inline ::caffe::DataParameter* mutable_data_param();
-  inline ::caffe::DataParameter* release_data_param();
-  inline void set_allocated_data_param(::caffe::DataParameter* data_param);
-
-  // optional .caffe.DropoutParameter dropout_param = 108;
-  inline bool has_dropout_param() const;
-  inline void clear_dropout_param();
-  static const int kDropoutParamFieldNumber = 108;
-  inline const ::caffe::DropoutParameter& dropout_param() const;
-  inline ::caffe::DropoutParameter* mutable_dropout_param();
-  inline ::caffe::DropoutParameter* release_dropout_param();
-  inline void set_allocated_dropout_param(::caffe::DropoutParameter* dropout_param);
-
-  // optional .caffe.DummyDataParameter dummy_data_param = 109;
-  inline bool has_dummy_data_param() const;
-  inline void clear_dummy_data_param();
-  static const int kDummyDataParamFieldNumber = 109;
-  inline const ::caffe::DummyDataParameter& dummy_data_param() const;
-  inline ::caffe::DummyDataParameter* mutable_dummy_data_param();
-  inline ::caffe::DummyDataParameter* release_dummy_data_param();
-  inline void set_allocated_dummy_data_param(::caffe::DummyDataParameter* dummy_data_param);
-
-  // optional .caffe.EltwiseParameter eltwise_param = 110;
-  inline bool has_eltwise_param() const;
-  inline void clear_eltwise_param();
-  static const int kEltwiseParamFieldNumber = 110;
-  inline const ::caffe::EltwiseParameter& eltwise_param() const;
-  inline ::caffe::EltwiseParameter* mutable_eltwise_param();
-  inline ::caffe::EltwiseParameter* release_eltwise_param();
-  inline void set_allocated_eltwise_param(::caffe::EltwiseParameter* eltwise_param);
-
-  // optional .caffe.ELUParameter elu_param = 140;
-  inline bool has_elu_param() const;
-  inline void clear_elu_param();
-  static const int kEluParamFieldNumber = 140;
-  inline const ::caffe::ELUParameter& elu_param() const;
-  inline ::caffe::ELUParameter* mutable_elu_param();
-  inline ::caffe::ELUParameter* release_elu_param();
-  inline void set_allocated_elu_param(::caffe::ELUParameter* elu_param);
-
-  // optional .caffe.EmbedParameter embed_param = 137;
-  inline bool has_embed_param() const;
-  inline void clear_embed_param();
-  static const int kEmbedParamFieldNumber = 137;
-  inline const ::caffe::EmbedParameter& embed_param() const;
-  inline ::caffe::EmbedParameter* mutable_embed_param();
-  inline ::caffe::EmbedParameter* release_embed_param();
-  inline void set_allocated_embed_param(::caffe::EmbedParameter* embed_param);
-
-  // optional .caffe.ExpParameter exp_param = 111;
-  inline bool has_exp_param() const;
-  inline void clear_exp_param();
-  static const int kExpParamFieldNumber = 111;
-  inline const ::caffe::ExpParameter& exp_param() const;
-  inline ::caffe::ExpParameter* mutable_exp_param();
-  inline ::caffe::ExpParameter* release_exp_param();
-  inline void set_allocated_exp_param(::caffe::ExpParameter* exp_param);
-
-  // optional .caffe.FlattenParameter flatten_param = 135;
-  inline bool has_flatten_param() const;
-  inline void clear_flatten_param();
-  static const int kFlattenParamFieldNumber = 135;
-  inline const ::caffe::FlattenParameter& flatten_param() const;
-  inline ::caffe::FlattenParameter* mutable_flatten_param();
-  inline ::caffe::FlattenParameter* release_flatten_param();
-  inline void set_allocated_flatten_param(::caffe::FlattenParameter* flatten_param);
-
-  // optional .caffe.HDF5DataParameter hdf5_data_param = 112;
-  inline bool has_hdf5_data_param() const;
-  inline void clear_hdf5_data_param();
-  static const int kHdf5DataParamFieldNumber = 112;
-  inline const ::caffe::HDF5DataParameter& hdf5_data_param() const;
-  inline ::caffe::HDF5DataParameter* mutable_hdf5_data_param();
-  inline ::caffe::HDF5DataParameter* release_hdf5_data_param();
-  inline void set_allocated_hdf5_data_param(::caffe::HDF5DataParameter* hdf5_data_param);
-
-  // optional .caffe.HDF5OutputParameter hdf5_output_param = 113;
-  inline bool has_hdf5_output_param() const;
-  inline void clear_hdf5_output_param();
-  static const int kHdf5OutputParamFieldNumber = 113;
-  inline const ::caffe::HDF5OutputParameter& hdf5_output_param() const;
-  inline ::caffe::HDF5OutputParameter* mutable_hdf5_output_param();
-  inline ::caffe::HDF5OutputParameter* release_hdf5_output_param();
-  inline void set_allocated_hdf5_output_param(::caffe::HDF5OutputParameter* hdf5_output_param);
-
-  // optional .caffe.HingeLossParameter hinge_loss_param = 114;
-  inline bool has_hinge_loss_param() const;
-  inline void clear_hinge_loss_param();
-  static const int kHingeLossParamFieldNumber = 114;
-  inline const ::caffe::HingeLossParameter& hinge_loss_param() const;
-  inline ::caffe::HingeLossParameter* mutable_hinge_loss_param();
-  inline ::caffe::HingeLossParameter* release_hinge_loss_param();
-  inline void set_allocated_hinge_loss_param(::caffe::HingeLossParameter* hinge_loss_param);
-
-  // optional .caffe.ImageDataParameter image_data_param = 115;
-  inline bool has_image_data_param() const;
-  inline void clear_image_data_param();
-  static const int kImageDataParamFieldNumber = 115;
-  inline const ::caffe::ImageDataParameter& image_data_param() const;
-  inline ::caffe::ImageDataParameter* mutable_image_data_param();
-  inline ::caffe::ImageDataParameter* release_image_data_param();
-  inline void set_allocated_image_data_param(::caffe::ImageDataParameter* image_data_param);
-
-  // optional .caffe.InfogainLossParameter infogain_loss_param = 116;
-  inline bool has_infogain_loss_param() const;
-  inline void clear_infogain_loss_param();
-  static const int kInfogainLossParamFieldNumber = 116;
-  inline const ::caffe::InfogainLossParameter& infogain_loss_param() const;
-  inline ::caffe::InfogainLossParameter* mutable_infogain_loss_param();
-  inline ::caffe::InfogainLossParameter* release_infogain_loss_param();
-  inline void set_allocated_infogain_loss_param(::caffe::InfogainLossParameter* infogain_loss_param);
-
-  // optional .caffe.InnerProductParameter inner_product_param = 117;
-  inline bool has_inner_product_param() const;
-  inline void clear_inner_product_param();
-  static const int kInnerProductParamFieldNumber = 117;
-  inline const ::caffe::InnerProductParameter& inner_product_param() const;
-  inline ::caffe::InnerProductParameter* mutable_inner_product_param();
-  inline ::caffe::InnerProductParameter* release_inner_product_param();
-  inline void set_allocated_inner_product_param(::caffe::InnerProductParameter* inner_product_param);
-
-  // optional .caffe.InputParameter input_param = 143;
-  inline bool has_input_param() const;
-  inline void clear_input_param();
-  static const int kInputParamFieldNumber = 143;
-  inline const ::caffe::InputParameter& input_param() const;
-  inline ::caffe::InputParameter* mutable_input_param();
-  inline ::caffe::InputParameter* release_input_param();
-  inline void set_allocated_input_param(::caffe::InputParameter* input_param);
-
-  // optional .caffe.LogParameter log_param = 134;
-  inline bool has_log_param() const;
-  inline void clear_log_param();
-  static const int kLogParamFieldNumber = 134;
-  inline const ::caffe::LogParameter& log_param() const;
-  inline ::caffe::LogParameter* mutable_log_param();
-  inline ::caffe::LogParameter* release_log_param();
-  inline void set_allocated_log_param(::caffe::LogParameter* log_param);
-
-  // optional .caffe.LRNParameter lrn_param = 118;
-  inline bool has_lrn_param() const;
-  inline void clear_lrn_param();
-  static const int kLrnParamFieldNumber = 118;
-  inline const ::caffe::LRNParameter& lrn_param() const;
-  inline ::caffe::LRNParameter* mutable_lrn_param();
-  inline ::caffe::LRNParameter* release_lrn_param();
-  inline void set_allocated_lrn_param(::caffe::LRNParameter* lrn_param);
-
-  // optional .caffe.MemoryDataParameter memory_data_param = 119;
-  inline bool has_memory_data_param() const;
-  inline void clear_memory_data_param();
-  static const int kMemoryDataParamFieldNumber = 119;
-  inline const ::caffe::MemoryDataParameter& memory_data_param() const;
-  inline ::caffe::MemoryDataParameter* mutable_memory_data_param();
-  inline ::caffe::MemoryDataParameter* release_memory_data_param();
-  inline void set_allocated_memory_data_param(::caffe::MemoryDataParameter* memory_data_param);
-
-  // optional .caffe.MVNParameter mvn_param = 120;
-  inline bool has_mvn_param() const;
-  inline void clear_mvn_param();
-  static const int kMvnParamFieldNumber = 120;
-  inline const ::caffe::MVNParameter& mvn_param() const;
-  inline ::caffe::MVNParameter* mutable_mvn_param();
-  inline ::caffe::MVNParameter* release_mvn_param();
-  inline void set_allocated_mvn_param(::caffe::MVNParameter* mvn_param);
-
-  // optional .caffe.ParameterParameter parameter_param = 145;
-  inline bool has_parameter_param() const;
-  inline void clear_parameter_param();
-  static const int kParameterParamFieldNumber = 145;
-  inline const ::caffe::ParameterParameter& parameter_param() const;
-  inline ::caffe::ParameterParameter* mutable_parameter_param();
-  inline ::caffe::ParameterParameter* release_parameter_param();
-  inline void set_allocated_parameter_param(::caffe::ParameterParameter* parameter_param);
-
-  // optional .caffe.PoolingParameter pooling_param = 121;
-  inline bool has_pooling_param() const;
-  inline void clear_pooling_param();
-  static const int kPoolingParamFieldNumber = 121;
-  inline const ::caffe::PoolingParameter& pooling_param() const;
-  inline ::caffe::PoolingParameter* mutable_pooling_param();
-  inline ::caffe::PoolingParameter* release_pooling_param();
-  inline void set_allocated_pooling_param(::caffe::PoolingParameter* pooling_param);
-
-  // optional .caffe.PowerParameter power_param = 122;
-  inline bool has_power_param() const;
-  inline void clear_power_param();
-  static const int kPowerParamFieldNumber = 122;
-  inline const ::caffe::PowerParameter& power_param() const;
-  inline ::caffe::PowerParameter* mutable_power_param();
-  inline ::caffe::PowerParameter* release_power_param();
-  inline void set_allocated_power_param(::caffe::PowerParameter* power_param);
-
-  // optional .caffe.PReLUParameter prelu_param = 131;
-  inline bool has_prelu_param() const;
-  inline void clear_prelu_param();
-  static const int kPreluParamFieldNumber = 131;
-  inline const ::caffe::PReLUParameter& prelu_param() const;
-  inline ::caffe::PReLUParameter* mutable_prelu_param();
-  inline ::caffe::PReLUParameter* release_prelu_param();
-  inline void set_allocated_prelu_param(::caffe::PReLUParameter* prelu_param);
-
-  // optional .caffe.PythonParameter python_param = 130;
-  inline bool has_python_param() const;
-  inline void clear_python_param();
-  static const int kPythonParamFieldNumber = 130;
-  inline const ::caffe::PythonParameter& python_param() const;
-  inline ::caffe::PythonParameter* mutable_python_param();
-  inline ::caffe::PythonParameter* release_python_param();
-  inline void set_allocated_python_param(::caffe::PythonParameter* python_param);
-
-  // optional .caffe.RecurrentParameter recurrent_param = 146;
-  inline bool has_recurrent_param() const;
-  inline void clear_recurrent_param();
-  static const int kRecurrentParamFieldNumber = 146;
-  inline const ::caffe::RecurrentParameter& recurrent_param() const;
-  inline ::caffe::RecurrentParameter* mutable_recurrent_param();
-  inline ::caffe::RecurrentParameter* release_recurrent_param();
-  inline void set_allocated_recurrent_param(::caffe::RecurrentParameter* recurrent_param);
-
-  // optional .caffe.ReductionParameter reduction_param = 136;
-  inline bool has_reduction_param() const;
-  inline void clear_reduction_param();
-  static const int kReductionParamFieldNumber = 136;
-  inline const ::caffe::ReductionParameter& reduction_param() const;
-  inline ::caffe::ReductionParameter* mutable_reduction_param();
-  inline ::caffe::ReductionParameter* release_reduction_param();
-  inline void set_allocated_reduction_param(::caffe::ReductionParameter* reduction_param);
-
-  // optional .caffe.ReLUParameter relu_param = 123;
-  inline bool has_relu_param() const;
-  inline void clear_relu_param();
-  static const int kReluParamFieldNumber = 123;
-  inline const ::caffe::ReLUParameter& relu_param() const;
-  inline ::caffe::ReLUParameter* mutable_relu_param();
-  inline ::caffe::ReLUParameter* release_relu_param();
-  inline void set_allocated_relu_param(::caffe::ReLUParameter* relu_param);
-
-  // optional .caffe.ReshapeParameter reshape_param = 133;
-  inline bool has_reshape_param() const;
-  inline void clear_reshape_param();
-  static const int kReshapeParamFieldNumber = 133;
-  inline const ::caffe::ReshapeParameter& reshape_param() const;
-  inline ::caffe::ReshapeParameter* mutable_reshape_param();
-  inline ::caffe::ReshapeParameter* release_reshape_param();
-  inline void set_allocated_reshape_param(::caffe::ReshapeParameter* reshape_param);
-
-  // optional .caffe.ScaleParameter scale_param = 142;
-  inline bool has_scale_param() const;
-  inline void clear_scale_param();
-  static const int kScaleParamFieldNumber = 142;
-  inline const ::caffe::ScaleParameter& scale_param() const;
-  inline ::caffe::ScaleParameter* mutable_scale_param();
-  inline ::caffe::ScaleParameter* release_scale_param();
-  inline void set_allocated_scale_param(::caffe::ScaleParameter* scale_param);
-
-  // optional .caffe.SigmoidParameter sigmoid_param = 124;
-  inline bool has_sigmoid_param() const;
-  inline void clear_sigmoid_param();
-  static const int kSigmoidParamFieldNumber = 124;
-  inline const ::caffe::SigmoidParameter& sigmoid_param() const;
-  inline ::caffe::SigmoidParameter* mutable_sigmoid_param();
-  inline ::caffe::SigmoidParameter* release_sigmoid_param();
-  inline void set_allocated_sigmoid_param(::caffe::SigmoidParameter* sigmoid_param);
-
-  // optional .caffe.SoftmaxParameter softmax_param = 125;
-  inline bool has_softmax_param() const;
-  inline void clear_softmax_param();
-  static const int kSoftmaxParamFieldNumber = 125;
-  inline const ::caffe::SoftmaxParameter& softmax_param() const;
-  inline ::caffe::SoftmaxParameter* mutable_softmax_param();
-  inline ::caffe::SoftmaxParameter* release_softmax_param();
-  inline void set_allocated_softmax_param(::caffe::SoftmaxParameter* softmax_param);
-
-  // optional .caffe.SPPParameter spp_param = 132;
-  inline bool has_spp_param() const;
-  inline void clear_spp_param();
-  static const int kSppParamFieldNumber = 132;
-  inline const ::caffe::SPPParameter& spp_param() const;
-  inline ::caffe::SPPParameter* mutable_spp_param();
-  inline ::caffe::SPPParameter* release_spp_param();
-  inline void set_allocated_spp_param(::caffe::SPPParameter* spp_param);
-
-  // optional .caffe.SliceParameter slice_param = 126;
-  inline bool has_slice_param() const;
-  inline void clear_slice_param();
-  static const int kSliceParamFieldNumber = 126;
-  inline const ::caffe::SliceParameter& slice_param() const;
-  inline ::caffe::SliceParameter* mutable_slice_param();
-  inline ::caffe::SliceParameter* release_slice_param();
-  inline void set_allocated_slice_param(::caffe::SliceParameter* slice_param);
-
-  // optional .caffe.TanHParameter tanh_param = 127;
-  inline bool has_tanh_param() const;
-  inline void clear_tanh_param();
-  static const int kTanhParamFieldNumber = 127;
-  inline const ::caffe::TanHParameter& tanh_param() const;
-  inline ::caffe::TanHParameter* mutable_tanh_param();
-  inline ::caffe::TanHParameter* release_tanh_param();
-  inline void set_allocated_tanh_param(::caffe::TanHParameter* tanh_param);
-
-  // optional .caffe.ThresholdParameter threshold_param = 128;
-  inline bool has_threshold_param() const;
-  inline void clear_threshold_param();
-  static const int kThresholdParamFieldNumber = 128;
-  inline const ::caffe::ThresholdParameter& threshold_param() const;
-  inline ::caffe::ThresholdParameter* mutable_threshold_param();
-  inline ::caffe::ThresholdParameter* release_threshold_param();
-  inline void set_allocated_threshold_param(::caffe::ThresholdParameter* threshold_param);
-
-  // optional .caffe.TileParameter tile_param = 138;
-  inline bool has_tile_param() const;
-  inline void clear_tile_param();
-  static const int kTileParamFieldNumber = 138;
-  inline const ::caffe::TileParameter& tile_param() const;
-  inline ::caffe::TileParameter* mutable_tile_param();
-  inline ::caffe::TileParameter* release_tile_param();
-  inline void set_allocated_tile_param(::caffe::TileParameter* tile_param);
-
-  // optional .caffe.WindowDataParameter window_data_param = 129;
-  inline bool has_window_data_param() const;
-  inline void clear_window_data_param();
-  static const int kWindowDataParamFieldNumber = 129;
-  inline const ::caffe::WindowDataParameter& window_data_param() const;
-  inline ::caffe::WindowDataParameter* mutable_window_data_param();
-  inline ::caffe::WindowDataParameter* release_window_data_param();
-  inline void set_allocated_window_data_param(::caffe::WindowDataParameter* window_data_param);
-
-  // optional .caffe.QuantizationParameter quantization_param = 147;
-  inline bool has_quantization_param() const;
-  inline void clear_quantization_param();
-  static const int kQuantizationParamFieldNumber = 147;
-  inline const ::caffe::QuantizationParameter& quantization_param() const;
-  inline ::caffe::QuantizationParameter* mutable_quantization_param();
-  inline ::caffe::QuantizationParameter* release_quantization_param();
-  inline void set_allocated_quantization_param(::caffe::QuantizationParameter* quantization_param);
-
-  // @@protoc_insertion_point(class_scope:caffe.LayerParameter)
- private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_phase();
-  inline void clear_has_phase();
-  inline void set_has_transform_param();
-  inline void clear_has_transform_param();
-  inline void set_has_loss_param();
-  inline void clear_has_loss_param();
-  inline void set_has_accuracy_param();
-  inline void clear_has_accuracy_param();
-  inline void set_has_argmax_param();
-  inline void clear_has_argmax_param();
-  inline void set_has_batch_norm_param();
-  inline void clear_has_batch_norm_param();
-  inline void set_has_bias_param();
-  inline void clear_has_bias_param();
-  inline void set_has_concat_param();
-  inline void clear_has_concat_param();
-  inline void set_has_contrastive_loss_param();
-  inline void clear_has_contrastive_loss_param();
-  inline void set_has_convolution_param();
-  inline void clear_has_convolution_param();
-  inline void set_has_crop_param();
-  inline void clear_has_crop_param();
-  inline void set_has_data_param();
-  inline void clear_has_data_param();
-  inline void set_has_dropout_param();
-  inline void clear_has_dropout_param();
-  inline void set_has_dummy_data_param();
-  inline void clear_has_dummy_data_param();
-  inline void set_has_eltwise_param();
-  inline void clear_has_eltwise_param();
-  inline void set_has_elu_param();
-  inline void clear_has_elu_param();
-  inline void set_has_embed_param();
-  inline void clear_has_embed_param();
-  inline void set_has_exp_param();
-  inline void clear_has_exp_param();
-  inline void set_has_flatten_param();
-  inline void clear_has_flatten_param();
-  inline void set_has_hdf5_data_param();
-  inline void clear_has_hdf5_data_param();
-  inline void set_has_hdf5_output_param();
-  inline void clear_has_hdf5_output_param();
-  inline void set_has_hinge_loss_param();
-  inline void clear_has_hinge_loss_param();
-  inline void set_has_image_data_param();
-  inline void clear_has_image_data_param();
-  inline void set_has_infogain_loss_param();
-  inline void clear_has_infogain_loss_param();
-  inline void set_has_inner_product_param();
-  inline void clear_has_inner_product_param();
-  inline void set_has_input_param();
-  inline void clear_has_input_param();
-  inline void set_has_log_param();
-  inline void clear_has_log_param();
-  inline void set_has_lrn_param();
-  inline void clear_has_lrn_param();
-  inline void set_has_memory_data_param();
-  inline void clear_has_memory_data_param();
-  inline void set_has_mvn_param();
-  inline void clear_has_mvn_param();
-  inline void set_has_parameter_param();
-  inline void clear_has_parameter_param();
-  inline void set_has_pooling_param();
-  inline void clear_has_pooling_param();
-  inline void set_has_power_param();
-  inline void clear_has_power_param();
-  inline void set_has_prelu_param();
-  inline void clear_has_prelu_param();
-  inline void set_has_python_param();
-  inline void clear_has_python_param();
-  inline void set_has_recurrent_param();
-  inline void clear_has_recurrent_param();
-  inline void set_has_reduction_param();
-  inline void clear_has_reduction_param();
-  inline void set_has_relu_param();
-  inline void clear_has_relu_param();
-  inline void set_has_reshape_param();
-  inline void clear_has_reshape_param();
-  inline void set_has_scale_param();
-  inline void clear_has_scale_param();
-  inline void set_has_sigmoid_param();
-  inline void clear_has_sigmoid_param();
-  inline void set_has_softmax_param();
-  inline void clear_has_softmax_param();
-  inline void set_has_spp_param();
-  inline void clear_has_spp_param();
-  inline void set_has_slice_param();
-  inline void clear_has_slice_param();
-  inline void set_has_tanh_param();
-  inline void clear_has_tanh_param();
-  inline void set_has_threshold_param();
-  inline void clear_has_threshold_param();
-  inline void set_has_tile_param();
-  inline void clear_has_tile_param();
-  inline void set_has_window_data_param();
-  inline void clear_has_window_data_param();
-  inline void set_has_quantization_param();
-  inline void clear_has_quantization_param();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[2];
-  ::std::string* name_;
-  ::std::string* type_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> bottom_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> top_;
-  ::google::protobuf::RepeatedField< float > loss_weight_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec > param_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto > blobs_;
-  ::google::protobuf::RepeatedField< bool > propagate_down_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule > include_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule > exclude_;
-  ::caffe::TransformationParameter* transform_param_;
-  ::caffe::LossParameter* loss_param_;
-  ::caffe::AccuracyParameter* accuracy_param_;
-  ::caffe::ArgMaxParameter* argmax_param_;
-  ::caffe::BatchNormParameter* batch_norm_param_;
-  ::caffe::BiasParameter* bias_param_;
-  ::caffe::ConcatParameter* concat_param_;
-  ::caffe::ContrastiveLossParameter* contrastive_loss_param_;
-  ::caffe::ConvolutionParameter* convolution_param_;
-  ::caffe::CropParameter* crop_param_;
-  ::caffe::DataParameter* data_param_;
-  ::caffe::DropoutParameter* dropout_param_;
-  ::caffe::DummyDataParameter* dummy_data_param_;
-  ::caffe::EltwiseParameter* eltwise_param_;
-  ::caffe::ELUParameter* elu_param_;
-  ::caffe::EmbedParameter* embed_param_;
-  ::caffe::ExpParameter* exp_param_;
-  ::caffe::FlattenParameter* flatten_param_;
-  ::caffe::HDF5DataParameter* hdf5_data_param_;
-  ::caffe::HDF5OutputParameter* hdf5_output_param_;
-  ::caffe::HingeLossParameter* hinge_loss_param_;
-  ::caffe::ImageDataParameter* image_data_param_;
-  ::caffe::InfogainLossParameter* infogain_loss_param_;
-  ::caffe::InnerProductParameter* inner_product_param_;
-  ::caffe::InputParameter* input_param_;
-  ::caffe::LogParameter* log_param_;
-  ::caffe::LRNParameter* lrn_param_;
-  ::caffe::MemoryDataParameter* memory_data_param_;
-  ::caffe::MVNParameter* mvn_param_;
-  ::caffe::ParameterParameter* parameter_param_;
-  ::caffe::PoolingParameter* pooling_param_;
-  ::caffe::PowerParameter* power_param_;
-  ::caffe::PReLUParameter* prelu_param_;
-  ::caffe::PythonParameter* python_param_;
-  ::caffe::RecurrentParameter* recurrent_param_;
-  ::caffe::ReductionParameter* reduction_param_;
-  ::caffe::ReLUParameter* relu_param_;
-  ::caffe::ReshapeParameter* reshape_param_;
-  ::caffe::ScaleParameter* scale_param_;
-  ::caffe::SigmoidParameter* sigmoid_param_;
-  ::caffe::SoftmaxParameter* softmax_param_;
-  ::caffe::SPPParameter* spp_param_;
-  ::caffe::SliceParameter* slice_param_;
-  ::caffe::TanHParameter* tanh_param_;
-  ::caffe::ThresholdParameter* threshold_param_;
-  ::caffe::TileParameter* tile_param_;
-  ::caffe::WindowDataParameter* window_data_param_;
-  ::caffe::QuantizationParameter* quantization_param_;
-  int phase_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static LayerParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class TransformationParameter : public ::google::protobuf::Message {
- public:
-  TransformationParameter();
-  virtual ~TransformationParameter();
-
-  TransformationParameter(const TransformationParameter& from);
-
-  inline TransformationParameter& operator=(const TransformationParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TransformationParameter& default_instance();
-
-  void Swap(TransformationParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  TransformationParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const TransformationParameter& from);
-  void MergeFrom(const TransformationParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float scale = 1 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 1;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional bool mirror = 2 [default = false];
-  inline bool has_mirror() const;
-  inline void clear_mirror();
-  static const int kMirrorFieldNumber = 2;
-  inline bool mirror() const;
-  inline void set_mirror(bool value);
-
-  // optional uint32 crop_size = 3 [default = 0];
-  inline bool has_crop_size() const;
-  inline void clear_crop_size();
-  static const int kCropSizeFieldNumber = 3;
-  inline ::google::protobuf::uint32 crop_size() const;
-  inline void set_crop_size(::google::protobuf::uint32 value);
-
-  // optional string mean_file = 4;
-  inline bool has_mean_file() const;
-  inline void clear_mean_file();
-  static const int kMeanFileFieldNumber = 4;
-  inline const ::std::string& mean_file() const;
-  inline void set_mean_file(const ::std::string& value);
-  inline void set_mean_file(const char* value);
-  inline void set_mean_file(const char* value, size_t size);
-  inline ::std::string* mutable_mean_file();
-  inline ::std::string* release_mean_file();
-  inline void set_allocated_mean_file(::std::string* mean_file);
-
-  // repeated float mean_value = 5;
-  inline int mean_value_size() const;
-  inline void clear_mean_value();
-  static const int kMeanValueFieldNumber = 5;
-  inline float mean_value(int index) const;
-  inline void set_mean_value(int index, float value);
-  inline void add_mean_value(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      mean_value() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_mean_value();
-
-  // optional bool force_color = 6 [default = false];
-  inline bool has_force_color() const;
-  inline void clear_force_color();
-  static const int kForceColorFieldNumber = 6;
-  inline bool force_color() const;
-  inline void set_force_color(bool value);
-
-  // optional bool force_gray = 7 [default = false];
-  inline bool has_force_gray() const;
-  inline void clear_force_gray();
-  static const int kForceGrayFieldNumber = 7;
-  inline bool force_gray() const;
-  inline void set_force_gray(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.TransformationParameter)
- private:
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_mirror();
-  inline void clear_has_mirror();
-  inline void set_has_crop_size();
-  inline void clear_has_crop_size();
-  inline void set_has_mean_file();
-  inline void clear_has_mean_file();
-  inline void set_has_force_color();
-  inline void clear_has_force_color();
-  inline void set_has_force_gray();
-  inline void clear_has_force_gray();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float scale_;
-  ::google::protobuf::uint32 crop_size_;
-  ::std::string* mean_file_;
-  ::google::protobuf::RepeatedField< float > mean_value_;
-  bool mirror_;
-  bool force_color_;
-  bool force_gray_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static TransformationParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class LossParameter : public ::google::protobuf::Message {
- public:
-  LossParameter();
-  virtual ~LossParameter();
-
-  LossParameter(const LossParameter& from);
-
-  inline LossParameter& operator=(const LossParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LossParameter& default_instance();
-
-  void Swap(LossParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  LossParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LossParameter& from);
-  void MergeFrom(const LossParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef LossParameter_NormalizationMode NormalizationMode;
-  static const NormalizationMode FULL = LossParameter_NormalizationMode_FULL;
-  static const NormalizationMode VALID = LossParameter_NormalizationMode_VALID;
-  static const NormalizationMode BATCH_SIZE = LossParameter_NormalizationMode_BATCH_SIZE;
-  static const NormalizationMode NONE = LossParameter_NormalizationMode_NONE;
-  static inline bool NormalizationMode_IsValid(int value) {
-    return LossParameter_NormalizationMode_IsValid(value);
-  }
-  static const NormalizationMode NormalizationMode_MIN =
-    LossParameter_NormalizationMode_NormalizationMode_MIN;
-  static const NormalizationMode NormalizationMode_MAX =
-    LossParameter_NormalizationMode_NormalizationMode_MAX;
-  static const int NormalizationMode_ARRAYSIZE =
-    LossParameter_NormalizationMode_NormalizationMode_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  NormalizationMode_descriptor() {
-    return LossParameter_NormalizationMode_descriptor();
-  }
-  static inline const ::std::string& NormalizationMode_Name(NormalizationMode value) {
-    return LossParameter_NormalizationMode_Name(value);
-  }
-  static inline bool NormalizationMode_Parse(const ::std::string& name,
-      NormalizationMode* value) {
-    return LossParameter_NormalizationMode_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 ignore_label = 1;
-  inline bool has_ignore_label() const;
-  inline void clear_ignore_label();
-  static const int kIgnoreLabelFieldNumber = 1;
-  inline ::google::protobuf::int32 ignore_label() const;
-  inline void set_ignore_label(::google::protobuf::int32 value);
-
-  // optional .caffe.LossParameter.NormalizationMode normalization = 3 [default = VALID];
-  inline bool has_normalization() const;
-  inline void clear_normalization();
-  static const int kNormalizationFieldNumber = 3;
-  inline ::caffe::LossParameter_NormalizationMode normalization() const;
-  inline void set_normalization(::caffe::LossParameter_NormalizationMode value);
-
-  // optional bool normalize = 2;
-  inline bool has_normalize() const;
-  inline void clear_normalize();
-  static const int kNormalizeFieldNumber = 2;
-  inline bool normalize() const;
-  inline void set_normalize(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.LossParameter)
- private:
-  inline void set_has_ignore_label();
-  inline void clear_has_ignore_label();
-  inline void set_has_normalization();
-  inline void clear_has_normalization();
-  inline void set_has_normalize();
-  inline void clear_has_normalize();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 ignore_label_;
-  int normalization_;
-  bool normalize_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static LossParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class AccuracyParameter : public ::google::protobuf::Message {
- public:
-  AccuracyParameter();
-  virtual ~AccuracyParameter();
-
-  AccuracyParameter(const AccuracyParameter& from);
-
-  inline AccuracyParameter& operator=(const AccuracyParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const AccuracyParameter& default_instance();
-
-  void Swap(AccuracyParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  AccuracyParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const AccuracyParameter& from);
-  void MergeFrom(const AccuracyParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 top_k = 1 [default = 1];
-  inline bool has_top_k() const;
-  inline void clear_top_k();
-  static const int kTopKFieldNumber = 1;
-  inline ::google::protobuf::uint32 top_k() const;
-  inline void set_top_k(::google::protobuf::uint32 value);
-
-  // optional int32 axis = 2 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 2;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional int32 ignore_label = 3;
-  inline bool has_ignore_label() const;
-  inline void clear_ignore_label();
-  static const int kIgnoreLabelFieldNumber = 3;
-  inline ::google::protobuf::int32 ignore_label() const;
-  inline void set_ignore_label(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.AccuracyParameter)
- private:
-  inline void set_has_top_k();
-  inline void clear_has_top_k();
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_ignore_label();
-  inline void clear_has_ignore_label();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 top_k_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::int32 ignore_label_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static AccuracyParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ArgMaxParameter : public ::google::protobuf::Message {
- public:
-  ArgMaxParameter();
-  virtual ~ArgMaxParameter();
-
-  ArgMaxParameter(const ArgMaxParameter& from);
-
-  inline ArgMaxParameter& operator=(const ArgMaxParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ArgMaxParameter& default_instance();
-
-  void Swap(ArgMaxParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ArgMaxParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ArgMaxParameter& from);
-  void MergeFrom(const ArgMaxParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional bool out_max_val = 1 [default = false];
-  inline bool has_out_max_val() const;
-  inline void clear_out_max_val();
-  static const int kOutMaxValFieldNumber = 1;
-  inline bool out_max_val() const;
-  inline void set_out_max_val(bool value);
-
-  // optional uint32 top_k = 2 [default = 1];
-  inline bool has_top_k() const;
-  inline void clear_top_k();
-  static const int kTopKFieldNumber = 2;
-  inline ::google::protobuf::uint32 top_k() const;
-  inline void set_top_k(::google::protobuf::uint32 value);
-
-  // optional int32 axis = 3;
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 3;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ArgMaxParameter)
- private:
-  inline void set_has_out_max_val();
-  inline void clear_has_out_max_val();
-  inline void set_has_top_k();
-  inline void clear_has_top_k();
-  inline void set_has_axis();
-  inline void clear_has_axis();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  bool out_max_val_;
-  ::google::protobuf::uint32 top_k_;
-  ::google::protobuf::int32 axis_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ArgMaxParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ConcatParameter : public ::google::protobuf::Message {
- public:
-  ConcatParameter();
-  virtual ~ConcatParameter();
-
-  ConcatParameter(const ConcatParameter& from);
-
-  inline ConcatParameter& operator=(const ConcatParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ConcatParameter& default_instance();
-
-  void Swap(ConcatParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ConcatParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ConcatParameter& from);
-  void MergeFrom(const ConcatParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 axis = 2 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 2;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional uint32 concat_dim = 1 [default = 1];
-  inline bool has_concat_dim() const;
-  inline void clear_concat_dim();
-  static const int kConcatDimFieldNumber = 1;
-  inline ::google::protobuf::uint32 concat_dim() const;
-  inline void set_concat_dim(::google::protobuf::uint32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ConcatParameter)
- private:
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_concat_dim();
-  inline void clear_has_concat_dim();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::uint32 concat_dim_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ConcatParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class BatchNormParameter : public ::google::protobuf::Message {
- public:
-  BatchNormParameter();
-  virtual ~BatchNormParameter();
-
-  BatchNormParameter(const BatchNormParameter& from);
-
-  inline BatchNormParameter& operator=(const BatchNormParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BatchNormParameter& default_instance();
-
-  void Swap(BatchNormParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  BatchNormParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BatchNormParameter& from);
-  void MergeFrom(const BatchNormParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional bool use_global_stats = 1;
-  inline bool has_use_global_stats() const;
-  inline void clear_use_global_stats();
-  static const int kUseGlobalStatsFieldNumber = 1;
-  inline bool use_global_stats() const;
-  inline void set_use_global_stats(bool value);
-
-  // optional float moving_average_fraction = 2 [default = 0.999];
-  inline bool has_moving_average_fraction() const;
-  inline void clear_moving_average_fraction();
-  static const int kMovingAverageFractionFieldNumber = 2;
-  inline float moving_average_fraction() const;
-  inline void set_moving_average_fraction(float value);
-
-  // optional float eps = 3 [default = 1e-05];
-  inline bool has_eps() const;
-  inline void clear_eps();
-  static const int kEpsFieldNumber = 3;
-  inline float eps() const;
-  inline void set_eps(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.BatchNormParameter)
- private:
-  inline void set_has_use_global_stats();
-  inline void clear_has_use_global_stats();
-  inline void set_has_moving_average_fraction();
-  inline void clear_has_moving_average_fraction();
-  inline void set_has_eps();
-  inline void clear_has_eps();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  bool use_global_stats_;
-  float moving_average_fraction_;
-  float eps_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static BatchNormParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class BiasParameter : public ::google::protobuf::Message {
- public:
-  BiasParameter();
-  virtual ~BiasParameter();
-
-  BiasParameter(const BiasParameter& from);
-
-  inline BiasParameter& operator=(const BiasParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BiasParameter& default_instance();
-
-  void Swap(BiasParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  BiasParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BiasParameter& from);
-  void MergeFrom(const BiasParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 axis = 1 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 1;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional int32 num_axes = 2 [default = 1];
-  inline bool has_num_axes() const;
-  inline void clear_num_axes();
-  static const int kNumAxesFieldNumber = 2;
-  inline ::google::protobuf::int32 num_axes() const;
-  inline void set_num_axes(::google::protobuf::int32 value);
-
-  // optional .caffe.FillerParameter filler = 3;
-  inline bool has_filler() const;
-  inline void clear_filler();
-  static const int kFillerFieldNumber = 3;
-  inline const ::caffe::FillerParameter& filler() const;
-  inline ::caffe::FillerParameter* mutable_filler();
-  inline ::caffe::FillerParameter* release_filler();
-  inline void set_allocated_filler(::caffe::FillerParameter* filler);
-
-  // @@protoc_insertion_point(class_scope:caffe.BiasParameter)
- private:
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_num_axes();
-  inline void clear_has_num_axes();
-  inline void set_has_filler();
-  inline void clear_has_filler();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::int32 num_axes_;
-  ::caffe::FillerParameter* filler_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static BiasParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ContrastiveLossParameter : public ::google::protobuf::Message {
- public:
-  ContrastiveLossParameter();
-  virtual ~ContrastiveLossParameter();
-
-  ContrastiveLossParameter(const ContrastiveLossParameter& from);
-
-  inline ContrastiveLossParameter& operator=(const ContrastiveLossParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ContrastiveLossParameter& default_instance();
-
-  void Swap(ContrastiveLossParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ContrastiveLossParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ContrastiveLossParameter& from);
-  void MergeFrom(const ContrastiveLossParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float margin = 1 [default = 1];
-  inline bool has_margin() const;
-  inline void clear_margin();
-  static const int kMarginFieldNumber = 1;
-  inline float margin() const;
-  inline void set_margin(float value);
-
-  // optional bool legacy_version = 2 [default = false];
-  inline bool has_legacy_version() const;
-  inline void clear_legacy_version();
-  static const int kLegacyVersionFieldNumber = 2;
-  inline bool legacy_version() const;
-  inline void set_legacy_version(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ContrastiveLossParameter)
- private:
-  inline void set_has_margin();
-  inline void clear_has_margin();
-  inline void set_has_legacy_version();
-  inline void clear_has_legacy_version();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float margin_;
-  bool legacy_version_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ContrastiveLossParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ConvolutionParameter : public ::google::protobuf::Message {
- public:
-  ConvolutionParameter();
-  virtual ~ConvolutionParameter();
-
-  ConvolutionParameter(const ConvolutionParameter& from);
-
-  inline ConvolutionParameter& operator=(const ConvolutionParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ConvolutionParameter& default_instance();
-
-  void Swap(ConvolutionParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ConvolutionParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ConvolutionParameter& from);
-  void MergeFrom(const ConvolutionParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef ConvolutionParameter_Engine Engine;
-  static const Engine DEFAULT = ConvolutionParameter_Engine_DEFAULT;
-  static const Engine CAFFE = ConvolutionParameter_Engine_CAFFE;
-  static const Engine CUDNN = ConvolutionParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return ConvolutionParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    ConvolutionParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    ConvolutionParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    ConvolutionParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return ConvolutionParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return ConvolutionParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return ConvolutionParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 num_output = 1;
-  inline bool has_num_output() const;
-  inline void clear_num_output();
-  static const int kNumOutputFieldNumber = 1;
-  inline ::google::protobuf::uint32 num_output() const;
-  inline void set_num_output(::google::protobuf::uint32 value);
-
-  // optional bool bias_term = 2 [default = true];
-  inline bool has_bias_term() const;
-  inline void clear_bias_term();
-  static const int kBiasTermFieldNumber = 2;
-  inline bool bias_term() const;
-  inline void set_bias_term(bool value);
-
-  // repeated uint32 pad = 3;
-  inline int pad_size() const;
-  inline void clear_pad();
-  static const int kPadFieldNumber = 3;
-  inline ::google::protobuf::uint32 pad(int index) const;
-  inline void set_pad(int index, ::google::protobuf::uint32 value);
-  inline void add_pad(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      pad() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_pad();
-
-  // repeated uint32 kernel_size = 4;
-  inline int kernel_size_size() const;
-  inline void clear_kernel_size();
-  static const int kKernelSizeFieldNumber = 4;
-  inline ::google::protobuf::uint32 kernel_size(int index) const;
-  inline void set_kernel_size(int index, ::google::protobuf::uint32 value);
-  inline void add_kernel_size(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      kernel_size() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_kernel_size();
-
-  // repeated uint32 stride = 6;
-  inline int stride_size() const;
-  inline void clear_stride();
-  static const int kStrideFieldNumber = 6;
-  inline ::google::protobuf::uint32 stride(int index) const;
-  inline void set_stride(int index, ::google::protobuf::uint32 value);
-  inline void add_stride(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      stride() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_stride();
-
-  // repeated uint32 dilation = 18;
-  inline int dilation_size() const;
-  inline void clear_dilation();
-  static const int kDilationFieldNumber = 18;
-  inline ::google::protobuf::uint32 dilation(int index) const;
-  inline void set_dilation(int index, ::google::protobuf::uint32 value);
-  inline void add_dilation(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      dilation() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_dilation();
-
-  // optional uint32 pad_h = 9 [default = 0];
-  inline bool has_pad_h() const;
-  inline void clear_pad_h();
-  static const int kPadHFieldNumber = 9;
-  inline ::google::protobuf::uint32 pad_h() const;
-  inline void set_pad_h(::google::protobuf::uint32 value);
-
-  // optional uint32 pad_w = 10 [default = 0];
-  inline bool has_pad_w() const;
-  inline void clear_pad_w();
-  static const int kPadWFieldNumber = 10;
-  inline ::google::protobuf::uint32 pad_w() const;
-  inline void set_pad_w(::google::protobuf::uint32 value);
-
-  // optional uint32 kernel_h = 11;
-  inline bool has_kernel_h() const;
-  inline void clear_kernel_h();
-  static const int kKernelHFieldNumber = 11;
-  inline ::google::protobuf::uint32 kernel_h() const;
-  inline void set_kernel_h(::google::protobuf::uint32 value);
-
-  // optional uint32 kernel_w = 12;
-  inline bool has_kernel_w() const;
-  inline void clear_kernel_w();
-  static const int kKernelWFieldNumber = 12;
-  inline ::google::protobuf::uint32 kernel_w() const;
-  inline void set_kernel_w(::google::protobuf::uint32 value);
-
-  // optional uint32 stride_h = 13;
-  inline bool has_stride_h() const;
-  inline void clear_stride_h();
-  static const int kStrideHFieldNumber = 13;
-  inline ::google::protobuf::uint32 stride_h() const;
-  inline void set_stride_h(::google::protobuf::uint32 value);
-
-  // optional uint32 stride_w = 14;
-  inline bool has_stride_w() const;
-  inline void clear_stride_w();
-  static const int kStrideWFieldNumber = 14;
-  inline ::google::protobuf::uint32 stride_w() const;
-  inline void set_stride_w(::google::protobuf::uint32 value);
-
-  // optional uint32 group = 5 [default = 1];
-  inline bool has_group() const;
-  inline void clear_group();
-  static const int kGroupFieldNumber = 5;
-  inline ::google::protobuf::uint32 group() const;
-  inline void set_group(::google::protobuf::uint32 value);
-
-  // optional .caffe.FillerParameter weight_filler = 7;
-  inline bool has_weight_filler() const;
-  inline void clear_weight_filler();
-  static const int kWeightFillerFieldNumber = 7;
-  inline const ::caffe::FillerParameter& weight_filler() const;
-  inline ::caffe::FillerParameter* mutable_weight_filler();
-  inline ::caffe::FillerParameter* release_weight_filler();
-  inline void set_allocated_weight_filler(::caffe::FillerParameter* weight_filler);
-
-  // optional .caffe.FillerParameter bias_filler = 8;
-  inline bool has_bias_filler() const;
-  inline void clear_bias_filler();
-  static const int kBiasFillerFieldNumber = 8;
-  inline const ::caffe::FillerParameter& bias_filler() const;
-  inline ::caffe::FillerParameter* mutable_bias_filler();
-  inline ::caffe::FillerParameter* release_bias_filler();
-  inline void set_allocated_bias_filler(::caffe::FillerParameter* bias_filler);
-
-  // optional .caffe.ConvolutionParameter.Engine engine = 15 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 15;
-  inline ::caffe::ConvolutionParameter_Engine engine() const;
-  inline void set_engine(::caffe::ConvolutionParameter_Engine value);
-
-  // optional int32 axis = 16 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 16;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional bool force_nd_im2col = 17 [default = false];
-  inline bool has_force_nd_im2col() const;
-  inline void clear_force_nd_im2col();
-  static const int kForceNdIm2ColFieldNumber = 17;
-  inline bool force_nd_im2col() const;
-  inline void set_force_nd_im2col(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ConvolutionParameter)
- private:
-  inline void set_has_num_output();
-  inline void clear_has_num_output();
-  inline void set_has_bias_term();
-  inline void clear_has_bias_term();
-  inline void set_has_pad_h();
-  inline void clear_has_pad_h();
-  inline void set_has_pad_w();
-  inline void clear_has_pad_w();
-  inline void set_has_kernel_h();
-  inline void clear_has_kernel_h();
-  inline void set_has_kernel_w();
-  inline void clear_has_kernel_w();
-  inline void set_has_stride_h();
-  inline void clear_has_stride_h();
-  inline void set_has_stride_w();
-  inline void clear_has_stride_w();
-  inline void set_has_group();
-  inline void clear_has_group();
-  inline void set_has_weight_filler();
-  inline void clear_has_weight_filler();
-  inline void set_has_bias_filler();
-  inline void clear_has_bias_filler();
-  inline void set_has_engine();
-  inline void clear_has_engine();
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_force_nd_im2col();
-  inline void clear_has_force_nd_im2col();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > pad_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > kernel_size_;
-  ::google::protobuf::uint32 num_output_;
-  ::google::protobuf::uint32 pad_h_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > stride_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > dilation_;
-  ::google::protobuf::uint32 pad_w_;
-  ::google::protobuf::uint32 kernel_h_;
-  ::google::protobuf::uint32 kernel_w_;
-  bool bias_term_;
-  bool force_nd_im2col_;
-  ::google::protobuf::uint32 stride_h_;
-  ::google::protobuf::uint32 stride_w_;
-  ::caffe::FillerParameter* weight_filler_;
-  ::google::protobuf::uint32 group_;
-  int engine_;
-  ::caffe::FillerParameter* bias_filler_;
-  ::google::protobuf::int32 axis_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ConvolutionParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class CropParameter : public ::google::protobuf::Message {
- public:
-  CropParameter();
-  virtual ~CropParameter();
-
-  CropParameter(const CropParameter& from);
-
-  inline CropParameter& operator=(const CropParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CropParameter& default_instance();
-
-  void Swap(CropParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  CropParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CropParameter& from);
-  void MergeFrom(const CropParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 axis = 1 [default = 2];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 1;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // repeated uint32 offset = 2;
-  inline int offset_size() const;
-  inline void clear_offset();
-  static const int kOffsetFieldNumber = 2;
-  inline ::google::protobuf::uint32 offset(int index) const;
-  inline void set_offset(int index, ::google::protobuf::uint32 value);
-  inline void add_offset(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      offset() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_offset();
-
-  // @@protoc_insertion_point(class_scope:caffe.CropParameter)
- private:
-  inline void set_has_axis();
-  inline void clear_has_axis();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > offset_;
-  ::google::protobuf::int32 axis_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static CropParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class DataParameter : public ::google::protobuf::Message {
- public:
-  DataParameter();
-  virtual ~DataParameter();
-
-  DataParameter(const DataParameter& from);
-
-  inline DataParameter& operator=(const DataParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DataParameter& default_instance();
-
-  void Swap(DataParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  DataParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const DataParameter& from);
-  void MergeFrom(const DataParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef DataParameter_DB DB;
-  static const DB LEVELDB = DataParameter_DB_LEVELDB;
-  static const DB LMDB = DataParameter_DB_LMDB;
-  static inline bool DB_IsValid(int value) {
-    return DataParameter_DB_IsValid(value);
-  }
-  static const DB DB_MIN =
-    DataParameter_DB_DB_MIN;
-  static const DB DB_MAX =
-    DataParameter_DB_DB_MAX;
-  static const int DB_ARRAYSIZE =
-    DataParameter_DB_DB_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  DB_descriptor() {
-    return DataParameter_DB_descriptor();
-  }
-  static inline const ::std::string& DB_Name(DB value) {
-    return DataParameter_DB_Name(value);
-  }
-  static inline bool DB_Parse(const ::std::string& name,
-      DB* value) {
-    return DataParameter_DB_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional string source = 1;
-  inline bool has_source() const;
-  inline void clear_source();
-  static const int kSourceFieldNumber = 1;
-  inline const ::std::string& source() const;
-  inline void set_source(const ::std::string& value);
-  inline void set_source(const char* value);
-  inline void set_source(const char* value, size_t size);
-  inline ::std::string* mutable_source();
-  inline ::std::string* release_source();
-  inline void set_allocated_source(::std::string* source);
-
-  // optional uint32 batch_size = 4;
-  inline bool has_batch_size() const;
-  inline void clear_batch_size();
-  static const int kBatchSizeFieldNumber = 4;
-  inline ::google::protobuf::uint32 batch_size() const;
-  inline void set_batch_size(::google::protobuf::uint32 value);
-
-  // optional uint32 rand_skip = 7 [default = 0];
-  inline bool has_rand_skip() const;
-  inline void clear_rand_skip();
-  static const int kRandSkipFieldNumber = 7;
-  inline ::google::protobuf::uint32 rand_skip() const;
-  inline void set_rand_skip(::google::protobuf::uint32 value);
-
-  // optional .caffe.DataParameter.DB backend = 8 [default = LEVELDB];
-  inline bool has_backend() const;
-  inline void clear_backend();
-  static const int kBackendFieldNumber = 8;
-  inline ::caffe::DataParameter_DB backend() const;
-  inline void set_backend(::caffe::DataParameter_DB value);
-
-  // optional float scale = 2 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 2;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional string mean_file = 3;
-  inline bool has_mean_file() const;
-  inline void clear_mean_file();
-  static const int kMeanFileFieldNumber = 3;
-  inline const ::std::string& mean_file() const;
-  inline void set_mean_file(const ::std::string& value);
-  inline void set_mean_file(const char* value);
-  inline void set_mean_file(const char* value, size_t size);
-  inline ::std::string* mutable_mean_file();
-  inline ::std::string* release_mean_file();
-  inline void set_allocated_mean_file(::std::string* mean_file);
-
-  // optional uint32 crop_size = 5 [default = 0];
-  inline bool has_crop_size() const;
-  inline void clear_crop_size();
-  static const int kCropSizeFieldNumber = 5;
-  inline ::google::protobuf::uint32 crop_size() const;
-  inline void set_crop_size(::google::protobuf::uint32 value);
-
-  // optional bool mirror = 6 [default = false];
-  inline bool has_mirror() const;
-  inline void clear_mirror();
-  static const int kMirrorFieldNumber = 6;
-  inline bool mirror() const;
-  inline void set_mirror(bool value);
-
-  // optional bool force_encoded_color = 9 [default = false];
-  inline bool has_force_encoded_color() const;
-  inline void clear_force_encoded_color();
-  static const int kForceEncodedColorFieldNumber = 9;
-  inline bool force_encoded_color() const;
-  inline void set_force_encoded_color(bool value);
-
-  // optional uint32 prefetch = 10 [default = 4];
-  inline bool has_prefetch() const;
-  inline void clear_prefetch();
-  static const int kPrefetchFieldNumber = 10;
-  inline ::google::protobuf::uint32 prefetch() const;
-  inline void set_prefetch(::google::protobuf::uint32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.DataParameter)
- private:
-  inline void set_has_source();
-  inline void clear_has_source();
-  inline void set_has_batch_size();
-  inline void clear_has_batch_size();
-  inline void set_has_rand_skip();
-  inline void clear_has_rand_skip();
-  inline void set_has_backend();
-  inline void clear_has_backend();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_mean_file();
-  inline void clear_has_mean_file();
-  inline void set_has_crop_size();
-  inline void clear_has_crop_size();
-  inline void set_has_mirror();
-  inline void clear_has_mirror();
-  inline void set_has_force_encoded_color();
-  inline void clear_has_force_encoded_color();
-  inline void set_has_prefetch();
-  inline void clear_has_prefetch();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* source_;
-  ::google::protobuf::uint32 batch_size_;
-  ::google::protobuf::uint32 rand_skip_;
-  int backend_;
-  float scale_;
-  ::std::string* mean_file_;
-  ::google::protobuf::uint32 crop_size_;
-  bool mirror_;
-  bool force_encoded_color_;
-  ::google::protobuf::uint32 prefetch_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static DataParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class DropoutParameter : public ::google::protobuf::Message {
- public:
-  DropoutParameter();
-  virtual ~DropoutParameter();
-
-  DropoutParameter(const DropoutParameter& from);
-
-  inline DropoutParameter& operator=(const DropoutParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DropoutParameter& default_instance();
-
-  void Swap(DropoutParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  DropoutParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const DropoutParameter& from);
-  void MergeFrom(const DropoutParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float dropout_ratio = 1 [default = 0.5];
-  inline bool has_dropout_ratio() const;
-  inline void clear_dropout_ratio();
-  static const int kDropoutRatioFieldNumber = 1;
-  inline float dropout_ratio() const;
-  inline void set_dropout_ratio(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.DropoutParameter)
- private:
-  inline void set_has_dropout_ratio();
-  inline void clear_has_dropout_ratio();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float dropout_ratio_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static DropoutParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class DummyDataParameter : public ::google::protobuf::Message {
- public:
-  DummyDataParameter();
-  virtual ~DummyDataParameter();
-
-  DummyDataParameter(const DummyDataParameter& from);
-
-  inline DummyDataParameter& operator=(const DummyDataParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DummyDataParameter& default_instance();
-
-  void Swap(DummyDataParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  DummyDataParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const DummyDataParameter& from);
-  void MergeFrom(const DummyDataParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // repeated .caffe.FillerParameter data_filler = 1;
-  inline int data_filler_size() const;
-  inline void clear_data_filler();
-  static const int kDataFillerFieldNumber = 1;
-  inline const ::caffe::FillerParameter& data_filler(int index) const;
-  inline ::caffe::FillerParameter* mutable_data_filler(int index);
-  inline ::caffe::FillerParameter* add_data_filler();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >&
-      data_filler() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >*
-      mutable_data_filler();
-
-  // repeated .caffe.BlobShape shape = 6;
-  inline int shape_size() const;
-  inline void clear_shape();
-  static const int kShapeFieldNumber = 6;
-  inline const ::caffe::BlobShape& shape(int index) const;
-  inline ::caffe::BlobShape* mutable_shape(int index);
-  inline ::caffe::BlobShape* add_shape();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-      shape() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
-      mutable_shape();
-
-  // repeated uint32 num = 2;
-  inline int num_size() const;
-  inline void clear_num();
-  static const int kNumFieldNumber = 2;
-  inline ::google::protobuf::uint32 num(int index) const;
-  inline void set_num(int index, ::google::protobuf::uint32 value);
-  inline void add_num(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      num() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_num();
-
-  // repeated uint32 channels = 3;
-  inline int channels_size() const;
-  inline void clear_channels();
-  static const int kChannelsFieldNumber = 3;
-  inline ::google::protobuf::uint32 channels(int index) const;
-  inline void set_channels(int index, ::google::protobuf::uint32 value);
-  inline void add_channels(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      channels() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_channels();
-
-  // repeated uint32 height = 4;
-  inline int height_size() const;
-  inline void clear_height();
-  static const int kHeightFieldNumber = 4;
-  inline ::google::protobuf::uint32 height(int index) const;
-  inline void set_height(int index, ::google::protobuf::uint32 value);
-  inline void add_height(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      height() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_height();
-
-  // repeated uint32 width = 5;
-  inline int width_size() const;
-  inline void clear_width();
-  static const int kWidthFieldNumber = 5;
-  inline ::google::protobuf::uint32 width(int index) const;
-  inline void set_width(int index, ::google::protobuf::uint32 value);
-  inline void add_width(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      width() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_width();
-
-  // @@protoc_insertion_point(class_scope:caffe.DummyDataParameter)
- private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter > data_filler_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape > shape_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > num_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > channels_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > height_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > width_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static DummyDataParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class EltwiseParameter : public ::google::protobuf::Message {
- public:
-  EltwiseParameter();
-  virtual ~EltwiseParameter();
-
-  EltwiseParameter(const EltwiseParameter& from);
-
-  inline EltwiseParameter& operator=(const EltwiseParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const EltwiseParameter& default_instance();
-
-  void Swap(EltwiseParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  EltwiseParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const EltwiseParameter& from);
-  void MergeFrom(const EltwiseParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef EltwiseParameter_EltwiseOp EltwiseOp;
-  static const EltwiseOp PROD = EltwiseParameter_EltwiseOp_PROD;
-  static const EltwiseOp SUM = EltwiseParameter_EltwiseOp_SUM;
-  static const EltwiseOp MAX = EltwiseParameter_EltwiseOp_MAX;
-  static inline bool EltwiseOp_IsValid(int value) {
-    return EltwiseParameter_EltwiseOp_IsValid(value);
-  }
-  static const EltwiseOp EltwiseOp_MIN =
-    EltwiseParameter_EltwiseOp_EltwiseOp_MIN;
-  static const EltwiseOp EltwiseOp_MAX =
-    EltwiseParameter_EltwiseOp_EltwiseOp_MAX;
-  static const int EltwiseOp_ARRAYSIZE =
-    EltwiseParameter_EltwiseOp_EltwiseOp_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  EltwiseOp_descriptor() {
-    return EltwiseParameter_EltwiseOp_descriptor();
-  }
-  static inline const ::std::string& EltwiseOp_Name(EltwiseOp value) {
-    return EltwiseParameter_EltwiseOp_Name(value);
-  }
-  static inline bool EltwiseOp_Parse(const ::std::string& name,
-      EltwiseOp* value) {
-    return EltwiseParameter_EltwiseOp_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.EltwiseParameter.EltwiseOp operation = 1 [default = SUM];
-  inline bool has_operation() const;
-  inline void clear_operation();
-  static const int kOperationFieldNumber = 1;
-  inline ::caffe::EltwiseParameter_EltwiseOp operation() const;
-  inline void set_operation(::caffe::EltwiseParameter_EltwiseOp value);
-
-  // repeated float coeff = 2;
-  inline int coeff_size() const;
-  inline void clear_coeff();
-  static const int kCoeffFieldNumber = 2;
-  inline float coeff(int index) const;
-  inline void set_coeff(int index, float value);
-  inline void add_coeff(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      coeff() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_coeff();
-
-  // optional bool stable_prod_grad = 3 [default = true];
-  inline bool has_stable_prod_grad() const;
-  inline void clear_stable_prod_grad();
-  static const int kStableProdGradFieldNumber = 3;
-  inline bool stable_prod_grad() const;
-  inline void set_stable_prod_grad(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.EltwiseParameter)
- private:
-  inline void set_has_operation();
-  inline void clear_has_operation();
-  inline void set_has_stable_prod_grad();
-  inline void clear_has_stable_prod_grad();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< float > coeff_;
-  int operation_;
-  bool stable_prod_grad_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static EltwiseParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ELUParameter : public ::google::protobuf::Message {
- public:
-  ELUParameter();
-  virtual ~ELUParameter();
-
-  ELUParameter(const ELUParameter& from);
-
-  inline ELUParameter& operator=(const ELUParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ELUParameter& default_instance();
-
-  void Swap(ELUParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ELUParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ELUParameter& from);
-  void MergeFrom(const ELUParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float alpha = 1 [default = 1];
-  inline bool has_alpha() const;
-  inline void clear_alpha();
-  static const int kAlphaFieldNumber = 1;
-  inline float alpha() const;
-  inline void set_alpha(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ELUParameter)
- private:
-  inline void set_has_alpha();
-  inline void clear_has_alpha();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float alpha_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ELUParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class EmbedParameter : public ::google::protobuf::Message {
- public:
-  EmbedParameter();
-  virtual ~EmbedParameter();
-
-  EmbedParameter(const EmbedParameter& from);
-
-  inline EmbedParameter& operator=(const EmbedParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const EmbedParameter& default_instance();
-
-  void Swap(EmbedParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  EmbedParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const EmbedParameter& from);
-  void MergeFrom(const EmbedParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 num_output = 1;
-  inline bool has_num_output() const;
-  inline void clear_num_output();
-  static const int kNumOutputFieldNumber = 1;
-  inline ::google::protobuf::uint32 num_output() const;
-  inline void set_num_output(::google::protobuf::uint32 value);
-
-  // optional uint32 input_dim = 2;
-  inline bool has_input_dim() const;
-  inline void clear_input_dim();
-  static const int kInputDimFieldNumber = 2;
-  inline ::google::protobuf::uint32 input_dim() const;
-  inline void set_input_dim(::google::protobuf::uint32 value);
-
-  // optional bool bias_term = 3 [default = true];
-  inline bool has_bias_term() const;
-  inline void clear_bias_term();
-  static const int kBiasTermFieldNumber = 3;
-  inline bool bias_term() const;
-  inline void set_bias_term(bool value);
-
-  // optional .caffe.FillerParameter weight_filler = 4;
-  inline bool has_weight_filler() const;
-  inline void clear_weight_filler();
-  static const int kWeightFillerFieldNumber = 4;
-  inline const ::caffe::FillerParameter& weight_filler() const;
-  inline ::caffe::FillerParameter* mutable_weight_filler();
-  inline ::caffe::FillerParameter* release_weight_filler();
-  inline void set_allocated_weight_filler(::caffe::FillerParameter* weight_filler);
-
-  // optional .caffe.FillerParameter bias_filler = 5;
-  inline bool has_bias_filler() const;
-  inline void clear_bias_filler();
-  static const int kBiasFillerFieldNumber = 5;
-  inline const ::caffe::FillerParameter& bias_filler() const;
-  inline ::caffe::FillerParameter* mutable_bias_filler();
-  inline ::caffe::FillerParameter* release_bias_filler();
-  inline void set_allocated_bias_filler(::caffe::FillerParameter* bias_filler);
-
-  // @@protoc_insertion_point(class_scope:caffe.EmbedParameter)
- private:
-  inline void set_has_num_output();
-  inline void clear_has_num_output();
-  inline void set_has_input_dim();
-  inline void clear_has_input_dim();
-  inline void set_has_bias_term();
-  inline void clear_has_bias_term();
-  inline void set_has_weight_filler();
-  inline void clear_has_weight_filler();
-  inline void set_has_bias_filler();
-  inline void clear_has_bias_filler();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 num_output_;
-  ::google::protobuf::uint32 input_dim_;
-  ::caffe::FillerParameter* weight_filler_;
-  ::caffe::FillerParameter* bias_filler_;
-  bool bias_term_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static EmbedParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ExpParameter : public ::google::protobuf::Message {
- public:
-  ExpParameter();
-  virtual ~ExpParameter();
-
-  ExpParameter(const ExpParameter& from);
-
-  inline ExpParameter& operator=(const ExpParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ExpParameter& default_instance();
-
-  void Swap(ExpParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ExpParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ExpParameter& from);
-  void MergeFrom(const ExpParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float base = 1 [default = -1];
-  inline bool has_base() const;
-  inline void clear_base();
-  static const int kBaseFieldNumber = 1;
-  inline float base() const;
-  inline void set_base(float value);
-
-  // optional float scale = 2 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 2;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional float shift = 3 [default = 0];
-  inline bool has_shift() const;
-  inline void clear_shift();
-  static const int kShiftFieldNumber = 3;
-  inline float shift() const;
-  inline void set_shift(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ExpParameter)
- private:
-  inline void set_has_base();
-  inline void clear_has_base();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_shift();
-  inline void clear_has_shift();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float base_;
-  float scale_;
-  float shift_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ExpParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class FlattenParameter : public ::google::protobuf::Message {
- public:
-  FlattenParameter();
-  virtual ~FlattenParameter();
-
-  FlattenParameter(const FlattenParameter& from);
-
-  inline FlattenParameter& operator=(const FlattenParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const FlattenParameter& default_instance();
-
-  void Swap(FlattenParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  FlattenParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const FlattenParameter& from);
-  void MergeFrom(const FlattenParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 axis = 1 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 1;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional int32 end_axis = 2 [default = -1];
-  inline bool has_end_axis() const;
-  inline void clear_end_axis();
-  static const int kEndAxisFieldNumber = 2;
-  inline ::google::protobuf::int32 end_axis() const;
-  inline void set_end_axis(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.FlattenParameter)
- private:
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_end_axis();
-  inline void clear_has_end_axis();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::int32 end_axis_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static FlattenParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class HDF5DataParameter : public ::google::protobuf::Message {
- public:
-  HDF5DataParameter();
-  virtual ~HDF5DataParameter();
-
-  HDF5DataParameter(const HDF5DataParameter& from);
-
-  inline HDF5DataParameter& operator=(const HDF5DataParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HDF5DataParameter& default_instance();
-
-  void Swap(HDF5DataParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  HDF5DataParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const HDF5DataParameter& from);
-  void MergeFrom(const HDF5DataParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string source = 1;
-  inline bool has_source() const;
-  inline void clear_source();
-  static const int kSourceFieldNumber = 1;
-  inline const ::std::string& source() const;
-  inline void set_source(const ::std::string& value);
-  inline void set_source(const char* value);
-  inline void set_source(const char* value, size_t size);
-  inline ::std::string* mutable_source();
-  inline ::std::string* release_source();
-  inline void set_allocated_source(::std::string* source);
-
-  // optional uint32 batch_size = 2;
-  inline bool has_batch_size() const;
-  inline void clear_batch_size();
-  static const int kBatchSizeFieldNumber = 2;
-  inline ::google::protobuf::uint32 batch_size() const;
-  inline void set_batch_size(::google::protobuf::uint32 value);
-
-  // optional bool shuffle = 3 [default = false];
-  inline bool has_shuffle() const;
-  inline void clear_shuffle();
-  static const int kShuffleFieldNumber = 3;
-  inline bool shuffle() const;
-  inline void set_shuffle(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.HDF5DataParameter)
- private:
-  inline void set_has_source();
-  inline void clear_has_source();
-  inline void set_has_batch_size();
-  inline void clear_has_batch_size();
-  inline void set_has_shuffle();
-  inline void clear_has_shuffle();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* source_;
-  ::google::protobuf::uint32 batch_size_;
-  bool shuffle_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static HDF5DataParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class HDF5OutputParameter : public ::google::protobuf::Message {
- public:
-  HDF5OutputParameter();
-  virtual ~HDF5OutputParameter();
-
-  HDF5OutputParameter(const HDF5OutputParameter& from);
-
-  inline HDF5OutputParameter& operator=(const HDF5OutputParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HDF5OutputParameter& default_instance();
-
-  void Swap(HDF5OutputParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  HDF5OutputParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const HDF5OutputParameter& from);
-  void MergeFrom(const HDF5OutputParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string file_name = 1;
-  inline bool has_file_name() const;
-  inline void clear_file_name();
-  static const int kFileNameFieldNumber = 1;
-  inline const ::std::string& file_name() const;
-  inline void set_file_name(const ::std::string& value);
-  inline void set_file_name(const char* value);
-  inline void set_file_name(const char* value, size_t size);
-  inline ::std::string* mutable_file_name();
-  inline ::std::string* release_file_name();
-  inline void set_allocated_file_name(::std::string* file_name);
-
-  // @@protoc_insertion_point(class_scope:caffe.HDF5OutputParameter)
- private:
-  inline void set_has_file_name();
-  inline void clear_has_file_name();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* file_name_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static HDF5OutputParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class HingeLossParameter : public ::google::protobuf::Message {
- public:
-  HingeLossParameter();
-  virtual ~HingeLossParameter();
-
-  HingeLossParameter(const HingeLossParameter& from);
-
-  inline HingeLossParameter& operator=(const HingeLossParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HingeLossParameter& default_instance();
-
-  void Swap(HingeLossParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  HingeLossParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const HingeLossParameter& from);
-  void MergeFrom(const HingeLossParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef HingeLossParameter_Norm Norm;
-  static const Norm L1 = HingeLossParameter_Norm_L1;
-  static const Norm L2 = HingeLossParameter_Norm_L2;
-  static inline bool Norm_IsValid(int value) {
-    return HingeLossParameter_Norm_IsValid(value);
-  }
-  static const Norm Norm_MIN =
-    HingeLossParameter_Norm_Norm_MIN;
-  static const Norm Norm_MAX =
-    HingeLossParameter_Norm_Norm_MAX;
-  static const int Norm_ARRAYSIZE =
-    HingeLossParameter_Norm_Norm_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Norm_descriptor() {
-    return HingeLossParameter_Norm_descriptor();
-  }
-  static inline const ::std::string& Norm_Name(Norm value) {
-    return HingeLossParameter_Norm_Name(value);
-  }
-  static inline bool Norm_Parse(const ::std::string& name,
-      Norm* value) {
-    return HingeLossParameter_Norm_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.HingeLossParameter.Norm norm = 1 [default = L1];
-  inline bool has_norm() const;
-  inline void clear_norm();
-  static const int kNormFieldNumber = 1;
-  inline ::caffe::HingeLossParameter_Norm norm() const;
-  inline void set_norm(::caffe::HingeLossParameter_Norm value);
-
-  // @@protoc_insertion_point(class_scope:caffe.HingeLossParameter)
- private:
-  inline void set_has_norm();
-  inline void clear_has_norm();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int norm_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static HingeLossParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ImageDataParameter : public ::google::protobuf::Message {
- public:
-  ImageDataParameter();
-  virtual ~ImageDataParameter();
-
-  ImageDataParameter(const ImageDataParameter& from);
-
-  inline ImageDataParameter& operator=(const ImageDataParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ImageDataParameter& default_instance();
-
-  void Swap(ImageDataParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ImageDataParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ImageDataParameter& from);
-  void MergeFrom(const ImageDataParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string source = 1;
-  inline bool has_source() const;
-  inline void clear_source();
-  static const int kSourceFieldNumber = 1;
-  inline const ::std::string& source() const;
-  inline void set_source(const ::std::string& value);
-  inline void set_source(const char* value);
-  inline void set_source(const char* value, size_t size);
-  inline ::std::string* mutable_source();
-  inline ::std::string* release_source();
-  inline void set_allocated_source(::std::string* source);
-
-  // optional uint32 batch_size = 4 [default = 1];
-  inline bool has_batch_size() const;
-  inline void clear_batch_size();
-  static const int kBatchSizeFieldNumber = 4;
-  inline ::google::protobuf::uint32 batch_size() const;
-  inline void set_batch_size(::google::protobuf::uint32 value);
-
-  // optional uint32 rand_skip = 7 [default = 0];
-  inline bool has_rand_skip() const;
-  inline void clear_rand_skip();
-  static const int kRandSkipFieldNumber = 7;
-  inline ::google::protobuf::uint32 rand_skip() const;
-  inline void set_rand_skip(::google::protobuf::uint32 value);
-
-  // optional bool shuffle = 8 [default = false];
-  inline bool has_shuffle() const;
-  inline void clear_shuffle();
-  static const int kShuffleFieldNumber = 8;
-  inline bool shuffle() const;
-  inline void set_shuffle(bool value);
-
-  // optional uint32 new_height = 9 [default = 0];
-  inline bool has_new_height() const;
-  inline void clear_new_height();
-  static const int kNewHeightFieldNumber = 9;
-  inline ::google::protobuf::uint32 new_height() const;
-  inline void set_new_height(::google::protobuf::uint32 value);
-
-  // optional uint32 new_width = 10 [default = 0];
-  inline bool has_new_width() const;
-  inline void clear_new_width();
-  static const int kNewWidthFieldNumber = 10;
-  inline ::google::protobuf::uint32 new_width() const;
-  inline void set_new_width(::google::protobuf::uint32 value);
-
-  // optional bool is_color = 11 [default = true];
-  inline bool has_is_color() const;
-  inline void clear_is_color();
-  static const int kIsColorFieldNumber = 11;
-  inline bool is_color() const;
-  inline void set_is_color(bool value);
-
-  // optional float scale = 2 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 2;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional string mean_file = 3;
-  inline bool has_mean_file() const;
-  inline void clear_mean_file();
-  static const int kMeanFileFieldNumber = 3;
-  inline const ::std::string& mean_file() const;
-  inline void set_mean_file(const ::std::string& value);
-  inline void set_mean_file(const char* value);
-  inline void set_mean_file(const char* value, size_t size);
-  inline ::std::string* mutable_mean_file();
-  inline ::std::string* release_mean_file();
-  inline void set_allocated_mean_file(::std::string* mean_file);
-
-  // optional uint32 crop_size = 5 [default = 0];
-  inline bool has_crop_size() const;
-  inline void clear_crop_size();
-  static const int kCropSizeFieldNumber = 5;
-  inline ::google::protobuf::uint32 crop_size() const;
-  inline void set_crop_size(::google::protobuf::uint32 value);
-
-  // optional bool mirror = 6 [default = false];
-  inline bool has_mirror() const;
-  inline void clear_mirror();
-  static const int kMirrorFieldNumber = 6;
-  inline bool mirror() const;
-  inline void set_mirror(bool value);
-
-  // optional string root_folder = 12 [default = ""];
-  inline bool has_root_folder() const;
-  inline void clear_root_folder();
-  static const int kRootFolderFieldNumber = 12;
-  inline const ::std::string& root_folder() const;
-  inline void set_root_folder(const ::std::string& value);
-  inline void set_root_folder(const char* value);
-  inline void set_root_folder(const char* value, size_t size);
-  inline ::std::string* mutable_root_folder();
-  inline ::std::string* release_root_folder();
-  inline void set_allocated_root_folder(::std::string* root_folder);
-
-  // @@protoc_insertion_point(class_scope:caffe.ImageDataParameter)
- private:
-  inline void set_has_source();
-  inline void clear_has_source();
-  inline void set_has_batch_size();
-  inline void clear_has_batch_size();
-  inline void set_has_rand_skip();
-  inline void clear_has_rand_skip();
-  inline void set_has_shuffle();
-  inline void clear_has_shuffle();
-  inline void set_has_new_height();
-  inline void clear_has_new_height();
-  inline void set_has_new_width();
-  inline void clear_has_new_width();
-  inline void set_has_is_color();
-  inline void clear_has_is_color();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_mean_file();
-  inline void clear_has_mean_file();
-  inline void set_has_crop_size();
-  inline void clear_has_crop_size();
-  inline void set_has_mirror();
-  inline void clear_has_mirror();
-  inline void set_has_root_folder();
-  inline void clear_has_root_folder();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* source_;
-  ::google::protobuf::uint32 batch_size_;
-  ::google::protobuf::uint32 rand_skip_;
-  ::google::protobuf::uint32 new_height_;
-  ::google::protobuf::uint32 new_width_;
-  bool shuffle_;
-  bool is_color_;
-  bool mirror_;
-  float scale_;
-  ::std::string* mean_file_;
-  ::std::string* root_folder_;
-  ::google::protobuf::uint32 crop_size_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ImageDataParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class InfogainLossParameter : public ::google::protobuf::Message {
- public:
-  InfogainLossParameter();
-  virtual ~InfogainLossParameter();
-
-  InfogainLossParameter(const InfogainLossParameter& from);
-
-  inline InfogainLossParameter& operator=(const InfogainLossParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const InfogainLossParameter& default_instance();
-
-  void Swap(InfogainLossParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  InfogainLossParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const InfogainLossParameter& from);
-  void MergeFrom(const InfogainLossParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string source = 1;
-  inline bool has_source() const;
-  inline void clear_source();
-  static const int kSourceFieldNumber = 1;
-  inline const ::std::string& source() const;
-  inline void set_source(const ::std::string& value);
-  inline void set_source(const char* value);
-  inline void set_source(const char* value, size_t size);
-  inline ::std::string* mutable_source();
-  inline ::std::string* release_source();
-  inline void set_allocated_source(::std::string* source);
-
-  // @@protoc_insertion_point(class_scope:caffe.InfogainLossParameter)
- private:
-  inline void set_has_source();
-  inline void clear_has_source();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* source_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static InfogainLossParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class InnerProductParameter : public ::google::protobuf::Message {
- public:
-  InnerProductParameter();
-  virtual ~InnerProductParameter();
-
-  InnerProductParameter(const InnerProductParameter& from);
-
-  inline InnerProductParameter& operator=(const InnerProductParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const InnerProductParameter& default_instance();
-
-  void Swap(InnerProductParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  InnerProductParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const InnerProductParameter& from);
-  void MergeFrom(const InnerProductParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 num_output = 1;
-  inline bool has_num_output() const;
-  inline void clear_num_output();
-  static const int kNumOutputFieldNumber = 1;
-  inline ::google::protobuf::uint32 num_output() const;
-  inline void set_num_output(::google::protobuf::uint32 value);
-
-  // optional bool bias_term = 2 [default = true];
-  inline bool has_bias_term() const;
-  inline void clear_bias_term();
-  static const int kBiasTermFieldNumber = 2;
-  inline bool bias_term() const;
-  inline void set_bias_term(bool value);
-
-  // optional .caffe.FillerParameter weight_filler = 3;
-  inline bool has_weight_filler() const;
-  inline void clear_weight_filler();
-  static const int kWeightFillerFieldNumber = 3;
-  inline const ::caffe::FillerParameter& weight_filler() const;
-  inline ::caffe::FillerParameter* mutable_weight_filler();
-  inline ::caffe::FillerParameter* release_weight_filler();
-  inline void set_allocated_weight_filler(::caffe::FillerParameter* weight_filler);
-
-  // optional .caffe.FillerParameter bias_filler = 4;
-  inline bool has_bias_filler() const;
-  inline void clear_bias_filler();
-  static const int kBiasFillerFieldNumber = 4;
-  inline const ::caffe::FillerParameter& bias_filler() const;
-  inline ::caffe::FillerParameter* mutable_bias_filler();
-  inline ::caffe::FillerParameter* release_bias_filler();
-  inline void set_allocated_bias_filler(::caffe::FillerParameter* bias_filler);
-
-  // optional int32 axis = 5 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 5;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional bool transpose = 6 [default = false];
-  inline bool has_transpose() const;
-  inline void clear_transpose();
-  static const int kTransposeFieldNumber = 6;
-  inline bool transpose() const;
-  inline void set_transpose(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.InnerProductParameter)
- private:
-  inline void set_has_num_output();
-  inline void clear_has_num_output();
-  inline void set_has_bias_term();
-  inline void clear_has_bias_term();
-  inline void set_has_weight_filler();
-  inline void clear_has_weight_filler();
-  inline void set_has_bias_filler();
-  inline void clear_has_bias_filler();
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_transpose();
-  inline void clear_has_transpose();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::caffe::FillerParameter* weight_filler_;
-  ::google::protobuf::uint32 num_output_;
-  bool bias_term_;
-  bool transpose_;
-  ::caffe::FillerParameter* bias_filler_;
-  ::google::protobuf::int32 axis_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static InnerProductParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class InputParameter : public ::google::protobuf::Message {
- public:
-  InputParameter();
-  virtual ~InputParameter();
-
-  InputParameter(const InputParameter& from);
-
-  inline InputParameter& operator=(const InputParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const InputParameter& default_instance();
-
-  void Swap(InputParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  InputParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const InputParameter& from);
-  void MergeFrom(const InputParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // repeated .caffe.BlobShape shape = 1;
-  inline int shape_size() const;
-  inline void clear_shape();
-  static const int kShapeFieldNumber = 1;
-  inline const ::caffe::BlobShape& shape(int index) const;
-  inline ::caffe::BlobShape* mutable_shape(int index);
-  inline ::caffe::BlobShape* add_shape();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-      shape() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
-      mutable_shape();
-
-  // @@protoc_insertion_point(class_scope:caffe.InputParameter)
- private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape > shape_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static InputParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class LogParameter : public ::google::protobuf::Message {
- public:
-  LogParameter();
-  virtual ~LogParameter();
-
-  LogParameter(const LogParameter& from);
-
-  inline LogParameter& operator=(const LogParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LogParameter& default_instance();
-
-  void Swap(LogParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  LogParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LogParameter& from);
-  void MergeFrom(const LogParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float base = 1 [default = -1];
-  inline bool has_base() const;
-  inline void clear_base();
-  static const int kBaseFieldNumber = 1;
-  inline float base() const;
-  inline void set_base(float value);
-
-  // optional float scale = 2 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 2;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional float shift = 3 [default = 0];
-  inline bool has_shift() const;
-  inline void clear_shift();
-  static const int kShiftFieldNumber = 3;
-  inline float shift() const;
-  inline void set_shift(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.LogParameter)
- private:
-  inline void set_has_base();
-  inline void clear_has_base();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_shift();
-  inline void clear_has_shift();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float base_;
-  float scale_;
-  float shift_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static LogParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class LRNParameter : public ::google::protobuf::Message {
- public:
-  LRNParameter();
-  virtual ~LRNParameter();
-
-  LRNParameter(const LRNParameter& from);
-
-  inline LRNParameter& operator=(const LRNParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LRNParameter& default_instance();
-
-  void Swap(LRNParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  LRNParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LRNParameter& from);
-  void MergeFrom(const LRNParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef LRNParameter_NormRegion NormRegion;
-  static const NormRegion ACROSS_CHANNELS = LRNParameter_NormRegion_ACROSS_CHANNELS;
-  static const NormRegion WITHIN_CHANNEL = LRNParameter_NormRegion_WITHIN_CHANNEL;
-  static inline bool NormRegion_IsValid(int value) {
-    return LRNParameter_NormRegion_IsValid(value);
-  }
-  static const NormRegion NormRegion_MIN =
-    LRNParameter_NormRegion_NormRegion_MIN;
-  static const NormRegion NormRegion_MAX =
-    LRNParameter_NormRegion_NormRegion_MAX;
-  static const int NormRegion_ARRAYSIZE =
-    LRNParameter_NormRegion_NormRegion_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  NormRegion_descriptor() {
-    return LRNParameter_NormRegion_descriptor();
-  }
-  static inline const ::std::string& NormRegion_Name(NormRegion value) {
-    return LRNParameter_NormRegion_Name(value);
-  }
-  static inline bool NormRegion_Parse(const ::std::string& name,
-      NormRegion* value) {
-    return LRNParameter_NormRegion_Parse(name, value);
-  }
-
-  typedef LRNParameter_Engine Engine;
-  static const Engine DEFAULT = LRNParameter_Engine_DEFAULT;
-  static const Engine CAFFE = LRNParameter_Engine_CAFFE;
-  static const Engine CUDNN = LRNParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return LRNParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    LRNParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    LRNParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    LRNParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return LRNParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return LRNParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return LRNParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 local_size = 1 [default = 5];
-  inline bool has_local_size() const;
-  inline void clear_local_size();
-  static const int kLocalSizeFieldNumber = 1;
-  inline ::google::protobuf::uint32 local_size() const;
-  inline void set_local_size(::google::protobuf::uint32 value);
-
-  // optional float alpha = 2 [default = 1];
-  inline bool has_alpha() const;
-  inline void clear_alpha();
-  static const int kAlphaFieldNumber = 2;
-  inline float alpha() const;
-  inline void set_alpha(float value);
-
-  // optional float beta = 3 [default = 0.75];
-  inline bool has_beta() const;
-  inline void clear_beta();
-  static const int kBetaFieldNumber = 3;
-  inline float beta() const;
-  inline void set_beta(float value);
-
-  // optional .caffe.LRNParameter.NormRegion norm_region = 4 [default = ACROSS_CHANNELS];
-  inline bool has_norm_region() const;
-  inline void clear_norm_region();
-  static const int kNormRegionFieldNumber = 4;
-  inline ::caffe::LRNParameter_NormRegion norm_region() const;
-  inline void set_norm_region(::caffe::LRNParameter_NormRegion value);
-
-  // optional float k = 5 [default = 1];
-  inline bool has_k() const;
-  inline void clear_k();
-  static const int kKFieldNumber = 5;
-  inline float k() const;
-  inline void set_k(float value);
-
-  // optional .caffe.LRNParameter.Engine engine = 6 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 6;
-  inline ::caffe::LRNParameter_Engine engine() const;
-  inline void set_engine(::caffe::LRNParameter_Engine value);
-
-  // @@protoc_insertion_point(class_scope:caffe.LRNParameter)
- private:
-  inline void set_has_local_size();
-  inline void clear_has_local_size();
-  inline void set_has_alpha();
-  inline void clear_has_alpha();
-  inline void set_has_beta();
-  inline void clear_has_beta();
-  inline void set_has_norm_region();
-  inline void clear_has_norm_region();
-  inline void set_has_k();
-  inline void clear_has_k();
-  inline void set_has_engine();
-  inline void clear_has_engine();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 local_size_;
-  float alpha_;
-  float beta_;
-  int norm_region_;
-  float k_;
-  int engine_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static LRNParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class MemoryDataParameter : public ::google::protobuf::Message {
- public:
-  MemoryDataParameter();
-  virtual ~MemoryDataParameter();
-
-  MemoryDataParameter(const MemoryDataParameter& from);
-
-  inline MemoryDataParameter& operator=(const MemoryDataParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MemoryDataParameter& default_instance();
-
-  void Swap(MemoryDataParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  MemoryDataParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const MemoryDataParameter& from);
-  void MergeFrom(const MemoryDataParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 batch_size = 1;
-  inline bool has_batch_size() const;
-  inline void clear_batch_size();
-  static const int kBatchSizeFieldNumber = 1;
-  inline ::google::protobuf::uint32 batch_size() const;
-  inline void set_batch_size(::google::protobuf::uint32 value);
-
-  // optional uint32 channels = 2;
-  inline bool has_channels() const;
-  inline void clear_channels();
-  static const int kChannelsFieldNumber = 2;
-  inline ::google::protobuf::uint32 channels() const;
-  inline void set_channels(::google::protobuf::uint32 value);
-
-  // optional uint32 height = 3;
-  inline bool has_height() const;
-  inline void clear_height();
-  static const int kHeightFieldNumber = 3;
-  inline ::google::protobuf::uint32 height() const;
-  inline void set_height(::google::protobuf::uint32 value);
-
-  // optional uint32 width = 4;
-  inline bool has_width() const;
-  inline void clear_width();
-  static const int kWidthFieldNumber = 4;
-  inline ::google::protobuf::uint32 width() const;
-  inline void set_width(::google::protobuf::uint32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.MemoryDataParameter)
- private:
-  inline void set_has_batch_size();
-  inline void clear_has_batch_size();
-  inline void set_has_channels();
-  inline void clear_has_channels();
-  inline void set_has_height();
-  inline void clear_has_height();
-  inline void set_has_width();
-  inline void clear_has_width();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 batch_size_;
-  ::google::protobuf::uint32 channels_;
-  ::google::protobuf::uint32 height_;
-  ::google::protobuf::uint32 width_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static MemoryDataParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class MVNParameter : public ::google::protobuf::Message {
- public:
-  MVNParameter();
-  virtual ~MVNParameter();
-
-  MVNParameter(const MVNParameter& from);
-
-  inline MVNParameter& operator=(const MVNParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MVNParameter& default_instance();
-
-  void Swap(MVNParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  MVNParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const MVNParameter& from);
-  void MergeFrom(const MVNParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional bool normalize_variance = 1 [default = true];
-  inline bool has_normalize_variance() const;
-  inline void clear_normalize_variance();
-  static const int kNormalizeVarianceFieldNumber = 1;
-  inline bool normalize_variance() const;
-  inline void set_normalize_variance(bool value);
-
-  // optional bool across_channels = 2 [default = false];
-  inline bool has_across_channels() const;
-  inline void clear_across_channels();
-  static const int kAcrossChannelsFieldNumber = 2;
-  inline bool across_channels() const;
-  inline void set_across_channels(bool value);
-
-  // optional float eps = 3 [default = 1e-09];
-  inline bool has_eps() const;
-  inline void clear_eps();
-  static const int kEpsFieldNumber = 3;
-  inline float eps() const;
-  inline void set_eps(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.MVNParameter)
- private:
-  inline void set_has_normalize_variance();
-  inline void clear_has_normalize_variance();
-  inline void set_has_across_channels();
-  inline void clear_has_across_channels();
-  inline void set_has_eps();
-  inline void clear_has_eps();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  bool normalize_variance_;
-  bool across_channels_;
-  float eps_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static MVNParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ParameterParameter : public ::google::protobuf::Message {
- public:
-  ParameterParameter();
-  virtual ~ParameterParameter();
-
-  ParameterParameter(const ParameterParameter& from);
-
-  inline ParameterParameter& operator=(const ParameterParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ParameterParameter& default_instance();
-
-  void Swap(ParameterParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ParameterParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ParameterParameter& from);
-  void MergeFrom(const ParameterParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.BlobShape shape = 1;
-  inline bool has_shape() const;
-  inline void clear_shape();
-  static const int kShapeFieldNumber = 1;
-  inline const ::caffe::BlobShape& shape() const;
-  inline ::caffe::BlobShape* mutable_shape();
-  inline ::caffe::BlobShape* release_shape();
-  inline void set_allocated_shape(::caffe::BlobShape* shape);
-
-  // @@protoc_insertion_point(class_scope:caffe.ParameterParameter)
- private:
-  inline void set_has_shape();
-  inline void clear_has_shape();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::caffe::BlobShape* shape_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ParameterParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class PoolingParameter : public ::google::protobuf::Message {
- public:
-  PoolingParameter();
-  virtual ~PoolingParameter();
-
-  PoolingParameter(const PoolingParameter& from);
-
-  inline PoolingParameter& operator=(const PoolingParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PoolingParameter& default_instance();
-
-  void Swap(PoolingParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  PoolingParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PoolingParameter& from);
-  void MergeFrom(const PoolingParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef PoolingParameter_PoolMethod PoolMethod;
-  static const PoolMethod MAX = PoolingParameter_PoolMethod_MAX;
-  static const PoolMethod AVE = PoolingParameter_PoolMethod_AVE;
-  static const PoolMethod STOCHASTIC = PoolingParameter_PoolMethod_STOCHASTIC;
-  static inline bool PoolMethod_IsValid(int value) {
-    return PoolingParameter_PoolMethod_IsValid(value);
-  }
-  static const PoolMethod PoolMethod_MIN =
-    PoolingParameter_PoolMethod_PoolMethod_MIN;
-  static const PoolMethod PoolMethod_MAX =
-    PoolingParameter_PoolMethod_PoolMethod_MAX;
-  static const int PoolMethod_ARRAYSIZE =
-    PoolingParameter_PoolMethod_PoolMethod_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  PoolMethod_descriptor() {
-    return PoolingParameter_PoolMethod_descriptor();
-  }
-  static inline const ::std::string& PoolMethod_Name(PoolMethod value) {
-    return PoolingParameter_PoolMethod_Name(value);
-  }
-  static inline bool PoolMethod_Parse(const ::std::string& name,
-      PoolMethod* value) {
-    return PoolingParameter_PoolMethod_Parse(name, value);
-  }
-
-  typedef PoolingParameter_Engine Engine;
-  static const Engine DEFAULT = PoolingParameter_Engine_DEFAULT;
-  static const Engine CAFFE = PoolingParameter_Engine_CAFFE;
-  static const Engine CUDNN = PoolingParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return PoolingParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    PoolingParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    PoolingParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    PoolingParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return PoolingParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return PoolingParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return PoolingParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.PoolingParameter.PoolMethod pool = 1 [default = MAX];
-  inline bool has_pool() const;
-  inline void clear_pool();
-  static const int kPoolFieldNumber = 1;
-  inline ::caffe::PoolingParameter_PoolMethod pool() const;
-  inline void set_pool(::caffe::PoolingParameter_PoolMethod value);
-
-  // optional uint32 pad = 4 [default = 0];
-  inline bool has_pad() const;
-  inline void clear_pad();
-  static const int kPadFieldNumber = 4;
-  inline ::google::protobuf::uint32 pad() const;
-  inline void set_pad(::google::protobuf::uint32 value);
-
-  // optional uint32 pad_h = 9 [default = 0];
-  inline bool has_pad_h() const;
-  inline void clear_pad_h();
-  static const int kPadHFieldNumber = 9;
-  inline ::google::protobuf::uint32 pad_h() const;
-  inline void set_pad_h(::google::protobuf::uint32 value);
-
-  // optional uint32 pad_w = 10 [default = 0];
-  inline bool has_pad_w() const;
-  inline void clear_pad_w();
-  static const int kPadWFieldNumber = 10;
-  inline ::google::protobuf::uint32 pad_w() const;
-  inline void set_pad_w(::google::protobuf::uint32 value);
-
-  // optional uint32 kernel_size = 2;
-  inline bool has_kernel_size() const;
-  inline void clear_kernel_size();
-  static const int kKernelSizeFieldNumber = 2;
-  inline ::google::protobuf::uint32 kernel_size() const;
-  inline void set_kernel_size(::google::protobuf::uint32 value);
-
-  // optional uint32 kernel_h = 5;
-  inline bool has_kernel_h() const;
-  inline void clear_kernel_h();
-  static const int kKernelHFieldNumber = 5;
-  inline ::google::protobuf::uint32 kernel_h() const;
-  inline void set_kernel_h(::google::protobuf::uint32 value);
-
-  // optional uint32 kernel_w = 6;
-  inline bool has_kernel_w() const;
-  inline void clear_kernel_w();
-  static const int kKernelWFieldNumber = 6;
-  inline ::google::protobuf::uint32 kernel_w() const;
-  inline void set_kernel_w(::google::protobuf::uint32 value);
-
-  // optional uint32 stride = 3 [default = 1];
-  inline bool has_stride() const;
-  inline void clear_stride();
-  static const int kStrideFieldNumber = 3;
-  inline ::google::protobuf::uint32 stride() const;
-  inline void set_stride(::google::protobuf::uint32 value);
-
-  // optional uint32 stride_h = 7;
-  inline bool has_stride_h() const;
-  inline void clear_stride_h();
-  static const int kStrideHFieldNumber = 7;
-  inline ::google::protobuf::uint32 stride_h() const;
-  inline void set_stride_h(::google::protobuf::uint32 value);
-
-  // optional uint32 stride_w = 8;
-  inline bool has_stride_w() const;
-  inline void clear_stride_w();
-  static const int kStrideWFieldNumber = 8;
-  inline ::google::protobuf::uint32 stride_w() const;
-  inline void set_stride_w(::google::protobuf::uint32 value);
-
-  // optional .caffe.PoolingParameter.Engine engine = 11 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 11;
-  inline ::caffe::PoolingParameter_Engine engine() const;
-  inline void set_engine(::caffe::PoolingParameter_Engine value);
-
-  // optional bool global_pooling = 12 [default = false];
-  inline bool has_global_pooling() const;
-  inline void clear_global_pooling();
-  static const int kGlobalPoolingFieldNumber = 12;
-  inline bool global_pooling() const;
-  inline void set_global_pooling(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.PoolingParameter)
- private:
-  inline void set_has_pool();
-  inline void clear_has_pool();
-  inline void set_has_pad();
-  inline void clear_has_pad();
-  inline void set_has_pad_h();
-  inline void clear_has_pad_h();
-  inline void set_has_pad_w();
-  inline void clear_has_pad_w();
-  inline void set_has_kernel_size();
-  inline void clear_has_kernel_size();
-  inline void set_has_kernel_h();
-  inline void clear_has_kernel_h();
-  inline void set_has_kernel_w();
-  inline void clear_has_kernel_w();
-  inline void set_has_stride();
-  inline void clear_has_stride();
-  inline void set_has_stride_h();
-  inline void clear_has_stride_h();
-  inline void set_has_stride_w();
-  inline void clear_has_stride_w();
-  inline void set_has_engine();
-  inline void clear_has_engine();
-  inline void set_has_global_pooling();
-  inline void clear_has_global_pooling();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int pool_;
-  ::google::protobuf::uint32 pad_;
-  ::google::protobuf::uint32 pad_h_;
-  ::google::protobuf::uint32 pad_w_;
-  ::google::protobuf::uint32 kernel_size_;
-  ::google::protobuf::uint32 kernel_h_;
-  ::google::protobuf::uint32 kernel_w_;
-  ::google::protobuf::uint32 stride_;
-  ::google::protobuf::uint32 stride_h_;
-  ::google::protobuf::uint32 stride_w_;
-  int engine_;
-  bool global_pooling_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static PoolingParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class PowerParameter : public ::google::protobuf::Message {
- public:
-  PowerParameter();
-  virtual ~PowerParameter();
-
-  PowerParameter(const PowerParameter& from);
-
-  inline PowerParameter& operator=(const PowerParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PowerParameter& default_instance();
-
-  void Swap(PowerParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  PowerParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PowerParameter& from);
-  void MergeFrom(const PowerParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float power = 1 [default = 1];
-  inline bool has_power() const;
-  inline void clear_power();
-  static const int kPowerFieldNumber = 1;
-  inline float power() const;
-  inline void set_power(float value);
-
-  // optional float scale = 2 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 2;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional float shift = 3 [default = 0];
-  inline bool has_shift() const;
-  inline void clear_shift();
-  static const int kShiftFieldNumber = 3;
-  inline float shift() const;
-  inline void set_shift(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.PowerParameter)
- private:
-  inline void set_has_power();
-  inline void clear_has_power();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_shift();
-  inline void clear_has_shift();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float power_;
-  float scale_;
-  float shift_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static PowerParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class PythonParameter : public ::google::protobuf::Message {
- public:
-  PythonParameter();
-  virtual ~PythonParameter();
-
-  PythonParameter(const PythonParameter& from);
-
-  inline PythonParameter& operator=(const PythonParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PythonParameter& default_instance();
-
-  void Swap(PythonParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  PythonParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PythonParameter& from);
-  void MergeFrom(const PythonParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string module = 1;
-  inline bool has_module() const;
-  inline void clear_module();
-  static const int kModuleFieldNumber = 1;
-  inline const ::std::string& module() const;
-  inline void set_module(const ::std::string& value);
-  inline void set_module(const char* value);
-  inline void set_module(const char* value, size_t size);
-  inline ::std::string* mutable_module();
-  inline ::std::string* release_module();
-  inline void set_allocated_module(::std::string* module);
-
-  // optional string layer = 2;
-  inline bool has_layer() const;
-  inline void clear_layer();
-  static const int kLayerFieldNumber = 2;
-  inline const ::std::string& layer() const;
-  inline void set_layer(const ::std::string& value);
-  inline void set_layer(const char* value);
-  inline void set_layer(const char* value, size_t size);
-  inline ::std::string* mutable_layer();
-  inline ::std::string* release_layer();
-  inline void set_allocated_layer(::std::string* layer);
-
-  // optional string param_str = 3 [default = ""];
-  inline bool has_param_str() const;
-  inline void clear_param_str();
-  static const int kParamStrFieldNumber = 3;
-  inline const ::std::string& param_str() const;
-  inline void set_param_str(const ::std::string& value);
-  inline void set_param_str(const char* value);
-  inline void set_param_str(const char* value, size_t size);
-  inline ::std::string* mutable_param_str();
-  inline ::std::string* release_param_str();
-  inline void set_allocated_param_str(::std::string* param_str);
-
-  // optional bool share_in_parallel = 4 [default = false];
-  inline bool has_share_in_parallel() const;
-  inline void clear_share_in_parallel();
-  static const int kShareInParallelFieldNumber = 4;
-  inline bool share_in_parallel() const;
-  inline void set_share_in_parallel(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.PythonParameter)
- private:
-  inline void set_has_module();
-  inline void clear_has_module();
-  inline void set_has_layer();
-  inline void clear_has_layer();
-  inline void set_has_param_str();
-  inline void clear_has_param_str();
-  inline void set_has_share_in_parallel();
-  inline void clear_has_share_in_parallel();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* module_;
-  ::std::string* layer_;
-  ::std::string* param_str_;
-  bool share_in_parallel_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static PythonParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class RecurrentParameter : public ::google::protobuf::Message {
- public:
-  RecurrentParameter();
-  virtual ~RecurrentParameter();
-
-  RecurrentParameter(const RecurrentParameter& from);
-
-  inline RecurrentParameter& operator=(const RecurrentParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RecurrentParameter& default_instance();
-
-  void Swap(RecurrentParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  RecurrentParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const RecurrentParameter& from);
-  void MergeFrom(const RecurrentParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 num_output = 1 [default = 0];
-  inline bool has_num_output() const;
-  inline void clear_num_output();
-  static const int kNumOutputFieldNumber = 1;
-  inline ::google::protobuf::uint32 num_output() const;
-  inline void set_num_output(::google::protobuf::uint32 value);
-
-  // optional .caffe.FillerParameter weight_filler = 2;
-  inline bool has_weight_filler() const;
-  inline void clear_weight_filler();
-  static const int kWeightFillerFieldNumber = 2;
-  inline const ::caffe::FillerParameter& weight_filler() const;
-  inline ::caffe::FillerParameter* mutable_weight_filler();
-  inline ::caffe::FillerParameter* release_weight_filler();
-  inline void set_allocated_weight_filler(::caffe::FillerParameter* weight_filler);
-
-  // optional .caffe.FillerParameter bias_filler = 3;
-  inline bool has_bias_filler() const;
-  inline void clear_bias_filler();
-  static const int kBiasFillerFieldNumber = 3;
-  inline const ::caffe::FillerParameter& bias_filler() const;
-  inline ::caffe::FillerParameter* mutable_bias_filler();
-  inline ::caffe::FillerParameter* release_bias_filler();
-  inline void set_allocated_bias_filler(::caffe::FillerParameter* bias_filler);
-
-  // optional bool debug_info = 4 [default = false];
-  inline bool has_debug_info() const;
-  inline void clear_debug_info();
-  static const int kDebugInfoFieldNumber = 4;
-  inline bool debug_info() const;
-  inline void set_debug_info(bool value);
-
-  // optional bool expose_hidden = 5 [default = false];
-  inline bool has_expose_hidden() const;
-  inline void clear_expose_hidden();
-  static const int kExposeHiddenFieldNumber = 5;
-  inline bool expose_hidden() const;
-  inline void set_expose_hidden(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.RecurrentParameter)
- private:
-  inline void set_has_num_output();
-  inline void clear_has_num_output();
-  inline void set_has_weight_filler();
-  inline void clear_has_weight_filler();
-  inline void set_has_bias_filler();
-  inline void clear_has_bias_filler();
-  inline void set_has_debug_info();
-  inline void clear_has_debug_info();
-  inline void set_has_expose_hidden();
-  inline void clear_has_expose_hidden();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::caffe::FillerParameter* weight_filler_;
-  ::caffe::FillerParameter* bias_filler_;
-  ::google::protobuf::uint32 num_output_;
-  bool debug_info_;
-  bool expose_hidden_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static RecurrentParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ReductionParameter : public ::google::protobuf::Message {
- public:
-  ReductionParameter();
-  virtual ~ReductionParameter();
-
-  ReductionParameter(const ReductionParameter& from);
-
-  inline ReductionParameter& operator=(const ReductionParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ReductionParameter& default_instance();
-
-  void Swap(ReductionParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ReductionParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReductionParameter& from);
-  void MergeFrom(const ReductionParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef ReductionParameter_ReductionOp ReductionOp;
-  static const ReductionOp SUM = ReductionParameter_ReductionOp_SUM;
-  static const ReductionOp ASUM = ReductionParameter_ReductionOp_ASUM;
-  static const ReductionOp SUMSQ = ReductionParameter_ReductionOp_SUMSQ;
-  static const ReductionOp MEAN = ReductionParameter_ReductionOp_MEAN;
-  static inline bool ReductionOp_IsValid(int value) {
-    return ReductionParameter_ReductionOp_IsValid(value);
-  }
-  static const ReductionOp ReductionOp_MIN =
-    ReductionParameter_ReductionOp_ReductionOp_MIN;
-  static const ReductionOp ReductionOp_MAX =
-    ReductionParameter_ReductionOp_ReductionOp_MAX;
-  static const int ReductionOp_ARRAYSIZE =
-    ReductionParameter_ReductionOp_ReductionOp_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  ReductionOp_descriptor() {
-    return ReductionParameter_ReductionOp_descriptor();
-  }
-  static inline const ::std::string& ReductionOp_Name(ReductionOp value) {
-    return ReductionParameter_ReductionOp_Name(value);
-  }
-  static inline bool ReductionOp_Parse(const ::std::string& name,
-      ReductionOp* value) {
-    return ReductionParameter_ReductionOp_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.ReductionParameter.ReductionOp operation = 1 [default = SUM];
-  inline bool has_operation() const;
-  inline void clear_operation();
-  static const int kOperationFieldNumber = 1;
-  inline ::caffe::ReductionParameter_ReductionOp operation() const;
-  inline void set_operation(::caffe::ReductionParameter_ReductionOp value);
-
-  // optional int32 axis = 2 [default = 0];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 2;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional float coeff = 3 [default = 1];
-  inline bool has_coeff() const;
-  inline void clear_coeff();
-  static const int kCoeffFieldNumber = 3;
-  inline float coeff() const;
-  inline void set_coeff(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ReductionParameter)
- private:
-  inline void set_has_operation();
-  inline void clear_has_operation();
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_coeff();
-  inline void clear_has_coeff();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int operation_;
-  ::google::protobuf::int32 axis_;
-  float coeff_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ReductionParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ReLUParameter : public ::google::protobuf::Message {
- public:
-  ReLUParameter();
-  virtual ~ReLUParameter();
-
-  ReLUParameter(const ReLUParameter& from);
-
-  inline ReLUParameter& operator=(const ReLUParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ReLUParameter& default_instance();
-
-  void Swap(ReLUParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ReLUParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReLUParameter& from);
-  void MergeFrom(const ReLUParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef ReLUParameter_Engine Engine;
-  static const Engine DEFAULT = ReLUParameter_Engine_DEFAULT;
-  static const Engine CAFFE = ReLUParameter_Engine_CAFFE;
-  static const Engine CUDNN = ReLUParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return ReLUParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    ReLUParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    ReLUParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    ReLUParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return ReLUParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return ReLUParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return ReLUParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional float negative_slope = 1 [default = 0];
-  inline bool has_negative_slope() const;
-  inline void clear_negative_slope();
-  static const int kNegativeSlopeFieldNumber = 1;
-  inline float negative_slope() const;
-  inline void set_negative_slope(float value);
-
-  // optional .caffe.ReLUParameter.Engine engine = 2 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 2;
-  inline ::caffe::ReLUParameter_Engine engine() const;
-  inline void set_engine(::caffe::ReLUParameter_Engine value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ReLUParameter)
- private:
-  inline void set_has_negative_slope();
-  inline void clear_has_negative_slope();
-  inline void set_has_engine();
-  inline void clear_has_engine();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float negative_slope_;
-  int engine_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ReLUParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ReshapeParameter : public ::google::protobuf::Message {
- public:
-  ReshapeParameter();
-  virtual ~ReshapeParameter();
-
-  ReshapeParameter(const ReshapeParameter& from);
-
-  inline ReshapeParameter& operator=(const ReshapeParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ReshapeParameter& default_instance();
-
-  void Swap(ReshapeParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ReshapeParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ReshapeParameter& from);
-  void MergeFrom(const ReshapeParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.BlobShape shape = 1;
-  inline bool has_shape() const;
-  inline void clear_shape();
-  static const int kShapeFieldNumber = 1;
-  inline const ::caffe::BlobShape& shape() const;
-  inline ::caffe::BlobShape* mutable_shape();
-  inline ::caffe::BlobShape* release_shape();
-  inline void set_allocated_shape(::caffe::BlobShape* shape);
-
-  // optional int32 axis = 2 [default = 0];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 2;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional int32 num_axes = 3 [default = -1];
-  inline bool has_num_axes() const;
-  inline void clear_num_axes();
-  static const int kNumAxesFieldNumber = 3;
-  inline ::google::protobuf::int32 num_axes() const;
-  inline void set_num_axes(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ReshapeParameter)
- private:
-  inline void set_has_shape();
-  inline void clear_has_shape();
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_num_axes();
-  inline void clear_has_num_axes();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::caffe::BlobShape* shape_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::int32 num_axes_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ReshapeParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ScaleParameter : public ::google::protobuf::Message {
- public:
-  ScaleParameter();
-  virtual ~ScaleParameter();
-
-  ScaleParameter(const ScaleParameter& from);
-
-  inline ScaleParameter& operator=(const ScaleParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ScaleParameter& default_instance();
-
-  void Swap(ScaleParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ScaleParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ScaleParameter& from);
-  void MergeFrom(const ScaleParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 axis = 1 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 1;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional int32 num_axes = 2 [default = 1];
-  inline bool has_num_axes() const;
-  inline void clear_num_axes();
-  static const int kNumAxesFieldNumber = 2;
-  inline ::google::protobuf::int32 num_axes() const;
-  inline void set_num_axes(::google::protobuf::int32 value);
-
-  // optional .caffe.FillerParameter filler = 3;
-  inline bool has_filler() const;
-  inline void clear_filler();
-  static const int kFillerFieldNumber = 3;
-  inline const ::caffe::FillerParameter& filler() const;
-  inline ::caffe::FillerParameter* mutable_filler();
-  inline ::caffe::FillerParameter* release_filler();
-  inline void set_allocated_filler(::caffe::FillerParameter* filler);
-
-  // optional bool bias_term = 4 [default = false];
-  inline bool has_bias_term() const;
-  inline void clear_bias_term();
-  static const int kBiasTermFieldNumber = 4;
-  inline bool bias_term() const;
-  inline void set_bias_term(bool value);
-
-  // optional .caffe.FillerParameter bias_filler = 5;
-  inline bool has_bias_filler() const;
-  inline void clear_bias_filler();
-  static const int kBiasFillerFieldNumber = 5;
-  inline const ::caffe::FillerParameter& bias_filler() const;
-  inline ::caffe::FillerParameter* mutable_bias_filler();
-  inline ::caffe::FillerParameter* release_bias_filler();
-  inline void set_allocated_bias_filler(::caffe::FillerParameter* bias_filler);
-
-  // @@protoc_insertion_point(class_scope:caffe.ScaleParameter)
- private:
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_num_axes();
-  inline void clear_has_num_axes();
-  inline void set_has_filler();
-  inline void clear_has_filler();
-  inline void set_has_bias_term();
-  inline void clear_has_bias_term();
-  inline void set_has_bias_filler();
-  inline void clear_has_bias_filler();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::int32 num_axes_;
-  ::caffe::FillerParameter* filler_;
-  ::caffe::FillerParameter* bias_filler_;
-  bool bias_term_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ScaleParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class SigmoidParameter : public ::google::protobuf::Message {
- public:
-  SigmoidParameter();
-  virtual ~SigmoidParameter();
-
-  SigmoidParameter(const SigmoidParameter& from);
-
-  inline SigmoidParameter& operator=(const SigmoidParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SigmoidParameter& default_instance();
-
-  void Swap(SigmoidParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  SigmoidParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SigmoidParameter& from);
-  void MergeFrom(const SigmoidParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef SigmoidParameter_Engine Engine;
-  static const Engine DEFAULT = SigmoidParameter_Engine_DEFAULT;
-  static const Engine CAFFE = SigmoidParameter_Engine_CAFFE;
-  static const Engine CUDNN = SigmoidParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return SigmoidParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    SigmoidParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    SigmoidParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    SigmoidParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return SigmoidParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return SigmoidParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return SigmoidParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 1;
-  inline ::caffe::SigmoidParameter_Engine engine() const;
-  inline void set_engine(::caffe::SigmoidParameter_Engine value);
-
-  // @@protoc_insertion_point(class_scope:caffe.SigmoidParameter)
- private:
-  inline void set_has_engine();
-  inline void clear_has_engine();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int engine_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static SigmoidParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class SliceParameter : public ::google::protobuf::Message {
- public:
-  SliceParameter();
-  virtual ~SliceParameter();
-
-  SliceParameter(const SliceParameter& from);
-
-  inline SliceParameter& operator=(const SliceParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SliceParameter& default_instance();
-
-  void Swap(SliceParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  SliceParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SliceParameter& from);
-  void MergeFrom(const SliceParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 axis = 3 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 3;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // repeated uint32 slice_point = 2;
-  inline int slice_point_size() const;
-  inline void clear_slice_point();
-  static const int kSlicePointFieldNumber = 2;
-  inline ::google::protobuf::uint32 slice_point(int index) const;
-  inline void set_slice_point(int index, ::google::protobuf::uint32 value);
-  inline void add_slice_point(::google::protobuf::uint32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      slice_point() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_slice_point();
-
-  // optional uint32 slice_dim = 1 [default = 1];
-  inline bool has_slice_dim() const;
-  inline void clear_slice_dim();
-  static const int kSliceDimFieldNumber = 1;
-  inline ::google::protobuf::uint32 slice_dim() const;
-  inline void set_slice_dim(::google::protobuf::uint32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.SliceParameter)
- private:
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_slice_dim();
-  inline void clear_has_slice_dim();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > slice_point_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::uint32 slice_dim_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static SliceParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class SoftmaxParameter : public ::google::protobuf::Message {
- public:
-  SoftmaxParameter();
-  virtual ~SoftmaxParameter();
-
-  SoftmaxParameter(const SoftmaxParameter& from);
-
-  inline SoftmaxParameter& operator=(const SoftmaxParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SoftmaxParameter& default_instance();
-
-  void Swap(SoftmaxParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  SoftmaxParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SoftmaxParameter& from);
-  void MergeFrom(const SoftmaxParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef SoftmaxParameter_Engine Engine;
-  static const Engine DEFAULT = SoftmaxParameter_Engine_DEFAULT;
-  static const Engine CAFFE = SoftmaxParameter_Engine_CAFFE;
-  static const Engine CUDNN = SoftmaxParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return SoftmaxParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    SoftmaxParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    SoftmaxParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    SoftmaxParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return SoftmaxParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return SoftmaxParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return SoftmaxParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.SoftmaxParameter.Engine engine = 1 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 1;
-  inline ::caffe::SoftmaxParameter_Engine engine() const;
-  inline void set_engine(::caffe::SoftmaxParameter_Engine value);
-
-  // optional int32 axis = 2 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 2;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.SoftmaxParameter)
- private:
-  inline void set_has_engine();
-  inline void clear_has_engine();
-  inline void set_has_axis();
-  inline void clear_has_axis();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int engine_;
-  ::google::protobuf::int32 axis_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static SoftmaxParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class TanHParameter : public ::google::protobuf::Message {
- public:
-  TanHParameter();
-  virtual ~TanHParameter();
-
-  TanHParameter(const TanHParameter& from);
-
-  inline TanHParameter& operator=(const TanHParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TanHParameter& default_instance();
-
-  void Swap(TanHParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  TanHParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const TanHParameter& from);
-  void MergeFrom(const TanHParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef TanHParameter_Engine Engine;
-  static const Engine DEFAULT = TanHParameter_Engine_DEFAULT;
-  static const Engine CAFFE = TanHParameter_Engine_CAFFE;
-  static const Engine CUDNN = TanHParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return TanHParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    TanHParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    TanHParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    TanHParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return TanHParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return TanHParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return TanHParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.TanHParameter.Engine engine = 1 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 1;
-  inline ::caffe::TanHParameter_Engine engine() const;
-  inline void set_engine(::caffe::TanHParameter_Engine value);
-
-  // @@protoc_insertion_point(class_scope:caffe.TanHParameter)
- private:
-  inline void set_has_engine();
-  inline void clear_has_engine();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int engine_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static TanHParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class TileParameter : public ::google::protobuf::Message {
- public:
-  TileParameter();
-  virtual ~TileParameter();
-
-  TileParameter(const TileParameter& from);
-
-  inline TileParameter& operator=(const TileParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TileParameter& default_instance();
-
-  void Swap(TileParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  TileParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const TileParameter& from);
-  void MergeFrom(const TileParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional int32 axis = 1 [default = 1];
-  inline bool has_axis() const;
-  inline void clear_axis();
-  static const int kAxisFieldNumber = 1;
-  inline ::google::protobuf::int32 axis() const;
-  inline void set_axis(::google::protobuf::int32 value);
-
-  // optional int32 tiles = 2;
-  inline bool has_tiles() const;
-  inline void clear_tiles();
-  static const int kTilesFieldNumber = 2;
-  inline ::google::protobuf::int32 tiles() const;
-  inline void set_tiles(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:caffe.TileParameter)
- private:
-  inline void set_has_axis();
-  inline void clear_has_axis();
-  inline void set_has_tiles();
-  inline void clear_has_tiles();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 axis_;
-  ::google::protobuf::int32 tiles_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static TileParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class ThresholdParameter : public ::google::protobuf::Message {
- public:
-  ThresholdParameter();
-  virtual ~ThresholdParameter();
-
-  ThresholdParameter(const ThresholdParameter& from);
-
-  inline ThresholdParameter& operator=(const ThresholdParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ThresholdParameter& default_instance();
-
-  void Swap(ThresholdParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  ThresholdParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ThresholdParameter& from);
-  void MergeFrom(const ThresholdParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional float threshold = 1 [default = 0];
-  inline bool has_threshold() const;
-  inline void clear_threshold();
-  static const int kThresholdFieldNumber = 1;
-  inline float threshold() const;
-  inline void set_threshold(float value);
-
-  // @@protoc_insertion_point(class_scope:caffe.ThresholdParameter)
- private:
-  inline void set_has_threshold();
-  inline void clear_has_threshold();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  float threshold_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static ThresholdParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class WindowDataParameter : public ::google::protobuf::Message {
- public:
-  WindowDataParameter();
-  virtual ~WindowDataParameter();
-
-  WindowDataParameter(const WindowDataParameter& from);
-
-  inline WindowDataParameter& operator=(const WindowDataParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const WindowDataParameter& default_instance();
-
-  void Swap(WindowDataParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  WindowDataParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const WindowDataParameter& from);
-  void MergeFrom(const WindowDataParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional string source = 1;
-  inline bool has_source() const;
-  inline void clear_source();
-  static const int kSourceFieldNumber = 1;
-  inline const ::std::string& source() const;
-  inline void set_source(const ::std::string& value);
-  inline void set_source(const char* value);
-  inline void set_source(const char* value, size_t size);
-  inline ::std::string* mutable_source();
-  inline ::std::string* release_source();
-  inline void set_allocated_source(::std::string* source);
-
-  // optional float scale = 2 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 2;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional string mean_file = 3;
-  inline bool has_mean_file() const;
-  inline void clear_mean_file();
-  static const int kMeanFileFieldNumber = 3;
-  inline const ::std::string& mean_file() const;
-  inline void set_mean_file(const ::std::string& value);
-  inline void set_mean_file(const char* value);
-  inline void set_mean_file(const char* value, size_t size);
-  inline ::std::string* mutable_mean_file();
-  inline ::std::string* release_mean_file();
-  inline void set_allocated_mean_file(::std::string* mean_file);
-
-  // optional uint32 batch_size = 4;
-  inline bool has_batch_size() const;
-  inline void clear_batch_size();
-  static const int kBatchSizeFieldNumber = 4;
-  inline ::google::protobuf::uint32 batch_size() const;
-  inline void set_batch_size(::google::protobuf::uint32 value);
-
-  // optional uint32 crop_size = 5 [default = 0];
-  inline bool has_crop_size() const;
-  inline void clear_crop_size();
-  static const int kCropSizeFieldNumber = 5;
-  inline ::google::protobuf::uint32 crop_size() const;
-  inline void set_crop_size(::google::protobuf::uint32 value);
-
-  // optional bool mirror = 6 [default = false];
-  inline bool has_mirror() const;
-  inline void clear_mirror();
-  static const int kMirrorFieldNumber = 6;
-  inline bool mirror() const;
-  inline void set_mirror(bool value);
-
-  // optional float fg_threshold = 7 [default = 0.5];
-  inline bool has_fg_threshold() const;
-  inline void clear_fg_threshold();
-  static const int kFgThresholdFieldNumber = 7;
-  inline float fg_threshold() const;
-  inline void set_fg_threshold(float value);
-
-  // optional float bg_threshold = 8 [default = 0.5];
-  inline bool has_bg_threshold() const;
-  inline void clear_bg_threshold();
-  static const int kBgThresholdFieldNumber = 8;
-  inline float bg_threshold() const;
-  inline void set_bg_threshold(float value);
-
-  // optional float fg_fraction = 9 [default = 0.25];
-  inline bool has_fg_fraction() const;
-  inline void clear_fg_fraction();
-  static const int kFgFractionFieldNumber = 9;
-  inline float fg_fraction() const;
-  inline void set_fg_fraction(float value);
-
-  // optional uint32 context_pad = 10 [default = 0];
-  inline bool has_context_pad() const;
-  inline void clear_context_pad();
-  static const int kContextPadFieldNumber = 10;
-  inline ::google::protobuf::uint32 context_pad() const;
-  inline void set_context_pad(::google::protobuf::uint32 value);
-
-  // optional string crop_mode = 11 [default = "warp"];
-  inline bool has_crop_mode() const;
-  inline void clear_crop_mode();
-  static const int kCropModeFieldNumber = 11;
-  inline const ::std::string& crop_mode() const;
-  inline void set_crop_mode(const ::std::string& value);
-  inline void set_crop_mode(const char* value);
-  inline void set_crop_mode(const char* value, size_t size);
-  inline ::std::string* mutable_crop_mode();
-  inline ::std::string* release_crop_mode();
-  inline void set_allocated_crop_mode(::std::string* crop_mode);
-
-  // optional bool cache_images = 12 [default = false];
-  inline bool has_cache_images() const;
-  inline void clear_cache_images();
-  static const int kCacheImagesFieldNumber = 12;
-  inline bool cache_images() const;
-  inline void set_cache_images(bool value);
-
-  // optional string root_folder = 13 [default = ""];
-  inline bool has_root_folder() const;
-  inline void clear_root_folder();
-  static const int kRootFolderFieldNumber = 13;
-  inline const ::std::string& root_folder() const;
-  inline void set_root_folder(const ::std::string& value);
-  inline void set_root_folder(const char* value);
-  inline void set_root_folder(const char* value, size_t size);
-  inline ::std::string* mutable_root_folder();
-  inline ::std::string* release_root_folder();
-  inline void set_allocated_root_folder(::std::string* root_folder);
-
-  // @@protoc_insertion_point(class_scope:caffe.WindowDataParameter)
- private:
-  inline void set_has_source();
-  inline void clear_has_source();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_mean_file();
-  inline void clear_has_mean_file();
-  inline void set_has_batch_size();
-  inline void clear_has_batch_size();
-  inline void set_has_crop_size();
-  inline void clear_has_crop_size();
-  inline void set_has_mirror();
-  inline void clear_has_mirror();
-  inline void set_has_fg_threshold();
-  inline void clear_has_fg_threshold();
-  inline void set_has_bg_threshold();
-  inline void clear_has_bg_threshold();
-  inline void set_has_fg_fraction();
-  inline void clear_has_fg_fraction();
-  inline void set_has_context_pad();
-  inline void clear_has_context_pad();
-  inline void set_has_crop_mode();
-  inline void clear_has_crop_mode();
-  inline void set_has_cache_images();
-  inline void clear_has_cache_images();
-  inline void set_has_root_folder();
-  inline void clear_has_root_folder();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::std::string* source_;
-  ::std::string* mean_file_;
-  float scale_;
-  ::google::protobuf::uint32 batch_size_;
-  ::google::protobuf::uint32 crop_size_;
-  float fg_threshold_;
-  float bg_threshold_;
-  float fg_fraction_;
-  bool mirror_;
-  bool cache_images_;
-  ::google::protobuf::uint32 context_pad_;
-  static ::std::string* _default_crop_mode_;
-  ::std::string* crop_mode_;
-  ::std::string* root_folder_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static WindowDataParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class SPPParameter : public ::google::protobuf::Message {
- public:
-  SPPParameter();
-  virtual ~SPPParameter();
-
-  SPPParameter(const SPPParameter& from);
-
-  inline SPPParameter& operator=(const SPPParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SPPParameter& default_instance();
-
-  void Swap(SPPParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  SPPParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SPPParameter& from);
-  void MergeFrom(const SPPParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef SPPParameter_PoolMethod PoolMethod;
-  static const PoolMethod MAX = SPPParameter_PoolMethod_MAX;
-  static const PoolMethod AVE = SPPParameter_PoolMethod_AVE;
-  static const PoolMethod STOCHASTIC = SPPParameter_PoolMethod_STOCHASTIC;
-  static inline bool PoolMethod_IsValid(int value) {
-    return SPPParameter_PoolMethod_IsValid(value);
-  }
-  static const PoolMethod PoolMethod_MIN =
-    SPPParameter_PoolMethod_PoolMethod_MIN;
-  static const PoolMethod PoolMethod_MAX =
-    SPPParameter_PoolMethod_PoolMethod_MAX;
-  static const int PoolMethod_ARRAYSIZE =
-    SPPParameter_PoolMethod_PoolMethod_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  PoolMethod_descriptor() {
-    return SPPParameter_PoolMethod_descriptor();
-  }
-  static inline const ::std::string& PoolMethod_Name(PoolMethod value) {
-    return SPPParameter_PoolMethod_Name(value);
-  }
-  static inline bool PoolMethod_Parse(const ::std::string& name,
-      PoolMethod* value) {
-    return SPPParameter_PoolMethod_Parse(name, value);
-  }
-
-  typedef SPPParameter_Engine Engine;
-  static const Engine DEFAULT = SPPParameter_Engine_DEFAULT;
-  static const Engine CAFFE = SPPParameter_Engine_CAFFE;
-  static const Engine CUDNN = SPPParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return SPPParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    SPPParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    SPPParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    SPPParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return SPPParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return SPPParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return SPPParameter_Engine_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional uint32 pyramid_height = 1;
-  inline bool has_pyramid_height() const;
-  inline void clear_pyramid_height();
-  static const int kPyramidHeightFieldNumber = 1;
-  inline ::google::protobuf::uint32 pyramid_height() const;
-  inline void set_pyramid_height(::google::protobuf::uint32 value);
-
-  // optional .caffe.SPPParameter.PoolMethod pool = 2 [default = MAX];
-  inline bool has_pool() const;
-  inline void clear_pool();
-  static const int kPoolFieldNumber = 2;
-  inline ::caffe::SPPParameter_PoolMethod pool() const;
-  inline void set_pool(::caffe::SPPParameter_PoolMethod value);
-
-  // optional .caffe.SPPParameter.Engine engine = 6 [default = DEFAULT];
-  inline bool has_engine() const;
-  inline void clear_engine();
-  static const int kEngineFieldNumber = 6;
-  inline ::caffe::SPPParameter_Engine engine() const;
-  inline void set_engine(::caffe::SPPParameter_Engine value);
-
-  // @@protoc_insertion_point(class_scope:caffe.SPPParameter)
- private:
-  inline void set_has_pyramid_height();
-  inline void clear_has_pyramid_height();
-  inline void set_has_pool();
-  inline void clear_has_pool();
-  inline void set_has_engine();
-  inline void clear_has_engine();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 pyramid_height_;
-  int pool_;
-  int engine_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static SPPParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class V1LayerParameter : public ::google::protobuf::Message {
- public:
-  V1LayerParameter();
-  virtual ~V1LayerParameter();
-
-  V1LayerParameter(const V1LayerParameter& from);
-
-  inline V1LayerParameter& operator=(const V1LayerParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const V1LayerParameter& default_instance();
-
-  void Swap(V1LayerParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  V1LayerParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const V1LayerParameter& from);
-  void MergeFrom(const V1LayerParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef V1LayerParameter_LayerType LayerType;
-  static const LayerType NONE = V1LayerParameter_LayerType_NONE;
-  static const LayerType ABSVAL = V1LayerParameter_LayerType_ABSVAL;
-  static const LayerType ACCURACY = V1LayerParameter_LayerType_ACCURACY;
-  static const LayerType ARGMAX = V1LayerParameter_LayerType_ARGMAX;
-  static const LayerType BNLL = V1LayerParameter_LayerType_BNLL;
-  static const LayerType CONCAT = V1LayerParameter_LayerType_CONCAT;
-  static const LayerType CONTRASTIVE_LOSS = V1LayerParameter_LayerType_CONTRASTIVE_LOSS;
-  static const LayerType CONVOLUTION = V1LayerParameter_LayerType_CONVOLUTION;
-  static const LayerType DATA = V1LayerParameter_LayerType_DATA;
-  static const LayerType DECONVOLUTION = V1LayerParameter_LayerType_DECONVOLUTION;
-  static const LayerType DROPOUT = V1LayerParameter_LayerType_DROPOUT;
-  static const LayerType DUMMY_DATA = V1LayerParameter_LayerType_DUMMY_DATA;
-  static const LayerType EUCLIDEAN_LOSS = V1LayerParameter_LayerType_EUCLIDEAN_LOSS;
-  static const LayerType ELTWISE = V1LayerParameter_LayerType_ELTWISE;
-  static const LayerType EXP = V1LayerParameter_LayerType_EXP;
-  static const LayerType FLATTEN = V1LayerParameter_LayerType_FLATTEN;
-  static const LayerType HDF5_DATA = V1LayerParameter_LayerType_HDF5_DATA;
-  static const LayerType HDF5_OUTPUT = V1LayerParameter_LayerType_HDF5_OUTPUT;
-  static const LayerType HINGE_LOSS = V1LayerParameter_LayerType_HINGE_LOSS;
-  static const LayerType IM2COL = V1LayerParameter_LayerType_IM2COL;
-  static const LayerType IMAGE_DATA = V1LayerParameter_LayerType_IMAGE_DATA;
-  static const LayerType INFOGAIN_LOSS = V1LayerParameter_LayerType_INFOGAIN_LOSS;
-  static const LayerType INNER_PRODUCT = V1LayerParameter_LayerType_INNER_PRODUCT;
-  static const LayerType LRN = V1LayerParameter_LayerType_LRN;
-  static const LayerType MEMORY_DATA = V1LayerParameter_LayerType_MEMORY_DATA;
-  static const LayerType MULTINOMIAL_LOGISTIC_LOSS = V1LayerParameter_LayerType_MULTINOMIAL_LOGISTIC_LOSS;
-  static const LayerType MVN = V1LayerParameter_LayerType_MVN;
-  static const LayerType POOLING = V1LayerParameter_LayerType_POOLING;
-  static const LayerType POWER = V1LayerParameter_LayerType_POWER;
-  static const LayerType RELU = V1LayerParameter_LayerType_RELU;
-  static const LayerType SIGMOID = V1LayerParameter_LayerType_SIGMOID;
-  static const LayerType SIGMOID_CROSS_ENTROPY_LOSS = V1LayerParameter_LayerType_SIGMOID_CROSS_ENTROPY_LOSS;
-  static const LayerType SILENCE = V1LayerParameter_LayerType_SILENCE;
-  static const LayerType SOFTMAX = V1LayerParameter_LayerType_SOFTMAX;
-  static const LayerType SOFTMAX_LOSS = V1LayerParameter_LayerType_SOFTMAX_LOSS;
-  static const LayerType SPLIT = V1LayerParameter_LayerType_SPLIT;
-  static const LayerType SLICE = V1LayerParameter_LayerType_SLICE;
-  static const LayerType TANH = V1LayerParameter_LayerType_TANH;
-  static const LayerType WINDOW_DATA = V1LayerParameter_LayerType_WINDOW_DATA;
-  static const LayerType THRESHOLD = V1LayerParameter_LayerType_THRESHOLD;
-  static inline bool LayerType_IsValid(int value) {
-    return V1LayerParameter_LayerType_IsValid(value);
-  }
-  static const LayerType LayerType_MIN =
-    V1LayerParameter_LayerType_LayerType_MIN;
-  static const LayerType LayerType_MAX =
-    V1LayerParameter_LayerType_LayerType_MAX;
-  static const int LayerType_ARRAYSIZE =
-    V1LayerParameter_LayerType_LayerType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  LayerType_descriptor() {
-    return V1LayerParameter_LayerType_descriptor();
-  }
-  static inline const ::std::string& LayerType_Name(LayerType value) {
-    return V1LayerParameter_LayerType_Name(value);
-  }
-  static inline bool LayerType_Parse(const ::std::string& name,
-      LayerType* value) {
-    return V1LayerParameter_LayerType_Parse(name, value);
-  }
-
-  typedef V1LayerParameter_DimCheckMode DimCheckMode;
-  static const DimCheckMode STRICT = V1LayerParameter_DimCheckMode_STRICT;
-  static const DimCheckMode PERMISSIVE = V1LayerParameter_DimCheckMode_PERMISSIVE;
-  static inline bool DimCheckMode_IsValid(int value) {
-    return V1LayerParameter_DimCheckMode_IsValid(value);
-  }
-  static const DimCheckMode DimCheckMode_MIN =
-    V1LayerParameter_DimCheckMode_DimCheckMode_MIN;
-  static const DimCheckMode DimCheckMode_MAX =
-    V1LayerParameter_DimCheckMode_DimCheckMode_MAX;
-  static const int DimCheckMode_ARRAYSIZE =
-    V1LayerParameter_DimCheckMode_DimCheckMode_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  DimCheckMode_descriptor() {
-    return V1LayerParameter_DimCheckMode_descriptor();
-  }
-  static inline const ::std::string& DimCheckMode_Name(DimCheckMode value) {
-    return V1LayerParameter_DimCheckMode_Name(value);
-  }
-  static inline bool DimCheckMode_Parse(const ::std::string& name,
-      DimCheckMode* value) {
-    return V1LayerParameter_DimCheckMode_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // repeated string bottom = 2;
-  inline int bottom_size() const;
-  inline void clear_bottom();
-  static const int kBottomFieldNumber = 2;
-  inline const ::std::string& bottom(int index) const;
-  inline ::std::string* mutable_bottom(int index);
-  inline void set_bottom(int index, const ::std::string& value);
-  inline void set_bottom(int index, const char* value);
-  inline void set_bottom(int index, const char* value, size_t size);
-  inline ::std::string* add_bottom();
-  inline void add_bottom(const ::std::string& value);
-  inline void add_bottom(const char* value);
-  inline void add_bottom(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& bottom() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_bottom();
-
-  // repeated string top = 3;
-  inline int top_size() const;
-  inline void clear_top();
-  static const int kTopFieldNumber = 3;
-  inline const ::std::string& top(int index) const;
-  inline ::std::string* mutable_top(int index);
-  inline void set_top(int index, const ::std::string& value);
-  inline void set_top(int index, const char* value);
-  inline void set_top(int index, const char* value, size_t size);
-  inline ::std::string* add_top();
-  inline void add_top(const ::std::string& value);
-  inline void add_top(const char* value);
-  inline void add_top(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& top() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_top();
-
-  // optional string name = 4;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 4;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
-  // repeated .caffe.NetStateRule include = 32;
-  inline int include_size() const;
-  inline void clear_include();
-  static const int kIncludeFieldNumber = 32;
-  inline const ::caffe::NetStateRule& include(int index) const;
-  inline ::caffe::NetStateRule* mutable_include(int index);
-  inline ::caffe::NetStateRule* add_include();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      include() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-      mutable_include();
-
-  // repeated .caffe.NetStateRule exclude = 33;
-  inline int exclude_size() const;
-  inline void clear_exclude();
-  static const int kExcludeFieldNumber = 33;
-  inline const ::caffe::NetStateRule& exclude(int index) const;
-  inline ::caffe::NetStateRule* mutable_exclude(int index);
-  inline ::caffe::NetStateRule* add_exclude();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      exclude() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-      mutable_exclude();
-
-  // optional .caffe.V1LayerParameter.LayerType type = 5;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 5;
-  inline ::caffe::V1LayerParameter_LayerType type() const;
-  inline void set_type(::caffe::V1LayerParameter_LayerType value);
-
-  // repeated .caffe.BlobProto blobs = 6;
-  inline int blobs_size() const;
-  inline void clear_blobs();
-  static const int kBlobsFieldNumber = 6;
-  inline const ::caffe::BlobProto& blobs(int index) const;
-  inline ::caffe::BlobProto* mutable_blobs(int index);
-  inline ::caffe::BlobProto* add_blobs();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-      mutable_blobs();
-
-  // repeated string param = 1001;
-  inline int param_size() const;
-  inline void clear_param();
-  static const int kParamFieldNumber = 1001;
-  inline const ::std::string& param(int index) const;
-  inline ::std::string* mutable_param(int index);
-  inline void set_param(int index, const ::std::string& value);
-  inline void set_param(int index, const char* value);
-  inline void set_param(int index, const char* value, size_t size);
-  inline ::std::string* add_param();
-  inline void add_param(const ::std::string& value);
-  inline void add_param(const char* value);
-  inline void add_param(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& param() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_param();
-
-  // repeated .caffe.V1LayerParameter.DimCheckMode blob_share_mode = 1002;
-  inline int blob_share_mode_size() const;
-  inline void clear_blob_share_mode();
-  static const int kBlobShareModeFieldNumber = 1002;
-  inline ::caffe::V1LayerParameter_DimCheckMode blob_share_mode(int index) const;
-  inline void set_blob_share_mode(int index, ::caffe::V1LayerParameter_DimCheckMode value);
-  inline void add_blob_share_mode(::caffe::V1LayerParameter_DimCheckMode value);
-  inline const ::google::protobuf::RepeatedField<int>& blob_share_mode() const;
-  inline ::google::protobuf::RepeatedField<int>* mutable_blob_share_mode();
-
-  // repeated float blobs_lr = 7;
-  inline int blobs_lr_size() const;
-  inline void clear_blobs_lr();
-  static const int kBlobsLrFieldNumber = 7;
-  inline float blobs_lr(int index) const;
-  inline void set_blobs_lr(int index, float value);
-  inline void add_blobs_lr(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      blobs_lr() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_blobs_lr();
-
-  // repeated float weight_decay = 8;
-  inline int weight_decay_size() const;
-  inline void clear_weight_decay();
-  static const int kWeightDecayFieldNumber = 8;
-  inline float weight_decay(int index) const;
-  inline void set_weight_decay(int index, float value);
-  inline void add_weight_decay(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      weight_decay() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_weight_decay();
-
-  // repeated float loss_weight = 35;
-  inline int loss_weight_size() const;
-  inline void clear_loss_weight();
-  static const int kLossWeightFieldNumber = 35;
-  inline float loss_weight(int index) const;
-  inline void set_loss_weight(int index, float value);
-  inline void add_loss_weight(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      loss_weight() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_loss_weight();
-
-  // optional .caffe.AccuracyParameter accuracy_param = 27;
-  inline bool has_accuracy_param() const;
-  inline void clear_accuracy_param();
-  static const int kAccuracyParamFieldNumber = 27;
-  inline const ::caffe::AccuracyParameter& accuracy_param() const;
-  inline ::caffe::AccuracyParameter* mutable_accuracy_param();
-  inline ::caffe::AccuracyParameter* release_accuracy_param();
-  inline void set_allocated_accuracy_param(::caffe::AccuracyParameter* accuracy_param);
-
-  // optional .caffe.ArgMaxParameter argmax_param = 23;
-  inline bool has_argmax_param() const;
-  inline void clear_argmax_param();
-  static const int kArgmaxParamFieldNumber = 23;
-  inline const ::caffe::ArgMaxParameter& argmax_param() const;
-  inline ::caffe::ArgMaxParameter* mutable_argmax_param();
-  inline ::caffe::ArgMaxParameter* release_argmax_param();
-  inline void set_allocated_argmax_param(::caffe::ArgMaxParameter* argmax_param);
-
-  // optional .caffe.ConcatParameter concat_param = 9;
-  inline bool has_concat_param() const;
-  inline void clear_concat_param();
-  static const int kConcatParamFieldNumber = 9;
-  inline const ::caffe::ConcatParameter& concat_param() const;
-  inline ::caffe::ConcatParameter* mutable_concat_param();
-  inline ::caffe::ConcatParameter* release_concat_param();
-  inline void set_allocated_concat_param(::caffe::ConcatParameter* concat_param);
-
-  // optional .caffe.ContrastiveLossParameter contrastive_loss_param = 40;
-  inline bool has_contrastive_loss_param() const;
-  inline void clear_contrastive_loss_param();
-  static const int kContrastiveLossParamFieldNumber = 40;
-  inline const ::caffe::ContrastiveLossParameter& contrastive_loss_param() const;
-  inline ::caffe::ContrastiveLossParameter* mutable_contrastive_loss_param();
-  inline ::caffe::ContrastiveLossParameter* release_contrastive_loss_param();
-  inline void set_allocated_contrastive_loss_param(::caffe::ContrastiveLossParameter* contrastive_loss_param);
-
-  // optional .caffe.ConvolutionParameter convolution_param = 10;
-  inline bool has_convolution_param() const;
-  inline void clear_convolution_param();
-  static const int kConvolutionParamFieldNumber = 10;
-  inline const ::caffe::ConvolutionParameter& convolution_param() const;
-  inline ::caffe::ConvolutionParameter* mutable_convolution_param();
-  inline ::caffe::ConvolutionParameter* release_convolution_param();
-  inline void set_allocated_convolution_param(::caffe::ConvolutionParameter* convolution_param);
-
-  // optional .caffe.DataParameter data_param = 11;
-  inline bool has_data_param() const;
-  inline void clear_data_param();
-  static const int kDataParamFieldNumber = 11;
-  inline const ::caffe::DataParameter& data_param() const;
-  inline ::caffe::DataParameter* mutable_data_param();
-  inline ::caffe::DataParameter* release_data_param();
-  inline void set_allocated_data_param(::caffe::DataParameter* data_param);
-
-  // optional .caffe.DropoutParameter dropout_param = 12;
-  inline bool has_dropout_param() const;
-  inline void clear_dropout_param();
-  static const int kDropoutParamFieldNumber = 12;
-  inline const ::caffe::DropoutParameter& dropout_param() const;
-  inline ::caffe::DropoutParameter* mutable_dropout_param();
-  inline ::caffe::DropoutParameter* release_dropout_param();
-  inline void set_allocated_dropout_param(::caffe::DropoutParameter* dropout_param);
-
-  // optional .caffe.DummyDataParameter dummy_data_param = 26;
-  inline bool has_dummy_data_param() const;
-  inline void clear_dummy_data_param();
-  static const int kDummyDataParamFieldNumber = 26;
-  inline const ::caffe::DummyDataParameter& dummy_data_param() const;
-  inline ::caffe::DummyDataParameter* mutable_dummy_data_param();
-  inline ::caffe::DummyDataParameter* release_dummy_data_param();
-  inline void set_allocated_dummy_data_param(::caffe::DummyDataParameter* dummy_data_param);
-
-  // optional .caffe.EltwiseParameter eltwise_param = 24;
-  inline bool has_eltwise_param() const;
-  inline void clear_eltwise_param();
-  static const int kEltwiseParamFieldNumber = 24;
-  inline const ::caffe::EltwiseParameter& eltwise_param() const;
-  inline ::caffe::EltwiseParameter* mutable_eltwise_param();
-  inline ::caffe::EltwiseParameter* release_eltwise_param();
-  inline void set_allocated_eltwise_param(::caffe::EltwiseParameter* eltwise_param);
-
-  // optional .caffe.ExpParameter exp_param = 41;
-  inline bool has_exp_param() const;
-  inline void clear_exp_param();
-  static const int kExpParamFieldNumber = 41;
-  inline const ::caffe::ExpParameter& exp_param() const;
-  inline ::caffe::ExpParameter* mutable_exp_param();
-  inline ::caffe::ExpParameter* release_exp_param();
-  inline void set_allocated_exp_param(::caffe::ExpParameter* exp_param);
-
-  // optional .caffe.HDF5DataParameter hdf5_data_param = 13;
-  inline bool has_hdf5_data_param() const;
-  inline void clear_hdf5_data_param();
-  static const int kHdf5DataParamFieldNumber = 13;
-  inline const ::caffe::HDF5DataParameter& hdf5_data_param() const;
-  inline ::caffe::HDF5DataParameter* mutable_hdf5_data_param();
-  inline ::caffe::HDF5DataParameter* release_hdf5_data_param();
-  inline void set_allocated_hdf5_data_param(::caffe::HDF5DataParameter* hdf5_data_param);
-
-  // optional .caffe.HDF5OutputParameter hdf5_output_param = 14;
-  inline bool has_hdf5_output_param() const;
-  inline void clear_hdf5_output_param();
-  static const int kHdf5OutputParamFieldNumber = 14;
-  inline const ::caffe::HDF5OutputParameter& hdf5_output_param() const;
-  inline ::caffe::HDF5OutputParameter* mutable_hdf5_output_param();
-  inline ::caffe::HDF5OutputParameter* release_hdf5_output_param();
-  inline void set_allocated_hdf5_output_param(::caffe::HDF5OutputParameter* hdf5_output_param);
-
-  // optional .caffe.HingeLossParameter hinge_loss_param = 29;
-  inline bool has_hinge_loss_param() const;
-  inline void clear_hinge_loss_param();
-  static const int kHingeLossParamFieldNumber = 29;
-  inline const ::caffe::HingeLossParameter& hinge_loss_param() const;
-  inline ::caffe::HingeLossParameter* mutable_hinge_loss_param();
-  inline ::caffe::HingeLossParameter* release_hinge_loss_param();
-  inline void set_allocated_hinge_loss_param(::caffe::HingeLossParameter* hinge_loss_param);
-
-  // optional .caffe.ImageDataParameter image_data_param = 15;
-  inline bool has_image_data_param() const;
-  inline void clear_image_data_param();
-  static const int kImageDataParamFieldNumber = 15;
-  inline const ::caffe::ImageDataParameter& image_data_param() const;
-  inline ::caffe::ImageDataParameter* mutable_image_data_param();
-  inline ::caffe::ImageDataParameter* release_image_data_param();
-  inline void set_allocated_image_data_param(::caffe::ImageDataParameter* image_data_param);
-
-  // optional .caffe.InfogainLossParameter infogain_loss_param = 16;
-  inline bool has_infogain_loss_param() const;
-  inline void clear_infogain_loss_param();
-  static const int kInfogainLossParamFieldNumber = 16;
-  inline const ::caffe::InfogainLossParameter& infogain_loss_param() const;
-  inline ::caffe::InfogainLossParameter* mutable_infogain_loss_param();
-  inline ::caffe::InfogainLossParameter* release_infogain_loss_param();
-  inline void set_allocated_infogain_loss_param(::caffe::InfogainLossParameter* infogain_loss_param);
-
-  // optional .caffe.InnerProductParameter inner_product_param = 17;
-  inline bool has_inner_product_param() const;
-  inline void clear_inner_product_param();
-  static const int kInnerProductParamFieldNumber = 17;
-  inline const ::caffe::InnerProductParameter& inner_product_param() const;
-  inline ::caffe::InnerProductParameter* mutable_inner_product_param();
-  inline ::caffe::InnerProductParameter* release_inner_product_param();
-  inline void set_allocated_inner_product_param(::caffe::InnerProductParameter* inner_product_param);
-
-  // optional .caffe.LRNParameter lrn_param = 18;
-  inline bool has_lrn_param() const;
-  inline void clear_lrn_param();
-  static const int kLrnParamFieldNumber = 18;
-  inline const ::caffe::LRNParameter& lrn_param() const;
-  inline ::caffe::LRNParameter* mutable_lrn_param();
-  inline ::caffe::LRNParameter* release_lrn_param();
-  inline void set_allocated_lrn_param(::caffe::LRNParameter* lrn_param);
-
-  // optional .caffe.MemoryDataParameter memory_data_param = 22;
-  inline bool has_memory_data_param() const;
-  inline void clear_memory_data_param();
-  static const int kMemoryDataParamFieldNumber = 22;
-  inline const ::caffe::MemoryDataParameter& memory_data_param() const;
-  inline ::caffe::MemoryDataParameter* mutable_memory_data_param();
-  inline ::caffe::MemoryDataParameter* release_memory_data_param();
-  inline void set_allocated_memory_data_param(::caffe::MemoryDataParameter* memory_data_param);
-
-  // optional .caffe.MVNParameter mvn_param = 34;
-  inline bool has_mvn_param() const;
-  inline void clear_mvn_param();
-  static const int kMvnParamFieldNumber = 34;
-  inline const ::caffe::MVNParameter& mvn_param() const;
-  inline ::caffe::MVNParameter* mutable_mvn_param();
-  inline ::caffe::MVNParameter* release_mvn_param();
-  inline void set_allocated_mvn_param(::caffe::MVNParameter* mvn_param);
-
-  // optional .caffe.PoolingParameter pooling_param = 19;
-  inline bool has_pooling_param() const;
-  inline void clear_pooling_param();
-  static const int kPoolingParamFieldNumber = 19;
-  inline const ::caffe::PoolingParameter& pooling_param() const;
-  inline ::caffe::PoolingParameter* mutable_pooling_param();
-  inline ::caffe::PoolingParameter* release_pooling_param();
-  inline void set_allocated_pooling_param(::caffe::PoolingParameter* pooling_param);
-
-  // optional .caffe.PowerParameter power_param = 21;
-  inline bool has_power_param() const;
-  inline void clear_power_param();
-  static const int kPowerParamFieldNumber = 21;
-  inline const ::caffe::PowerParameter& power_param() const;
-  inline ::caffe::PowerParameter* mutable_power_param();
-  inline ::caffe::PowerParameter* release_power_param();
-  inline void set_allocated_power_param(::caffe::PowerParameter* power_param);
-
-  // optional .caffe.ReLUParameter relu_param = 30;
-  inline bool has_relu_param() const;
-  inline void clear_relu_param();
-  static const int kReluParamFieldNumber = 30;
-  inline const ::caffe::ReLUParameter& relu_param() const;
-  inline ::caffe::ReLUParameter* mutable_relu_param();
-  inline ::caffe::ReLUParameter* release_relu_param();
-  inline void set_allocated_relu_param(::caffe::ReLUParameter* relu_param);
-
-  // optional .caffe.SigmoidParameter sigmoid_param = 38;
-  inline bool has_sigmoid_param() const;
-  inline void clear_sigmoid_param();
-  static const int kSigmoidParamFieldNumber = 38;
-  inline const ::caffe::SigmoidParameter& sigmoid_param() const;
-  inline ::caffe::SigmoidParameter* mutable_sigmoid_param();
-  inline ::caffe::SigmoidParameter* release_sigmoid_param();
-  inline void set_allocated_sigmoid_param(::caffe::SigmoidParameter* sigmoid_param);
-
-  // optional .caffe.SoftmaxParameter softmax_param = 39;
-  inline bool has_softmax_param() const;
-  inline void clear_softmax_param();
-  static const int kSoftmaxParamFieldNumber = 39;
-  inline const ::caffe::SoftmaxParameter& softmax_param() const;
-  inline ::caffe::SoftmaxParameter* mutable_softmax_param();
-  inline ::caffe::SoftmaxParameter* release_softmax_param();
-  inline void set_allocated_softmax_param(::caffe::SoftmaxParameter* softmax_param);
-
-  // optional .caffe.SliceParameter slice_param = 31;
-  inline bool has_slice_param() const;
-  inline void clear_slice_param();
-  static const int kSliceParamFieldNumber = 31;
-  inline const ::caffe::SliceParameter& slice_param() const;
-  inline ::caffe::SliceParameter* mutable_slice_param();
-  inline ::caffe::SliceParameter* release_slice_param();
-  inline void set_allocated_slice_param(::caffe::SliceParameter* slice_param);
-
-  // optional .caffe.TanHParameter tanh_param = 37;
-  inline bool has_tanh_param() const;
-  inline void clear_tanh_param();
-  static const int kTanhParamFieldNumber = 37;
-  inline const ::caffe::TanHParameter& tanh_param() const;
-  inline ::caffe::TanHParameter* mutable_tanh_param();
-  inline ::caffe::TanHParameter* release_tanh_param();
-  inline void set_allocated_tanh_param(::caffe::TanHParameter* tanh_param);
-
-  // optional .caffe.ThresholdParameter threshold_param = 25;
-  inline bool has_threshold_param() const;
-  inline void clear_threshold_param();
-  static const int kThresholdParamFieldNumber = 25;
-  inline const ::caffe::ThresholdParameter& threshold_param() const;
-  inline ::caffe::ThresholdParameter* mutable_threshold_param();
-  inline ::caffe::ThresholdParameter* release_threshold_param();
-  inline void set_allocated_threshold_param(::caffe::ThresholdParameter* threshold_param);
-
-  // optional .caffe.WindowDataParameter window_data_param = 20;
-  inline bool has_window_data_param() const;
-  inline void clear_window_data_param();
-  static const int kWindowDataParamFieldNumber = 20;
-  inline const ::caffe::WindowDataParameter& window_data_param() const;
-  inline ::caffe::WindowDataParameter* mutable_window_data_param();
-  inline ::caffe::WindowDataParameter* release_window_data_param();
-  inline void set_allocated_window_data_param(::caffe::WindowDataParameter* window_data_param);
-
-  // optional .caffe.TransformationParameter transform_param = 36;
-  inline bool has_transform_param() const;
-  inline void clear_transform_param();
-  static const int kTransformParamFieldNumber = 36;
-  inline const ::caffe::TransformationParameter& transform_param() const;
-  inline ::caffe::TransformationParameter* mutable_transform_param();
-  inline ::caffe::TransformationParameter* release_transform_param();
-  inline void set_allocated_transform_param(::caffe::TransformationParameter* transform_param);
-
-  // optional .caffe.LossParameter loss_param = 42;
-  inline bool has_loss_param() const;
-  inline void clear_loss_param();
-  static const int kLossParamFieldNumber = 42;
-  inline const ::caffe::LossParameter& loss_param() const;
-  inline ::caffe::LossParameter* mutable_loss_param();
-  inline ::caffe::LossParameter* release_loss_param();
-  inline void set_allocated_loss_param(::caffe::LossParameter* loss_param);
-
-  // optional .caffe.V0LayerParameter layer = 1;
-  inline bool has_layer() const;
-  inline void clear_layer();
-  static const int kLayerFieldNumber = 1;
-  inline const ::caffe::V0LayerParameter& layer() const;
-  inline ::caffe::V0LayerParameter* mutable_layer();
-  inline ::caffe::V0LayerParameter* release_layer();
-  inline void set_allocated_layer(::caffe::V0LayerParameter* layer);
-
-  // @@protoc_insertion_point(class_scope:caffe.V1LayerParameter)
- private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_accuracy_param();
-  inline void clear_has_accuracy_param();
-  inline void set_has_argmax_param();
-  inline void clear_has_argmax_param();
-  inline void set_has_concat_param();
-  inline void clear_has_concat_param();
-  inline void set_has_contrastive_loss_param();
-  inline void clear_has_contrastive_loss_param();
-  inline void set_has_convolution_param();
-  inline void clear_has_convolution_param();
-  inline void set_has_data_param();
-  inline void clear_has_data_param();
-  inline void set_has_dropout_param();
-  inline void clear_has_dropout_param();
-  inline void set_has_dummy_data_param();
-  inline void clear_has_dummy_data_param();
-  inline void set_has_eltwise_param();
-  inline void clear_has_eltwise_param();
-  inline void set_has_exp_param();
-  inline void clear_has_exp_param();
-  inline void set_has_hdf5_data_param();
-  inline void clear_has_hdf5_data_param();
-  inline void set_has_hdf5_output_param();
-  inline void clear_has_hdf5_output_param();
-  inline void set_has_hinge_loss_param();
-  inline void clear_has_hinge_loss_param();
-  inline void set_has_image_data_param();
-  inline void clear_has_image_data_param();
-  inline void set_has_infogain_loss_param();
-  inline void clear_has_infogain_loss_param();
-  inline void set_has_inner_product_param();
-  inline void clear_has_inner_product_param();
-  inline void set_has_lrn_param();
-  inline void clear_has_lrn_param();
-  inline void set_has_memory_data_param();
-  inline void clear_has_memory_data_param();
-  inline void set_has_mvn_param();
-  inline void clear_has_mvn_param();
-  inline void set_has_pooling_param();
-  inline void clear_has_pooling_param();
-  inline void set_has_power_param();
-  inline void clear_has_power_param();
-  inline void set_has_relu_param();
-  inline void clear_has_relu_param();
-  inline void set_has_sigmoid_param();
-  inline void clear_has_sigmoid_param();
-  inline void set_has_softmax_param();
-  inline void clear_has_softmax_param();
-  inline void set_has_slice_param();
-  inline void clear_has_slice_param();
-  inline void set_has_tanh_param();
-  inline void clear_has_tanh_param();
-  inline void set_has_threshold_param();
-  inline void clear_has_threshold_param();
-  inline void set_has_window_data_param();
-  inline void clear_has_window_data_param();
-  inline void set_has_transform_param();
-  inline void clear_has_transform_param();
-  inline void set_has_loss_param();
-  inline void clear_has_loss_param();
-  inline void set_has_layer();
-  inline void clear_has_layer();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[2];
-  ::google::protobuf::RepeatedPtrField< ::std::string> bottom_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> top_;
-  ::std::string* name_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule > include_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule > exclude_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto > blobs_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> param_;
-  ::google::protobuf::RepeatedField<int> blob_share_mode_;
-  ::google::protobuf::RepeatedField< float > blobs_lr_;
-  ::google::protobuf::RepeatedField< float > weight_decay_;
-  ::google::protobuf::RepeatedField< float > loss_weight_;
-  ::caffe::AccuracyParameter* accuracy_param_;
-  ::caffe::ArgMaxParameter* argmax_param_;
-  ::caffe::ConcatParameter* concat_param_;
-  ::caffe::ContrastiveLossParameter* contrastive_loss_param_;
-  ::caffe::ConvolutionParameter* convolution_param_;
-  ::caffe::DataParameter* data_param_;
-  ::caffe::DropoutParameter* dropout_param_;
-  ::caffe::DummyDataParameter* dummy_data_param_;
-  ::caffe::EltwiseParameter* eltwise_param_;
-  ::caffe::ExpParameter* exp_param_;
-  ::caffe::HDF5DataParameter* hdf5_data_param_;
-  ::caffe::HDF5OutputParameter* hdf5_output_param_;
-  ::caffe::HingeLossParameter* hinge_loss_param_;
-  ::caffe::ImageDataParameter* image_data_param_;
-  ::caffe::InfogainLossParameter* infogain_loss_param_;
-  ::caffe::InnerProductParameter* inner_product_param_;
-  ::caffe::LRNParameter* lrn_param_;
-  ::caffe::MemoryDataParameter* memory_data_param_;
-  ::caffe::MVNParameter* mvn_param_;
-  ::caffe::PoolingParameter* pooling_param_;
-  ::caffe::PowerParameter* power_param_;
-  ::caffe::ReLUParameter* relu_param_;
-  ::caffe::SigmoidParameter* sigmoid_param_;
-  ::caffe::SoftmaxParameter* softmax_param_;
-  ::caffe::SliceParameter* slice_param_;
-  ::caffe::TanHParameter* tanh_param_;
-  ::caffe::ThresholdParameter* threshold_param_;
-  ::caffe::WindowDataParameter* window_data_param_;
-  ::caffe::TransformationParameter* transform_param_;
-  ::caffe::LossParameter* loss_param_;
-  ::caffe::V0LayerParameter* layer_;
-  int type_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static V1LayerParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class V0LayerParameter : public ::google::protobuf::Message {
- public:
-  V0LayerParameter();
-  virtual ~V0LayerParameter();
-
-  V0LayerParameter(const V0LayerParameter& from);
-
-  inline V0LayerParameter& operator=(const V0LayerParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const V0LayerParameter& default_instance();
-
-  void Swap(V0LayerParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  V0LayerParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const V0LayerParameter& from);
-  void MergeFrom(const V0LayerParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef V0LayerParameter_PoolMethod PoolMethod;
-  static const PoolMethod MAX = V0LayerParameter_PoolMethod_MAX;
-  static const PoolMethod AVE = V0LayerParameter_PoolMethod_AVE;
-  static const PoolMethod STOCHASTIC = V0LayerParameter_PoolMethod_STOCHASTIC;
-  static inline bool PoolMethod_IsValid(int value) {
-    return V0LayerParameter_PoolMethod_IsValid(value);
-  }
-  static const PoolMethod PoolMethod_MIN =
-    V0LayerParameter_PoolMethod_PoolMethod_MIN;
-  static const PoolMethod PoolMethod_MAX =
-    V0LayerParameter_PoolMethod_PoolMethod_MAX;
-  static const int PoolMethod_ARRAYSIZE =
-    V0LayerParameter_PoolMethod_PoolMethod_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  PoolMethod_descriptor() {
-    return V0LayerParameter_PoolMethod_descriptor();
-  }
-  static inline const ::std::string& PoolMethod_Name(PoolMethod value) {
-    return V0LayerParameter_PoolMethod_Name(value);
-  }
-  static inline bool PoolMethod_Parse(const ::std::string& name,
-      PoolMethod* value) {
-    return V0LayerParameter_PoolMethod_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
-
-  // optional string type = 2;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 2;
-  inline const ::std::string& type() const;
-  inline void set_type(const ::std::string& value);
-  inline void set_type(const char* value);
-  inline void set_type(const char* value, size_t size);
-  inline ::std::string* mutable_type();
-  inline ::std::string* release_type();
-  inline void set_allocated_type(::std::string* type);
-
-  // optional uint32 num_output = 3;
-  inline bool has_num_output() const;
-  inline void clear_num_output();
-  static const int kNumOutputFieldNumber = 3;
-  inline ::google::protobuf::uint32 num_output() const;
-  inline void set_num_output(::google::protobuf::uint32 value);
-
-  // optional bool biasterm = 4 [default = true];
-  inline bool has_biasterm() const;
-  inline void clear_biasterm();
-  static const int kBiastermFieldNumber = 4;
-  inline bool biasterm() const;
-  inline void set_biasterm(bool value);
-
-  // optional .caffe.FillerParameter weight_filler = 5;
-  inline bool has_weight_filler() const;
-  inline void clear_weight_filler();
-  static const int kWeightFillerFieldNumber = 5;
-  inline const ::caffe::FillerParameter& weight_filler() const;
-  inline ::caffe::FillerParameter* mutable_weight_filler();
-  inline ::caffe::FillerParameter* release_weight_filler();
-  inline void set_allocated_weight_filler(::caffe::FillerParameter* weight_filler);
-
-  // optional .caffe.FillerParameter bias_filler = 6;
-  inline bool has_bias_filler() const;
-  inline void clear_bias_filler();
-  static const int kBiasFillerFieldNumber = 6;
-  inline const ::caffe::FillerParameter& bias_filler() const;
-  inline ::caffe::FillerParameter* mutable_bias_filler();
-  inline ::caffe::FillerParameter* release_bias_filler();
-  inline void set_allocated_bias_filler(::caffe::FillerParameter* bias_filler);
-
-  // optional uint32 pad = 7 [default = 0];
-  inline bool has_pad() const;
-  inline void clear_pad();
-  static const int kPadFieldNumber = 7;
-  inline ::google::protobuf::uint32 pad() const;
-  inline void set_pad(::google::protobuf::uint32 value);
-
-  // optional uint32 kernelsize = 8;
-  inline bool has_kernelsize() const;
-  inline void clear_kernelsize();
-  static const int kKernelsizeFieldNumber = 8;
-  inline ::google::protobuf::uint32 kernelsize() const;
-  inline void set_kernelsize(::google::protobuf::uint32 value);
-
-  // optional uint32 group = 9 [default = 1];
-  inline bool has_group() const;
-  inline void clear_group();
-  static const int kGroupFieldNumber = 9;
-  inline ::google::protobuf::uint32 group() const;
-  inline void set_group(::google::protobuf::uint32 value);
-
-  // optional uint32 stride = 10 [default = 1];
-  inline bool has_stride() const;
-  inline void clear_stride();
-  static const int kStrideFieldNumber = 10;
-  inline ::google::protobuf::uint32 stride() const;
-  inline void set_stride(::google::protobuf::uint32 value);
-
-  // optional .caffe.V0LayerParameter.PoolMethod pool = 11 [default = MAX];
-  inline bool has_pool() const;
-  inline void clear_pool();
-  static const int kPoolFieldNumber = 11;
-  inline ::caffe::V0LayerParameter_PoolMethod pool() const;
-  inline void set_pool(::caffe::V0LayerParameter_PoolMethod value);
-
-  // optional float dropout_ratio = 12 [default = 0.5];
-  inline bool has_dropout_ratio() const;
-  inline void clear_dropout_ratio();
-  static const int kDropoutRatioFieldNumber = 12;
-  inline float dropout_ratio() const;
-  inline void set_dropout_ratio(float value);
-
-  // optional uint32 local_size = 13 [default = 5];
-  inline bool has_local_size() const;
-  inline void clear_local_size();
-  static const int kLocalSizeFieldNumber = 13;
-  inline ::google::protobuf::uint32 local_size() const;
-  inline void set_local_size(::google::protobuf::uint32 value);
-
-  // optional float alpha = 14 [default = 1];
-  inline bool has_alpha() const;
-  inline void clear_alpha();
-  static const int kAlphaFieldNumber = 14;
-  inline float alpha() const;
-  inline void set_alpha(float value);
-
-  // optional float beta = 15 [default = 0.75];
-  inline bool has_beta() const;
-  inline void clear_beta();
-  static const int kBetaFieldNumber = 15;
-  inline float beta() const;
-  inline void set_beta(float value);
-
-  // optional float k = 22 [default = 1];
-  inline bool has_k() const;
-  inline void clear_k();
-  static const int kKFieldNumber = 22;
-  inline float k() const;
-  inline void set_k(float value);
-
-  // optional string source = 16;
-  inline bool has_source() const;
-  inline void clear_source();
-  static const int kSourceFieldNumber = 16;
-  inline const ::std::string& source() const;
-  inline void set_source(const ::std::string& value);
-  inline void set_source(const char* value);
-  inline void set_source(const char* value, size_t size);
-  inline ::std::string* mutable_source();
-  inline ::std::string* release_source();
-  inline void set_allocated_source(::std::string* source);
-
-  // optional float scale = 17 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 17;
-  inline float scale() const;
-  inline void set_scale(float value);
-
-  // optional string meanfile = 18;
-  inline bool has_meanfile() const;
-  inline void clear_meanfile();
-  static const int kMeanfileFieldNumber = 18;
-  inline const ::std::string& meanfile() const;
-  inline void set_meanfile(const ::std::string& value);
-  inline void set_meanfile(const char* value);
-  inline void set_meanfile(const char* value, size_t size);
-  inline ::std::string* mutable_meanfile();
-  inline ::std::string* release_meanfile();
-  inline void set_allocated_meanfile(::std::string* meanfile);
-
-  // optional uint32 batchsize = 19;
-  inline bool has_batchsize() const;
-  inline void clear_batchsize();
-  static const int kBatchsizeFieldNumber = 19;
-  inline ::google::protobuf::uint32 batchsize() const;
-  inline void set_batchsize(::google::protobuf::uint32 value);
-
-  // optional uint32 cropsize = 20 [default = 0];
-  inline bool has_cropsize() const;
-  inline void clear_cropsize();
-  static const int kCropsizeFieldNumber = 20;
-  inline ::google::protobuf::uint32 cropsize() const;
-  inline void set_cropsize(::google::protobuf::uint32 value);
-
-  // optional bool mirror = 21 [default = false];
-  inline bool has_mirror() const;
-  inline void clear_mirror();
-  static const int kMirrorFieldNumber = 21;
-  inline bool mirror() const;
-  inline void set_mirror(bool value);
-
-  // repeated .caffe.BlobProto blobs = 50;
-  inline int blobs_size() const;
-  inline void clear_blobs();
-  static const int kBlobsFieldNumber = 50;
-  inline const ::caffe::BlobProto& blobs(int index) const;
-  inline ::caffe::BlobProto* mutable_blobs(int index);
-  inline ::caffe::BlobProto* add_blobs();
-  inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
-  inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-      mutable_blobs();
-
-  // repeated float blobs_lr = 51;
-  inline int blobs_lr_size() const;
-  inline void clear_blobs_lr();
-  static const int kBlobsLrFieldNumber = 51;
-  inline float blobs_lr(int index) const;
-  inline void set_blobs_lr(int index, float value);
-  inline void add_blobs_lr(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      blobs_lr() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_blobs_lr();
-
-  // repeated float weight_decay = 52;
-  inline int weight_decay_size() const;
-  inline void clear_weight_decay();
-  static const int kWeightDecayFieldNumber = 52;
-  inline float weight_decay(int index) const;
-  inline void set_weight_decay(int index, float value);
-  inline void add_weight_decay(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      weight_decay() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_weight_decay();
-
-  // optional uint32 rand_skip = 53 [default = 0];
-  inline bool has_rand_skip() const;
-  inline void clear_rand_skip();
-  static const int kRandSkipFieldNumber = 53;
-  inline ::google::protobuf::uint32 rand_skip() const;
-  inline void set_rand_skip(::google::protobuf::uint32 value);
-
-  // optional float det_fg_threshold = 54 [default = 0.5];
-  inline bool has_det_fg_threshold() const;
-  inline void clear_det_fg_threshold();
-  static const int kDetFgThresholdFieldNumber = 54;
-  inline float det_fg_threshold() const;
-  inline void set_det_fg_threshold(float value);
-
-  // optional float det_bg_threshold = 55 [default = 0.5];
-  inline bool has_det_bg_threshold() const;
-  inline void clear_det_bg_threshold();
-  static const int kDetBgThresholdFieldNumber = 55;
-  inline float det_bg_threshold() const;
-  inline void set_det_bg_threshold(float value);
-
-  // optional float det_fg_fraction = 56 [default = 0.25];
-  inline bool has_det_fg_fraction() const;
-  inline void clear_det_fg_fraction();
-  static const int kDetFgFractionFieldNumber = 56;
-  inline float det_fg_fraction() const;
-  inline void set_det_fg_fraction(float value);
-
-  // optional uint32 det_context_pad = 58 [default = 0];
-  inline bool has_det_context_pad() const;
-  inline void clear_det_context_pad();
-  static const int kDetContextPadFieldNumber = 58;
-  inline ::google::protobuf::uint32 det_context_pad() const;
-  inline void set_det_context_pad(::google::protobuf::uint32 value);
-
-  // optional string det_crop_mode = 59 [default = "warp"];
-  inline bool has_det_crop_mode() const;
-  inline void clear_det_crop_mode();
-  static const int kDetCropModeFieldNumber = 59;
-  inline const ::std::string& det_crop_mode() const;
-  inline void set_det_crop_mode(const ::std::string& value);
-  inline void set_det_crop_mode(const char* value);
-  inline void set_det_crop_mode(const char* value, size_t size);
-  inline ::std::string* mutable_det_crop_mode();
-  inline ::std::string* release_det_crop_mode();
-  inline void set_allocated_det_crop_mode(::std::string* det_crop_mode);
-
-  // optional int32 new_num = 60 [default = 0];
-  inline bool has_new_num() const;
-  inline void clear_new_num();
-  static const int kNewNumFieldNumber = 60;
-  inline ::google::protobuf::int32 new_num() const;
-  inline void set_new_num(::google::protobuf::int32 value);
-
-  // optional int32 new_channels = 61 [default = 0];
-  inline bool has_new_channels() const;
-  inline void clear_new_channels();
-  static const int kNewChannelsFieldNumber = 61;
-  inline ::google::protobuf::int32 new_channels() const;
-  inline void set_new_channels(::google::protobuf::int32 value);
-
-  // optional int32 new_height = 62 [default = 0];
-  inline bool has_new_height() const;
-  inline void clear_new_height();
-  static const int kNewHeightFieldNumber = 62;
-  inline ::google::protobuf::int32 new_height() const;
-  inline void set_new_height(::google::protobuf::int32 value);
-
-  // optional int32 new_width = 63 [default = 0];
-  inline bool has_new_width() const;
-  inline void clear_new_width();
-  static const int kNewWidthFieldNumber = 63;
-  inline ::google::protobuf::int32 new_width() const;
-  inline void set_new_width(::google::protobuf::int32 value);
-
-  // optional bool shuffle_images = 64 [default = false];
-  inline bool has_shuffle_images() const;
-  inline void clear_shuffle_images();
-  static const int kShuffleImagesFieldNumber = 64;
-  inline bool shuffle_images() const;
-  inline void set_shuffle_images(bool value);
-
-  // optional uint32 concat_dim = 65 [default = 1];
-  inline bool has_concat_dim() const;
-  inline void clear_concat_dim();
-  static const int kConcatDimFieldNumber = 65;
-  inline ::google::protobuf::uint32 concat_dim() const;
-  inline void set_concat_dim(::google::protobuf::uint32 value);
-
-  // optional .caffe.HDF5OutputParameter hdf5_output_param = 1001;
-  inline bool has_hdf5_output_param() const;
-  inline void clear_hdf5_output_param();
-  static const int kHdf5OutputParamFieldNumber = 1001;
-  inline const ::caffe::HDF5OutputParameter& hdf5_output_param() const;
-  inline ::caffe::HDF5OutputParameter* mutable_hdf5_output_param();
-  inline ::caffe::HDF5OutputParameter* release_hdf5_output_param();
-  inline void set_allocated_hdf5_output_param(::caffe::HDF5OutputParameter* hdf5_output_param);
-
-  // @@protoc_insertion_point(class_scope:caffe.V0LayerParameter)
- private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_num_output();
-  inline void clear_has_num_output();
-  inline void set_has_biasterm();
-  inline void clear_has_biasterm();
-  inline void set_has_weight_filler();
-  inline void clear_has_weight_filler();
-  inline void set_has_bias_filler();
-  inline void clear_has_bias_filler();
-  inline void set_has_pad();
-  inline void clear_has_pad();
-  inline void set_has_kernelsize();
-  inline void clear_has_kernelsize();
-  inline void set_has_group();
-  inline void clear_has_group();
-  inline void set_has_stride();
-  inline void clear_has_stride();
-  inline void set_has_pool();
-  inline void clear_has_pool();
-  inline void set_has_dropout_ratio();
-  inline void clear_has_dropout_ratio();
-  inline void set_has_local_size();
-  inline void clear_has_local_size();
-  inline void set_has_alpha();
-  inline void clear_has_alpha();
-  inline void set_has_beta();
-  inline void clear_has_beta();
-  inline void set_has_k();
-  inline void clear_has_k();
-  inline void set_has_source();
-  inline void clear_has_source();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  inline void set_has_meanfile();
-  inline void clear_has_meanfile();
-  inline void set_has_batchsize();
-  inline void clear_has_batchsize();
-  inline void set_has_cropsize();
-  inline void clear_has_cropsize();
-  inline void set_has_mirror();
-  inline void clear_has_mirror();
-  inline void set_has_rand_skip();
-  inline void clear_has_rand_skip();
-  inline void set_has_det_fg_threshold();
-  inline void clear_has_det_fg_threshold();
-  inline void set_has_det_bg_threshold();
-  inline void clear_has_det_bg_threshold();
-  inline void set_has_det_fg_fraction();
-  inline void clear_has_det_fg_fraction();
-  inline void set_has_det_context_pad();
-  inline void clear_has_det_context_pad();
-  inline void set_has_det_crop_mode();
-  inline void clear_has_det_crop_mode();
-  inline void set_has_new_num();
-  inline void clear_has_new_num();
-  inline void set_has_new_channels();
-  inline void clear_has_new_channels();
-  inline void set_has_new_height();
-  inline void clear_has_new_height();
-  inline void set_has_new_width();
-  inline void clear_has_new_width();
-  inline void set_has_shuffle_images();
-  inline void clear_has_shuffle_images();
-  inline void set_has_concat_dim();
-  inline void clear_has_concat_dim();
-  inline void set_has_hdf5_output_param();
-  inline void clear_has_hdf5_output_param();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[2];
-  ::std::string* name_;
-  ::std::string* type_;
-  ::caffe::FillerParameter* weight_filler_;
-  ::google::protobuf::uint32 num_output_;
-  ::google::protobuf::uint32 pad_;
-  ::caffe::FillerParameter* bias_filler_;
-  ::google::protobuf::uint32 kernelsize_;
-  ::google::protobuf::uint32 group_;
-  ::google::protobuf::uint32 stride_;
-  int pool_;
-  float dropout_ratio_;
-  ::google::protobuf::uint32 local_size_;
-  float alpha_;
-  float beta_;
-  ::std::string* source_;
-  float k_;
-  float scale_;
-  ::std::string* meanfile_;
-  ::google::protobuf::uint32 batchsize_;
-  bool biasterm_;
-  bool mirror_;
-  bool shuffle_images_;
-  ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto > blobs_;
-  ::google::protobuf::uint32 cropsize_;
-  ::google::protobuf::uint32 rand_skip_;
-  ::google::protobuf::RepeatedField< float > blobs_lr_;
-  ::google::protobuf::RepeatedField< float > weight_decay_;
-  float det_fg_threshold_;
-  float det_bg_threshold_;
-  float det_fg_fraction_;
-  ::google::protobuf::uint32 det_context_pad_;
-  static ::std::string* _default_det_crop_mode_;
-  ::std::string* det_crop_mode_;
-  ::google::protobuf::int32 new_num_;
-  ::google::protobuf::int32 new_channels_;
-  ::google::protobuf::int32 new_height_;
-  ::google::protobuf::int32 new_width_;
-  ::caffe::HDF5OutputParameter* hdf5_output_param_;
-  ::google::protobuf::uint32 concat_dim_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static V0LayerParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class PReLUParameter : public ::google::protobuf::Message {
- public:
-  PReLUParameter();
-  virtual ~PReLUParameter();
-
-  PReLUParameter(const PReLUParameter& from);
-
-  inline PReLUParameter& operator=(const PReLUParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PReLUParameter& default_instance();
-
-  void Swap(PReLUParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  PReLUParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PReLUParameter& from);
-  void MergeFrom(const PReLUParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.FillerParameter filler = 1;
-  inline bool has_filler() const;
-  inline void clear_filler();
-  static const int kFillerFieldNumber = 1;
-  inline const ::caffe::FillerParameter& filler() const;
-  inline ::caffe::FillerParameter* mutable_filler();
-  inline ::caffe::FillerParameter* release_filler();
-  inline void set_allocated_filler(::caffe::FillerParameter* filler);
-
-  // optional bool channel_shared = 2 [default = false];
-  inline bool has_channel_shared() const;
-  inline void clear_channel_shared();
-  static const int kChannelSharedFieldNumber = 2;
-  inline bool channel_shared() const;
-  inline void set_channel_shared(bool value);
-
-  // @@protoc_insertion_point(class_scope:caffe.PReLUParameter)
- private:
-  inline void set_has_filler();
-  inline void clear_has_filler();
-  inline void set_has_channel_shared();
-  inline void clear_has_channel_shared();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::caffe::FillerParameter* filler_;
-  bool channel_shared_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static PReLUParameter* default_instance_;
-};
-// -------------------------------------------------------------------
-
-class QuantizationParameter : public ::google::protobuf::Message {
- public:
-  QuantizationParameter();
-  virtual ~QuantizationParameter();
-
-  QuantizationParameter(const QuantizationParameter& from);
-
-  inline QuantizationParameter& operator=(const QuantizationParameter& from) {
-    CopyFrom(from);
-    return *this;
-  }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
-  }
-
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
-  }
-
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QuantizationParameter& default_instance();
-
-  void Swap(QuantizationParameter* other);
-
-  // implements Message ----------------------------------------------
-
-  QuantizationParameter* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const QuantizationParameter& from);
-  void MergeFrom(const QuantizationParameter& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef QuantizationParameter_RoundMethod RoundMethod;
-  static const RoundMethod ROUND = QuantizationParameter_RoundMethod_ROUND;
-  static const RoundMethod FLOOR = QuantizationParameter_RoundMethod_FLOOR;
-  static const RoundMethod CEIL = QuantizationParameter_RoundMethod_CEIL;
-  static const RoundMethod TRUNC = QuantizationParameter_RoundMethod_TRUNC;
-  static inline bool RoundMethod_IsValid(int value) {
-    return QuantizationParameter_RoundMethod_IsValid(value);
-  }
-  static const RoundMethod RoundMethod_MIN =
-    QuantizationParameter_RoundMethod_RoundMethod_MIN;
-  static const RoundMethod RoundMethod_MAX =
-    QuantizationParameter_RoundMethod_RoundMethod_MAX;
-  static const int RoundMethod_ARRAYSIZE =
-    QuantizationParameter_RoundMethod_RoundMethod_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  RoundMethod_descriptor() {
-    return QuantizationParameter_RoundMethod_descriptor();
-  }
-  static inline const ::std::string& RoundMethod_Name(RoundMethod value) {
-    return QuantizationParameter_RoundMethod_Name(value);
-  }
-  static inline bool RoundMethod_Parse(const ::std::string& name,
-      RoundMethod* value) {
-    return QuantizationParameter_RoundMethod_Parse(name, value);
-  }
-
-  typedef QuantizationParameter_RoundStrategy RoundStrategy;
-  static const RoundStrategy CONSERVATIVE = QuantizationParameter_RoundStrategy_CONSERVATIVE;
-  static const RoundStrategy NEUTRAL = QuantizationParameter_RoundStrategy_NEUTRAL;
-  static const RoundStrategy AGGRESSIVE = QuantizationParameter_RoundStrategy_AGGRESSIVE;
-  static inline bool RoundStrategy_IsValid(int value) {
-    return QuantizationParameter_RoundStrategy_IsValid(value);
-  }
-  static const RoundStrategy RoundStrategy_MIN =
-    QuantizationParameter_RoundStrategy_RoundStrategy_MIN;
-  static const RoundStrategy RoundStrategy_MAX =
-    QuantizationParameter_RoundStrategy_RoundStrategy_MAX;
-  static const int RoundStrategy_ARRAYSIZE =
-    QuantizationParameter_RoundStrategy_RoundStrategy_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  RoundStrategy_descriptor() {
-    return QuantizationParameter_RoundStrategy_descriptor();
-  }
-  static inline const ::std::string& RoundStrategy_Name(RoundStrategy value) {
-    return QuantizationParameter_RoundStrategy_Name(value);
-  }
-  static inline bool RoundStrategy_Parse(const ::std::string& name,
-      RoundStrategy* value) {
-    return QuantizationParameter_RoundStrategy_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  // optional .caffe.QuantizationParameter.RoundMethod round_method = 1 [default = ROUND];
-  inline bool has_round_method() const;
-  inline void clear_round_method();
-  static const int kRoundMethodFieldNumber = 1;
-  inline ::caffe::QuantizationParameter_RoundMethod round_method() const;
-  inline void set_round_method(::caffe::QuantizationParameter_RoundMethod value);
-
-  // optional .caffe.QuantizationParameter.RoundStrategy round_strategy = 2 [default = CONSERVATIVE];
-  inline bool has_round_strategy() const;
-  inline void clear_round_strategy();
-  static const int kRoundStrategyFieldNumber = 2;
-  inline ::caffe::QuantizationParameter_RoundStrategy round_strategy() const;
-  inline void set_round_strategy(::caffe::QuantizationParameter_RoundStrategy value);
-
-  // optional int32 bit_width = 3 [default = 0];
-  inline bool has_bit_width() const;
-  inline void clear_bit_width();
-  static const int kBitWidthFieldNumber = 3;
-  inline ::google::protobuf::int32 bit_width() const;
-  inline void set_bit_width(::google::protobuf::int32 value);
-
-  // repeated float range = 4 [packed = true];
-  inline int range_size() const;
-  inline void clear_range();
-  static const int kRangeFieldNumber = 4;
-  inline float range(int index) const;
-  inline void set_range(int index, float value);
-  inline void add_range(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
-      range() const;
-  inline ::google::protobuf::RepeatedField< float >*
-      mutable_range();
-
-  // @@protoc_insertion_point(class_scope:caffe.QuantizationParameter)
- private:
-  inline void set_has_round_method();
-  inline void clear_has_round_method();
-  inline void set_has_round_strategy();
-  inline void clear_has_round_strategy();
-  inline void set_has_bit_width();
-  inline void clear_has_bit_width();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  int round_method_;
-  int round_strategy_;
-  ::google::protobuf::RepeatedField< float > range_;
-  mutable int _range_cached_byte_size_;
-  ::google::protobuf::int32 bit_width_;
-  friend void  protobuf_AddDesc_caffe_2eproto();
-  friend void protobuf_AssignDesc_caffe_2eproto();
-  friend void protobuf_ShutdownFile_caffe_2eproto();
-
-  void InitAsDefaultInstance();
-  static QuantizationParameter* default_instance_;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-// BlobShape
-
-// repeated int64 dim = 1 [packed = true];
-inline int BlobShape::dim_size() const {
-  return dim_.size();
-}
-inline void BlobShape::clear_dim() {
-  dim_.Clear();
-}
-inline ::google::protobuf::int64 BlobShape::dim(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.BlobShape.dim)
-  return dim_.Get(index);
-}
-inline void BlobShape::set_dim(int index, ::google::protobuf::int64 value) {
-  dim_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.BlobShape.dim)
-}
-inline void BlobShape::add_dim(::google::protobuf::int64 value) {
-  dim_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.BlobShape.dim)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
-BlobShape::dim() const {
-  // @@protoc_insertion_point(field_list:caffe.BlobShape.dim)
-  return dim_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
-BlobShape::mutable_dim() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.BlobShape.dim)
-  return &dim_;
-}
-
-// -------------------------------------------------------------------
-
-// BlobProto
-
-// optional .caffe.BlobShape shape = 7;
-inline bool BlobProto::has_shape() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void BlobProto::set_has_shape() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void BlobProto::clear_has_shape() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void BlobProto::clear_shape() {
-  if (shape_ != NULL) shape_->::caffe::BlobShape::Clear();
-  clear_has_shape();
-}
-inline const ::caffe::BlobShape& BlobProto::shape() const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.shape)
-  return shape_ != NULL ? *shape_ : *default_instance_->shape_;
-}
-inline ::caffe::BlobShape* BlobProto::mutable_shape() {
-  set_has_shape();
-  if (shape_ == NULL) shape_ = new ::caffe::BlobShape;
-  // @@protoc_insertion_point(field_mutable:caffe.BlobProto.shape)
-  return shape_;
-}
-inline ::caffe::BlobShape* BlobProto::release_shape() {
-  clear_has_shape();
-  ::caffe::BlobShape* temp = shape_;
-  shape_ = NULL;
-  return temp;
-}
-inline void BlobProto::set_allocated_shape(::caffe::BlobShape* shape) {
-  delete shape_;
-  shape_ = shape;
-  if (shape) {
-    set_has_shape();
-  } else {
-    clear_has_shape();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.BlobProto.shape)
-}
-
-// repeated float data = 5 [packed = true];
-inline int BlobProto::data_size() const {
-  return data_.size();
-}
-inline void BlobProto::clear_data() {
-  data_.Clear();
-}
-inline float BlobProto::data(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.data)
-  return data_.Get(index);
-}
-inline void BlobProto::set_data(int index, float value) {
-  data_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.data)
-}
-inline void BlobProto::add_data(float value) {
-  data_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.BlobProto.data)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-BlobProto::data() const {
-  // @@protoc_insertion_point(field_list:caffe.BlobProto.data)
-  return data_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-BlobProto::mutable_data() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.BlobProto.data)
-  return &data_;
-}
-
-// repeated float diff = 6 [packed = true];
-inline int BlobProto::diff_size() const {
-  return diff_.size();
-}
-inline void BlobProto::clear_diff() {
-  diff_.Clear();
-}
-inline float BlobProto::diff(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.diff)
-  return diff_.Get(index);
-}
-inline void BlobProto::set_diff(int index, float value) {
-  diff_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.diff)
-}
-inline void BlobProto::add_diff(float value) {
-  diff_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.BlobProto.diff)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-BlobProto::diff() const {
-  // @@protoc_insertion_point(field_list:caffe.BlobProto.diff)
-  return diff_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-BlobProto::mutable_diff() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.BlobProto.diff)
-  return &diff_;
-}
-
-// repeated double double_data = 8 [packed = true];
-inline int BlobProto::double_data_size() const {
-  return double_data_.size();
-}
-inline void BlobProto::clear_double_data() {
-  double_data_.Clear();
-}
-inline double BlobProto::double_data(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.double_data)
-  return double_data_.Get(index);
-}
-inline void BlobProto::set_double_data(int index, double value) {
-  double_data_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.double_data)
-}
-inline void BlobProto::add_double_data(double value) {
-  double_data_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.BlobProto.double_data)
-}
-inline const ::google::protobuf::RepeatedField< double >&
-BlobProto::double_data() const {
-  // @@protoc_insertion_point(field_list:caffe.BlobProto.double_data)
-  return double_data_;
-}
-inline ::google::protobuf::RepeatedField< double >*
-BlobProto::mutable_double_data() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.BlobProto.double_data)
-  return &double_data_;
-}
-
-// repeated double double_diff = 9 [packed = true];
-inline int BlobProto::double_diff_size() const {
-  return double_diff_.size();
-}
-inline void BlobProto::clear_double_diff() {
-  double_diff_.Clear();
-}
-inline double BlobProto::double_diff(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.double_diff)
-  return double_diff_.Get(index);
-}
-inline void BlobProto::set_double_diff(int index, double value) {
-  double_diff_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.double_diff)
-}
-inline void BlobProto::add_double_diff(double value) {
-  double_diff_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.BlobProto.double_diff)
-}
-inline const ::google::protobuf::RepeatedField< double >&
-BlobProto::double_diff() const {
-  // @@protoc_insertion_point(field_list:caffe.BlobProto.double_diff)
-  return double_diff_;
-}
-inline ::google::protobuf::RepeatedField< double >*
-BlobProto::mutable_double_diff() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.BlobProto.double_diff)
-  return &double_diff_;
-}
-
-// optional int32 num = 1 [default = 0];
-inline bool BlobProto::has_num() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void BlobProto::set_has_num() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void BlobProto::clear_has_num() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void BlobProto::clear_num() {
-  num_ = 0;
-  clear_has_num();
-}
-inline ::google::protobuf::int32 BlobProto::num() const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.num)
-  return num_;
-}
-inline void BlobProto::set_num(::google::protobuf::int32 value) {
-  set_has_num();
-  num_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.num)
-}
-
-// optional int32 channels = 2 [default = 0];
-inline bool BlobProto::has_channels() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void BlobProto::set_has_channels() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void BlobProto::clear_has_channels() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void BlobProto::clear_channels() {
-  channels_ = 0;
-  clear_has_channels();
-}
-inline ::google::protobuf::int32 BlobProto::channels() const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.channels)
-  return channels_;
-}
-inline void BlobProto::set_channels(::google::protobuf::int32 value) {
-  set_has_channels();
-  channels_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.channels)
-}
-
-// optional int32 height = 3 [default = 0];
-inline bool BlobProto::has_height() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void BlobProto::set_has_height() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void BlobProto::clear_has_height() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void BlobProto::clear_height() {
-  height_ = 0;
-  clear_has_height();
-}
-inline ::google::protobuf::int32 BlobProto::height() const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.height)
-  return height_;
-}
-inline void BlobProto::set_height(::google::protobuf::int32 value) {
-  set_has_height();
-  height_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.height)
-}
-
-// optional int32 width = 4 [default = 0];
-inline bool BlobProto::has_width() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void BlobProto::set_has_width() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void BlobProto::clear_has_width() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline void BlobProto::clear_width() {
-  width_ = 0;
-  clear_has_width();
-}
-inline ::google::protobuf::int32 BlobProto::width() const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProto.width)
-  return width_;
-}
-inline void BlobProto::set_width(::google::protobuf::int32 value) {
-  set_has_width();
-  width_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BlobProto.width)
-}
-
-// -------------------------------------------------------------------
-
-// BlobProtoVector
-
-// repeated .caffe.BlobProto blobs = 1;
-inline int BlobProtoVector::blobs_size() const {
-  return blobs_.size();
-}
-inline void BlobProtoVector::clear_blobs() {
-  blobs_.Clear();
-}
-inline const ::caffe::BlobProto& BlobProtoVector::blobs(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.BlobProtoVector.blobs)
-  return blobs_.Get(index);
-}
-inline ::caffe::BlobProto* BlobProtoVector::mutable_blobs(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.BlobProtoVector.blobs)
-  return blobs_.Mutable(index);
-}
-inline ::caffe::BlobProto* BlobProtoVector::add_blobs() {
-  // @@protoc_insertion_point(field_add:caffe.BlobProtoVector.blobs)
-  return blobs_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-BlobProtoVector::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.BlobProtoVector.blobs)
-  return blobs_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-BlobProtoVector::mutable_blobs() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.BlobProtoVector.blobs)
-  return &blobs_;
-}
-
-// -------------------------------------------------------------------
-
-// Datum
-
-// optional int32 channels = 1;
-inline bool Datum::has_channels() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Datum::set_has_channels() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Datum::clear_has_channels() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void Datum::clear_channels() {
-  channels_ = 0;
-  clear_has_channels();
-}
-inline ::google::protobuf::int32 Datum::channels() const {
-  // @@protoc_insertion_point(field_get:caffe.Datum.channels)
-  return channels_;
-}
-inline void Datum::set_channels(::google::protobuf::int32 value) {
-  set_has_channels();
-  channels_ = value;
-  // @@protoc_insertion_point(field_set:caffe.Datum.channels)
-}
-
-// optional int32 height = 2;
-inline bool Datum::has_height() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Datum::set_has_height() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Datum::clear_has_height() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void Datum::clear_height() {
-  height_ = 0;
-  clear_has_height();
-}
-inline ::google::protobuf::int32 Datum::height() const {
-  // @@protoc_insertion_point(field_get:caffe.Datum.height)
-  return height_;
-}
-inline void Datum::set_height(::google::protobuf::int32 value) {
-  set_has_height();
-  height_ = value;
-  // @@protoc_insertion_point(field_set:caffe.Datum.height)
-}
-
-// optional int32 width = 3;
-inline bool Datum::has_width() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void Datum::set_has_width() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void Datum::clear_has_width() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void Datum::clear_width() {
-  width_ = 0;
-  clear_has_width();
-}
-inline ::google::protobuf::int32 Datum::width() const {
-  // @@protoc_insertion_point(field_get:caffe.Datum.width)
-  return width_;
-}
-inline void Datum::set_width(::google::protobuf::int32 value) {
-  set_has_width();
-  width_ = value;
-  // @@protoc_insertion_point(field_set:caffe.Datum.width)
-}
-
-// optional bytes data = 4;
-inline bool Datum::has_data() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void Datum::set_has_data() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void Datum::clear_has_data() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void Datum::clear_data() {
-  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    data_->clear();
-  }
-  clear_has_data();
-}
-inline const ::std::string& Datum::data() const {
-  // @@protoc_insertion_point(field_get:caffe.Datum.data)
-  return *data_;
-}
-inline void Datum::set_data(const ::std::string& value) {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    data_ = new ::std::string;
-  }
-  data_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.Datum.data)
-}
-inline void Datum::set_data(const char* value) {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    data_ = new ::std::string;
-  }
-  data_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.Datum.data)
-}
-inline void Datum::set_data(const void* value, size_t size) {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    data_ = new ::std::string;
-  }
-  data_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.Datum.data)
-}
-inline ::std::string* Datum::mutable_data() {
-  set_has_data();
-  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    data_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.Datum.data)
-  return data_;
-}
-inline ::std::string* Datum::release_data() {
-  clear_has_data();
-  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = data_;
-    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void Datum::set_allocated_data(::std::string* data) {
-  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete data_;
-  }
-  if (data) {
-    set_has_data();
-    data_ = data;
-  } else {
-    clear_has_data();
-    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.Datum.data)
-}
-
-// optional int32 label = 5;
-inline bool Datum::has_label() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void Datum::set_has_label() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void Datum::clear_has_label() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void Datum::clear_label() {
-  label_ = 0;
-  clear_has_label();
-}
-inline ::google::protobuf::int32 Datum::label() const {
-  // @@protoc_insertion_point(field_get:caffe.Datum.label)
-  return label_;
-}
-inline void Datum::set_label(::google::protobuf::int32 value) {
-  set_has_label();
-  label_ = value;
-  // @@protoc_insertion_point(field_set:caffe.Datum.label)
-}
-
-// repeated float float_data = 6;
-inline int Datum::float_data_size() const {
-  return float_data_.size();
-}
-inline void Datum::clear_float_data() {
-  float_data_.Clear();
-}
-inline float Datum::float_data(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.Datum.float_data)
-  return float_data_.Get(index);
-}
-inline void Datum::set_float_data(int index, float value) {
-  float_data_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.Datum.float_data)
-}
-inline void Datum::add_float_data(float value) {
-  float_data_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.Datum.float_data)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-Datum::float_data() const {
-  // @@protoc_insertion_point(field_list:caffe.Datum.float_data)
-  return float_data_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-Datum::mutable_float_data() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.Datum.float_data)
-  return &float_data_;
-}
-
-// optional bool encoded = 7 [default = false];
-inline bool Datum::has_encoded() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void Datum::set_has_encoded() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void Datum::clear_has_encoded() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void Datum::clear_encoded() {
-  encoded_ = false;
-  clear_has_encoded();
-}
-inline bool Datum::encoded() const {
-  // @@protoc_insertion_point(field_get:caffe.Datum.encoded)
-  return encoded_;
-}
-inline void Datum::set_encoded(bool value) {
-  set_has_encoded();
-  encoded_ = value;
-  // @@protoc_insertion_point(field_set:caffe.Datum.encoded)
-}
-
-// -------------------------------------------------------------------
-
-// FillerParameter
-
-// optional string type = 1 [default = "constant"];
-inline bool FillerParameter::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void FillerParameter::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void FillerParameter::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void FillerParameter::clear_type() {
-  if (type_ != _default_type_) {
-    type_->assign(*_default_type_);
-  }
-  clear_has_type();
-}
-inline const ::std::string& FillerParameter::type() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.type)
-  return *type_;
-}
-inline void FillerParameter::set_type(const ::std::string& value) {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.type)
-}
-inline void FillerParameter::set_type(const char* value) {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.FillerParameter.type)
-}
-inline void FillerParameter::set_type(const char* value, size_t size) {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string;
-  }
-  type_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.FillerParameter.type)
-}
-inline ::std::string* FillerParameter::mutable_type() {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string(*_default_type_);
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.FillerParameter.type)
-  return type_;
-}
-inline ::std::string* FillerParameter::release_type() {
-  clear_has_type();
-  if (type_ == _default_type_) {
-    return NULL;
-  } else {
-    ::std::string* temp = type_;
-    type_ = const_cast< ::std::string*>(_default_type_);
-    return temp;
-  }
-}
-inline void FillerParameter::set_allocated_type(::std::string* type) {
-  if (type_ != _default_type_) {
-    delete type_;
-  }
-  if (type) {
-    set_has_type();
-    type_ = type;
-  } else {
-    clear_has_type();
-    type_ = const_cast< ::std::string*>(_default_type_);
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.FillerParameter.type)
-}
-
-// optional float value = 2 [default = 0];
-inline bool FillerParameter::has_value() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void FillerParameter::set_has_value() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void FillerParameter::clear_has_value() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void FillerParameter::clear_value() {
-  value_ = 0;
-  clear_has_value();
-}
-inline float FillerParameter::value() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.value)
-  return value_;
-}
-inline void FillerParameter::set_value(float value) {
-  set_has_value();
-  value_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.value)
-}
-
-// optional float min = 3 [default = 0];
-inline bool FillerParameter::has_min() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void FillerParameter::set_has_min() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void FillerParameter::clear_has_min() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void FillerParameter::clear_min() {
-  min_ = 0;
-  clear_has_min();
-}
-inline float FillerParameter::min() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.min)
-  return min_;
-}
-inline void FillerParameter::set_min(float value) {
-  set_has_min();
-  min_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.min)
-}
-
-// optional float max = 4 [default = 1];
-inline bool FillerParameter::has_max() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void FillerParameter::set_has_max() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void FillerParameter::clear_has_max() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void FillerParameter::clear_max() {
-  max_ = 1;
-  clear_has_max();
-}
-inline float FillerParameter::max() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.max)
-  return max_;
-}
-inline void FillerParameter::set_max(float value) {
-  set_has_max();
-  max_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.max)
-}
-
-// optional float mean = 5 [default = 0];
-inline bool FillerParameter::has_mean() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void FillerParameter::set_has_mean() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void FillerParameter::clear_has_mean() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void FillerParameter::clear_mean() {
-  mean_ = 0;
-  clear_has_mean();
-}
-inline float FillerParameter::mean() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.mean)
-  return mean_;
-}
-inline void FillerParameter::set_mean(float value) {
-  set_has_mean();
-  mean_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.mean)
-}
-
-// optional float std = 6 [default = 1];
-inline bool FillerParameter::has_std() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void FillerParameter::set_has_std() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void FillerParameter::clear_has_std() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void FillerParameter::clear_std() {
-  std_ = 1;
-  clear_has_std();
-}
-inline float FillerParameter::std() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.std)
-  return std_;
-}
-inline void FillerParameter::set_std(float value) {
-  set_has_std();
-  std_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.std)
-}
-
-// optional int32 sparse = 7 [default = -1];
-inline bool FillerParameter::has_sparse() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void FillerParameter::set_has_sparse() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void FillerParameter::clear_has_sparse() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void FillerParameter::clear_sparse() {
-  sparse_ = -1;
-  clear_has_sparse();
-}
-inline ::google::protobuf::int32 FillerParameter::sparse() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.sparse)
-  return sparse_;
-}
-inline void FillerParameter::set_sparse(::google::protobuf::int32 value) {
-  set_has_sparse();
-  sparse_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.sparse)
-}
-
-// optional .caffe.FillerParameter.VarianceNorm variance_norm = 8 [default = FAN_IN];
-inline bool FillerParameter::has_variance_norm() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void FillerParameter::set_has_variance_norm() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void FillerParameter::clear_has_variance_norm() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void FillerParameter::clear_variance_norm() {
-  variance_norm_ = 0;
-  clear_has_variance_norm();
-}
-inline ::caffe::FillerParameter_VarianceNorm FillerParameter::variance_norm() const {
-  // @@protoc_insertion_point(field_get:caffe.FillerParameter.variance_norm)
-  return static_cast< ::caffe::FillerParameter_VarianceNorm >(variance_norm_);
-}
-inline void FillerParameter::set_variance_norm(::caffe::FillerParameter_VarianceNorm value) {
-  assert(::caffe::FillerParameter_VarianceNorm_IsValid(value));
-  set_has_variance_norm();
-  variance_norm_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FillerParameter.variance_norm)
-}
-
-// -------------------------------------------------------------------
-
-// NetParameter
-
-// optional string name = 1;
-inline bool NetParameter::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void NetParameter::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void NetParameter::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void NetParameter::clear_name() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& NetParameter::name() const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.name)
-  return *name_;
-}
-inline void NetParameter::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.NetParameter.name)
-}
-inline void NetParameter::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.NetParameter.name)
-}
-inline void NetParameter::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.NetParameter.name)
-}
-inline ::std::string* NetParameter::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.NetParameter.name)
-  return name_;
-}
-inline ::std::string* NetParameter::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void NetParameter::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.NetParameter.name)
-}
-
-// repeated string input = 3;
-inline int NetParameter::input_size() const {
-  return input_.size();
-}
-inline void NetParameter::clear_input() {
-  input_.Clear();
-}
-inline const ::std::string& NetParameter::input(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.input)
-  return input_.Get(index);
-}
-inline ::std::string* NetParameter::mutable_input(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.NetParameter.input)
-  return input_.Mutable(index);
-}
-inline void NetParameter::set_input(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.NetParameter.input)
-  input_.Mutable(index)->assign(value);
-}
-inline void NetParameter::set_input(int index, const char* value) {
-  input_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.NetParameter.input)
-}
-inline void NetParameter::set_input(int index, const char* value, size_t size) {
-  input_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.NetParameter.input)
-}
-inline ::std::string* NetParameter::add_input() {
-  return input_.Add();
-}
-inline void NetParameter::add_input(const ::std::string& value) {
-  input_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.NetParameter.input)
-}
-inline void NetParameter::add_input(const char* value) {
-  input_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.NetParameter.input)
-}
-inline void NetParameter::add_input(const char* value, size_t size) {
-  input_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.NetParameter.input)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-NetParameter::input() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.input)
-  return input_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-NetParameter::mutable_input() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.input)
-  return &input_;
-}
-
-// repeated .caffe.BlobShape input_shape = 8;
-inline int NetParameter::input_shape_size() const {
-  return input_shape_.size();
-}
-inline void NetParameter::clear_input_shape() {
-  input_shape_.Clear();
-}
-inline const ::caffe::BlobShape& NetParameter::input_shape(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.input_shape)
-  return input_shape_.Get(index);
-}
-inline ::caffe::BlobShape* NetParameter::mutable_input_shape(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.NetParameter.input_shape)
-  return input_shape_.Mutable(index);
-}
-inline ::caffe::BlobShape* NetParameter::add_input_shape() {
-  // @@protoc_insertion_point(field_add:caffe.NetParameter.input_shape)
-  return input_shape_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-NetParameter::input_shape() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.input_shape)
-  return input_shape_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
-NetParameter::mutable_input_shape() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.input_shape)
-  return &input_shape_;
-}
-
-// repeated int32 input_dim = 4;
-inline int NetParameter::input_dim_size() const {
-  return input_dim_.size();
-}
-inline void NetParameter::clear_input_dim() {
-  input_dim_.Clear();
-}
-inline ::google::protobuf::int32 NetParameter::input_dim(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.input_dim)
-  return input_dim_.Get(index);
-}
-inline void NetParameter::set_input_dim(int index, ::google::protobuf::int32 value) {
-  input_dim_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.NetParameter.input_dim)
-}
-inline void NetParameter::add_input_dim(::google::protobuf::int32 value) {
-  input_dim_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.NetParameter.input_dim)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-NetParameter::input_dim() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.input_dim)
-  return input_dim_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-NetParameter::mutable_input_dim() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.input_dim)
-  return &input_dim_;
-}
-
-// optional bool force_backward = 5 [default = false];
-inline bool NetParameter::has_force_backward() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void NetParameter::set_has_force_backward() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void NetParameter::clear_has_force_backward() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void NetParameter::clear_force_backward() {
-  force_backward_ = false;
-  clear_has_force_backward();
-}
-inline bool NetParameter::force_backward() const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.force_backward)
-  return force_backward_;
-}
-inline void NetParameter::set_force_backward(bool value) {
-  set_has_force_backward();
-  force_backward_ = value;
-  // @@protoc_insertion_point(field_set:caffe.NetParameter.force_backward)
-}
-
-// optional .caffe.NetState state = 6;
-inline bool NetParameter::has_state() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void NetParameter::set_has_state() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void NetParameter::clear_has_state() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void NetParameter::clear_state() {
-  if (state_ != NULL) state_->::caffe::NetState::Clear();
-  clear_has_state();
-}
-inline const ::caffe::NetState& NetParameter::state() const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.state)
-  return state_ != NULL ? *state_ : *default_instance_->state_;
-}
-inline ::caffe::NetState* NetParameter::mutable_state() {
-  set_has_state();
-  if (state_ == NULL) state_ = new ::caffe::NetState;
-  // @@protoc_insertion_point(field_mutable:caffe.NetParameter.state)
-  return state_;
-}
-inline ::caffe::NetState* NetParameter::release_state() {
-  clear_has_state();
-  ::caffe::NetState* temp = state_;
-  state_ = NULL;
-  return temp;
-}
-inline void NetParameter::set_allocated_state(::caffe::NetState* state) {
-  delete state_;
-  state_ = state;
-  if (state) {
-    set_has_state();
-  } else {
-    clear_has_state();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.NetParameter.state)
-}
-
-// optional bool debug_info = 7 [default = false];
-inline bool NetParameter::has_debug_info() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void NetParameter::set_has_debug_info() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void NetParameter::clear_has_debug_info() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void NetParameter::clear_debug_info() {
-  debug_info_ = false;
-  clear_has_debug_info();
-}
-inline bool NetParameter::debug_info() const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.debug_info)
-  return debug_info_;
-}
-inline void NetParameter::set_debug_info(bool value) {
-  set_has_debug_info();
-  debug_info_ = value;
-  // @@protoc_insertion_point(field_set:caffe.NetParameter.debug_info)
-}
-
-// repeated .caffe.LayerParameter layer = 100;
-inline int NetParameter::layer_size() const {
-  return layer_.size();
-}
-inline void NetParameter::clear_layer() {
-  layer_.Clear();
-}
-inline const ::caffe::LayerParameter& NetParameter::layer(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.layer)
-  return layer_.Get(index);
-}
-inline ::caffe::LayerParameter* NetParameter::mutable_layer(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.NetParameter.layer)
-  return layer_.Mutable(index);
-}
-inline ::caffe::LayerParameter* NetParameter::add_layer() {
-  // @@protoc_insertion_point(field_add:caffe.NetParameter.layer)
-  return layer_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >&
-NetParameter::layer() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.layer)
-  return layer_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >*
-NetParameter::mutable_layer() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.layer)
-  return &layer_;
-}
-
-// repeated .caffe.V1LayerParameter layers = 2;
-inline int NetParameter::layers_size() const {
-  return layers_.size();
-}
-inline void NetParameter::clear_layers() {
-  layers_.Clear();
-}
-inline const ::caffe::V1LayerParameter& NetParameter::layers(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetParameter.layers)
-  return layers_.Get(index);
-}
-inline ::caffe::V1LayerParameter* NetParameter::mutable_layers(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.NetParameter.layers)
-  return layers_.Mutable(index);
-}
-inline ::caffe::V1LayerParameter* NetParameter::add_layers() {
-  // @@protoc_insertion_point(field_add:caffe.NetParameter.layers)
-  return layers_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >&
-NetParameter::layers() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.layers)
-  return layers_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >*
-NetParameter::mutable_layers() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.layers)
-  return &layers_;
-}
-
-// -------------------------------------------------------------------
-
-// SolverParameter
-
-// optional string net = 24;
-inline bool SolverParameter::has_net() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SolverParameter::set_has_net() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SolverParameter::clear_has_net() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SolverParameter::clear_net() {
-  if (net_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    net_->clear();
-  }
-  clear_has_net();
-}
-inline const ::std::string& SolverParameter::net() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.net)
-  return *net_;
-}
-inline void SolverParameter::set_net(const ::std::string& value) {
-  set_has_net();
-  if (net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    net_ = new ::std::string;
-  }
-  net_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.net)
-}
-inline void SolverParameter::set_net(const char* value) {
-  set_has_net();
-  if (net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    net_ = new ::std::string;
-  }
-  net_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.net)
-}
-inline void SolverParameter::set_net(const char* value, size_t size) {
-  set_has_net();
-  if (net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    net_ = new ::std::string;
-  }
-  net_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.net)
-}
-inline ::std::string* SolverParameter::mutable_net() {
-  set_has_net();
-  if (net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    net_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.net)
-  return net_;
-}
-inline ::std::string* SolverParameter::release_net() {
-  clear_has_net();
-  if (net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = net_;
-    net_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void SolverParameter::set_allocated_net(::std::string* net) {
-  if (net_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete net_;
-  }
-  if (net) {
-    set_has_net();
-    net_ = net;
-  } else {
-    clear_has_net();
-    net_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.net)
-}
-
-// optional .caffe.NetParameter net_param = 25;
-inline bool SolverParameter::has_net_param() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SolverParameter::set_has_net_param() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SolverParameter::clear_has_net_param() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void SolverParameter::clear_net_param() {
-  if (net_param_ != NULL) net_param_->::caffe::NetParameter::Clear();
-  clear_has_net_param();
-}
-inline const ::caffe::NetParameter& SolverParameter::net_param() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.net_param)
-  return net_param_ != NULL ? *net_param_ : *default_instance_->net_param_;
-}
-inline ::caffe::NetParameter* SolverParameter::mutable_net_param() {
-  set_has_net_param();
-  if (net_param_ == NULL) net_param_ = new ::caffe::NetParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.net_param)
-  return net_param_;
-}
-inline ::caffe::NetParameter* SolverParameter::release_net_param() {
-  clear_has_net_param();
-  ::caffe::NetParameter* temp = net_param_;
-  net_param_ = NULL;
-  return temp;
-}
-inline void SolverParameter::set_allocated_net_param(::caffe::NetParameter* net_param) {
-  delete net_param_;
-  net_param_ = net_param;
-  if (net_param) {
-    set_has_net_param();
-  } else {
-    clear_has_net_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.net_param)
-}
-
-// optional string train_net = 1;
-inline bool SolverParameter::has_train_net() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void SolverParameter::set_has_train_net() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void SolverParameter::clear_has_train_net() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void SolverParameter::clear_train_net() {
-  if (train_net_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    train_net_->clear();
-  }
-  clear_has_train_net();
-}
-inline const ::std::string& SolverParameter::train_net() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.train_net)
-  return *train_net_;
-}
-inline void SolverParameter::set_train_net(const ::std::string& value) {
-  set_has_train_net();
-  if (train_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    train_net_ = new ::std::string;
-  }
-  train_net_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.train_net)
-}
-inline void SolverParameter::set_train_net(const char* value) {
-  set_has_train_net();
-  if (train_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    train_net_ = new ::std::string;
-  }
-  train_net_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.train_net)
-}
-inline void SolverParameter::set_train_net(const char* value, size_t size) {
-  set_has_train_net();
-  if (train_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    train_net_ = new ::std::string;
-  }
-  train_net_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.train_net)
-}
-inline ::std::string* SolverParameter::mutable_train_net() {
-  set_has_train_net();
-  if (train_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    train_net_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.train_net)
-  return train_net_;
-}
-inline ::std::string* SolverParameter::release_train_net() {
-  clear_has_train_net();
-  if (train_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = train_net_;
-    train_net_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void SolverParameter::set_allocated_train_net(::std::string* train_net) {
-  if (train_net_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete train_net_;
-  }
-  if (train_net) {
-    set_has_train_net();
-    train_net_ = train_net;
-  } else {
-    clear_has_train_net();
-    train_net_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.train_net)
-}
-
-// repeated string test_net = 2;
-inline int SolverParameter::test_net_size() const {
-  return test_net_.size();
-}
-inline void SolverParameter::clear_test_net() {
-  test_net_.Clear();
-}
-inline const ::std::string& SolverParameter::test_net(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_net)
-  return test_net_.Get(index);
-}
-inline ::std::string* SolverParameter::mutable_test_net(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.test_net)
-  return test_net_.Mutable(index);
-}
-inline void SolverParameter::set_test_net(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_net)
-  test_net_.Mutable(index)->assign(value);
-}
-inline void SolverParameter::set_test_net(int index, const char* value) {
-  test_net_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.test_net)
-}
-inline void SolverParameter::set_test_net(int index, const char* value, size_t size) {
-  test_net_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.test_net)
-}
-inline ::std::string* SolverParameter::add_test_net() {
-  return test_net_.Add();
-}
-inline void SolverParameter::add_test_net(const ::std::string& value) {
-  test_net_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.SolverParameter.test_net)
-}
-inline void SolverParameter::add_test_net(const char* value) {
-  test_net_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.SolverParameter.test_net)
-}
-inline void SolverParameter::add_test_net(const char* value, size_t size) {
-  test_net_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.SolverParameter.test_net)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-SolverParameter::test_net() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_net)
-  return test_net_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-SolverParameter::mutable_test_net() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.SolverParameter.test_net)
-  return &test_net_;
-}
-
-// optional .caffe.NetParameter train_net_param = 21;
-inline bool SolverParameter::has_train_net_param() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void SolverParameter::set_has_train_net_param() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void SolverParameter::clear_has_train_net_param() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void SolverParameter::clear_train_net_param() {
-  if (train_net_param_ != NULL) train_net_param_->::caffe::NetParameter::Clear();
-  clear_has_train_net_param();
-}
-inline const ::caffe::NetParameter& SolverParameter::train_net_param() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.train_net_param)
-  return train_net_param_ != NULL ? *train_net_param_ : *default_instance_->train_net_param_;
-}
-inline ::caffe::NetParameter* SolverParameter::mutable_train_net_param() {
-  set_has_train_net_param();
-  if (train_net_param_ == NULL) train_net_param_ = new ::caffe::NetParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.train_net_param)
-  return train_net_param_;
-}
-inline ::caffe::NetParameter* SolverParameter::release_train_net_param() {
-  clear_has_train_net_param();
-  ::caffe::NetParameter* temp = train_net_param_;
-  train_net_param_ = NULL;
-  return temp;
-}
-inline void SolverParameter::set_allocated_train_net_param(::caffe::NetParameter* train_net_param) {
-  delete train_net_param_;
-  train_net_param_ = train_net_param;
-  if (train_net_param) {
-    set_has_train_net_param();
-  } else {
-    clear_has_train_net_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.train_net_param)
-}
-
-// repeated .caffe.NetParameter test_net_param = 22;
-inline int SolverParameter::test_net_param_size() const {
-  return test_net_param_.size();
-}
-inline void SolverParameter::clear_test_net_param() {
-  test_net_param_.Clear();
-}
-inline const ::caffe::NetParameter& SolverParameter::test_net_param(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_net_param)
-  return test_net_param_.Get(index);
-}
-inline ::caffe::NetParameter* SolverParameter::mutable_test_net_param(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.test_net_param)
-  return test_net_param_.Mutable(index);
-}
-inline ::caffe::NetParameter* SolverParameter::add_test_net_param() {
-  // @@protoc_insertion_point(field_add:caffe.SolverParameter.test_net_param)
-  return test_net_param_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >&
-SolverParameter::test_net_param() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_net_param)
-  return test_net_param_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >*
-SolverParameter::mutable_test_net_param() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.SolverParameter.test_net_param)
-  return &test_net_param_;
-}
-
-// optional .caffe.NetState train_state = 26;
-inline bool SolverParameter::has_train_state() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void SolverParameter::set_has_train_state() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void SolverParameter::clear_has_train_state() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void SolverParameter::clear_train_state() {
-  if (train_state_ != NULL) train_state_->::caffe::NetState::Clear();
-  clear_has_train_state();
-}
-inline const ::caffe::NetState& SolverParameter::train_state() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.train_state)
-  return train_state_ != NULL ? *train_state_ : *default_instance_->train_state_;
-}
-inline ::caffe::NetState* SolverParameter::mutable_train_state() {
-  set_has_train_state();
-  if (train_state_ == NULL) train_state_ = new ::caffe::NetState;
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.train_state)
-  return train_state_;
-}
-inline ::caffe::NetState* SolverParameter::release_train_state() {
-  clear_has_train_state();
-  ::caffe::NetState* temp = train_state_;
-  train_state_ = NULL;
-  return temp;
-}
-inline void SolverParameter::set_allocated_train_state(::caffe::NetState* train_state) {
-  delete train_state_;
-  train_state_ = train_state;
-  if (train_state) {
-    set_has_train_state();
-  } else {
-    clear_has_train_state();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.train_state)
-}
-
-// repeated .caffe.NetState test_state = 27;
-inline int SolverParameter::test_state_size() const {
-  return test_state_.size();
-}
-inline void SolverParameter::clear_test_state() {
-  test_state_.Clear();
-}
-inline const ::caffe::NetState& SolverParameter::test_state(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_state)
-  return test_state_.Get(index);
-}
-inline ::caffe::NetState* SolverParameter::mutable_test_state(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.test_state)
-  return test_state_.Mutable(index);
-}
-inline ::caffe::NetState* SolverParameter::add_test_state() {
-  // @@protoc_insertion_point(field_add:caffe.SolverParameter.test_state)
-  return test_state_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetState >&
-SolverParameter::test_state() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_state)
-  return test_state_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::NetState >*
-SolverParameter::mutable_test_state() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.SolverParameter.test_state)
-  return &test_state_;
-}
-
-// repeated int32 test_iter = 3;
-inline int SolverParameter::test_iter_size() const {
-  return test_iter_.size();
-}
-inline void SolverParameter::clear_test_iter() {
-  test_iter_.Clear();
-}
-inline ::google::protobuf::int32 SolverParameter::test_iter(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_iter)
-  return test_iter_.Get(index);
-}
-inline void SolverParameter::set_test_iter(int index, ::google::protobuf::int32 value) {
-  test_iter_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_iter)
-}
-inline void SolverParameter::add_test_iter(::google::protobuf::int32 value) {
-  test_iter_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.SolverParameter.test_iter)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-SolverParameter::test_iter() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_iter)
-  return test_iter_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-SolverParameter::mutable_test_iter() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.SolverParameter.test_iter)
-  return &test_iter_;
-}
-
-// optional int32 test_interval = 4 [default = 0];
-inline bool SolverParameter::has_test_interval() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void SolverParameter::set_has_test_interval() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void SolverParameter::clear_has_test_interval() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-inline void SolverParameter::clear_test_interval() {
-  test_interval_ = 0;
-  clear_has_test_interval();
-}
-inline ::google::protobuf::int32 SolverParameter::test_interval() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_interval)
-  return test_interval_;
-}
-inline void SolverParameter::set_test_interval(::google::protobuf::int32 value) {
-  set_has_test_interval();
-  test_interval_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_interval)
-}
-
-// optional bool test_compute_loss = 19 [default = false];
-inline bool SolverParameter::has_test_compute_loss() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void SolverParameter::set_has_test_compute_loss() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void SolverParameter::clear_has_test_compute_loss() {
-  _has_bits_[0] &= ~0x00000400u;
-}
-inline void SolverParameter::clear_test_compute_loss() {
-  test_compute_loss_ = false;
-  clear_has_test_compute_loss();
-}
-inline bool SolverParameter::test_compute_loss() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_compute_loss)
-  return test_compute_loss_;
-}
-inline void SolverParameter::set_test_compute_loss(bool value) {
-  set_has_test_compute_loss();
-  test_compute_loss_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_compute_loss)
-}
-
-// optional bool test_initialization = 32 [default = true];
-inline bool SolverParameter::has_test_initialization() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void SolverParameter::set_has_test_initialization() {
-  _has_bits_[0] |= 0x00000800u;
-}
-inline void SolverParameter::clear_has_test_initialization() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-inline void SolverParameter::clear_test_initialization() {
-  test_initialization_ = true;
-  clear_has_test_initialization();
-}
-inline bool SolverParameter::test_initialization() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_initialization)
-  return test_initialization_;
-}
-inline void SolverParameter::set_test_initialization(bool value) {
-  set_has_test_initialization();
-  test_initialization_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_initialization)
-}
-
-// optional float base_lr = 5;
-inline bool SolverParameter::has_base_lr() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-inline void SolverParameter::set_has_base_lr() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void SolverParameter::clear_has_base_lr() {
-  _has_bits_[0] &= ~0x00001000u;
-}
-inline void SolverParameter::clear_base_lr() {
-  base_lr_ = 0;
-  clear_has_base_lr();
-}
-inline float SolverParameter::base_lr() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.base_lr)
-  return base_lr_;
-}
-inline void SolverParameter::set_base_lr(float value) {
-  set_has_base_lr();
-  base_lr_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.base_lr)
-}
-
-// optional int32 display = 6;
-inline bool SolverParameter::has_display() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void SolverParameter::set_has_display() {
-  _has_bits_[0] |= 0x00002000u;
-}
-inline void SolverParameter::clear_has_display() {
-  _has_bits_[0] &= ~0x00002000u;
-}
-inline void SolverParameter::clear_display() {
-  display_ = 0;
-  clear_has_display();
-}
-inline ::google::protobuf::int32 SolverParameter::display() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.display)
-  return display_;
-}
-inline void SolverParameter::set_display(::google::protobuf::int32 value) {
-  set_has_display();
-  display_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.display)
-}
-
-// optional int32 average_loss = 33 [default = 1];
-inline bool SolverParameter::has_average_loss() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
-}
-inline void SolverParameter::set_has_average_loss() {
-  _has_bits_[0] |= 0x00004000u;
-}
-inline void SolverParameter::clear_has_average_loss() {
-  _has_bits_[0] &= ~0x00004000u;
-}
-inline void SolverParameter::clear_average_loss() {
-  average_loss_ = 1;
-  clear_has_average_loss();
-}
-inline ::google::protobuf::int32 SolverParameter::average_loss() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.average_loss)
-  return average_loss_;
-}
-inline void SolverParameter::set_average_loss(::google::protobuf::int32 value) {
-  set_has_average_loss();
-  average_loss_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.average_loss)
-}
-
-// optional int32 max_iter = 7;
-inline bool SolverParameter::has_max_iter() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-inline void SolverParameter::set_has_max_iter() {
-  _has_bits_[0] |= 0x00008000u;
-}
-inline void SolverParameter::clear_has_max_iter() {
-  _has_bits_[0] &= ~0x00008000u;
-}
-inline void SolverParameter::clear_max_iter() {
-  max_iter_ = 0;
-  clear_has_max_iter();
-}
-inline ::google::protobuf::int32 SolverParameter::max_iter() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.max_iter)
-  return max_iter_;
-}
-inline void SolverParameter::set_max_iter(::google::protobuf::int32 value) {
-  set_has_max_iter();
-  max_iter_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.max_iter)
-}
-
-// optional int32 iter_size = 36 [default = 1];
-inline bool SolverParameter::has_iter_size() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
-}
-inline void SolverParameter::set_has_iter_size() {
-  _has_bits_[0] |= 0x00010000u;
-}
-inline void SolverParameter::clear_has_iter_size() {
-  _has_bits_[0] &= ~0x00010000u;
-}
-inline void SolverParameter::clear_iter_size() {
-  iter_size_ = 1;
-  clear_has_iter_size();
-}
-inline ::google::protobuf::int32 SolverParameter::iter_size() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.iter_size)
-  return iter_size_;
-}
-inline void SolverParameter::set_iter_size(::google::protobuf::int32 value) {
-  set_has_iter_size();
-  iter_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.iter_size)
-}
-
-// optional string lr_policy = 8;
-inline bool SolverParameter::has_lr_policy() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
-}
-inline void SolverParameter::set_has_lr_policy() {
-  _has_bits_[0] |= 0x00020000u;
-}
-inline void SolverParameter::clear_has_lr_policy() {
-  _has_bits_[0] &= ~0x00020000u;
-}
-inline void SolverParameter::clear_lr_policy() {
-  if (lr_policy_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    lr_policy_->clear();
-  }
-  clear_has_lr_policy();
-}
-inline const ::std::string& SolverParameter::lr_policy() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.lr_policy)
-  return *lr_policy_;
-}
-inline void SolverParameter::set_lr_policy(const ::std::string& value) {
-  set_has_lr_policy();
-  if (lr_policy_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    lr_policy_ = new ::std::string;
-  }
-  lr_policy_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.lr_policy)
-}
-inline void SolverParameter::set_lr_policy(const char* value) {
-  set_has_lr_policy();
-  if (lr_policy_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    lr_policy_ = new ::std::string;
-  }
-  lr_policy_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.lr_policy)
-}
-inline void SolverParameter::set_lr_policy(const char* value, size_t size) {
-  set_has_lr_policy();
-  if (lr_policy_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    lr_policy_ = new ::std::string;
-  }
-  lr_policy_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.lr_policy)
-}
-inline ::std::string* SolverParameter::mutable_lr_policy() {
-  set_has_lr_policy();
-  if (lr_policy_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    lr_policy_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.lr_policy)
-  return lr_policy_;
-}
-inline ::std::string* SolverParameter::release_lr_policy() {
-  clear_has_lr_policy();
-  if (lr_policy_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = lr_policy_;
-    lr_policy_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void SolverParameter::set_allocated_lr_policy(::std::string* lr_policy) {
-  if (lr_policy_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete lr_policy_;
-  }
-  if (lr_policy) {
-    set_has_lr_policy();
-    lr_policy_ = lr_policy;
-  } else {
-    clear_has_lr_policy();
-    lr_policy_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.lr_policy)
-}
-
-// optional float gamma = 9;
-inline bool SolverParameter::has_gamma() const {
-  return (_has_bits_[0] & 0x00040000u) != 0;
-}
-inline void SolverParameter::set_has_gamma() {
-  _has_bits_[0] |= 0x00040000u;
-}
-inline void SolverParameter::clear_has_gamma() {
-  _has_bits_[0] &= ~0x00040000u;
-}
-inline void SolverParameter::clear_gamma() {
-  gamma_ = 0;
-  clear_has_gamma();
-}
-inline float SolverParameter::gamma() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.gamma)
-  return gamma_;
-}
-inline void SolverParameter::set_gamma(float value) {
-  set_has_gamma();
-  gamma_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.gamma)
-}
-
-// optional float power = 10;
-inline bool SolverParameter::has_power() const {
-  return (_has_bits_[0] & 0x00080000u) != 0;
-}
-inline void SolverParameter::set_has_power() {
-  _has_bits_[0] |= 0x00080000u;
-}
-inline void SolverParameter::clear_has_power() {
-  _has_bits_[0] &= ~0x00080000u;
-}
-inline void SolverParameter::clear_power() {
-  power_ = 0;
-  clear_has_power();
-}
-inline float SolverParameter::power() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.power)
-  return power_;
-}
-inline void SolverParameter::set_power(float value) {
-  set_has_power();
-  power_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.power)
-}
-
-// optional float momentum = 11;
-inline bool SolverParameter::has_momentum() const {
-  return (_has_bits_[0] & 0x00100000u) != 0;
-}
-inline void SolverParameter::set_has_momentum() {
-  _has_bits_[0] |= 0x00100000u;
-}
-inline void SolverParameter::clear_has_momentum() {
-  _has_bits_[0] &= ~0x00100000u;
-}
-inline void SolverParameter::clear_momentum() {
-  momentum_ = 0;
-  clear_has_momentum();
-}
-inline float SolverParameter::momentum() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.momentum)
-  return momentum_;
-}
-inline void SolverParameter::set_momentum(float value) {
-  set_has_momentum();
-  momentum_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.momentum)
-}
-
-// optional float weight_decay = 12;
-inline bool SolverParameter::has_weight_decay() const {
-  return (_has_bits_[0] & 0x00200000u) != 0;
-}
-inline void SolverParameter::set_has_weight_decay() {
-  _has_bits_[0] |= 0x00200000u;
-}
-inline void SolverParameter::clear_has_weight_decay() {
-  _has_bits_[0] &= ~0x00200000u;
-}
-inline void SolverParameter::clear_weight_decay() {
-  weight_decay_ = 0;
-  clear_has_weight_decay();
-}
-inline float SolverParameter::weight_decay() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.weight_decay)
-  return weight_decay_;
-}
-inline void SolverParameter::set_weight_decay(float value) {
-  set_has_weight_decay();
-  weight_decay_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.weight_decay)
-}
-
-// optional string regularization_type = 29 [default = "L2"];
-inline bool SolverParameter::has_regularization_type() const {
-  return (_has_bits_[0] & 0x00400000u) != 0;
-}
-inline void SolverParameter::set_has_regularization_type() {
-  _has_bits_[0] |= 0x00400000u;
-}
-inline void SolverParameter::clear_has_regularization_type() {
-  _has_bits_[0] &= ~0x00400000u;
-}
-inline void SolverParameter::clear_regularization_type() {
-  if (regularization_type_ != _default_regularization_type_) {
-    regularization_type_->assign(*_default_regularization_type_);
-  }
-  clear_has_regularization_type();
-}
-inline const ::std::string& SolverParameter::regularization_type() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.regularization_type)
-  return *regularization_type_;
-}
-inline void SolverParameter::set_regularization_type(const ::std::string& value) {
-  set_has_regularization_type();
-  if (regularization_type_ == _default_regularization_type_) {
-    regularization_type_ = new ::std::string;
-  }
-  regularization_type_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.regularization_type)
-}
-inline void SolverParameter::set_regularization_type(const char* value) {
-  set_has_regularization_type();
-  if (regularization_type_ == _default_regularization_type_) {
-    regularization_type_ = new ::std::string;
-  }
-  regularization_type_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.regularization_type)
-}
-inline void SolverParameter::set_regularization_type(const char* value, size_t size) {
-  set_has_regularization_type();
-  if (regularization_type_ == _default_regularization_type_) {
-    regularization_type_ = new ::std::string;
-  }
-  regularization_type_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.regularization_type)
-}
-inline ::std::string* SolverParameter::mutable_regularization_type() {
-  set_has_regularization_type();
-  if (regularization_type_ == _default_regularization_type_) {
-    regularization_type_ = new ::std::string(*_default_regularization_type_);
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.regularization_type)
-  return regularization_type_;
-}
-inline ::std::string* SolverParameter::release_regularization_type() {
-  clear_has_regularization_type();
-  if (regularization_type_ == _default_regularization_type_) {
-    return NULL;
-  } else {
-    ::std::string* temp = regularization_type_;
-    regularization_type_ = const_cast< ::std::string*>(_default_regularization_type_);
-    return temp;
-  }
-}
-inline void SolverParameter::set_allocated_regularization_type(::std::string* regularization_type) {
-  if (regularization_type_ != _default_regularization_type_) {
-    delete regularization_type_;
-  }
-  if (regularization_type) {
-    set_has_regularization_type();
-    regularization_type_ = regularization_type;
-  } else {
-    clear_has_regularization_type();
-    regularization_type_ = const_cast< ::std::string*>(_default_regularization_type_);
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.regularization_type)
-}
-
-// optional int32 stepsize = 13;
-inline bool SolverParameter::has_stepsize() const {
-  return (_has_bits_[0] & 0x00800000u) != 0;
-}
-inline void SolverParameter::set_has_stepsize() {
-  _has_bits_[0] |= 0x00800000u;
-}
-inline void SolverParameter::clear_has_stepsize() {
-  _has_bits_[0] &= ~0x00800000u;
-}
-inline void SolverParameter::clear_stepsize() {
-  stepsize_ = 0;
-  clear_has_stepsize();
-}
-inline ::google::protobuf::int32 SolverParameter::stepsize() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.stepsize)
-  return stepsize_;
-}
-inline void SolverParameter::set_stepsize(::google::protobuf::int32 value) {
-  set_has_stepsize();
-  stepsize_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.stepsize)
-}
-
-// repeated int32 stepvalue = 34;
-inline int SolverParameter::stepvalue_size() const {
-  return stepvalue_.size();
-}
-inline void SolverParameter::clear_stepvalue() {
-  stepvalue_.Clear();
-}
-inline ::google::protobuf::int32 SolverParameter::stepvalue(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.stepvalue)
-  return stepvalue_.Get(index);
-}
-inline void SolverParameter::set_stepvalue(int index, ::google::protobuf::int32 value) {
-  stepvalue_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.stepvalue)
-}
-inline void SolverParameter::add_stepvalue(::google::protobuf::int32 value) {
-  stepvalue_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.SolverParameter.stepvalue)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-SolverParameter::stepvalue() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverParameter.stepvalue)
-  return stepvalue_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-SolverParameter::mutable_stepvalue() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.SolverParameter.stepvalue)
-  return &stepvalue_;
-}
-
-// optional float clip_gradients = 35 [default = -1];
-inline bool SolverParameter::has_clip_gradients() const {
-  return (_has_bits_[0] & 0x02000000u) != 0;
-}
-inline void SolverParameter::set_has_clip_gradients() {
-  _has_bits_[0] |= 0x02000000u;
-}
-inline void SolverParameter::clear_has_clip_gradients() {
-  _has_bits_[0] &= ~0x02000000u;
-}
-inline void SolverParameter::clear_clip_gradients() {
-  clip_gradients_ = -1;
-  clear_has_clip_gradients();
-}
-inline float SolverParameter::clip_gradients() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.clip_gradients)
-  return clip_gradients_;
-}
-inline void SolverParameter::set_clip_gradients(float value) {
-  set_has_clip_gradients();
-  clip_gradients_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.clip_gradients)
-}
-
-// optional int32 snapshot = 14 [default = 0];
-inline bool SolverParameter::has_snapshot() const {
-  return (_has_bits_[0] & 0x04000000u) != 0;
-}
-inline void SolverParameter::set_has_snapshot() {
-  _has_bits_[0] |= 0x04000000u;
-}
-inline void SolverParameter::clear_has_snapshot() {
-  _has_bits_[0] &= ~0x04000000u;
-}
-inline void SolverParameter::clear_snapshot() {
-  snapshot_ = 0;
-  clear_has_snapshot();
-}
-inline ::google::protobuf::int32 SolverParameter::snapshot() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.snapshot)
-  return snapshot_;
-}
-inline void SolverParameter::set_snapshot(::google::protobuf::int32 value) {
-  set_has_snapshot();
-  snapshot_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.snapshot)
-}
-
-// optional string snapshot_prefix = 15;
-inline bool SolverParameter::has_snapshot_prefix() const {
-  return (_has_bits_[0] & 0x08000000u) != 0;
-}
-inline void SolverParameter::set_has_snapshot_prefix() {
-  _has_bits_[0] |= 0x08000000u;
-}
-inline void SolverParameter::clear_has_snapshot_prefix() {
-  _has_bits_[0] &= ~0x08000000u;
-}
-inline void SolverParameter::clear_snapshot_prefix() {
-  if (snapshot_prefix_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    snapshot_prefix_->clear();
-  }
-  clear_has_snapshot_prefix();
-}
-inline const ::std::string& SolverParameter::snapshot_prefix() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.snapshot_prefix)
-  return *snapshot_prefix_;
-}
-inline void SolverParameter::set_snapshot_prefix(const ::std::string& value) {
-  set_has_snapshot_prefix();
-  if (snapshot_prefix_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    snapshot_prefix_ = new ::std::string;
-  }
-  snapshot_prefix_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.snapshot_prefix)
-}
-inline void SolverParameter::set_snapshot_prefix(const char* value) {
-  set_has_snapshot_prefix();
-  if (snapshot_prefix_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    snapshot_prefix_ = new ::std::string;
-  }
-  snapshot_prefix_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.snapshot_prefix)
-}
-inline void SolverParameter::set_snapshot_prefix(const char* value, size_t size) {
-  set_has_snapshot_prefix();
-  if (snapshot_prefix_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    snapshot_prefix_ = new ::std::string;
-  }
-  snapshot_prefix_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.snapshot_prefix)
-}
-inline ::std::string* SolverParameter::mutable_snapshot_prefix() {
-  set_has_snapshot_prefix();
-  if (snapshot_prefix_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    snapshot_prefix_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.snapshot_prefix)
-  return snapshot_prefix_;
-}
-inline ::std::string* SolverParameter::release_snapshot_prefix() {
-  clear_has_snapshot_prefix();
-  if (snapshot_prefix_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = snapshot_prefix_;
-    snapshot_prefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void SolverParameter::set_allocated_snapshot_prefix(::std::string* snapshot_prefix) {
-  if (snapshot_prefix_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete snapshot_prefix_;
-  }
-  if (snapshot_prefix) {
-    set_has_snapshot_prefix();
-    snapshot_prefix_ = snapshot_prefix;
-  } else {
-    clear_has_snapshot_prefix();
-    snapshot_prefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.snapshot_prefix)
-}
-
-// optional bool snapshot_diff = 16 [default = false];
-inline bool SolverParameter::has_snapshot_diff() const {
-  return (_has_bits_[0] & 0x10000000u) != 0;
-}
-inline void SolverParameter::set_has_snapshot_diff() {
-  _has_bits_[0] |= 0x10000000u;
-}
-inline void SolverParameter::clear_has_snapshot_diff() {
-  _has_bits_[0] &= ~0x10000000u;
-}
-inline void SolverParameter::clear_snapshot_diff() {
-  snapshot_diff_ = false;
-  clear_has_snapshot_diff();
-}
-inline bool SolverParameter::snapshot_diff() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.snapshot_diff)
-  return snapshot_diff_;
-}
-inline void SolverParameter::set_snapshot_diff(bool value) {
-  set_has_snapshot_diff();
-  snapshot_diff_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.snapshot_diff)
-}
-
-// optional .caffe.SolverParameter.SnapshotFormat snapshot_format = 37 [default = BINARYPROTO];
-inline bool SolverParameter::has_snapshot_format() const {
-  return (_has_bits_[0] & 0x20000000u) != 0;
-}
-inline void SolverParameter::set_has_snapshot_format() {
-  _has_bits_[0] |= 0x20000000u;
-}
-inline void SolverParameter::clear_has_snapshot_format() {
-  _has_bits_[0] &= ~0x20000000u;
-}
-inline void SolverParameter::clear_snapshot_format() {
-  snapshot_format_ = 1;
-  clear_has_snapshot_format();
-}
-inline ::caffe::SolverParameter_SnapshotFormat SolverParameter::snapshot_format() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.snapshot_format)
-  return static_cast< ::caffe::SolverParameter_SnapshotFormat >(snapshot_format_);
-}
-inline void SolverParameter::set_snapshot_format(::caffe::SolverParameter_SnapshotFormat value) {
-  assert(::caffe::SolverParameter_SnapshotFormat_IsValid(value));
-  set_has_snapshot_format();
-  snapshot_format_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.snapshot_format)
-}
-
-// optional .caffe.SolverParameter.SolverMode solver_mode = 17 [default = GPU];
-inline bool SolverParameter::has_solver_mode() const {
-  return (_has_bits_[0] & 0x40000000u) != 0;
-}
-inline void SolverParameter::set_has_solver_mode() {
-  _has_bits_[0] |= 0x40000000u;
-}
-inline void SolverParameter::clear_has_solver_mode() {
-  _has_bits_[0] &= ~0x40000000u;
-}
-inline void SolverParameter::clear_solver_mode() {
-  solver_mode_ = 1;
-  clear_has_solver_mode();
-}
-inline ::caffe::SolverParameter_SolverMode SolverParameter::solver_mode() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.solver_mode)
-  return static_cast< ::caffe::SolverParameter_SolverMode >(solver_mode_);
-}
-inline void SolverParameter::set_solver_mode(::caffe::SolverParameter_SolverMode value) {
-  assert(::caffe::SolverParameter_SolverMode_IsValid(value));
-  set_has_solver_mode();
-  solver_mode_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.solver_mode)
-}
-
-// optional int32 device_id = 18 [default = 0];
-inline bool SolverParameter::has_device_id() const {
-  return (_has_bits_[0] & 0x80000000u) != 0;
-}
-inline void SolverParameter::set_has_device_id() {
-  _has_bits_[0] |= 0x80000000u;
-}
-inline void SolverParameter::clear_has_device_id() {
-  _has_bits_[0] &= ~0x80000000u;
-}
-inline void SolverParameter::clear_device_id() {
-  device_id_ = 0;
-  clear_has_device_id();
-}
-inline ::google::protobuf::int32 SolverParameter::device_id() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.device_id)
-  return device_id_;
-}
-inline void SolverParameter::set_device_id(::google::protobuf::int32 value) {
-  set_has_device_id();
-  device_id_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.device_id)
-}
-
-// optional int64 random_seed = 20 [default = -1];
-inline bool SolverParameter::has_random_seed() const {
-  return (_has_bits_[1] & 0x00000001u) != 0;
-}
-inline void SolverParameter::set_has_random_seed() {
-  _has_bits_[1] |= 0x00000001u;
-}
-inline void SolverParameter::clear_has_random_seed() {
-  _has_bits_[1] &= ~0x00000001u;
-}
-inline void SolverParameter::clear_random_seed() {
-  random_seed_ = GOOGLE_LONGLONG(-1);
-  clear_has_random_seed();
-}
-inline ::google::protobuf::int64 SolverParameter::random_seed() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.random_seed)
-  return random_seed_;
-}
-inline void SolverParameter::set_random_seed(::google::protobuf::int64 value) {
-  set_has_random_seed();
-  random_seed_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.random_seed)
-}
-
-// optional string type = 40 [default = "SGD"];
-inline bool SolverParameter::has_type() const {
-  return (_has_bits_[1] & 0x00000002u) != 0;
-}
-inline void SolverParameter::set_has_type() {
-  _has_bits_[1] |= 0x00000002u;
-}
-inline void SolverParameter::clear_has_type() {
-  _has_bits_[1] &= ~0x00000002u;
-}
-inline void SolverParameter::clear_type() {
-  if (type_ != _default_type_) {
-    type_->assign(*_default_type_);
-  }
-  clear_has_type();
-}
-inline const ::std::string& SolverParameter::type() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.type)
-  return *type_;
-}
-inline void SolverParameter::set_type(const ::std::string& value) {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.type)
-}
-inline void SolverParameter::set_type(const char* value) {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.type)
-}
-inline void SolverParameter::set_type(const char* value, size_t size) {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string;
-  }
-  type_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.type)
-}
-inline ::std::string* SolverParameter::mutable_type() {
-  set_has_type();
-  if (type_ == _default_type_) {
-    type_ = new ::std::string(*_default_type_);
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.type)
-  return type_;
-}
-inline ::std::string* SolverParameter::release_type() {
-  clear_has_type();
-  if (type_ == _default_type_) {
-    return NULL;
-  } else {
-    ::std::string* temp = type_;
-    type_ = const_cast< ::std::string*>(_default_type_);
-    return temp;
-  }
-}
-inline void SolverParameter::set_allocated_type(::std::string* type) {
-  if (type_ != _default_type_) {
-    delete type_;
-  }
-  if (type) {
-    set_has_type();
-    type_ = type;
-  } else {
-    clear_has_type();
-    type_ = const_cast< ::std::string*>(_default_type_);
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.type)
-}
-
-// optional float delta = 31 [default = 1e-08];
-inline bool SolverParameter::has_delta() const {
-  return (_has_bits_[1] & 0x00000004u) != 0;
-}
-inline void SolverParameter::set_has_delta() {
-  _has_bits_[1] |= 0x00000004u;
-}
-inline void SolverParameter::clear_has_delta() {
-  _has_bits_[1] &= ~0x00000004u;
-}
-inline void SolverParameter::clear_delta() {
-  delta_ = 1e-08f;
-  clear_has_delta();
-}
-inline float SolverParameter::delta() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.delta)
-  return delta_;
-}
-inline void SolverParameter::set_delta(float value) {
-  set_has_delta();
-  delta_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.delta)
-}
-
-// optional float momentum2 = 39 [default = 0.999];
-inline bool SolverParameter::has_momentum2() const {
-  return (_has_bits_[1] & 0x00000008u) != 0;
-}
-inline void SolverParameter::set_has_momentum2() {
-  _has_bits_[1] |= 0x00000008u;
-}
-inline void SolverParameter::clear_has_momentum2() {
-  _has_bits_[1] &= ~0x00000008u;
-}
-inline void SolverParameter::clear_momentum2() {
-  momentum2_ = 0.999f;
-  clear_has_momentum2();
-}
-inline float SolverParameter::momentum2() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.momentum2)
-  return momentum2_;
-}
-inline void SolverParameter::set_momentum2(float value) {
-  set_has_momentum2();
-  momentum2_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.momentum2)
-}
-
-// optional float rms_decay = 38 [default = 0.99];
-inline bool SolverParameter::has_rms_decay() const {
-  return (_has_bits_[1] & 0x00000010u) != 0;
-}
-inline void SolverParameter::set_has_rms_decay() {
-  _has_bits_[1] |= 0x00000010u;
-}
-inline void SolverParameter::clear_has_rms_decay() {
-  _has_bits_[1] &= ~0x00000010u;
-}
-inline void SolverParameter::clear_rms_decay() {
-  rms_decay_ = 0.99f;
-  clear_has_rms_decay();
-}
-inline float SolverParameter::rms_decay() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.rms_decay)
-  return rms_decay_;
-}
-inline void SolverParameter::set_rms_decay(float value) {
-  set_has_rms_decay();
-  rms_decay_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.rms_decay)
-}
-
-// optional bool debug_info = 23 [default = false];
-inline bool SolverParameter::has_debug_info() const {
-  return (_has_bits_[1] & 0x00000020u) != 0;
-}
-inline void SolverParameter::set_has_debug_info() {
-  _has_bits_[1] |= 0x00000020u;
-}
-inline void SolverParameter::clear_has_debug_info() {
-  _has_bits_[1] &= ~0x00000020u;
-}
-inline void SolverParameter::clear_debug_info() {
-  debug_info_ = false;
-  clear_has_debug_info();
-}
-inline bool SolverParameter::debug_info() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.debug_info)
-  return debug_info_;
-}
-inline void SolverParameter::set_debug_info(bool value) {
-  set_has_debug_info();
-  debug_info_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.debug_info)
-}
-
-// optional bool snapshot_after_train = 28 [default = true];
-inline bool SolverParameter::has_snapshot_after_train() const {
-  return (_has_bits_[1] & 0x00000040u) != 0;
-}
-inline void SolverParameter::set_has_snapshot_after_train() {
-  _has_bits_[1] |= 0x00000040u;
-}
-inline void SolverParameter::clear_has_snapshot_after_train() {
-  _has_bits_[1] &= ~0x00000040u;
-}
-inline void SolverParameter::clear_snapshot_after_train() {
-  snapshot_after_train_ = true;
-  clear_has_snapshot_after_train();
-}
-inline bool SolverParameter::snapshot_after_train() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.snapshot_after_train)
-  return snapshot_after_train_;
-}
-inline void SolverParameter::set_snapshot_after_train(bool value) {
-  set_has_snapshot_after_train();
-  snapshot_after_train_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.snapshot_after_train)
-}
-
-// optional .caffe.SolverParameter.SolverType solver_type = 30 [default = SGD];
-inline bool SolverParameter::has_solver_type() const {
-  return (_has_bits_[1] & 0x00000080u) != 0;
-}
-inline void SolverParameter::set_has_solver_type() {
-  _has_bits_[1] |= 0x00000080u;
-}
-inline void SolverParameter::clear_has_solver_type() {
-  _has_bits_[1] &= ~0x00000080u;
-}
-inline void SolverParameter::clear_solver_type() {
-  solver_type_ = 0;
-  clear_has_solver_type();
-}
-inline ::caffe::SolverParameter_SolverType SolverParameter::solver_type() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverParameter.solver_type)
-  return static_cast< ::caffe::SolverParameter_SolverType >(solver_type_);
-}
-inline void SolverParameter::set_solver_type(::caffe::SolverParameter_SolverType value) {
-  assert(::caffe::SolverParameter_SolverType_IsValid(value));
-  set_has_solver_type();
-  solver_type_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverParameter.solver_type)
-}
-
-// -------------------------------------------------------------------
-
-// SolverState
-
-// optional int32 iter = 1;
-inline bool SolverState::has_iter() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SolverState::set_has_iter() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SolverState::clear_has_iter() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SolverState::clear_iter() {
-  iter_ = 0;
-  clear_has_iter();
-}
-inline ::google::protobuf::int32 SolverState::iter() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverState.iter)
-  return iter_;
-}
-inline void SolverState::set_iter(::google::protobuf::int32 value) {
-  set_has_iter();
-  iter_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverState.iter)
-}
-
-// optional string learned_net = 2;
-inline bool SolverState::has_learned_net() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SolverState::set_has_learned_net() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SolverState::clear_has_learned_net() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void SolverState::clear_learned_net() {
-  if (learned_net_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    learned_net_->clear();
-  }
-  clear_has_learned_net();
-}
-inline const ::std::string& SolverState::learned_net() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverState.learned_net)
-  return *learned_net_;
-}
-inline void SolverState::set_learned_net(const ::std::string& value) {
-  set_has_learned_net();
-  if (learned_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    learned_net_ = new ::std::string;
-  }
-  learned_net_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.SolverState.learned_net)
-}
-inline void SolverState::set_learned_net(const char* value) {
-  set_has_learned_net();
-  if (learned_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    learned_net_ = new ::std::string;
-  }
-  learned_net_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.SolverState.learned_net)
-}
-inline void SolverState::set_learned_net(const char* value, size_t size) {
-  set_has_learned_net();
-  if (learned_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    learned_net_ = new ::std::string;
-  }
-  learned_net_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.SolverState.learned_net)
-}
-inline ::std::string* SolverState::mutable_learned_net() {
-  set_has_learned_net();
-  if (learned_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    learned_net_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.SolverState.learned_net)
-  return learned_net_;
-}
-inline ::std::string* SolverState::release_learned_net() {
-  clear_has_learned_net();
-  if (learned_net_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = learned_net_;
-    learned_net_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void SolverState::set_allocated_learned_net(::std::string* learned_net) {
-  if (learned_net_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete learned_net_;
-  }
-  if (learned_net) {
-    set_has_learned_net();
-    learned_net_ = learned_net;
-  } else {
-    clear_has_learned_net();
-    learned_net_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.SolverState.learned_net)
-}
-
-// repeated .caffe.BlobProto history = 3;
-inline int SolverState::history_size() const {
-  return history_.size();
-}
-inline void SolverState::clear_history() {
-  history_.Clear();
-}
-inline const ::caffe::BlobProto& SolverState::history(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.SolverState.history)
-  return history_.Get(index);
-}
-inline ::caffe::BlobProto* SolverState::mutable_history(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.SolverState.history)
-  return history_.Mutable(index);
-}
-inline ::caffe::BlobProto* SolverState::add_history() {
-  // @@protoc_insertion_point(field_add:caffe.SolverState.history)
-  return history_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-SolverState::history() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverState.history)
-  return history_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-SolverState::mutable_history() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.SolverState.history)
-  return &history_;
-}
-
-// optional int32 current_step = 4 [default = 0];
-inline bool SolverState::has_current_step() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void SolverState::set_has_current_step() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void SolverState::clear_has_current_step() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void SolverState::clear_current_step() {
-  current_step_ = 0;
-  clear_has_current_step();
-}
-inline ::google::protobuf::int32 SolverState::current_step() const {
-  // @@protoc_insertion_point(field_get:caffe.SolverState.current_step)
-  return current_step_;
-}
-inline void SolverState::set_current_step(::google::protobuf::int32 value) {
-  set_has_current_step();
-  current_step_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SolverState.current_step)
-}
-
-// -------------------------------------------------------------------
-
-// NetState
-
-// optional .caffe.Phase phase = 1 [default = TEST];
-inline bool NetState::has_phase() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void NetState::set_has_phase() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void NetState::clear_has_phase() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void NetState::clear_phase() {
-  phase_ = 1;
-  clear_has_phase();
-}
-inline ::caffe::Phase NetState::phase() const {
-  // @@protoc_insertion_point(field_get:caffe.NetState.phase)
-  return static_cast< ::caffe::Phase >(phase_);
-}
-inline void NetState::set_phase(::caffe::Phase value) {
-  assert(::caffe::Phase_IsValid(value));
-  set_has_phase();
-  phase_ = value;
-  // @@protoc_insertion_point(field_set:caffe.NetState.phase)
-}
-
-// optional int32 level = 2 [default = 0];
-inline bool NetState::has_level() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void NetState::set_has_level() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void NetState::clear_has_level() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void NetState::clear_level() {
-  level_ = 0;
-  clear_has_level();
-}
-inline ::google::protobuf::int32 NetState::level() const {
-  // @@protoc_insertion_point(field_get:caffe.NetState.level)
-  return level_;
-}
-inline void NetState::set_level(::google::protobuf::int32 value) {
-  set_has_level();
-  level_ = value;
-  // @@protoc_insertion_point(field_set:caffe.NetState.level)
-}
-
-// repeated string stage = 3;
-inline int NetState::stage_size() const {
-  return stage_.size();
-}
-inline void NetState::clear_stage() {
-  stage_.Clear();
-}
-inline const ::std::string& NetState::stage(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetState.stage)
-  return stage_.Get(index);
-}
-inline ::std::string* NetState::mutable_stage(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.NetState.stage)
-  return stage_.Mutable(index);
-}
-inline void NetState::set_stage(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.NetState.stage)
-  stage_.Mutable(index)->assign(value);
-}
-inline void NetState::set_stage(int index, const char* value) {
-  stage_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.NetState.stage)
-}
-inline void NetState::set_stage(int index, const char* value, size_t size) {
-  stage_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.NetState.stage)
-}
-inline ::std::string* NetState::add_stage() {
-  return stage_.Add();
-}
-inline void NetState::add_stage(const ::std::string& value) {
-  stage_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.NetState.stage)
-}
-inline void NetState::add_stage(const char* value) {
-  stage_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.NetState.stage)
-}
-inline void NetState::add_stage(const char* value, size_t size) {
-  stage_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.NetState.stage)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-NetState::stage() const {
-  // @@protoc_insertion_point(field_list:caffe.NetState.stage)
-  return stage_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-NetState::mutable_stage() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetState.stage)
-  return &stage_;
-}
-
-// -------------------------------------------------------------------
-
-// NetStateRule
-
-// optional .caffe.Phase phase = 1;
-inline bool NetStateRule::has_phase() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void NetStateRule::set_has_phase() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void NetStateRule::clear_has_phase() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void NetStateRule::clear_phase() {
-  phase_ = 0;
-  clear_has_phase();
-}
-inline ::caffe::Phase NetStateRule::phase() const {
-  // @@protoc_insertion_point(field_get:caffe.NetStateRule.phase)
-  return static_cast< ::caffe::Phase >(phase_);
-}
-inline void NetStateRule::set_phase(::caffe::Phase value) {
-  assert(::caffe::Phase_IsValid(value));
-  set_has_phase();
-  phase_ = value;
-  // @@protoc_insertion_point(field_set:caffe.NetStateRule.phase)
-}
-
-// optional int32 min_level = 2;
-inline bool NetStateRule::has_min_level() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void NetStateRule::set_has_min_level() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void NetStateRule::clear_has_min_level() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void NetStateRule::clear_min_level() {
-  min_level_ = 0;
-  clear_has_min_level();
-}
-inline ::google::protobuf::int32 NetStateRule::min_level() const {
-  // @@protoc_insertion_point(field_get:caffe.NetStateRule.min_level)
-  return min_level_;
-}
-inline void NetStateRule::set_min_level(::google::protobuf::int32 value) {
-  set_has_min_level();
-  min_level_ = value;
-  // @@protoc_insertion_point(field_set:caffe.NetStateRule.min_level)
-}
-
-// optional int32 max_level = 3;
-inline bool NetStateRule::has_max_level() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void NetStateRule::set_has_max_level() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void NetStateRule::clear_has_max_level() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void NetStateRule::clear_max_level() {
-  max_level_ = 0;
-  clear_has_max_level();
-}
-inline ::google::protobuf::int32 NetStateRule::max_level() const {
-  // @@protoc_insertion_point(field_get:caffe.NetStateRule.max_level)
-  return max_level_;
-}
-inline void NetStateRule::set_max_level(::google::protobuf::int32 value) {
-  set_has_max_level();
-  max_level_ = value;
-  // @@protoc_insertion_point(field_set:caffe.NetStateRule.max_level)
-}
-
-// repeated string stage = 4;
-inline int NetStateRule::stage_size() const {
-  return stage_.size();
-}
-inline void NetStateRule::clear_stage() {
-  stage_.Clear();
-}
-inline const ::std::string& NetStateRule::stage(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetStateRule.stage)
-  return stage_.Get(index);
-}
-inline ::std::string* NetStateRule::mutable_stage(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.NetStateRule.stage)
-  return stage_.Mutable(index);
-}
-inline void NetStateRule::set_stage(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.NetStateRule.stage)
-  stage_.Mutable(index)->assign(value);
-}
-inline void NetStateRule::set_stage(int index, const char* value) {
-  stage_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.NetStateRule.stage)
-}
-inline void NetStateRule::set_stage(int index, const char* value, size_t size) {
-  stage_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.NetStateRule.stage)
-}
-inline ::std::string* NetStateRule::add_stage() {
-  return stage_.Add();
-}
-inline void NetStateRule::add_stage(const ::std::string& value) {
-  stage_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.NetStateRule.stage)
-}
-inline void NetStateRule::add_stage(const char* value) {
-  stage_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.NetStateRule.stage)
-}
-inline void NetStateRule::add_stage(const char* value, size_t size) {
-  stage_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.NetStateRule.stage)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-NetStateRule::stage() const {
-  // @@protoc_insertion_point(field_list:caffe.NetStateRule.stage)
-  return stage_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-NetStateRule::mutable_stage() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetStateRule.stage)
-  return &stage_;
-}
-
-// repeated string not_stage = 5;
-inline int NetStateRule::not_stage_size() const {
-  return not_stage_.size();
-}
-inline void NetStateRule::clear_not_stage() {
-  not_stage_.Clear();
-}
-inline const ::std::string& NetStateRule::not_stage(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.NetStateRule.not_stage)
-  return not_stage_.Get(index);
-}
-inline ::std::string* NetStateRule::mutable_not_stage(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.NetStateRule.not_stage)
-  return not_stage_.Mutable(index);
-}
-inline void NetStateRule::set_not_stage(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.NetStateRule.not_stage)
-  not_stage_.Mutable(index)->assign(value);
-}
-inline void NetStateRule::set_not_stage(int index, const char* value) {
-  not_stage_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.NetStateRule.not_stage)
-}
-inline void NetStateRule::set_not_stage(int index, const char* value, size_t size) {
-  not_stage_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.NetStateRule.not_stage)
-}
-inline ::std::string* NetStateRule::add_not_stage() {
-  return not_stage_.Add();
-}
-inline void NetStateRule::add_not_stage(const ::std::string& value) {
-  not_stage_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.NetStateRule.not_stage)
-}
-inline void NetStateRule::add_not_stage(const char* value) {
-  not_stage_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.NetStateRule.not_stage)
-}
-inline void NetStateRule::add_not_stage(const char* value, size_t size) {
-  not_stage_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.NetStateRule.not_stage)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-NetStateRule::not_stage() const {
-  // @@protoc_insertion_point(field_list:caffe.NetStateRule.not_stage)
-  return not_stage_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-NetStateRule::mutable_not_stage() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.NetStateRule.not_stage)
-  return &not_stage_;
-}
-
-// -------------------------------------------------------------------
-
-// ParamSpec
-
-// optional string name = 1;
-inline bool ParamSpec::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ParamSpec::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ParamSpec::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ParamSpec::clear_name() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& ParamSpec::name() const {
-  // @@protoc_insertion_point(field_get:caffe.ParamSpec.name)
-  return *name_;
-}
-inline void ParamSpec::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.ParamSpec.name)
-}
-inline void ParamSpec::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.ParamSpec.name)
-}
-inline void ParamSpec::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.ParamSpec.name)
-}
-inline ::std::string* ParamSpec::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.ParamSpec.name)
-  return name_;
-}
-inline ::std::string* ParamSpec::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void ParamSpec::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ParamSpec.name)
-}
-
-// optional .caffe.ParamSpec.DimCheckMode share_mode = 2;
-inline bool ParamSpec::has_share_mode() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ParamSpec::set_has_share_mode() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ParamSpec::clear_has_share_mode() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ParamSpec::clear_share_mode() {
-  share_mode_ = 0;
-  clear_has_share_mode();
-}
-inline ::caffe::ParamSpec_DimCheckMode ParamSpec::share_mode() const {
-  // @@protoc_insertion_point(field_get:caffe.ParamSpec.share_mode)
-  return static_cast< ::caffe::ParamSpec_DimCheckMode >(share_mode_);
-}
-inline void ParamSpec::set_share_mode(::caffe::ParamSpec_DimCheckMode value) {
-  assert(::caffe::ParamSpec_DimCheckMode_IsValid(value));
-  set_has_share_mode();
-  share_mode_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ParamSpec.share_mode)
-}
-
-// optional float lr_mult = 3 [default = 1];
-inline bool ParamSpec::has_lr_mult() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ParamSpec::set_has_lr_mult() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ParamSpec::clear_has_lr_mult() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ParamSpec::clear_lr_mult() {
-  lr_mult_ = 1;
-  clear_has_lr_mult();
-}
-inline float ParamSpec::lr_mult() const {
-  // @@protoc_insertion_point(field_get:caffe.ParamSpec.lr_mult)
-  return lr_mult_;
-}
-inline void ParamSpec::set_lr_mult(float value) {
-  set_has_lr_mult();
-  lr_mult_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ParamSpec.lr_mult)
-}
-
-// optional float decay_mult = 4 [default = 1];
-inline bool ParamSpec::has_decay_mult() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void ParamSpec::set_has_decay_mult() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void ParamSpec::clear_has_decay_mult() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void ParamSpec::clear_decay_mult() {
-  decay_mult_ = 1;
-  clear_has_decay_mult();
-}
-inline float ParamSpec::decay_mult() const {
-  // @@protoc_insertion_point(field_get:caffe.ParamSpec.decay_mult)
-  return decay_mult_;
-}
-inline void ParamSpec::set_decay_mult(float value) {
-  set_has_decay_mult();
-  decay_mult_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ParamSpec.decay_mult)
-}
-
-// -------------------------------------------------------------------
-
-// LayerParameter
-
-// optional string name = 1;
-inline bool LayerParameter::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LayerParameter::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LayerParameter::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void LayerParameter::clear_name() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& LayerParameter::name() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.name)
-  return *name_;
-}
-inline void LayerParameter::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.LayerParameter.name)
-}
-inline void LayerParameter::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.LayerParameter.name)
-}
-inline void LayerParameter::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.LayerParameter.name)
-}
-inline ::std::string* LayerParameter::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.name)
-  return name_;
-}
-inline ::std::string* LayerParameter::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void LayerParameter::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.name)
-}
-
-// optional string type = 2;
-inline bool LayerParameter::has_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void LayerParameter::set_has_type() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void LayerParameter::clear_has_type() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void LayerParameter::clear_type() {
-  if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_->clear();
-  }
-  clear_has_type();
-}
-inline const ::std::string& LayerParameter::type() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.type)
-  return *type_;
-}
-inline void LayerParameter::set_type(const ::std::string& value) {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.LayerParameter.type)
-}
-inline void LayerParameter::set_type(const char* value) {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.LayerParameter.type)
-}
-inline void LayerParameter::set_type(const char* value, size_t size) {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  type_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.LayerParameter.type)
-}
-inline ::std::string* LayerParameter::mutable_type() {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.type)
-  return type_;
-}
-inline ::std::string* LayerParameter::release_type() {
-  clear_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = type_;
-    type_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void LayerParameter::set_allocated_type(::std::string* type) {
-  if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete type_;
-  }
-  if (type) {
-    set_has_type();
-    type_ = type;
-  } else {
-    clear_has_type();
-    type_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.type)
-}
-
-// repeated string bottom = 3;
-inline int LayerParameter::bottom_size() const {
-  return bottom_.size();
-}
-inline void LayerParameter::clear_bottom() {
-  bottom_.Clear();
-}
-inline const ::std::string& LayerParameter::bottom(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.bottom)
-  return bottom_.Get(index);
-}
-inline ::std::string* LayerParameter::mutable_bottom(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.bottom)
-  return bottom_.Mutable(index);
-}
-inline void LayerParameter::set_bottom(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.LayerParameter.bottom)
-  bottom_.Mutable(index)->assign(value);
-}
-inline void LayerParameter::set_bottom(int index, const char* value) {
-  bottom_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.LayerParameter.bottom)
-}
-inline void LayerParameter::set_bottom(int index, const char* value, size_t size) {
-  bottom_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.LayerParameter.bottom)
-}
-inline ::std::string* LayerParameter::add_bottom() {
-  return bottom_.Add();
-}
-inline void LayerParameter::add_bottom(const ::std::string& value) {
-  bottom_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.bottom)
-}
-inline void LayerParameter::add_bottom(const char* value) {
-  bottom_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.LayerParameter.bottom)
-}
-inline void LayerParameter::add_bottom(const char* value, size_t size) {
-  bottom_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.LayerParameter.bottom)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-LayerParameter::bottom() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.bottom)
-  return bottom_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-LayerParameter::mutable_bottom() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.bottom)
-  return &bottom_;
-}
-
-// repeated string top = 4;
-inline int LayerParameter::top_size() const {
-  return top_.size();
-}
-inline void LayerParameter::clear_top() {
-  top_.Clear();
-}
-inline const ::std::string& LayerParameter::top(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.top)
-  return top_.Get(index);
-}
-inline ::std::string* LayerParameter::mutable_top(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.top)
-  return top_.Mutable(index);
-}
-inline void LayerParameter::set_top(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.LayerParameter.top)
-  top_.Mutable(index)->assign(value);
-}
-inline void LayerParameter::set_top(int index, const char* value) {
-  top_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.LayerParameter.top)
-}
-inline void LayerParameter::set_top(int index, const char* value, size_t size) {
-  top_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.LayerParameter.top)
-}
-inline ::std::string* LayerParameter::add_top() {
-  return top_.Add();
-}
-inline void LayerParameter::add_top(const ::std::string& value) {
-  top_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.top)
-}
-inline void LayerParameter::add_top(const char* value) {
-  top_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.LayerParameter.top)
-}
-inline void LayerParameter::add_top(const char* value, size_t size) {
-  top_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.LayerParameter.top)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-LayerParameter::top() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.top)
-  return top_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-LayerParameter::mutable_top() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.top)
-  return &top_;
-}
-
-// optional .caffe.Phase phase = 10;
-inline bool LayerParameter::has_phase() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void LayerParameter::set_has_phase() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void LayerParameter::clear_has_phase() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void LayerParameter::clear_phase() {
-  phase_ = 0;
-  clear_has_phase();
-}
-inline ::caffe::Phase LayerParameter::phase() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.phase)
-  return static_cast< ::caffe::Phase >(phase_);
-}
-inline void LayerParameter::set_phase(::caffe::Phase value) {
-  assert(::caffe::Phase_IsValid(value));
-  set_has_phase();
-  phase_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LayerParameter.phase)
-}
-
-// repeated float loss_weight = 5;
-inline int LayerParameter::loss_weight_size() const {
-  return loss_weight_.size();
-}
-inline void LayerParameter::clear_loss_weight() {
-  loss_weight_.Clear();
-}
-inline float LayerParameter::loss_weight(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.loss_weight)
-  return loss_weight_.Get(index);
-}
-inline void LayerParameter::set_loss_weight(int index, float value) {
-  loss_weight_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.LayerParameter.loss_weight)
-}
-inline void LayerParameter::add_loss_weight(float value) {
-  loss_weight_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.loss_weight)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-LayerParameter::loss_weight() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.loss_weight)
-  return loss_weight_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-LayerParameter::mutable_loss_weight() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.loss_weight)
-  return &loss_weight_;
-}
-
-// repeated .caffe.ParamSpec param = 6;
-inline int LayerParameter::param_size() const {
-  return param_.size();
-}
-inline void LayerParameter::clear_param() {
-  param_.Clear();
-}
-inline const ::caffe::ParamSpec& LayerParameter::param(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.param)
-  return param_.Get(index);
-}
-inline ::caffe::ParamSpec* LayerParameter::mutable_param(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.param)
-  return param_.Mutable(index);
-}
-inline ::caffe::ParamSpec* LayerParameter::add_param() {
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.param)
-  return param_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >&
-LayerParameter::param() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.param)
-  return param_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >*
-LayerParameter::mutable_param() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.param)
-  return &param_;
-}
-
-// repeated .caffe.BlobProto blobs = 7;
-inline int LayerParameter::blobs_size() const {
-  return blobs_.size();
-}
-inline void LayerParameter::clear_blobs() {
-  blobs_.Clear();
-}
-inline const ::caffe::BlobProto& LayerParameter::blobs(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.blobs)
-  return blobs_.Get(index);
-}
-inline ::caffe::BlobProto* LayerParameter::mutable_blobs(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.blobs)
-  return blobs_.Mutable(index);
-}
-inline ::caffe::BlobProto* LayerParameter::add_blobs() {
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.blobs)
-  return blobs_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-LayerParameter::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.blobs)
-  return blobs_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-LayerParameter::mutable_blobs() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.blobs)
-  return &blobs_;
-}
-
-// repeated bool propagate_down = 11;
-inline int LayerParameter::propagate_down_size() const {
-  return propagate_down_.size();
-}
-inline void LayerParameter::clear_propagate_down() {
-  propagate_down_.Clear();
-}
-inline bool LayerParameter::propagate_down(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.propagate_down)
-  return propagate_down_.Get(index);
-}
-inline void LayerParameter::set_propagate_down(int index, bool value) {
-  propagate_down_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.LayerParameter.propagate_down)
-}
-inline void LayerParameter::add_propagate_down(bool value) {
-  propagate_down_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.propagate_down)
-}
-inline const ::google::protobuf::RepeatedField< bool >&
-LayerParameter::propagate_down() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.propagate_down)
-  return propagate_down_;
-}
-inline ::google::protobuf::RepeatedField< bool >*
-LayerParameter::mutable_propagate_down() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.propagate_down)
-  return &propagate_down_;
-}
-
-// repeated .caffe.NetStateRule include = 8;
-inline int LayerParameter::include_size() const {
-  return include_.size();
-}
-inline void LayerParameter::clear_include() {
-  include_.Clear();
-}
-inline const ::caffe::NetStateRule& LayerParameter::include(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.include)
-  return include_.Get(index);
-}
-inline ::caffe::NetStateRule* LayerParameter::mutable_include(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.include)
-  return include_.Mutable(index);
-}
-inline ::caffe::NetStateRule* LayerParameter::add_include() {
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.include)
-  return include_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-LayerParameter::include() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.include)
-  return include_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-LayerParameter::mutable_include() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.include)
-  return &include_;
-}
-
-// repeated .caffe.NetStateRule exclude = 9;
-inline int LayerParameter::exclude_size() const {
-  return exclude_.size();
-}
-inline void LayerParameter::clear_exclude() {
-  exclude_.Clear();
-}
-inline const ::caffe::NetStateRule& LayerParameter::exclude(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.exclude)
-  return exclude_.Get(index);
-}
-inline ::caffe::NetStateRule* LayerParameter::mutable_exclude(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.exclude)
-  return exclude_.Mutable(index);
-}
-inline ::caffe::NetStateRule* LayerParameter::add_exclude() {
-  // @@protoc_insertion_point(field_add:caffe.LayerParameter.exclude)
-  return exclude_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-LayerParameter::exclude() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.exclude)
-  return exclude_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-LayerParameter::mutable_exclude() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.exclude)
-  return &exclude_;
-}
-
-// optional .caffe.TransformationParameter transform_param = 100;
-inline bool LayerParameter::has_transform_param() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void LayerParameter::set_has_transform_param() {
-  _has_bits_[0] |= 0x00000800u;
-}
-inline void LayerParameter::clear_has_transform_param() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-inline void LayerParameter::clear_transform_param() {
-  if (transform_param_ != NULL) transform_param_->::caffe::TransformationParameter::Clear();
-  clear_has_transform_param();
-}
-inline const ::caffe::TransformationParameter& LayerParameter::transform_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.transform_param)
-  return transform_param_ != NULL ? *transform_param_ : *default_instance_->transform_param_;
-}
-inline ::caffe::TransformationParameter* LayerParameter::mutable_transform_param() {
-  set_has_transform_param();
-  if (transform_param_ == NULL) transform_param_ = new ::caffe::TransformationParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.transform_param)
-  return transform_param_;
-}
-inline ::caffe::TransformationParameter* LayerParameter::release_transform_param() {
-  clear_has_transform_param();
-  ::caffe::TransformationParameter* temp = transform_param_;
-  transform_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_transform_param(::caffe::TransformationParameter* transform_param) {
-  delete transform_param_;
-  transform_param_ = transform_param;
-  if (transform_param) {
-    set_has_transform_param();
-  } else {
-    clear_has_transform_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.transform_param)
-}
-
-// optional .caffe.LossParameter loss_param = 101;
-inline bool LayerParameter::has_loss_param() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-inline void LayerParameter::set_has_loss_param() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void LayerParameter::clear_has_loss_param() {
-  _has_bits_[0] &= ~0x00001000u;
-}
-inline void LayerParameter::clear_loss_param() {
-  if (loss_param_ != NULL) loss_param_->::caffe::LossParameter::Clear();
-  clear_has_loss_param();
-}
-inline const ::caffe::LossParameter& LayerParameter::loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.loss_param)
-  return loss_param_ != NULL ? *loss_param_ : *default_instance_->loss_param_;
-}
-inline ::caffe::LossParameter* LayerParameter::mutable_loss_param() {
-  set_has_loss_param();
-  if (loss_param_ == NULL) loss_param_ = new ::caffe::LossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.loss_param)
-  return loss_param_;
-}
-inline ::caffe::LossParameter* LayerParameter::release_loss_param() {
-  clear_has_loss_param();
-  ::caffe::LossParameter* temp = loss_param_;
-  loss_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_loss_param(::caffe::LossParameter* loss_param) {
-  delete loss_param_;
-  loss_param_ = loss_param;
-  if (loss_param) {
-    set_has_loss_param();
-  } else {
-    clear_has_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.loss_param)
-}
-
-// optional .caffe.AccuracyParameter accuracy_param = 102;
-inline bool LayerParameter::has_accuracy_param() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void LayerParameter::set_has_accuracy_param() {
-  _has_bits_[0] |= 0x00002000u;
-}
-inline void LayerParameter::clear_has_accuracy_param() {
-  _has_bits_[0] &= ~0x00002000u;
-}
-inline void LayerParameter::clear_accuracy_param() {
-  if (accuracy_param_ != NULL) accuracy_param_->::caffe::AccuracyParameter::Clear();
-  clear_has_accuracy_param();
-}
-inline const ::caffe::AccuracyParameter& LayerParameter::accuracy_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.accuracy_param)
-  return accuracy_param_ != NULL ? *accuracy_param_ : *default_instance_->accuracy_param_;
-}
-inline ::caffe::AccuracyParameter* LayerParameter::mutable_accuracy_param() {
-  set_has_accuracy_param();
-  if (accuracy_param_ == NULL) accuracy_param_ = new ::caffe::AccuracyParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.accuracy_param)
-  return accuracy_param_;
-}
-inline ::caffe::AccuracyParameter* LayerParameter::release_accuracy_param() {
-  clear_has_accuracy_param();
-  ::caffe::AccuracyParameter* temp = accuracy_param_;
-  accuracy_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_accuracy_param(::caffe::AccuracyParameter* accuracy_param) {
-  delete accuracy_param_;
-  accuracy_param_ = accuracy_param;
-  if (accuracy_param) {
-    set_has_accuracy_param();
-  } else {
-    clear_has_accuracy_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.accuracy_param)
-}
-
-// optional .caffe.ArgMaxParameter argmax_param = 103;
-inline bool LayerParameter::has_argmax_param() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
-}
-inline void LayerParameter::set_has_argmax_param() {
-  _has_bits_[0] |= 0x00004000u;
-}
-inline void LayerParameter::clear_has_argmax_param() {
-  _has_bits_[0] &= ~0x00004000u;
-}
-inline void LayerParameter::clear_argmax_param() {
-  if (argmax_param_ != NULL) argmax_param_->::caffe::ArgMaxParameter::Clear();
-  clear_has_argmax_param();
-}
-inline const ::caffe::ArgMaxParameter& LayerParameter::argmax_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.argmax_param)
-  return argmax_param_ != NULL ? *argmax_param_ : *default_instance_->argmax_param_;
-}
-inline ::caffe::ArgMaxParameter* LayerParameter::mutable_argmax_param() {
-  set_has_argmax_param();
-  if (argmax_param_ == NULL) argmax_param_ = new ::caffe::ArgMaxParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.argmax_param)
-  return argmax_param_;
-}
-inline ::caffe::ArgMaxParameter* LayerParameter::release_argmax_param() {
-  clear_has_argmax_param();
-  ::caffe::ArgMaxParameter* temp = argmax_param_;
-  argmax_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_argmax_param(::caffe::ArgMaxParameter* argmax_param) {
-  delete argmax_param_;
-  argmax_param_ = argmax_param;
-  if (argmax_param) {
-    set_has_argmax_param();
-  } else {
-    clear_has_argmax_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.argmax_param)
-}
-
-// optional .caffe.BatchNormParameter batch_norm_param = 139;
-inline bool LayerParameter::has_batch_norm_param() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-inline void LayerParameter::set_has_batch_norm_param() {
-  _has_bits_[0] |= 0x00008000u;
-}
-inline void LayerParameter::clear_has_batch_norm_param() {
-  _has_bits_[0] &= ~0x00008000u;
-}
-inline void LayerParameter::clear_batch_norm_param() {
-  if (batch_norm_param_ != NULL) batch_norm_param_->::caffe::BatchNormParameter::Clear();
-  clear_has_batch_norm_param();
-}
-inline const ::caffe::BatchNormParameter& LayerParameter::batch_norm_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.batch_norm_param)
-  return batch_norm_param_ != NULL ? *batch_norm_param_ : *default_instance_->batch_norm_param_;
-}
-inline ::caffe::BatchNormParameter* LayerParameter::mutable_batch_norm_param() {
-  set_has_batch_norm_param();
-  if (batch_norm_param_ == NULL) batch_norm_param_ = new ::caffe::BatchNormParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.batch_norm_param)
-  return batch_norm_param_;
-}
-inline ::caffe::BatchNormParameter* LayerParameter::release_batch_norm_param() {
-  clear_has_batch_norm_param();
-  ::caffe::BatchNormParameter* temp = batch_norm_param_;
-  batch_norm_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_batch_norm_param(::caffe::BatchNormParameter* batch_norm_param) {
-  delete batch_norm_param_;
-  batch_norm_param_ = batch_norm_param;
-  if (batch_norm_param) {
-    set_has_batch_norm_param();
-  } else {
-    clear_has_batch_norm_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.batch_norm_param)
-}
-
-// optional .caffe.BiasParameter bias_param = 141;
-inline bool LayerParameter::has_bias_param() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
-}
-inline void LayerParameter::set_has_bias_param() {
-  _has_bits_[0] |= 0x00010000u;
-}
-inline void LayerParameter::clear_has_bias_param() {
-  _has_bits_[0] &= ~0x00010000u;
-}
-inline void LayerParameter::clear_bias_param() {
-  if (bias_param_ != NULL) bias_param_->::caffe::BiasParameter::Clear();
-  clear_has_bias_param();
-}
-inline const ::caffe::BiasParameter& LayerParameter::bias_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.bias_param)
-  return bias_param_ != NULL ? *bias_param_ : *default_instance_->bias_param_;
-}
-inline ::caffe::BiasParameter* LayerParameter::mutable_bias_param() {
-  set_has_bias_param();
-  if (bias_param_ == NULL) bias_param_ = new ::caffe::BiasParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.bias_param)
-  return bias_param_;
-}
-inline ::caffe::BiasParameter* LayerParameter::release_bias_param() {
-  clear_has_bias_param();
-  ::caffe::BiasParameter* temp = bias_param_;
-  bias_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_bias_param(::caffe::BiasParameter* bias_param) {
-  delete bias_param_;
-  bias_param_ = bias_param;
-  if (bias_param) {
-    set_has_bias_param();
-  } else {
-    clear_has_bias_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.bias_param)
-}
-
-// optional .caffe.ConcatParameter concat_param = 104;
-inline bool LayerParameter::has_concat_param() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
-}
-inline void LayerParameter::set_has_concat_param() {
-  _has_bits_[0] |= 0x00020000u;
-}
-inline void LayerParameter::clear_has_concat_param() {
-  _has_bits_[0] &= ~0x00020000u;
-}
-inline void LayerParameter::clear_concat_param() {
-  if (concat_param_ != NULL) concat_param_->::caffe::ConcatParameter::Clear();
-  clear_has_concat_param();
-}
-inline const ::caffe::ConcatParameter& LayerParameter::concat_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.concat_param)
-  return concat_param_ != NULL ? *concat_param_ : *default_instance_->concat_param_;
-}
-inline ::caffe::ConcatParameter* LayerParameter::mutable_concat_param() {
-  set_has_concat_param();
-  if (concat_param_ == NULL) concat_param_ = new ::caffe::ConcatParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.concat_param)
-  return concat_param_;
-}
-inline ::caffe::ConcatParameter* LayerParameter::release_concat_param() {
-  clear_has_concat_param();
-  ::caffe::ConcatParameter* temp = concat_param_;
-  concat_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_concat_param(::caffe::ConcatParameter* concat_param) {
-  delete concat_param_;
-  concat_param_ = concat_param;
-  if (concat_param) {
-    set_has_concat_param();
-  } else {
-    clear_has_concat_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.concat_param)
-}
-
-// optional .caffe.ContrastiveLossParameter contrastive_loss_param = 105;
-inline bool LayerParameter::has_contrastive_loss_param() const {
-  return (_has_bits_[0] & 0x00040000u) != 0;
-}
-inline void LayerParameter::set_has_contrastive_loss_param() {
-  _has_bits_[0] |= 0x00040000u;
-}
-inline void LayerParameter::clear_has_contrastive_loss_param() {
-  _has_bits_[0] &= ~0x00040000u;
-}
-inline void LayerParameter::clear_contrastive_loss_param() {
-  if (contrastive_loss_param_ != NULL) contrastive_loss_param_->::caffe::ContrastiveLossParameter::Clear();
-  clear_has_contrastive_loss_param();
-}
-inline const ::caffe::ContrastiveLossParameter& LayerParameter::contrastive_loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.contrastive_loss_param)
-  return contrastive_loss_param_ != NULL ? *contrastive_loss_param_ : *default_instance_->contrastive_loss_param_;
-}
-inline ::caffe::ContrastiveLossParameter* LayerParameter::mutable_contrastive_loss_param() {
-  set_has_contrastive_loss_param();
-  if (contrastive_loss_param_ == NULL) contrastive_loss_param_ = new ::caffe::ContrastiveLossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.contrastive_loss_param)
-  return contrastive_loss_param_;
-}
-inline ::caffe::ContrastiveLossParameter* LayerParameter::release_contrastive_loss_param() {
-  clear_has_contrastive_loss_param();
-  ::caffe::ContrastiveLossParameter* temp = contrastive_loss_param_;
-  contrastive_loss_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_contrastive_loss_param(::caffe::ContrastiveLossParameter* contrastive_loss_param) {
-  delete contrastive_loss_param_;
-  contrastive_loss_param_ = contrastive_loss_param;
-  if (contrastive_loss_param) {
-    set_has_contrastive_loss_param();
-  } else {
-    clear_has_contrastive_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.contrastive_loss_param)
-}
-
-// optional .caffe.ConvolutionParameter convolution_param = 106;
-inline bool LayerParameter::has_convolution_param() const {
-  return (_has_bits_[0] & 0x00080000u) != 0;
-}
-inline void LayerParameter::set_has_convolution_param() {
-  _has_bits_[0] |= 0x00080000u;
-}
-inline void LayerParameter::clear_has_convolution_param() {
-  _has_bits_[0] &= ~0x00080000u;
-}
-inline void LayerParameter::clear_convolution_param() {
-  if (convolution_param_ != NULL) convolution_param_->::caffe::ConvolutionParameter::Clear();
-  clear_has_convolution_param();
-}
-inline const ::caffe::ConvolutionParameter& LayerParameter::convolution_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.convolution_param)
-  return convolution_param_ != NULL ? *convolution_param_ : *default_instance_->convolution_param_;
-}
-inline ::caffe::ConvolutionParameter* LayerParameter::mutable_convolution_param() {
-  set_has_convolution_param();
-  if (convolution_param_ == NULL) convolution_param_ = new ::caffe::ConvolutionParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.convolution_param)
-  return convolution_param_;
-}
-inline ::caffe::ConvolutionParameter* LayerParameter::release_convolution_param() {
-  clear_has_convolution_param();
-  ::caffe::ConvolutionParameter* temp = convolution_param_;
-  convolution_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_convolution_param(::caffe::ConvolutionParameter* convolution_param) {
-  delete convolution_param_;
-  convolution_param_ = convolution_param;
-  if (convolution_param) {
-    set_has_convolution_param();
-  } else {
-    clear_has_convolution_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.convolution_param)
-}
-
-// optional .caffe.CropParameter crop_param = 144;
-inline bool LayerParameter::has_crop_param() const {
-  return (_has_bits_[0] & 0x00100000u) != 0;
-}
-inline void LayerParameter::set_has_crop_param() {
-  _has_bits_[0] |= 0x00100000u;
-}
-inline void LayerParameter::clear_has_crop_param() {
-  _has_bits_[0] &= ~0x00100000u;
-}
-inline void LayerParameter::clear_crop_param() {
-  if (crop_param_ != NULL) crop_param_->::caffe::CropParameter::Clear();
-  clear_has_crop_param();
-}
-inline const ::caffe::CropParameter& LayerParameter::crop_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.crop_param)
-  return crop_param_ != NULL ? *crop_param_ : *default_instance_->crop_param_;
-}
-inline ::caffe::CropParameter* LayerParameter::mutable_crop_param() {
-  set_has_crop_param();
-  if (crop_param_ == NULL) crop_param_ = new ::caffe::CropParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.crop_param)
-  return crop_param_;
-}
-inline ::caffe::CropParameter* LayerParameter::release_crop_param() {
-  clear_has_crop_param();
-  ::caffe::CropParameter* temp = crop_param_;
-  crop_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_crop_param(::caffe::CropParameter* crop_param) {
-  delete crop_param_;
-  crop_param_ = crop_param;
-  if (crop_param) {
-    set_has_crop_param();
-  } else {
-    clear_has_crop_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.crop_param)
-}
-
-// optional .caffe.DataParameter data_param = 107;
-inline bool LayerParameter::has_data_param() const {
-  return (_has_bits_[0] & 0x00200000u) != 0;
-}
-inline void LayerParameter::set_has_data_param() {
-  _has_bits_[0] |= 0x00200000u;
-}
-inline void LayerParameter::clear_has_data_param() {
-  _has_bits_[0] &= ~0x00200000u;
-}
-inline void LayerParameter::clear_data_param() {
-  if (data_param_ != NULL) data_param_->::caffe::DataParameter::Clear();
-  clear_has_data_param();
-}
-inline const ::caffe::DataParameter& LayerParameter::data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.data_param)
-  return data_param_ != NULL ? *data_param_ : *default_instance_->data_param_;
-}
-inline ::caffe::DataParameter* LayerParameter::mutable_data_param() {
-  set_has_data_param();
-  if (data_param_ == NULL) data_param_ = new ::caffe::DataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.data_param)
-  return data_param_;
-}
-inline ::caffe::DataParameter* LayerParameter::release_data_param() {
-  clear_has_data_param();
-  ::caffe::DataParameter* temp = data_param_;
-  data_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_data_param(::caffe::DataParameter* data_param) {
-  delete data_param_;
-  data_param_ = data_param;
-  if (data_param) {
-    set_has_data_param();
-  } else {
-    clear_has_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.data_param)
-}
-
-// optional .caffe.DropoutParameter dropout_param = 108;
-inline bool LayerParameter::has_dropout_param() const {
-  return (_has_bits_[0] & 0x00400000u) != 0;
-}
-inline void LayerParameter::set_has_dropout_param() {
-  _has_bits_[0] |= 0x00400000u;
-}
-inline void LayerParameter::clear_has_dropout_param() {
-  _has_bits_[0] &= ~0x00400000u;
-}
-inline void LayerParameter::clear_dropout_param() {
-  if (dropout_param_ != NULL) dropout_param_->::caffe::DropoutParameter::Clear();
-  clear_has_dropout_param();
-}
-inline const ::caffe::DropoutParameter& LayerParameter::dropout_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.dropout_param)
-  return dropout_param_ != NULL ? *dropout_param_ : *default_instance_->dropout_param_;
-}
-inline ::caffe::DropoutParameter* LayerParameter::mutable_dropout_param() {
-  set_has_dropout_param();
-  if (dropout_param_ == NULL) dropout_param_ = new ::caffe::DropoutParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.dropout_param)
-  return dropout_param_;
-}
-inline ::caffe::DropoutParameter* LayerParameter::release_dropout_param() {
-  clear_has_dropout_param();
-  ::caffe::DropoutParameter* temp = dropout_param_;
-  dropout_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_dropout_param(::caffe::DropoutParameter* dropout_param) {
-  delete dropout_param_;
-  dropout_param_ = dropout_param;
-  if (dropout_param) {
-    set_has_dropout_param();
-  } else {
-    clear_has_dropout_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.dropout_param)
-}
-
-// optional .caffe.DummyDataParameter dummy_data_param = 109;
-inline bool LayerParameter::has_dummy_data_param() const {
-  return (_has_bits_[0] & 0x00800000u) != 0;
-}
-inline void LayerParameter::set_has_dummy_data_param() {
-  _has_bits_[0] |= 0x00800000u;
-}
-inline void LayerParameter::clear_has_dummy_data_param() {
-  _has_bits_[0] &= ~0x00800000u;
-}
-inline void LayerParameter::clear_dummy_data_param() {
-  if (dummy_data_param_ != NULL) dummy_data_param_->::caffe::DummyDataParameter::Clear();
-  clear_has_dummy_data_param();
-}
-inline const ::caffe::DummyDataParameter& LayerParameter::dummy_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.dummy_data_param)
-  return dummy_data_param_ != NULL ? *dummy_data_param_ : *default_instance_->dummy_data_param_;
-}
-inline ::caffe::DummyDataParameter* LayerParameter::mutable_dummy_data_param() {
-  set_has_dummy_data_param();
-  if (dummy_data_param_ == NULL) dummy_data_param_ = new ::caffe::DummyDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.dummy_data_param)
-  return dummy_data_param_;
-}
-inline ::caffe::DummyDataParameter* LayerParameter::release_dummy_data_param() {
-  clear_has_dummy_data_param();
-  ::caffe::DummyDataParameter* temp = dummy_data_param_;
-  dummy_data_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_dummy_data_param(::caffe::DummyDataParameter* dummy_data_param) {
-  delete dummy_data_param_;
-  dummy_data_param_ = dummy_data_param;
-  if (dummy_data_param) {
-    set_has_dummy_data_param();
-  } else {
-    clear_has_dummy_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.dummy_data_param)
-}
-
-// optional .caffe.EltwiseParameter eltwise_param = 110;
-inline bool LayerParameter::has_eltwise_param() const {
-  return (_has_bits_[0] & 0x01000000u) != 0;
-}
-inline void LayerParameter::set_has_eltwise_param() {
-  _has_bits_[0] |= 0x01000000u;
-}
-inline void LayerParameter::clear_has_eltwise_param() {
-  _has_bits_[0] &= ~0x01000000u;
-}
-inline void LayerParameter::clear_eltwise_param() {
-  if (eltwise_param_ != NULL) eltwise_param_->::caffe::EltwiseParameter::Clear();
-  clear_has_eltwise_param();
-}
-inline const ::caffe::EltwiseParameter& LayerParameter::eltwise_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.eltwise_param)
-  return eltwise_param_ != NULL ? *eltwise_param_ : *default_instance_->eltwise_param_;
-}
-inline ::caffe::EltwiseParameter* LayerParameter::mutable_eltwise_param() {
-  set_has_eltwise_param();
-  if (eltwise_param_ == NULL) eltwise_param_ = new ::caffe::EltwiseParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.eltwise_param)
-  return eltwise_param_;
-}
-inline ::caffe::EltwiseParameter* LayerParameter::release_eltwise_param() {
-  clear_has_eltwise_param();
-  ::caffe::EltwiseParameter* temp = eltwise_param_;
-  eltwise_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_eltwise_param(::caffe::EltwiseParameter* eltwise_param) {
-  delete eltwise_param_;
-  eltwise_param_ = eltwise_param;
-  if (eltwise_param) {
-    set_has_eltwise_param();
-  } else {
-    clear_has_eltwise_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.eltwise_param)
-}
-
-// optional .caffe.ELUParameter elu_param = 140;
-inline bool LayerParameter::has_elu_param() const {
-  return (_has_bits_[0] & 0x02000000u) != 0;
-}
-inline void LayerParameter::set_has_elu_param() {
-  _has_bits_[0] |= 0x02000000u;
-}
-inline void LayerParameter::clear_has_elu_param() {
-  _has_bits_[0] &= ~0x02000000u;
-}
-inline void LayerParameter::clear_elu_param() {
-  if (elu_param_ != NULL) elu_param_->::caffe::ELUParameter::Clear();
-  clear_has_elu_param();
-}
-inline const ::caffe::ELUParameter& LayerParameter::elu_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.elu_param)
-  return elu_param_ != NULL ? *elu_param_ : *default_instance_->elu_param_;
-}
-inline ::caffe::ELUParameter* LayerParameter::mutable_elu_param() {
-  set_has_elu_param();
-  if (elu_param_ == NULL) elu_param_ = new ::caffe::ELUParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.elu_param)
-  return elu_param_;
-}
-inline ::caffe::ELUParameter* LayerParameter::release_elu_param() {
-  clear_has_elu_param();
-  ::caffe::ELUParameter* temp = elu_param_;
-  elu_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_elu_param(::caffe::ELUParameter* elu_param) {
-  delete elu_param_;
-  elu_param_ = elu_param;
-  if (elu_param) {
-    set_has_elu_param();
-  } else {
-    clear_has_elu_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.elu_param)
-}
-
-// optional .caffe.EmbedParameter embed_param = 137;
-inline bool LayerParameter::has_embed_param() const {
-  return (_has_bits_[0] & 0x04000000u) != 0;
-}
-inline void LayerParameter::set_has_embed_param() {
-  _has_bits_[0] |= 0x04000000u;
-}
-inline void LayerParameter::clear_has_embed_param() {
-  _has_bits_[0] &= ~0x04000000u;
-}
-inline void LayerParameter::clear_embed_param() {
-  if (embed_param_ != NULL) embed_param_->::caffe::EmbedParameter::Clear();
-  clear_has_embed_param();
-}
-inline const ::caffe::EmbedParameter& LayerParameter::embed_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.embed_param)
-  return embed_param_ != NULL ? *embed_param_ : *default_instance_->embed_param_;
-}
-inline ::caffe::EmbedParameter* LayerParameter::mutable_embed_param() {
-  set_has_embed_param();
-  if (embed_param_ == NULL) embed_param_ = new ::caffe::EmbedParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.embed_param)
-  return embed_param_;
-}
-inline ::caffe::EmbedParameter* LayerParameter::release_embed_param() {
-  clear_has_embed_param();
-  ::caffe::EmbedParameter* temp = embed_param_;
-  embed_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_embed_param(::caffe::EmbedParameter* embed_param) {
-  delete embed_param_;
-  embed_param_ = embed_param;
-  if (embed_param) {
-    set_has_embed_param();
-  } else {
-    clear_has_embed_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.embed_param)
-}
-
-// optional .caffe.ExpParameter exp_param = 111;
-inline bool LayerParameter::has_exp_param() const {
-  return (_has_bits_[0] & 0x08000000u) != 0;
-}
-inline void LayerParameter::set_has_exp_param() {
-  _has_bits_[0] |= 0x08000000u;
-}
-inline void LayerParameter::clear_has_exp_param() {
-  _has_bits_[0] &= ~0x08000000u;
-}
-inline void LayerParameter::clear_exp_param() {
-  if (exp_param_ != NULL) exp_param_->::caffe::ExpParameter::Clear();
-  clear_has_exp_param();
-}
-inline const ::caffe::ExpParameter& LayerParameter::exp_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.exp_param)
-  return exp_param_ != NULL ? *exp_param_ : *default_instance_->exp_param_;
-}
-inline ::caffe::ExpParameter* LayerParameter::mutable_exp_param() {
-  set_has_exp_param();
-  if (exp_param_ == NULL) exp_param_ = new ::caffe::ExpParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.exp_param)
-  return exp_param_;
-}
-inline ::caffe::ExpParameter* LayerParameter::release_exp_param() {
-  clear_has_exp_param();
-  ::caffe::ExpParameter* temp = exp_param_;
-  exp_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_exp_param(::caffe::ExpParameter* exp_param) {
-  delete exp_param_;
-  exp_param_ = exp_param;
-  if (exp_param) {
-    set_has_exp_param();
-  } else {
-    clear_has_exp_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.exp_param)
-}
-
-// optional .caffe.FlattenParameter flatten_param = 135;
-inline bool LayerParameter::has_flatten_param() const {
-  return (_has_bits_[0] & 0x10000000u) != 0;
-}
-inline void LayerParameter::set_has_flatten_param() {
-  _has_bits_[0] |= 0x10000000u;
-}
-inline void LayerParameter::clear_has_flatten_param() {
-  _has_bits_[0] &= ~0x10000000u;
-}
-inline void LayerParameter::clear_flatten_param() {
-  if (flatten_param_ != NULL) flatten_param_->::caffe::FlattenParameter::Clear();
-  clear_has_flatten_param();
-}
-inline const ::caffe::FlattenParameter& LayerParameter::flatten_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.flatten_param)
-  return flatten_param_ != NULL ? *flatten_param_ : *default_instance_->flatten_param_;
-}
-inline ::caffe::FlattenParameter* LayerParameter::mutable_flatten_param() {
-  set_has_flatten_param();
-  if (flatten_param_ == NULL) flatten_param_ = new ::caffe::FlattenParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.flatten_param)
-  return flatten_param_;
-}
-inline ::caffe::FlattenParameter* LayerParameter::release_flatten_param() {
-  clear_has_flatten_param();
-  ::caffe::FlattenParameter* temp = flatten_param_;
-  flatten_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_flatten_param(::caffe::FlattenParameter* flatten_param) {
-  delete flatten_param_;
-  flatten_param_ = flatten_param;
-  if (flatten_param) {
-    set_has_flatten_param();
-  } else {
-    clear_has_flatten_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.flatten_param)
-}
-
-// optional .caffe.HDF5DataParameter hdf5_data_param = 112;
-inline bool LayerParameter::has_hdf5_data_param() const {
-  return (_has_bits_[0] & 0x20000000u) != 0;
-}
-inline void LayerParameter::set_has_hdf5_data_param() {
-  _has_bits_[0] |= 0x20000000u;
-}
-inline void LayerParameter::clear_has_hdf5_data_param() {
-  _has_bits_[0] &= ~0x20000000u;
-}
-inline void LayerParameter::clear_hdf5_data_param() {
-  if (hdf5_data_param_ != NULL) hdf5_data_param_->::caffe::HDF5DataParameter::Clear();
-  clear_has_hdf5_data_param();
-}
-inline const ::caffe::HDF5DataParameter& LayerParameter::hdf5_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.hdf5_data_param)
-  return hdf5_data_param_ != NULL ? *hdf5_data_param_ : *default_instance_->hdf5_data_param_;
-}
-inline ::caffe::HDF5DataParameter* LayerParameter::mutable_hdf5_data_param() {
-  set_has_hdf5_data_param();
-  if (hdf5_data_param_ == NULL) hdf5_data_param_ = new ::caffe::HDF5DataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.hdf5_data_param)
-  return hdf5_data_param_;
-}
-inline ::caffe::HDF5DataParameter* LayerParameter::release_hdf5_data_param() {
-  clear_has_hdf5_data_param();
-  ::caffe::HDF5DataParameter* temp = hdf5_data_param_;
-  hdf5_data_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_hdf5_data_param(::caffe::HDF5DataParameter* hdf5_data_param) {
-  delete hdf5_data_param_;
-  hdf5_data_param_ = hdf5_data_param;
-  if (hdf5_data_param) {
-    set_has_hdf5_data_param();
-  } else {
-    clear_has_hdf5_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.hdf5_data_param)
-}
-
-// optional .caffe.HDF5OutputParameter hdf5_output_param = 113;
-inline bool LayerParameter::has_hdf5_output_param() const {
-  return (_has_bits_[0] & 0x40000000u) != 0;
-}
-inline void LayerParameter::set_has_hdf5_output_param() {
-  _has_bits_[0] |= 0x40000000u;
-}
-inline void LayerParameter::clear_has_hdf5_output_param() {
-  _has_bits_[0] &= ~0x40000000u;
-}
-inline void LayerParameter::clear_hdf5_output_param() {
-  if (hdf5_output_param_ != NULL) hdf5_output_param_->::caffe::HDF5OutputParameter::Clear();
-  clear_has_hdf5_output_param();
-}
-inline const ::caffe::HDF5OutputParameter& LayerParameter::hdf5_output_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.hdf5_output_param)
-  return hdf5_output_param_ != NULL ? *hdf5_output_param_ : *default_instance_->hdf5_output_param_;
-}
-inline ::caffe::HDF5OutputParameter* LayerParameter::mutable_hdf5_output_param() {
-  set_has_hdf5_output_param();
-  if (hdf5_output_param_ == NULL) hdf5_output_param_ = new ::caffe::HDF5OutputParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.hdf5_output_param)
-  return hdf5_output_param_;
-}
-inline ::caffe::HDF5OutputParameter* LayerParameter::release_hdf5_output_param() {
-  clear_has_hdf5_output_param();
-  ::caffe::HDF5OutputParameter* temp = hdf5_output_param_;
-  hdf5_output_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_hdf5_output_param(::caffe::HDF5OutputParameter* hdf5_output_param) {
-  delete hdf5_output_param_;
-  hdf5_output_param_ = hdf5_output_param;
-  if (hdf5_output_param) {
-    set_has_hdf5_output_param();
-  } else {
-    clear_has_hdf5_output_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.hdf5_output_param)
-}
-
-// optional .caffe.HingeLossParameter hinge_loss_param = 114;
-inline bool LayerParameter::has_hinge_loss_param() const {
-  return (_has_bits_[0] & 0x80000000u) != 0;
-}
-inline void LayerParameter::set_has_hinge_loss_param() {
-  _has_bits_[0] |= 0x80000000u;
-}
-inline void LayerParameter::clear_has_hinge_loss_param() {
-  _has_bits_[0] &= ~0x80000000u;
-}
-inline void LayerParameter::clear_hinge_loss_param() {
-  if (hinge_loss_param_ != NULL) hinge_loss_param_->::caffe::HingeLossParameter::Clear();
-  clear_has_hinge_loss_param();
-}
-inline const ::caffe::HingeLossParameter& LayerParameter::hinge_loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.hinge_loss_param)
-  return hinge_loss_param_ != NULL ? *hinge_loss_param_ : *default_instance_->hinge_loss_param_;
-}
-inline ::caffe::HingeLossParameter* LayerParameter::mutable_hinge_loss_param() {
-  set_has_hinge_loss_param();
-  if (hinge_loss_param_ == NULL) hinge_loss_param_ = new ::caffe::HingeLossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.hinge_loss_param)
-  return hinge_loss_param_;
-}
-inline ::caffe::HingeLossParameter* LayerParameter::release_hinge_loss_param() {
-  clear_has_hinge_loss_param();
-  ::caffe::HingeLossParameter* temp = hinge_loss_param_;
-  hinge_loss_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_hinge_loss_param(::caffe::HingeLossParameter* hinge_loss_param) {
-  delete hinge_loss_param_;
-  hinge_loss_param_ = hinge_loss_param;
-  if (hinge_loss_param) {
-    set_has_hinge_loss_param();
-  } else {
-    clear_has_hinge_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.hinge_loss_param)
-}
-
-// optional .caffe.ImageDataParameter image_data_param = 115;
-inline bool LayerParameter::has_image_data_param() const {
-  return (_has_bits_[1] & 0x00000001u) != 0;
-}
-inline void LayerParameter::set_has_image_data_param() {
-  _has_bits_[1] |= 0x00000001u;
-}
-inline void LayerParameter::clear_has_image_data_param() {
-  _has_bits_[1] &= ~0x00000001u;
-}
-inline void LayerParameter::clear_image_data_param() {
-  if (image_data_param_ != NULL) image_data_param_->::caffe::ImageDataParameter::Clear();
-  clear_has_image_data_param();
-}
-inline const ::caffe::ImageDataParameter& LayerParameter::image_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.image_data_param)
-  return image_data_param_ != NULL ? *image_data_param_ : *default_instance_->image_data_param_;
-}
-inline ::caffe::ImageDataParameter* LayerParameter::mutable_image_data_param() {
-  set_has_image_data_param();
-  if (image_data_param_ == NULL) image_data_param_ = new ::caffe::ImageDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.image_data_param)
-  return image_data_param_;
-}
-inline ::caffe::ImageDataParameter* LayerParameter::release_image_data_param() {
-  clear_has_image_data_param();
-  ::caffe::ImageDataParameter* temp = image_data_param_;
-  image_data_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_image_data_param(::caffe::ImageDataParameter* image_data_param) {
-  delete image_data_param_;
-  image_data_param_ = image_data_param;
-  if (image_data_param) {
-    set_has_image_data_param();
-  } else {
-    clear_has_image_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.image_data_param)
-}
-
-// optional .caffe.InfogainLossParameter infogain_loss_param = 116;
-inline bool LayerParameter::has_infogain_loss_param() const {
-  return (_has_bits_[1] & 0x00000002u) != 0;
-}
-inline void LayerParameter::set_has_infogain_loss_param() {
-  _has_bits_[1] |= 0x00000002u;
-}
-inline void LayerParameter::clear_has_infogain_loss_param() {
-  _has_bits_[1] &= ~0x00000002u;
-}
-inline void LayerParameter::clear_infogain_loss_param() {
-  if (infogain_loss_param_ != NULL) infogain_loss_param_->::caffe::InfogainLossParameter::Clear();
-  clear_has_infogain_loss_param();
-}
-inline const ::caffe::InfogainLossParameter& LayerParameter::infogain_loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.infogain_loss_param)
-  return infogain_loss_param_ != NULL ? *infogain_loss_param_ : *default_instance_->infogain_loss_param_;
-}
-inline ::caffe::InfogainLossParameter* LayerParameter::mutable_infogain_loss_param() {
-  set_has_infogain_loss_param();
-  if (infogain_loss_param_ == NULL) infogain_loss_param_ = new ::caffe::InfogainLossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.infogain_loss_param)
-  return infogain_loss_param_;
-}
-inline ::caffe::InfogainLossParameter* LayerParameter::release_infogain_loss_param() {
-  clear_has_infogain_loss_param();
-  ::caffe::InfogainLossParameter* temp = infogain_loss_param_;
-  infogain_loss_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_infogain_loss_param(::caffe::InfogainLossParameter* infogain_loss_param) {
-  delete infogain_loss_param_;
-  infogain_loss_param_ = infogain_loss_param;
-  if (infogain_loss_param) {
-    set_has_infogain_loss_param();
-  } else {
-    clear_has_infogain_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.infogain_loss_param)
-}
-
-// optional .caffe.InnerProductParameter inner_product_param = 117;
-inline bool LayerParameter::has_inner_product_param() const {
-  return (_has_bits_[1] & 0x00000004u) != 0;
-}
-inline void LayerParameter::set_has_inner_product_param() {
-  _has_bits_[1] |= 0x00000004u;
-}
-inline void LayerParameter::clear_has_inner_product_param() {
-  _has_bits_[1] &= ~0x00000004u;
-}
-inline void LayerParameter::clear_inner_product_param() {
-  if (inner_product_param_ != NULL) inner_product_param_->::caffe::InnerProductParameter::Clear();
-  clear_has_inner_product_param();
-}
-inline const ::caffe::InnerProductParameter& LayerParameter::inner_product_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.inner_product_param)
-  return inner_product_param_ != NULL ? *inner_product_param_ : *default_instance_->inner_product_param_;
-}
-inline ::caffe::InnerProductParameter* LayerParameter::mutable_inner_product_param() {
-  set_has_inner_product_param();
-  if (inner_product_param_ == NULL) inner_product_param_ = new ::caffe::InnerProductParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.inner_product_param)
-  return inner_product_param_;
-}
-inline ::caffe::InnerProductParameter* LayerParameter::release_inner_product_param() {
-  clear_has_inner_product_param();
-  ::caffe::InnerProductParameter* temp = inner_product_param_;
-  inner_product_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_inner_product_param(::caffe::InnerProductParameter* inner_product_param) {
-  delete inner_product_param_;
-  inner_product_param_ = inner_product_param;
-  if (inner_product_param) {
-    set_has_inner_product_param();
-  } else {
-    clear_has_inner_product_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.inner_product_param)
-}
-
-// optional .caffe.InputParameter input_param = 143;
-inline bool LayerParameter::has_input_param() const {
-  return (_has_bits_[1] & 0x00000008u) != 0;
-}
-inline void LayerParameter::set_has_input_param() {
-  _has_bits_[1] |= 0x00000008u;
-}
-inline void LayerParameter::clear_has_input_param() {
-  _has_bits_[1] &= ~0x00000008u;
-}
-inline void LayerParameter::clear_input_param() {
-  if (input_param_ != NULL) input_param_->::caffe::InputParameter::Clear();
-  clear_has_input_param();
-}
-inline const ::caffe::InputParameter& LayerParameter::input_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.input_param)
-  return input_param_ != NULL ? *input_param_ : *default_instance_->input_param_;
-}
-inline ::caffe::InputParameter* LayerParameter::mutable_input_param() {
-  set_has_input_param();
-  if (input_param_ == NULL) input_param_ = new ::caffe::InputParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.input_param)
-  return input_param_;
-}
-inline ::caffe::InputParameter* LayerParameter::release_input_param() {
-  clear_has_input_param();
-  ::caffe::InputParameter* temp = input_param_;
-  input_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_input_param(::caffe::InputParameter* input_param) {
-  delete input_param_;
-  input_param_ = input_param;
-  if (input_param) {
-    set_has_input_param();
-  } else {
-    clear_has_input_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.input_param)
-}
-
-// optional .caffe.LogParameter log_param = 134;
-inline bool LayerParameter::has_log_param() const {
-  return (_has_bits_[1] & 0x00000010u) != 0;
-}
-inline void LayerParameter::set_has_log_param() {
-  _has_bits_[1] |= 0x00000010u;
-}
-inline void LayerParameter::clear_has_log_param() {
-  _has_bits_[1] &= ~0x00000010u;
-}
-inline void LayerParameter::clear_log_param() {
-  if (log_param_ != NULL) log_param_->::caffe::LogParameter::Clear();
-  clear_has_log_param();
-}
-inline const ::caffe::LogParameter& LayerParameter::log_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.log_param)
-  return log_param_ != NULL ? *log_param_ : *default_instance_->log_param_;
-}
-inline ::caffe::LogParameter* LayerParameter::mutable_log_param() {
-  set_has_log_param();
-  if (log_param_ == NULL) log_param_ = new ::caffe::LogParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.log_param)
-  return log_param_;
-}
-inline ::caffe::LogParameter* LayerParameter::release_log_param() {
-  clear_has_log_param();
-  ::caffe::LogParameter* temp = log_param_;
-  log_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_log_param(::caffe::LogParameter* log_param) {
-  delete log_param_;
-  log_param_ = log_param;
-  if (log_param) {
-    set_has_log_param();
-  } else {
-    clear_has_log_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.log_param)
-}
-
-// optional .caffe.LRNParameter lrn_param = 118;
-inline bool LayerParameter::has_lrn_param() const {
-  return (_has_bits_[1] & 0x00000020u) != 0;
-}
-inline void LayerParameter::set_has_lrn_param() {
-  _has_bits_[1] |= 0x00000020u;
-}
-inline void LayerParameter::clear_has_lrn_param() {
-  _has_bits_[1] &= ~0x00000020u;
-}
-inline void LayerParameter::clear_lrn_param() {
-  if (lrn_param_ != NULL) lrn_param_->::caffe::LRNParameter::Clear();
-  clear_has_lrn_param();
-}
-inline const ::caffe::LRNParameter& LayerParameter::lrn_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.lrn_param)
-  return lrn_param_ != NULL ? *lrn_param_ : *default_instance_->lrn_param_;
-}
-inline ::caffe::LRNParameter* LayerParameter::mutable_lrn_param() {
-  set_has_lrn_param();
-  if (lrn_param_ == NULL) lrn_param_ = new ::caffe::LRNParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.lrn_param)
-  return lrn_param_;
-}
-inline ::caffe::LRNParameter* LayerParameter::release_lrn_param() {
-  clear_has_lrn_param();
-  ::caffe::LRNParameter* temp = lrn_param_;
-  lrn_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_lrn_param(::caffe::LRNParameter* lrn_param) {
-  delete lrn_param_;
-  lrn_param_ = lrn_param;
-  if (lrn_param) {
-    set_has_lrn_param();
-  } else {
-    clear_has_lrn_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.lrn_param)
-}
-
-// optional .caffe.MemoryDataParameter memory_data_param = 119;
-inline bool LayerParameter::has_memory_data_param() const {
-  return (_has_bits_[1] & 0x00000040u) != 0;
-}
-inline void LayerParameter::set_has_memory_data_param() {
-  _has_bits_[1] |= 0x00000040u;
-}
-inline void LayerParameter::clear_has_memory_data_param() {
-  _has_bits_[1] &= ~0x00000040u;
-}
-inline void LayerParameter::clear_memory_data_param() {
-  if (memory_data_param_ != NULL) memory_data_param_->::caffe::MemoryDataParameter::Clear();
-  clear_has_memory_data_param();
-}
-inline const ::caffe::MemoryDataParameter& LayerParameter::memory_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.memory_data_param)
-  return memory_data_param_ != NULL ? *memory_data_param_ : *default_instance_->memory_data_param_;
-}
-inline ::caffe::MemoryDataParameter* LayerParameter::mutable_memory_data_param() {
-  set_has_memory_data_param();
-  if (memory_data_param_ == NULL) memory_data_param_ = new ::caffe::MemoryDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.memory_data_param)
-  return memory_data_param_;
-}
-inline ::caffe::MemoryDataParameter* LayerParameter::release_memory_data_param() {
-  clear_has_memory_data_param();
-  ::caffe::MemoryDataParameter* temp = memory_data_param_;
-  memory_data_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_memory_data_param(::caffe::MemoryDataParameter* memory_data_param) {
-  delete memory_data_param_;
-  memory_data_param_ = memory_data_param;
-  if (memory_data_param) {
-    set_has_memory_data_param();
-  } else {
-    clear_has_memory_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.memory_data_param)
-}
-
-// optional .caffe.MVNParameter mvn_param = 120;
-inline bool LayerParameter::has_mvn_param() const {
-  return (_has_bits_[1] & 0x00000080u) != 0;
-}
-inline void LayerParameter::set_has_mvn_param() {
-  _has_bits_[1] |= 0x00000080u;
-}
-inline void LayerParameter::clear_has_mvn_param() {
-  _has_bits_[1] &= ~0x00000080u;
-}
-inline void LayerParameter::clear_mvn_param() {
-  if (mvn_param_ != NULL) mvn_param_->::caffe::MVNParameter::Clear();
-  clear_has_mvn_param();
-}
-inline const ::caffe::MVNParameter& LayerParameter::mvn_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.mvn_param)
-  return mvn_param_ != NULL ? *mvn_param_ : *default_instance_->mvn_param_;
-}
-inline ::caffe::MVNParameter* LayerParameter::mutable_mvn_param() {
-  set_has_mvn_param();
-  if (mvn_param_ == NULL) mvn_param_ = new ::caffe::MVNParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.mvn_param)
-  return mvn_param_;
-}
-inline ::caffe::MVNParameter* LayerParameter::release_mvn_param() {
-  clear_has_mvn_param();
-  ::caffe::MVNParameter* temp = mvn_param_;
-  mvn_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_mvn_param(::caffe::MVNParameter* mvn_param) {
-  delete mvn_param_;
-  mvn_param_ = mvn_param;
-  if (mvn_param) {
-    set_has_mvn_param();
-  } else {
-    clear_has_mvn_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.mvn_param)
-}
-
-// optional .caffe.ParameterParameter parameter_param = 145;
-inline bool LayerParameter::has_parameter_param() const {
-  return (_has_bits_[1] & 0x00000100u) != 0;
-}
-inline void LayerParameter::set_has_parameter_param() {
-  _has_bits_[1] |= 0x00000100u;
-}
-inline void LayerParameter::clear_has_parameter_param() {
-  _has_bits_[1] &= ~0x00000100u;
-}
-inline void LayerParameter::clear_parameter_param() {
-  if (parameter_param_ != NULL) parameter_param_->::caffe::ParameterParameter::Clear();
-  clear_has_parameter_param();
-}
-inline const ::caffe::ParameterParameter& LayerParameter::parameter_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.parameter_param)
-  return parameter_param_ != NULL ? *parameter_param_ : *default_instance_->parameter_param_;
-}
-inline ::caffe::ParameterParameter* LayerParameter::mutable_parameter_param() {
-  set_has_parameter_param();
-  if (parameter_param_ == NULL) parameter_param_ = new ::caffe::ParameterParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.parameter_param)
-  return parameter_param_;
-}
-inline ::caffe::ParameterParameter* LayerParameter::release_parameter_param() {
-  clear_has_parameter_param();
-  ::caffe::ParameterParameter* temp = parameter_param_;
-  parameter_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_parameter_param(::caffe::ParameterParameter* parameter_param) {
-  delete parameter_param_;
-  parameter_param_ = parameter_param;
-  if (parameter_param) {
-    set_has_parameter_param();
-  } else {
-    clear_has_parameter_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.parameter_param)
-}
-
-// optional .caffe.PoolingParameter pooling_param = 121;
-inline bool LayerParameter::has_pooling_param() const {
-  return (_has_bits_[1] & 0x00000200u) != 0;
-}
-inline void LayerParameter::set_has_pooling_param() {
-  _has_bits_[1] |= 0x00000200u;
-}
-inline void LayerParameter::clear_has_pooling_param() {
-  _has_bits_[1] &= ~0x00000200u;
-}
-inline void LayerParameter::clear_pooling_param() {
-  if (pooling_param_ != NULL) pooling_param_->::caffe::PoolingParameter::Clear();
-  clear_has_pooling_param();
-}
-inline const ::caffe::PoolingParameter& LayerParameter::pooling_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.pooling_param)
-  return pooling_param_ != NULL ? *pooling_param_ : *default_instance_->pooling_param_;
-}
-inline ::caffe::PoolingParameter* LayerParameter::mutable_pooling_param() {
-  set_has_pooling_param();
-  if (pooling_param_ == NULL) pooling_param_ = new ::caffe::PoolingParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.pooling_param)
-  return pooling_param_;
-}
-inline ::caffe::PoolingParameter* LayerParameter::release_pooling_param() {
-  clear_has_pooling_param();
-  ::caffe::PoolingParameter* temp = pooling_param_;
-  pooling_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_pooling_param(::caffe::PoolingParameter* pooling_param) {
-  delete pooling_param_;
-  pooling_param_ = pooling_param;
-  if (pooling_param) {
-    set_has_pooling_param();
-  } else {
-    clear_has_pooling_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.pooling_param)
-}
-
-// optional .caffe.PowerParameter power_param = 122;
-inline bool LayerParameter::has_power_param() const {
-  return (_has_bits_[1] & 0x00000400u) != 0;
-}
-inline void LayerParameter::set_has_power_param() {
-  _has_bits_[1] |= 0x00000400u;
-}
-inline void LayerParameter::clear_has_power_param() {
-  _has_bits_[1] &= ~0x00000400u;
-}
-inline void LayerParameter::clear_power_param() {
-  if (power_param_ != NULL) power_param_->::caffe::PowerParameter::Clear();
-  clear_has_power_param();
-}
-inline const ::caffe::PowerParameter& LayerParameter::power_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.power_param)
-  return power_param_ != NULL ? *power_param_ : *default_instance_->power_param_;
-}
-inline ::caffe::PowerParameter* LayerParameter::mutable_power_param() {
-  set_has_power_param();
-  if (power_param_ == NULL) power_param_ = new ::caffe::PowerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.power_param)
-  return power_param_;
-}
-inline ::caffe::PowerParameter* LayerParameter::release_power_param() {
-  clear_has_power_param();
-  ::caffe::PowerParameter* temp = power_param_;
-  power_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_power_param(::caffe::PowerParameter* power_param) {
-  delete power_param_;
-  power_param_ = power_param;
-  if (power_param) {
-    set_has_power_param();
-  } else {
-    clear_has_power_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.power_param)
-}
-
-// optional .caffe.PReLUParameter prelu_param = 131;
-inline bool LayerParameter::has_prelu_param() const {
-  return (_has_bits_[1] & 0x00000800u) != 0;
-}
-inline void LayerParameter::set_has_prelu_param() {
-  _has_bits_[1] |= 0x00000800u;
-}
-inline void LayerParameter::clear_has_prelu_param() {
-  _has_bits_[1] &= ~0x00000800u;
-}
-inline void LayerParameter::clear_prelu_param() {
-  if (prelu_param_ != NULL) prelu_param_->::caffe::PReLUParameter::Clear();
-  clear_has_prelu_param();
-}
-inline const ::caffe::PReLUParameter& LayerParameter::prelu_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.prelu_param)
-  return prelu_param_ != NULL ? *prelu_param_ : *default_instance_->prelu_param_;
-}
-inline ::caffe::PReLUParameter* LayerParameter::mutable_prelu_param() {
-  set_has_prelu_param();
-  if (prelu_param_ == NULL) prelu_param_ = new ::caffe::PReLUParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.prelu_param)
-  return prelu_param_;
-}
-inline ::caffe::PReLUParameter* LayerParameter::release_prelu_param() {
-  clear_has_prelu_param();
-  ::caffe::PReLUParameter* temp = prelu_param_;
-  prelu_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_prelu_param(::caffe::PReLUParameter* prelu_param) {
-  delete prelu_param_;
-  prelu_param_ = prelu_param;
-  if (prelu_param) {
-    set_has_prelu_param();
-  } else {
-    clear_has_prelu_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.prelu_param)
-}
-
-// optional .caffe.PythonParameter python_param = 130;
-inline bool LayerParameter::has_python_param() const {
-  return (_has_bits_[1] & 0x00001000u) != 0;
-}
-inline void LayerParameter::set_has_python_param() {
-  _has_bits_[1] |= 0x00001000u;
-}
-inline void LayerParameter::clear_has_python_param() {
-  _has_bits_[1] &= ~0x00001000u;
-}
-inline void LayerParameter::clear_python_param() {
-  if (python_param_ != NULL) python_param_->::caffe::PythonParameter::Clear();
-  clear_has_python_param();
-}
-inline const ::caffe::PythonParameter& LayerParameter::python_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.python_param)
-  return python_param_ != NULL ? *python_param_ : *default_instance_->python_param_;
-}
-inline ::caffe::PythonParameter* LayerParameter::mutable_python_param() {
-  set_has_python_param();
-  if (python_param_ == NULL) python_param_ = new ::caffe::PythonParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.python_param)
-  return python_param_;
-}
-inline ::caffe::PythonParameter* LayerParameter::release_python_param() {
-  clear_has_python_param();
-  ::caffe::PythonParameter* temp = python_param_;
-  python_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_python_param(::caffe::PythonParameter* python_param) {
-  delete python_param_;
-  python_param_ = python_param;
-  if (python_param) {
-    set_has_python_param();
-  } else {
-    clear_has_python_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.python_param)
-}
-
-// optional .caffe.RecurrentParameter recurrent_param = 146;
-inline bool LayerParameter::has_recurrent_param() const {
-  return (_has_bits_[1] & 0x00002000u) != 0;
-}
-inline void LayerParameter::set_has_recurrent_param() {
-  _has_bits_[1] |= 0x00002000u;
-}
-inline void LayerParameter::clear_has_recurrent_param() {
-  _has_bits_[1] &= ~0x00002000u;
-}
-inline void LayerParameter::clear_recurrent_param() {
-  if (recurrent_param_ != NULL) recurrent_param_->::caffe::RecurrentParameter::Clear();
-  clear_has_recurrent_param();
-}
-inline const ::caffe::RecurrentParameter& LayerParameter::recurrent_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.recurrent_param)
-  return recurrent_param_ != NULL ? *recurrent_param_ : *default_instance_->recurrent_param_;
-}
-inline ::caffe::RecurrentParameter* LayerParameter::mutable_recurrent_param() {
-  set_has_recurrent_param();
-  if (recurrent_param_ == NULL) recurrent_param_ = new ::caffe::RecurrentParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.recurrent_param)
-  return recurrent_param_;
-}
-inline ::caffe::RecurrentParameter* LayerParameter::release_recurrent_param() {
-  clear_has_recurrent_param();
-  ::caffe::RecurrentParameter* temp = recurrent_param_;
-  recurrent_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_recurrent_param(::caffe::RecurrentParameter* recurrent_param) {
-  delete recurrent_param_;
-  recurrent_param_ = recurrent_param;
-  if (recurrent_param) {
-    set_has_recurrent_param();
-  } else {
-    clear_has_recurrent_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.recurrent_param)
-}
-
-// optional .caffe.ReductionParameter reduction_param = 136;
-inline bool LayerParameter::has_reduction_param() const {
-  return (_has_bits_[1] & 0x00004000u) != 0;
-}
-inline void LayerParameter::set_has_reduction_param() {
-  _has_bits_[1] |= 0x00004000u;
-}
-inline void LayerParameter::clear_has_reduction_param() {
-  _has_bits_[1] &= ~0x00004000u;
-}
-inline void LayerParameter::clear_reduction_param() {
-  if (reduction_param_ != NULL) reduction_param_->::caffe::ReductionParameter::Clear();
-  clear_has_reduction_param();
-}
-inline const ::caffe::ReductionParameter& LayerParameter::reduction_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.reduction_param)
-  return reduction_param_ != NULL ? *reduction_param_ : *default_instance_->reduction_param_;
-}
-inline ::caffe::ReductionParameter* LayerParameter::mutable_reduction_param() {
-  set_has_reduction_param();
-  if (reduction_param_ == NULL) reduction_param_ = new ::caffe::ReductionParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.reduction_param)
-  return reduction_param_;
-}
-inline ::caffe::ReductionParameter* LayerParameter::release_reduction_param() {
-  clear_has_reduction_param();
-  ::caffe::ReductionParameter* temp = reduction_param_;
-  reduction_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_reduction_param(::caffe::ReductionParameter* reduction_param) {
-  delete reduction_param_;
-  reduction_param_ = reduction_param;
-  if (reduction_param) {
-    set_has_reduction_param();
-  } else {
-    clear_has_reduction_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.reduction_param)
-}
-
-// optional .caffe.ReLUParameter relu_param = 123;
-inline bool LayerParameter::has_relu_param() const {
-  return (_has_bits_[1] & 0x00008000u) != 0;
-}
-inline void LayerParameter::set_has_relu_param() {
-  _has_bits_[1] |= 0x00008000u;
-}
-inline void LayerParameter::clear_has_relu_param() {
-  _has_bits_[1] &= ~0x00008000u;
-}
-inline void LayerParameter::clear_relu_param() {
-  if (relu_param_ != NULL) relu_param_->::caffe::ReLUParameter::Clear();
-  clear_has_relu_param();
-}
-inline const ::caffe::ReLUParameter& LayerParameter::relu_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.relu_param)
-  return relu_param_ != NULL ? *relu_param_ : *default_instance_->relu_param_;
-}
-inline ::caffe::ReLUParameter* LayerParameter::mutable_relu_param() {
-  set_has_relu_param();
-  if (relu_param_ == NULL) relu_param_ = new ::caffe::ReLUParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.relu_param)
-  return relu_param_;
-}
-inline ::caffe::ReLUParameter* LayerParameter::release_relu_param() {
-  clear_has_relu_param();
-  ::caffe::ReLUParameter* temp = relu_param_;
-  relu_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_relu_param(::caffe::ReLUParameter* relu_param) {
-  delete relu_param_;
-  relu_param_ = relu_param;
-  if (relu_param) {
-    set_has_relu_param();
-  } else {
-    clear_has_relu_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.relu_param)
-}
-
-// optional .caffe.ReshapeParameter reshape_param = 133;
-inline bool LayerParameter::has_reshape_param() const {
-  return (_has_bits_[1] & 0x00010000u) != 0;
-}
-inline void LayerParameter::set_has_reshape_param() {
-  _has_bits_[1] |= 0x00010000u;
-}
-inline void LayerParameter::clear_has_reshape_param() {
-  _has_bits_[1] &= ~0x00010000u;
-}
-inline void LayerParameter::clear_reshape_param() {
-  if (reshape_param_ != NULL) reshape_param_->::caffe::ReshapeParameter::Clear();
-  clear_has_reshape_param();
-}
-inline const ::caffe::ReshapeParameter& LayerParameter::reshape_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.reshape_param)
-  return reshape_param_ != NULL ? *reshape_param_ : *default_instance_->reshape_param_;
-}
-inline ::caffe::ReshapeParameter* LayerParameter::mutable_reshape_param() {
-  set_has_reshape_param();
-  if (reshape_param_ == NULL) reshape_param_ = new ::caffe::ReshapeParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.reshape_param)
-  return reshape_param_;
-}
-inline ::caffe::ReshapeParameter* LayerParameter::release_reshape_param() {
-  clear_has_reshape_param();
-  ::caffe::ReshapeParameter* temp = reshape_param_;
-  reshape_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_reshape_param(::caffe::ReshapeParameter* reshape_param) {
-  delete reshape_param_;
-  reshape_param_ = reshape_param;
-  if (reshape_param) {
-    set_has_reshape_param();
-  } else {
-    clear_has_reshape_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.reshape_param)
-}
-
-// optional .caffe.ScaleParameter scale_param = 142;
-inline bool LayerParameter::has_scale_param() const {
-  return (_has_bits_[1] & 0x00020000u) != 0;
-}
-inline void LayerParameter::set_has_scale_param() {
-  _has_bits_[1] |= 0x00020000u;
-}
-inline void LayerParameter::clear_has_scale_param() {
-  _has_bits_[1] &= ~0x00020000u;
-}
-inline void LayerParameter::clear_scale_param() {
-  if (scale_param_ != NULL) scale_param_->::caffe::ScaleParameter::Clear();
-  clear_has_scale_param();
-}
-inline const ::caffe::ScaleParameter& LayerParameter::scale_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.scale_param)
-  return scale_param_ != NULL ? *scale_param_ : *default_instance_->scale_param_;
-}
-inline ::caffe::ScaleParameter* LayerParameter::mutable_scale_param() {
-  set_has_scale_param();
-  if (scale_param_ == NULL) scale_param_ = new ::caffe::ScaleParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.scale_param)
-  return scale_param_;
-}
-inline ::caffe::ScaleParameter* LayerParameter::release_scale_param() {
-  clear_has_scale_param();
-  ::caffe::ScaleParameter* temp = scale_param_;
-  scale_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_scale_param(::caffe::ScaleParameter* scale_param) {
-  delete scale_param_;
-  scale_param_ = scale_param;
-  if (scale_param) {
-    set_has_scale_param();
-  } else {
-    clear_has_scale_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.scale_param)
-}
-
-// optional .caffe.SigmoidParameter sigmoid_param = 124;
-inline bool LayerParameter::has_sigmoid_param() const {
-  return (_has_bits_[1] & 0x00040000u) != 0;
-}
-inline void LayerParameter::set_has_sigmoid_param() {
-  _has_bits_[1] |= 0x00040000u;
-}
-inline void LayerParameter::clear_has_sigmoid_param() {
-  _has_bits_[1] &= ~0x00040000u;
-}
-inline void LayerParameter::clear_sigmoid_param() {
-  if (sigmoid_param_ != NULL) sigmoid_param_->::caffe::SigmoidParameter::Clear();
-  clear_has_sigmoid_param();
-}
-inline const ::caffe::SigmoidParameter& LayerParameter::sigmoid_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.sigmoid_param)
-  return sigmoid_param_ != NULL ? *sigmoid_param_ : *default_instance_->sigmoid_param_;
-}
-inline ::caffe::SigmoidParameter* LayerParameter::mutable_sigmoid_param() {
-  set_has_sigmoid_param();
-  if (sigmoid_param_ == NULL) sigmoid_param_ = new ::caffe::SigmoidParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.sigmoid_param)
-  return sigmoid_param_;
-}
-inline ::caffe::SigmoidParameter* LayerParameter::release_sigmoid_param() {
-  clear_has_sigmoid_param();
-  ::caffe::SigmoidParameter* temp = sigmoid_param_;
-  sigmoid_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_sigmoid_param(::caffe::SigmoidParameter* sigmoid_param) {
-  delete sigmoid_param_;
-  sigmoid_param_ = sigmoid_param;
-  if (sigmoid_param) {
-    set_has_sigmoid_param();
-  } else {
-    clear_has_sigmoid_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.sigmoid_param)
-}
-
-// optional .caffe.SoftmaxParameter softmax_param = 125;
-inline bool LayerParameter::has_softmax_param() const {
-  return (_has_bits_[1] & 0x00080000u) != 0;
-}
-inline void LayerParameter::set_has_softmax_param() {
-  _has_bits_[1] |= 0x00080000u;
-}
-inline void LayerParameter::clear_has_softmax_param() {
-  _has_bits_[1] &= ~0x00080000u;
-}
-inline void LayerParameter::clear_softmax_param() {
-  if (softmax_param_ != NULL) softmax_param_->::caffe::SoftmaxParameter::Clear();
-  clear_has_softmax_param();
-}
-inline const ::caffe::SoftmaxParameter& LayerParameter::softmax_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.softmax_param)
-  return softmax_param_ != NULL ? *softmax_param_ : *default_instance_->softmax_param_;
-}
-inline ::caffe::SoftmaxParameter* LayerParameter::mutable_softmax_param() {
-  set_has_softmax_param();
-  if (softmax_param_ == NULL) softmax_param_ = new ::caffe::SoftmaxParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.softmax_param)
-  return softmax_param_;
-}
-inline ::caffe::SoftmaxParameter* LayerParameter::release_softmax_param() {
-  clear_has_softmax_param();
-  ::caffe::SoftmaxParameter* temp = softmax_param_;
-  softmax_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_softmax_param(::caffe::SoftmaxParameter* softmax_param) {
-  delete softmax_param_;
-  softmax_param_ = softmax_param;
-  if (softmax_param) {
-    set_has_softmax_param();
-  } else {
-    clear_has_softmax_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.softmax_param)
-}
-
-// optional .caffe.SPPParameter spp_param = 132;
-inline bool LayerParameter::has_spp_param() const {
-  return (_has_bits_[1] & 0x00100000u) != 0;
-}
-inline void LayerParameter::set_has_spp_param() {
-  _has_bits_[1] |= 0x00100000u;
-}
-inline void LayerParameter::clear_has_spp_param() {
-  _has_bits_[1] &= ~0x00100000u;
-}
-inline void LayerParameter::clear_spp_param() {
-  if (spp_param_ != NULL) spp_param_->::caffe::SPPParameter::Clear();
-  clear_has_spp_param();
-}
-inline const ::caffe::SPPParameter& LayerParameter::spp_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.spp_param)
-  return spp_param_ != NULL ? *spp_param_ : *default_instance_->spp_param_;
-}
-inline ::caffe::SPPParameter* LayerParameter::mutable_spp_param() {
-  set_has_spp_param();
-  if (spp_param_ == NULL) spp_param_ = new ::caffe::SPPParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.spp_param)
-  return spp_param_;
-}
-inline ::caffe::SPPParameter* LayerParameter::release_spp_param() {
-  clear_has_spp_param();
-  ::caffe::SPPParameter* temp = spp_param_;
-  spp_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_spp_param(::caffe::SPPParameter* spp_param) {
-  delete spp_param_;
-  spp_param_ = spp_param;
-  if (spp_param) {
-    set_has_spp_param();
-  } else {
-    clear_has_spp_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.spp_param)
-}
-
-// optional .caffe.SliceParameter slice_param = 126;
-inline bool LayerParameter::has_slice_param() const {
-  return (_has_bits_[1] & 0x00200000u) != 0;
-}
-inline void LayerParameter::set_has_slice_param() {
-  _has_bits_[1] |= 0x00200000u;
-}
-inline void LayerParameter::clear_has_slice_param() {
-  _has_bits_[1] &= ~0x00200000u;
-}
-inline void LayerParameter::clear_slice_param() {
-  if (slice_param_ != NULL) slice_param_->::caffe::SliceParameter::Clear();
-  clear_has_slice_param();
-}
-inline const ::caffe::SliceParameter& LayerParameter::slice_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.slice_param)
-  return slice_param_ != NULL ? *slice_param_ : *default_instance_->slice_param_;
-}
-inline ::caffe::SliceParameter* LayerParameter::mutable_slice_param() {
-  set_has_slice_param();
-  if (slice_param_ == NULL) slice_param_ = new ::caffe::SliceParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.slice_param)
-  return slice_param_;
-}
-inline ::caffe::SliceParameter* LayerParameter::release_slice_param() {
-  clear_has_slice_param();
-  ::caffe::SliceParameter* temp = slice_param_;
-  slice_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_slice_param(::caffe::SliceParameter* slice_param) {
-  delete slice_param_;
-  slice_param_ = slice_param;
-  if (slice_param) {
-    set_has_slice_param();
-  } else {
-    clear_has_slice_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.slice_param)
-}
-
-// optional .caffe.TanHParameter tanh_param = 127;
-inline bool LayerParameter::has_tanh_param() const {
-  return (_has_bits_[1] & 0x00400000u) != 0;
-}
-inline void LayerParameter::set_has_tanh_param() {
-  _has_bits_[1] |= 0x00400000u;
-}
-inline void LayerParameter::clear_has_tanh_param() {
-  _has_bits_[1] &= ~0x00400000u;
-}
-inline void LayerParameter::clear_tanh_param() {
-  if (tanh_param_ != NULL) tanh_param_->::caffe::TanHParameter::Clear();
-  clear_has_tanh_param();
-}
-inline const ::caffe::TanHParameter& LayerParameter::tanh_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.tanh_param)
-  return tanh_param_ != NULL ? *tanh_param_ : *default_instance_->tanh_param_;
-}
-inline ::caffe::TanHParameter* LayerParameter::mutable_tanh_param() {
-  set_has_tanh_param();
-  if (tanh_param_ == NULL) tanh_param_ = new ::caffe::TanHParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.tanh_param)
-  return tanh_param_;
-}
-inline ::caffe::TanHParameter* LayerParameter::release_tanh_param() {
-  clear_has_tanh_param();
-  ::caffe::TanHParameter* temp = tanh_param_;
-  tanh_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_tanh_param(::caffe::TanHParameter* tanh_param) {
-  delete tanh_param_;
-  tanh_param_ = tanh_param;
-  if (tanh_param) {
-    set_has_tanh_param();
-  } else {
-    clear_has_tanh_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.tanh_param)
-}
-
-// optional .caffe.ThresholdParameter threshold_param = 128;
-inline bool LayerParameter::has_threshold_param() const {
-  return (_has_bits_[1] & 0x00800000u) != 0;
-}
-inline void LayerParameter::set_has_threshold_param() {
-  _has_bits_[1] |= 0x00800000u;
-}
-inline void LayerParameter::clear_has_threshold_param() {
-  _has_bits_[1] &= ~0x00800000u;
-}
-inline void LayerParameter::clear_threshold_param() {
-  if (threshold_param_ != NULL) threshold_param_->::caffe::ThresholdParameter::Clear();
-  clear_has_threshold_param();
-}
-inline const ::caffe::ThresholdParameter& LayerParameter::threshold_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.threshold_param)
-  return threshold_param_ != NULL ? *threshold_param_ : *default_instance_->threshold_param_;
-}
-inline ::caffe::ThresholdParameter* LayerParameter::mutable_threshold_param() {
-  set_has_threshold_param();
-  if (threshold_param_ == NULL) threshold_param_ = new ::caffe::ThresholdParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.threshold_param)
-  return threshold_param_;
-}
-inline ::caffe::ThresholdParameter* LayerParameter::release_threshold_param() {
-  clear_has_threshold_param();
-  ::caffe::ThresholdParameter* temp = threshold_param_;
-  threshold_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_threshold_param(::caffe::ThresholdParameter* threshold_param) {
-  delete threshold_param_;
-  threshold_param_ = threshold_param;
-  if (threshold_param) {
-    set_has_threshold_param();
-  } else {
-    clear_has_threshold_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.threshold_param)
-}
-
-// optional .caffe.TileParameter tile_param = 138;
-inline bool LayerParameter::has_tile_param() const {
-  return (_has_bits_[1] & 0x01000000u) != 0;
-}
-inline void LayerParameter::set_has_tile_param() {
-  _has_bits_[1] |= 0x01000000u;
-}
-inline void LayerParameter::clear_has_tile_param() {
-  _has_bits_[1] &= ~0x01000000u;
-}
-inline void LayerParameter::clear_tile_param() {
-  if (tile_param_ != NULL) tile_param_->::caffe::TileParameter::Clear();
-  clear_has_tile_param();
-}
-inline const ::caffe::TileParameter& LayerParameter::tile_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.tile_param)
-  return tile_param_ != NULL ? *tile_param_ : *default_instance_->tile_param_;
-}
-inline ::caffe::TileParameter* LayerParameter::mutable_tile_param() {
-  set_has_tile_param();
-  if (tile_param_ == NULL) tile_param_ = new ::caffe::TileParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.tile_param)
-  return tile_param_;
-}
-inline ::caffe::TileParameter* LayerParameter::release_tile_param() {
-  clear_has_tile_param();
-  ::caffe::TileParameter* temp = tile_param_;
-  tile_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_tile_param(::caffe::TileParameter* tile_param) {
-  delete tile_param_;
-  tile_param_ = tile_param;
-  if (tile_param) {
-    set_has_tile_param();
-  } else {
-    clear_has_tile_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.tile_param)
-}
-
-// optional .caffe.WindowDataParameter window_data_param = 129;
-inline bool LayerParameter::has_window_data_param() const {
-  return (_has_bits_[1] & 0x02000000u) != 0;
-}
-inline void LayerParameter::set_has_window_data_param() {
-  _has_bits_[1] |= 0x02000000u;
-}
-inline void LayerParameter::clear_has_window_data_param() {
-  _has_bits_[1] &= ~0x02000000u;
-}
-inline void LayerParameter::clear_window_data_param() {
-  if (window_data_param_ != NULL) window_data_param_->::caffe::WindowDataParameter::Clear();
-  clear_has_window_data_param();
-}
-inline const ::caffe::WindowDataParameter& LayerParameter::window_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.window_data_param)
-  return window_data_param_ != NULL ? *window_data_param_ : *default_instance_->window_data_param_;
-}
-inline ::caffe::WindowDataParameter* LayerParameter::mutable_window_data_param() {
-  set_has_window_data_param();
-  if (window_data_param_ == NULL) window_data_param_ = new ::caffe::WindowDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.window_data_param)
-  return window_data_param_;
-}
-inline ::caffe::WindowDataParameter* LayerParameter::release_window_data_param() {
-  clear_has_window_data_param();
-  ::caffe::WindowDataParameter* temp = window_data_param_;
-  window_data_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_window_data_param(::caffe::WindowDataParameter* window_data_param) {
-  delete window_data_param_;
-  window_data_param_ = window_data_param;
-  if (window_data_param) {
-    set_has_window_data_param();
-  } else {
-    clear_has_window_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.window_data_param)
-}
-
-// optional .caffe.QuantizationParameter quantization_param = 147;
-inline bool LayerParameter::has_quantization_param() const {
-  return (_has_bits_[1] & 0x04000000u) != 0;
-}
-inline void LayerParameter::set_has_quantization_param() {
-  _has_bits_[1] |= 0x04000000u;
-}
-inline void LayerParameter::clear_has_quantization_param() {
-  _has_bits_[1] &= ~0x04000000u;
-}
-inline void LayerParameter::clear_quantization_param() {
-  if (quantization_param_ != NULL) quantization_param_->::caffe::QuantizationParameter::Clear();
-  clear_has_quantization_param();
-}
-inline const ::caffe::QuantizationParameter& LayerParameter::quantization_param() const {
-  // @@protoc_insertion_point(field_get:caffe.LayerParameter.quantization_param)
-  return quantization_param_ != NULL ? *quantization_param_ : *default_instance_->quantization_param_;
-}
-inline ::caffe::QuantizationParameter* LayerParameter::mutable_quantization_param() {
-  set_has_quantization_param();
-  if (quantization_param_ == NULL) quantization_param_ = new ::caffe::QuantizationParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.quantization_param)
-  return quantization_param_;
-}
-inline ::caffe::QuantizationParameter* LayerParameter::release_quantization_param() {
-  clear_has_quantization_param();
-  ::caffe::QuantizationParameter* temp = quantization_param_;
-  quantization_param_ = NULL;
-  return temp;
-}
-inline void LayerParameter::set_allocated_quantization_param(::caffe::QuantizationParameter* quantization_param) {
-  delete quantization_param_;
-  quantization_param_ = quantization_param;
-  if (quantization_param) {
-    set_has_quantization_param();
-  } else {
-    clear_has_quantization_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.quantization_param)
-}
-
-// -------------------------------------------------------------------
-
-// TransformationParameter
-
-// optional float scale = 1 [default = 1];
-inline bool TransformationParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TransformationParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TransformationParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void TransformationParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float TransformationParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.scale)
-  return scale_;
-}
-inline void TransformationParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.scale)
-}
-
-// optional bool mirror = 2 [default = false];
-inline bool TransformationParameter::has_mirror() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TransformationParameter::set_has_mirror() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TransformationParameter::clear_has_mirror() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void TransformationParameter::clear_mirror() {
-  mirror_ = false;
-  clear_has_mirror();
-}
-inline bool TransformationParameter::mirror() const {
-  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.mirror)
-  return mirror_;
-}
-inline void TransformationParameter::set_mirror(bool value) {
-  set_has_mirror();
-  mirror_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.mirror)
-}
-
-// optional uint32 crop_size = 3 [default = 0];
-inline bool TransformationParameter::has_crop_size() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TransformationParameter::set_has_crop_size() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void TransformationParameter::clear_has_crop_size() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void TransformationParameter::clear_crop_size() {
-  crop_size_ = 0u;
-  clear_has_crop_size();
-}
-inline ::google::protobuf::uint32 TransformationParameter::crop_size() const {
-  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.crop_size)
-  return crop_size_;
-}
-inline void TransformationParameter::set_crop_size(::google::protobuf::uint32 value) {
-  set_has_crop_size();
-  crop_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.crop_size)
-}
-
-// optional string mean_file = 4;
-inline bool TransformationParameter::has_mean_file() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void TransformationParameter::set_has_mean_file() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void TransformationParameter::clear_has_mean_file() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void TransformationParameter::clear_mean_file() {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_->clear();
-  }
-  clear_has_mean_file();
-}
-inline const ::std::string& TransformationParameter::mean_file() const {
-  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.mean_file)
-  return *mean_file_;
-}
-inline void TransformationParameter::set_mean_file(const ::std::string& value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.mean_file)
-}
-inline void TransformationParameter::set_mean_file(const char* value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.TransformationParameter.mean_file)
-}
-inline void TransformationParameter::set_mean_file(const char* value, size_t size) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.TransformationParameter.mean_file)
-}
-inline ::std::string* TransformationParameter::mutable_mean_file() {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.TransformationParameter.mean_file)
-  return mean_file_;
-}
-inline ::std::string* TransformationParameter::release_mean_file() {
-  clear_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = mean_file_;
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void TransformationParameter::set_allocated_mean_file(::std::string* mean_file) {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete mean_file_;
-  }
-  if (mean_file) {
-    set_has_mean_file();
-    mean_file_ = mean_file;
-  } else {
-    clear_has_mean_file();
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.TransformationParameter.mean_file)
-}
-
-// repeated float mean_value = 5;
-inline int TransformationParameter::mean_value_size() const {
-  return mean_value_.size();
-}
-inline void TransformationParameter::clear_mean_value() {
-  mean_value_.Clear();
-}
-inline float TransformationParameter::mean_value(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.mean_value)
-  return mean_value_.Get(index);
-}
-inline void TransformationParameter::set_mean_value(int index, float value) {
-  mean_value_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.mean_value)
-}
-inline void TransformationParameter::add_mean_value(float value) {
-  mean_value_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.TransformationParameter.mean_value)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-TransformationParameter::mean_value() const {
-  // @@protoc_insertion_point(field_list:caffe.TransformationParameter.mean_value)
-  return mean_value_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-TransformationParameter::mutable_mean_value() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.TransformationParameter.mean_value)
-  return &mean_value_;
-}
-
-// optional bool force_color = 6 [default = false];
-inline bool TransformationParameter::has_force_color() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void TransformationParameter::set_has_force_color() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void TransformationParameter::clear_has_force_color() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void TransformationParameter::clear_force_color() {
-  force_color_ = false;
-  clear_has_force_color();
-}
-inline bool TransformationParameter::force_color() const {
-  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.force_color)
-  return force_color_;
-}
-inline void TransformationParameter::set_force_color(bool value) {
-  set_has_force_color();
-  force_color_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.force_color)
-}
-
-// optional bool force_gray = 7 [default = false];
-inline bool TransformationParameter::has_force_gray() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void TransformationParameter::set_has_force_gray() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void TransformationParameter::clear_has_force_gray() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void TransformationParameter::clear_force_gray() {
-  force_gray_ = false;
-  clear_has_force_gray();
-}
-inline bool TransformationParameter::force_gray() const {
-  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.force_gray)
-  return force_gray_;
-}
-inline void TransformationParameter::set_force_gray(bool value) {
-  set_has_force_gray();
-  force_gray_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.force_gray)
-}
-
-// -------------------------------------------------------------------
-
-// LossParameter
-
-// optional int32 ignore_label = 1;
-inline bool LossParameter::has_ignore_label() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LossParameter::set_has_ignore_label() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LossParameter::clear_has_ignore_label() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void LossParameter::clear_ignore_label() {
-  ignore_label_ = 0;
-  clear_has_ignore_label();
-}
-inline ::google::protobuf::int32 LossParameter::ignore_label() const {
-  // @@protoc_insertion_point(field_get:caffe.LossParameter.ignore_label)
-  return ignore_label_;
-}
-inline void LossParameter::set_ignore_label(::google::protobuf::int32 value) {
-  set_has_ignore_label();
-  ignore_label_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LossParameter.ignore_label)
-}
-
-// optional .caffe.LossParameter.NormalizationMode normalization = 3 [default = VALID];
-inline bool LossParameter::has_normalization() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void LossParameter::set_has_normalization() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void LossParameter::clear_has_normalization() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void LossParameter::clear_normalization() {
-  normalization_ = 1;
-  clear_has_normalization();
-}
-inline ::caffe::LossParameter_NormalizationMode LossParameter::normalization() const {
-  // @@protoc_insertion_point(field_get:caffe.LossParameter.normalization)
-  return static_cast< ::caffe::LossParameter_NormalizationMode >(normalization_);
-}
-inline void LossParameter::set_normalization(::caffe::LossParameter_NormalizationMode value) {
-  assert(::caffe::LossParameter_NormalizationMode_IsValid(value));
-  set_has_normalization();
-  normalization_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LossParameter.normalization)
-}
-
-// optional bool normalize = 2;
-inline bool LossParameter::has_normalize() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void LossParameter::set_has_normalize() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void LossParameter::clear_has_normalize() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void LossParameter::clear_normalize() {
-  normalize_ = false;
-  clear_has_normalize();
-}
-inline bool LossParameter::normalize() const {
-  // @@protoc_insertion_point(field_get:caffe.LossParameter.normalize)
-  return normalize_;
-}
-inline void LossParameter::set_normalize(bool value) {
-  set_has_normalize();
-  normalize_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LossParameter.normalize)
-}
-
-// -------------------------------------------------------------------
-
-// AccuracyParameter
-
-// optional uint32 top_k = 1 [default = 1];
-inline bool AccuracyParameter::has_top_k() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void AccuracyParameter::set_has_top_k() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void AccuracyParameter::clear_has_top_k() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void AccuracyParameter::clear_top_k() {
-  top_k_ = 1u;
-  clear_has_top_k();
-}
-inline ::google::protobuf::uint32 AccuracyParameter::top_k() const {
-  // @@protoc_insertion_point(field_get:caffe.AccuracyParameter.top_k)
-  return top_k_;
-}
-inline void AccuracyParameter::set_top_k(::google::protobuf::uint32 value) {
-  set_has_top_k();
-  top_k_ = value;
-  // @@protoc_insertion_point(field_set:caffe.AccuracyParameter.top_k)
-}
-
-// optional int32 axis = 2 [default = 1];
-inline bool AccuracyParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void AccuracyParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void AccuracyParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void AccuracyParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 AccuracyParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.AccuracyParameter.axis)
-  return axis_;
-}
-inline void AccuracyParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.AccuracyParameter.axis)
-}
-
-// optional int32 ignore_label = 3;
-inline bool AccuracyParameter::has_ignore_label() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void AccuracyParameter::set_has_ignore_label() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void AccuracyParameter::clear_has_ignore_label() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void AccuracyParameter::clear_ignore_label() {
-  ignore_label_ = 0;
-  clear_has_ignore_label();
-}
-inline ::google::protobuf::int32 AccuracyParameter::ignore_label() const {
-  // @@protoc_insertion_point(field_get:caffe.AccuracyParameter.ignore_label)
-  return ignore_label_;
-}
-inline void AccuracyParameter::set_ignore_label(::google::protobuf::int32 value) {
-  set_has_ignore_label();
-  ignore_label_ = value;
-  // @@protoc_insertion_point(field_set:caffe.AccuracyParameter.ignore_label)
-}
-
-// -------------------------------------------------------------------
-
-// ArgMaxParameter
-
-// optional bool out_max_val = 1 [default = false];
-inline bool ArgMaxParameter::has_out_max_val() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ArgMaxParameter::set_has_out_max_val() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ArgMaxParameter::clear_has_out_max_val() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ArgMaxParameter::clear_out_max_val() {
-  out_max_val_ = false;
-  clear_has_out_max_val();
-}
-inline bool ArgMaxParameter::out_max_val() const {
-  // @@protoc_insertion_point(field_get:caffe.ArgMaxParameter.out_max_val)
-  return out_max_val_;
-}
-inline void ArgMaxParameter::set_out_max_val(bool value) {
-  set_has_out_max_val();
-  out_max_val_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ArgMaxParameter.out_max_val)
-}
-
-// optional uint32 top_k = 2 [default = 1];
-inline bool ArgMaxParameter::has_top_k() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ArgMaxParameter::set_has_top_k() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ArgMaxParameter::clear_has_top_k() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ArgMaxParameter::clear_top_k() {
-  top_k_ = 1u;
-  clear_has_top_k();
-}
-inline ::google::protobuf::uint32 ArgMaxParameter::top_k() const {
-  // @@protoc_insertion_point(field_get:caffe.ArgMaxParameter.top_k)
-  return top_k_;
-}
-inline void ArgMaxParameter::set_top_k(::google::protobuf::uint32 value) {
-  set_has_top_k();
-  top_k_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ArgMaxParameter.top_k)
-}
-
-// optional int32 axis = 3;
-inline bool ArgMaxParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ArgMaxParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ArgMaxParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ArgMaxParameter::clear_axis() {
-  axis_ = 0;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 ArgMaxParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.ArgMaxParameter.axis)
-  return axis_;
-}
-inline void ArgMaxParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ArgMaxParameter.axis)
-}
-
-// -------------------------------------------------------------------
-
-// ConcatParameter
-
-// optional int32 axis = 2 [default = 1];
-inline bool ConcatParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ConcatParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ConcatParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ConcatParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 ConcatParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.ConcatParameter.axis)
-  return axis_;
-}
-inline void ConcatParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConcatParameter.axis)
-}
-
-// optional uint32 concat_dim = 1 [default = 1];
-inline bool ConcatParameter::has_concat_dim() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ConcatParameter::set_has_concat_dim() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ConcatParameter::clear_has_concat_dim() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ConcatParameter::clear_concat_dim() {
-  concat_dim_ = 1u;
-  clear_has_concat_dim();
-}
-inline ::google::protobuf::uint32 ConcatParameter::concat_dim() const {
-  // @@protoc_insertion_point(field_get:caffe.ConcatParameter.concat_dim)
-  return concat_dim_;
-}
-inline void ConcatParameter::set_concat_dim(::google::protobuf::uint32 value) {
-  set_has_concat_dim();
-  concat_dim_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConcatParameter.concat_dim)
-}
-
-// -------------------------------------------------------------------
-
-// BatchNormParameter
-
-// optional bool use_global_stats = 1;
-inline bool BatchNormParameter::has_use_global_stats() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void BatchNormParameter::set_has_use_global_stats() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void BatchNormParameter::clear_has_use_global_stats() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void BatchNormParameter::clear_use_global_stats() {
-  use_global_stats_ = false;
-  clear_has_use_global_stats();
-}
-inline bool BatchNormParameter::use_global_stats() const {
-  // @@protoc_insertion_point(field_get:caffe.BatchNormParameter.use_global_stats)
-  return use_global_stats_;
-}
-inline void BatchNormParameter::set_use_global_stats(bool value) {
-  set_has_use_global_stats();
-  use_global_stats_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BatchNormParameter.use_global_stats)
-}
-
-// optional float moving_average_fraction = 2 [default = 0.999];
-inline bool BatchNormParameter::has_moving_average_fraction() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void BatchNormParameter::set_has_moving_average_fraction() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void BatchNormParameter::clear_has_moving_average_fraction() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void BatchNormParameter::clear_moving_average_fraction() {
-  moving_average_fraction_ = 0.999f;
-  clear_has_moving_average_fraction();
-}
-inline float BatchNormParameter::moving_average_fraction() const {
-  // @@protoc_insertion_point(field_get:caffe.BatchNormParameter.moving_average_fraction)
-  return moving_average_fraction_;
-}
-inline void BatchNormParameter::set_moving_average_fraction(float value) {
-  set_has_moving_average_fraction();
-  moving_average_fraction_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BatchNormParameter.moving_average_fraction)
-}
-
-// optional float eps = 3 [default = 1e-05];
-inline bool BatchNormParameter::has_eps() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void BatchNormParameter::set_has_eps() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void BatchNormParameter::clear_has_eps() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void BatchNormParameter::clear_eps() {
-  eps_ = 1e-05f;
-  clear_has_eps();
-}
-inline float BatchNormParameter::eps() const {
-  // @@protoc_insertion_point(field_get:caffe.BatchNormParameter.eps)
-  return eps_;
-}
-inline void BatchNormParameter::set_eps(float value) {
-  set_has_eps();
-  eps_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BatchNormParameter.eps)
-}
-
-// -------------------------------------------------------------------
-
-// BiasParameter
-
-// optional int32 axis = 1 [default = 1];
-inline bool BiasParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void BiasParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void BiasParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void BiasParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 BiasParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.BiasParameter.axis)
-  return axis_;
-}
-inline void BiasParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BiasParameter.axis)
-}
-
-// optional int32 num_axes = 2 [default = 1];
-inline bool BiasParameter::has_num_axes() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void BiasParameter::set_has_num_axes() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void BiasParameter::clear_has_num_axes() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void BiasParameter::clear_num_axes() {
-  num_axes_ = 1;
-  clear_has_num_axes();
-}
-inline ::google::protobuf::int32 BiasParameter::num_axes() const {
-  // @@protoc_insertion_point(field_get:caffe.BiasParameter.num_axes)
-  return num_axes_;
-}
-inline void BiasParameter::set_num_axes(::google::protobuf::int32 value) {
-  set_has_num_axes();
-  num_axes_ = value;
-  // @@protoc_insertion_point(field_set:caffe.BiasParameter.num_axes)
-}
-
-// optional .caffe.FillerParameter filler = 3;
-inline bool BiasParameter::has_filler() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void BiasParameter::set_has_filler() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void BiasParameter::clear_has_filler() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void BiasParameter::clear_filler() {
-  if (filler_ != NULL) filler_->::caffe::FillerParameter::Clear();
-  clear_has_filler();
-}
-inline const ::caffe::FillerParameter& BiasParameter::filler() const {
-  // @@protoc_insertion_point(field_get:caffe.BiasParameter.filler)
-  return filler_ != NULL ? *filler_ : *default_instance_->filler_;
-}
-inline ::caffe::FillerParameter* BiasParameter::mutable_filler() {
-  set_has_filler();
-  if (filler_ == NULL) filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.BiasParameter.filler)
-  return filler_;
-}
-inline ::caffe::FillerParameter* BiasParameter::release_filler() {
-  clear_has_filler();
-  ::caffe::FillerParameter* temp = filler_;
-  filler_ = NULL;
-  return temp;
-}
-inline void BiasParameter::set_allocated_filler(::caffe::FillerParameter* filler) {
-  delete filler_;
-  filler_ = filler;
-  if (filler) {
-    set_has_filler();
-  } else {
-    clear_has_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.BiasParameter.filler)
-}
-
-// -------------------------------------------------------------------
-
-// ContrastiveLossParameter
-
-// optional float margin = 1 [default = 1];
-inline bool ContrastiveLossParameter::has_margin() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ContrastiveLossParameter::set_has_margin() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ContrastiveLossParameter::clear_has_margin() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ContrastiveLossParameter::clear_margin() {
-  margin_ = 1;
-  clear_has_margin();
-}
-inline float ContrastiveLossParameter::margin() const {
-  // @@protoc_insertion_point(field_get:caffe.ContrastiveLossParameter.margin)
-  return margin_;
-}
-inline void ContrastiveLossParameter::set_margin(float value) {
-  set_has_margin();
-  margin_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ContrastiveLossParameter.margin)
-}
-
-// optional bool legacy_version = 2 [default = false];
-inline bool ContrastiveLossParameter::has_legacy_version() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ContrastiveLossParameter::set_has_legacy_version() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ContrastiveLossParameter::clear_has_legacy_version() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ContrastiveLossParameter::clear_legacy_version() {
-  legacy_version_ = false;
-  clear_has_legacy_version();
-}
-inline bool ContrastiveLossParameter::legacy_version() const {
-  // @@protoc_insertion_point(field_get:caffe.ContrastiveLossParameter.legacy_version)
-  return legacy_version_;
-}
-inline void ContrastiveLossParameter::set_legacy_version(bool value) {
-  set_has_legacy_version();
-  legacy_version_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ContrastiveLossParameter.legacy_version)
-}
-
-// -------------------------------------------------------------------
-
-// ConvolutionParameter
-
-// optional uint32 num_output = 1;
-inline bool ConvolutionParameter::has_num_output() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ConvolutionParameter::set_has_num_output() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ConvolutionParameter::clear_has_num_output() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ConvolutionParameter::clear_num_output() {
-  num_output_ = 0u;
-  clear_has_num_output();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::num_output() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.num_output)
-  return num_output_;
-}
-inline void ConvolutionParameter::set_num_output(::google::protobuf::uint32 value) {
-  set_has_num_output();
-  num_output_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.num_output)
-}
-
-// optional bool bias_term = 2 [default = true];
-inline bool ConvolutionParameter::has_bias_term() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ConvolutionParameter::set_has_bias_term() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ConvolutionParameter::clear_has_bias_term() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ConvolutionParameter::clear_bias_term() {
-  bias_term_ = true;
-  clear_has_bias_term();
-}
-inline bool ConvolutionParameter::bias_term() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.bias_term)
-  return bias_term_;
-}
-inline void ConvolutionParameter::set_bias_term(bool value) {
-  set_has_bias_term();
-  bias_term_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.bias_term)
-}
-
-// repeated uint32 pad = 3;
-inline int ConvolutionParameter::pad_size() const {
-  return pad_.size();
-}
-inline void ConvolutionParameter::clear_pad() {
-  pad_.Clear();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::pad(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.pad)
-  return pad_.Get(index);
-}
-inline void ConvolutionParameter::set_pad(int index, ::google::protobuf::uint32 value) {
-  pad_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.pad)
-}
-inline void ConvolutionParameter::add_pad(::google::protobuf::uint32 value) {
-  pad_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.ConvolutionParameter.pad)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-ConvolutionParameter::pad() const {
-  // @@protoc_insertion_point(field_list:caffe.ConvolutionParameter.pad)
-  return pad_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-ConvolutionParameter::mutable_pad() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.ConvolutionParameter.pad)
-  return &pad_;
-}
-
-// repeated uint32 kernel_size = 4;
-inline int ConvolutionParameter::kernel_size_size() const {
-  return kernel_size_.size();
-}
-inline void ConvolutionParameter::clear_kernel_size() {
-  kernel_size_.Clear();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::kernel_size(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.kernel_size)
-  return kernel_size_.Get(index);
-}
-inline void ConvolutionParameter::set_kernel_size(int index, ::google::protobuf::uint32 value) {
-  kernel_size_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.kernel_size)
-}
-inline void ConvolutionParameter::add_kernel_size(::google::protobuf::uint32 value) {
-  kernel_size_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.ConvolutionParameter.kernel_size)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-ConvolutionParameter::kernel_size() const {
-  // @@protoc_insertion_point(field_list:caffe.ConvolutionParameter.kernel_size)
-  return kernel_size_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-ConvolutionParameter::mutable_kernel_size() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.ConvolutionParameter.kernel_size)
-  return &kernel_size_;
-}
-
-// repeated uint32 stride = 6;
-inline int ConvolutionParameter::stride_size() const {
-  return stride_.size();
-}
-inline void ConvolutionParameter::clear_stride() {
-  stride_.Clear();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::stride(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.stride)
-  return stride_.Get(index);
-}
-inline void ConvolutionParameter::set_stride(int index, ::google::protobuf::uint32 value) {
-  stride_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.stride)
-}
-inline void ConvolutionParameter::add_stride(::google::protobuf::uint32 value) {
-  stride_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.ConvolutionParameter.stride)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-ConvolutionParameter::stride() const {
-  // @@protoc_insertion_point(field_list:caffe.ConvolutionParameter.stride)
-  return stride_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-ConvolutionParameter::mutable_stride() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.ConvolutionParameter.stride)
-  return &stride_;
-}
-
-// repeated uint32 dilation = 18;
-inline int ConvolutionParameter::dilation_size() const {
-  return dilation_.size();
-}
-inline void ConvolutionParameter::clear_dilation() {
-  dilation_.Clear();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::dilation(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.dilation)
-  return dilation_.Get(index);
-}
-inline void ConvolutionParameter::set_dilation(int index, ::google::protobuf::uint32 value) {
-  dilation_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.dilation)
-}
-inline void ConvolutionParameter::add_dilation(::google::protobuf::uint32 value) {
-  dilation_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.ConvolutionParameter.dilation)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-ConvolutionParameter::dilation() const {
-  // @@protoc_insertion_point(field_list:caffe.ConvolutionParameter.dilation)
-  return dilation_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-ConvolutionParameter::mutable_dilation() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.ConvolutionParameter.dilation)
-  return &dilation_;
-}
-
-// optional uint32 pad_h = 9 [default = 0];
-inline bool ConvolutionParameter::has_pad_h() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void ConvolutionParameter::set_has_pad_h() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void ConvolutionParameter::clear_has_pad_h() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void ConvolutionParameter::clear_pad_h() {
-  pad_h_ = 0u;
-  clear_has_pad_h();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::pad_h() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.pad_h)
-  return pad_h_;
-}
-inline void ConvolutionParameter::set_pad_h(::google::protobuf::uint32 value) {
-  set_has_pad_h();
-  pad_h_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.pad_h)
-}
-
-// optional uint32 pad_w = 10 [default = 0];
-inline bool ConvolutionParameter::has_pad_w() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void ConvolutionParameter::set_has_pad_w() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void ConvolutionParameter::clear_has_pad_w() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void ConvolutionParameter::clear_pad_w() {
-  pad_w_ = 0u;
-  clear_has_pad_w();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::pad_w() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.pad_w)
-  return pad_w_;
-}
-inline void ConvolutionParameter::set_pad_w(::google::protobuf::uint32 value) {
-  set_has_pad_w();
-  pad_w_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.pad_w)
-}
-
-// optional uint32 kernel_h = 11;
-inline bool ConvolutionParameter::has_kernel_h() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void ConvolutionParameter::set_has_kernel_h() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void ConvolutionParameter::clear_has_kernel_h() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline void ConvolutionParameter::clear_kernel_h() {
-  kernel_h_ = 0u;
-  clear_has_kernel_h();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::kernel_h() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.kernel_h)
-  return kernel_h_;
-}
-inline void ConvolutionParameter::set_kernel_h(::google::protobuf::uint32 value) {
-  set_has_kernel_h();
-  kernel_h_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.kernel_h)
-}
-
-// optional uint32 kernel_w = 12;
-inline bool ConvolutionParameter::has_kernel_w() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void ConvolutionParameter::set_has_kernel_w() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void ConvolutionParameter::clear_has_kernel_w() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-inline void ConvolutionParameter::clear_kernel_w() {
-  kernel_w_ = 0u;
-  clear_has_kernel_w();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::kernel_w() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.kernel_w)
-  return kernel_w_;
-}
-inline void ConvolutionParameter::set_kernel_w(::google::protobuf::uint32 value) {
-  set_has_kernel_w();
-  kernel_w_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.kernel_w)
-}
-
-// optional uint32 stride_h = 13;
-inline bool ConvolutionParameter::has_stride_h() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void ConvolutionParameter::set_has_stride_h() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void ConvolutionParameter::clear_has_stride_h() {
-  _has_bits_[0] &= ~0x00000400u;
-}
-inline void ConvolutionParameter::clear_stride_h() {
-  stride_h_ = 0u;
-  clear_has_stride_h();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::stride_h() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.stride_h)
-  return stride_h_;
-}
-inline void ConvolutionParameter::set_stride_h(::google::protobuf::uint32 value) {
-  set_has_stride_h();
-  stride_h_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.stride_h)
-}
-
-// optional uint32 stride_w = 14;
-inline bool ConvolutionParameter::has_stride_w() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void ConvolutionParameter::set_has_stride_w() {
-  _has_bits_[0] |= 0x00000800u;
-}
-inline void ConvolutionParameter::clear_has_stride_w() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-inline void ConvolutionParameter::clear_stride_w() {
-  stride_w_ = 0u;
-  clear_has_stride_w();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::stride_w() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.stride_w)
-  return stride_w_;
-}
-inline void ConvolutionParameter::set_stride_w(::google::protobuf::uint32 value) {
-  set_has_stride_w();
-  stride_w_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.stride_w)
-}
-
-// optional uint32 group = 5 [default = 1];
-inline bool ConvolutionParameter::has_group() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-inline void ConvolutionParameter::set_has_group() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void ConvolutionParameter::clear_has_group() {
-  _has_bits_[0] &= ~0x00001000u;
-}
-inline void ConvolutionParameter::clear_group() {
-  group_ = 1u;
-  clear_has_group();
-}
-inline ::google::protobuf::uint32 ConvolutionParameter::group() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.group)
-  return group_;
-}
-inline void ConvolutionParameter::set_group(::google::protobuf::uint32 value) {
-  set_has_group();
-  group_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.group)
-}
-
-// optional .caffe.FillerParameter weight_filler = 7;
-inline bool ConvolutionParameter::has_weight_filler() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void ConvolutionParameter::set_has_weight_filler() {
-  _has_bits_[0] |= 0x00002000u;
-}
-inline void ConvolutionParameter::clear_has_weight_filler() {
-  _has_bits_[0] &= ~0x00002000u;
-}
-inline void ConvolutionParameter::clear_weight_filler() {
-  if (weight_filler_ != NULL) weight_filler_->::caffe::FillerParameter::Clear();
-  clear_has_weight_filler();
-}
-inline const ::caffe::FillerParameter& ConvolutionParameter::weight_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.weight_filler)
-  return weight_filler_ != NULL ? *weight_filler_ : *default_instance_->weight_filler_;
-}
-inline ::caffe::FillerParameter* ConvolutionParameter::mutable_weight_filler() {
-  set_has_weight_filler();
-  if (weight_filler_ == NULL) weight_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.ConvolutionParameter.weight_filler)
-  return weight_filler_;
-}
-inline ::caffe::FillerParameter* ConvolutionParameter::release_weight_filler() {
-  clear_has_weight_filler();
-  ::caffe::FillerParameter* temp = weight_filler_;
-  weight_filler_ = NULL;
-  return temp;
-}
-inline void ConvolutionParameter::set_allocated_weight_filler(::caffe::FillerParameter* weight_filler) {
-  delete weight_filler_;
-  weight_filler_ = weight_filler;
-  if (weight_filler) {
-    set_has_weight_filler();
-  } else {
-    clear_has_weight_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ConvolutionParameter.weight_filler)
-}
-
-// optional .caffe.FillerParameter bias_filler = 8;
-inline bool ConvolutionParameter::has_bias_filler() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
-}
-inline void ConvolutionParameter::set_has_bias_filler() {
-  _has_bits_[0] |= 0x00004000u;
-}
-inline void ConvolutionParameter::clear_has_bias_filler() {
-  _has_bits_[0] &= ~0x00004000u;
-}
-inline void ConvolutionParameter::clear_bias_filler() {
-  if (bias_filler_ != NULL) bias_filler_->::caffe::FillerParameter::Clear();
-  clear_has_bias_filler();
-}
-inline const ::caffe::FillerParameter& ConvolutionParameter::bias_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.bias_filler)
-  return bias_filler_ != NULL ? *bias_filler_ : *default_instance_->bias_filler_;
-}
-inline ::caffe::FillerParameter* ConvolutionParameter::mutable_bias_filler() {
-  set_has_bias_filler();
-  if (bias_filler_ == NULL) bias_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.ConvolutionParameter.bias_filler)
-  return bias_filler_;
-}
-inline ::caffe::FillerParameter* ConvolutionParameter::release_bias_filler() {
-  clear_has_bias_filler();
-  ::caffe::FillerParameter* temp = bias_filler_;
-  bias_filler_ = NULL;
-  return temp;
-}
-inline void ConvolutionParameter::set_allocated_bias_filler(::caffe::FillerParameter* bias_filler) {
-  delete bias_filler_;
-  bias_filler_ = bias_filler;
-  if (bias_filler) {
-    set_has_bias_filler();
-  } else {
-    clear_has_bias_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ConvolutionParameter.bias_filler)
-}
-
-// optional .caffe.ConvolutionParameter.Engine engine = 15 [default = DEFAULT];
-inline bool ConvolutionParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-inline void ConvolutionParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00008000u;
-}
-inline void ConvolutionParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00008000u;
-}
-inline void ConvolutionParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::ConvolutionParameter_Engine ConvolutionParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.engine)
-  return static_cast< ::caffe::ConvolutionParameter_Engine >(engine_);
-}
-inline void ConvolutionParameter::set_engine(::caffe::ConvolutionParameter_Engine value) {
-  assert(::caffe::ConvolutionParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.engine)
-}
-
-// optional int32 axis = 16 [default = 1];
-inline bool ConvolutionParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
-}
-inline void ConvolutionParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00010000u;
-}
-inline void ConvolutionParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00010000u;
-}
-inline void ConvolutionParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 ConvolutionParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.axis)
-  return axis_;
-}
-inline void ConvolutionParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.axis)
-}
-
-// optional bool force_nd_im2col = 17 [default = false];
-inline bool ConvolutionParameter::has_force_nd_im2col() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
-}
-inline void ConvolutionParameter::set_has_force_nd_im2col() {
-  _has_bits_[0] |= 0x00020000u;
-}
-inline void ConvolutionParameter::clear_has_force_nd_im2col() {
-  _has_bits_[0] &= ~0x00020000u;
-}
-inline void ConvolutionParameter::clear_force_nd_im2col() {
-  force_nd_im2col_ = false;
-  clear_has_force_nd_im2col();
-}
-inline bool ConvolutionParameter::force_nd_im2col() const {
-  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.force_nd_im2col)
-  return force_nd_im2col_;
-}
-inline void ConvolutionParameter::set_force_nd_im2col(bool value) {
-  set_has_force_nd_im2col();
-  force_nd_im2col_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.force_nd_im2col)
-}
-
-// -------------------------------------------------------------------
-
-// CropParameter
-
-// optional int32 axis = 1 [default = 2];
-inline bool CropParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CropParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void CropParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void CropParameter::clear_axis() {
-  axis_ = 2;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 CropParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.CropParameter.axis)
-  return axis_;
-}
-inline void CropParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.CropParameter.axis)
-}
-
-// repeated uint32 offset = 2;
-inline int CropParameter::offset_size() const {
-  return offset_.size();
-}
-inline void CropParameter::clear_offset() {
-  offset_.Clear();
-}
-inline ::google::protobuf::uint32 CropParameter::offset(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.CropParameter.offset)
-  return offset_.Get(index);
-}
-inline void CropParameter::set_offset(int index, ::google::protobuf::uint32 value) {
-  offset_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.CropParameter.offset)
-}
-inline void CropParameter::add_offset(::google::protobuf::uint32 value) {
-  offset_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.CropParameter.offset)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-CropParameter::offset() const {
-  // @@protoc_insertion_point(field_list:caffe.CropParameter.offset)
-  return offset_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-CropParameter::mutable_offset() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.CropParameter.offset)
-  return &offset_;
-}
-
-// -------------------------------------------------------------------
-
-// DataParameter
-
-// optional string source = 1;
-inline bool DataParameter::has_source() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void DataParameter::set_has_source() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void DataParameter::clear_has_source() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void DataParameter::clear_source() {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_->clear();
-  }
-  clear_has_source();
-}
-inline const ::std::string& DataParameter::source() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.source)
-  return *source_;
-}
-inline void DataParameter::set_source(const ::std::string& value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.source)
-}
-inline void DataParameter::set_source(const char* value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.DataParameter.source)
-}
-inline void DataParameter::set_source(const char* value, size_t size) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.DataParameter.source)
-}
-inline ::std::string* DataParameter::mutable_source() {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.DataParameter.source)
-  return source_;
-}
-inline ::std::string* DataParameter::release_source() {
-  clear_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = source_;
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void DataParameter::set_allocated_source(::std::string* source) {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete source_;
-  }
-  if (source) {
-    set_has_source();
-    source_ = source;
-  } else {
-    clear_has_source();
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.DataParameter.source)
-}
-
-// optional uint32 batch_size = 4;
-inline bool DataParameter::has_batch_size() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void DataParameter::set_has_batch_size() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void DataParameter::clear_has_batch_size() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void DataParameter::clear_batch_size() {
-  batch_size_ = 0u;
-  clear_has_batch_size();
-}
-inline ::google::protobuf::uint32 DataParameter::batch_size() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.batch_size)
-  return batch_size_;
-}
-inline void DataParameter::set_batch_size(::google::protobuf::uint32 value) {
-  set_has_batch_size();
-  batch_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.batch_size)
-}
-
-// optional uint32 rand_skip = 7 [default = 0];
-inline bool DataParameter::has_rand_skip() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void DataParameter::set_has_rand_skip() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void DataParameter::clear_has_rand_skip() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void DataParameter::clear_rand_skip() {
-  rand_skip_ = 0u;
-  clear_has_rand_skip();
-}
-inline ::google::protobuf::uint32 DataParameter::rand_skip() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.rand_skip)
-  return rand_skip_;
-}
-inline void DataParameter::set_rand_skip(::google::protobuf::uint32 value) {
-  set_has_rand_skip();
-  rand_skip_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.rand_skip)
-}
-
-// optional .caffe.DataParameter.DB backend = 8 [default = LEVELDB];
-inline bool DataParameter::has_backend() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void DataParameter::set_has_backend() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void DataParameter::clear_has_backend() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void DataParameter::clear_backend() {
-  backend_ = 0;
-  clear_has_backend();
-}
-inline ::caffe::DataParameter_DB DataParameter::backend() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.backend)
-  return static_cast< ::caffe::DataParameter_DB >(backend_);
-}
-inline void DataParameter::set_backend(::caffe::DataParameter_DB value) {
-  assert(::caffe::DataParameter_DB_IsValid(value));
-  set_has_backend();
-  backend_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.backend)
-}
-
-// optional float scale = 2 [default = 1];
-inline bool DataParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void DataParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void DataParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void DataParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float DataParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.scale)
-  return scale_;
-}
-inline void DataParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.scale)
-}
-
-// optional string mean_file = 3;
-inline bool DataParameter::has_mean_file() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void DataParameter::set_has_mean_file() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void DataParameter::clear_has_mean_file() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void DataParameter::clear_mean_file() {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_->clear();
-  }
-  clear_has_mean_file();
-}
-inline const ::std::string& DataParameter::mean_file() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.mean_file)
-  return *mean_file_;
-}
-inline void DataParameter::set_mean_file(const ::std::string& value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.mean_file)
-}
-inline void DataParameter::set_mean_file(const char* value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.DataParameter.mean_file)
-}
-inline void DataParameter::set_mean_file(const char* value, size_t size) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.DataParameter.mean_file)
-}
-inline ::std::string* DataParameter::mutable_mean_file() {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.DataParameter.mean_file)
-  return mean_file_;
-}
-inline ::std::string* DataParameter::release_mean_file() {
-  clear_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = mean_file_;
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void DataParameter::set_allocated_mean_file(::std::string* mean_file) {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete mean_file_;
-  }
-  if (mean_file) {
-    set_has_mean_file();
-    mean_file_ = mean_file;
-  } else {
-    clear_has_mean_file();
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.DataParameter.mean_file)
-}
-
-// optional uint32 crop_size = 5 [default = 0];
-inline bool DataParameter::has_crop_size() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void DataParameter::set_has_crop_size() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void DataParameter::clear_has_crop_size() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void DataParameter::clear_crop_size() {
-  crop_size_ = 0u;
-  clear_has_crop_size();
-}
-inline ::google::protobuf::uint32 DataParameter::crop_size() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.crop_size)
-  return crop_size_;
-}
-inline void DataParameter::set_crop_size(::google::protobuf::uint32 value) {
-  set_has_crop_size();
-  crop_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.crop_size)
-}
-
-// optional bool mirror = 6 [default = false];
-inline bool DataParameter::has_mirror() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void DataParameter::set_has_mirror() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void DataParameter::clear_has_mirror() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void DataParameter::clear_mirror() {
-  mirror_ = false;
-  clear_has_mirror();
-}
-inline bool DataParameter::mirror() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.mirror)
-  return mirror_;
-}
-inline void DataParameter::set_mirror(bool value) {
-  set_has_mirror();
-  mirror_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.mirror)
-}
-
-// optional bool force_encoded_color = 9 [default = false];
-inline bool DataParameter::has_force_encoded_color() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void DataParameter::set_has_force_encoded_color() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void DataParameter::clear_has_force_encoded_color() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline void DataParameter::clear_force_encoded_color() {
-  force_encoded_color_ = false;
-  clear_has_force_encoded_color();
-}
-inline bool DataParameter::force_encoded_color() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.force_encoded_color)
-  return force_encoded_color_;
-}
-inline void DataParameter::set_force_encoded_color(bool value) {
-  set_has_force_encoded_color();
-  force_encoded_color_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.force_encoded_color)
-}
-
-// optional uint32 prefetch = 10 [default = 4];
-inline bool DataParameter::has_prefetch() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void DataParameter::set_has_prefetch() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void DataParameter::clear_has_prefetch() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-inline void DataParameter::clear_prefetch() {
-  prefetch_ = 4u;
-  clear_has_prefetch();
-}
-inline ::google::protobuf::uint32 DataParameter::prefetch() const {
-  // @@protoc_insertion_point(field_get:caffe.DataParameter.prefetch)
-  return prefetch_;
-}
-inline void DataParameter::set_prefetch(::google::protobuf::uint32 value) {
-  set_has_prefetch();
-  prefetch_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DataParameter.prefetch)
-}
-
-// -------------------------------------------------------------------
-
-// DropoutParameter
-
-// optional float dropout_ratio = 1 [default = 0.5];
-inline bool DropoutParameter::has_dropout_ratio() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void DropoutParameter::set_has_dropout_ratio() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void DropoutParameter::clear_has_dropout_ratio() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void DropoutParameter::clear_dropout_ratio() {
-  dropout_ratio_ = 0.5f;
-  clear_has_dropout_ratio();
-}
-inline float DropoutParameter::dropout_ratio() const {
-  // @@protoc_insertion_point(field_get:caffe.DropoutParameter.dropout_ratio)
-  return dropout_ratio_;
-}
-inline void DropoutParameter::set_dropout_ratio(float value) {
-  set_has_dropout_ratio();
-  dropout_ratio_ = value;
-  // @@protoc_insertion_point(field_set:caffe.DropoutParameter.dropout_ratio)
-}
-
-// -------------------------------------------------------------------
-
-// DummyDataParameter
-
-// repeated .caffe.FillerParameter data_filler = 1;
-inline int DummyDataParameter::data_filler_size() const {
-  return data_filler_.size();
-}
-inline void DummyDataParameter::clear_data_filler() {
-  data_filler_.Clear();
-}
-inline const ::caffe::FillerParameter& DummyDataParameter::data_filler(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.DummyDataParameter.data_filler)
-  return data_filler_.Get(index);
-}
-inline ::caffe::FillerParameter* DummyDataParameter::mutable_data_filler(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.DummyDataParameter.data_filler)
-  return data_filler_.Mutable(index);
-}
-inline ::caffe::FillerParameter* DummyDataParameter::add_data_filler() {
-  // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.data_filler)
-  return data_filler_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >&
-DummyDataParameter::data_filler() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.data_filler)
-  return data_filler_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >*
-DummyDataParameter::mutable_data_filler() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.data_filler)
-  return &data_filler_;
-}
-
-// repeated .caffe.BlobShape shape = 6;
-inline int DummyDataParameter::shape_size() const {
-  return shape_.size();
-}
-inline void DummyDataParameter::clear_shape() {
-  shape_.Clear();
-}
-inline const ::caffe::BlobShape& DummyDataParameter::shape(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.DummyDataParameter.shape)
-  return shape_.Get(index);
-}
-inline ::caffe::BlobShape* DummyDataParameter::mutable_shape(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.DummyDataParameter.shape)
-  return shape_.Mutable(index);
-}
-inline ::caffe::BlobShape* DummyDataParameter::add_shape() {
-  // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.shape)
-  return shape_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-DummyDataParameter::shape() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.shape)
-  return shape_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
-DummyDataParameter::mutable_shape() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.shape)
-  return &shape_;
-}
-
-// repeated uint32 num = 2;
-inline int DummyDataParameter::num_size() const {
-  return num_.size();
-}
-inline void DummyDataParameter::clear_num() {
-  num_.Clear();
-}
-inline ::google::protobuf::uint32 DummyDataParameter::num(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.DummyDataParameter.num)
-  return num_.Get(index);
-}
-inline void DummyDataParameter::set_num(int index, ::google::protobuf::uint32 value) {
-  num_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.DummyDataParameter.num)
-}
-inline void DummyDataParameter::add_num(::google::protobuf::uint32 value) {
-  num_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.num)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-DummyDataParameter::num() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.num)
-  return num_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-DummyDataParameter::mutable_num() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.num)
-  return &num_;
-}
-
-// repeated uint32 channels = 3;
-inline int DummyDataParameter::channels_size() const {
-  return channels_.size();
-}
-inline void DummyDataParameter::clear_channels() {
-  channels_.Clear();
-}
-inline ::google::protobuf::uint32 DummyDataParameter::channels(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.DummyDataParameter.channels)
-  return channels_.Get(index);
-}
-inline void DummyDataParameter::set_channels(int index, ::google::protobuf::uint32 value) {
-  channels_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.DummyDataParameter.channels)
-}
-inline void DummyDataParameter::add_channels(::google::protobuf::uint32 value) {
-  channels_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.channels)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-DummyDataParameter::channels() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.channels)
-  return channels_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-DummyDataParameter::mutable_channels() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.channels)
-  return &channels_;
-}
-
-// repeated uint32 height = 4;
-inline int DummyDataParameter::height_size() const {
-  return height_.size();
-}
-inline void DummyDataParameter::clear_height() {
-  height_.Clear();
-}
-inline ::google::protobuf::uint32 DummyDataParameter::height(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.DummyDataParameter.height)
-  return height_.Get(index);
-}
-inline void DummyDataParameter::set_height(int index, ::google::protobuf::uint32 value) {
-  height_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.DummyDataParameter.height)
-}
-inline void DummyDataParameter::add_height(::google::protobuf::uint32 value) {
-  height_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.height)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-DummyDataParameter::height() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.height)
-  return height_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-DummyDataParameter::mutable_height() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.height)
-  return &height_;
-}
-
-// repeated uint32 width = 5;
-inline int DummyDataParameter::width_size() const {
-  return width_.size();
-}
-inline void DummyDataParameter::clear_width() {
-  width_.Clear();
-}
-inline ::google::protobuf::uint32 DummyDataParameter::width(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.DummyDataParameter.width)
-  return width_.Get(index);
-}
-inline void DummyDataParameter::set_width(int index, ::google::protobuf::uint32 value) {
-  width_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.DummyDataParameter.width)
-}
-inline void DummyDataParameter::add_width(::google::protobuf::uint32 value) {
-  width_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.width)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-DummyDataParameter::width() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.width)
-  return width_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-DummyDataParameter::mutable_width() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.width)
-  return &width_;
-}
-
-// -------------------------------------------------------------------
-
-// EltwiseParameter
-
-// optional .caffe.EltwiseParameter.EltwiseOp operation = 1 [default = SUM];
-inline bool EltwiseParameter::has_operation() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void EltwiseParameter::set_has_operation() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void EltwiseParameter::clear_has_operation() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void EltwiseParameter::clear_operation() {
-  operation_ = 1;
-  clear_has_operation();
-}
-inline ::caffe::EltwiseParameter_EltwiseOp EltwiseParameter::operation() const {
-  // @@protoc_insertion_point(field_get:caffe.EltwiseParameter.operation)
-  return static_cast< ::caffe::EltwiseParameter_EltwiseOp >(operation_);
-}
-inline void EltwiseParameter::set_operation(::caffe::EltwiseParameter_EltwiseOp value) {
-  assert(::caffe::EltwiseParameter_EltwiseOp_IsValid(value));
-  set_has_operation();
-  operation_ = value;
-  // @@protoc_insertion_point(field_set:caffe.EltwiseParameter.operation)
-}
-
-// repeated float coeff = 2;
-inline int EltwiseParameter::coeff_size() const {
-  return coeff_.size();
-}
-inline void EltwiseParameter::clear_coeff() {
-  coeff_.Clear();
-}
-inline float EltwiseParameter::coeff(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.EltwiseParameter.coeff)
-  return coeff_.Get(index);
-}
-inline void EltwiseParameter::set_coeff(int index, float value) {
-  coeff_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.EltwiseParameter.coeff)
-}
-inline void EltwiseParameter::add_coeff(float value) {
-  coeff_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.EltwiseParameter.coeff)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-EltwiseParameter::coeff() const {
-  // @@protoc_insertion_point(field_list:caffe.EltwiseParameter.coeff)
-  return coeff_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-EltwiseParameter::mutable_coeff() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.EltwiseParameter.coeff)
-  return &coeff_;
-}
-
-// optional bool stable_prod_grad = 3 [default = true];
-inline bool EltwiseParameter::has_stable_prod_grad() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void EltwiseParameter::set_has_stable_prod_grad() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void EltwiseParameter::clear_has_stable_prod_grad() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void EltwiseParameter::clear_stable_prod_grad() {
-  stable_prod_grad_ = true;
-  clear_has_stable_prod_grad();
-}
-inline bool EltwiseParameter::stable_prod_grad() const {
-  // @@protoc_insertion_point(field_get:caffe.EltwiseParameter.stable_prod_grad)
-  return stable_prod_grad_;
-}
-inline void EltwiseParameter::set_stable_prod_grad(bool value) {
-  set_has_stable_prod_grad();
-  stable_prod_grad_ = value;
-  // @@protoc_insertion_point(field_set:caffe.EltwiseParameter.stable_prod_grad)
-}
-
-// -------------------------------------------------------------------
-
-// ELUParameter
-
-// optional float alpha = 1 [default = 1];
-inline bool ELUParameter::has_alpha() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ELUParameter::set_has_alpha() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ELUParameter::clear_has_alpha() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ELUParameter::clear_alpha() {
-  alpha_ = 1;
-  clear_has_alpha();
-}
-inline float ELUParameter::alpha() const {
-  // @@protoc_insertion_point(field_get:caffe.ELUParameter.alpha)
-  return alpha_;
-}
-inline void ELUParameter::set_alpha(float value) {
-  set_has_alpha();
-  alpha_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ELUParameter.alpha)
-}
-
-// -------------------------------------------------------------------
-
-// EmbedParameter
-
-// optional uint32 num_output = 1;
-inline bool EmbedParameter::has_num_output() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void EmbedParameter::set_has_num_output() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void EmbedParameter::clear_has_num_output() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void EmbedParameter::clear_num_output() {
-  num_output_ = 0u;
-  clear_has_num_output();
-}
-inline ::google::protobuf::uint32 EmbedParameter::num_output() const {
-  // @@protoc_insertion_point(field_get:caffe.EmbedParameter.num_output)
-  return num_output_;
-}
-inline void EmbedParameter::set_num_output(::google::protobuf::uint32 value) {
-  set_has_num_output();
-  num_output_ = value;
-  // @@protoc_insertion_point(field_set:caffe.EmbedParameter.num_output)
-}
-
-// optional uint32 input_dim = 2;
-inline bool EmbedParameter::has_input_dim() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void EmbedParameter::set_has_input_dim() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void EmbedParameter::clear_has_input_dim() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void EmbedParameter::clear_input_dim() {
-  input_dim_ = 0u;
-  clear_has_input_dim();
-}
-inline ::google::protobuf::uint32 EmbedParameter::input_dim() const {
-  // @@protoc_insertion_point(field_get:caffe.EmbedParameter.input_dim)
-  return input_dim_;
-}
-inline void EmbedParameter::set_input_dim(::google::protobuf::uint32 value) {
-  set_has_input_dim();
-  input_dim_ = value;
-  // @@protoc_insertion_point(field_set:caffe.EmbedParameter.input_dim)
-}
-
-// optional bool bias_term = 3 [default = true];
-inline bool EmbedParameter::has_bias_term() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void EmbedParameter::set_has_bias_term() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void EmbedParameter::clear_has_bias_term() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void EmbedParameter::clear_bias_term() {
-  bias_term_ = true;
-  clear_has_bias_term();
-}
-inline bool EmbedParameter::bias_term() const {
-  // @@protoc_insertion_point(field_get:caffe.EmbedParameter.bias_term)
-  return bias_term_;
-}
-inline void EmbedParameter::set_bias_term(bool value) {
-  set_has_bias_term();
-  bias_term_ = value;
-  // @@protoc_insertion_point(field_set:caffe.EmbedParameter.bias_term)
-}
-
-// optional .caffe.FillerParameter weight_filler = 4;
-inline bool EmbedParameter::has_weight_filler() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void EmbedParameter::set_has_weight_filler() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void EmbedParameter::clear_has_weight_filler() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void EmbedParameter::clear_weight_filler() {
-  if (weight_filler_ != NULL) weight_filler_->::caffe::FillerParameter::Clear();
-  clear_has_weight_filler();
-}
-inline const ::caffe::FillerParameter& EmbedParameter::weight_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.EmbedParameter.weight_filler)
-  return weight_filler_ != NULL ? *weight_filler_ : *default_instance_->weight_filler_;
-}
-inline ::caffe::FillerParameter* EmbedParameter::mutable_weight_filler() {
-  set_has_weight_filler();
-  if (weight_filler_ == NULL) weight_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.EmbedParameter.weight_filler)
-  return weight_filler_;
-}
-inline ::caffe::FillerParameter* EmbedParameter::release_weight_filler() {
-  clear_has_weight_filler();
-  ::caffe::FillerParameter* temp = weight_filler_;
-  weight_filler_ = NULL;
-  return temp;
-}
-inline void EmbedParameter::set_allocated_weight_filler(::caffe::FillerParameter* weight_filler) {
-  delete weight_filler_;
-  weight_filler_ = weight_filler;
-  if (weight_filler) {
-    set_has_weight_filler();
-  } else {
-    clear_has_weight_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.EmbedParameter.weight_filler)
-}
-
-// optional .caffe.FillerParameter bias_filler = 5;
-inline bool EmbedParameter::has_bias_filler() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void EmbedParameter::set_has_bias_filler() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void EmbedParameter::clear_has_bias_filler() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void EmbedParameter::clear_bias_filler() {
-  if (bias_filler_ != NULL) bias_filler_->::caffe::FillerParameter::Clear();
-  clear_has_bias_filler();
-}
-inline const ::caffe::FillerParameter& EmbedParameter::bias_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.EmbedParameter.bias_filler)
-  return bias_filler_ != NULL ? *bias_filler_ : *default_instance_->bias_filler_;
-}
-inline ::caffe::FillerParameter* EmbedParameter::mutable_bias_filler() {
-  set_has_bias_filler();
-  if (bias_filler_ == NULL) bias_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.EmbedParameter.bias_filler)
-  return bias_filler_;
-}
-inline ::caffe::FillerParameter* EmbedParameter::release_bias_filler() {
-  clear_has_bias_filler();
-  ::caffe::FillerParameter* temp = bias_filler_;
-  bias_filler_ = NULL;
-  return temp;
-}
-inline void EmbedParameter::set_allocated_bias_filler(::caffe::FillerParameter* bias_filler) {
-  delete bias_filler_;
-  bias_filler_ = bias_filler;
-  if (bias_filler) {
-    set_has_bias_filler();
-  } else {
-    clear_has_bias_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.EmbedParameter.bias_filler)
-}
-
-// -------------------------------------------------------------------
-
-// ExpParameter
-
-// optional float base = 1 [default = -1];
-inline bool ExpParameter::has_base() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ExpParameter::set_has_base() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ExpParameter::clear_has_base() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ExpParameter::clear_base() {
-  base_ = -1;
-  clear_has_base();
-}
-inline float ExpParameter::base() const {
-  // @@protoc_insertion_point(field_get:caffe.ExpParameter.base)
-  return base_;
-}
-inline void ExpParameter::set_base(float value) {
-  set_has_base();
-  base_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ExpParameter.base)
-}
-
-// optional float scale = 2 [default = 1];
-inline bool ExpParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ExpParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ExpParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ExpParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float ExpParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.ExpParameter.scale)
-  return scale_;
-}
-inline void ExpParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ExpParameter.scale)
-}
-
-// optional float shift = 3 [default = 0];
-inline bool ExpParameter::has_shift() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ExpParameter::set_has_shift() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ExpParameter::clear_has_shift() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ExpParameter::clear_shift() {
-  shift_ = 0;
-  clear_has_shift();
-}
-inline float ExpParameter::shift() const {
-  // @@protoc_insertion_point(field_get:caffe.ExpParameter.shift)
-  return shift_;
-}
-inline void ExpParameter::set_shift(float value) {
-  set_has_shift();
-  shift_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ExpParameter.shift)
-}
-
-// -------------------------------------------------------------------
-
-// FlattenParameter
-
-// optional int32 axis = 1 [default = 1];
-inline bool FlattenParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void FlattenParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void FlattenParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void FlattenParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 FlattenParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.FlattenParameter.axis)
-  return axis_;
-}
-inline void FlattenParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FlattenParameter.axis)
-}
-
-// optional int32 end_axis = 2 [default = -1];
-inline bool FlattenParameter::has_end_axis() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void FlattenParameter::set_has_end_axis() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void FlattenParameter::clear_has_end_axis() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void FlattenParameter::clear_end_axis() {
-  end_axis_ = -1;
-  clear_has_end_axis();
-}
-inline ::google::protobuf::int32 FlattenParameter::end_axis() const {
-  // @@protoc_insertion_point(field_get:caffe.FlattenParameter.end_axis)
-  return end_axis_;
-}
-inline void FlattenParameter::set_end_axis(::google::protobuf::int32 value) {
-  set_has_end_axis();
-  end_axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.FlattenParameter.end_axis)
-}
-
-// -------------------------------------------------------------------
-
-// HDF5DataParameter
-
-// optional string source = 1;
-inline bool HDF5DataParameter::has_source() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void HDF5DataParameter::set_has_source() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void HDF5DataParameter::clear_has_source() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void HDF5DataParameter::clear_source() {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_->clear();
-  }
-  clear_has_source();
-}
-inline const ::std::string& HDF5DataParameter::source() const {
-  // @@protoc_insertion_point(field_get:caffe.HDF5DataParameter.source)
-  return *source_;
-}
-inline void HDF5DataParameter::set_source(const ::std::string& value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.HDF5DataParameter.source)
-}
-inline void HDF5DataParameter::set_source(const char* value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.HDF5DataParameter.source)
-}
-inline void HDF5DataParameter::set_source(const char* value, size_t size) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.HDF5DataParameter.source)
-}
-inline ::std::string* HDF5DataParameter::mutable_source() {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.HDF5DataParameter.source)
-  return source_;
-}
-inline ::std::string* HDF5DataParameter::release_source() {
-  clear_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = source_;
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void HDF5DataParameter::set_allocated_source(::std::string* source) {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete source_;
-  }
-  if (source) {
-    set_has_source();
-    source_ = source;
-  } else {
-    clear_has_source();
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.HDF5DataParameter.source)
-}
-
-// optional uint32 batch_size = 2;
-inline bool HDF5DataParameter::has_batch_size() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void HDF5DataParameter::set_has_batch_size() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void HDF5DataParameter::clear_has_batch_size() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void HDF5DataParameter::clear_batch_size() {
-  batch_size_ = 0u;
-  clear_has_batch_size();
-}
-inline ::google::protobuf::uint32 HDF5DataParameter::batch_size() const {
-  // @@protoc_insertion_point(field_get:caffe.HDF5DataParameter.batch_size)
-  return batch_size_;
-}
-inline void HDF5DataParameter::set_batch_size(::google::protobuf::uint32 value) {
-  set_has_batch_size();
-  batch_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.HDF5DataParameter.batch_size)
-}
-
-// optional bool shuffle = 3 [default = false];
-inline bool HDF5DataParameter::has_shuffle() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void HDF5DataParameter::set_has_shuffle() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void HDF5DataParameter::clear_has_shuffle() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void HDF5DataParameter::clear_shuffle() {
-  shuffle_ = false;
-  clear_has_shuffle();
-}
-inline bool HDF5DataParameter::shuffle() const {
-  // @@protoc_insertion_point(field_get:caffe.HDF5DataParameter.shuffle)
-  return shuffle_;
-}
-inline void HDF5DataParameter::set_shuffle(bool value) {
-  set_has_shuffle();
-  shuffle_ = value;
-  // @@protoc_insertion_point(field_set:caffe.HDF5DataParameter.shuffle)
-}
-
-// -------------------------------------------------------------------
-
-// HDF5OutputParameter
-
-// optional string file_name = 1;
-inline bool HDF5OutputParameter::has_file_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void HDF5OutputParameter::set_has_file_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void HDF5OutputParameter::clear_has_file_name() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void HDF5OutputParameter::clear_file_name() {
-  if (file_name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    file_name_->clear();
-  }
-  clear_has_file_name();
-}
-inline const ::std::string& HDF5OutputParameter::file_name() const {
-  // @@protoc_insertion_point(field_get:caffe.HDF5OutputParameter.file_name)
-  return *file_name_;
-}
-inline void HDF5OutputParameter::set_file_name(const ::std::string& value) {
-  set_has_file_name();
-  if (file_name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    file_name_ = new ::std::string;
-  }
-  file_name_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.HDF5OutputParameter.file_name)
-}
-inline void HDF5OutputParameter::set_file_name(const char* value) {
-  set_has_file_name();
-  if (file_name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    file_name_ = new ::std::string;
-  }
-  file_name_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.HDF5OutputParameter.file_name)
-}
-inline void HDF5OutputParameter::set_file_name(const char* value, size_t size) {
-  set_has_file_name();
-  if (file_name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    file_name_ = new ::std::string;
-  }
-  file_name_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.HDF5OutputParameter.file_name)
-}
-inline ::std::string* HDF5OutputParameter::mutable_file_name() {
-  set_has_file_name();
-  if (file_name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    file_name_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.HDF5OutputParameter.file_name)
-  return file_name_;
-}
-inline ::std::string* HDF5OutputParameter::release_file_name() {
-  clear_has_file_name();
-  if (file_name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = file_name_;
-    file_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void HDF5OutputParameter::set_allocated_file_name(::std::string* file_name) {
-  if (file_name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete file_name_;
-  }
-  if (file_name) {
-    set_has_file_name();
-    file_name_ = file_name;
-  } else {
-    clear_has_file_name();
-    file_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.HDF5OutputParameter.file_name)
-}
-
-// -------------------------------------------------------------------
-
-// HingeLossParameter
-
-// optional .caffe.HingeLossParameter.Norm norm = 1 [default = L1];
-inline bool HingeLossParameter::has_norm() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void HingeLossParameter::set_has_norm() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void HingeLossParameter::clear_has_norm() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void HingeLossParameter::clear_norm() {
-  norm_ = 1;
-  clear_has_norm();
-}
-inline ::caffe::HingeLossParameter_Norm HingeLossParameter::norm() const {
-  // @@protoc_insertion_point(field_get:caffe.HingeLossParameter.norm)
-  return static_cast< ::caffe::HingeLossParameter_Norm >(norm_);
-}
-inline void HingeLossParameter::set_norm(::caffe::HingeLossParameter_Norm value) {
-  assert(::caffe::HingeLossParameter_Norm_IsValid(value));
-  set_has_norm();
-  norm_ = value;
-  // @@protoc_insertion_point(field_set:caffe.HingeLossParameter.norm)
-}
-
-// -------------------------------------------------------------------
-
-// ImageDataParameter
-
-// optional string source = 1;
-inline bool ImageDataParameter::has_source() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ImageDataParameter::set_has_source() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ImageDataParameter::clear_has_source() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ImageDataParameter::clear_source() {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_->clear();
-  }
-  clear_has_source();
-}
-inline const ::std::string& ImageDataParameter::source() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.source)
-  return *source_;
-}
-inline void ImageDataParameter::set_source(const ::std::string& value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.source)
-}
-inline void ImageDataParameter::set_source(const char* value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.ImageDataParameter.source)
-}
-inline void ImageDataParameter::set_source(const char* value, size_t size) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.ImageDataParameter.source)
-}
-inline ::std::string* ImageDataParameter::mutable_source() {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.ImageDataParameter.source)
-  return source_;
-}
-inline ::std::string* ImageDataParameter::release_source() {
-  clear_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = source_;
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void ImageDataParameter::set_allocated_source(::std::string* source) {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete source_;
-  }
-  if (source) {
-    set_has_source();
-    source_ = source;
-  } else {
-    clear_has_source();
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ImageDataParameter.source)
-}
-
-// optional uint32 batch_size = 4 [default = 1];
-inline bool ImageDataParameter::has_batch_size() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ImageDataParameter::set_has_batch_size() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ImageDataParameter::clear_has_batch_size() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ImageDataParameter::clear_batch_size() {
-  batch_size_ = 1u;
-  clear_has_batch_size();
-}
-inline ::google::protobuf::uint32 ImageDataParameter::batch_size() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.batch_size)
-  return batch_size_;
-}
-inline void ImageDataParameter::set_batch_size(::google::protobuf::uint32 value) {
-  set_has_batch_size();
-  batch_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.batch_size)
-}
-
-// optional uint32 rand_skip = 7 [default = 0];
-inline bool ImageDataParameter::has_rand_skip() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ImageDataParameter::set_has_rand_skip() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ImageDataParameter::clear_has_rand_skip() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ImageDataParameter::clear_rand_skip() {
-  rand_skip_ = 0u;
-  clear_has_rand_skip();
-}
-inline ::google::protobuf::uint32 ImageDataParameter::rand_skip() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.rand_skip)
-  return rand_skip_;
-}
-inline void ImageDataParameter::set_rand_skip(::google::protobuf::uint32 value) {
-  set_has_rand_skip();
-  rand_skip_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.rand_skip)
-}
-
-// optional bool shuffle = 8 [default = false];
-inline bool ImageDataParameter::has_shuffle() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void ImageDataParameter::set_has_shuffle() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void ImageDataParameter::clear_has_shuffle() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void ImageDataParameter::clear_shuffle() {
-  shuffle_ = false;
-  clear_has_shuffle();
-}
-inline bool ImageDataParameter::shuffle() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.shuffle)
-  return shuffle_;
-}
-inline void ImageDataParameter::set_shuffle(bool value) {
-  set_has_shuffle();
-  shuffle_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.shuffle)
-}
-
-// optional uint32 new_height = 9 [default = 0];
-inline bool ImageDataParameter::has_new_height() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void ImageDataParameter::set_has_new_height() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void ImageDataParameter::clear_has_new_height() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void ImageDataParameter::clear_new_height() {
-  new_height_ = 0u;
-  clear_has_new_height();
-}
-inline ::google::protobuf::uint32 ImageDataParameter::new_height() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.new_height)
-  return new_height_;
-}
-inline void ImageDataParameter::set_new_height(::google::protobuf::uint32 value) {
-  set_has_new_height();
-  new_height_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.new_height)
-}
-
-// optional uint32 new_width = 10 [default = 0];
-inline bool ImageDataParameter::has_new_width() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void ImageDataParameter::set_has_new_width() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void ImageDataParameter::clear_has_new_width() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void ImageDataParameter::clear_new_width() {
-  new_width_ = 0u;
-  clear_has_new_width();
-}
-inline ::google::protobuf::uint32 ImageDataParameter::new_width() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.new_width)
-  return new_width_;
-}
-inline void ImageDataParameter::set_new_width(::google::protobuf::uint32 value) {
-  set_has_new_width();
-  new_width_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.new_width)
-}
-
-// optional bool is_color = 11 [default = true];
-inline bool ImageDataParameter::has_is_color() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void ImageDataParameter::set_has_is_color() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void ImageDataParameter::clear_has_is_color() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void ImageDataParameter::clear_is_color() {
-  is_color_ = true;
-  clear_has_is_color();
-}
-inline bool ImageDataParameter::is_color() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.is_color)
-  return is_color_;
-}
-inline void ImageDataParameter::set_is_color(bool value) {
-  set_has_is_color();
-  is_color_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.is_color)
-}
-
-// optional float scale = 2 [default = 1];
-inline bool ImageDataParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void ImageDataParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void ImageDataParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void ImageDataParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float ImageDataParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.scale)
-  return scale_;
-}
-inline void ImageDataParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.scale)
-}
-
-// optional string mean_file = 3;
-inline bool ImageDataParameter::has_mean_file() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void ImageDataParameter::set_has_mean_file() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void ImageDataParameter::clear_has_mean_file() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline void ImageDataParameter::clear_mean_file() {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_->clear();
-  }
-  clear_has_mean_file();
-}
-inline const ::std::string& ImageDataParameter::mean_file() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.mean_file)
-  return *mean_file_;
-}
-inline void ImageDataParameter::set_mean_file(const ::std::string& value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.mean_file)
-}
-inline void ImageDataParameter::set_mean_file(const char* value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.ImageDataParameter.mean_file)
-}
-inline void ImageDataParameter::set_mean_file(const char* value, size_t size) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.ImageDataParameter.mean_file)
-}
-inline ::std::string* ImageDataParameter::mutable_mean_file() {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.ImageDataParameter.mean_file)
-  return mean_file_;
-}
-inline ::std::string* ImageDataParameter::release_mean_file() {
-  clear_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = mean_file_;
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void ImageDataParameter::set_allocated_mean_file(::std::string* mean_file) {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete mean_file_;
-  }
-  if (mean_file) {
-    set_has_mean_file();
-    mean_file_ = mean_file;
-  } else {
-    clear_has_mean_file();
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ImageDataParameter.mean_file)
-}
-
-// optional uint32 crop_size = 5 [default = 0];
-inline bool ImageDataParameter::has_crop_size() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void ImageDataParameter::set_has_crop_size() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void ImageDataParameter::clear_has_crop_size() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-inline void ImageDataParameter::clear_crop_size() {
-  crop_size_ = 0u;
-  clear_has_crop_size();
-}
-inline ::google::protobuf::uint32 ImageDataParameter::crop_size() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.crop_size)
-  return crop_size_;
-}
-inline void ImageDataParameter::set_crop_size(::google::protobuf::uint32 value) {
-  set_has_crop_size();
-  crop_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.crop_size)
-}
-
-// optional bool mirror = 6 [default = false];
-inline bool ImageDataParameter::has_mirror() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void ImageDataParameter::set_has_mirror() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void ImageDataParameter::clear_has_mirror() {
-  _has_bits_[0] &= ~0x00000400u;
-}
-inline void ImageDataParameter::clear_mirror() {
-  mirror_ = false;
-  clear_has_mirror();
-}
-inline bool ImageDataParameter::mirror() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.mirror)
-  return mirror_;
-}
-inline void ImageDataParameter::set_mirror(bool value) {
-  set_has_mirror();
-  mirror_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.mirror)
-}
-
-// optional string root_folder = 12 [default = ""];
-inline bool ImageDataParameter::has_root_folder() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void ImageDataParameter::set_has_root_folder() {
-  _has_bits_[0] |= 0x00000800u;
-}
-inline void ImageDataParameter::clear_has_root_folder() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-inline void ImageDataParameter::clear_root_folder() {
-  if (root_folder_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_->clear();
-  }
-  clear_has_root_folder();
-}
-inline const ::std::string& ImageDataParameter::root_folder() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.root_folder)
-  return *root_folder_;
-}
-inline void ImageDataParameter::set_root_folder(const ::std::string& value) {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  root_folder_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.root_folder)
-}
-inline void ImageDataParameter::set_root_folder(const char* value) {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  root_folder_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.ImageDataParameter.root_folder)
-}
-inline void ImageDataParameter::set_root_folder(const char* value, size_t size) {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  root_folder_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.ImageDataParameter.root_folder)
-}
-inline ::std::string* ImageDataParameter::mutable_root_folder() {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.ImageDataParameter.root_folder)
-  return root_folder_;
-}
-inline ::std::string* ImageDataParameter::release_root_folder() {
-  clear_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = root_folder_;
-    root_folder_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void ImageDataParameter::set_allocated_root_folder(::std::string* root_folder) {
-  if (root_folder_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete root_folder_;
-  }
-  if (root_folder) {
-    set_has_root_folder();
-    root_folder_ = root_folder;
-  } else {
-    clear_has_root_folder();
-    root_folder_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ImageDataParameter.root_folder)
-}
-
-// -------------------------------------------------------------------
-
-// InfogainLossParameter
-
-// optional string source = 1;
-inline bool InfogainLossParameter::has_source() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void InfogainLossParameter::set_has_source() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void InfogainLossParameter::clear_has_source() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void InfogainLossParameter::clear_source() {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_->clear();
-  }
-  clear_has_source();
-}
-inline const ::std::string& InfogainLossParameter::source() const {
-  // @@protoc_insertion_point(field_get:caffe.InfogainLossParameter.source)
-  return *source_;
-}
-inline void InfogainLossParameter::set_source(const ::std::string& value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.InfogainLossParameter.source)
-}
-inline void InfogainLossParameter::set_source(const char* value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.InfogainLossParameter.source)
-}
-inline void InfogainLossParameter::set_source(const char* value, size_t size) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.InfogainLossParameter.source)
-}
-inline ::std::string* InfogainLossParameter::mutable_source() {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.InfogainLossParameter.source)
-  return source_;
-}
-inline ::std::string* InfogainLossParameter::release_source() {
-  clear_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = source_;
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void InfogainLossParameter::set_allocated_source(::std::string* source) {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete source_;
-  }
-  if (source) {
-    set_has_source();
-    source_ = source;
-  } else {
-    clear_has_source();
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.InfogainLossParameter.source)
-}
-
-// -------------------------------------------------------------------
-
-// InnerProductParameter
-
-// optional uint32 num_output = 1;
-inline bool InnerProductParameter::has_num_output() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void InnerProductParameter::set_has_num_output() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void InnerProductParameter::clear_has_num_output() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void InnerProductParameter::clear_num_output() {
-  num_output_ = 0u;
-  clear_has_num_output();
-}
-inline ::google::protobuf::uint32 InnerProductParameter::num_output() const {
-  // @@protoc_insertion_point(field_get:caffe.InnerProductParameter.num_output)
-  return num_output_;
-}
-inline void InnerProductParameter::set_num_output(::google::protobuf::uint32 value) {
-  set_has_num_output();
-  num_output_ = value;
-  // @@protoc_insertion_point(field_set:caffe.InnerProductParameter.num_output)
-}
-
-// optional bool bias_term = 2 [default = true];
-inline bool InnerProductParameter::has_bias_term() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void InnerProductParameter::set_has_bias_term() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void InnerProductParameter::clear_has_bias_term() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void InnerProductParameter::clear_bias_term() {
-  bias_term_ = true;
-  clear_has_bias_term();
-}
-inline bool InnerProductParameter::bias_term() const {
-  // @@protoc_insertion_point(field_get:caffe.InnerProductParameter.bias_term)
-  return bias_term_;
-}
-inline void InnerProductParameter::set_bias_term(bool value) {
-  set_has_bias_term();
-  bias_term_ = value;
-  // @@protoc_insertion_point(field_set:caffe.InnerProductParameter.bias_term)
-}
-
-// optional .caffe.FillerParameter weight_filler = 3;
-inline bool InnerProductParameter::has_weight_filler() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void InnerProductParameter::set_has_weight_filler() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void InnerProductParameter::clear_has_weight_filler() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void InnerProductParameter::clear_weight_filler() {
-  if (weight_filler_ != NULL) weight_filler_->::caffe::FillerParameter::Clear();
-  clear_has_weight_filler();
-}
-inline const ::caffe::FillerParameter& InnerProductParameter::weight_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.InnerProductParameter.weight_filler)
-  return weight_filler_ != NULL ? *weight_filler_ : *default_instance_->weight_filler_;
-}
-inline ::caffe::FillerParameter* InnerProductParameter::mutable_weight_filler() {
-  set_has_weight_filler();
-  if (weight_filler_ == NULL) weight_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.InnerProductParameter.weight_filler)
-  return weight_filler_;
-}
-inline ::caffe::FillerParameter* InnerProductParameter::release_weight_filler() {
-  clear_has_weight_filler();
-  ::caffe::FillerParameter* temp = weight_filler_;
-  weight_filler_ = NULL;
-  return temp;
-}
-inline void InnerProductParameter::set_allocated_weight_filler(::caffe::FillerParameter* weight_filler) {
-  delete weight_filler_;
-  weight_filler_ = weight_filler;
-  if (weight_filler) {
-    set_has_weight_filler();
-  } else {
-    clear_has_weight_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.InnerProductParameter.weight_filler)
-}
-
-// optional .caffe.FillerParameter bias_filler = 4;
-inline bool InnerProductParameter::has_bias_filler() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void InnerProductParameter::set_has_bias_filler() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void InnerProductParameter::clear_has_bias_filler() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void InnerProductParameter::clear_bias_filler() {
-  if (bias_filler_ != NULL) bias_filler_->::caffe::FillerParameter::Clear();
-  clear_has_bias_filler();
-}
-inline const ::caffe::FillerParameter& InnerProductParameter::bias_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.InnerProductParameter.bias_filler)
-  return bias_filler_ != NULL ? *bias_filler_ : *default_instance_->bias_filler_;
-}
-inline ::caffe::FillerParameter* InnerProductParameter::mutable_bias_filler() {
-  set_has_bias_filler();
-  if (bias_filler_ == NULL) bias_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.InnerProductParameter.bias_filler)
-  return bias_filler_;
-}
-inline ::caffe::FillerParameter* InnerProductParameter::release_bias_filler() {
-  clear_has_bias_filler();
-  ::caffe::FillerParameter* temp = bias_filler_;
-  bias_filler_ = NULL;
-  return temp;
-}
-inline void InnerProductParameter::set_allocated_bias_filler(::caffe::FillerParameter* bias_filler) {
-  delete bias_filler_;
-  bias_filler_ = bias_filler;
-  if (bias_filler) {
-    set_has_bias_filler();
-  } else {
-    clear_has_bias_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.InnerProductParameter.bias_filler)
-}
-
-// optional int32 axis = 5 [default = 1];
-inline bool InnerProductParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void InnerProductParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void InnerProductParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void InnerProductParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 InnerProductParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.InnerProductParameter.axis)
-  return axis_;
-}
-inline void InnerProductParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.InnerProductParameter.axis)
-}
-
-// optional bool transpose = 6 [default = false];
-inline bool InnerProductParameter::has_transpose() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void InnerProductParameter::set_has_transpose() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void InnerProductParameter::clear_has_transpose() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void InnerProductParameter::clear_transpose() {
-  transpose_ = false;
-  clear_has_transpose();
-}
-inline bool InnerProductParameter::transpose() const {
-  // @@protoc_insertion_point(field_get:caffe.InnerProductParameter.transpose)
-  return transpose_;
-}
-inline void InnerProductParameter::set_transpose(bool value) {
-  set_has_transpose();
-  transpose_ = value;
-  // @@protoc_insertion_point(field_set:caffe.InnerProductParameter.transpose)
-}
-
-// -------------------------------------------------------------------
-
-// InputParameter
-
-// repeated .caffe.BlobShape shape = 1;
-inline int InputParameter::shape_size() const {
-  return shape_.size();
-}
-inline void InputParameter::clear_shape() {
-  shape_.Clear();
-}
-inline const ::caffe::BlobShape& InputParameter::shape(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.InputParameter.shape)
-  return shape_.Get(index);
-}
-inline ::caffe::BlobShape* InputParameter::mutable_shape(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.InputParameter.shape)
-  return shape_.Mutable(index);
-}
-inline ::caffe::BlobShape* InputParameter::add_shape() {
-  // @@protoc_insertion_point(field_add:caffe.InputParameter.shape)
-  return shape_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-InputParameter::shape() const {
-  // @@protoc_insertion_point(field_list:caffe.InputParameter.shape)
-  return shape_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
-InputParameter::mutable_shape() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.InputParameter.shape)
-  return &shape_;
-}
-
-// -------------------------------------------------------------------
-
-// LogParameter
-
-// optional float base = 1 [default = -1];
-inline bool LogParameter::has_base() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LogParameter::set_has_base() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LogParameter::clear_has_base() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void LogParameter::clear_base() {
-  base_ = -1;
-  clear_has_base();
-}
-inline float LogParameter::base() const {
-  // @@protoc_insertion_point(field_get:caffe.LogParameter.base)
-  return base_;
-}
-inline void LogParameter::set_base(float value) {
-  set_has_base();
-  base_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LogParameter.base)
-}
-
-// optional float scale = 2 [default = 1];
-inline bool LogParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void LogParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void LogParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void LogParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float LogParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.LogParameter.scale)
-  return scale_;
-}
-inline void LogParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LogParameter.scale)
-}
-
-// optional float shift = 3 [default = 0];
-inline bool LogParameter::has_shift() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void LogParameter::set_has_shift() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void LogParameter::clear_has_shift() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void LogParameter::clear_shift() {
-  shift_ = 0;
-  clear_has_shift();
-}
-inline float LogParameter::shift() const {
-  // @@protoc_insertion_point(field_get:caffe.LogParameter.shift)
-  return shift_;
-}
-inline void LogParameter::set_shift(float value) {
-  set_has_shift();
-  shift_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LogParameter.shift)
-}
-
-// -------------------------------------------------------------------
-
-// LRNParameter
-
-// optional uint32 local_size = 1 [default = 5];
-inline bool LRNParameter::has_local_size() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LRNParameter::set_has_local_size() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LRNParameter::clear_has_local_size() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void LRNParameter::clear_local_size() {
-  local_size_ = 5u;
-  clear_has_local_size();
-}
-inline ::google::protobuf::uint32 LRNParameter::local_size() const {
-  // @@protoc_insertion_point(field_get:caffe.LRNParameter.local_size)
-  return local_size_;
-}
-inline void LRNParameter::set_local_size(::google::protobuf::uint32 value) {
-  set_has_local_size();
-  local_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LRNParameter.local_size)
-}
-
-// optional float alpha = 2 [default = 1];
-inline bool LRNParameter::has_alpha() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void LRNParameter::set_has_alpha() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void LRNParameter::clear_has_alpha() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void LRNParameter::clear_alpha() {
-  alpha_ = 1;
-  clear_has_alpha();
-}
-inline float LRNParameter::alpha() const {
-  // @@protoc_insertion_point(field_get:caffe.LRNParameter.alpha)
-  return alpha_;
-}
-inline void LRNParameter::set_alpha(float value) {
-  set_has_alpha();
-  alpha_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LRNParameter.alpha)
-}
-
-// optional float beta = 3 [default = 0.75];
-inline bool LRNParameter::has_beta() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void LRNParameter::set_has_beta() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void LRNParameter::clear_has_beta() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void LRNParameter::clear_beta() {
-  beta_ = 0.75f;
-  clear_has_beta();
-}
-inline float LRNParameter::beta() const {
-  // @@protoc_insertion_point(field_get:caffe.LRNParameter.beta)
-  return beta_;
-}
-inline void LRNParameter::set_beta(float value) {
-  set_has_beta();
-  beta_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LRNParameter.beta)
-}
-
-// optional .caffe.LRNParameter.NormRegion norm_region = 4 [default = ACROSS_CHANNELS];
-inline bool LRNParameter::has_norm_region() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void LRNParameter::set_has_norm_region() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void LRNParameter::clear_has_norm_region() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void LRNParameter::clear_norm_region() {
-  norm_region_ = 0;
-  clear_has_norm_region();
-}
-inline ::caffe::LRNParameter_NormRegion LRNParameter::norm_region() const {
-  // @@protoc_insertion_point(field_get:caffe.LRNParameter.norm_region)
-  return static_cast< ::caffe::LRNParameter_NormRegion >(norm_region_);
-}
-inline void LRNParameter::set_norm_region(::caffe::LRNParameter_NormRegion value) {
-  assert(::caffe::LRNParameter_NormRegion_IsValid(value));
-  set_has_norm_region();
-  norm_region_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LRNParameter.norm_region)
-}
-
-// optional float k = 5 [default = 1];
-inline bool LRNParameter::has_k() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void LRNParameter::set_has_k() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void LRNParameter::clear_has_k() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void LRNParameter::clear_k() {
-  k_ = 1;
-  clear_has_k();
-}
-inline float LRNParameter::k() const {
-  // @@protoc_insertion_point(field_get:caffe.LRNParameter.k)
-  return k_;
-}
-inline void LRNParameter::set_k(float value) {
-  set_has_k();
-  k_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LRNParameter.k)
-}
-
-// optional .caffe.LRNParameter.Engine engine = 6 [default = DEFAULT];
-inline bool LRNParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void LRNParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void LRNParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void LRNParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::LRNParameter_Engine LRNParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.LRNParameter.engine)
-  return static_cast< ::caffe::LRNParameter_Engine >(engine_);
-}
-inline void LRNParameter::set_engine(::caffe::LRNParameter_Engine value) {
-  assert(::caffe::LRNParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.LRNParameter.engine)
-}
-
-// -------------------------------------------------------------------
-
-// MemoryDataParameter
-
-// optional uint32 batch_size = 1;
-inline bool MemoryDataParameter::has_batch_size() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MemoryDataParameter::set_has_batch_size() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void MemoryDataParameter::clear_has_batch_size() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void MemoryDataParameter::clear_batch_size() {
-  batch_size_ = 0u;
-  clear_has_batch_size();
-}
-inline ::google::protobuf::uint32 MemoryDataParameter::batch_size() const {
-  // @@protoc_insertion_point(field_get:caffe.MemoryDataParameter.batch_size)
-  return batch_size_;
-}
-inline void MemoryDataParameter::set_batch_size(::google::protobuf::uint32 value) {
-  set_has_batch_size();
-  batch_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.MemoryDataParameter.batch_size)
-}
-
-// optional uint32 channels = 2;
-inline bool MemoryDataParameter::has_channels() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void MemoryDataParameter::set_has_channels() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void MemoryDataParameter::clear_has_channels() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void MemoryDataParameter::clear_channels() {
-  channels_ = 0u;
-  clear_has_channels();
-}
-inline ::google::protobuf::uint32 MemoryDataParameter::channels() const {
-  // @@protoc_insertion_point(field_get:caffe.MemoryDataParameter.channels)
-  return channels_;
-}
-inline void MemoryDataParameter::set_channels(::google::protobuf::uint32 value) {
-  set_has_channels();
-  channels_ = value;
-  // @@protoc_insertion_point(field_set:caffe.MemoryDataParameter.channels)
-}
-
-// optional uint32 height = 3;
-inline bool MemoryDataParameter::has_height() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void MemoryDataParameter::set_has_height() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void MemoryDataParameter::clear_has_height() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void MemoryDataParameter::clear_height() {
-  height_ = 0u;
-  clear_has_height();
-}
-inline ::google::protobuf::uint32 MemoryDataParameter::height() const {
-  // @@protoc_insertion_point(field_get:caffe.MemoryDataParameter.height)
-  return height_;
-}
-inline void MemoryDataParameter::set_height(::google::protobuf::uint32 value) {
-  set_has_height();
-  height_ = value;
-  // @@protoc_insertion_point(field_set:caffe.MemoryDataParameter.height)
-}
-
-// optional uint32 width = 4;
-inline bool MemoryDataParameter::has_width() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void MemoryDataParameter::set_has_width() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void MemoryDataParameter::clear_has_width() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void MemoryDataParameter::clear_width() {
-  width_ = 0u;
-  clear_has_width();
-}
-inline ::google::protobuf::uint32 MemoryDataParameter::width() const {
-  // @@protoc_insertion_point(field_get:caffe.MemoryDataParameter.width)
-  return width_;
-}
-inline void MemoryDataParameter::set_width(::google::protobuf::uint32 value) {
-  set_has_width();
-  width_ = value;
-  // @@protoc_insertion_point(field_set:caffe.MemoryDataParameter.width)
-}
-
-// -------------------------------------------------------------------
-
-// MVNParameter
-
-// optional bool normalize_variance = 1 [default = true];
-inline bool MVNParameter::has_normalize_variance() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void MVNParameter::set_has_normalize_variance() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void MVNParameter::clear_has_normalize_variance() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void MVNParameter::clear_normalize_variance() {
-  normalize_variance_ = true;
-  clear_has_normalize_variance();
-}
-inline bool MVNParameter::normalize_variance() const {
-  // @@protoc_insertion_point(field_get:caffe.MVNParameter.normalize_variance)
-  return normalize_variance_;
-}
-inline void MVNParameter::set_normalize_variance(bool value) {
-  set_has_normalize_variance();
-  normalize_variance_ = value;
-  // @@protoc_insertion_point(field_set:caffe.MVNParameter.normalize_variance)
-}
-
-// optional bool across_channels = 2 [default = false];
-inline bool MVNParameter::has_across_channels() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void MVNParameter::set_has_across_channels() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void MVNParameter::clear_has_across_channels() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void MVNParameter::clear_across_channels() {
-  across_channels_ = false;
-  clear_has_across_channels();
-}
-inline bool MVNParameter::across_channels() const {
-  // @@protoc_insertion_point(field_get:caffe.MVNParameter.across_channels)
-  return across_channels_;
-}
-inline void MVNParameter::set_across_channels(bool value) {
-  set_has_across_channels();
-  across_channels_ = value;
-  // @@protoc_insertion_point(field_set:caffe.MVNParameter.across_channels)
-}
-
-// optional float eps = 3 [default = 1e-09];
-inline bool MVNParameter::has_eps() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void MVNParameter::set_has_eps() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void MVNParameter::clear_has_eps() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void MVNParameter::clear_eps() {
-  eps_ = 1e-09f;
-  clear_has_eps();
-}
-inline float MVNParameter::eps() const {
-  // @@protoc_insertion_point(field_get:caffe.MVNParameter.eps)
-  return eps_;
-}
-inline void MVNParameter::set_eps(float value) {
-  set_has_eps();
-  eps_ = value;
-  // @@protoc_insertion_point(field_set:caffe.MVNParameter.eps)
-}
-
-// -------------------------------------------------------------------
-
-// ParameterParameter
-
-// optional .caffe.BlobShape shape = 1;
-inline bool ParameterParameter::has_shape() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ParameterParameter::set_has_shape() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ParameterParameter::clear_has_shape() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ParameterParameter::clear_shape() {
-  if (shape_ != NULL) shape_->::caffe::BlobShape::Clear();
-  clear_has_shape();
-}
-inline const ::caffe::BlobShape& ParameterParameter::shape() const {
-  // @@protoc_insertion_point(field_get:caffe.ParameterParameter.shape)
-  return shape_ != NULL ? *shape_ : *default_instance_->shape_;
-}
-inline ::caffe::BlobShape* ParameterParameter::mutable_shape() {
-  set_has_shape();
-  if (shape_ == NULL) shape_ = new ::caffe::BlobShape;
-  // @@protoc_insertion_point(field_mutable:caffe.ParameterParameter.shape)
-  return shape_;
-}
-inline ::caffe::BlobShape* ParameterParameter::release_shape() {
-  clear_has_shape();
-  ::caffe::BlobShape* temp = shape_;
-  shape_ = NULL;
-  return temp;
-}
-inline void ParameterParameter::set_allocated_shape(::caffe::BlobShape* shape) {
-  delete shape_;
-  shape_ = shape;
-  if (shape) {
-    set_has_shape();
-  } else {
-    clear_has_shape();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ParameterParameter.shape)
-}
-
-// -------------------------------------------------------------------
-
-// PoolingParameter
-
-// optional .caffe.PoolingParameter.PoolMethod pool = 1 [default = MAX];
-inline bool PoolingParameter::has_pool() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void PoolingParameter::set_has_pool() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void PoolingParameter::clear_has_pool() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void PoolingParameter::clear_pool() {
-  pool_ = 0;
-  clear_has_pool();
-}
-inline ::caffe::PoolingParameter_PoolMethod PoolingParameter::pool() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.pool)
-  return static_cast< ::caffe::PoolingParameter_PoolMethod >(pool_);
-}
-inline void PoolingParameter::set_pool(::caffe::PoolingParameter_PoolMethod value) {
-  assert(::caffe::PoolingParameter_PoolMethod_IsValid(value));
-  set_has_pool();
-  pool_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.pool)
-}
-
-// optional uint32 pad = 4 [default = 0];
-inline bool PoolingParameter::has_pad() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void PoolingParameter::set_has_pad() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void PoolingParameter::clear_has_pad() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void PoolingParameter::clear_pad() {
-  pad_ = 0u;
-  clear_has_pad();
-}
-inline ::google::protobuf::uint32 PoolingParameter::pad() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.pad)
-  return pad_;
-}
-inline void PoolingParameter::set_pad(::google::protobuf::uint32 value) {
-  set_has_pad();
-  pad_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.pad)
-}
-
-// optional uint32 pad_h = 9 [default = 0];
-inline bool PoolingParameter::has_pad_h() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void PoolingParameter::set_has_pad_h() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void PoolingParameter::clear_has_pad_h() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void PoolingParameter::clear_pad_h() {
-  pad_h_ = 0u;
-  clear_has_pad_h();
-}
-inline ::google::protobuf::uint32 PoolingParameter::pad_h() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.pad_h)
-  return pad_h_;
-}
-inline void PoolingParameter::set_pad_h(::google::protobuf::uint32 value) {
-  set_has_pad_h();
-  pad_h_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.pad_h)
-}
-
-// optional uint32 pad_w = 10 [default = 0];
-inline bool PoolingParameter::has_pad_w() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void PoolingParameter::set_has_pad_w() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void PoolingParameter::clear_has_pad_w() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void PoolingParameter::clear_pad_w() {
-  pad_w_ = 0u;
-  clear_has_pad_w();
-}
-inline ::google::protobuf::uint32 PoolingParameter::pad_w() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.pad_w)
-  return pad_w_;
-}
-inline void PoolingParameter::set_pad_w(::google::protobuf::uint32 value) {
-  set_has_pad_w();
-  pad_w_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.pad_w)
-}
-
-// optional uint32 kernel_size = 2;
-inline bool PoolingParameter::has_kernel_size() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void PoolingParameter::set_has_kernel_size() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void PoolingParameter::clear_has_kernel_size() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void PoolingParameter::clear_kernel_size() {
-  kernel_size_ = 0u;
-  clear_has_kernel_size();
-}
-inline ::google::protobuf::uint32 PoolingParameter::kernel_size() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.kernel_size)
-  return kernel_size_;
-}
-inline void PoolingParameter::set_kernel_size(::google::protobuf::uint32 value) {
-  set_has_kernel_size();
-  kernel_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.kernel_size)
-}
-
-// optional uint32 kernel_h = 5;
-inline bool PoolingParameter::has_kernel_h() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void PoolingParameter::set_has_kernel_h() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void PoolingParameter::clear_has_kernel_h() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void PoolingParameter::clear_kernel_h() {
-  kernel_h_ = 0u;
-  clear_has_kernel_h();
-}
-inline ::google::protobuf::uint32 PoolingParameter::kernel_h() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.kernel_h)
-  return kernel_h_;
-}
-inline void PoolingParameter::set_kernel_h(::google::protobuf::uint32 value) {
-  set_has_kernel_h();
-  kernel_h_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.kernel_h)
-}
-
-// optional uint32 kernel_w = 6;
-inline bool PoolingParameter::has_kernel_w() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void PoolingParameter::set_has_kernel_w() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void PoolingParameter::clear_has_kernel_w() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void PoolingParameter::clear_kernel_w() {
-  kernel_w_ = 0u;
-  clear_has_kernel_w();
-}
-inline ::google::protobuf::uint32 PoolingParameter::kernel_w() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.kernel_w)
-  return kernel_w_;
-}
-inline void PoolingParameter::set_kernel_w(::google::protobuf::uint32 value) {
-  set_has_kernel_w();
-  kernel_w_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.kernel_w)
-}
-
-// optional uint32 stride = 3 [default = 1];
-inline bool PoolingParameter::has_stride() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void PoolingParameter::set_has_stride() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void PoolingParameter::clear_has_stride() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void PoolingParameter::clear_stride() {
-  stride_ = 1u;
-  clear_has_stride();
-}
-inline ::google::protobuf::uint32 PoolingParameter::stride() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.stride)
-  return stride_;
-}
-inline void PoolingParameter::set_stride(::google::protobuf::uint32 value) {
-  set_has_stride();
-  stride_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.stride)
-}
-
-// optional uint32 stride_h = 7;
-inline bool PoolingParameter::has_stride_h() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void PoolingParameter::set_has_stride_h() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void PoolingParameter::clear_has_stride_h() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline void PoolingParameter::clear_stride_h() {
-  stride_h_ = 0u;
-  clear_has_stride_h();
-}
-inline ::google::protobuf::uint32 PoolingParameter::stride_h() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.stride_h)
-  return stride_h_;
-}
-inline void PoolingParameter::set_stride_h(::google::protobuf::uint32 value) {
-  set_has_stride_h();
-  stride_h_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.stride_h)
-}
-
-// optional uint32 stride_w = 8;
-inline bool PoolingParameter::has_stride_w() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void PoolingParameter::set_has_stride_w() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void PoolingParameter::clear_has_stride_w() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-inline void PoolingParameter::clear_stride_w() {
-  stride_w_ = 0u;
-  clear_has_stride_w();
-}
-inline ::google::protobuf::uint32 PoolingParameter::stride_w() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.stride_w)
-  return stride_w_;
-}
-inline void PoolingParameter::set_stride_w(::google::protobuf::uint32 value) {
-  set_has_stride_w();
-  stride_w_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.stride_w)
-}
-
-// optional .caffe.PoolingParameter.Engine engine = 11 [default = DEFAULT];
-inline bool PoolingParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void PoolingParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void PoolingParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00000400u;
-}
-inline void PoolingParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::PoolingParameter_Engine PoolingParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.engine)
-  return static_cast< ::caffe::PoolingParameter_Engine >(engine_);
-}
-inline void PoolingParameter::set_engine(::caffe::PoolingParameter_Engine value) {
-  assert(::caffe::PoolingParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.engine)
-}
-
-// optional bool global_pooling = 12 [default = false];
-inline bool PoolingParameter::has_global_pooling() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void PoolingParameter::set_has_global_pooling() {
-  _has_bits_[0] |= 0x00000800u;
-}
-inline void PoolingParameter::clear_has_global_pooling() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-inline void PoolingParameter::clear_global_pooling() {
-  global_pooling_ = false;
-  clear_has_global_pooling();
-}
-inline bool PoolingParameter::global_pooling() const {
-  // @@protoc_insertion_point(field_get:caffe.PoolingParameter.global_pooling)
-  return global_pooling_;
-}
-inline void PoolingParameter::set_global_pooling(bool value) {
-  set_has_global_pooling();
-  global_pooling_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PoolingParameter.global_pooling)
-}
-
-// -------------------------------------------------------------------
-
-// PowerParameter
-
-// optional float power = 1 [default = 1];
-inline bool PowerParameter::has_power() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void PowerParameter::set_has_power() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void PowerParameter::clear_has_power() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void PowerParameter::clear_power() {
-  power_ = 1;
-  clear_has_power();
-}
-inline float PowerParameter::power() const {
-  // @@protoc_insertion_point(field_get:caffe.PowerParameter.power)
-  return power_;
-}
-inline void PowerParameter::set_power(float value) {
-  set_has_power();
-  power_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PowerParameter.power)
-}
-
-// optional float scale = 2 [default = 1];
-inline bool PowerParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void PowerParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void PowerParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void PowerParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float PowerParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.PowerParameter.scale)
-  return scale_;
-}
-inline void PowerParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PowerParameter.scale)
-}
-
-// optional float shift = 3 [default = 0];
-inline bool PowerParameter::has_shift() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void PowerParameter::set_has_shift() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void PowerParameter::clear_has_shift() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void PowerParameter::clear_shift() {
-  shift_ = 0;
-  clear_has_shift();
-}
-inline float PowerParameter::shift() const {
-  // @@protoc_insertion_point(field_get:caffe.PowerParameter.shift)
-  return shift_;
-}
-inline void PowerParameter::set_shift(float value) {
-  set_has_shift();
-  shift_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PowerParameter.shift)
-}
-
-// -------------------------------------------------------------------
-
-// PythonParameter
-
-// optional string module = 1;
-inline bool PythonParameter::has_module() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void PythonParameter::set_has_module() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void PythonParameter::clear_has_module() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void PythonParameter::clear_module() {
-  if (module_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    module_->clear();
-  }
-  clear_has_module();
-}
-inline const ::std::string& PythonParameter::module() const {
-  // @@protoc_insertion_point(field_get:caffe.PythonParameter.module)
-  return *module_;
-}
-inline void PythonParameter::set_module(const ::std::string& value) {
-  set_has_module();
-  if (module_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    module_ = new ::std::string;
-  }
-  module_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.PythonParameter.module)
-}
-inline void PythonParameter::set_module(const char* value) {
-  set_has_module();
-  if (module_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    module_ = new ::std::string;
-  }
-  module_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.PythonParameter.module)
-}
-inline void PythonParameter::set_module(const char* value, size_t size) {
-  set_has_module();
-  if (module_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    module_ = new ::std::string;
-  }
-  module_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.PythonParameter.module)
-}
-inline ::std::string* PythonParameter::mutable_module() {
-  set_has_module();
-  if (module_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    module_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.PythonParameter.module)
-  return module_;
-}
-inline ::std::string* PythonParameter::release_module() {
-  clear_has_module();
-  if (module_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = module_;
-    module_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void PythonParameter::set_allocated_module(::std::string* module) {
-  if (module_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete module_;
-  }
-  if (module) {
-    set_has_module();
-    module_ = module;
-  } else {
-    clear_has_module();
-    module_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.PythonParameter.module)
-}
-
-// optional string layer = 2;
-inline bool PythonParameter::has_layer() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void PythonParameter::set_has_layer() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void PythonParameter::clear_has_layer() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void PythonParameter::clear_layer() {
-  if (layer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    layer_->clear();
-  }
-  clear_has_layer();
-}
-inline const ::std::string& PythonParameter::layer() const {
-  // @@protoc_insertion_point(field_get:caffe.PythonParameter.layer)
-  return *layer_;
-}
-inline void PythonParameter::set_layer(const ::std::string& value) {
-  set_has_layer();
-  if (layer_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    layer_ = new ::std::string;
-  }
-  layer_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.PythonParameter.layer)
-}
-inline void PythonParameter::set_layer(const char* value) {
-  set_has_layer();
-  if (layer_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    layer_ = new ::std::string;
-  }
-  layer_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.PythonParameter.layer)
-}
-inline void PythonParameter::set_layer(const char* value, size_t size) {
-  set_has_layer();
-  if (layer_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    layer_ = new ::std::string;
-  }
-  layer_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.PythonParameter.layer)
-}
-inline ::std::string* PythonParameter::mutable_layer() {
-  set_has_layer();
-  if (layer_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    layer_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.PythonParameter.layer)
-  return layer_;
-}
-inline ::std::string* PythonParameter::release_layer() {
-  clear_has_layer();
-  if (layer_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = layer_;
-    layer_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void PythonParameter::set_allocated_layer(::std::string* layer) {
-  if (layer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete layer_;
-  }
-  if (layer) {
-    set_has_layer();
-    layer_ = layer;
-  } else {
-    clear_has_layer();
-    layer_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.PythonParameter.layer)
-}
-
-// optional string param_str = 3 [default = ""];
-inline bool PythonParameter::has_param_str() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void PythonParameter::set_has_param_str() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void PythonParameter::clear_has_param_str() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void PythonParameter::clear_param_str() {
-  if (param_str_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    param_str_->clear();
-  }
-  clear_has_param_str();
-}
-inline const ::std::string& PythonParameter::param_str() const {
-  // @@protoc_insertion_point(field_get:caffe.PythonParameter.param_str)
-  return *param_str_;
-}
-inline void PythonParameter::set_param_str(const ::std::string& value) {
-  set_has_param_str();
-  if (param_str_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    param_str_ = new ::std::string;
-  }
-  param_str_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.PythonParameter.param_str)
-}
-inline void PythonParameter::set_param_str(const char* value) {
-  set_has_param_str();
-  if (param_str_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    param_str_ = new ::std::string;
-  }
-  param_str_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.PythonParameter.param_str)
-}
-inline void PythonParameter::set_param_str(const char* value, size_t size) {
-  set_has_param_str();
-  if (param_str_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    param_str_ = new ::std::string;
-  }
-  param_str_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.PythonParameter.param_str)
-}
-inline ::std::string* PythonParameter::mutable_param_str() {
-  set_has_param_str();
-  if (param_str_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    param_str_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.PythonParameter.param_str)
-  return param_str_;
-}
-inline ::std::string* PythonParameter::release_param_str() {
-  clear_has_param_str();
-  if (param_str_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = param_str_;
-    param_str_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void PythonParameter::set_allocated_param_str(::std::string* param_str) {
-  if (param_str_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete param_str_;
-  }
-  if (param_str) {
-    set_has_param_str();
-    param_str_ = param_str;
-  } else {
-    clear_has_param_str();
-    param_str_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.PythonParameter.param_str)
-}
-
-// optional bool share_in_parallel = 4 [default = false];
-inline bool PythonParameter::has_share_in_parallel() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void PythonParameter::set_has_share_in_parallel() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void PythonParameter::clear_has_share_in_parallel() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void PythonParameter::clear_share_in_parallel() {
-  share_in_parallel_ = false;
-  clear_has_share_in_parallel();
-}
-inline bool PythonParameter::share_in_parallel() const {
-  // @@protoc_insertion_point(field_get:caffe.PythonParameter.share_in_parallel)
-  return share_in_parallel_;
-}
-inline void PythonParameter::set_share_in_parallel(bool value) {
-  set_has_share_in_parallel();
-  share_in_parallel_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PythonParameter.share_in_parallel)
-}
-
-// -------------------------------------------------------------------
-
-// RecurrentParameter
-
-// optional uint32 num_output = 1 [default = 0];
-inline bool RecurrentParameter::has_num_output() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void RecurrentParameter::set_has_num_output() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void RecurrentParameter::clear_has_num_output() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void RecurrentParameter::clear_num_output() {
-  num_output_ = 0u;
-  clear_has_num_output();
-}
-inline ::google::protobuf::uint32 RecurrentParameter::num_output() const {
-  // @@protoc_insertion_point(field_get:caffe.RecurrentParameter.num_output)
-  return num_output_;
-}
-inline void RecurrentParameter::set_num_output(::google::protobuf::uint32 value) {
-  set_has_num_output();
-  num_output_ = value;
-  // @@protoc_insertion_point(field_set:caffe.RecurrentParameter.num_output)
-}
-
-// optional .caffe.FillerParameter weight_filler = 2;
-inline bool RecurrentParameter::has_weight_filler() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void RecurrentParameter::set_has_weight_filler() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void RecurrentParameter::clear_has_weight_filler() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void RecurrentParameter::clear_weight_filler() {
-  if (weight_filler_ != NULL) weight_filler_->::caffe::FillerParameter::Clear();
-  clear_has_weight_filler();
-}
-inline const ::caffe::FillerParameter& RecurrentParameter::weight_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.RecurrentParameter.weight_filler)
-  return weight_filler_ != NULL ? *weight_filler_ : *default_instance_->weight_filler_;
-}
-inline ::caffe::FillerParameter* RecurrentParameter::mutable_weight_filler() {
-  set_has_weight_filler();
-  if (weight_filler_ == NULL) weight_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.RecurrentParameter.weight_filler)
-  return weight_filler_;
-}
-inline ::caffe::FillerParameter* RecurrentParameter::release_weight_filler() {
-  clear_has_weight_filler();
-  ::caffe::FillerParameter* temp = weight_filler_;
-  weight_filler_ = NULL;
-  return temp;
-}
-inline void RecurrentParameter::set_allocated_weight_filler(::caffe::FillerParameter* weight_filler) {
-  delete weight_filler_;
-  weight_filler_ = weight_filler;
-  if (weight_filler) {
-    set_has_weight_filler();
-  } else {
-    clear_has_weight_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.RecurrentParameter.weight_filler)
-}
-
-// optional .caffe.FillerParameter bias_filler = 3;
-inline bool RecurrentParameter::has_bias_filler() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void RecurrentParameter::set_has_bias_filler() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void RecurrentParameter::clear_has_bias_filler() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void RecurrentParameter::clear_bias_filler() {
-  if (bias_filler_ != NULL) bias_filler_->::caffe::FillerParameter::Clear();
-  clear_has_bias_filler();
-}
-inline const ::caffe::FillerParameter& RecurrentParameter::bias_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.RecurrentParameter.bias_filler)
-  return bias_filler_ != NULL ? *bias_filler_ : *default_instance_->bias_filler_;
-}
-inline ::caffe::FillerParameter* RecurrentParameter::mutable_bias_filler() {
-  set_has_bias_filler();
-  if (bias_filler_ == NULL) bias_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.RecurrentParameter.bias_filler)
-  return bias_filler_;
-}
-inline ::caffe::FillerParameter* RecurrentParameter::release_bias_filler() {
-  clear_has_bias_filler();
-  ::caffe::FillerParameter* temp = bias_filler_;
-  bias_filler_ = NULL;
-  return temp;
-}
-inline void RecurrentParameter::set_allocated_bias_filler(::caffe::FillerParameter* bias_filler) {
-  delete bias_filler_;
-  bias_filler_ = bias_filler;
-  if (bias_filler) {
-    set_has_bias_filler();
-  } else {
-    clear_has_bias_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.RecurrentParameter.bias_filler)
-}
-
-// optional bool debug_info = 4 [default = false];
-inline bool RecurrentParameter::has_debug_info() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void RecurrentParameter::set_has_debug_info() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void RecurrentParameter::clear_has_debug_info() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void RecurrentParameter::clear_debug_info() {
-  debug_info_ = false;
-  clear_has_debug_info();
-}
-inline bool RecurrentParameter::debug_info() const {
-  // @@protoc_insertion_point(field_get:caffe.RecurrentParameter.debug_info)
-  return debug_info_;
-}
-inline void RecurrentParameter::set_debug_info(bool value) {
-  set_has_debug_info();
-  debug_info_ = value;
-  // @@protoc_insertion_point(field_set:caffe.RecurrentParameter.debug_info)
-}
-
-// optional bool expose_hidden = 5 [default = false];
-inline bool RecurrentParameter::has_expose_hidden() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void RecurrentParameter::set_has_expose_hidden() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void RecurrentParameter::clear_has_expose_hidden() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void RecurrentParameter::clear_expose_hidden() {
-  expose_hidden_ = false;
-  clear_has_expose_hidden();
-}
-inline bool RecurrentParameter::expose_hidden() const {
-  // @@protoc_insertion_point(field_get:caffe.RecurrentParameter.expose_hidden)
-  return expose_hidden_;
-}
-inline void RecurrentParameter::set_expose_hidden(bool value) {
-  set_has_expose_hidden();
-  expose_hidden_ = value;
-  // @@protoc_insertion_point(field_set:caffe.RecurrentParameter.expose_hidden)
-}
-
-// -------------------------------------------------------------------
-
-// ReductionParameter
-
-// optional .caffe.ReductionParameter.ReductionOp operation = 1 [default = SUM];
-inline bool ReductionParameter::has_operation() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ReductionParameter::set_has_operation() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ReductionParameter::clear_has_operation() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ReductionParameter::clear_operation() {
-  operation_ = 1;
-  clear_has_operation();
-}
-inline ::caffe::ReductionParameter_ReductionOp ReductionParameter::operation() const {
-  // @@protoc_insertion_point(field_get:caffe.ReductionParameter.operation)
-  return static_cast< ::caffe::ReductionParameter_ReductionOp >(operation_);
-}
-inline void ReductionParameter::set_operation(::caffe::ReductionParameter_ReductionOp value) {
-  assert(::caffe::ReductionParameter_ReductionOp_IsValid(value));
-  set_has_operation();
-  operation_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ReductionParameter.operation)
-}
-
-// optional int32 axis = 2 [default = 0];
-inline bool ReductionParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ReductionParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ReductionParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ReductionParameter::clear_axis() {
-  axis_ = 0;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 ReductionParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.ReductionParameter.axis)
-  return axis_;
-}
-inline void ReductionParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ReductionParameter.axis)
-}
-
-// optional float coeff = 3 [default = 1];
-inline bool ReductionParameter::has_coeff() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ReductionParameter::set_has_coeff() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ReductionParameter::clear_has_coeff() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ReductionParameter::clear_coeff() {
-  coeff_ = 1;
-  clear_has_coeff();
-}
-inline float ReductionParameter::coeff() const {
-  // @@protoc_insertion_point(field_get:caffe.ReductionParameter.coeff)
-  return coeff_;
-}
-inline void ReductionParameter::set_coeff(float value) {
-  set_has_coeff();
-  coeff_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ReductionParameter.coeff)
-}
-
-// -------------------------------------------------------------------
-
-// ReLUParameter
-
-// optional float negative_slope = 1 [default = 0];
-inline bool ReLUParameter::has_negative_slope() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ReLUParameter::set_has_negative_slope() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ReLUParameter::clear_has_negative_slope() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ReLUParameter::clear_negative_slope() {
-  negative_slope_ = 0;
-  clear_has_negative_slope();
-}
-inline float ReLUParameter::negative_slope() const {
-  // @@protoc_insertion_point(field_get:caffe.ReLUParameter.negative_slope)
-  return negative_slope_;
-}
-inline void ReLUParameter::set_negative_slope(float value) {
-  set_has_negative_slope();
-  negative_slope_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ReLUParameter.negative_slope)
-}
-
-// optional .caffe.ReLUParameter.Engine engine = 2 [default = DEFAULT];
-inline bool ReLUParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ReLUParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ReLUParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ReLUParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::ReLUParameter_Engine ReLUParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.ReLUParameter.engine)
-  return static_cast< ::caffe::ReLUParameter_Engine >(engine_);
-}
-inline void ReLUParameter::set_engine(::caffe::ReLUParameter_Engine value) {
-  assert(::caffe::ReLUParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ReLUParameter.engine)
-}
-
-// -------------------------------------------------------------------
-
-// ReshapeParameter
-
-// optional .caffe.BlobShape shape = 1;
-inline bool ReshapeParameter::has_shape() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ReshapeParameter::set_has_shape() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ReshapeParameter::clear_has_shape() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ReshapeParameter::clear_shape() {
-  if (shape_ != NULL) shape_->::caffe::BlobShape::Clear();
-  clear_has_shape();
-}
-inline const ::caffe::BlobShape& ReshapeParameter::shape() const {
-  // @@protoc_insertion_point(field_get:caffe.ReshapeParameter.shape)
-  return shape_ != NULL ? *shape_ : *default_instance_->shape_;
-}
-inline ::caffe::BlobShape* ReshapeParameter::mutable_shape() {
-  set_has_shape();
-  if (shape_ == NULL) shape_ = new ::caffe::BlobShape;
-  // @@protoc_insertion_point(field_mutable:caffe.ReshapeParameter.shape)
-  return shape_;
-}
-inline ::caffe::BlobShape* ReshapeParameter::release_shape() {
-  clear_has_shape();
-  ::caffe::BlobShape* temp = shape_;
-  shape_ = NULL;
-  return temp;
-}
-inline void ReshapeParameter::set_allocated_shape(::caffe::BlobShape* shape) {
-  delete shape_;
-  shape_ = shape;
-  if (shape) {
-    set_has_shape();
-  } else {
-    clear_has_shape();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ReshapeParameter.shape)
-}
-
-// optional int32 axis = 2 [default = 0];
-inline bool ReshapeParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ReshapeParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ReshapeParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ReshapeParameter::clear_axis() {
-  axis_ = 0;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 ReshapeParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.ReshapeParameter.axis)
-  return axis_;
-}
-inline void ReshapeParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ReshapeParameter.axis)
-}
-
-// optional int32 num_axes = 3 [default = -1];
-inline bool ReshapeParameter::has_num_axes() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ReshapeParameter::set_has_num_axes() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ReshapeParameter::clear_has_num_axes() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ReshapeParameter::clear_num_axes() {
-  num_axes_ = -1;
-  clear_has_num_axes();
-}
-inline ::google::protobuf::int32 ReshapeParameter::num_axes() const {
-  // @@protoc_insertion_point(field_get:caffe.ReshapeParameter.num_axes)
-  return num_axes_;
-}
-inline void ReshapeParameter::set_num_axes(::google::protobuf::int32 value) {
-  set_has_num_axes();
-  num_axes_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ReshapeParameter.num_axes)
-}
-
-// -------------------------------------------------------------------
-
-// ScaleParameter
-
-// optional int32 axis = 1 [default = 1];
-inline bool ScaleParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ScaleParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ScaleParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ScaleParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 ScaleParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.ScaleParameter.axis)
-  return axis_;
-}
-inline void ScaleParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ScaleParameter.axis)
-}
-
-// optional int32 num_axes = 2 [default = 1];
-inline bool ScaleParameter::has_num_axes() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ScaleParameter::set_has_num_axes() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void ScaleParameter::clear_has_num_axes() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void ScaleParameter::clear_num_axes() {
-  num_axes_ = 1;
-  clear_has_num_axes();
-}
-inline ::google::protobuf::int32 ScaleParameter::num_axes() const {
-  // @@protoc_insertion_point(field_get:caffe.ScaleParameter.num_axes)
-  return num_axes_;
-}
-inline void ScaleParameter::set_num_axes(::google::protobuf::int32 value) {
-  set_has_num_axes();
-  num_axes_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ScaleParameter.num_axes)
-}
-
-// optional .caffe.FillerParameter filler = 3;
-inline bool ScaleParameter::has_filler() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void ScaleParameter::set_has_filler() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ScaleParameter::clear_has_filler() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void ScaleParameter::clear_filler() {
-  if (filler_ != NULL) filler_->::caffe::FillerParameter::Clear();
-  clear_has_filler();
-}
-inline const ::caffe::FillerParameter& ScaleParameter::filler() const {
-  // @@protoc_insertion_point(field_get:caffe.ScaleParameter.filler)
-  return filler_ != NULL ? *filler_ : *default_instance_->filler_;
-}
-inline ::caffe::FillerParameter* ScaleParameter::mutable_filler() {
-  set_has_filler();
-  if (filler_ == NULL) filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.ScaleParameter.filler)
-  return filler_;
-}
-inline ::caffe::FillerParameter* ScaleParameter::release_filler() {
-  clear_has_filler();
-  ::caffe::FillerParameter* temp = filler_;
-  filler_ = NULL;
-  return temp;
-}
-inline void ScaleParameter::set_allocated_filler(::caffe::FillerParameter* filler) {
-  delete filler_;
-  filler_ = filler;
-  if (filler) {
-    set_has_filler();
-  } else {
-    clear_has_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ScaleParameter.filler)
-}
-
-// optional bool bias_term = 4 [default = false];
-inline bool ScaleParameter::has_bias_term() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void ScaleParameter::set_has_bias_term() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void ScaleParameter::clear_has_bias_term() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void ScaleParameter::clear_bias_term() {
-  bias_term_ = false;
-  clear_has_bias_term();
-}
-inline bool ScaleParameter::bias_term() const {
-  // @@protoc_insertion_point(field_get:caffe.ScaleParameter.bias_term)
-  return bias_term_;
-}
-inline void ScaleParameter::set_bias_term(bool value) {
-  set_has_bias_term();
-  bias_term_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ScaleParameter.bias_term)
-}
-
-// optional .caffe.FillerParameter bias_filler = 5;
-inline bool ScaleParameter::has_bias_filler() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void ScaleParameter::set_has_bias_filler() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void ScaleParameter::clear_has_bias_filler() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void ScaleParameter::clear_bias_filler() {
-  if (bias_filler_ != NULL) bias_filler_->::caffe::FillerParameter::Clear();
-  clear_has_bias_filler();
-}
-inline const ::caffe::FillerParameter& ScaleParameter::bias_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.ScaleParameter.bias_filler)
-  return bias_filler_ != NULL ? *bias_filler_ : *default_instance_->bias_filler_;
-}
-inline ::caffe::FillerParameter* ScaleParameter::mutable_bias_filler() {
-  set_has_bias_filler();
-  if (bias_filler_ == NULL) bias_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.ScaleParameter.bias_filler)
-  return bias_filler_;
-}
-inline ::caffe::FillerParameter* ScaleParameter::release_bias_filler() {
-  clear_has_bias_filler();
-  ::caffe::FillerParameter* temp = bias_filler_;
-  bias_filler_ = NULL;
-  return temp;
-}
-inline void ScaleParameter::set_allocated_bias_filler(::caffe::FillerParameter* bias_filler) {
-  delete bias_filler_;
-  bias_filler_ = bias_filler;
-  if (bias_filler) {
-    set_has_bias_filler();
-  } else {
-    clear_has_bias_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.ScaleParameter.bias_filler)
-}
-
-// -------------------------------------------------------------------
-
-// SigmoidParameter
-
-// optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
-inline bool SigmoidParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SigmoidParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SigmoidParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SigmoidParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::SigmoidParameter_Engine SigmoidParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.SigmoidParameter.engine)
-  return static_cast< ::caffe::SigmoidParameter_Engine >(engine_);
-}
-inline void SigmoidParameter::set_engine(::caffe::SigmoidParameter_Engine value) {
-  assert(::caffe::SigmoidParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SigmoidParameter.engine)
-}
-
-// -------------------------------------------------------------------
-
-// SliceParameter
-
-// optional int32 axis = 3 [default = 1];
-inline bool SliceParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SliceParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SliceParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SliceParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 SliceParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.SliceParameter.axis)
-  return axis_;
-}
-inline void SliceParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SliceParameter.axis)
-}
-
-// repeated uint32 slice_point = 2;
-inline int SliceParameter::slice_point_size() const {
-  return slice_point_.size();
-}
-inline void SliceParameter::clear_slice_point() {
-  slice_point_.Clear();
-}
-inline ::google::protobuf::uint32 SliceParameter::slice_point(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.SliceParameter.slice_point)
-  return slice_point_.Get(index);
-}
-inline void SliceParameter::set_slice_point(int index, ::google::protobuf::uint32 value) {
-  slice_point_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.SliceParameter.slice_point)
-}
-inline void SliceParameter::add_slice_point(::google::protobuf::uint32 value) {
-  slice_point_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.SliceParameter.slice_point)
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-SliceParameter::slice_point() const {
-  // @@protoc_insertion_point(field_list:caffe.SliceParameter.slice_point)
-  return slice_point_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-SliceParameter::mutable_slice_point() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.SliceParameter.slice_point)
-  return &slice_point_;
-}
-
-// optional uint32 slice_dim = 1 [default = 1];
-inline bool SliceParameter::has_slice_dim() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void SliceParameter::set_has_slice_dim() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void SliceParameter::clear_has_slice_dim() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void SliceParameter::clear_slice_dim() {
-  slice_dim_ = 1u;
-  clear_has_slice_dim();
-}
-inline ::google::protobuf::uint32 SliceParameter::slice_dim() const {
-  // @@protoc_insertion_point(field_get:caffe.SliceParameter.slice_dim)
-  return slice_dim_;
-}
-inline void SliceParameter::set_slice_dim(::google::protobuf::uint32 value) {
-  set_has_slice_dim();
-  slice_dim_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SliceParameter.slice_dim)
-}
-
-// -------------------------------------------------------------------
-
-// SoftmaxParameter
-
-// optional .caffe.SoftmaxParameter.Engine engine = 1 [default = DEFAULT];
-inline bool SoftmaxParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SoftmaxParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SoftmaxParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SoftmaxParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::SoftmaxParameter_Engine SoftmaxParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.SoftmaxParameter.engine)
-  return static_cast< ::caffe::SoftmaxParameter_Engine >(engine_);
-}
-inline void SoftmaxParameter::set_engine(::caffe::SoftmaxParameter_Engine value) {
-  assert(::caffe::SoftmaxParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SoftmaxParameter.engine)
-}
-
-// optional int32 axis = 2 [default = 1];
-inline bool SoftmaxParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SoftmaxParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SoftmaxParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void SoftmaxParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 SoftmaxParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.SoftmaxParameter.axis)
-  return axis_;
-}
-inline void SoftmaxParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SoftmaxParameter.axis)
-}
-
-// -------------------------------------------------------------------
-
-// TanHParameter
-
-// optional .caffe.TanHParameter.Engine engine = 1 [default = DEFAULT];
-inline bool TanHParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TanHParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TanHParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void TanHParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::TanHParameter_Engine TanHParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.TanHParameter.engine)
-  return static_cast< ::caffe::TanHParameter_Engine >(engine_);
-}
-inline void TanHParameter::set_engine(::caffe::TanHParameter_Engine value) {
-  assert(::caffe::TanHParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TanHParameter.engine)
-}
-
-// -------------------------------------------------------------------
-
-// TileParameter
-
-// optional int32 axis = 1 [default = 1];
-inline bool TileParameter::has_axis() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TileParameter::set_has_axis() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TileParameter::clear_has_axis() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void TileParameter::clear_axis() {
-  axis_ = 1;
-  clear_has_axis();
-}
-inline ::google::protobuf::int32 TileParameter::axis() const {
-  // @@protoc_insertion_point(field_get:caffe.TileParameter.axis)
-  return axis_;
-}
-inline void TileParameter::set_axis(::google::protobuf::int32 value) {
-  set_has_axis();
-  axis_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TileParameter.axis)
-}
-
-// optional int32 tiles = 2;
-inline bool TileParameter::has_tiles() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TileParameter::set_has_tiles() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TileParameter::clear_has_tiles() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void TileParameter::clear_tiles() {
-  tiles_ = 0;
-  clear_has_tiles();
-}
-inline ::google::protobuf::int32 TileParameter::tiles() const {
-  // @@protoc_insertion_point(field_get:caffe.TileParameter.tiles)
-  return tiles_;
-}
-inline void TileParameter::set_tiles(::google::protobuf::int32 value) {
-  set_has_tiles();
-  tiles_ = value;
-  // @@protoc_insertion_point(field_set:caffe.TileParameter.tiles)
-}
-
-// -------------------------------------------------------------------
-
-// ThresholdParameter
-
-// optional float threshold = 1 [default = 0];
-inline bool ThresholdParameter::has_threshold() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ThresholdParameter::set_has_threshold() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ThresholdParameter::clear_has_threshold() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void ThresholdParameter::clear_threshold() {
-  threshold_ = 0;
-  clear_has_threshold();
-}
-inline float ThresholdParameter::threshold() const {
-  // @@protoc_insertion_point(field_get:caffe.ThresholdParameter.threshold)
-  return threshold_;
-}
-inline void ThresholdParameter::set_threshold(float value) {
-  set_has_threshold();
-  threshold_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ThresholdParameter.threshold)
-}
-
-// -------------------------------------------------------------------
-
-// WindowDataParameter
-
-// optional string source = 1;
-inline bool WindowDataParameter::has_source() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void WindowDataParameter::set_has_source() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void WindowDataParameter::clear_has_source() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void WindowDataParameter::clear_source() {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_->clear();
-  }
-  clear_has_source();
-}
-inline const ::std::string& WindowDataParameter::source() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.source)
-  return *source_;
-}
-inline void WindowDataParameter::set_source(const ::std::string& value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.source)
-}
-inline void WindowDataParameter::set_source(const char* value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.WindowDataParameter.source)
-}
-inline void WindowDataParameter::set_source(const char* value, size_t size) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.WindowDataParameter.source)
-}
-inline ::std::string* WindowDataParameter::mutable_source() {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.WindowDataParameter.source)
-  return source_;
-}
-inline ::std::string* WindowDataParameter::release_source() {
-  clear_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = source_;
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void WindowDataParameter::set_allocated_source(::std::string* source) {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete source_;
-  }
-  if (source) {
-    set_has_source();
-    source_ = source;
-  } else {
-    clear_has_source();
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.WindowDataParameter.source)
-}
-
-// optional float scale = 2 [default = 1];
-inline bool WindowDataParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void WindowDataParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void WindowDataParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void WindowDataParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float WindowDataParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.scale)
-  return scale_;
-}
-inline void WindowDataParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.scale)
-}
-
-// optional string mean_file = 3;
-inline bool WindowDataParameter::has_mean_file() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void WindowDataParameter::set_has_mean_file() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void WindowDataParameter::clear_has_mean_file() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void WindowDataParameter::clear_mean_file() {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_->clear();
-  }
-  clear_has_mean_file();
-}
-inline const ::std::string& WindowDataParameter::mean_file() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.mean_file)
-  return *mean_file_;
-}
-inline void WindowDataParameter::set_mean_file(const ::std::string& value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.mean_file)
-}
-inline void WindowDataParameter::set_mean_file(const char* value) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.WindowDataParameter.mean_file)
-}
-inline void WindowDataParameter::set_mean_file(const char* value, size_t size) {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  mean_file_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.WindowDataParameter.mean_file)
-}
-inline ::std::string* WindowDataParameter::mutable_mean_file() {
-  set_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    mean_file_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.WindowDataParameter.mean_file)
-  return mean_file_;
-}
-inline ::std::string* WindowDataParameter::release_mean_file() {
-  clear_has_mean_file();
-  if (mean_file_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = mean_file_;
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void WindowDataParameter::set_allocated_mean_file(::std::string* mean_file) {
-  if (mean_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete mean_file_;
-  }
-  if (mean_file) {
-    set_has_mean_file();
-    mean_file_ = mean_file;
-  } else {
-    clear_has_mean_file();
-    mean_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.WindowDataParameter.mean_file)
-}
-
-// optional uint32 batch_size = 4;
-inline bool WindowDataParameter::has_batch_size() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void WindowDataParameter::set_has_batch_size() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void WindowDataParameter::clear_has_batch_size() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void WindowDataParameter::clear_batch_size() {
-  batch_size_ = 0u;
-  clear_has_batch_size();
-}
-inline ::google::protobuf::uint32 WindowDataParameter::batch_size() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.batch_size)
-  return batch_size_;
-}
-inline void WindowDataParameter::set_batch_size(::google::protobuf::uint32 value) {
-  set_has_batch_size();
-  batch_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.batch_size)
-}
-
-// optional uint32 crop_size = 5 [default = 0];
-inline bool WindowDataParameter::has_crop_size() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void WindowDataParameter::set_has_crop_size() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void WindowDataParameter::clear_has_crop_size() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void WindowDataParameter::clear_crop_size() {
-  crop_size_ = 0u;
-  clear_has_crop_size();
-}
-inline ::google::protobuf::uint32 WindowDataParameter::crop_size() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.crop_size)
-  return crop_size_;
-}
-inline void WindowDataParameter::set_crop_size(::google::protobuf::uint32 value) {
-  set_has_crop_size();
-  crop_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.crop_size)
-}
-
-// optional bool mirror = 6 [default = false];
-inline bool WindowDataParameter::has_mirror() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void WindowDataParameter::set_has_mirror() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void WindowDataParameter::clear_has_mirror() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void WindowDataParameter::clear_mirror() {
-  mirror_ = false;
-  clear_has_mirror();
-}
-inline bool WindowDataParameter::mirror() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.mirror)
-  return mirror_;
-}
-inline void WindowDataParameter::set_mirror(bool value) {
-  set_has_mirror();
-  mirror_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.mirror)
-}
-
-// optional float fg_threshold = 7 [default = 0.5];
-inline bool WindowDataParameter::has_fg_threshold() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void WindowDataParameter::set_has_fg_threshold() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void WindowDataParameter::clear_has_fg_threshold() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void WindowDataParameter::clear_fg_threshold() {
-  fg_threshold_ = 0.5f;
-  clear_has_fg_threshold();
-}
-inline float WindowDataParameter::fg_threshold() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.fg_threshold)
-  return fg_threshold_;
-}
-inline void WindowDataParameter::set_fg_threshold(float value) {
-  set_has_fg_threshold();
-  fg_threshold_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.fg_threshold)
-}
-
-// optional float bg_threshold = 8 [default = 0.5];
-inline bool WindowDataParameter::has_bg_threshold() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void WindowDataParameter::set_has_bg_threshold() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void WindowDataParameter::clear_has_bg_threshold() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void WindowDataParameter::clear_bg_threshold() {
-  bg_threshold_ = 0.5f;
-  clear_has_bg_threshold();
-}
-inline float WindowDataParameter::bg_threshold() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.bg_threshold)
-  return bg_threshold_;
-}
-inline void WindowDataParameter::set_bg_threshold(float value) {
-  set_has_bg_threshold();
-  bg_threshold_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.bg_threshold)
-}
-
-// optional float fg_fraction = 9 [default = 0.25];
-inline bool WindowDataParameter::has_fg_fraction() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void WindowDataParameter::set_has_fg_fraction() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void WindowDataParameter::clear_has_fg_fraction() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline void WindowDataParameter::clear_fg_fraction() {
-  fg_fraction_ = 0.25f;
-  clear_has_fg_fraction();
-}
-inline float WindowDataParameter::fg_fraction() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.fg_fraction)
-  return fg_fraction_;
-}
-inline void WindowDataParameter::set_fg_fraction(float value) {
-  set_has_fg_fraction();
-  fg_fraction_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.fg_fraction)
-}
-
-// optional uint32 context_pad = 10 [default = 0];
-inline bool WindowDataParameter::has_context_pad() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void WindowDataParameter::set_has_context_pad() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void WindowDataParameter::clear_has_context_pad() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-inline void WindowDataParameter::clear_context_pad() {
-  context_pad_ = 0u;
-  clear_has_context_pad();
-}
-inline ::google::protobuf::uint32 WindowDataParameter::context_pad() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.context_pad)
-  return context_pad_;
-}
-inline void WindowDataParameter::set_context_pad(::google::protobuf::uint32 value) {
-  set_has_context_pad();
-  context_pad_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.context_pad)
-}
-
-// optional string crop_mode = 11 [default = "warp"];
-inline bool WindowDataParameter::has_crop_mode() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void WindowDataParameter::set_has_crop_mode() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void WindowDataParameter::clear_has_crop_mode() {
-  _has_bits_[0] &= ~0x00000400u;
-}
-inline void WindowDataParameter::clear_crop_mode() {
-  if (crop_mode_ != _default_crop_mode_) {
-    crop_mode_->assign(*_default_crop_mode_);
-  }
-  clear_has_crop_mode();
-}
-inline const ::std::string& WindowDataParameter::crop_mode() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.crop_mode)
-  return *crop_mode_;
-}
-inline void WindowDataParameter::set_crop_mode(const ::std::string& value) {
-  set_has_crop_mode();
-  if (crop_mode_ == _default_crop_mode_) {
-    crop_mode_ = new ::std::string;
-  }
-  crop_mode_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.crop_mode)
-}
-inline void WindowDataParameter::set_crop_mode(const char* value) {
-  set_has_crop_mode();
-  if (crop_mode_ == _default_crop_mode_) {
-    crop_mode_ = new ::std::string;
-  }
-  crop_mode_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.WindowDataParameter.crop_mode)
-}
-inline void WindowDataParameter::set_crop_mode(const char* value, size_t size) {
-  set_has_crop_mode();
-  if (crop_mode_ == _default_crop_mode_) {
-    crop_mode_ = new ::std::string;
-  }
-  crop_mode_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.WindowDataParameter.crop_mode)
-}
-inline ::std::string* WindowDataParameter::mutable_crop_mode() {
-  set_has_crop_mode();
-  if (crop_mode_ == _default_crop_mode_) {
-    crop_mode_ = new ::std::string(*_default_crop_mode_);
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.WindowDataParameter.crop_mode)
-  return crop_mode_;
-}
-inline ::std::string* WindowDataParameter::release_crop_mode() {
-  clear_has_crop_mode();
-  if (crop_mode_ == _default_crop_mode_) {
-    return NULL;
-  } else {
-    ::std::string* temp = crop_mode_;
-    crop_mode_ = const_cast< ::std::string*>(_default_crop_mode_);
-    return temp;
-  }
-}
-inline void WindowDataParameter::set_allocated_crop_mode(::std::string* crop_mode) {
-  if (crop_mode_ != _default_crop_mode_) {
-    delete crop_mode_;
-  }
-  if (crop_mode) {
-    set_has_crop_mode();
-    crop_mode_ = crop_mode;
-  } else {
-    clear_has_crop_mode();
-    crop_mode_ = const_cast< ::std::string*>(_default_crop_mode_);
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.WindowDataParameter.crop_mode)
-}
-
-// optional bool cache_images = 12 [default = false];
-inline bool WindowDataParameter::has_cache_images() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void WindowDataParameter::set_has_cache_images() {
-  _has_bits_[0] |= 0x00000800u;
-}
-inline void WindowDataParameter::clear_has_cache_images() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-inline void WindowDataParameter::clear_cache_images() {
-  cache_images_ = false;
-  clear_has_cache_images();
-}
-inline bool WindowDataParameter::cache_images() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.cache_images)
-  return cache_images_;
-}
-inline void WindowDataParameter::set_cache_images(bool value) {
-  set_has_cache_images();
-  cache_images_ = value;
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.cache_images)
-}
-
-// optional string root_folder = 13 [default = ""];
-inline bool WindowDataParameter::has_root_folder() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-inline void WindowDataParameter::set_has_root_folder() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void WindowDataParameter::clear_has_root_folder() {
-  _has_bits_[0] &= ~0x00001000u;
-}
-inline void WindowDataParameter::clear_root_folder() {
-  if (root_folder_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_->clear();
-  }
-  clear_has_root_folder();
-}
-inline const ::std::string& WindowDataParameter::root_folder() const {
-  // @@protoc_insertion_point(field_get:caffe.WindowDataParameter.root_folder)
-  return *root_folder_;
-}
-inline void WindowDataParameter::set_root_folder(const ::std::string& value) {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  root_folder_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.WindowDataParameter.root_folder)
-}
-inline void WindowDataParameter::set_root_folder(const char* value) {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  root_folder_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.WindowDataParameter.root_folder)
-}
-inline void WindowDataParameter::set_root_folder(const char* value, size_t size) {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  root_folder_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.WindowDataParameter.root_folder)
-}
-inline ::std::string* WindowDataParameter::mutable_root_folder() {
-  set_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    root_folder_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.WindowDataParameter.root_folder)
-  return root_folder_;
-}
-inline ::std::string* WindowDataParameter::release_root_folder() {
-  clear_has_root_folder();
-  if (root_folder_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = root_folder_;
-    root_folder_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void WindowDataParameter::set_allocated_root_folder(::std::string* root_folder) {
-  if (root_folder_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete root_folder_;
-  }
-  if (root_folder) {
-    set_has_root_folder();
-    root_folder_ = root_folder;
-  } else {
-    clear_has_root_folder();
-    root_folder_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.WindowDataParameter.root_folder)
-}
-
-// -------------------------------------------------------------------
-
-// SPPParameter
-
-// optional uint32 pyramid_height = 1;
-inline bool SPPParameter::has_pyramid_height() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SPPParameter::set_has_pyramid_height() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SPPParameter::clear_has_pyramid_height() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SPPParameter::clear_pyramid_height() {
-  pyramid_height_ = 0u;
-  clear_has_pyramid_height();
-}
-inline ::google::protobuf::uint32 SPPParameter::pyramid_height() const {
-  // @@protoc_insertion_point(field_get:caffe.SPPParameter.pyramid_height)
-  return pyramid_height_;
-}
-inline void SPPParameter::set_pyramid_height(::google::protobuf::uint32 value) {
-  set_has_pyramid_height();
-  pyramid_height_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SPPParameter.pyramid_height)
-}
-
-// optional .caffe.SPPParameter.PoolMethod pool = 2 [default = MAX];
-inline bool SPPParameter::has_pool() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SPPParameter::set_has_pool() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SPPParameter::clear_has_pool() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void SPPParameter::clear_pool() {
-  pool_ = 0;
-  clear_has_pool();
-}
-inline ::caffe::SPPParameter_PoolMethod SPPParameter::pool() const {
-  // @@protoc_insertion_point(field_get:caffe.SPPParameter.pool)
-  return static_cast< ::caffe::SPPParameter_PoolMethod >(pool_);
-}
-inline void SPPParameter::set_pool(::caffe::SPPParameter_PoolMethod value) {
-  assert(::caffe::SPPParameter_PoolMethod_IsValid(value));
-  set_has_pool();
-  pool_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SPPParameter.pool)
-}
-
-// optional .caffe.SPPParameter.Engine engine = 6 [default = DEFAULT];
-inline bool SPPParameter::has_engine() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void SPPParameter::set_has_engine() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void SPPParameter::clear_has_engine() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void SPPParameter::clear_engine() {
-  engine_ = 0;
-  clear_has_engine();
-}
-inline ::caffe::SPPParameter_Engine SPPParameter::engine() const {
-  // @@protoc_insertion_point(field_get:caffe.SPPParameter.engine)
-  return static_cast< ::caffe::SPPParameter_Engine >(engine_);
-}
-inline void SPPParameter::set_engine(::caffe::SPPParameter_Engine value) {
-  assert(::caffe::SPPParameter_Engine_IsValid(value));
-  set_has_engine();
-  engine_ = value;
-  // @@protoc_insertion_point(field_set:caffe.SPPParameter.engine)
-}
-
-// -------------------------------------------------------------------
-
-// V1LayerParameter
-
-// repeated string bottom = 2;
-inline int V1LayerParameter::bottom_size() const {
-  return bottom_.size();
-}
-inline void V1LayerParameter::clear_bottom() {
-  bottom_.Clear();
-}
-inline const ::std::string& V1LayerParameter::bottom(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.bottom)
-  return bottom_.Get(index);
-}
-inline ::std::string* V1LayerParameter::mutable_bottom(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.bottom)
-  return bottom_.Mutable(index);
-}
-inline void V1LayerParameter::set_bottom(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.bottom)
-  bottom_.Mutable(index)->assign(value);
-}
-inline void V1LayerParameter::set_bottom(int index, const char* value) {
-  bottom_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V1LayerParameter.bottom)
-}
-inline void V1LayerParameter::set_bottom(int index, const char* value, size_t size) {
-  bottom_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V1LayerParameter.bottom)
-}
-inline ::std::string* V1LayerParameter::add_bottom() {
-  return bottom_.Add();
-}
-inline void V1LayerParameter::add_bottom(const ::std::string& value) {
-  bottom_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.bottom)
-}
-inline void V1LayerParameter::add_bottom(const char* value) {
-  bottom_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.V1LayerParameter.bottom)
-}
-inline void V1LayerParameter::add_bottom(const char* value, size_t size) {
-  bottom_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.V1LayerParameter.bottom)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-V1LayerParameter::bottom() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.bottom)
-  return bottom_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-V1LayerParameter::mutable_bottom() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.bottom)
-  return &bottom_;
-}
-
-// repeated string top = 3;
-inline int V1LayerParameter::top_size() const {
-  return top_.size();
-}
-inline void V1LayerParameter::clear_top() {
-  top_.Clear();
-}
-inline const ::std::string& V1LayerParameter::top(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.top)
-  return top_.Get(index);
-}
-inline ::std::string* V1LayerParameter::mutable_top(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.top)
-  return top_.Mutable(index);
-}
-inline void V1LayerParameter::set_top(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.top)
-  top_.Mutable(index)->assign(value);
-}
-inline void V1LayerParameter::set_top(int index, const char* value) {
-  top_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V1LayerParameter.top)
-}
-inline void V1LayerParameter::set_top(int index, const char* value, size_t size) {
-  top_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V1LayerParameter.top)
-}
-inline ::std::string* V1LayerParameter::add_top() {
-  return top_.Add();
-}
-inline void V1LayerParameter::add_top(const ::std::string& value) {
-  top_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.top)
-}
-inline void V1LayerParameter::add_top(const char* value) {
-  top_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.V1LayerParameter.top)
-}
-inline void V1LayerParameter::add_top(const char* value, size_t size) {
-  top_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.V1LayerParameter.top)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-V1LayerParameter::top() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.top)
-  return top_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-V1LayerParameter::mutable_top() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.top)
-  return &top_;
-}
-
-// optional string name = 4;
-inline bool V1LayerParameter::has_name() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void V1LayerParameter::set_has_name() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void V1LayerParameter::clear_has_name() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void V1LayerParameter::clear_name() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& V1LayerParameter::name() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.name)
-  return *name_;
-}
-inline void V1LayerParameter::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.name)
-}
-inline void V1LayerParameter::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V1LayerParameter.name)
-}
-inline void V1LayerParameter::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V1LayerParameter.name)
-}
-inline ::std::string* V1LayerParameter::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.name)
-  return name_;
-}
-inline ::std::string* V1LayerParameter::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void V1LayerParameter::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.name)
-}
-
-// repeated .caffe.NetStateRule include = 32;
-inline int V1LayerParameter::include_size() const {
-  return include_.size();
-}
-inline void V1LayerParameter::clear_include() {
-  include_.Clear();
-}
-inline const ::caffe::NetStateRule& V1LayerParameter::include(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.include)
-  return include_.Get(index);
-}
-inline ::caffe::NetStateRule* V1LayerParameter::mutable_include(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.include)
-  return include_.Mutable(index);
-}
-inline ::caffe::NetStateRule* V1LayerParameter::add_include() {
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.include)
-  return include_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-V1LayerParameter::include() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.include)
-  return include_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-V1LayerParameter::mutable_include() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.include)
-  return &include_;
-}
-
-// repeated .caffe.NetStateRule exclude = 33;
-inline int V1LayerParameter::exclude_size() const {
-  return exclude_.size();
-}
-inline void V1LayerParameter::clear_exclude() {
-  exclude_.Clear();
-}
-inline const ::caffe::NetStateRule& V1LayerParameter::exclude(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.exclude)
-  return exclude_.Get(index);
-}
-inline ::caffe::NetStateRule* V1LayerParameter::mutable_exclude(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.exclude)
-  return exclude_.Mutable(index);
-}
-inline ::caffe::NetStateRule* V1LayerParameter::add_exclude() {
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.exclude)
-  return exclude_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-V1LayerParameter::exclude() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.exclude)
-  return exclude_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
-V1LayerParameter::mutable_exclude() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.exclude)
-  return &exclude_;
-}
-
-// optional .caffe.V1LayerParameter.LayerType type = 5;
-inline bool V1LayerParameter::has_type() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void V1LayerParameter::set_has_type() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void V1LayerParameter::clear_has_type() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void V1LayerParameter::clear_type() {
-  type_ = 0;
-  clear_has_type();
-}
-inline ::caffe::V1LayerParameter_LayerType V1LayerParameter::type() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.type)
-  return static_cast< ::caffe::V1LayerParameter_LayerType >(type_);
-}
-inline void V1LayerParameter::set_type(::caffe::V1LayerParameter_LayerType value) {
-  assert(::caffe::V1LayerParameter_LayerType_IsValid(value));
-  set_has_type();
-  type_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.type)
-}
-
-// repeated .caffe.BlobProto blobs = 6;
-inline int V1LayerParameter::blobs_size() const {
-  return blobs_.size();
-}
-inline void V1LayerParameter::clear_blobs() {
-  blobs_.Clear();
-}
-inline const ::caffe::BlobProto& V1LayerParameter::blobs(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.blobs)
-  return blobs_.Get(index);
-}
-inline ::caffe::BlobProto* V1LayerParameter::mutable_blobs(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.blobs)
-  return blobs_.Mutable(index);
-}
-inline ::caffe::BlobProto* V1LayerParameter::add_blobs() {
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.blobs)
-  return blobs_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-V1LayerParameter::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.blobs)
-  return blobs_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-V1LayerParameter::mutable_blobs() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.blobs)
-  return &blobs_;
-}
-
-// repeated string param = 1001;
-inline int V1LayerParameter::param_size() const {
-  return param_.size();
-}
-inline void V1LayerParameter::clear_param() {
-  param_.Clear();
-}
-inline const ::std::string& V1LayerParameter::param(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.param)
-  return param_.Get(index);
-}
-inline ::std::string* V1LayerParameter::mutable_param(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.param)
-  return param_.Mutable(index);
-}
-inline void V1LayerParameter::set_param(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.param)
-  param_.Mutable(index)->assign(value);
-}
-inline void V1LayerParameter::set_param(int index, const char* value) {
-  param_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V1LayerParameter.param)
-}
-inline void V1LayerParameter::set_param(int index, const char* value, size_t size) {
-  param_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V1LayerParameter.param)
-}
-inline ::std::string* V1LayerParameter::add_param() {
-  return param_.Add();
-}
-inline void V1LayerParameter::add_param(const ::std::string& value) {
-  param_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.param)
-}
-inline void V1LayerParameter::add_param(const char* value) {
-  param_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:caffe.V1LayerParameter.param)
-}
-inline void V1LayerParameter::add_param(const char* value, size_t size) {
-  param_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:caffe.V1LayerParameter.param)
-}
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-V1LayerParameter::param() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.param)
-  return param_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-V1LayerParameter::mutable_param() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.param)
-  return &param_;
-}
-
-// repeated .caffe.V1LayerParameter.DimCheckMode blob_share_mode = 1002;
-inline int V1LayerParameter::blob_share_mode_size() const {
-  return blob_share_mode_.size();
-}
-inline void V1LayerParameter::clear_blob_share_mode() {
-  blob_share_mode_.Clear();
-}
-inline ::caffe::V1LayerParameter_DimCheckMode V1LayerParameter::blob_share_mode(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.blob_share_mode)
-  return static_cast< ::caffe::V1LayerParameter_DimCheckMode >(blob_share_mode_.Get(index));
-}
-inline void V1LayerParameter::set_blob_share_mode(int index, ::caffe::V1LayerParameter_DimCheckMode value) {
-  assert(::caffe::V1LayerParameter_DimCheckMode_IsValid(value));
-  blob_share_mode_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.blob_share_mode)
-}
-inline void V1LayerParameter::add_blob_share_mode(::caffe::V1LayerParameter_DimCheckMode value) {
-  assert(::caffe::V1LayerParameter_DimCheckMode_IsValid(value));
-  blob_share_mode_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.blob_share_mode)
-}
-inline const ::google::protobuf::RepeatedField<int>&
-V1LayerParameter::blob_share_mode() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.blob_share_mode)
-  return blob_share_mode_;
-}
-inline ::google::protobuf::RepeatedField<int>*
-V1LayerParameter::mutable_blob_share_mode() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.blob_share_mode)
-  return &blob_share_mode_;
-}
-
-// repeated float blobs_lr = 7;
-inline int V1LayerParameter::blobs_lr_size() const {
-  return blobs_lr_.size();
-}
-inline void V1LayerParameter::clear_blobs_lr() {
-  blobs_lr_.Clear();
-}
-inline float V1LayerParameter::blobs_lr(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.blobs_lr)
-  return blobs_lr_.Get(index);
-}
-inline void V1LayerParameter::set_blobs_lr(int index, float value) {
-  blobs_lr_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.blobs_lr)
-}
-inline void V1LayerParameter::add_blobs_lr(float value) {
-  blobs_lr_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.blobs_lr)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-V1LayerParameter::blobs_lr() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.blobs_lr)
-  return blobs_lr_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-V1LayerParameter::mutable_blobs_lr() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.blobs_lr)
-  return &blobs_lr_;
-}
-
-// repeated float weight_decay = 8;
-inline int V1LayerParameter::weight_decay_size() const {
-  return weight_decay_.size();
-}
-inline void V1LayerParameter::clear_weight_decay() {
-  weight_decay_.Clear();
-}
-inline float V1LayerParameter::weight_decay(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.weight_decay)
-  return weight_decay_.Get(index);
-}
-inline void V1LayerParameter::set_weight_decay(int index, float value) {
-  weight_decay_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.weight_decay)
-}
-inline void V1LayerParameter::add_weight_decay(float value) {
-  weight_decay_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.weight_decay)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-V1LayerParameter::weight_decay() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.weight_decay)
-  return weight_decay_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-V1LayerParameter::mutable_weight_decay() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.weight_decay)
-  return &weight_decay_;
-}
-
-// repeated float loss_weight = 35;
-inline int V1LayerParameter::loss_weight_size() const {
-  return loss_weight_.size();
-}
-inline void V1LayerParameter::clear_loss_weight() {
-  loss_weight_.Clear();
-}
-inline float V1LayerParameter::loss_weight(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.loss_weight)
-  return loss_weight_.Get(index);
-}
-inline void V1LayerParameter::set_loss_weight(int index, float value) {
-  loss_weight_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.V1LayerParameter.loss_weight)
-}
-inline void V1LayerParameter::add_loss_weight(float value) {
-  loss_weight_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.loss_weight)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-V1LayerParameter::loss_weight() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.loss_weight)
-  return loss_weight_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-V1LayerParameter::mutable_loss_weight() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.loss_weight)
-  return &loss_weight_;
-}
-
-// optional .caffe.AccuracyParameter accuracy_param = 27;
-inline bool V1LayerParameter::has_accuracy_param() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-inline void V1LayerParameter::set_has_accuracy_param() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void V1LayerParameter::clear_has_accuracy_param() {
-  _has_bits_[0] &= ~0x00001000u;
-}
-inline void V1LayerParameter::clear_accuracy_param() {
-  if (accuracy_param_ != NULL) accuracy_param_->::caffe::AccuracyParameter::Clear();
-  clear_has_accuracy_param();
-}
-inline const ::caffe::AccuracyParameter& V1LayerParameter::accuracy_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.accuracy_param)
-  return accuracy_param_ != NULL ? *accuracy_param_ : *default_instance_->accuracy_param_;
-}
-inline ::caffe::AccuracyParameter* V1LayerParameter::mutable_accuracy_param() {
-  set_has_accuracy_param();
-  if (accuracy_param_ == NULL) accuracy_param_ = new ::caffe::AccuracyParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.accuracy_param)
-  return accuracy_param_;
-}
-inline ::caffe::AccuracyParameter* V1LayerParameter::release_accuracy_param() {
-  clear_has_accuracy_param();
-  ::caffe::AccuracyParameter* temp = accuracy_param_;
-  accuracy_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_accuracy_param(::caffe::AccuracyParameter* accuracy_param) {
-  delete accuracy_param_;
-  accuracy_param_ = accuracy_param;
-  if (accuracy_param) {
-    set_has_accuracy_param();
-  } else {
-    clear_has_accuracy_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.accuracy_param)
-}
-
-// optional .caffe.ArgMaxParameter argmax_param = 23;
-inline bool V1LayerParameter::has_argmax_param() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void V1LayerParameter::set_has_argmax_param() {
-  _has_bits_[0] |= 0x00002000u;
-}
-inline void V1LayerParameter::clear_has_argmax_param() {
-  _has_bits_[0] &= ~0x00002000u;
-}
-inline void V1LayerParameter::clear_argmax_param() {
-  if (argmax_param_ != NULL) argmax_param_->::caffe::ArgMaxParameter::Clear();
-  clear_has_argmax_param();
-}
-inline const ::caffe::ArgMaxParameter& V1LayerParameter::argmax_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.argmax_param)
-  return argmax_param_ != NULL ? *argmax_param_ : *default_instance_->argmax_param_;
-}
-inline ::caffe::ArgMaxParameter* V1LayerParameter::mutable_argmax_param() {
-  set_has_argmax_param();
-  if (argmax_param_ == NULL) argmax_param_ = new ::caffe::ArgMaxParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.argmax_param)
-  return argmax_param_;
-}
-inline ::caffe::ArgMaxParameter* V1LayerParameter::release_argmax_param() {
-  clear_has_argmax_param();
-  ::caffe::ArgMaxParameter* temp = argmax_param_;
-  argmax_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_argmax_param(::caffe::ArgMaxParameter* argmax_param) {
-  delete argmax_param_;
-  argmax_param_ = argmax_param;
-  if (argmax_param) {
-    set_has_argmax_param();
-  } else {
-    clear_has_argmax_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.argmax_param)
-}
-
-// optional .caffe.ConcatParameter concat_param = 9;
-inline bool V1LayerParameter::has_concat_param() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
-}
-inline void V1LayerParameter::set_has_concat_param() {
-  _has_bits_[0] |= 0x00004000u;
-}
-inline void V1LayerParameter::clear_has_concat_param() {
-  _has_bits_[0] &= ~0x00004000u;
-}
-inline void V1LayerParameter::clear_concat_param() {
-  if (concat_param_ != NULL) concat_param_->::caffe::ConcatParameter::Clear();
-  clear_has_concat_param();
-}
-inline const ::caffe::ConcatParameter& V1LayerParameter::concat_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.concat_param)
-  return concat_param_ != NULL ? *concat_param_ : *default_instance_->concat_param_;
-}
-inline ::caffe::ConcatParameter* V1LayerParameter::mutable_concat_param() {
-  set_has_concat_param();
-  if (concat_param_ == NULL) concat_param_ = new ::caffe::ConcatParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.concat_param)
-  return concat_param_;
-}
-inline ::caffe::ConcatParameter* V1LayerParameter::release_concat_param() {
-  clear_has_concat_param();
-  ::caffe::ConcatParameter* temp = concat_param_;
-  concat_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_concat_param(::caffe::ConcatParameter* concat_param) {
-  delete concat_param_;
-  concat_param_ = concat_param;
-  if (concat_param) {
-    set_has_concat_param();
-  } else {
-    clear_has_concat_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.concat_param)
-}
-
-// optional .caffe.ContrastiveLossParameter contrastive_loss_param = 40;
-inline bool V1LayerParameter::has_contrastive_loss_param() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-inline void V1LayerParameter::set_has_contrastive_loss_param() {
-  _has_bits_[0] |= 0x00008000u;
-}
-inline void V1LayerParameter::clear_has_contrastive_loss_param() {
-  _has_bits_[0] &= ~0x00008000u;
-}
-inline void V1LayerParameter::clear_contrastive_loss_param() {
-  if (contrastive_loss_param_ != NULL) contrastive_loss_param_->::caffe::ContrastiveLossParameter::Clear();
-  clear_has_contrastive_loss_param();
-}
-inline const ::caffe::ContrastiveLossParameter& V1LayerParameter::contrastive_loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.contrastive_loss_param)
-  return contrastive_loss_param_ != NULL ? *contrastive_loss_param_ : *default_instance_->contrastive_loss_param_;
-}
-inline ::caffe::ContrastiveLossParameter* V1LayerParameter::mutable_contrastive_loss_param() {
-  set_has_contrastive_loss_param();
-  if (contrastive_loss_param_ == NULL) contrastive_loss_param_ = new ::caffe::ContrastiveLossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.contrastive_loss_param)
-  return contrastive_loss_param_;
-}
-inline ::caffe::ContrastiveLossParameter* V1LayerParameter::release_contrastive_loss_param() {
-  clear_has_contrastive_loss_param();
-  ::caffe::ContrastiveLossParameter* temp = contrastive_loss_param_;
-  contrastive_loss_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_contrastive_loss_param(::caffe::ContrastiveLossParameter* contrastive_loss_param) {
-  delete contrastive_loss_param_;
-  contrastive_loss_param_ = contrastive_loss_param;
-  if (contrastive_loss_param) {
-    set_has_contrastive_loss_param();
-  } else {
-    clear_has_contrastive_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.contrastive_loss_param)
-}
-
-// optional .caffe.ConvolutionParameter convolution_param = 10;
-inline bool V1LayerParameter::has_convolution_param() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
-}
-inline void V1LayerParameter::set_has_convolution_param() {
-  _has_bits_[0] |= 0x00010000u;
-}
-inline void V1LayerParameter::clear_has_convolution_param() {
-  _has_bits_[0] &= ~0x00010000u;
-}
-inline void V1LayerParameter::clear_convolution_param() {
-  if (convolution_param_ != NULL) convolution_param_->::caffe::ConvolutionParameter::Clear();
-  clear_has_convolution_param();
-}
-inline const ::caffe::ConvolutionParameter& V1LayerParameter::convolution_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.convolution_param)
-  return convolution_param_ != NULL ? *convolution_param_ : *default_instance_->convolution_param_;
-}
-inline ::caffe::ConvolutionParameter* V1LayerParameter::mutable_convolution_param() {
-  set_has_convolution_param();
-  if (convolution_param_ == NULL) convolution_param_ = new ::caffe::ConvolutionParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.convolution_param)
-  return convolution_param_;
-}
-inline ::caffe::ConvolutionParameter* V1LayerParameter::release_convolution_param() {
-  clear_has_convolution_param();
-  ::caffe::ConvolutionParameter* temp = convolution_param_;
-  convolution_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_convolution_param(::caffe::ConvolutionParameter* convolution_param) {
-  delete convolution_param_;
-  convolution_param_ = convolution_param;
-  if (convolution_param) {
-    set_has_convolution_param();
-  } else {
-    clear_has_convolution_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.convolution_param)
-}
-
-// optional .caffe.DataParameter data_param = 11;
-inline bool V1LayerParameter::has_data_param() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
-}
-inline void V1LayerParameter::set_has_data_param() {
-  _has_bits_[0] |= 0x00020000u;
-}
-inline void V1LayerParameter::clear_has_data_param() {
-  _has_bits_[0] &= ~0x00020000u;
-}
-inline void V1LayerParameter::clear_data_param() {
-  if (data_param_ != NULL) data_param_->::caffe::DataParameter::Clear();
-  clear_has_data_param();
-}
-inline const ::caffe::DataParameter& V1LayerParameter::data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.data_param)
-  return data_param_ != NULL ? *data_param_ : *default_instance_->data_param_;
-}
-inline ::caffe::DataParameter* V1LayerParameter::mutable_data_param() {
-  set_has_data_param();
-  if (data_param_ == NULL) data_param_ = new ::caffe::DataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.data_param)
-  return data_param_;
-}
-inline ::caffe::DataParameter* V1LayerParameter::release_data_param() {
-  clear_has_data_param();
-  ::caffe::DataParameter* temp = data_param_;
-  data_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_data_param(::caffe::DataParameter* data_param) {
-  delete data_param_;
-  data_param_ = data_param;
-  if (data_param) {
-    set_has_data_param();
-  } else {
-    clear_has_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.data_param)
-}
-
-// optional .caffe.DropoutParameter dropout_param = 12;
-inline bool V1LayerParameter::has_dropout_param() const {
-  return (_has_bits_[0] & 0x00040000u) != 0;
-}
-inline void V1LayerParameter::set_has_dropout_param() {
-  _has_bits_[0] |= 0x00040000u;
-}
-inline void V1LayerParameter::clear_has_dropout_param() {
-  _has_bits_[0] &= ~0x00040000u;
-}
-inline void V1LayerParameter::clear_dropout_param() {
-  if (dropout_param_ != NULL) dropout_param_->::caffe::DropoutParameter::Clear();
-  clear_has_dropout_param();
-}
-inline const ::caffe::DropoutParameter& V1LayerParameter::dropout_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.dropout_param)
-  return dropout_param_ != NULL ? *dropout_param_ : *default_instance_->dropout_param_;
-}
-inline ::caffe::DropoutParameter* V1LayerParameter::mutable_dropout_param() {
-  set_has_dropout_param();
-  if (dropout_param_ == NULL) dropout_param_ = new ::caffe::DropoutParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.dropout_param)
-  return dropout_param_;
-}
-inline ::caffe::DropoutParameter* V1LayerParameter::release_dropout_param() {
-  clear_has_dropout_param();
-  ::caffe::DropoutParameter* temp = dropout_param_;
-  dropout_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_dropout_param(::caffe::DropoutParameter* dropout_param) {
-  delete dropout_param_;
-  dropout_param_ = dropout_param;
-  if (dropout_param) {
-    set_has_dropout_param();
-  } else {
-    clear_has_dropout_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.dropout_param)
-}
-
-// optional .caffe.DummyDataParameter dummy_data_param = 26;
-inline bool V1LayerParameter::has_dummy_data_param() const {
-  return (_has_bits_[0] & 0x00080000u) != 0;
-}
-inline void V1LayerParameter::set_has_dummy_data_param() {
-  _has_bits_[0] |= 0x00080000u;
-}
-inline void V1LayerParameter::clear_has_dummy_data_param() {
-  _has_bits_[0] &= ~0x00080000u;
-}
-inline void V1LayerParameter::clear_dummy_data_param() {
-  if (dummy_data_param_ != NULL) dummy_data_param_->::caffe::DummyDataParameter::Clear();
-  clear_has_dummy_data_param();
-}
-inline const ::caffe::DummyDataParameter& V1LayerParameter::dummy_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.dummy_data_param)
-  return dummy_data_param_ != NULL ? *dummy_data_param_ : *default_instance_->dummy_data_param_;
-}
-inline ::caffe::DummyDataParameter* V1LayerParameter::mutable_dummy_data_param() {
-  set_has_dummy_data_param();
-  if (dummy_data_param_ == NULL) dummy_data_param_ = new ::caffe::DummyDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.dummy_data_param)
-  return dummy_data_param_;
-}
-inline ::caffe::DummyDataParameter* V1LayerParameter::release_dummy_data_param() {
-  clear_has_dummy_data_param();
-  ::caffe::DummyDataParameter* temp = dummy_data_param_;
-  dummy_data_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_dummy_data_param(::caffe::DummyDataParameter* dummy_data_param) {
-  delete dummy_data_param_;
-  dummy_data_param_ = dummy_data_param;
-  if (dummy_data_param) {
-    set_has_dummy_data_param();
-  } else {
-    clear_has_dummy_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.dummy_data_param)
-}
-
-// optional .caffe.EltwiseParameter eltwise_param = 24;
-inline bool V1LayerParameter::has_eltwise_param() const {
-  return (_has_bits_[0] & 0x00100000u) != 0;
-}
-inline void V1LayerParameter::set_has_eltwise_param() {
-  _has_bits_[0] |= 0x00100000u;
-}
-inline void V1LayerParameter::clear_has_eltwise_param() {
-  _has_bits_[0] &= ~0x00100000u;
-}
-inline void V1LayerParameter::clear_eltwise_param() {
-  if (eltwise_param_ != NULL) eltwise_param_->::caffe::EltwiseParameter::Clear();
-  clear_has_eltwise_param();
-}
-inline const ::caffe::EltwiseParameter& V1LayerParameter::eltwise_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.eltwise_param)
-  return eltwise_param_ != NULL ? *eltwise_param_ : *default_instance_->eltwise_param_;
-}
-inline ::caffe::EltwiseParameter* V1LayerParameter::mutable_eltwise_param() {
-  set_has_eltwise_param();
-  if (eltwise_param_ == NULL) eltwise_param_ = new ::caffe::EltwiseParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.eltwise_param)
-  return eltwise_param_;
-}
-inline ::caffe::EltwiseParameter* V1LayerParameter::release_eltwise_param() {
-  clear_has_eltwise_param();
-  ::caffe::EltwiseParameter* temp = eltwise_param_;
-  eltwise_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_eltwise_param(::caffe::EltwiseParameter* eltwise_param) {
-  delete eltwise_param_;
-  eltwise_param_ = eltwise_param;
-  if (eltwise_param) {
-    set_has_eltwise_param();
-  } else {
-    clear_has_eltwise_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.eltwise_param)
-}
-
-// optional .caffe.ExpParameter exp_param = 41;
-inline bool V1LayerParameter::has_exp_param() const {
-  return (_has_bits_[0] & 0x00200000u) != 0;
-}
-inline void V1LayerParameter::set_has_exp_param() {
-  _has_bits_[0] |= 0x00200000u;
-}
-inline void V1LayerParameter::clear_has_exp_param() {
-  _has_bits_[0] &= ~0x00200000u;
-}
-inline void V1LayerParameter::clear_exp_param() {
-  if (exp_param_ != NULL) exp_param_->::caffe::ExpParameter::Clear();
-  clear_has_exp_param();
-}
-inline const ::caffe::ExpParameter& V1LayerParameter::exp_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.exp_param)
-  return exp_param_ != NULL ? *exp_param_ : *default_instance_->exp_param_;
-}
-inline ::caffe::ExpParameter* V1LayerParameter::mutable_exp_param() {
-  set_has_exp_param();
-  if (exp_param_ == NULL) exp_param_ = new ::caffe::ExpParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.exp_param)
-  return exp_param_;
-}
-inline ::caffe::ExpParameter* V1LayerParameter::release_exp_param() {
-  clear_has_exp_param();
-  ::caffe::ExpParameter* temp = exp_param_;
-  exp_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_exp_param(::caffe::ExpParameter* exp_param) {
-  delete exp_param_;
-  exp_param_ = exp_param;
-  if (exp_param) {
-    set_has_exp_param();
-  } else {
-    clear_has_exp_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.exp_param)
-}
-
-// optional .caffe.HDF5DataParameter hdf5_data_param = 13;
-inline bool V1LayerParameter::has_hdf5_data_param() const {
-  return (_has_bits_[0] & 0x00400000u) != 0;
-}
-inline void V1LayerParameter::set_has_hdf5_data_param() {
-  _has_bits_[0] |= 0x00400000u;
-}
-inline void V1LayerParameter::clear_has_hdf5_data_param() {
-  _has_bits_[0] &= ~0x00400000u;
-}
-inline void V1LayerParameter::clear_hdf5_data_param() {
-  if (hdf5_data_param_ != NULL) hdf5_data_param_->::caffe::HDF5DataParameter::Clear();
-  clear_has_hdf5_data_param();
-}
-inline const ::caffe::HDF5DataParameter& V1LayerParameter::hdf5_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.hdf5_data_param)
-  return hdf5_data_param_ != NULL ? *hdf5_data_param_ : *default_instance_->hdf5_data_param_;
-}
-inline ::caffe::HDF5DataParameter* V1LayerParameter::mutable_hdf5_data_param() {
-  set_has_hdf5_data_param();
-  if (hdf5_data_param_ == NULL) hdf5_data_param_ = new ::caffe::HDF5DataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.hdf5_data_param)
-  return hdf5_data_param_;
-}
-inline ::caffe::HDF5DataParameter* V1LayerParameter::release_hdf5_data_param() {
-  clear_has_hdf5_data_param();
-  ::caffe::HDF5DataParameter* temp = hdf5_data_param_;
-  hdf5_data_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_hdf5_data_param(::caffe::HDF5DataParameter* hdf5_data_param) {
-  delete hdf5_data_param_;
-  hdf5_data_param_ = hdf5_data_param;
-  if (hdf5_data_param) {
-    set_has_hdf5_data_param();
-  } else {
-    clear_has_hdf5_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.hdf5_data_param)
-}
-
-// optional .caffe.HDF5OutputParameter hdf5_output_param = 14;
-inline bool V1LayerParameter::has_hdf5_output_param() const {
-  return (_has_bits_[0] & 0x00800000u) != 0;
-}
-inline void V1LayerParameter::set_has_hdf5_output_param() {
-  _has_bits_[0] |= 0x00800000u;
-}
-inline void V1LayerParameter::clear_has_hdf5_output_param() {
-  _has_bits_[0] &= ~0x00800000u;
-}
-inline void V1LayerParameter::clear_hdf5_output_param() {
-  if (hdf5_output_param_ != NULL) hdf5_output_param_->::caffe::HDF5OutputParameter::Clear();
-  clear_has_hdf5_output_param();
-}
-inline const ::caffe::HDF5OutputParameter& V1LayerParameter::hdf5_output_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.hdf5_output_param)
-  return hdf5_output_param_ != NULL ? *hdf5_output_param_ : *default_instance_->hdf5_output_param_;
-}
-inline ::caffe::HDF5OutputParameter* V1LayerParameter::mutable_hdf5_output_param() {
-  set_has_hdf5_output_param();
-  if (hdf5_output_param_ == NULL) hdf5_output_param_ = new ::caffe::HDF5OutputParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.hdf5_output_param)
-  return hdf5_output_param_;
-}
-inline ::caffe::HDF5OutputParameter* V1LayerParameter::release_hdf5_output_param() {
-  clear_has_hdf5_output_param();
-  ::caffe::HDF5OutputParameter* temp = hdf5_output_param_;
-  hdf5_output_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_hdf5_output_param(::caffe::HDF5OutputParameter* hdf5_output_param) {
-  delete hdf5_output_param_;
-  hdf5_output_param_ = hdf5_output_param;
-  if (hdf5_output_param) {
-    set_has_hdf5_output_param();
-  } else {
-    clear_has_hdf5_output_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.hdf5_output_param)
-}
-
-// optional .caffe.HingeLossParameter hinge_loss_param = 29;
-inline bool V1LayerParameter::has_hinge_loss_param() const {
-  return (_has_bits_[0] & 0x01000000u) != 0;
-}
-inline void V1LayerParameter::set_has_hinge_loss_param() {
-  _has_bits_[0] |= 0x01000000u;
-}
-inline void V1LayerParameter::clear_has_hinge_loss_param() {
-  _has_bits_[0] &= ~0x01000000u;
-}
-inline void V1LayerParameter::clear_hinge_loss_param() {
-  if (hinge_loss_param_ != NULL) hinge_loss_param_->::caffe::HingeLossParameter::Clear();
-  clear_has_hinge_loss_param();
-}
-inline const ::caffe::HingeLossParameter& V1LayerParameter::hinge_loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.hinge_loss_param)
-  return hinge_loss_param_ != NULL ? *hinge_loss_param_ : *default_instance_->hinge_loss_param_;
-}
-inline ::caffe::HingeLossParameter* V1LayerParameter::mutable_hinge_loss_param() {
-  set_has_hinge_loss_param();
-  if (hinge_loss_param_ == NULL) hinge_loss_param_ = new ::caffe::HingeLossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.hinge_loss_param)
-  return hinge_loss_param_;
-}
-inline ::caffe::HingeLossParameter* V1LayerParameter::release_hinge_loss_param() {
-  clear_has_hinge_loss_param();
-  ::caffe::HingeLossParameter* temp = hinge_loss_param_;
-  hinge_loss_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_hinge_loss_param(::caffe::HingeLossParameter* hinge_loss_param) {
-  delete hinge_loss_param_;
-  hinge_loss_param_ = hinge_loss_param;
-  if (hinge_loss_param) {
-    set_has_hinge_loss_param();
-  } else {
-    clear_has_hinge_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.hinge_loss_param)
-}
-
-// optional .caffe.ImageDataParameter image_data_param = 15;
-inline bool V1LayerParameter::has_image_data_param() const {
-  return (_has_bits_[0] & 0x02000000u) != 0;
-}
-inline void V1LayerParameter::set_has_image_data_param() {
-  _has_bits_[0] |= 0x02000000u;
-}
-inline void V1LayerParameter::clear_has_image_data_param() {
-  _has_bits_[0] &= ~0x02000000u;
-}
-inline void V1LayerParameter::clear_image_data_param() {
-  if (image_data_param_ != NULL) image_data_param_->::caffe::ImageDataParameter::Clear();
-  clear_has_image_data_param();
-}
-inline const ::caffe::ImageDataParameter& V1LayerParameter::image_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.image_data_param)
-  return image_data_param_ != NULL ? *image_data_param_ : *default_instance_->image_data_param_;
-}
-inline ::caffe::ImageDataParameter* V1LayerParameter::mutable_image_data_param() {
-  set_has_image_data_param();
-  if (image_data_param_ == NULL) image_data_param_ = new ::caffe::ImageDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.image_data_param)
-  return image_data_param_;
-}
-inline ::caffe::ImageDataParameter* V1LayerParameter::release_image_data_param() {
-  clear_has_image_data_param();
-  ::caffe::ImageDataParameter* temp = image_data_param_;
-  image_data_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_image_data_param(::caffe::ImageDataParameter* image_data_param) {
-  delete image_data_param_;
-  image_data_param_ = image_data_param;
-  if (image_data_param) {
-    set_has_image_data_param();
-  } else {
-    clear_has_image_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.image_data_param)
-}
-
-// optional .caffe.InfogainLossParameter infogain_loss_param = 16;
-inline bool V1LayerParameter::has_infogain_loss_param() const {
-  return (_has_bits_[0] & 0x04000000u) != 0;
-}
-inline void V1LayerParameter::set_has_infogain_loss_param() {
-  _has_bits_[0] |= 0x04000000u;
-}
-inline void V1LayerParameter::clear_has_infogain_loss_param() {
-  _has_bits_[0] &= ~0x04000000u;
-}
-inline void V1LayerParameter::clear_infogain_loss_param() {
-  if (infogain_loss_param_ != NULL) infogain_loss_param_->::caffe::InfogainLossParameter::Clear();
-  clear_has_infogain_loss_param();
-}
-inline const ::caffe::InfogainLossParameter& V1LayerParameter::infogain_loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.infogain_loss_param)
-  return infogain_loss_param_ != NULL ? *infogain_loss_param_ : *default_instance_->infogain_loss_param_;
-}
-inline ::caffe::InfogainLossParameter* V1LayerParameter::mutable_infogain_loss_param() {
-  set_has_infogain_loss_param();
-  if (infogain_loss_param_ == NULL) infogain_loss_param_ = new ::caffe::InfogainLossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.infogain_loss_param)
-  return infogain_loss_param_;
-}
-inline ::caffe::InfogainLossParameter* V1LayerParameter::release_infogain_loss_param() {
-  clear_has_infogain_loss_param();
-  ::caffe::InfogainLossParameter* temp = infogain_loss_param_;
-  infogain_loss_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_infogain_loss_param(::caffe::InfogainLossParameter* infogain_loss_param) {
-  delete infogain_loss_param_;
-  infogain_loss_param_ = infogain_loss_param;
-  if (infogain_loss_param) {
-    set_has_infogain_loss_param();
-  } else {
-    clear_has_infogain_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.infogain_loss_param)
-}
-
-// optional .caffe.InnerProductParameter inner_product_param = 17;
-inline bool V1LayerParameter::has_inner_product_param() const {
-  return (_has_bits_[0] & 0x08000000u) != 0;
-}
-inline void V1LayerParameter::set_has_inner_product_param() {
-  _has_bits_[0] |= 0x08000000u;
-}
-inline void V1LayerParameter::clear_has_inner_product_param() {
-  _has_bits_[0] &= ~0x08000000u;
-}
-inline void V1LayerParameter::clear_inner_product_param() {
-  if (inner_product_param_ != NULL) inner_product_param_->::caffe::InnerProductParameter::Clear();
-  clear_has_inner_product_param();
-}
-inline const ::caffe::InnerProductParameter& V1LayerParameter::inner_product_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.inner_product_param)
-  return inner_product_param_ != NULL ? *inner_product_param_ : *default_instance_->inner_product_param_;
-}
-inline ::caffe::InnerProductParameter* V1LayerParameter::mutable_inner_product_param() {
-  set_has_inner_product_param();
-  if (inner_product_param_ == NULL) inner_product_param_ = new ::caffe::InnerProductParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.inner_product_param)
-  return inner_product_param_;
-}
-inline ::caffe::InnerProductParameter* V1LayerParameter::release_inner_product_param() {
-  clear_has_inner_product_param();
-  ::caffe::InnerProductParameter* temp = inner_product_param_;
-  inner_product_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_inner_product_param(::caffe::InnerProductParameter* inner_product_param) {
-  delete inner_product_param_;
-  inner_product_param_ = inner_product_param;
-  if (inner_product_param) {
-    set_has_inner_product_param();
-  } else {
-    clear_has_inner_product_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.inner_product_param)
-}
-
-// optional .caffe.LRNParameter lrn_param = 18;
-inline bool V1LayerParameter::has_lrn_param() const {
-  return (_has_bits_[0] & 0x10000000u) != 0;
-}
-inline void V1LayerParameter::set_has_lrn_param() {
-  _has_bits_[0] |= 0x10000000u;
-}
-inline void V1LayerParameter::clear_has_lrn_param() {
-  _has_bits_[0] &= ~0x10000000u;
-}
-inline void V1LayerParameter::clear_lrn_param() {
-  if (lrn_param_ != NULL) lrn_param_->::caffe::LRNParameter::Clear();
-  clear_has_lrn_param();
-}
-inline const ::caffe::LRNParameter& V1LayerParameter::lrn_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.lrn_param)
-  return lrn_param_ != NULL ? *lrn_param_ : *default_instance_->lrn_param_;
-}
-inline ::caffe::LRNParameter* V1LayerParameter::mutable_lrn_param() {
-  set_has_lrn_param();
-  if (lrn_param_ == NULL) lrn_param_ = new ::caffe::LRNParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.lrn_param)
-  return lrn_param_;
-}
-inline ::caffe::LRNParameter* V1LayerParameter::release_lrn_param() {
-  clear_has_lrn_param();
-  ::caffe::LRNParameter* temp = lrn_param_;
-  lrn_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_lrn_param(::caffe::LRNParameter* lrn_param) {
-  delete lrn_param_;
-  lrn_param_ = lrn_param;
-  if (lrn_param) {
-    set_has_lrn_param();
-  } else {
-    clear_has_lrn_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.lrn_param)
-}
-
-// optional .caffe.MemoryDataParameter memory_data_param = 22;
-inline bool V1LayerParameter::has_memory_data_param() const {
-  return (_has_bits_[0] & 0x20000000u) != 0;
-}
-inline void V1LayerParameter::set_has_memory_data_param() {
-  _has_bits_[0] |= 0x20000000u;
-}
-inline void V1LayerParameter::clear_has_memory_data_param() {
-  _has_bits_[0] &= ~0x20000000u;
-}
-inline void V1LayerParameter::clear_memory_data_param() {
-  if (memory_data_param_ != NULL) memory_data_param_->::caffe::MemoryDataParameter::Clear();
-  clear_has_memory_data_param();
-}
-inline const ::caffe::MemoryDataParameter& V1LayerParameter::memory_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.memory_data_param)
-  return memory_data_param_ != NULL ? *memory_data_param_ : *default_instance_->memory_data_param_;
-}
-inline ::caffe::MemoryDataParameter* V1LayerParameter::mutable_memory_data_param() {
-  set_has_memory_data_param();
-  if (memory_data_param_ == NULL) memory_data_param_ = new ::caffe::MemoryDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.memory_data_param)
-  return memory_data_param_;
-}
-inline ::caffe::MemoryDataParameter* V1LayerParameter::release_memory_data_param() {
-  clear_has_memory_data_param();
-  ::caffe::MemoryDataParameter* temp = memory_data_param_;
-  memory_data_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_memory_data_param(::caffe::MemoryDataParameter* memory_data_param) {
-  delete memory_data_param_;
-  memory_data_param_ = memory_data_param;
-  if (memory_data_param) {
-    set_has_memory_data_param();
-  } else {
-    clear_has_memory_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.memory_data_param)
-}
-
-// optional .caffe.MVNParameter mvn_param = 34;
-inline bool V1LayerParameter::has_mvn_param() const {
-  return (_has_bits_[0] & 0x40000000u) != 0;
-}
-inline void V1LayerParameter::set_has_mvn_param() {
-  _has_bits_[0] |= 0x40000000u;
-}
-inline void V1LayerParameter::clear_has_mvn_param() {
-  _has_bits_[0] &= ~0x40000000u;
-}
-inline void V1LayerParameter::clear_mvn_param() {
-  if (mvn_param_ != NULL) mvn_param_->::caffe::MVNParameter::Clear();
-  clear_has_mvn_param();
-}
-inline const ::caffe::MVNParameter& V1LayerParameter::mvn_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.mvn_param)
-  return mvn_param_ != NULL ? *mvn_param_ : *default_instance_->mvn_param_;
-}
-inline ::caffe::MVNParameter* V1LayerParameter::mutable_mvn_param() {
-  set_has_mvn_param();
-  if (mvn_param_ == NULL) mvn_param_ = new ::caffe::MVNParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.mvn_param)
-  return mvn_param_;
-}
-inline ::caffe::MVNParameter* V1LayerParameter::release_mvn_param() {
-  clear_has_mvn_param();
-  ::caffe::MVNParameter* temp = mvn_param_;
-  mvn_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_mvn_param(::caffe::MVNParameter* mvn_param) {
-  delete mvn_param_;
-  mvn_param_ = mvn_param;
-  if (mvn_param) {
-    set_has_mvn_param();
-  } else {
-    clear_has_mvn_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.mvn_param)
-}
-
-// optional .caffe.PoolingParameter pooling_param = 19;
-inline bool V1LayerParameter::has_pooling_param() const {
-  return (_has_bits_[0] & 0x80000000u) != 0;
-}
-inline void V1LayerParameter::set_has_pooling_param() {
-  _has_bits_[0] |= 0x80000000u;
-}
-inline void V1LayerParameter::clear_has_pooling_param() {
-  _has_bits_[0] &= ~0x80000000u;
-}
-inline void V1LayerParameter::clear_pooling_param() {
-  if (pooling_param_ != NULL) pooling_param_->::caffe::PoolingParameter::Clear();
-  clear_has_pooling_param();
-}
-inline const ::caffe::PoolingParameter& V1LayerParameter::pooling_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.pooling_param)
-  return pooling_param_ != NULL ? *pooling_param_ : *default_instance_->pooling_param_;
-}
-inline ::caffe::PoolingParameter* V1LayerParameter::mutable_pooling_param() {
-  set_has_pooling_param();
-  if (pooling_param_ == NULL) pooling_param_ = new ::caffe::PoolingParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.pooling_param)
-  return pooling_param_;
-}
-inline ::caffe::PoolingParameter* V1LayerParameter::release_pooling_param() {
-  clear_has_pooling_param();
-  ::caffe::PoolingParameter* temp = pooling_param_;
-  pooling_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_pooling_param(::caffe::PoolingParameter* pooling_param) {
-  delete pooling_param_;
-  pooling_param_ = pooling_param;
-  if (pooling_param) {
-    set_has_pooling_param();
-  } else {
-    clear_has_pooling_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.pooling_param)
-}
-
-// optional .caffe.PowerParameter power_param = 21;
-inline bool V1LayerParameter::has_power_param() const {
-  return (_has_bits_[1] & 0x00000001u) != 0;
-}
-inline void V1LayerParameter::set_has_power_param() {
-  _has_bits_[1] |= 0x00000001u;
-}
-inline void V1LayerParameter::clear_has_power_param() {
-  _has_bits_[1] &= ~0x00000001u;
-}
-inline void V1LayerParameter::clear_power_param() {
-  if (power_param_ != NULL) power_param_->::caffe::PowerParameter::Clear();
-  clear_has_power_param();
-}
-inline const ::caffe::PowerParameter& V1LayerParameter::power_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.power_param)
-  return power_param_ != NULL ? *power_param_ : *default_instance_->power_param_;
-}
-inline ::caffe::PowerParameter* V1LayerParameter::mutable_power_param() {
-  set_has_power_param();
-  if (power_param_ == NULL) power_param_ = new ::caffe::PowerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.power_param)
-  return power_param_;
-}
-inline ::caffe::PowerParameter* V1LayerParameter::release_power_param() {
-  clear_has_power_param();
-  ::caffe::PowerParameter* temp = power_param_;
-  power_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_power_param(::caffe::PowerParameter* power_param) {
-  delete power_param_;
-  power_param_ = power_param;
-  if (power_param) {
-    set_has_power_param();
-  } else {
-    clear_has_power_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.power_param)
-}
-
-// optional .caffe.ReLUParameter relu_param = 30;
-inline bool V1LayerParameter::has_relu_param() const {
-  return (_has_bits_[1] & 0x00000002u) != 0;
-}
-inline void V1LayerParameter::set_has_relu_param() {
-  _has_bits_[1] |= 0x00000002u;
-}
-inline void V1LayerParameter::clear_has_relu_param() {
-  _has_bits_[1] &= ~0x00000002u;
-}
-inline void V1LayerParameter::clear_relu_param() {
-  if (relu_param_ != NULL) relu_param_->::caffe::ReLUParameter::Clear();
-  clear_has_relu_param();
-}
-inline const ::caffe::ReLUParameter& V1LayerParameter::relu_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.relu_param)
-  return relu_param_ != NULL ? *relu_param_ : *default_instance_->relu_param_;
-}
-inline ::caffe::ReLUParameter* V1LayerParameter::mutable_relu_param() {
-  set_has_relu_param();
-  if (relu_param_ == NULL) relu_param_ = new ::caffe::ReLUParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.relu_param)
-  return relu_param_;
-}
-inline ::caffe::ReLUParameter* V1LayerParameter::release_relu_param() {
-  clear_has_relu_param();
-  ::caffe::ReLUParameter* temp = relu_param_;
-  relu_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_relu_param(::caffe::ReLUParameter* relu_param) {
-  delete relu_param_;
-  relu_param_ = relu_param;
-  if (relu_param) {
-    set_has_relu_param();
-  } else {
-    clear_has_relu_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.relu_param)
-}
-
-// optional .caffe.SigmoidParameter sigmoid_param = 38;
-inline bool V1LayerParameter::has_sigmoid_param() const {
-  return (_has_bits_[1] & 0x00000004u) != 0;
-}
-inline void V1LayerParameter::set_has_sigmoid_param() {
-  _has_bits_[1] |= 0x00000004u;
-}
-inline void V1LayerParameter::clear_has_sigmoid_param() {
-  _has_bits_[1] &= ~0x00000004u;
-}
-inline void V1LayerParameter::clear_sigmoid_param() {
-  if (sigmoid_param_ != NULL) sigmoid_param_->::caffe::SigmoidParameter::Clear();
-  clear_has_sigmoid_param();
-}
-inline const ::caffe::SigmoidParameter& V1LayerParameter::sigmoid_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.sigmoid_param)
-  return sigmoid_param_ != NULL ? *sigmoid_param_ : *default_instance_->sigmoid_param_;
-}
-inline ::caffe::SigmoidParameter* V1LayerParameter::mutable_sigmoid_param() {
-  set_has_sigmoid_param();
-  if (sigmoid_param_ == NULL) sigmoid_param_ = new ::caffe::SigmoidParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.sigmoid_param)
-  return sigmoid_param_;
-}
-inline ::caffe::SigmoidParameter* V1LayerParameter::release_sigmoid_param() {
-  clear_has_sigmoid_param();
-  ::caffe::SigmoidParameter* temp = sigmoid_param_;
-  sigmoid_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_sigmoid_param(::caffe::SigmoidParameter* sigmoid_param) {
-  delete sigmoid_param_;
-  sigmoid_param_ = sigmoid_param;
-  if (sigmoid_param) {
-    set_has_sigmoid_param();
-  } else {
-    clear_has_sigmoid_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.sigmoid_param)
-}
-
-// optional .caffe.SoftmaxParameter softmax_param = 39;
-inline bool V1LayerParameter::has_softmax_param() const {
-  return (_has_bits_[1] & 0x00000008u) != 0;
-}
-inline void V1LayerParameter::set_has_softmax_param() {
-  _has_bits_[1] |= 0x00000008u;
-}
-inline void V1LayerParameter::clear_has_softmax_param() {
-  _has_bits_[1] &= ~0x00000008u;
-}
-inline void V1LayerParameter::clear_softmax_param() {
-  if (softmax_param_ != NULL) softmax_param_->::caffe::SoftmaxParameter::Clear();
-  clear_has_softmax_param();
-}
-inline const ::caffe::SoftmaxParameter& V1LayerParameter::softmax_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.softmax_param)
-  return softmax_param_ != NULL ? *softmax_param_ : *default_instance_->softmax_param_;
-}
-inline ::caffe::SoftmaxParameter* V1LayerParameter::mutable_softmax_param() {
-  set_has_softmax_param();
-  if (softmax_param_ == NULL) softmax_param_ = new ::caffe::SoftmaxParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.softmax_param)
-  return softmax_param_;
-}
-inline ::caffe::SoftmaxParameter* V1LayerParameter::release_softmax_param() {
-  clear_has_softmax_param();
-  ::caffe::SoftmaxParameter* temp = softmax_param_;
-  softmax_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_softmax_param(::caffe::SoftmaxParameter* softmax_param) {
-  delete softmax_param_;
-  softmax_param_ = softmax_param;
-  if (softmax_param) {
-    set_has_softmax_param();
-  } else {
-    clear_has_softmax_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.softmax_param)
-}
-
-// optional .caffe.SliceParameter slice_param = 31;
-inline bool V1LayerParameter::has_slice_param() const {
-  return (_has_bits_[1] & 0x00000010u) != 0;
-}
-inline void V1LayerParameter::set_has_slice_param() {
-  _has_bits_[1] |= 0x00000010u;
-}
-inline void V1LayerParameter::clear_has_slice_param() {
-  _has_bits_[1] &= ~0x00000010u;
-}
-inline void V1LayerParameter::clear_slice_param() {
-  if (slice_param_ != NULL) slice_param_->::caffe::SliceParameter::Clear();
-  clear_has_slice_param();
-}
-inline const ::caffe::SliceParameter& V1LayerParameter::slice_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.slice_param)
-  return slice_param_ != NULL ? *slice_param_ : *default_instance_->slice_param_;
-}
-inline ::caffe::SliceParameter* V1LayerParameter::mutable_slice_param() {
-  set_has_slice_param();
-  if (slice_param_ == NULL) slice_param_ = new ::caffe::SliceParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.slice_param)
-  return slice_param_;
-}
-inline ::caffe::SliceParameter* V1LayerParameter::release_slice_param() {
-  clear_has_slice_param();
-  ::caffe::SliceParameter* temp = slice_param_;
-  slice_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_slice_param(::caffe::SliceParameter* slice_param) {
-  delete slice_param_;
-  slice_param_ = slice_param;
-  if (slice_param) {
-    set_has_slice_param();
-  } else {
-    clear_has_slice_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.slice_param)
-}
-
-// optional .caffe.TanHParameter tanh_param = 37;
-inline bool V1LayerParameter::has_tanh_param() const {
-  return (_has_bits_[1] & 0x00000020u) != 0;
-}
-inline void V1LayerParameter::set_has_tanh_param() {
-  _has_bits_[1] |= 0x00000020u;
-}
-inline void V1LayerParameter::clear_has_tanh_param() {
-  _has_bits_[1] &= ~0x00000020u;
-}
-inline void V1LayerParameter::clear_tanh_param() {
-  if (tanh_param_ != NULL) tanh_param_->::caffe::TanHParameter::Clear();
-  clear_has_tanh_param();
-}
-inline const ::caffe::TanHParameter& V1LayerParameter::tanh_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.tanh_param)
-  return tanh_param_ != NULL ? *tanh_param_ : *default_instance_->tanh_param_;
-}
-inline ::caffe::TanHParameter* V1LayerParameter::mutable_tanh_param() {
-  set_has_tanh_param();
-  if (tanh_param_ == NULL) tanh_param_ = new ::caffe::TanHParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.tanh_param)
-  return tanh_param_;
-}
-inline ::caffe::TanHParameter* V1LayerParameter::release_tanh_param() {
-  clear_has_tanh_param();
-  ::caffe::TanHParameter* temp = tanh_param_;
-  tanh_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_tanh_param(::caffe::TanHParameter* tanh_param) {
-  delete tanh_param_;
-  tanh_param_ = tanh_param;
-  if (tanh_param) {
-    set_has_tanh_param();
-  } else {
-    clear_has_tanh_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.tanh_param)
-}
-
-// optional .caffe.ThresholdParameter threshold_param = 25;
-inline bool V1LayerParameter::has_threshold_param() const {
-  return (_has_bits_[1] & 0x00000040u) != 0;
-}
-inline void V1LayerParameter::set_has_threshold_param() {
-  _has_bits_[1] |= 0x00000040u;
-}
-inline void V1LayerParameter::clear_has_threshold_param() {
-  _has_bits_[1] &= ~0x00000040u;
-}
-inline void V1LayerParameter::clear_threshold_param() {
-  if (threshold_param_ != NULL) threshold_param_->::caffe::ThresholdParameter::Clear();
-  clear_has_threshold_param();
-}
-inline const ::caffe::ThresholdParameter& V1LayerParameter::threshold_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.threshold_param)
-  return threshold_param_ != NULL ? *threshold_param_ : *default_instance_->threshold_param_;
-}
-inline ::caffe::ThresholdParameter* V1LayerParameter::mutable_threshold_param() {
-  set_has_threshold_param();
-  if (threshold_param_ == NULL) threshold_param_ = new ::caffe::ThresholdParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.threshold_param)
-  return threshold_param_;
-}
-inline ::caffe::ThresholdParameter* V1LayerParameter::release_threshold_param() {
-  clear_has_threshold_param();
-  ::caffe::ThresholdParameter* temp = threshold_param_;
-  threshold_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_threshold_param(::caffe::ThresholdParameter* threshold_param) {
-  delete threshold_param_;
-  threshold_param_ = threshold_param;
-  if (threshold_param) {
-    set_has_threshold_param();
-  } else {
-    clear_has_threshold_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.threshold_param)
-}
-
-// optional .caffe.WindowDataParameter window_data_param = 20;
-inline bool V1LayerParameter::has_window_data_param() const {
-  return (_has_bits_[1] & 0x00000080u) != 0;
-}
-inline void V1LayerParameter::set_has_window_data_param() {
-  _has_bits_[1] |= 0x00000080u;
-}
-inline void V1LayerParameter::clear_has_window_data_param() {
-  _has_bits_[1] &= ~0x00000080u;
-}
-inline void V1LayerParameter::clear_window_data_param() {
-  if (window_data_param_ != NULL) window_data_param_->::caffe::WindowDataParameter::Clear();
-  clear_has_window_data_param();
-}
-inline const ::caffe::WindowDataParameter& V1LayerParameter::window_data_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.window_data_param)
-  return window_data_param_ != NULL ? *window_data_param_ : *default_instance_->window_data_param_;
-}
-inline ::caffe::WindowDataParameter* V1LayerParameter::mutable_window_data_param() {
-  set_has_window_data_param();
-  if (window_data_param_ == NULL) window_data_param_ = new ::caffe::WindowDataParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.window_data_param)
-  return window_data_param_;
-}
-inline ::caffe::WindowDataParameter* V1LayerParameter::release_window_data_param() {
-  clear_has_window_data_param();
-  ::caffe::WindowDataParameter* temp = window_data_param_;
-  window_data_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_window_data_param(::caffe::WindowDataParameter* window_data_param) {
-  delete window_data_param_;
-  window_data_param_ = window_data_param;
-  if (window_data_param) {
-    set_has_window_data_param();
-  } else {
-    clear_has_window_data_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.window_data_param)
-}
-
-// optional .caffe.TransformationParameter transform_param = 36;
-inline bool V1LayerParameter::has_transform_param() const {
-  return (_has_bits_[1] & 0x00000100u) != 0;
-}
-inline void V1LayerParameter::set_has_transform_param() {
-  _has_bits_[1] |= 0x00000100u;
-}
-inline void V1LayerParameter::clear_has_transform_param() {
-  _has_bits_[1] &= ~0x00000100u;
-}
-inline void V1LayerParameter::clear_transform_param() {
-  if (transform_param_ != NULL) transform_param_->::caffe::TransformationParameter::Clear();
-  clear_has_transform_param();
-}
-inline const ::caffe::TransformationParameter& V1LayerParameter::transform_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.transform_param)
-  return transform_param_ != NULL ? *transform_param_ : *default_instance_->transform_param_;
-}
-inline ::caffe::TransformationParameter* V1LayerParameter::mutable_transform_param() {
-  set_has_transform_param();
-  if (transform_param_ == NULL) transform_param_ = new ::caffe::TransformationParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.transform_param)
-  return transform_param_;
-}
-inline ::caffe::TransformationParameter* V1LayerParameter::release_transform_param() {
-  clear_has_transform_param();
-  ::caffe::TransformationParameter* temp = transform_param_;
-  transform_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_transform_param(::caffe::TransformationParameter* transform_param) {
-  delete transform_param_;
-  transform_param_ = transform_param;
-  if (transform_param) {
-    set_has_transform_param();
-  } else {
-    clear_has_transform_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.transform_param)
-}
-
-// optional .caffe.LossParameter loss_param = 42;
-inline bool V1LayerParameter::has_loss_param() const {
-  return (_has_bits_[1] & 0x00000200u) != 0;
-}
-inline void V1LayerParameter::set_has_loss_param() {
-  _has_bits_[1] |= 0x00000200u;
-}
-inline void V1LayerParameter::clear_has_loss_param() {
-  _has_bits_[1] &= ~0x00000200u;
-}
-inline void V1LayerParameter::clear_loss_param() {
-  if (loss_param_ != NULL) loss_param_->::caffe::LossParameter::Clear();
-  clear_has_loss_param();
-}
-inline const ::caffe::LossParameter& V1LayerParameter::loss_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.loss_param)
-  return loss_param_ != NULL ? *loss_param_ : *default_instance_->loss_param_;
-}
-inline ::caffe::LossParameter* V1LayerParameter::mutable_loss_param() {
-  set_has_loss_param();
-  if (loss_param_ == NULL) loss_param_ = new ::caffe::LossParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.loss_param)
-  return loss_param_;
-}
-inline ::caffe::LossParameter* V1LayerParameter::release_loss_param() {
-  clear_has_loss_param();
-  ::caffe::LossParameter* temp = loss_param_;
-  loss_param_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_loss_param(::caffe::LossParameter* loss_param) {
-  delete loss_param_;
-  loss_param_ = loss_param;
-  if (loss_param) {
-    set_has_loss_param();
-  } else {
-    clear_has_loss_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.loss_param)
-}
-
-// optional .caffe.V0LayerParameter layer = 1;
-inline bool V1LayerParameter::has_layer() const {
-  return (_has_bits_[1] & 0x00000400u) != 0;
-}
-inline void V1LayerParameter::set_has_layer() {
-  _has_bits_[1] |= 0x00000400u;
-}
-inline void V1LayerParameter::clear_has_layer() {
-  _has_bits_[1] &= ~0x00000400u;
-}
-inline void V1LayerParameter::clear_layer() {
-  if (layer_ != NULL) layer_->::caffe::V0LayerParameter::Clear();
-  clear_has_layer();
-}
-inline const ::caffe::V0LayerParameter& V1LayerParameter::layer() const {
-  // @@protoc_insertion_point(field_get:caffe.V1LayerParameter.layer)
-  return layer_ != NULL ? *layer_ : *default_instance_->layer_;
-}
-inline ::caffe::V0LayerParameter* V1LayerParameter::mutable_layer() {
-  set_has_layer();
-  if (layer_ == NULL) layer_ = new ::caffe::V0LayerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V1LayerParameter.layer)
-  return layer_;
-}
-inline ::caffe::V0LayerParameter* V1LayerParameter::release_layer() {
-  clear_has_layer();
-  ::caffe::V0LayerParameter* temp = layer_;
-  layer_ = NULL;
-  return temp;
-}
-inline void V1LayerParameter::set_allocated_layer(::caffe::V0LayerParameter* layer) {
-  delete layer_;
-  layer_ = layer;
-  if (layer) {
-    set_has_layer();
-  } else {
-    clear_has_layer();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V1LayerParameter.layer)
-}
-
-// -------------------------------------------------------------------
-
-// V0LayerParameter
-
-// optional string name = 1;
-inline bool V0LayerParameter::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void V0LayerParameter::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void V0LayerParameter::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void V0LayerParameter::clear_name() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& V0LayerParameter::name() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.name)
-  return *name_;
-}
-inline void V0LayerParameter::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.name)
-}
-inline void V0LayerParameter::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V0LayerParameter.name)
-}
-inline void V0LayerParameter::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V0LayerParameter.name)
-}
-inline ::std::string* V0LayerParameter::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    name_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.name)
-  return name_;
-}
-inline ::std::string* V0LayerParameter::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void V0LayerParameter::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.name)
-}
-
-// optional string type = 2;
-inline bool V0LayerParameter::has_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void V0LayerParameter::set_has_type() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void V0LayerParameter::clear_has_type() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void V0LayerParameter::clear_type() {
-  if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_->clear();
-  }
-  clear_has_type();
-}
-inline const ::std::string& V0LayerParameter::type() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.type)
-  return *type_;
-}
-inline void V0LayerParameter::set_type(const ::std::string& value) {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.type)
-}
-inline void V0LayerParameter::set_type(const char* value) {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  type_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V0LayerParameter.type)
-}
-inline void V0LayerParameter::set_type(const char* value, size_t size) {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  type_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V0LayerParameter.type)
-}
-inline ::std::string* V0LayerParameter::mutable_type() {
-  set_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    type_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.type)
-  return type_;
-}
-inline ::std::string* V0LayerParameter::release_type() {
-  clear_has_type();
-  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = type_;
-    type_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void V0LayerParameter::set_allocated_type(::std::string* type) {
-  if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete type_;
-  }
-  if (type) {
-    set_has_type();
-    type_ = type;
-  } else {
-    clear_has_type();
-    type_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.type)
-}
-
-// optional uint32 num_output = 3;
-inline bool V0LayerParameter::has_num_output() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void V0LayerParameter::set_has_num_output() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void V0LayerParameter::clear_has_num_output() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void V0LayerParameter::clear_num_output() {
-  num_output_ = 0u;
-  clear_has_num_output();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::num_output() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.num_output)
-  return num_output_;
-}
-inline void V0LayerParameter::set_num_output(::google::protobuf::uint32 value) {
-  set_has_num_output();
-  num_output_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.num_output)
-}
-
-// optional bool biasterm = 4 [default = true];
-inline bool V0LayerParameter::has_biasterm() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void V0LayerParameter::set_has_biasterm() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void V0LayerParameter::clear_has_biasterm() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void V0LayerParameter::clear_biasterm() {
-  biasterm_ = true;
-  clear_has_biasterm();
-}
-inline bool V0LayerParameter::biasterm() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.biasterm)
-  return biasterm_;
-}
-inline void V0LayerParameter::set_biasterm(bool value) {
-  set_has_biasterm();
-  biasterm_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.biasterm)
-}
-
-// optional .caffe.FillerParameter weight_filler = 5;
-inline bool V0LayerParameter::has_weight_filler() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void V0LayerParameter::set_has_weight_filler() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void V0LayerParameter::clear_has_weight_filler() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void V0LayerParameter::clear_weight_filler() {
-  if (weight_filler_ != NULL) weight_filler_->::caffe::FillerParameter::Clear();
-  clear_has_weight_filler();
-}
-inline const ::caffe::FillerParameter& V0LayerParameter::weight_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.weight_filler)
-  return weight_filler_ != NULL ? *weight_filler_ : *default_instance_->weight_filler_;
-}
-inline ::caffe::FillerParameter* V0LayerParameter::mutable_weight_filler() {
-  set_has_weight_filler();
-  if (weight_filler_ == NULL) weight_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.weight_filler)
-  return weight_filler_;
-}
-inline ::caffe::FillerParameter* V0LayerParameter::release_weight_filler() {
-  clear_has_weight_filler();
-  ::caffe::FillerParameter* temp = weight_filler_;
-  weight_filler_ = NULL;
-  return temp;
-}
-inline void V0LayerParameter::set_allocated_weight_filler(::caffe::FillerParameter* weight_filler) {
-  delete weight_filler_;
-  weight_filler_ = weight_filler;
-  if (weight_filler) {
-    set_has_weight_filler();
-  } else {
-    clear_has_weight_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.weight_filler)
-}
-
-// optional .caffe.FillerParameter bias_filler = 6;
-inline bool V0LayerParameter::has_bias_filler() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void V0LayerParameter::set_has_bias_filler() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void V0LayerParameter::clear_has_bias_filler() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void V0LayerParameter::clear_bias_filler() {
-  if (bias_filler_ != NULL) bias_filler_->::caffe::FillerParameter::Clear();
-  clear_has_bias_filler();
-}
-inline const ::caffe::FillerParameter& V0LayerParameter::bias_filler() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.bias_filler)
-  return bias_filler_ != NULL ? *bias_filler_ : *default_instance_->bias_filler_;
-}
-inline ::caffe::FillerParameter* V0LayerParameter::mutable_bias_filler() {
-  set_has_bias_filler();
-  if (bias_filler_ == NULL) bias_filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.bias_filler)
-  return bias_filler_;
-}
-inline ::caffe::FillerParameter* V0LayerParameter::release_bias_filler() {
-  clear_has_bias_filler();
-  ::caffe::FillerParameter* temp = bias_filler_;
-  bias_filler_ = NULL;
-  return temp;
-}
-inline void V0LayerParameter::set_allocated_bias_filler(::caffe::FillerParameter* bias_filler) {
-  delete bias_filler_;
-  bias_filler_ = bias_filler;
-  if (bias_filler) {
-    set_has_bias_filler();
-  } else {
-    clear_has_bias_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.bias_filler)
-}
-
-// optional uint32 pad = 7 [default = 0];
-inline bool V0LayerParameter::has_pad() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void V0LayerParameter::set_has_pad() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void V0LayerParameter::clear_has_pad() {
-  _has_bits_[0] &= ~0x00000040u;
-}
-inline void V0LayerParameter::clear_pad() {
-  pad_ = 0u;
-  clear_has_pad();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::pad() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.pad)
-  return pad_;
-}
-inline void V0LayerParameter::set_pad(::google::protobuf::uint32 value) {
-  set_has_pad();
-  pad_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.pad)
-}
-
-// optional uint32 kernelsize = 8;
-inline bool V0LayerParameter::has_kernelsize() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void V0LayerParameter::set_has_kernelsize() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void V0LayerParameter::clear_has_kernelsize() {
-  _has_bits_[0] &= ~0x00000080u;
-}
-inline void V0LayerParameter::clear_kernelsize() {
-  kernelsize_ = 0u;
-  clear_has_kernelsize();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::kernelsize() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.kernelsize)
-  return kernelsize_;
-}
-inline void V0LayerParameter::set_kernelsize(::google::protobuf::uint32 value) {
-  set_has_kernelsize();
-  kernelsize_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.kernelsize)
-}
-
-// optional uint32 group = 9 [default = 1];
-inline bool V0LayerParameter::has_group() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void V0LayerParameter::set_has_group() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void V0LayerParameter::clear_has_group() {
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline void V0LayerParameter::clear_group() {
-  group_ = 1u;
-  clear_has_group();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::group() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.group)
-  return group_;
-}
-inline void V0LayerParameter::set_group(::google::protobuf::uint32 value) {
-  set_has_group();
-  group_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.group)
-}
-
-// optional uint32 stride = 10 [default = 1];
-inline bool V0LayerParameter::has_stride() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void V0LayerParameter::set_has_stride() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void V0LayerParameter::clear_has_stride() {
-  _has_bits_[0] &= ~0x00000200u;
-}
-inline void V0LayerParameter::clear_stride() {
-  stride_ = 1u;
-  clear_has_stride();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::stride() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.stride)
-  return stride_;
-}
-inline void V0LayerParameter::set_stride(::google::protobuf::uint32 value) {
-  set_has_stride();
-  stride_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.stride)
-}
-
-// optional .caffe.V0LayerParameter.PoolMethod pool = 11 [default = MAX];
-inline bool V0LayerParameter::has_pool() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
-}
-inline void V0LayerParameter::set_has_pool() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void V0LayerParameter::clear_has_pool() {
-  _has_bits_[0] &= ~0x00000400u;
-}
-inline void V0LayerParameter::clear_pool() {
-  pool_ = 0;
-  clear_has_pool();
-}
-inline ::caffe::V0LayerParameter_PoolMethod V0LayerParameter::pool() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.pool)
-  return static_cast< ::caffe::V0LayerParameter_PoolMethod >(pool_);
-}
-inline void V0LayerParameter::set_pool(::caffe::V0LayerParameter_PoolMethod value) {
-  assert(::caffe::V0LayerParameter_PoolMethod_IsValid(value));
-  set_has_pool();
-  pool_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.pool)
-}
-
-// optional float dropout_ratio = 12 [default = 0.5];
-inline bool V0LayerParameter::has_dropout_ratio() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void V0LayerParameter::set_has_dropout_ratio() {
-  _has_bits_[0] |= 0x00000800u;
-}
-inline void V0LayerParameter::clear_has_dropout_ratio() {
-  _has_bits_[0] &= ~0x00000800u;
-}
-inline void V0LayerParameter::clear_dropout_ratio() {
-  dropout_ratio_ = 0.5f;
-  clear_has_dropout_ratio();
-}
-inline float V0LayerParameter::dropout_ratio() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.dropout_ratio)
-  return dropout_ratio_;
-}
-inline void V0LayerParameter::set_dropout_ratio(float value) {
-  set_has_dropout_ratio();
-  dropout_ratio_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.dropout_ratio)
-}
-
-// optional uint32 local_size = 13 [default = 5];
-inline bool V0LayerParameter::has_local_size() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
-}
-inline void V0LayerParameter::set_has_local_size() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void V0LayerParameter::clear_has_local_size() {
-  _has_bits_[0] &= ~0x00001000u;
-}
-inline void V0LayerParameter::clear_local_size() {
-  local_size_ = 5u;
-  clear_has_local_size();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::local_size() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.local_size)
-  return local_size_;
-}
-inline void V0LayerParameter::set_local_size(::google::protobuf::uint32 value) {
-  set_has_local_size();
-  local_size_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.local_size)
-}
-
-// optional float alpha = 14 [default = 1];
-inline bool V0LayerParameter::has_alpha() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void V0LayerParameter::set_has_alpha() {
-  _has_bits_[0] |= 0x00002000u;
-}
-inline void V0LayerParameter::clear_has_alpha() {
-  _has_bits_[0] &= ~0x00002000u;
-}
-inline void V0LayerParameter::clear_alpha() {
-  alpha_ = 1;
-  clear_has_alpha();
-}
-inline float V0LayerParameter::alpha() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.alpha)
-  return alpha_;
-}
-inline void V0LayerParameter::set_alpha(float value) {
-  set_has_alpha();
-  alpha_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.alpha)
-}
-
-// optional float beta = 15 [default = 0.75];
-inline bool V0LayerParameter::has_beta() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
-}
-inline void V0LayerParameter::set_has_beta() {
-  _has_bits_[0] |= 0x00004000u;
-}
-inline void V0LayerParameter::clear_has_beta() {
-  _has_bits_[0] &= ~0x00004000u;
-}
-inline void V0LayerParameter::clear_beta() {
-  beta_ = 0.75f;
-  clear_has_beta();
-}
-inline float V0LayerParameter::beta() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.beta)
-  return beta_;
-}
-inline void V0LayerParameter::set_beta(float value) {
-  set_has_beta();
-  beta_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.beta)
-}
-
-// optional float k = 22 [default = 1];
-inline bool V0LayerParameter::has_k() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-inline void V0LayerParameter::set_has_k() {
-  _has_bits_[0] |= 0x00008000u;
-}
-inline void V0LayerParameter::clear_has_k() {
-  _has_bits_[0] &= ~0x00008000u;
-}
-inline void V0LayerParameter::clear_k() {
-  k_ = 1;
-  clear_has_k();
-}
-inline float V0LayerParameter::k() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.k)
-  return k_;
-}
-inline void V0LayerParameter::set_k(float value) {
-  set_has_k();
-  k_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.k)
-}
-
-// optional string source = 16;
-inline bool V0LayerParameter::has_source() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
-}
-inline void V0LayerParameter::set_has_source() {
-  _has_bits_[0] |= 0x00010000u;
-}
-inline void V0LayerParameter::clear_has_source() {
-  _has_bits_[0] &= ~0x00010000u;
-}
-inline void V0LayerParameter::clear_source() {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_->clear();
-  }
-  clear_has_source();
-}
-inline const ::std::string& V0LayerParameter::source() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.source)
-  return *source_;
-}
-inline void V0LayerParameter::set_source(const ::std::string& value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.source)
-}
-inline void V0LayerParameter::set_source(const char* value) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V0LayerParameter.source)
-}
-inline void V0LayerParameter::set_source(const char* value, size_t size) {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  source_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V0LayerParameter.source)
-}
-inline ::std::string* V0LayerParameter::mutable_source() {
-  set_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    source_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.source)
-  return source_;
-}
-inline ::std::string* V0LayerParameter::release_source() {
-  clear_has_source();
-  if (source_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = source_;
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void V0LayerParameter::set_allocated_source(::std::string* source) {
-  if (source_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete source_;
-  }
-  if (source) {
-    set_has_source();
-    source_ = source;
-  } else {
-    clear_has_source();
-    source_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.source)
-}
-
-// optional float scale = 17 [default = 1];
-inline bool V0LayerParameter::has_scale() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
-}
-inline void V0LayerParameter::set_has_scale() {
-  _has_bits_[0] |= 0x00020000u;
-}
-inline void V0LayerParameter::clear_has_scale() {
-  _has_bits_[0] &= ~0x00020000u;
-}
-inline void V0LayerParameter::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
-}
-inline float V0LayerParameter::scale() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.scale)
-  return scale_;
-}
-inline void V0LayerParameter::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.scale)
-}
-
-// optional string meanfile = 18;
-inline bool V0LayerParameter::has_meanfile() const {
-  return (_has_bits_[0] & 0x00040000u) != 0;
-}
-inline void V0LayerParameter::set_has_meanfile() {
-  _has_bits_[0] |= 0x00040000u;
-}
-inline void V0LayerParameter::clear_has_meanfile() {
-  _has_bits_[0] &= ~0x00040000u;
-}
-inline void V0LayerParameter::clear_meanfile() {
-  if (meanfile_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    meanfile_->clear();
-  }
-  clear_has_meanfile();
-}
-inline const ::std::string& V0LayerParameter::meanfile() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.meanfile)
-  return *meanfile_;
-}
-inline void V0LayerParameter::set_meanfile(const ::std::string& value) {
-  set_has_meanfile();
-  if (meanfile_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    meanfile_ = new ::std::string;
-  }
-  meanfile_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.meanfile)
-}
-inline void V0LayerParameter::set_meanfile(const char* value) {
-  set_has_meanfile();
-  if (meanfile_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    meanfile_ = new ::std::string;
-  }
-  meanfile_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V0LayerParameter.meanfile)
-}
-inline void V0LayerParameter::set_meanfile(const char* value, size_t size) {
-  set_has_meanfile();
-  if (meanfile_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    meanfile_ = new ::std::string;
-  }
-  meanfile_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V0LayerParameter.meanfile)
-}
-inline ::std::string* V0LayerParameter::mutable_meanfile() {
-  set_has_meanfile();
-  if (meanfile_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    meanfile_ = new ::std::string;
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.meanfile)
-  return meanfile_;
-}
-inline ::std::string* V0LayerParameter::release_meanfile() {
-  clear_has_meanfile();
-  if (meanfile_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    return NULL;
-  } else {
-    ::std::string* temp = meanfile_;
-    meanfile_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    return temp;
-  }
-}
-inline void V0LayerParameter::set_allocated_meanfile(::std::string* meanfile) {
-  if (meanfile_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete meanfile_;
-  }
-  if (meanfile) {
-    set_has_meanfile();
-    meanfile_ = meanfile;
-  } else {
-    clear_has_meanfile();
-    meanfile_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.meanfile)
-}
-
-// optional uint32 batchsize = 19;
-inline bool V0LayerParameter::has_batchsize() const {
-  return (_has_bits_[0] & 0x00080000u) != 0;
-}
-inline void V0LayerParameter::set_has_batchsize() {
-  _has_bits_[0] |= 0x00080000u;
-}
-inline void V0LayerParameter::clear_has_batchsize() {
-  _has_bits_[0] &= ~0x00080000u;
-}
-inline void V0LayerParameter::clear_batchsize() {
-  batchsize_ = 0u;
-  clear_has_batchsize();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::batchsize() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.batchsize)
-  return batchsize_;
-}
-inline void V0LayerParameter::set_batchsize(::google::protobuf::uint32 value) {
-  set_has_batchsize();
-  batchsize_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.batchsize)
-}
-
-// optional uint32 cropsize = 20 [default = 0];
-inline bool V0LayerParameter::has_cropsize() const {
-  return (_has_bits_[0] & 0x00100000u) != 0;
-}
-inline void V0LayerParameter::set_has_cropsize() {
-  _has_bits_[0] |= 0x00100000u;
-}
-inline void V0LayerParameter::clear_has_cropsize() {
-  _has_bits_[0] &= ~0x00100000u;
-}
-inline void V0LayerParameter::clear_cropsize() {
-  cropsize_ = 0u;
-  clear_has_cropsize();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::cropsize() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.cropsize)
-  return cropsize_;
-}
-inline void V0LayerParameter::set_cropsize(::google::protobuf::uint32 value) {
-  set_has_cropsize();
-  cropsize_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.cropsize)
-}
-
-// optional bool mirror = 21 [default = false];
-inline bool V0LayerParameter::has_mirror() const {
-  return (_has_bits_[0] & 0x00200000u) != 0;
-}
-inline void V0LayerParameter::set_has_mirror() {
-  _has_bits_[0] |= 0x00200000u;
-}
-inline void V0LayerParameter::clear_has_mirror() {
-  _has_bits_[0] &= ~0x00200000u;
-}
-inline void V0LayerParameter::clear_mirror() {
-  mirror_ = false;
-  clear_has_mirror();
-}
-inline bool V0LayerParameter::mirror() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.mirror)
-  return mirror_;
-}
-inline void V0LayerParameter::set_mirror(bool value) {
-  set_has_mirror();
-  mirror_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.mirror)
-}
-
-// repeated .caffe.BlobProto blobs = 50;
-inline int V0LayerParameter::blobs_size() const {
-  return blobs_.size();
-}
-inline void V0LayerParameter::clear_blobs() {
-  blobs_.Clear();
-}
-inline const ::caffe::BlobProto& V0LayerParameter::blobs(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.blobs)
-  return blobs_.Get(index);
-}
-inline ::caffe::BlobProto* V0LayerParameter::mutable_blobs(int index) {
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.blobs)
-  return blobs_.Mutable(index);
-}
-inline ::caffe::BlobProto* V0LayerParameter::add_blobs() {
-  // @@protoc_insertion_point(field_add:caffe.V0LayerParameter.blobs)
-  return blobs_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-V0LayerParameter::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.V0LayerParameter.blobs)
-  return blobs_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
-V0LayerParameter::mutable_blobs() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V0LayerParameter.blobs)
-  return &blobs_;
-}
-
-// repeated float blobs_lr = 51;
-inline int V0LayerParameter::blobs_lr_size() const {
-  return blobs_lr_.size();
-}
-inline void V0LayerParameter::clear_blobs_lr() {
-  blobs_lr_.Clear();
-}
-inline float V0LayerParameter::blobs_lr(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.blobs_lr)
-  return blobs_lr_.Get(index);
-}
-inline void V0LayerParameter::set_blobs_lr(int index, float value) {
-  blobs_lr_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.blobs_lr)
-}
-inline void V0LayerParameter::add_blobs_lr(float value) {
-  blobs_lr_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.V0LayerParameter.blobs_lr)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-V0LayerParameter::blobs_lr() const {
-  // @@protoc_insertion_point(field_list:caffe.V0LayerParameter.blobs_lr)
-  return blobs_lr_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-V0LayerParameter::mutable_blobs_lr() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V0LayerParameter.blobs_lr)
-  return &blobs_lr_;
-}
-
-// repeated float weight_decay = 52;
-inline int V0LayerParameter::weight_decay_size() const {
-  return weight_decay_.size();
-}
-inline void V0LayerParameter::clear_weight_decay() {
-  weight_decay_.Clear();
-}
-inline float V0LayerParameter::weight_decay(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.weight_decay)
-  return weight_decay_.Get(index);
-}
-inline void V0LayerParameter::set_weight_decay(int index, float value) {
-  weight_decay_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.weight_decay)
-}
-inline void V0LayerParameter::add_weight_decay(float value) {
-  weight_decay_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.V0LayerParameter.weight_decay)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-V0LayerParameter::weight_decay() const {
-  // @@protoc_insertion_point(field_list:caffe.V0LayerParameter.weight_decay)
-  return weight_decay_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-V0LayerParameter::mutable_weight_decay() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.V0LayerParameter.weight_decay)
-  return &weight_decay_;
-}
-
-// optional uint32 rand_skip = 53 [default = 0];
-inline bool V0LayerParameter::has_rand_skip() const {
-  return (_has_bits_[0] & 0x02000000u) != 0;
-}
-inline void V0LayerParameter::set_has_rand_skip() {
-  _has_bits_[0] |= 0x02000000u;
-}
-inline void V0LayerParameter::clear_has_rand_skip() {
-  _has_bits_[0] &= ~0x02000000u;
-}
-inline void V0LayerParameter::clear_rand_skip() {
-  rand_skip_ = 0u;
-  clear_has_rand_skip();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::rand_skip() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.rand_skip)
-  return rand_skip_;
-}
-inline void V0LayerParameter::set_rand_skip(::google::protobuf::uint32 value) {
-  set_has_rand_skip();
-  rand_skip_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.rand_skip)
-}
-
-// optional float det_fg_threshold = 54 [default = 0.5];
-inline bool V0LayerParameter::has_det_fg_threshold() const {
-  return (_has_bits_[0] & 0x04000000u) != 0;
-}
-inline void V0LayerParameter::set_has_det_fg_threshold() {
-  _has_bits_[0] |= 0x04000000u;
-}
-inline void V0LayerParameter::clear_has_det_fg_threshold() {
-  _has_bits_[0] &= ~0x04000000u;
-}
-inline void V0LayerParameter::clear_det_fg_threshold() {
-  det_fg_threshold_ = 0.5f;
-  clear_has_det_fg_threshold();
-}
-inline float V0LayerParameter::det_fg_threshold() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.det_fg_threshold)
-  return det_fg_threshold_;
-}
-inline void V0LayerParameter::set_det_fg_threshold(float value) {
-  set_has_det_fg_threshold();
-  det_fg_threshold_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.det_fg_threshold)
-}
-
-// optional float det_bg_threshold = 55 [default = 0.5];
-inline bool V0LayerParameter::has_det_bg_threshold() const {
-  return (_has_bits_[0] & 0x08000000u) != 0;
-}
-inline void V0LayerParameter::set_has_det_bg_threshold() {
-  _has_bits_[0] |= 0x08000000u;
-}
-inline void V0LayerParameter::clear_has_det_bg_threshold() {
-  _has_bits_[0] &= ~0x08000000u;
-}
-inline void V0LayerParameter::clear_det_bg_threshold() {
-  det_bg_threshold_ = 0.5f;
-  clear_has_det_bg_threshold();
-}
-inline float V0LayerParameter::det_bg_threshold() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.det_bg_threshold)
-  return det_bg_threshold_;
-}
-inline void V0LayerParameter::set_det_bg_threshold(float value) {
-  set_has_det_bg_threshold();
-  det_bg_threshold_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.det_bg_threshold)
-}
-
-// optional float det_fg_fraction = 56 [default = 0.25];
-inline bool V0LayerParameter::has_det_fg_fraction() const {
-  return (_has_bits_[0] & 0x10000000u) != 0;
-}
-inline void V0LayerParameter::set_has_det_fg_fraction() {
-  _has_bits_[0] |= 0x10000000u;
-}
-inline void V0LayerParameter::clear_has_det_fg_fraction() {
-  _has_bits_[0] &= ~0x10000000u;
-}
-inline void V0LayerParameter::clear_det_fg_fraction() {
-  det_fg_fraction_ = 0.25f;
-  clear_has_det_fg_fraction();
-}
-inline float V0LayerParameter::det_fg_fraction() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.det_fg_fraction)
-  return det_fg_fraction_;
-}
-inline void V0LayerParameter::set_det_fg_fraction(float value) {
-  set_has_det_fg_fraction();
-  det_fg_fraction_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.det_fg_fraction)
-}
-
-// optional uint32 det_context_pad = 58 [default = 0];
-inline bool V0LayerParameter::has_det_context_pad() const {
-  return (_has_bits_[0] & 0x20000000u) != 0;
-}
-inline void V0LayerParameter::set_has_det_context_pad() {
-  _has_bits_[0] |= 0x20000000u;
-}
-inline void V0LayerParameter::clear_has_det_context_pad() {
-  _has_bits_[0] &= ~0x20000000u;
-}
-inline void V0LayerParameter::clear_det_context_pad() {
-  det_context_pad_ = 0u;
-  clear_has_det_context_pad();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::det_context_pad() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.det_context_pad)
-  return det_context_pad_;
-}
-inline void V0LayerParameter::set_det_context_pad(::google::protobuf::uint32 value) {
-  set_has_det_context_pad();
-  det_context_pad_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.det_context_pad)
-}
-
-// optional string det_crop_mode = 59 [default = "warp"];
-inline bool V0LayerParameter::has_det_crop_mode() const {
-  return (_has_bits_[0] & 0x40000000u) != 0;
-}
-inline void V0LayerParameter::set_has_det_crop_mode() {
-  _has_bits_[0] |= 0x40000000u;
-}
-inline void V0LayerParameter::clear_has_det_crop_mode() {
-  _has_bits_[0] &= ~0x40000000u;
-}
-inline void V0LayerParameter::clear_det_crop_mode() {
-  if (det_crop_mode_ != _default_det_crop_mode_) {
-    det_crop_mode_->assign(*_default_det_crop_mode_);
-  }
-  clear_has_det_crop_mode();
-}
-inline const ::std::string& V0LayerParameter::det_crop_mode() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.det_crop_mode)
-  return *det_crop_mode_;
-}
-inline void V0LayerParameter::set_det_crop_mode(const ::std::string& value) {
-  set_has_det_crop_mode();
-  if (det_crop_mode_ == _default_det_crop_mode_) {
-    det_crop_mode_ = new ::std::string;
-  }
-  det_crop_mode_->assign(value);
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.det_crop_mode)
-}
-inline void V0LayerParameter::set_det_crop_mode(const char* value) {
-  set_has_det_crop_mode();
-  if (det_crop_mode_ == _default_det_crop_mode_) {
-    det_crop_mode_ = new ::std::string;
-  }
-  det_crop_mode_->assign(value);
-  // @@protoc_insertion_point(field_set_char:caffe.V0LayerParameter.det_crop_mode)
-}
-inline void V0LayerParameter::set_det_crop_mode(const char* value, size_t size) {
-  set_has_det_crop_mode();
-  if (det_crop_mode_ == _default_det_crop_mode_) {
-    det_crop_mode_ = new ::std::string;
-  }
-  det_crop_mode_->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:caffe.V0LayerParameter.det_crop_mode)
-}
-inline ::std::string* V0LayerParameter::mutable_det_crop_mode() {
-  set_has_det_crop_mode();
-  if (det_crop_mode_ == _default_det_crop_mode_) {
-    det_crop_mode_ = new ::std::string(*_default_det_crop_mode_);
-  }
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.det_crop_mode)
-  return det_crop_mode_;
-}
-inline ::std::string* V0LayerParameter::release_det_crop_mode() {
-  clear_has_det_crop_mode();
-  if (det_crop_mode_ == _default_det_crop_mode_) {
-    return NULL;
-  } else {
-    ::std::string* temp = det_crop_mode_;
-    det_crop_mode_ = const_cast< ::std::string*>(_default_det_crop_mode_);
-    return temp;
-  }
-}
-inline void V0LayerParameter::set_allocated_det_crop_mode(::std::string* det_crop_mode) {
-  if (det_crop_mode_ != _default_det_crop_mode_) {
-    delete det_crop_mode_;
-  }
-  if (det_crop_mode) {
-    set_has_det_crop_mode();
-    det_crop_mode_ = det_crop_mode;
-  } else {
-    clear_has_det_crop_mode();
-    det_crop_mode_ = const_cast< ::std::string*>(_default_det_crop_mode_);
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.det_crop_mode)
-}
-
-// optional int32 new_num = 60 [default = 0];
-inline bool V0LayerParameter::has_new_num() const {
-  return (_has_bits_[0] & 0x80000000u) != 0;
-}
-inline void V0LayerParameter::set_has_new_num() {
-  _has_bits_[0] |= 0x80000000u;
-}
-inline void V0LayerParameter::clear_has_new_num() {
-  _has_bits_[0] &= ~0x80000000u;
-}
-inline void V0LayerParameter::clear_new_num() {
-  new_num_ = 0;
-  clear_has_new_num();
-}
-inline ::google::protobuf::int32 V0LayerParameter::new_num() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.new_num)
-  return new_num_;
-}
-inline void V0LayerParameter::set_new_num(::google::protobuf::int32 value) {
-  set_has_new_num();
-  new_num_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.new_num)
-}
-
-// optional int32 new_channels = 61 [default = 0];
-inline bool V0LayerParameter::has_new_channels() const {
-  return (_has_bits_[1] & 0x00000001u) != 0;
-}
-inline void V0LayerParameter::set_has_new_channels() {
-  _has_bits_[1] |= 0x00000001u;
-}
-inline void V0LayerParameter::clear_has_new_channels() {
-  _has_bits_[1] &= ~0x00000001u;
-}
-inline void V0LayerParameter::clear_new_channels() {
-  new_channels_ = 0;
-  clear_has_new_channels();
-}
-inline ::google::protobuf::int32 V0LayerParameter::new_channels() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.new_channels)
-  return new_channels_;
-}
-inline void V0LayerParameter::set_new_channels(::google::protobuf::int32 value) {
-  set_has_new_channels();
-  new_channels_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.new_channels)
-}
-
-// optional int32 new_height = 62 [default = 0];
-inline bool V0LayerParameter::has_new_height() const {
-  return (_has_bits_[1] & 0x00000002u) != 0;
-}
-inline void V0LayerParameter::set_has_new_height() {
-  _has_bits_[1] |= 0x00000002u;
-}
-inline void V0LayerParameter::clear_has_new_height() {
-  _has_bits_[1] &= ~0x00000002u;
-}
-inline void V0LayerParameter::clear_new_height() {
-  new_height_ = 0;
-  clear_has_new_height();
-}
-inline ::google::protobuf::int32 V0LayerParameter::new_height() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.new_height)
-  return new_height_;
-}
-inline void V0LayerParameter::set_new_height(::google::protobuf::int32 value) {
-  set_has_new_height();
-  new_height_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.new_height)
-}
-
-// optional int32 new_width = 63 [default = 0];
-inline bool V0LayerParameter::has_new_width() const {
-  return (_has_bits_[1] & 0x00000004u) != 0;
-}
-inline void V0LayerParameter::set_has_new_width() {
-  _has_bits_[1] |= 0x00000004u;
-}
-inline void V0LayerParameter::clear_has_new_width() {
-  _has_bits_[1] &= ~0x00000004u;
-}
-inline void V0LayerParameter::clear_new_width() {
-  new_width_ = 0;
-  clear_has_new_width();
-}
-inline ::google::protobuf::int32 V0LayerParameter::new_width() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.new_width)
-  return new_width_;
-}
-inline void V0LayerParameter::set_new_width(::google::protobuf::int32 value) {
-  set_has_new_width();
-  new_width_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.new_width)
-}
-
-// optional bool shuffle_images = 64 [default = false];
-inline bool V0LayerParameter::has_shuffle_images() const {
-  return (_has_bits_[1] & 0x00000008u) != 0;
-}
-inline void V0LayerParameter::set_has_shuffle_images() {
-  _has_bits_[1] |= 0x00000008u;
-}
-inline void V0LayerParameter::clear_has_shuffle_images() {
-  _has_bits_[1] &= ~0x00000008u;
-}
-inline void V0LayerParameter::clear_shuffle_images() {
-  shuffle_images_ = false;
-  clear_has_shuffle_images();
-}
-inline bool V0LayerParameter::shuffle_images() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.shuffle_images)
-  return shuffle_images_;
-}
-inline void V0LayerParameter::set_shuffle_images(bool value) {
-  set_has_shuffle_images();
-  shuffle_images_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.shuffle_images)
-}
-
-// optional uint32 concat_dim = 65 [default = 1];
-inline bool V0LayerParameter::has_concat_dim() const {
-  return (_has_bits_[1] & 0x00000010u) != 0;
-}
-inline void V0LayerParameter::set_has_concat_dim() {
-  _has_bits_[1] |= 0x00000010u;
-}
-inline void V0LayerParameter::clear_has_concat_dim() {
-  _has_bits_[1] &= ~0x00000010u;
-}
-inline void V0LayerParameter::clear_concat_dim() {
-  concat_dim_ = 1u;
-  clear_has_concat_dim();
-}
-inline ::google::protobuf::uint32 V0LayerParameter::concat_dim() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.concat_dim)
-  return concat_dim_;
-}
-inline void V0LayerParameter::set_concat_dim(::google::protobuf::uint32 value) {
-  set_has_concat_dim();
-  concat_dim_ = value;
-  // @@protoc_insertion_point(field_set:caffe.V0LayerParameter.concat_dim)
-}
-
-// optional .caffe.HDF5OutputParameter hdf5_output_param = 1001;
-inline bool V0LayerParameter::has_hdf5_output_param() const {
-  return (_has_bits_[1] & 0x00000020u) != 0;
-}
-inline void V0LayerParameter::set_has_hdf5_output_param() {
-  _has_bits_[1] |= 0x00000020u;
-}
-inline void V0LayerParameter::clear_has_hdf5_output_param() {
-  _has_bits_[1] &= ~0x00000020u;
-}
-inline void V0LayerParameter::clear_hdf5_output_param() {
-  if (hdf5_output_param_ != NULL) hdf5_output_param_->::caffe::HDF5OutputParameter::Clear();
-  clear_has_hdf5_output_param();
-}
-inline const ::caffe::HDF5OutputParameter& V0LayerParameter::hdf5_output_param() const {
-  // @@protoc_insertion_point(field_get:caffe.V0LayerParameter.hdf5_output_param)
-  return hdf5_output_param_ != NULL ? *hdf5_output_param_ : *default_instance_->hdf5_output_param_;
-}
-inline ::caffe::HDF5OutputParameter* V0LayerParameter::mutable_hdf5_output_param() {
-  set_has_hdf5_output_param();
-  if (hdf5_output_param_ == NULL) hdf5_output_param_ = new ::caffe::HDF5OutputParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.V0LayerParameter.hdf5_output_param)
-  return hdf5_output_param_;
-}
-inline ::caffe::HDF5OutputParameter* V0LayerParameter::release_hdf5_output_param() {
-  clear_has_hdf5_output_param();
-  ::caffe::HDF5OutputParameter* temp = hdf5_output_param_;
-  hdf5_output_param_ = NULL;
-  return temp;
-}
-inline void V0LayerParameter::set_allocated_hdf5_output_param(::caffe::HDF5OutputParameter* hdf5_output_param) {
-  delete hdf5_output_param_;
-  hdf5_output_param_ = hdf5_output_param;
-  if (hdf5_output_param) {
-    set_has_hdf5_output_param();
-  } else {
-    clear_has_hdf5_output_param();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.V0LayerParameter.hdf5_output_param)
-}
-
-// -------------------------------------------------------------------
-
-// PReLUParameter
-
-// optional .caffe.FillerParameter filler = 1;
-inline bool PReLUParameter::has_filler() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void PReLUParameter::set_has_filler() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void PReLUParameter::clear_has_filler() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void PReLUParameter::clear_filler() {
-  if (filler_ != NULL) filler_->::caffe::FillerParameter::Clear();
-  clear_has_filler();
-}
-inline const ::caffe::FillerParameter& PReLUParameter::filler() const {
-  // @@protoc_insertion_point(field_get:caffe.PReLUParameter.filler)
-  return filler_ != NULL ? *filler_ : *default_instance_->filler_;
-}
-inline ::caffe::FillerParameter* PReLUParameter::mutable_filler() {
-  set_has_filler();
-  if (filler_ == NULL) filler_ = new ::caffe::FillerParameter;
-  // @@protoc_insertion_point(field_mutable:caffe.PReLUParameter.filler)
-  return filler_;
-}
-inline ::caffe::FillerParameter* PReLUParameter::release_filler() {
-  clear_has_filler();
-  ::caffe::FillerParameter* temp = filler_;
-  filler_ = NULL;
-  return temp;
-}
-inline void PReLUParameter::set_allocated_filler(::caffe::FillerParameter* filler) {
-  delete filler_;
-  filler_ = filler;
-  if (filler) {
-    set_has_filler();
-  } else {
-    clear_has_filler();
-  }
-  // @@protoc_insertion_point(field_set_allocated:caffe.PReLUParameter.filler)
-}
-
-// optional bool channel_shared = 2 [default = false];
-inline bool PReLUParameter::has_channel_shared() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void PReLUParameter::set_has_channel_shared() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void PReLUParameter::clear_has_channel_shared() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void PReLUParameter::clear_channel_shared() {
-  channel_shared_ = false;
-  clear_has_channel_shared();
-}
-inline bool PReLUParameter::channel_shared() const {
-  // @@protoc_insertion_point(field_get:caffe.PReLUParameter.channel_shared)
-  return channel_shared_;
-}
-inline void PReLUParameter::set_channel_shared(bool value) {
-  set_has_channel_shared();
-  channel_shared_ = value;
-  // @@protoc_insertion_point(field_set:caffe.PReLUParameter.channel_shared)
-}
-
-// -------------------------------------------------------------------
-
-// QuantizationParameter
-
-// optional .caffe.QuantizationParameter.RoundMethod round_method = 1 [default = ROUND];
-inline bool QuantizationParameter::has_round_method() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void QuantizationParameter::set_has_round_method() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void QuantizationParameter::clear_has_round_method() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void QuantizationParameter::clear_round_method() {
-  round_method_ = 0;
-  clear_has_round_method();
-}
-inline ::caffe::QuantizationParameter_RoundMethod QuantizationParameter::round_method() const {
-  // @@protoc_insertion_point(field_get:caffe.QuantizationParameter.round_method)
-  return static_cast< ::caffe::QuantizationParameter_RoundMethod >(round_method_);
-}
-inline void QuantizationParameter::set_round_method(::caffe::QuantizationParameter_RoundMethod value) {
-  assert(::caffe::QuantizationParameter_RoundMethod_IsValid(value));
-  set_has_round_method();
-  round_method_ = value;
-  // @@protoc_insertion_point(field_set:caffe.QuantizationParameter.round_method)
-}
-
-// optional .caffe.QuantizationParameter.RoundStrategy round_strategy = 2 [default = CONSERVATIVE];
-inline bool QuantizationParameter::has_round_strategy() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void QuantizationParameter::set_has_round_strategy() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void QuantizationParameter::clear_has_round_strategy() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void QuantizationParameter::clear_round_strategy() {
-  round_strategy_ = 0;
-  clear_has_round_strategy();
-}
-inline ::caffe::QuantizationParameter_RoundStrategy QuantizationParameter::round_strategy() const {
-  // @@protoc_insertion_point(field_get:caffe.QuantizationParameter.round_strategy)
-  return static_cast< ::caffe::QuantizationParameter_RoundStrategy >(round_strategy_);
-}
-inline void QuantizationParameter::set_round_strategy(::caffe::QuantizationParameter_RoundStrategy value) {
-  assert(::caffe::QuantizationParameter_RoundStrategy_IsValid(value));
-  set_has_round_strategy();
-  round_strategy_ = value;
-  // @@protoc_insertion_point(field_set:caffe.QuantizationParameter.round_strategy)
-}
-
-// optional int32 bit_width = 3 [default = 0];
-inline bool QuantizationParameter::has_bit_width() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void QuantizationParameter::set_has_bit_width() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void QuantizationParameter::clear_has_bit_width() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void QuantizationParameter::clear_bit_width() {
-  bit_width_ = 0;
-  clear_has_bit_width();
-}
-inline ::google::protobuf::int32 QuantizationParameter::bit_width() const {
-  // @@protoc_insertion_point(field_get:caffe.QuantizationParameter.bit_width)
-  return bit_width_;
-}
-inline void QuantizationParameter::set_bit_width(::google::protobuf::int32 value) {
-  set_has_bit_width();
-  bit_width_ = value;
-  // @@protoc_insertion_point(field_set:caffe.QuantizationParameter.bit_width)
-}
-
-// repeated float range = 4 [packed = true];
-inline int QuantizationParameter::range_size() const {
-  return range_.size();
-}
-inline void QuantizationParameter::clear_range() {
-  range_.Clear();
-}
-inline float QuantizationParameter::range(int index) const {
-  // @@protoc_insertion_point(field_get:caffe.QuantizationParameter.range)
-  return range_.Get(index);
-}
-inline void QuantizationParameter::set_range(int index, float value) {
-  range_.Set(index, value);
-  // @@protoc_insertion_point(field_set:caffe.QuantizationParameter.range)
-}
-inline void QuantizationParameter::add_range(float value) {
-  range_.Add(value);
-  // @@protoc_insertion_point(field_add:caffe.QuantizationParameter.range)
-}
-inline const ::google::protobuf::RepeatedField< float >&
-QuantizationParameter::range() const {
-  // @@protoc_insertion_point(field_list:caffe.QuantizationParameter.range)
-  return range_;
-}
-inline ::google::protobuf::RepeatedField< float >*
-QuantizationParameter::mutable_range() {
-  // @@protoc_insertion_point(field_mutable_list:caffe.QuantizationParameter.range)
-  return &range_;
-}
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace caffe
-
-#ifndef SWIG
-namespace google {
-namespace protobuf {
-
-template <> struct is_proto_enum< ::caffe::FillerParameter_VarianceNorm> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::FillerParameter_VarianceNorm>() {
-  return ::caffe::FillerParameter_VarianceNorm_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::SolverParameter_SnapshotFormat> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::SolverParameter_SnapshotFormat>() {
-  return ::caffe::SolverParameter_SnapshotFormat_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::SolverParameter_SolverMode> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::SolverParameter_SolverMode>() {
-  return ::caffe::SolverParameter_SolverMode_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::SolverParameter_SolverType> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::SolverParameter_SolverType>() {
-  return ::caffe::SolverParameter_SolverType_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::ParamSpec_DimCheckMode> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::ParamSpec_DimCheckMode>() {
-  return ::caffe::ParamSpec_DimCheckMode_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::LossParameter_NormalizationMode> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::LossParameter_NormalizationMode>() {
-  return ::caffe::LossParameter_NormalizationMode_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::ConvolutionParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::ConvolutionParameter_Engine>() {
-  return ::caffe::ConvolutionParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::DataParameter_DB> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::DataParameter_DB>() {
-  return ::caffe::DataParameter_DB_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::EltwiseParameter_EltwiseOp> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::EltwiseParameter_EltwiseOp>() {
-  return ::caffe::EltwiseParameter_EltwiseOp_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::HingeLossParameter_Norm> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::HingeLossParameter_Norm>() {
-  return ::caffe::HingeLossParameter_Norm_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::LRNParameter_NormRegion> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::LRNParameter_NormRegion>() {
-  return ::caffe::LRNParameter_NormRegion_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::LRNParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::LRNParameter_Engine>() {
-  return ::caffe::LRNParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::PoolingParameter_PoolMethod> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::PoolingParameter_PoolMethod>() {
-  return ::caffe::PoolingParameter_PoolMethod_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::PoolingParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::PoolingParameter_Engine>() {
-  return ::caffe::PoolingParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::ReductionParameter_ReductionOp> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::ReductionParameter_ReductionOp>() {
-  return ::caffe::ReductionParameter_ReductionOp_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::ReLUParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::ReLUParameter_Engine>() {
-  return ::caffe::ReLUParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::SigmoidParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::SigmoidParameter_Engine>() {
-  return ::caffe::SigmoidParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::SoftmaxParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::SoftmaxParameter_Engine>() {
-  return ::caffe::SoftmaxParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::TanHParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::TanHParameter_Engine>() {
-  return ::caffe::TanHParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::SPPParameter_PoolMethod> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::SPPParameter_PoolMethod>() {
-  return ::caffe::SPPParameter_PoolMethod_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::SPPParameter_Engine> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::SPPParameter_Engine>() {
-  return ::caffe::SPPParameter_Engine_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::V1LayerParameter_LayerType> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::V1LayerParameter_LayerType>() {
-  return ::caffe::V1LayerParameter_LayerType_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::V1LayerParameter_DimCheckMode> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::V1LayerParameter_DimCheckMode>() {
-  return ::caffe::V1LayerParameter_DimCheckMode_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::V0LayerParameter_PoolMethod> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::V0LayerParameter_PoolMethod>() {
-  return ::caffe::V0LayerParameter_PoolMethod_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::QuantizationParameter_RoundMethod> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::QuantizationParameter_RoundMethod>() {
-  return ::caffe::QuantizationParameter_RoundMethod_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::QuantizationParameter_RoundStrategy> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::QuantizationParameter_RoundStrategy>() {
-  return ::caffe::QuantizationParameter_RoundStrategy_descriptor();
-}
-template <> struct is_proto_enum< ::caffe::Phase> : ::google::protobuf::internal::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::caffe::Phase>() {
-  return ::caffe::Phase_descriptor();
-}
-
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
-
-// @@protoc_insertion_point(global_scope)
-
-#endif  // PROTOBUF_caffe_2eproto__INCLUDED
@@ -7,6 +7,7 @@
 #include "header/caffe/layers/conv_layer.hpp"
 #include "proto/caffe.pb.h"
 #include "header/caffe/layer_factory.hpp"
+#include "header/logger.hpp"
 #include <iostream>
 #include <vector>
 
@@ -95,8 +96,9 @@ void ConvolutionLayer::SetUp(const vector<vector<int>* >& bottom_shape,
 
   // initialize the kernel parameters
   if (bias_term_) {
-    cout << "num_output_: " << num_output_ << " num_input_: " << num_input_
-      << " group: " << group_ << " kh_: " << kh_ << " kw_: " << kw_ << endl;
+    LOG(NET, DETAIL) << "num_output_: " << num_output_ << " num_input_: "
+      << num_input_ << " group: " << group_ << " kh_: " << kh_ << " kw_: "
+      << kw_ << endl;
     // contain the biases in CONV
     blobs_shape_.resize(2);
     // weight shape: (Nout, Nin, Kh, Kw)
@@ -23,9 +23,8 @@ void EltwiseLayer::SetUp(const vector<vector<int>* >& bottom_shape,
   // we only expect multiple input feature maps and single output feature map
   assert(bottom_shape.size() > 1);
   assert(top_shape.size() == 1);
-  // only summation
-  assert(layer_param_.eltwise_param().operation() ==
-      EltwiseParameter_EltwiseOp_SUM);
+  // the blob-wise coefficients are not supported by the data path
+  assert(layer_param_.eltwise_param().coeff_size() == 0);
 
   // check the input blobs have the same shape with each other
   for (size_t i = 1; i < bottom_shape.size(); ++i) {
@@ -47,18 +46,29 @@ void EltwiseLayer::SetUp(const vector<vector<int>* >& bottom_shape,
 /*
  * Implementation notes: ComputationComplexity
  * --------------------------------------------
- * The EltwiseLayer takes 1 add per pixel in the input feature map.
+ * The EltwiseLayer combines the bottom blobs pairwise, i.e. takes (no. of
+ * bottom blobs - 1) operations per pixel in the input feature map: add for SUM,
+ * multiplication for PROD and comparison for MAX.
  */
 void EltwiseLayer::ComputationComplexity(const vector<vector<int>* >&
     bottom_shape, const vector<vector<int>* >& top_shape) {
   memset(&num_op_, 0, sizeof(num_op_));
-  // 1 ADD per pixel
-  int volume = 1;
+  long int volume = bottom_shape.size() - 1;
   for (vector<int>::const_iterator iter = bottom_shape[0]->begin();
       iter != bottom_shape[0]->end(); ++iter) {
     volume *= *iter;
   }
-  num_op_.num_add = volume;
+  switch (layer_param_.eltwise_param().operation()) {
+    case EltwiseParameter_EltwiseOp_PROD:
+      num_op_.num_mac = volume;
+      break;
+    case EltwiseParameter_EltwiseOp_MAX:
+      num_op_.num_comp = volume;
+      break;
+    default:
+      num_op_.num_add = volume;
+      break;
+  }
 }
 
 // Register EltwiseLayer
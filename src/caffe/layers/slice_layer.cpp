@@ -0,0 +1,77 @@
+/*
+ * Filename: slice_layer.cpp
+ * --------------------------
+ * This file implements the class SliceLayer.
+ */
+
+#include "header/caffe/layers/slice_layer.hpp"
+#include "proto/caffe.pb.h"
+#include "header/caffe/layer_factory.hpp"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace caffe;
+
+/*
+ * Implementation notes: SetUp
+ * ----------------------------
+ * The top blobs are the channel ranges of the bottom one between the slice
+ * points, or of the same size if no slice point is specified. We only support
+ * the slice along the channels.
+ */
+void SliceLayer::SetUp(const vector<vector<int>* >& bottom_shape,
+    const vector<vector<int>* >& top_shape) {
+  // sanity check: single 4D bottom blob & multiple top blobs
+  assert(bottom_shape.size() == 1);
+  assert(bottom_shape[0]->size() == 4);
+  assert(top_shape.size() > 1);
+
+  const SliceParameter& slice_param = layer_param_.slice_param();
+  if (slice_param.axis() != 1 || slice_param.slice_dim() != 1) {
+    cerr << "[ERROR]: slice layer " << layer_param_.name() << " only slices "
+      "the channels" << endl;
+    exit(1);
+  }
+  const int num_channels = bottom_shape[0]->at(1);
+  const int num_tops = top_shape.size();
+  vector<int> slice_points;
+  if (slice_param.slice_point_size() > 0) {
+    assert(slice_param.slice_point_size() == num_tops-1);
+    slice_points.assign(slice_param.slice_point().begin(),
+        slice_param.slice_point().end());
+  } else {
+    assert(num_channels % num_tops == 0);
+    for (int blob_id = 1; blob_id < num_tops; ++blob_id) {
+      slice_points.push_back(blob_id * num_channels / num_tops);
+    }
+  }
+  slice_points.push_back(num_channels);
+
+  int prev_slice_point = 0;
+  for (int blob_id = 0; blob_id < num_tops; ++blob_id) {
+    assert(top_shape[blob_id] != bottom_shape[0]);
+    assert(slice_points[blob_id] > prev_slice_point);
+
+    *top_shape[blob_id] = *bottom_shape[0];
+    top_shape[blob_id]->at(1) = slice_points[blob_id] - prev_slice_point;
+    prev_slice_point = slice_points[blob_id];
+  }
+  assert(prev_slice_point == num_channels);
+
+  // there is no additional parameters for SliceLayer
+  blobs_shape_.clear();
+}
+
+/*
+ * Implementation notes: ComputationComplexity
+ * --------------------------------------------
+ * The slice only reroutes the channels, there is no computation.
+ */
+void SliceLayer::ComputationComplexity(const vector<vector<int>* >&
+    bottom_shape, const vector<vector<int>* >& top_shape) {
+  memset(&num_op_, 0, sizeof(num_op_));
+}
+
+// Register SliceLayer
+REGISTER_LAYER_CLASS(Slice);
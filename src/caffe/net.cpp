@@ -8,22 +8,26 @@
 #include "header/caffe/util/upgrade_proto.hpp"
 #include "header/caffe/layer_factory.hpp"
 #include "proto/caffe.pb.h"
+#include "header/logger.hpp"
 #include <string>
 #include <iostream>
 #include <climits>
 #include <sstream>
+#include <set>
 
 using namespace std;
 using namespace caffe;
 
-Net::Net(const caffe::NetParameter& param) {
-  Init(param);
+Net::Net(const caffe::NetParameter& param, bool fuse_sibling_convs,
+    const map<string, string>& fusion_tags) {
+  Init(param, fuse_sibling_convs, fusion_tags);
 }
 
-Net::Net(const string& param_file) {
+Net::Net(const string& param_file, bool fuse_sibling_convs,
+    const map<string, string>& fusion_tags) {
   NetParameter param;
   ReadNetParamsFromTextFileOrDie(param_file, &param);
-  Init(param);
+  Init(param, fuse_sibling_convs, fusion_tags);
 }
 
 /*
@@ -32,12 +36,21 @@ Net::Net(const string& param_file) {
  * Initialize the data structure of neural network with a specified network
  * parameter.
  */
-void Net::Init(const NetParameter& in_param) {
+void Net::Init(const NetParameter& in_param, bool fuse_sibling_convs,
+    const map<string, string>& fusion_tags) {
   // filter the layers not in the TEST phase (we only consider the inference
   // phase)
   NetParameter filtered_param;
   FilterTestLayers(in_param, &filtered_param);
 
+  // fuse the sibling 1x1 convolutions before the splits are inserted, so the
+  // fused convolution is a single consumer of the bottom blob
+  if (fuse_sibling_convs) {
+    NetParameter fused_param;
+    FuseSiblingConvs(filtered_param, fusion_tags, &fused_param);
+    filtered_param.Swap(&fused_param);
+  }
+
   // Insert the split layer
   NetParameter param;
   InsertSplits(filtered_param, &param);
@@ -75,7 +88,7 @@ void Net::Init(const NetParameter& in_param) {
     }
 
     // LOG info
-    cout << "Layer[" << layer_id << "]: " << layer_param.name() 
+    LOG(NET, DETAIL) << "Layer[" << layer_id << "]: " << layer_param.name() 
       << " of type " << layer_param.type() << endl;
   }
 }
@@ -103,7 +116,7 @@ void Net::AppendBottom(const NetParameter& param, const int layer_id,
   // insert the corresponding Blob shape to the pointer
   bottom_blobs_shape_ptr_[layer_id].push_back(blobs_shape_[blob_id]);
 
-  cout << "Layer[" << layer_id << "]: " << layer_param.name() << 
+  LOG(NET, DETAIL) << "Layer[" << layer_id << "]: " << layer_param.name() << 
     " with bottom blob id " << blob_id << endl;
 }
 
@@ -130,8 +143,8 @@ void Net::AppendTop(const NetParameter& param, const int layer_id,
     top_blobs_shape_ptr_[layer_id].push_back(blobs_shape_[blob_id]);
 
     // LOG info
-    cout << "In-place Layer[" << layer_id << "]: " << layer_param.name() <<
-      " Top with blob id " << blob_id << endl;
+    LOG(NET, DETAIL) << "In-place Layer[" << layer_id << "]: "
+      << layer_param.name() << " Top with blob id " << blob_id << endl;
   } else {
     // normal computation, allocate a new blob, and push the name index map
     const int blob_id = blobs_shape_.size();
@@ -140,11 +153,161 @@ void Net::AppendTop(const NetParameter& param, const int layer_id,
     blobs_name_to_idx_[blob_name] = blob_id;
     top_blobs_shape_ptr_[layer_id].push_back(blobs_shape_[blob_id]);
 
-    cout << "Layer[" << layer_id << "]: " << layer_param.name() <<
+    LOG(NET, DETAIL) << "Layer[" << layer_id << "]: " << layer_param.name() <<
       " with top blob id " << blob_id << endl;
   }
 }
 
+/*
+ * Helper function: PointwiseConvGeometry
+ * ---------------------------------------
+ * Returns the stride, pad & bias term of the 1x1 convolution that can be fused
+ * with its siblings (a single bottom, not in-place, no group or dilation),
+ * parsed as ConvolutionLayer::SetUp, or an empty string otherwise.
+ */
+static string PointwiseConvGeometry(const LayerParameter& layer_param) {
+  if (layer_param.type() != "Convolution" || layer_param.bottom_size() != 1 ||
+      layer_param.top_size() != 1 ||
+      layer_param.top(0) == layer_param.bottom(0)) {
+    return "";
+  }
+  const ConvolutionParameter& conv_param = layer_param.convolution_param();
+  int kh = 0, kw = 0;
+  if (conv_param.has_kernel_h() || conv_param.has_kernel_w()) {
+    kh = conv_param.kernel_h();
+    kw = conv_param.kernel_w();
+  } else if (conv_param.kernel_size_size() == 1) {
+    kh = kw = conv_param.kernel_size(0);
+  }
+  if (kh != 1 || kw != 1 || conv_param.group() != 1 ||
+      conv_param.dilation_size() > 0) {
+    return "";
+  }
+
+  int stride_h = 1, stride_w = 1;
+  if (conv_param.has_stride_h() || conv_param.has_stride_w()) {
+    stride_h = conv_param.stride_h();
+    stride_w = conv_param.stride_w();
+  } else if (conv_param.stride_size() == 1) {
+    stride_h = stride_w = conv_param.stride(0);
+  }
+  int pad_h = 0, pad_w = 0;
+  if (conv_param.has_pad_h() || conv_param.has_pad_w()) {
+    pad_h = conv_param.pad_h();
+    pad_w = conv_param.pad_w();
+  } else if (conv_param.pad_size() == 1) {
+    pad_h = pad_w = conv_param.pad(0);
+  }
+
+  ostringstream geometry;
+  geometry << "stride " << stride_h << "x" << stride_w << " pad " << pad_h
+    << "x" << pad_w << " bias " << conv_param.bias_term();
+  return geometry.str();
+}
+
+/*
+ * Implementation notes: FuseSiblingConvs
+ * ---------------------------------------
+ * The 1x1 convolutions are grouped by the bottom blob they read & their
+ * geometry. The bottom blob is versioned by the layers writing to it (e.g. the
+ * in-place ReLU), so the convolutions before & after an in-place layer are not
+ * siblings. Neither are the convolutions of different fusion tags, e.g. the
+ * ones resolved to different bit widths. Each group of more than one
+ * convolution is replaced, at the position of its first one, by the fused
+ * convolution of the total outputs and a Slice layer, whose tops are the
+ * original tops in the group order. The weights of the fused convolution are
+ * the ones of the siblings concatenated along the outputs, see SourceLayers.
+ */
+void Net::FuseSiblingConvs(const NetParameter& param,
+    const map<string, string>& fusion_tags, NetParameter* param_fused) {
+  // copy all the network parameters, excluding the layers
+  param_fused->CopyFrom(param);
+  param_fused->clear_layer();
+
+  // no. of layers having written to the blob
+  map<string, int> blob_version;
+  // bottom blob, its version & the geometry to the sibling convolutions
+  map<string, vector<int> > siblings;
+  for (int i = 0; i < param.layer_size(); ++i) {
+    const LayerParameter& layer_param = param.layer(i);
+    const string geometry = PointwiseConvGeometry(layer_param);
+    if (!geometry.empty()) {
+      ostringstream key;
+      key << layer_param.bottom(0) << "#" << blob_version[layer_param.bottom(0)]
+        << "#" << geometry;
+      map<string, string>::const_iterator tag_iter =
+        fusion_tags.find(layer_param.name());
+      if (tag_iter != fusion_tags.end()) {
+        key << "#" << tag_iter->second;
+      }
+      siblings[key.str()].push_back(i);
+    }
+    for (int blob_id = 0; blob_id < layer_param.top_size(); ++blob_id) {
+      ++blob_version[layer_param.top(blob_id)];
+    }
+  }
+
+  // first convolution of each group to the group & the other fused ones
+  map<int, const vector<int>*> fused_groups;
+  set<int> fused_siblings;
+  for (map<string, vector<int> >::const_iterator iter = siblings.begin();
+      iter != siblings.end(); ++iter) {
+    if (iter->second.size() > 1) {
+      fused_groups[iter->second[0]] = &iter->second;
+      fused_siblings.insert(iter->second.begin()+1, iter->second.end());
+    }
+  }
+
+  for (int i = 0; i < param.layer_size(); ++i) {
+    const LayerParameter& layer_param = param.layer(i);
+    if (fused_siblings.count(i)) {
+      continue;
+    }
+    map<int, const vector<int>*>::const_iterator iter = fused_groups.find(i);
+    if (iter == fused_groups.end()) {
+      param_fused->add_layer()->CopyFrom(layer_param);
+      continue;
+    }
+
+    // fused convolution followed by the slice layer
+    LayerParameter* conv_layer_param = param_fused->add_layer();
+    conv_layer_param->CopyFrom(layer_param);
+    conv_layer_param->set_name(layer_param.name() + "_fused");
+    conv_layer_param->set_top(0, layer_param.top(0) + "_fused");
+    LayerParameter* slice_layer_param = param_fused->add_layer();
+    slice_layer_param->set_name(layer_param.name() + "_slice");
+    slice_layer_param->set_type("Slice");
+    slice_layer_param->add_bottom(conv_layer_param->top(0));
+
+    const vector<int>& group = *iter->second;
+    vector<string>& source_layers = fused_layers_[conv_layer_param->name()];
+    int num_output = 0;
+    for (size_t k = 0; k < group.size(); ++k) {
+      const LayerParameter& sibling_param = param.layer(group[k]);
+      if (k > 0) {
+        slice_layer_param->mutable_slice_param()->add_slice_point(num_output);
+      }
+      num_output += sibling_param.convolution_param().num_output();
+      slice_layer_param->add_top(sibling_param.top(0));
+      source_layers.push_back(sibling_param.name());
+    }
+    conv_layer_param->mutable_convolution_param()->set_num_output(num_output);
+
+    LOG(NET, INFO) << "Fused " << group.size() << " sibling convolutions of "
+      << layer_param.bottom(0) << " into " << conv_layer_param->name()
+      << " of " << num_output << " outputs" << endl;
+  }
+}
+
+vector<string> Net::SourceLayers(const string& layer_name) const {
+  map<string, vector<string> >::const_iterator iter =
+    fused_layers_.find(layer_name);
+  if (iter != fused_layers_.end()) {
+    return iter->second;
+  }
+  return vector<string>(1, layer_name);
+}
+
 /*
  * Implementation notes: InsertSplits
  * -----------------------------------
@@ -0,0 +1,264 @@
+/*
+ * Filename: weight_loader.cpp
+ * ----------------------------
+ * This file implements the class WeightLoader.
+ */
+
+#include "header/caffe/util/weight_loader.hpp"
+#include <google/protobuf/io/coded_stream.h>
+#include <iostream>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+using google::protobuf::io::CodedInputStream;
+
+// field numbers & wire types of the caffe.proto messages being indexed
+namespace {
+  const int kNetLayerField = 100;       // NetParameter.layer
+  const int kNetV1LayerField = 2;       // NetParameter.layers (deprecated)
+  const int kLayerNameField = 1;        // LayerParameter.name
+  const int kLayerBlobsField = 7;       // LayerParameter.blobs
+  const int kBlobDataField = 5;         // BlobProto.data (packed)
+  const int kBlobDoubleDataField = 8;   // BlobProto.double_data (packed)
+
+  const int kWireVarint = 0;
+  const int kWireFixed64 = 1;
+  const int kWireLengthDelimited = 2;
+  const int kWireFixed32 = 5;
+
+  // skip the field of the tag, returns false for the malformed field
+  bool SkipField(CodedInputStream& input, uint32_t tag) {
+    uint64_t varint;
+    uint32_t length;
+    switch (tag & 0x7) {
+      case kWireVarint:
+        return input.ReadVarint64(&varint);
+      case kWireFixed64:
+        return input.Skip(8);
+      case kWireLengthDelimited:
+        return input.ReadVarint32(&length) &&
+          input.Skip(static_cast<int>(length));
+      case kWireFixed32:
+        return input.Skip(4);
+      default:
+        // groups are not used by caffe.proto
+        return false;
+    }
+  }
+}
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The caffemodel is mapped read-only, and the pages are only touched by the
+ * indexing (the length-delimited headers) and the quantization of the layers
+ * requested later.
+ */
+WeightLoader::WeightLoader(const string& filename) : filename_(filename),
+  addr_(NULL), size_(0) {
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    cerr << "[ERROR]: caffemodel " << filename << " can NOT open!" << endl;
+    exit(1);
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    cerr << "[ERROR]: caffemodel " << filename << " can NOT stat!" << endl;
+    exit(1);
+  }
+  size_ = file_stat.st_size;
+  if (size_ == 0 || size_ > static_cast<size_t>(INT_MAX)) {
+    cerr << "[ERROR]: unsupported caffemodel size " << size_ << " bytes of "
+      << filename << endl;
+    exit(1);
+  }
+  addr_ = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr_ == MAP_FAILED) {
+    cerr << "[ERROR]: caffemodel " << filename << " can NOT map!" << endl;
+    exit(1);
+  }
+
+  IndexNet(static_cast<const uint8_t*>(addr_), static_cast<int>(size_));
+  cout << "Indexed " << layer_blobs_.size() << " layers from " << filename
+    << endl;
+}
+
+WeightLoader::~WeightLoader() {
+  munmap(addr_, size_);
+}
+
+void WeightLoader::IndexNet(const uint8_t* buffer, int size) {
+  CodedInputStream input(buffer, size);
+  uint32_t tag;
+  while ((tag = input.ReadTag()) != 0) {
+    const int field = tag >> 3;
+    if (field == kNetLayerField && (tag & 0x7) == kWireLengthDelimited) {
+      uint32_t length;
+      if (!input.ReadVarint32(&length) ||
+          static_cast<int>(length) > size - input.CurrentPosition()) {
+        break;
+      }
+      IndexLayer(buffer + input.CurrentPosition(), length);
+      input.Skip(length);
+    } else if (field == kNetV1LayerField) {
+      cerr << "[ERROR]: V1 layers of caffemodel " << filename_
+        << " are not supported, upgrade it with upgrade_net_proto_binary"
+        << endl;
+      exit(1);
+    } else if (!SkipField(input, tag)) {
+      break;
+    }
+  }
+  if (input.CurrentPosition() != size) {
+    cerr << "[ERROR]: malformed caffemodel " << filename_ << endl;
+    exit(1);
+  }
+}
+
+void WeightLoader::IndexLayer(const uint8_t* buffer, int size) {
+  CodedInputStream input(buffer, size);
+  string name;
+  vector<BlobData> blobs;
+  uint32_t tag;
+  while ((tag = input.ReadTag()) != 0) {
+    const int field = tag >> 3;
+    if (field == kLayerNameField && (tag & 0x7) == kWireLengthDelimited) {
+      uint32_t length;
+      if (!input.ReadVarint32(&length) ||
+          !input.ReadString(&name, length)) {
+        break;
+      }
+    } else if (field == kLayerBlobsField &&
+        (tag & 0x7) == kWireLengthDelimited) {
+      uint32_t length;
+      if (!input.ReadVarint32(&length) ||
+          static_cast<int>(length) > size - input.CurrentPosition()) {
+        break;
+      }
+      blobs.push_back(IndexBlob(buffer + input.CurrentPosition(), length));
+      input.Skip(length);
+    } else if (!SkipField(input, tag)) {
+      break;
+    }
+  }
+  if (input.CurrentPosition() != size) {
+    cerr << "[ERROR]: malformed layer " << name << " of caffemodel "
+      << filename_ << endl;
+    exit(1);
+  }
+  if (!blobs.empty()) {
+    layer_blobs_[name] = blobs;
+  }
+}
+
+WeightLoader::BlobData WeightLoader::IndexBlob(const uint8_t* buffer,
+    int size) {
+  CodedInputStream input(buffer, size);
+  BlobData blob;
+  blob.data = NULL;
+  blob.count = 0;
+  uint32_t tag;
+  while ((tag = input.ReadTag()) != 0) {
+    const int field = tag >> 3;
+    if (field == kBlobDataField && (tag & 0x7) == kWireLengthDelimited) {
+      // packed floats: point to the data in place
+      uint32_t length;
+      if (!input.ReadVarint32(&length) ||
+          static_cast<int>(length) > size - input.CurrentPosition()) {
+        break;
+      }
+      blob.data = buffer + input.CurrentPosition();
+      blob.count = length / sizeof(float);
+      input.Skip(length);
+    } else if (field == kBlobDataField || field == kBlobDoubleDataField) {
+      cerr << "[ERROR]: only packed float blob data is supported" << endl;
+      exit(1);
+    } else if (!SkipField(input, tag)) {
+      break;
+    }
+  }
+  return blob;
+}
+
+bool WeightLoader::HasWeights(const string& layer_name) const {
+  return layer_blobs_.find(layer_name) != layer_blobs_.end();
+}
+
+/*
+ * Implementation notes: QuantizeWeights
+ * --------------------------------------
+ * The weights are rounded to the nearest multiple of 2^-frac_bits and
+ * saturated to the range of the bit_width signed integer. The fraction bits
+ * may be negative if the largest magnitude exceeds the integer range. The
+ * fused layers share the fraction bits.
+ */
+int WeightLoader::QuantizeWeights(const vector<string>& layer_names, int Nout,
+    int Nin, int kernel_size, int group, int bit_width,
+    vector<int>& weights) const {
+  // decode the little-endian floats of the layers in turn
+  vector<float> values;
+  for (size_t layer_id = 0; layer_id < layer_names.size(); ++layer_id) {
+    const string& layer_name = layer_names[layer_id];
+    map<string, vector<BlobData> >::const_iterator iter =
+      layer_blobs_.find(layer_name);
+    if (iter == layer_blobs_.end()) {
+      cerr << "[ERROR]: no weights of layer " << layer_name
+        << " in caffemodel " << filename_ << endl;
+      exit(1);
+    }
+    const BlobData& blob = iter->second[0];
+    const size_t offset = values.size();
+    values.resize(offset + blob.count);
+    for (int i = 0; i < blob.count; ++i) {
+      uint32_t bits;
+      CodedInputStream::ReadLittleEndian32FromArray(
+          blob.data + i*sizeof(float), &bits);
+      memcpy(&values[offset+i], &bits, sizeof(float));
+    }
+  }
+  const int group_Nin = Nin / group;
+  const int group_Nout = Nout / group;
+  if (static_cast<int>(values.size()) != Nout * group_Nin * kernel_size) {
+    cerr << "[ERROR]: weights of layer " << layer_names[0];
+    for (size_t layer_id = 1; layer_id < layer_names.size(); ++layer_id) {
+      cerr << " + " << layer_names[layer_id];
+    }
+    cerr << " has " << values.size() << " elements, expect "
+      << Nout * group_Nin * kernel_size << endl;
+    exit(1);
+  }
+
+  // fraction bits covering the largest magnitude
+  float max_abs = 0.f;
+  for (size_t i = 0; i < values.size(); ++i) {
+    max_abs = max(max_abs, fabs(values[i]));
+  }
+  const double max_int = ldexp(1., bit_width-1) - 1.;
+  const double min_int = -ldexp(1., bit_width-1);
+  const int frac_bits = (max_abs == 0.f) ? 0 :
+    static_cast<int>(floor(log2(max_int / max_abs)));
+
+  weights.assign(Nout * Nin * kernel_size, 0);
+  for (int o = 0; o < Nout; ++o) {
+    // input channels of the group of the output channel
+    const int in_start = (o / group_Nout) * group_Nin;
+    for (int i = 0; i < group_Nin; ++i) {
+      for (int k = 0; k < kernel_size; ++k) {
+        double q = floor(ldexp(values[(o*group_Nin+i)*kernel_size+k],
+              frac_bits) + 0.5);
+        q = min(max(q, min_int), max_int);
+        weights[(o*Nin+in_start+i)*kernel_size+k] = static_cast<int>(q);
+      }
+    }
+  }
+  return frac_bits;
+}
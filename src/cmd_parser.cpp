@@ -9,16 +9,22 @@
 #include "proto/config.pb.h"
 #include <string>
 #include <iostream>
+#include <algorithm>
+#include <sstream>
 #include <getopt.h>
+#include <dirent.h>
+#include <sys/stat.h>
 
 using namespace std;
 using namespace config;
 
 // Definition for short & long options
-const char* const CmdParser::short_options = "hc:";
+const char* const CmdParser::short_options = "hc:b:o:";
 const struct option CmdParser::long_options[] = {
   {"help", 0, NULL, 'h'},
   {"config", 1, NULL, 'c'},
+  {"batch", 1, NULL, 'b'},
+  {"output", 1, NULL, 'o'},
   {NULL, 0, NULL, 0}
 };
 
@@ -42,6 +48,14 @@ void CmdParser::Parse() {
         config_filename = optarg;
         break;
 
+      case 'b':   // -b or --batch
+        batch_path = optarg;
+        break;
+
+      case 'o':   // -o or --output
+        output_filename = optarg;
+        break;
+
       case -1:    // end of option
         break;
 
@@ -54,6 +68,16 @@ void CmdParser::Parse() {
     }
   } while (next_option != -1);
 
+  if (batch_path != "") {
+    if (config_filename != "") {
+      cerr << "configuration file and batch can NOT be specified together"
+        << endl;
+      exit(1);
+    }
+    ParseBatch();
+    return;
+  }
+
   if (config_filename == "") {
     cout << "please specify the configuration file" << endl;
     PrintUsage();
@@ -70,12 +94,82 @@ void CmdParser::Parse() {
   model_filename = config_param.model_file();
 }
 
+/*
+ * Implementation notes: ParseBatch
+ * ---------------------------------
+ * The batch is either a directory, where each *.prototxt file inside is one
+ * configuration (in the alphabetical order), or a single prototxt file of
+ * BatchParameter containing multiple configurations.
+ */
+void CmdParser::ParseBatch() {
+  struct stat batch_stat;
+  if (stat(batch_path.c_str(), &batch_stat) != 0) {
+    cerr << "Error to open the batch: " << batch_path << endl;
+    exit(1);
+  }
+
+  if (S_ISDIR(batch_stat.st_mode)) {
+    DIR* dir = opendir(batch_path.c_str());
+    if (dir == NULL) {
+      cerr << "Error to open the batch directory: " << batch_path << endl;
+      exit(1);
+    }
+    vector<string> filenames;
+    const string suffix = ".prototxt";
+    for (struct dirent* entry = readdir(dir); entry != NULL;
+        entry = readdir(dir)) {
+      const string filename = entry->d_name;
+      if (filename.size() > suffix.size() && filename.compare(filename.size()
+            - suffix.size(), suffix.size(), suffix) == 0) {
+        filenames.push_back(filename);
+      }
+    }
+    closedir(dir);
+    sort(filenames.begin(), filenames.end());
+
+    for (vector<string>::const_iterator iter = filenames.begin();
+        iter != filenames.end(); ++iter) {
+      ConfigParameter point_param;
+      const string point_filename = batch_path + "/" + *iter;
+      if (!ReadProtoFromTextFile(point_filename, &point_param)) {
+        cerr << "Error to parse the configuration file: " << point_filename
+          << endl;
+        exit(1);
+      }
+      batch_config_name.push_back(iter->substr(0, iter->size() -
+            suffix.size()));
+      batch_config_param.push_back(point_param);
+    }
+  } else {
+    BatchParameter batch_param;
+    if (!ReadProtoFromTextFile(batch_path, &batch_param)) {
+      cerr << "Error to parse the batch file: " << batch_path << endl;
+      exit(1);
+    }
+    for (int i = 0; i < batch_param.config_size(); ++i) {
+      ostringstream point_name;
+      point_name << "point_" << i;
+      batch_config_name.push_back(point_name.str());
+      batch_config_param.push_back(batch_param.config(i));
+    }
+  }
+
+  if (batch_config_param.empty()) {
+    cerr << "no configuration found in the batch: " << batch_path << endl;
+    exit(1);
+  }
+}
+
 void CmdParser::PrintUsage() const {
   cout << "Usage: " << program_name << " options " << endl;
   cout << "\t-h --help                   Display this usage information"
     << endl;
   cout << "\t-c --config config_filename Input the configuration filename"
     << endl;
+  cout << "\t-b --batch batch_path       Input the batch of configurations: a"
+    << " directory of *.prototxt or a multi-entry batch prototxt" << endl;
+  cout << "\t-o --output output_filename Output the batch result records"
+    << " (default: " << output_filename << ")" << endl;
   exit(0);
 }
 
@@ -105,5 +199,49 @@ void CmdParser::ConfigParamSummary() const {
     << endl;
   cout << "# kernel unrolling flag: " << config_param.kernel_unrolling_flag()
     << endl;
+  if (config_param.multiplier_budget() > 0) {
+    cout << "# multiplier budget: " << config_param.multiplier_budget() << endl;
+  }
+  if (config_param.area_budget() > 0) {
+    cout << "# area budget [um2]: " << config_param.area_budget() << endl;
+  }
+  cout << "# simulation mode: " << ConfigParameter_SimulationMode_Name(
+      config_param.simulation_mode()) << endl;
+  cout << "# predict buffer depth: " << config_param.predict_buffer_depth()
+    << endl;
+  if (!config_param.buffer_depth_file().empty()) {
+    cout << "# buffer depth file: " << config_param.buffer_depth_file()
+      << " (margin: " << config_param.buffer_depth_margin() << ")" << endl;
+  }
+  if (!config_param.weight_file().empty()) {
+    cout << "# weight file: " << config_param.weight_file() << endl;
+  }
+  cout << "# zero skipping: " << config_param.zero_skipping() << endl;
+  for (int i = 0; i < config_param.layer_bit_width_size(); ++i) {
+    cout << "# layer bit width: " << config_param.layer_bit_width(i).layer()
+      << " -> " << config_param.layer_bit_width(i).bit_width() << endl;
+  }
+  for (int i = 0; i < config_param.input_file_size(); ++i) {
+    cout << "# input file: " << config_param.input_file(i) << endl;
+  }
+  cout << "# num of frames: " << config_param.num_frames() << endl;
+  if (config_param.num_segments() > 1) {
+    cout << "# num of segments: " << config_param.num_segments() << endl;
+  }
+  if (!config_param.checkpoint_file().empty()) {
+    cout << "# checkpoint file: " << config_param.checkpoint_file() << endl;
+  }
+  if (!config_param.restore_file().empty()) {
+    cout << "# restore file: " << config_param.restore_file() << endl;
+  }
+  cout << "# fuse sibling convs: " << config_param.fuse_sibling_convs()
+    << endl;
+  cout << "# log level: " << ConfigParameter_LogLevel_Name(
+      config_param.log_level()) << endl;
+  for (int i = 0; i < config_param.module_log_level_size(); ++i) {
+    cout << "# module log level: " << config_param.module_log_level(i).module()
+      << " -> " << ConfigParameter_LogLevel_Name(
+          config_param.module_log_level(i).level()) << endl;
+  }
   cout << "##################################################" << endl;
 }
@@ -0,0 +1,271 @@
+/*
+ * Filename: design_space_explorer.cpp
+ * ------------------------------------
+ * This file implements the class DesignSpaceExplorer.
+ */
+
+#include "header/design_space_explorer.hpp"
+#include "header/systemc/parallelism_allocator.hpp"
+#include "header/layer_precision.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+using namespace std;
+using namespace config;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The design points are the cartesian product of the swept parameters. The
+ * parameter without a range (or an empty list) keeps the value of the base
+ * configuration.
+ */
+DesignSpaceExplorer::DesignSpaceExplorer(const Net& net,
+    const DseParameter& dse_param) : net_(net), next_point_(0) {
+  const ConfigParameter& base_config = dse_param.base_config();
+  if (base_config.multiplier_budget() > 0 && base_config.area_budget() > 0) {
+    cerr << "only one of multiplier_budget & area_budget can be set" << endl;
+    exit(1);
+  }
+
+  vector<int> pixel_inference_rates, bit_widths, append_buffer_capacities;
+  vector<bool> kernel_unrolling_flags;
+  vector<ConfigParameter_MemoryType> memory_types;
+  if (dse_param.has_pixel_inference_rate()) {
+    ExpandRange(dse_param.pixel_inference_rate(), &pixel_inference_rates);
+  } else {
+    pixel_inference_rates.push_back(base_config.pixel_inference_rate());
+  }
+  if (dse_param.has_bit_width()) {
+    ExpandRange(dse_param.bit_width(), &bit_widths);
+  } else {
+    bit_widths.push_back(base_config.bit_width());
+  }
+  if (dse_param.has_append_buffer_capacity()) {
+    ExpandRange(dse_param.append_buffer_capacity(),
+        &append_buffer_capacities);
+  } else {
+    append_buffer_capacities.push_back(base_config.append_buffer_capacity());
+  }
+  for (int i = 0; i < dse_param.kernel_unrolling_flag_size(); ++i) {
+    kernel_unrolling_flags.push_back(dse_param.kernel_unrolling_flag(i));
+  }
+  if (kernel_unrolling_flags.empty()) {
+    kernel_unrolling_flags.push_back(base_config.kernel_unrolling_flag());
+  }
+  for (int i = 0; i < dse_param.memory_type_size(); ++i) {
+    memory_types.push_back(dse_param.memory_type(i));
+  }
+  if (memory_types.empty()) {
+    memory_types.push_back(base_config.memory_type());
+  }
+
+  DesignPoint point;
+  point.config_param = base_config;
+  for (size_t i = 0; i < pixel_inference_rates.size(); ++i) {
+    point.config_param.set_pixel_inference_rate(pixel_inference_rates[i]);
+    for (size_t j = 0; j < bit_widths.size(); ++j) {
+      point.config_param.set_bit_width(bit_widths[j]);
+      for (size_t k = 0; k < kernel_unrolling_flags.size(); ++k) {
+        point.config_param.set_kernel_unrolling_flag(
+            kernel_unrolling_flags[k]);
+        for (size_t l = 0; l < append_buffer_capacities.size(); ++l) {
+          point.config_param.set_append_buffer_capacity(
+              append_buffer_capacities[l]);
+          for (size_t m = 0; m < memory_types.size(); ++m) {
+            point.config_param.set_memory_type(memory_types[m]);
+            design_points_.push_back(point);
+          }
+        }
+      }
+    }
+  }
+
+  pthread_mutex_init(&mutex_, NULL);
+}
+
+DesignSpaceExplorer::~DesignSpaceExplorer() {
+  pthread_mutex_destroy(&mutex_);
+}
+
+void DesignSpaceExplorer::ExpandRange(const IntRange& range,
+    vector<int>* values) {
+  if (range.min() > range.max() || range.step() < 1 ||
+      (range.geometric() && range.step() < 2)) {
+    cerr << "invalid range: [" << range.min() << ", " << range.max()
+      << "] with step " << range.step() << endl;
+    exit(1);
+  }
+  if (range.geometric() && range.min() <= 0) {
+    cerr << "geometric range must start from a positive value" << endl;
+    exit(1);
+  }
+  for (long int value = range.min(); value <= range.max();
+      value = range.geometric() ? value * range.step() : value + range.step()) {
+    values->push_back(static_cast<int>(value));
+  }
+}
+
+void DesignSpaceExplorer::FusionTags(const DseParameter& dse_param,
+    map<string, string>* fusion_tags) {
+  vector<int> bit_widths;
+  if (dse_param.has_bit_width()) {
+    ExpandRange(dse_param.bit_width(), &bit_widths);
+  } else {
+    bit_widths.push_back(dse_param.base_config().bit_width());
+  }
+  for (size_t i = 0; i < bit_widths.size(); ++i) {
+    ConfigParameter config_param = dse_param.base_config();
+    config_param.set_bit_width(bit_widths[i]);
+    LayerPrecision::FusionTags(config_param, fusion_tags);
+  }
+}
+
+/*
+ * Implementation notes: Evaluate
+ * -------------------------------
+ * The parallelism is determined in the same way as the ConvNetAcc: by the
+ * multiplier/area budget if specified, by the pixel_inference_rate otherwise.
+ */
+void DesignSpaceExplorer::Evaluate(DesignPoint* point) const {
+  const ConfigParameter& config_param = point->config_param;
+  ParallelismAllocator allocator(net_, config_param);
+  if (config_param.multiplier_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::MULTIPLIER,
+        config_param.multiplier_budget());
+  } else if (config_param.area_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::AREA, config_param.area_budget());
+  } else {
+    allocator.AllocateByRate(config_param.pixel_inference_rate());
+  }
+
+  point->max_inference_rate = allocator.max_inference_rate();
+  // clock frequency [GHz]
+  point->throughput = config_param.clk_freq() * 1e9 /
+    point->max_inference_rate;
+  point->num_mults = 0;
+  const map<int, ParallelismAllocator::LayerAllocation>& allocation =
+    allocator.allocation();
+  for (map<int, ParallelismAllocator::LayerAllocation>::const_iterator iter =
+      allocation.begin(); iter != allocation.end(); ++iter) {
+    point->num_mults += iter->second.num_mults;
+  }
+  point->area = allocator.Area();
+  point->static_power = allocator.StaticPower();
+  point->pareto = false;
+}
+
+/*
+ * Implementation notes: Worker
+ * -----------------------------
+ * The design points are fetched one at a time from the shared index, so that
+ * the workload is balanced over the threads regardless of the evaluation time
+ * of each design point.
+ */
+void* DesignSpaceExplorer::Worker(void* explorer) {
+  DesignSpaceExplorer* dse = static_cast<DesignSpaceExplorer*>(explorer);
+  while (true) {
+    pthread_mutex_lock(&dse->mutex_);
+    const size_t point_id = dse->next_point_++;
+    pthread_mutex_unlock(&dse->mutex_);
+    if (point_id >= dse->design_points_.size()) {
+      break;
+    }
+    dse->Evaluate(&dse->design_points_[point_id]);
+  }
+  return NULL;
+}
+
+void DesignSpaceExplorer::Explore(int num_threads) {
+  if (num_threads < 1) {
+    num_threads = 1;
+  }
+  next_point_ = 0;
+  vector<pthread_t> threads(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    if (pthread_create(&threads[i], NULL, Worker, this) != 0) {
+      cerr << "fail to create the worker thread " << i << endl;
+      exit(1);
+    }
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  MarkParetoFront();
+}
+
+// order of the design points by increasing area, then decreasing throughput
+static bool AreaLess(const DesignSpaceExplorer::DesignPoint* a,
+    const DesignSpaceExplorer::DesignPoint* b) {
+  if (a->area != b->area) {
+    return a->area < b->area;
+  }
+  return a->throughput > b->throughput;
+}
+
+/*
+ * Implementation notes: MarkParetoFront
+ * --------------------------------------
+ * After sorting by the area, a design point is on the Pareto front iff its
+ * throughput is strictly higher than all design points of smaller area.
+ */
+void DesignSpaceExplorer::MarkParetoFront() {
+  vector<DesignPoint*> sorted_points;
+  for (size_t i = 0; i < design_points_.size(); ++i) {
+    sorted_points.push_back(&design_points_[i]);
+  }
+  stable_sort(sorted_points.begin(), sorted_points.end(), AreaLess);
+  double max_throughput = 0.;
+  for (size_t i = 0; i < sorted_points.size(); ++i) {
+    sorted_points[i]->pareto = (sorted_points[i]->throughput > max_throughput);
+    max_throughput = max(max_throughput, sorted_points[i]->throughput);
+  }
+}
+
+void DesignSpaceExplorer::Summary(ostream& os) const {
+  vector<const DesignPoint*> pareto_points;
+  for (size_t i = 0; i < design_points_.size(); ++i) {
+    if (design_points_[i].pareto) {
+      pareto_points.push_back(&design_points_[i]);
+    }
+  }
+  stable_sort(pareto_points.begin(), pareto_points.end(), AreaLess);
+
+  os << "################################" << endl;
+  os << "# Pareto front of area vs. throughput" << endl;
+  os << "################################" << endl;
+  os << "pixel_rate\tbit_width\tunrolling\tbuffer\tmemory\tmults\t"
+    << "area[um2]\tstatic_power[uW]\trate\tthroughput[frame/s]" << endl;
+  for (size_t i = 0; i < pareto_points.size(); ++i) {
+    const ConfigParameter& config_param = pareto_points[i]->config_param;
+    os << config_param.pixel_inference_rate() << "\t"
+      << config_param.bit_width() << "\t"
+      << config_param.kernel_unrolling_flag() << "\t"
+      << config_param.append_buffer_capacity() << "\t"
+      << ConfigParameter_MemoryType_Name(config_param.memory_type()) << "\t"
+      << pareto_points[i]->num_mults << "\t" << pareto_points[i]->area << "\t"
+      << pareto_points[i]->static_power << "\t"
+      << pareto_points[i]->max_inference_rate << "\t"
+      << pareto_points[i]->throughput << endl;
+  }
+  os << "Pareto design points: " << pareto_points.size() << " out of "
+    << design_points_.size() << endl;
+}
+
+void DesignSpaceExplorer::WriteRecords(ostream& os) const {
+  os << "pixel_inference_rate,bit_width,kernel_unrolling_flag,"
+    << "append_buffer_capacity,memory_type,num_mults,area,static_power,"
+    << "max_layer_inference_rate,throughput,pareto" << endl;
+  for (size_t i = 0; i < design_points_.size(); ++i) {
+    const DesignPoint& point = design_points_[i];
+    const ConfigParameter& config_param = point.config_param;
+    os << config_param.pixel_inference_rate() << ","
+      << config_param.bit_width() << ","
+      << config_param.kernel_unrolling_flag() << ","
+      << config_param.append_buffer_capacity() << ","
+      << ConfigParameter_MemoryType_Name(config_param.memory_type()) << ","
+      << point.num_mults << "," << point.area << "," << point.static_power
+      << "," << point.max_inference_rate << "," << point.throughput << ","
+      << point.pareto << endl;
+  }
+}
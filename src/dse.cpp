@@ -0,0 +1,117 @@
+/*
+ * Filename: dse.cpp
+ * ------------------
+ * This is the main file of the design space exploration program. It evaluates
+ * the design points analytically without the SystemC simulation.
+ */
+
+#include "header/design_space_explorer.hpp"
+#include "header/caffe/net.hpp"
+#include "header/caffe/util/io.hpp"
+#include "header/logger.hpp"
+#include "proto/config.pb.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <map>
+#include <cstdlib>
+#include <getopt.h>
+#include <unistd.h>
+
+using namespace std;
+
+// Definition for short & long options
+static const char* const short_options = "hc:o:j:";
+static const struct option long_options[] = {
+  {"help", 0, NULL, 'h'},
+  {"config", 1, NULL, 'c'},
+  {"output", 1, NULL, 'o'},
+  {"threads", 1, NULL, 'j'},
+  {NULL, 0, NULL, 0}
+};
+
+static void PrintUsage(const char* program_name) {
+  cout << "Usage: " << program_name << " options " << endl;
+  cout << "\t-h --help                   Display this usage information"
+    << endl;
+  cout << "\t-c --config dse_filename    Input the design space exploration"
+    << " prototxt (DseParameter)" << endl;
+  cout << "\t-o --output output_filename Output the design point records"
+    << " (default: dse_result.csv)" << endl;
+  cout << "\t-j --threads num_threads    Number of worker threads (default:"
+    << " number of online processors)" << endl;
+  exit(0);
+}
+
+/* Main gateway function */
+int main(int argc, char** argv) {
+  string dse_filename;
+  string output_filename = "dse_result.csv";
+  int num_threads = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+
+  int next_option;
+  do {
+    next_option = getopt_long(argc, argv, short_options, long_options, NULL);
+    switch (next_option) {
+      case 'h':   // -h or --help
+        PrintUsage(argv[0]);
+        break;
+
+      case 'c':   // -c or --config
+        dse_filename = optarg;
+        break;
+
+      case 'o':   // -o or --output
+        output_filename = optarg;
+        break;
+
+      case 'j':   // -j or --threads
+        num_threads = atoi(optarg);
+        break;
+
+      case -1:    // end of option
+        break;
+
+      case '?':   // invalid option
+        PrintUsage(argv[0]);
+        break;
+
+      default:    // unexpected
+        exit(1);
+    }
+  } while (next_option != -1);
+
+  if (dse_filename == "") {
+    cout << "please specify the design space exploration file" << endl;
+    PrintUsage(argv[0]);
+  }
+  config::DseParameter dse_param;
+  if (!ReadProtoFromTextFile(dse_filename, &dse_param)) {
+    cerr << "Error to parse the design space exploration file: "
+      << dse_filename << endl;
+    exit(1);
+  }
+
+  Logger::Configure(dse_param.base_config());
+  // the network architecture is parsed once for all design points
+  map<string, string> fusion_tags;
+  DesignSpaceExplorer::FusionTags(dse_param, &fusion_tags);
+  Net caffe_net(dse_param.base_config().model_file(),
+      dse_param.base_config().fuse_sibling_convs(), fusion_tags);
+  DesignSpaceExplorer explorer(caffe_net, dse_param);
+  cout << "Explore " << explorer.design_points().size() << " design points "
+    << "with " << num_threads << " threads ..." << endl;
+  explorer.Explore(num_threads);
+  explorer.Summary();
+
+  ofstream records(output_filename.c_str());
+  if (!records) {
+    cerr << "[ERROR]: design space exploration result file can NOT open!"
+      << endl;
+    exit(1);
+  }
+  explorer.WriteRecords(records);
+  cout << "Design point records are written to " << output_filename << endl;
+
+  return 0;
+}
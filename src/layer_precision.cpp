@@ -0,0 +1,179 @@
+/*
+ * Filename: layer_precision.cpp
+ * ------------------------------
+ * This file implements the class LayerPrecision.
+ */
+
+#include "header/layer_precision.hpp"
+#include "header/caffe/layer.hpp"
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstdlib>
+#include <fnmatch.h>
+
+using namespace std;
+using namespace config;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The layers are in the topological order, so the blob bit widths are resolved
+ * in the reverse order: a processing element requires its own bit width on the
+ * bottom blob, while the Split, Concat, Eltwise & bypassed layers pass the bit
+ * width required on their top blobs to their bottom blobs. The network input
+ * is not produced by any processing element, thus can not be requantized. A
+ * fused convolution takes the bit width of its sibling convolutions in the
+ * prototxt file.
+ */
+LayerPrecision::LayerPrecision(const Net& net,
+    const ConfigParameter& config_param) {
+  default_bit_width_ = config_param.bit_width();
+  for (int i = 0; i < config_param.layer_bit_width_size(); ++i) {
+    const ConfigParameter::LayerBitWidth& layer_bit_width =
+      config_param.layer_bit_width(i);
+    if (layer_bit_width.bit_width() <= 0) {
+      cerr << "[ERROR]: non-positive bit width " << layer_bit_width.bit_width()
+        << " of layer " << layer_bit_width.layer() << endl;
+      exit(1);
+    }
+    patterns_.push_back(make_pair(layer_bit_width.layer(),
+          layer_bit_width.bit_width()));
+  }
+
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    const caffe::LayerParameter& layer_param =
+      net.layers_[layer_id]->layer_param();
+    if (layer_param.type() == "Convolution" ||
+        layer_param.type() == "InnerProduct" ||
+        layer_param.type() == "Pooling") {
+      layer_bit_width_[layer_id] = SourceBitWidth(
+          net.SourceLayers(layer_param.name()), layer_param.name());
+    }
+  }
+
+  for (int layer_id = net.layers_.size()-1; layer_id >= 0; --layer_id) {
+    const caffe::LayerParameter& layer_param =
+      net.layers_[layer_id]->layer_param();
+    if (layer_param.type() == "Input") {
+      continue;
+    } else if (layer_param.bottom_size() == 0) {
+      cerr << "[ERROR]: layer " << layer_param.name() << " ("
+        << layer_param.type() << ") has no bottom blob, only the Input layer "
+        "can feed the network" << endl;
+      exit(1);
+    } else if (layer_bit_width_.find(layer_id) != layer_bit_width_.end()) {
+      RequireBlobBitWidth(layer_param.bottom(0), layer_bit_width_[layer_id],
+          layer_param.name());
+    } else {
+      // Split, Concat, Eltwise & bypassed layers
+      for (int top_id = 0; top_id < layer_param.top_size(); ++top_id) {
+        map<string, int>::const_iterator iter =
+          blob_bit_width_.find(layer_param.top(top_id));
+        if (iter == blob_bit_width_.end()) {
+          continue;
+        }
+        const int bit_width = iter->second;
+        const int bottom_size = (layer_param.type() == "Concat" ||
+            layer_param.type() == "Eltwise") ? layer_param.bottom_size() : 1;
+        for (int bottom_id = 0; bottom_id < bottom_size; ++bottom_id) {
+          RequireBlobBitWidth(layer_param.bottom(bottom_id), bit_width,
+              layer_param.name());
+        }
+      }
+    }
+  }
+
+  const string input_blob = net.layers_[0]->layer_param().top(0);
+  if (BlobBitWidth(input_blob) != default_bit_width_) {
+    cerr << "[ERROR]: input blob " << input_blob << " is consumed at "
+      << BlobBitWidth(input_blob) << " bits, expect the bit width "
+      << default_bit_width_ << endl;
+    exit(1);
+  }
+}
+
+void LayerPrecision::FusionTags(const ConfigParameter& config_param,
+    map<string, string>* fusion_tags) {
+  if (!config_param.fuse_sibling_convs()) {
+    return;
+  }
+  const Net net(config_param.model_file());
+  const LayerPrecision layer_precision(net, config_param);
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    const caffe::LayerParameter& layer_param =
+      net.layers_[layer_id]->layer_param();
+    if (layer_param.type() != "Convolution") {
+      continue;
+    }
+    ostringstream tag;
+    tag << layer_precision.LayerBitWidth(layer_id) << "/"
+      << layer_precision.BlobBitWidth(layer_param.top(0)) << ";";
+    (*fusion_tags)[layer_param.name()] += tag.str();
+  }
+}
+
+int LayerPrecision::MatchBitWidth(const string& layer_name) const {
+  for (vector<pair<string, int> >::const_iterator iter = patterns_.begin();
+      iter != patterns_.end(); ++iter) {
+    if (fnmatch(iter->first.c_str(), layer_name.c_str(), 0) == 0) {
+      return iter->second;
+    }
+  }
+  return default_bit_width_;
+}
+
+int LayerPrecision::SourceBitWidth(const vector<string>& source_layers,
+    const string& layer_name) const {
+  const int bit_width = MatchBitWidth(source_layers[0]);
+  for (size_t i = 1; i < source_layers.size(); ++i) {
+    if (MatchBitWidth(source_layers[i]) != bit_width) {
+      cerr << "[ERROR]: layer " << layer_name << " fuses " << source_layers[0]
+        << " of " << bit_width << " bits and " << source_layers[i] << " of "
+        << MatchBitWidth(source_layers[i]) << " bits" << endl;
+      exit(1);
+    }
+  }
+  return bit_width;
+}
+
+void LayerPrecision::RequireBlobBitWidth(const string& blob_name,
+    int bit_width, const string& layer_name) {
+  map<string, int>::const_iterator iter = blob_bit_width_.find(blob_name);
+  if (iter != blob_bit_width_.end() && iter->second != bit_width) {
+    cerr << "[ERROR]: blob " << blob_name << " is consumed at both "
+      << iter->second << " and " << bit_width << " bits (layer " << layer_name
+      << ")" << endl;
+    exit(1);
+  }
+  blob_bit_width_[blob_name] = bit_width;
+}
+
+int LayerPrecision::LayerBitWidth(int layer_id) const {
+  map<int, int>::const_iterator iter = layer_bit_width_.find(layer_id);
+  return (iter == layer_bit_width_.end()) ? default_bit_width_ : iter->second;
+}
+
+int LayerPrecision::BlobBitWidth(const string& blob_name) const {
+  map<string, int>::const_iterator iter = blob_bit_width_.find(blob_name);
+  return (iter == blob_bit_width_.end()) ? default_bit_width_ : iter->second;
+}
+
+int LayerPrecision::MaxBitWidth() const {
+  int max_bit_width = default_bit_width_;
+  for (map<int, int>::const_iterator iter = layer_bit_width_.begin();
+      iter != layer_bit_width_.end(); ++iter) {
+    max_bit_width = max(max_bit_width, iter->second);
+  }
+  return max_bit_width;
+}
+
+bool LayerPrecision::mixed() const {
+  for (map<int, int>::const_iterator iter = layer_bit_width_.begin();
+      iter != layer_bit_width_.end(); ++iter) {
+    if (iter->second != default_bit_width_) {
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,38 @@
+/*
+ * Filename: logger.cpp
+ * ---------------------
+ * This file implements the class Logger.
+ */
+
+#include "header/logger.hpp"
+#include <cstdlib>
+
+using namespace std;
+using namespace config;
+
+int Logger::levels_[Logger::NUM_MODULES] = {INFO, INFO, INFO, INFO, INFO,
+  INFO};
+
+const char* const Logger::module_names_[Logger::NUM_MODULES] = {"net",
+  "convnet_acc", "testbench", "mult_array", "pool_array", "tlm"};
+
+void Logger::Configure(const ConfigParameter& config_param) {
+  for (int module = 0; module < NUM_MODULES; ++module) {
+    levels_[module] = config_param.log_level();
+  }
+  for (int i = 0; i < config_param.module_log_level_size(); ++i) {
+    const ConfigParameter::ModuleLogLevel& module_log_level =
+      config_param.module_log_level(i);
+    int module = 0;
+    while (module < NUM_MODULES &&
+        module_log_level.module() != module_names_[module]) {
+      ++module;
+    }
+    if (module == NUM_MODULES) {
+      cerr << "[ERROR]: unknown log module " << module_log_level.module()
+        << endl;
+      exit(1);
+    }
+    levels_[module] = module_log_level.level();
+  }
+}
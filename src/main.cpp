@@ -6,30 +6,332 @@
 
 #include "header/cmd_parser.hpp"
 #include "header/caffe/net.hpp"
+#include "header/layer_precision.hpp"
+#include "header/logger.hpp"
+#include "header/net_partitioner.hpp"
 #include "header/systemc/top.hpp"
+#include "header/systemc/parallelism_allocator.hpp"
+#include "header/systemc/tlm/tlm_convnet_acc.hpp"
+#include "header/systemc/tlm/tlm_testbench.hpp"
 #include "header/verilog/verilog_compiler.hpp"
 #include "proto/config.pb.h"
 #include <iostream>
+#include <fstream>
+#include <map>
+#include <vector>
+#include <sstream>
+#include <cerrno>
+#include <cstdio>
 #include <systemc.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 
 using namespace std;
 
+/*
+ * Function: RunBatch
+ * -------------------
+ * Generate the project of every design point in the batch, and write one
+ * comma-separated record per design point to the output file. The parsed
+ * network is shared by the design points of the same model file.
+ */
+static void RunBatch(const CmdParser& cmd_parser) {
+  ofstream records(cmd_parser.output_filename.c_str());
+  if (!records) {
+    cerr << "[ERROR]: batch result file can NOT open!" << endl;
+    exit(1);
+  }
+  records << "name,model_file,bit_width,memory_type,pixel_inference_rate,"
+    << "append_buffer_capacity,inception_buffer_depth,kernel_unrolling_flag,"
+    << "max_layer_inference_rate,project" << endl;
+
+  map<string, Net*> nets;
+  for (size_t i = 0; i < cmd_parser.batch_config_param.size(); ++i) {
+    const config::ConfigParameter& config_param =
+      cmd_parser.batch_config_param[i];
+    const string& name = cmd_parser.batch_config_name[i];
+    cout << "Design point[" << i << "]: " << name << endl;
+    Logger::Configure(config_param);
+
+    // reuse the parsed network architecture (fused or not), the fused
+    // siblings depend on the bit widths of the design point
+    map<string, string> fusion_tags;
+    LayerPrecision::FusionTags(config_param, &fusion_tags);
+    string net_key = config_param.model_file() +
+      (config_param.fuse_sibling_convs() ? "#fused" : "");
+    for (map<string, string>::const_iterator iter = fusion_tags.begin();
+        iter != fusion_tags.end(); ++iter) {
+      net_key += "#" + iter->first + ":" + iter->second;
+    }
+    Net*& net = nets[net_key];
+    if (net == NULL) {
+      net = new Net(config_param.model_file(),
+          config_param.fuse_sibling_convs(), fusion_tags);
+    }
+
+    const string project = "./project/" + name;
+    VerilogCompiler verilog_compiler(*net, config_param);
+    verilog_compiler.GenerateProj(project);
+
+    const string memory_type = (config_param.memory_type() ==
+      config::ConfigParameter_MemoryType_RAM) ? "RAM" : "ROM";
+    records << name << "," << config_param.model_file() << ","
+      << config_param.bit_width() << "," << memory_type << ","
+      << config_param.pixel_inference_rate() << ","
+      << config_param.append_buffer_capacity() << ","
+      << config_param.inception_buffer_depth() << ","
+      << config_param.kernel_unrolling_flag() << ","
+      << verilog_compiler.max_layer_inference_rate() << "," << project << endl;
+  }
+
+  for (map<string, Net*>::iterator iter = nets.begin(); iter != nets.end();
+      ++iter) {
+    delete iter->second;
+  }
+  cout << "Batch results are written to " << cmd_parser.output_filename
+    << endl;
+}
+
+/*
+ * Function: RunTransactionLevel
+ * ------------------------------
+ * Simulate the transaction-level model of the ConvNetAcc, and report the same
+ * throughput statistics as the Testbench together with the max depth of each
+ * channel buffer. If result_filename is set, the avg injection interval & frame
+ * latency followed by the channel buffer depths are also written to it.
+ */
+static void RunTransactionLevel(const Net& net,
+    const config::ConfigParameter& config_param,
+    const string& result_filename="") {
+  TlmConvNetAcc convnet_acc("convnet_acc", net, config_param);
+  TlmTestbench testbench("testbench", convnet_acc.input_spatial_dim_,
+      convnet_acc.output_spatial_dim_, config_param.early_stop_frame_size(),
+      config_param.num_frames(), convnet_acc.clock_period_,
+      convnet_acc.input_width_, convnet_acc.input_pixels_);
+  testbench.input_layer_socket.bind(convnet_acc.input_layer_socket);
+  convnet_acc.output_layer_socket.bind(testbench.output_layer_socket);
+
+  // clock frequency [GHz]
+  const double clk_freq = config_param.clk_freq();
+  const int sim_period = config_param.sim_period();
+  if (sim_period > 0) {
+    cout << "starts transaction-level simulation for " << sim_period
+      << " cycles ..." << endl;
+    sc_start(sim_period/clk_freq, SC_NS);
+  } else {
+    cout << "starts transaction-level simulation until early stop ..." << endl;
+    sc_start();
+  }
+
+  testbench.ReportStatistics();
+  convnet_acc.ReportBufferDepth();
+
+  if (!result_filename.empty()) {
+    ofstream result(result_filename.c_str());
+    if (!result) {
+      cerr << "[ERROR]: result file " << result_filename << " can NOT open!"
+        << endl;
+      exit(1);
+    }
+    result << testbench.AvgInjectionInterval() << " "
+      << testbench.AvgFrameLatency() << endl;
+    convnet_acc.ReportBufferDepth(result);
+  }
+}
+
+/*
+ * Function: RunSegments
+ * ----------------------
+ * Cut the net into segments by the NetPartitioner, and simulate the
+ * transaction-level model of each segment in a forked process, i.e. with its
+ * own SystemC kernel, logging to segments/segment_<id>.log. Each segment keeps
+ * the layer inference rate of the whole net, so its pixel_inference_rate is
+ * scaled by its input spatial dimension. The accelerator is paced by the
+ * segment of the longest frame period, and the channel buffer depths of all
+ * segments are reported together.
+ */
+static void RunSegments(const Net& net,
+    const config::ConfigParameter& config_param) {
+  NetPartitioner partitioner(net, config_param.num_segments());
+  partitioner.Summary();
+  const vector<NetPartitioner::Segment>& segments = partitioner.segments();
+
+  // layer inference rate of the whole net
+  ParallelismAllocator allocator(net, config_param);
+  long int layer_inference_rate;
+  if (config_param.multiplier_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::MULTIPLIER,
+        config_param.multiplier_budget());
+    layer_inference_rate = allocator.max_inference_rate();
+  } else if (config_param.area_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::AREA, config_param.area_budget());
+    layer_inference_rate = allocator.max_inference_rate();
+  } else {
+    layer_inference_rate = static_cast<long int>(
+        allocator.input_spatial_dim()) * config_param.pixel_inference_rate();
+  }
+
+  if (mkdir("segments", 0755) != 0 && errno != EEXIST) {
+    cerr << "[ERROR]: can NOT create the folder segments" << endl;
+    exit(1);
+  }
+  vector<pid_t> pids;
+  for (size_t i = 0; i < segments.size(); ++i) {
+    config::ConfigParameter segment_config = config_param;
+    segment_config.set_num_segments(1);
+    segment_config.clear_multiplier_budget();
+    segment_config.clear_area_budget();
+    segment_config.clear_input_file();
+    segment_config.set_pixel_inference_rate((layer_inference_rate +
+          segments[i].input_spatial_dim - 1) / segments[i].input_spatial_dim);
+    caffe::NetParameter segment_param;
+    partitioner.SegmentParam(i, &segment_param);
+
+    ostringstream prefix;
+    prefix << "segments/segment_" << i;
+    // flush before fork, otherwise the buffered output is written twice
+    cout.flush();
+    fflush(stdout);
+    const pid_t pid = fork();
+    if (pid < 0) {
+      cerr << "[ERROR]: can NOT fork the simulation of segment " << i << endl;
+      exit(1);
+    } else if (pid == 0) {
+      if (freopen((prefix.str() + ".log").c_str(), "w", stdout) == NULL) {
+        cerr << "[ERROR]: log file " << prefix.str() << ".log can NOT open!"
+          << endl;
+        _exit(1);
+      }
+      Logger::Configure(segment_config);
+      Net segment_net(segment_param);
+      RunTransactionLevel(segment_net, segment_config,
+          prefix.str() + ".result");
+      cout.flush();
+      fflush(stdout);
+      _exit(0);
+    }
+    cout << "- Segment[" << i << "]: simulated by process " << pid
+      << " with pixel_inference_rate " << segment_config.
+      pixel_inference_rate() << endl;
+    pids.push_back(pid);
+  }
+
+  bool failed = false;
+  for (size_t i = 0; i < pids.size(); ++i) {
+    int status;
+    if (waitpid(pids[i], &status, 0) < 0 || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+      cerr << "[ERROR]: simulation of segment " << i << " failed, see "
+        << "segments/segment_" << i << ".log" << endl;
+      failed = true;
+    }
+  }
+  if (failed) {
+    exit(1);
+  }
+
+  // stitch the results
+  cout << "#############################" << endl;
+  cout << "# Statistics of segmented ConvNet Asic " << endl;
+  cout << "#############################" << endl;
+  double frame_period = 0, frame_latency = 0;
+  size_t bottleneck = 0;
+  vector<vector<string> > buffer_depths(segments.size());
+  for (size_t i = 0; i < segments.size(); ++i) {
+    ostringstream filename;
+    filename << "segments/segment_" << i << ".result";
+    ifstream result(filename.str().c_str());
+    double avg_interval, avg_latency;
+    if (!(result >> avg_interval >> avg_latency)) {
+      cerr << "[ERROR]: malformed result file " << filename.str() << endl;
+      exit(1);
+    }
+    string line;
+    while (getline(result, line)) {
+      if (!line.empty() && line[0] != '#') {
+        buffer_depths[i].push_back(line);
+      }
+    }
+
+    const double period = avg_interval * segments[i].input_spatial_dim;
+    cout << "# Segment[" << i << "] avg injection interval [cycles]: "
+      << avg_interval << ", frame period [cycles]: " << period
+      << ", avg frame latency [cycles]: " << avg_latency << endl;
+    if (period > frame_period) {
+      frame_period = period;
+      bottleneck = i;
+    }
+    frame_latency += avg_latency;
+  }
+  cout << "# Bottleneck: Segment[" << bottleneck << "]" << endl;
+  cout << "# Frame period [cycles]: " << frame_period << endl;
+  cout << "# Avg injection interval (throughput) [cycles]: " << frame_period /
+    segments[0].input_spatial_dim << endl;
+  cout << "# Sum of avg segment frame latencies [cycles]: " << frame_latency
+    << endl;
+
+  cout << "#############################" << endl;
+  cout << "# Channel buffer depth (TLM)" << endl;
+  cout << "#############################" << endl;
+  for (size_t i = 0; i < buffer_depths.size(); ++i) {
+    for (size_t j = 0; j < buffer_depths[i].size(); ++j) {
+      cout << "Segment[" << i << "] " << buffer_depths[i][j] << endl;
+    }
+  }
+}
+
 /* Main gateway function */
 int sc_main (int argc, char **argv) {
   // parse the inline commands
   CmdParser cmd_parser(argc, argv);
   cmd_parser.Parse();
+  if (cmd_parser.batch_mode()) {
+    // run all design points in the batch
+    RunBatch(cmd_parser);
+    return 0;
+  }
   // print the parsed configuration file
   cmd_parser.ConfigParamSummary();
+  Logger::Configure(cmd_parser.config_param);
 
   // parse the network architecture prototxt file
-  Net caffe_net(cmd_parser.model_filename);
+  map<string, string> fusion_tags;
+  LayerPrecision::FusionTags(cmd_parser.config_param, &fusion_tags);
+  Net caffe_net(cmd_parser.model_filename,
+      cmd_parser.config_param.fuse_sibling_convs(), fusion_tags);
 
   // Verilog Compiler of the parsed caffenet
   VerilogCompiler verilog_compiler(caffe_net, cmd_parser.config_param);
   verilog_compiler.GenerateProj("./project");
 
-/* TODO
+  if (cmd_parser.config_param.simulation_mode() ==
+      config::ConfigParameter_SimulationMode_TRANSACTION_LEVEL) {
+    // fast throughput estimation with the transaction-level model, which
+    // simulates neither the data path nor the state of the modules
+    if (!cmd_parser.config_param.checkpoint_file().empty() ||
+        !cmd_parser.config_param.restore_file().empty() ||
+        cmd_parser.config_param.zero_skipping()) {
+      cerr << "[ERROR]: checkpoint_file, restore_file & zero_skipping are "
+        "only supported by the CYCLE_ACCURATE simulation_mode" << endl;
+      exit(1);
+    }
+    if (cmd_parser.config_param.num_segments() > 1) {
+      RunSegments(caffe_net, cmd_parser.config_param);
+    } else {
+      RunTransactionLevel(caffe_net, cmd_parser.config_param);
+    }
+    return 0;
+  }
+
+  // cycle accurate simulation of the Top, which also models the checkpoint &
+  // restore, the zero skipping and the stream of input frames
+  if (cmd_parser.config_param.num_segments() > 1) {
+    cerr << "[ERROR]: num_segments is only supported by the "
+      "TRANSACTION_LEVEL simulation_mode" << endl;
+    exit(1);
+  }
+
   // create trace file
   sc_trace_file* tf = NULL;
   sc_set_time_resolution(100, SC_PS);
@@ -54,7 +356,10 @@ int sc_main (int argc, char **argv) {
 
   // run the simulation
   const int reset_period = cmd_parser.config_param.reset_period();
-  assert(reset_period > 0);
+  if (reset_period <= 0) {
+    cerr << "[ERROR]: non-positive reset_period: " << reset_period << endl;
+    exit(1);
+  }
   cout << "starts reset for " << reset_period << " cycles ..." << endl;
   reset.write(1);
   sc_start(reset_period/clk_freq, SC_NS);
@@ -95,7 +400,6 @@ int sc_main (int argc, char **argv) {
   if (tf) {
     sc_close_vcd_trace_file(tf);
   }
-  */
 
   return 0;
 }
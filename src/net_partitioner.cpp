@@ -0,0 +1,168 @@
+/*
+ * Filename: net_partitioner.cpp
+ * ------------------------------
+ * This file implements the class NetPartitioner.
+ */
+
+#include "header/net_partitioner.hpp"
+#include "header/caffe/layer.hpp"
+#include <iostream>
+#include <sstream>
+#include <map>
+#include <set>
+
+using namespace std;
+using namespace caffe;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The layers are in the topological order, so the blobs alive after a layer
+ * are the ones produced so far & consumed by any later layer. The min max cost
+ * is searched over the budget of processing elements per segment, where the
+ * greedy partition taking the furthest cut within the budget is the one with
+ * the fewest segments.
+ */
+NetPartitioner::NetPartitioner(const Net& net, int max_segments) {
+  net_ = &net;
+  const int num_layers = net.layers_.size();
+  map<string, int> last_use;
+  for (int layer_id = 0; layer_id < num_layers; ++layer_id) {
+    const LayerParameter& layer_param = net.layers_[layer_id]->layer_param();
+    for (int bottom_id = 0; bottom_id < layer_param.bottom_size();
+        ++bottom_id) {
+      last_use[layer_param.bottom(bottom_id)] = layer_id;
+    }
+  }
+
+  set<string> alive;
+  prefix_cost_.resize(num_layers);
+  cut_blob_.resize(num_layers);
+  for (int layer_id = 0; layer_id < num_layers; ++layer_id) {
+    const LayerParameter& layer_param = net.layers_[layer_id]->layer_param();
+    const bool pe = (layer_param.type() == "Convolution" ||
+        layer_param.type() == "InnerProduct" ||
+        layer_param.type() == "Pooling");
+    prefix_cost_[layer_id] = PrefixCost(layer_id-1) + (pe ? 1 : 0);
+
+    for (int bottom_id = 0; bottom_id < layer_param.bottom_size();
+        ++bottom_id) {
+      if (last_use[layer_param.bottom(bottom_id)] == layer_id) {
+        alive.erase(layer_param.bottom(bottom_id));
+      }
+    }
+    for (int top_id = 0; top_id < layer_param.top_size(); ++top_id) {
+      map<string, int>::const_iterator iter =
+        last_use.find(layer_param.top(top_id));
+      if (iter != last_use.end() && iter->second > layer_id) {
+        alive.insert(layer_param.top(top_id));
+      }
+    }
+    if (alive.size() == 1) {
+      const string& blob_name = *alive.begin();
+      const int blob_id = net.blobs_name_to_idx_.find(blob_name)->second;
+      if (net.blobs_shape_[blob_id]->size() == 4) {
+        cut_blob_[layer_id] = blob_name;
+      }
+    }
+  }
+
+  // legal cuts leaving processing elements on both sides
+  const int total_cost = PrefixCost(num_layers-1);
+  vector<int> cuts;
+  for (int layer_id = 0; layer_id < num_layers-1; ++layer_id) {
+    if (!cut_blob_[layer_id].empty() && PrefixCost(layer_id) > 0 &&
+        PrefixCost(layer_id) < total_cost) {
+      cuts.push_back(layer_id);
+    }
+  }
+  vector<int> best_cuts;
+  for (int max_cost = 1; max_cost <= total_cost && max_segments > 1;
+      ++max_cost) {
+    vector<int> result;
+    Partition(cuts, max_cost, &result);
+    if (static_cast<int>(result.size()) < max_segments) {
+      best_cuts = result;
+      break;
+    }
+  }
+
+  best_cuts.push_back(num_layers-1);
+  for (size_t i = 0; i < best_cuts.size(); ++i) {
+    Segment segment;
+    segment.first_layer = (i == 0) ? 0 : best_cuts[i-1]+1;
+    segment.last_layer = best_cuts[i];
+    segment.input_blob = (i == 0) ?
+      net.layers_[0]->layer_param().top(0) : cut_blob_[best_cuts[i-1]];
+    const Net::BlobShape* shape = net.blobs_shape_[
+      net.blobs_name_to_idx_.find(segment.input_blob)->second];
+    segment.input_spatial_dim = shape->at(2) * shape->at(3);
+    segment.num_pe = PrefixCost(segment.last_layer) -
+      PrefixCost(segment.first_layer-1);
+    segments_.push_back(segment);
+  }
+}
+
+void NetPartitioner::Partition(const vector<int>& cuts, int max_cost,
+    vector<int>* result) const {
+  result->clear();
+  const int total_cost = PrefixCost(net_->layers_.size()-1);
+  int base = -1;
+  size_t next = 0;
+  while (total_cost - PrefixCost(base) > max_cost) {
+    // skip the cuts without any processing element in the segment
+    while (next < cuts.size() && PrefixCost(cuts[next]) == PrefixCost(base)) {
+      ++next;
+    }
+    if (next == cuts.size()) {
+      return;
+    }
+    // the furthest cut within the budget, or the nearest one otherwise
+    size_t cut = next;
+    while (cut+1 < cuts.size() &&
+        PrefixCost(cuts[cut+1]) - PrefixCost(base) <= max_cost) {
+      ++cut;
+    }
+    result->push_back(cuts[cut]);
+    base = cuts[cut];
+    next = cut+1;
+  }
+}
+
+void NetPartitioner::SegmentParam(int segment_id, NetParameter* param) const {
+  const Segment& segment = segments_.at(segment_id);
+  ostringstream name;
+  name << net_->name_ << "_segment" << segment_id;
+  param->Clear();
+  param->set_name(name.str());
+  if (segment_id > 0) {
+    LayerParameter* input_layer = param->add_layer();
+    input_layer->set_name(segment.input_blob);
+    input_layer->set_type("Input");
+    input_layer->add_top(segment.input_blob);
+    caffe::BlobShape* shape = input_layer->mutable_input_param()->add_shape();
+    const Net::BlobShape* blob_shape = net_->blobs_shape_[
+      net_->blobs_name_to_idx_.find(segment.input_blob)->second];
+    for (size_t i = 0; i < blob_shape->size(); ++i) {
+      shape->add_dim(blob_shape->at(i));
+    }
+  }
+  for (int layer_id = segment.first_layer; layer_id <= segment.last_layer;
+      ++layer_id) {
+    *param->add_layer() = net_->layers_[layer_id]->layer_param();
+  }
+}
+
+void NetPartitioner::Summary() const {
+  cout << "##################################################" << endl;
+  cout << "# Network segments" << endl;
+  cout << "##################################################" << endl;
+  for (size_t i = 0; i < segments_.size(); ++i) {
+    const Segment& segment = segments_[i];
+    cout << "- Segment[" << i << "]: " << net_->layers_name_[
+      segment.first_layer] << " ... " << net_->layers_name_[
+      segment.last_layer] << " with input " << segment.input_blob << " ("
+      << segment.input_spatial_dim << " pixels) and " << segment.num_pe
+      << " processing elements" << endl;
+  }
+}
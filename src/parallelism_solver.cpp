@@ -0,0 +1,102 @@
+/*
+ * Filename: parallelism_solver.cpp
+ * ---------------------------------
+ * This file implements the parallelism solver defined in
+ * parallelism_solver.hpp.
+ */
+
+#include "header/parallelism_solver.hpp"
+#include <cmath>
+
+using namespace std;
+
+/*
+ * Implementation notes: CeilQuotientCandidates
+ * ---------------------------------------------
+ * For the quotient q = ceil(N/P), all P in [P, ceil(N/(q-1))) share the same
+ * quotient. We therefore jump directly to the next block, which visits each
+ * distinct quotient exactly once with the smallest P achieving it.
+ */
+void CeilQuotientCandidates(int N, vector<pair<int, int> >* candidates) {
+  candidates->clear();
+  int P = 1;
+  while (P <= N) {
+    const int q = (N + P - 1) / P;
+    candidates->push_back(make_pair(q, P));
+    if (q == 1) {
+      break;
+    }
+    // smallest P' such that ceil(N/P') <= q-1
+    P = (N + q - 2) / (q - 1);
+  }
+}
+
+/*
+ * Implementation notes: SolveParallelism
+ * ---------------------------------------
+ * The calculated rate only depends on the quotients ceil(Nin/Pin),
+ * ceil(Nout/Pout) and ceil(K/Pk). For each distinct quotient we only need to
+ * consider the smallest parallelism achieving it, since a larger one gives the
+ * same rate and loses the tie-breaking. The candidates are visited in the order
+ * of increasing Pin, Pout, Pk, so a strictly smaller error keeps the first
+ * minimum as the exhaustive search does.
+ *
+ * The quotients decrease along each candidate list, so the calculated rate is
+ * monotonic in the inner loops. Once it drops below the target by at least the
+ * best error found so far, the rest of the loop cannot improve the result.
+ */
+pair<pair<int, int>, int> SolveParallelism(int Nin, int Nout, int K,
+    bool kernel_unrolling, double rate, int min_out_iter, double max_error) {
+  vector<pair<int, int> > in_candidates, out_candidates, k_candidates;
+  CeilQuotientCandidates(Nin, &in_candidates);
+  CeilQuotientCandidates(Nout, &out_candidates);
+  if (kernel_unrolling) {
+    CeilQuotientCandidates(K, &k_candidates);
+  } else if (K > 0) {
+    // Pk = Kernel size if kernel unrolling option is disabled
+    k_candidates.push_back(make_pair(1, K));
+  }
+  // only keep the output candidates satisfying the dependency constraint
+  vector<pair<int, int> >::iterator out_end = out_candidates.begin();
+  while (out_end != out_candidates.end() && out_end->first >= min_out_iter) {
+    ++out_end;
+  }
+  out_candidates.erase(out_end, out_candidates.end());
+  if (in_candidates.empty() || out_candidates.empty() ||
+      k_candidates.empty()) {
+    return make_pair(make_pair(1, 1), 1);
+  }
+
+  const double max_out_k = static_cast<double>(out_candidates.front().first) *
+    k_candidates.front().first;
+  int Pin = 1, Pout = 1, Pk = 1;
+  double min = max_error;
+  for (vector<pair<int, int> >::const_iterator in_iter = in_candidates.begin();
+      in_iter != in_candidates.end(); ++in_iter) {
+    const double in_rate = static_cast<double>(in_iter->first);
+    if (in_rate * max_out_k < rate && rate - in_rate * max_out_k >= min) {
+      break;
+    }
+    for (vector<pair<int, int> >::const_iterator out_iter =
+        out_candidates.begin(); out_iter != out_candidates.end(); ++out_iter) {
+      const double in_out_rate = in_rate * out_iter->first;
+      const double max_rate = in_out_rate * k_candidates.front().first;
+      if (max_rate < rate && rate - max_rate >= min) {
+        break;
+      }
+      for (vector<pair<int, int> >::const_iterator k_iter =
+          k_candidates.begin(); k_iter != k_candidates.end(); ++k_iter) {
+        const double calculated_rate = in_out_rate * k_iter->first;
+        if (abs(calculated_rate - rate) < min) {
+          min = abs(calculated_rate - rate);
+          Pin = in_iter->second;
+          Pout = out_iter->second;
+          Pk = k_iter->second;
+        } else if (calculated_rate < rate) {
+          break;
+        }
+      }
+    }
+  }
+  return make_pair(make_pair(Pin, Pout), Pk);
+}
@@ -5,6 +5,7 @@
  */
 
 #include "header/systemc/add_array.hpp"
+#include "header/systemc/event_gating.hpp"
 using namespace std;
 
 /*
@@ -33,6 +34,15 @@ AddArray::AddArray(sc_module_name module_name, int Kh, int Kw, int Pin,
     sensitive << clock.pos() << reset;
 
     add_reg_ = new Payload [Pout_];
+
+    // fast paths of the common kernel parallelism as the MultArray
+    switch (Pk_) {
+      case 1: sum_products_ = &AddArray::SumProducts<1>; break;
+      case 7: sum_products_ = &AddArray::SumProducts<7>; break;
+      case 9: sum_products_ = &AddArray::SumProducts<9>; break;
+      case 25: sum_products_ = &AddArray::SumProducts<25>; break;
+      default: sum_products_ = &AddArray::SumProducts<0>; break;
+    }
   }
 
 /*
@@ -55,6 +65,9 @@ AddArray::~AddArray() {
  * Add the results from every multiplier array.
  */
 void AddArray::AddArrayProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
   if (reset.read()) {
     for (int i = 0; i < Pout_; ++i) {
       add_array_out_data[i].write(Payload(0));
@@ -68,13 +81,7 @@ void AddArray::AddArrayProc() {
         dynamic_energy_ += adder_model_->DynamicEnergyOfOneOperation()*Pin_*Pk_;
 #ifdef DATA_PATH
         // summing the Pin kernel activation results & partial results
-        Payload result;
-        // add over Pin Kh*Kw kernels
-        for (int i = 0; i < Pin_; ++i) {
-          for (int k = 0; k < Pk_; ++k) {
-            result = result + add_array_mult_in_data[o*Pin_*Pk_+i*Pk_+k].read();
-          }
-        }
+        Payload result = (this->*sum_products_)(o);
         if (add_array_accumulate_kernel.read()) {
           // accumulate with the output register
           result = result + add_reg_[o];
@@ -93,6 +100,22 @@ void AddArray::AddArrayProc() {
       }
     }
   }
+
+  SleepUntilEnabled(add_array_enable, reset);
+}
+
+template <int PK>
+Payload AddArray::SumProducts(int o) const {
+  const int Pk = (PK > 0) ? PK : Pk_;
+  const sc_in<Payload>* mult_in_data = &add_array_mult_in_data[o*Pin_*Pk];
+  Payload result;
+  // add over Pin Kh*Kw kernels
+  for (int i = 0; i < Pin_; ++i) {
+    for (int k = 0; k < Pk; ++k) {
+      result = result + mult_in_data[i*Pk+k].read();
+    }
+  }
+  return result;
 }
 
 /*
@@ -9,12 +9,8 @@ using namespace std;
 
 ChannelBuffer::ChannelBuffer(sc_module_name module_name, int Nin, int capacity,
     int bit_width, int tech_node, double clk_freq)
-  : sc_module(module_name), Nin_(Nin), capacity_(capacity) {
-  // allocate the port width
-  prev_layer_data = new sc_in<Payload> [Nin];
-  next_layer_data = new sc_out<Payload> [Nin];
-  // allocate the buffer for each channel
-  buffer_ = new queue<Payload> [Nin];
+  : sc_module(module_name), Nin_(Nin), capacity_(capacity),
+  buffer_(Nin, capacity), zero_data_(Nin), front_data_(Nin) {
 
   if (capacity > 0) {
     // model the channel buffer if capacity > 0
@@ -26,10 +22,7 @@ ChannelBuffer::ChannelBuffer(sc_module_name module_name, int Nin, int capacity,
   } else {
     // simplify the buffer into purly combination logic
     SC_METHOD(ChannelBufferCombLogic);
-    sensitive << prev_layer_valid << next_layer_rdy;
-    for (int i = 0;i < Nin; ++i) {
-      sensitive << prev_layer_data[i];
-    }
+    sensitive << prev_layer_valid << next_layer_rdy << prev_layer_data;
   }
 
   // we will use the default Memory Model depth as the initial memory depth
@@ -38,6 +31,7 @@ ChannelBuffer::ChannelBuffer(sc_module_name module_name, int Nin, int capacity,
   const int memory_width = Nin * bit_width;
   const int memory_depth = INIT_MEM_DEPTH;
   max_buffer_size_ = 0;
+  reset_max_buffer_size_ = 0;
   memory_model_ = new MemoryModel(memory_width, memory_depth, tech_node,
       config::ConfigParameter_MemoryType_RAM, clk_freq);
   // initialize the dynamic energy
@@ -49,9 +43,6 @@ ChannelBuffer::ChannelBuffer(sc_module_name module_name, int Nin, int capacity,
 }
 
 ChannelBuffer::~ChannelBuffer() {
-  delete [] prev_layer_data;
-  delete [] next_layer_data;
-  delete [] buffer_;
   delete memory_model_;
 }
 
@@ -62,9 +53,13 @@ ChannelBuffer::~ChannelBuffer() {
  * always accept the upstreaming data and push it into the buffer.
  */
 void ChannelBuffer::ChannelBufferRX() {
-  // reset behavior
+  // reset behavior (to the restored state if any)
   prev_layer_rdy.write(0);
-  max_buffer_size_ = 0;
+  buffer_.Clear();
+  for (size_t i = 0; i < reset_pixels_.size(); i += Nin_) {
+    buffer_.Push(&reset_pixels_[i]);
+  }
+  max_buffer_size_ = reset_max_buffer_size_;
   wait();
 
   while (true) {
@@ -84,9 +79,7 @@ void ChannelBuffer::ChannelBufferRX() {
 
       // push the data into channel buffer
       prev_layer_rdy.write(0);
-      for (int i = 0; i < Nin_; ++i) {
-        buffer_[i].push(prev_layer_data[i]);
-      }
+      buffer_.Push(&prev_layer_data.read()[0]);
       // update the max buffer size
       if (max_buffer_size_ < BufferSize()) {
         max_buffer_size_ = BufferSize();
@@ -109,17 +102,14 @@ void ChannelBuffer::ChannelBufferRX() {
 void ChannelBuffer::ChannelBufferTX() {
   // reset behavior
   next_layer_valid.write(0);
-  for (int i = 0; i < Nin_; ++i) {
-    next_layer_data[i].write(Payload(0));
-  }
+  next_layer_data.write(zero_data_);
   wait();
 
   while (true) {
     if (BufferSize() > 0) {
       next_layer_valid.write(1);
-      for (int i = 0; i < Nin_; ++i) {
-        next_layer_data[i].write(buffer_[i].front());
-      }
+      buffer_.Front(&front_data_);
+      next_layer_data.write(front_data_);
       // increments the dynamic energy
       dynamic_read_energy_ += memory_model_->DynamicEnergyOfReadOperation();
       do {
@@ -127,9 +117,7 @@ void ChannelBuffer::ChannelBufferTX() {
       } while (!next_layer_rdy.read());
 
       // pop the data out
-      for (int i = 0; i < Nin_; ++i) {
-        buffer_[i].pop();
-      }
+      buffer_.Pop();
       // deassert the valid
       next_layer_valid.write(0);
     } else {
@@ -137,15 +125,11 @@ void ChannelBuffer::ChannelBufferTX() {
       if (prev_layer_valid.read() && next_layer_rdy.read() &&
           !next_layer_valid.read()) {
         next_layer_valid.write(1);
-        for (int i = 0; i < Nin_; ++i) {
-          next_layer_data[i].write(prev_layer_data[i].read());
-        }
+        next_layer_data.write(prev_layer_data.read());
       } else {
         // empty buffer: no data to be transmitted
         next_layer_valid.write(0);
-        for (int i = 0; i < Nin_; ++i) {
-          next_layer_data[i].write(Payload(0));
-        }
+        next_layer_data.write(zero_data_);
       }
       wait();
     }
@@ -161,14 +145,39 @@ void ChannelBuffer::ChannelBufferCombLogic() {
   // write the input to the output
   next_layer_valid.write(prev_layer_valid.read());
   prev_layer_rdy.write(next_layer_rdy.read());
-  for (int i = 0; i < Nin_; ++i) {
-    next_layer_data[i].write(prev_layer_data[i].read());
-  }
+  next_layer_data.write(prev_layer_data.read());
 }
 
 void ChannelBuffer::ChannelBufferMonitor() {
   //cout << "Channel buffer: " << sc_get_current_process_b()->get_parent_object()
-  //  ->basename() << " with depth " << buffer_[0].size() << endl;
+  //  ->basename() << " with depth " << buffer_.size() << endl;
+}
+
+/*
+ * Implementation notes: SaveState
+ * --------------------------------
+ * The buffered pixels are saved from the front of the FIFO. The max buffer
+ * size is kept as well, since the depth of the warmed-up buffer is reached
+ * before the checkpoint.
+ */
+void ChannelBuffer::SaveState(Checkpoint* checkpoint) const {
+  vector<Payload> pixels;
+  for (int i = 0; i < buffer_.size(); ++i) {
+    pixels.insert(pixels.end(), buffer_.At(i), buffer_.At(i)+Nin_);
+  }
+  checkpoint->Write(name(), max_buffer_size_);
+  checkpoint->WriteVector(name(), pixels);
+}
+
+void ChannelBuffer::RestoreState(Checkpoint* checkpoint) {
+  checkpoint->Read(name(), &reset_max_buffer_size_);
+  checkpoint->ReadVector(name(), &reset_pixels_);
+  if (reset_pixels_.size() % Nin_ != 0 ||
+      static_cast<long int>(reset_pixels_.size() / Nin_) > capacity_) {
+    cerr << "[ERROR]: checkpoint of " << name() << " does not match the "
+      "channel depth" << endl;
+    exit(1);
+  }
 }
 
 /*
@@ -0,0 +1,108 @@
+/*
+ * Filename: checkpoint.cpp
+ * -------------------------
+ * This file implements the class Checkpoint.
+ */
+
+#include "header/systemc/checkpoint.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdint.h>
+using namespace std;
+
+const char Checkpoint::MAGIC[8] = {'C', 'N', 'A', 'C', 'K', 'P', 'T', '1'};
+
+bool Checkpoint::HasRecord(const string& module) const {
+  return records_.find(module) != records_.end();
+}
+
+void Checkpoint::WriteBytes(const string& module, const void* data,
+    size_t size) {
+  vector<char>& record = records_[module];
+  const char* bytes = static_cast<const char*>(data);
+  record.insert(record.end(), bytes, bytes+size);
+}
+
+void Checkpoint::ReadBytes(const string& module, void* data, size_t size) {
+  map<string, vector<char> >::const_iterator iter = records_.find(module);
+  if (iter == records_.end()) {
+    cerr << "[ERROR]: no checkpoint record of " << module << endl;
+    exit(1);
+  }
+  size_t& pos = read_pos_[module];
+  if (pos + size > iter->second.size()) {
+    cerr << "[ERROR]: checkpoint record of " << module << " is shorter than "
+      "expected" << endl;
+    exit(1);
+  }
+  memcpy(data, &iter->second[pos], size);
+  pos += size;
+}
+
+/*
+ * Implementation notes: Save
+ * ---------------------------
+ * The file is the magic number, the no. of records, followed by the records,
+ * each of which is the name length, the name, the payload size & the payload.
+ */
+void Checkpoint::Save(const string& filename) const {
+  ofstream file(filename.c_str(), ios::out | ios::binary);
+  if (!file.is_open()) {
+    cerr << "[ERROR]: can not open checkpoint file " << filename << endl;
+    exit(1);
+  }
+  file.write(MAGIC, sizeof(MAGIC));
+  const uint32_t num_records = records_.size();
+  file.write(reinterpret_cast<const char*>(&num_records), sizeof(num_records));
+  for (map<string, vector<char> >::const_iterator iter = records_.begin();
+      iter != records_.end(); ++iter) {
+    const uint32_t name_size = iter->first.size();
+    const uint64_t record_size = iter->second.size();
+    file.write(reinterpret_cast<const char*>(&name_size), sizeof(name_size));
+    file.write(iter->first.data(), name_size);
+    file.write(reinterpret_cast<const char*>(&record_size),
+        sizeof(record_size));
+    if (record_size > 0) {
+      file.write(&iter->second[0], record_size);
+    }
+  }
+}
+
+void Checkpoint::Load(const string& filename) {
+  ifstream file(filename.c_str(), ios::in | ios::binary);
+  if (!file.is_open()) {
+    cerr << "[ERROR]: can not open checkpoint file " << filename << endl;
+    exit(1);
+  }
+  char magic[sizeof(MAGIC)];
+  uint32_t num_records = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&num_records), sizeof(num_records));
+  if (!file || memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+    cerr << "[ERROR]: " << filename << " is not a checkpoint file" << endl;
+    exit(1);
+  }
+  records_.clear();
+  read_pos_.clear();
+  for (uint32_t i = 0; i < num_records; ++i) {
+    uint32_t name_size = 0;
+    uint64_t record_size = 0;
+    file.read(reinterpret_cast<char*>(&name_size), sizeof(name_size));
+    string name(name_size, '\0');
+    if (name_size > 0) {
+      file.read(&name[0], name_size);
+    }
+    file.read(reinterpret_cast<char*>(&record_size), sizeof(record_size));
+    vector<char>& record = records_[name];
+    record.resize(record_size);
+    if (record_size > 0) {
+      file.read(&record[0], record_size);
+    }
+    if (!file) {
+      cerr << "[ERROR]: truncated checkpoint file " << filename << endl;
+      exit(1);
+    }
+  }
+}
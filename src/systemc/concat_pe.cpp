@@ -13,18 +13,18 @@ using namespace std;
  * The constructor allocates the ports of the block.
  */
 ConcatPe::ConcatPe(sc_module_name module_name, int Nin, int numSplits) :
-  sc_module(module_name), Nin_(Nin), numSplits_(numSplits) {
+  sc_module(module_name), Nin_(Nin), numSplits_(numSplits),
+  concat_data_(Nin) {
   // sanity check: the number of bottom blobs should be greater than 1
   assert(numSplits > 1);
   // allocates the ports
   prev_layer_valid = new sc_in<bool> [numSplits];
   prev_layer_rdy = new sc_out<bool> [numSplits];
-  prev_layer_data = new sc_in<Payload> [Nin];
-  next_layer_data = new sc_out<Payload> [Nin];
+  prev_layer_data = new sc_in<PayloadBus> [numSplits];
 
   // the main process of the concat process
   SC_METHOD(ConcatPeNextData);
-  for (int i = 0; i < Nin; ++i) {
+  for (int i = 0; i < numSplits; ++i) {
     sensitive << prev_layer_data[i];
   }
 
@@ -44,18 +44,27 @@ ConcatPe::~ConcatPe() {
   delete [] prev_layer_valid;
   delete [] prev_layer_rdy;
   delete [] prev_layer_data;
-  delete [] next_layer_data;
 }
 
 /*
  * Implementation notes: ConcatPeNextData
  * ---------------------------------------
- * Bypass the layer data from the previous layer to the next layer.
+ * Concatenate the layer data from the previous layers in the order of the
+ * bottom blobs, and bypass it to the next layer.
  */
 void ConcatPe::ConcatPeNextData() {
-  for (int i = 0; i < Nin_; ++i) {
-    next_layer_data[i].write(prev_layer_data[i].read());
+  int cur_data_blob_idx = 0;
+  for (int i = 0; i < numSplits_; ++i) {
+    const PayloadBus& prev_data = prev_layer_data[i].read();
+    // sanity check: the channel depths of the bottom blobs sum up to Nin
+    assert(cur_data_blob_idx+prev_data.width() <= Nin_);
+    for (int j = 0; j < prev_data.width(); ++j) {
+      concat_data_[cur_data_blob_idx+j] = prev_data[j];
+    }
+    cur_data_blob_idx += prev_data.width();
   }
+  assert(cur_data_blob_idx == Nin_);
+  next_layer_data.write(concat_data_);
 }
 
 /*
@@ -9,7 +9,7 @@ using namespace std;
 
 ConvLayerCtrl::ConvLayerCtrl(sc_module_name module_name, int Kh, int Kw, int h,
     int w, int Nin, int Nout, int Pin, int Pout, int Pk, int Pad_h, int Pad_w,
-    int Stride_h, int Stride_w, int extra_pipeline_stage)
+    int Stride_h, int Stride_w, int extra_pipeline_stage, int Pw)
   : sc_module(module_name) {
   // assign the parameters to the instance variables
   Kh_ = Kh;
@@ -26,14 +26,41 @@ ConvLayerCtrl::ConvLayerCtrl(sc_module_name module_name, int Kh, int Kw, int h,
   Stride_h_ = Stride_h;
   Stride_w_ = Stride_w;
   extra_pipeline_stage_ = extra_pipeline_stage;
+  Pw_ = Pw;
+  pixels_ = (Pw > 1) ? Pw*Stride_w : 1;
+  pointwise_ = IsPointwise(Kh, Kw, Pad_h, Pad_w);
+  num_lanes_ = 1;
+  // start from the first pixel unless restored from the checkpoint
+  feat_pixel_counter_ = reset_feat_pixel_counter_ = 0;
+  waiting_input_ = false;
+
+  // schedule all the (input, output) tiles
+  const int tiled_in = static_cast<int>(ceil(static_cast<double>(Nin_)/Pin_));
+  const int tiled_out = static_cast<int>(ceil(static_cast<double>(Nout_)/
+        Pout_));
+  for (int i = 0; i < tiled_in; ++i) {
+    tile_row_ptr_.push_back(i*tiled_out);
+    for (int o = 0; o < tiled_out; ++o) {
+      tile_col_idx_.push_back(o);
+    }
+  }
+  tile_row_ptr_.push_back(tiled_in*tiled_out);
 
   // allocate the ports
   mult_array_in_valid = new sc_out<bool> [Pout_*Pin_*Pk_];
   add_array_in_valid = new sc_out<bool> [Pout_];
 
   // synchronous to clock & reset
-  SC_CTHREAD(ConvLayerCtrlProc, clock.pos());
-  reset_signal_is(reset, true);
+  if (pointwise_) {
+    SC_CTHREAD(PointwiseCtrlProc, clock.pos());
+    reset_signal_is(reset, true);
+  } else if (Pw_ > 1) {
+    SC_CTHREAD(MultiPixelCtrlProc, clock.pos());
+    reset_signal_is(reset, true);
+  } else {
+    SC_CTHREAD(ConvLayerCtrlProc, clock.pos());
+    reset_signal_is(reset, true);
+  }
 
   SC_METHOD(MultArrayCtrlProc);
   sensitive << clock.pos() << reset;
@@ -53,6 +80,40 @@ ConvLayerCtrl::~ConvLayerCtrl() {
   delete [] add_array_in_valid;
 }
 
+/*
+ * Implementation notes: SaveState
+ * --------------------------------
+ * The state is only saved when the controller waits for the input pixel, so
+ * it is the feature map counter: the pipeline stages are drained & the output
+ * register is cleared after the last pixel sent. On reset, the restored
+ * controller goes on to wait for the next input pixel.
+ */
+void ConvLayerCtrl::SaveState(Checkpoint* checkpoint) const {
+  checkpoint->Write(name(), feat_pixel_counter_);
+}
+
+void ConvLayerCtrl::RestoreState(Checkpoint* checkpoint) {
+  checkpoint->Read(name(), &reset_feat_pixel_counter_);
+  const int feat_pixels = (h_+2*Pad_h_) * (w_+2*Pad_w_);
+  if (reset_feat_pixel_counter_ < 0 ||
+      reset_feat_pixel_counter_ > feat_pixels) {
+    cerr << "[ERROR]: checkpoint of " << name() << " does not match the "
+      "feature map size" << endl;
+    exit(1);
+  }
+}
+
+void ConvLayerCtrl::SetTileSchedule(const vector<int>& tile_row_ptr,
+    const vector<int>& tile_col_idx) {
+  if (tile_row_ptr.size() != tile_row_ptr_.size()) {
+    cerr << name() << ": unexpected no. of input tiles "
+      << tile_row_ptr.size()-1 << endl;
+    exit(1);
+  }
+  tile_row_ptr_ = tile_row_ptr;
+  tile_col_idx_ = tile_col_idx;
+}
+
 void ConvLayerCtrl::LineBufferValid() {
   if (line_buffer_zero_in) {
     line_buffer_valid.write(1);
@@ -63,12 +124,13 @@ void ConvLayerCtrl::LineBufferValid() {
   }
 }
 
-void ConvLayerCtrl::ConvLayerCtrlProc() {
-  // reset behavior
+void ConvLayerCtrl::ResetCtrl() {
   prev_layer_rdy.write(0);    // not ready for the reset
   next_layer_valid.write(0);  // invalid for the next layer (not compute yet)
   // invalid & disable for all the internal units
   line_buffer_zero_in.write(0);
+  line_buffer_pixel_num.write(1);
+  line_buffer_window_offset.write(0);
   line_buffer_mux_en.write(0);
   line_buffer_mux_select.write(0);
   weight_mem_rd_en.write(0);
@@ -80,140 +142,277 @@ void ConvLayerCtrl::ConvLayerCtrlProc() {
   feat_map_loc_ = make_pair(0, 0);
   // clear the output register
   demux_out_reg_clear.write(1);
+  out_lane_select.write(0);
+  num_lanes_ = 1;
+}
+
+bool ConvLayerCtrl::CompletesWindow(int counter) const {
+  // warm up the line buffer at first
+  if (counter < (w_+2*Pad_w_) * (Kh_-1) + Kw_-1) {
+    return false;
+  }
+  // go across the row of feature map
+  if (counter % (w_+2*Pad_w_) < Kw_ && counter % (w_+2*Pad_w_) > 0) {
+    return false;
+  }
+  // stride bypass: we use the row-major line buffer
+  // row index & column index in the feature map (1-indexed)
+  const int row_idx = 1 + (counter-1) % (w_+2*Pad_w_);
+  const int col_idx = 1 + (counter-1) / (w_+2*Pad_w_);
+  return (row_idx-Kw_) % Stride_w_ == 0 && (col_idx-Kh_) % Stride_h_ == 0;
+}
+
+void ConvLayerCtrl::ConvLayerCtrlProc() {
+  // reset behavior
+  ResetCtrl();
 
-  // calculate scheduling related parameters
-  // warm up cycles: start computation until the buffer is filled
-  const int warm_up_cycles = (w_+2*Pad_w_) * (Kh_-1) + Kw_-1;
   // total feature map pixels
   const int feat_pixels = (h_+2*Pad_h_) * (w_+2*Pad_w_);
   // counters
-  int feat_pixel_counter = 0;
+  feat_pixel_counter_ = reset_feat_pixel_counter_;
+  waiting_input_ = false;
 
   wait();
 
   while (true) {
-    // reset feat_pixel_counter
-    if (feat_pixel_counter == feat_pixels) {
-      feat_pixel_counter = 0;
+    // reset feat_pixel_counter_
+    if (feat_pixel_counter_ == feat_pixels) {
+      feat_pixel_counter_ = 0;
     }
 
-    if (feat_pixel_counter < Pad_h_*(w_+2*Pad_w_)) {
+    if (feat_pixel_counter_ < Pad_h_*(w_+2*Pad_w_)) {
       // padding leading zeros: first Pad_h full 0 rows
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
-    else if (feat_pixel_counter % (w_+2*Pad_w_) >= 0 &&
-        feat_pixel_counter % (w_+2*Pad_w_) < Pad_w_) {
+    else if (feat_pixel_counter_ % (w_+2*Pad_w_) >= 0 &&
+        feat_pixel_counter_ % (w_+2*Pad_w_) < Pad_w_) {
       // padding leading zeros: first Pad_w 0s
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
-    else if (feat_pixel_counter % (w_+2*Pad_w_) >= w_+Pad_w_) {
+    else if (feat_pixel_counter_ % (w_+2*Pad_w_) >= w_+Pad_w_) {
       // padding tailing zeros: last Pad_w 0s
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
-    else if (feat_pixel_counter >= (w_+2*Pad_w_)*(h_+Pad_h_) &&
-        feat_pixel_counter < feat_pixels) {
+    else if (feat_pixel_counter_ >= (w_+2*Pad_w_)*(h_+Pad_h_) &&
+        feat_pixel_counter_ < feat_pixels) {
       // padding tailing zeros: last Pad_h rows 0s
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
     else {
       // accept the data from previous layers
       prev_layer_rdy.write(1);  // indicate current layer is ready for receiving
+      waiting_input_ = true;
       do {
         wait();                 // handshake property, wait for valid
       } while (!prev_layer_valid.read());
+      waiting_input_ = false;
 
       // deassert the ready, indicate it is busy right now
       prev_layer_rdy.write(0);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
     }
 
-    // warm up the line buffer at first
-    if (feat_pixel_counter < warm_up_cycles) {
-      // do not enter the computation stage
+    // do not enter the computation stage until a window is completed
+    if (!CompletesWindow(feat_pixel_counter_)) {
       continue;
     }
 
-    // go across the row of feature map
-    if (feat_pixel_counter % (w_+2*Pad_w_) < Kw_ &&
-        feat_pixel_counter % (w_+2*Pad_w_) > 0) {
-      continue;
+    ComputeOutputPixel();
+  } // while (true)
+}
+
+/*
+ * Implementation notes: MultiPixelCtrlProc
+ * -----------------------------------------
+ * The zero paddings are still streamed in one at a time, while the pixels of
+ * each row are accepted in groups of up to Pw*Stride_w (the last group of the
+ * row may be shorter), so that a group completes at most Pw sliding windows,
+ * Stride_w pixels apart. The line buffer exposes them as the lanes from the
+ * newest window, which lies window_offset pixels before the end of the write.
+ */
+void ConvLayerCtrl::MultiPixelCtrlProc() {
+  // reset behavior
+  ResetCtrl();
+
+  const int padded_w = w_+2*Pad_w_;
+  // total feature map pixels
+  const int feat_pixels = (h_+2*Pad_h_) * padded_w;
+  feat_pixel_counter_ = reset_feat_pixel_counter_;
+  waiting_input_ = false;
+
+  wait();
+
+  while (true) {
+    // reset feat_pixel_counter_
+    if (feat_pixel_counter_ == feat_pixels) {
+      feat_pixel_counter_ = 0;
+    }
+    const int col = feat_pixel_counter_ % padded_w;
+    const bool padding = feat_pixel_counter_ < Pad_h_*padded_w ||
+      feat_pixel_counter_ >= padded_w*(h_+Pad_h_) || col < Pad_w_ ||
+      col >= w_+Pad_w_;
+    const int n = padding ? 1 : min(pixels_, w_+Pad_w_-col);
+
+    // windows completed by the write, from the newest one
+    int window_offset = 0;
+    num_lanes_ = 0;
+    for (int d = 0; d < n; ++d) {
+      if (CompletesWindow(feat_pixel_counter_+n-d)) {
+        if (num_lanes_ == 0) {
+          window_offset = d;
+        }
+        ++num_lanes_;
+      }
+    }
+    line_buffer_pixel_num.write(n);
+    line_buffer_window_offset.write(window_offset);
+
+    if (padding) {
+      line_buffer_zero_in.write(1);
+      wait();
+      line_buffer_zero_in.write(0);
+    } else {
+      // accept the group of pixels from the previous layer
+      prev_layer_rdy.write(1);
+      waiting_input_ = true;
+      do {
+        wait();
+      } while (!prev_layer_valid.read());
+      waiting_input_ = false;
+      prev_layer_rdy.write(0);
+    }
+    feat_pixel_counter_ += n;
+
+    if (num_lanes_ > 0) {
+      ComputeOutputPixel();
+    }
+  } // while (true)
+}
+
+/*
+ * Implementation notes: PointwiseCtrlProc
+ * ----------------------------------------
+ * The 1x1 kernel without padding needs neither the zero padding nor the
+ * warm-up of the line buffer: each accepted pixel is computed right away,
+ * unless it is skipped by the stride.
+ */
+void ConvLayerCtrl::PointwiseCtrlProc() {
+  // reset behavior
+  ResetCtrl();
+
+  // total feature map pixels
+  const int feat_pixels = h_ * w_;
+  feat_pixel_counter_ = reset_feat_pixel_counter_;
+  waiting_input_ = false;
+
+  wait();
+
+  while (true) {
+    // reset feat_pixel_counter_
+    if (feat_pixel_counter_ == feat_pixels) {
+      feat_pixel_counter_ = 0;
     }
+    const int row_idx = feat_pixel_counter_ / w_;
+    const int col_idx = feat_pixel_counter_ % w_;
+
+    // accept the data from previous layers, which is loaded into the PixelMux
+    // in the handshake cycle
+    prev_layer_rdy.write(1);
+    waiting_input_ = true;
+    do {
+      wait();
+    } while (!prev_layer_valid.read());
+    waiting_input_ = false;
+    prev_layer_rdy.write(0);
+    ++feat_pixel_counter_;
 
-    // stride bypass: we use the row-major line buffer
-    // row index & column index in the feature map (1-indexed)
-    const int row_idx = 1 + (feat_pixel_counter-1) % (w_+2*Pad_w_);
-    const int col_idx = 1 + (feat_pixel_counter-1) / (w_+2*Pad_w_);
-    if ((row_idx-Kw_) % Stride_w_ != 0 || (col_idx-Kh_) % Stride_h_ != 0) {
+    // stride bypass
+    if (row_idx % Stride_h_ != 0 || col_idx % Stride_w_ != 0) {
       continue;
     }
 
-    // real computation phase
-    // the scheduling first iterates over the output feature map, then over the
-    // input feature map. It can reduce the memory access of line buffer
-    pipeline_flags_[0] = true;
-    // start accumulating the partial results in the output register
-    demux_out_reg_clear.write(0);
-    for (int i = 0; i < ceil(static_cast<double>(Nin_)/Pin_); ++i) {
-      for (int o = 0; o < ceil(static_cast<double>(Nout_)/Pout_); ++o) {
-        // unroll the kernel dimension as well
-        for (int k = 0; k < ceil(static_cast<double>(Kh_*Kw_)/Pk_); ++k) {
-          // activate the line buffer mux
-          if (o == 0 && k == 0) {
-            line_buffer_mux_en.write(1);
-            line_buffer_mux_select.write(i);
-          } else {
-            // do not require to activate the line buffer mux for the remaining
-            // cycle, save part of the mux power
-            line_buffer_mux_en.write(0);
-          }
-          // activate the weight memory access
-          weight_mem_rd_en.write(1);
-          weight_mem_rd_addr.write(static_cast<int>(k +
-                o*ceil(static_cast<double>(Kh_*Kw_)/Pk_) +
-                i*ceil(static_cast<double>(Nout_)/Pout_)*
-                ceil(static_cast<double>(Kh_*Kw_)/Pk_)));
-          // first, second: start idx of input feature map & output feature map
-          feat_map_loc_ = make_pair(i*Pin_, o*Pout_);
-          // kernel location in the total kernel dimension
-          kernel_loc_ = k*Pk_;
-          wait();
+    ComputeOutputPixel();
+  } // while (true)
+}
+
+/*
+ * Implementation notes: ComputeOutputPixel
+ * -----------------------------------------
+ * The scheduling first iterates over the output feature map, then over the
+ * input feature map. It can reduce the memory access of line buffer. The tiles
+ * of all-zero weights are skipped (if any). The output pixel is sent after the
+ * pipeline is drained. The lanes share the schedule, and their output pixels
+ * are sent from the oldest one (the last lane).
+ */
+void ConvLayerCtrl::ComputeOutputPixel() {
+  pipeline_flags_[0] = true;
+  // start accumulating the partial results in the output register
+  demux_out_reg_clear.write(0);
+  const int tiled_kernel = static_cast<int>(ceil(static_cast<double>(
+          Kh_*Kw_)/Pk_));
+  const int tiled_in = tile_row_ptr_.size() - 1;
+  for (int i = 0; i < tiled_in; ++i) {
+    for (int p = tile_row_ptr_[i]; p < tile_row_ptr_[i+1]; ++p) {
+      const int o = tile_col_idx_[p];
+      // unroll the kernel dimension as well
+      for (int k = 0; k < tiled_kernel; ++k) {
+        // activate the line buffer mux (the pointwise PixelMux loads the
+        // first input tile with the accepted pixel)
+        if (p == tile_row_ptr_[i] && k == 0 && !(pointwise_ && i == 0)) {
+          line_buffer_mux_en.write(1);
+          line_buffer_mux_select.write(i);
+        } else {
+          // do not require to activate the line buffer mux for the remaining
+          // cycle, save part of the mux power
+          line_buffer_mux_en.write(0);
         }
+        // activate the weight memory access
+        weight_mem_rd_en.write(1);
+        weight_mem_rd_addr.write(p*tiled_kernel + k);
+        // first, second: start idx of input feature map & output feature map
+        feat_map_loc_ = make_pair(i*Pin_, o*Pout_);
+        // kernel location in the total kernel dimension
+        kernel_loc_ = k*Pk_;
+        wait();
       }
     }
-    // deassert all the arithmetic stages
-    pipeline_flags_[0] = false;
-    line_buffer_mux_en.write(0);
-    line_buffer_mux_select.write(0);
-    weight_mem_rd_en.write(0);
-    weight_mem_rd_addr.write(0);
-
-    int drain_pipeline_ = 0;
-    while ((++drain_pipeline_) < (PIPELINE_STAGE+extra_pipeline_stage_)) {
-      wait();
-    }
+  }
+  // deassert all the arithmetic stages
+  pipeline_flags_[0] = false;
+  line_buffer_mux_en.write(0);
+  line_buffer_mux_select.write(0);
+  weight_mem_rd_en.write(0);
+  weight_mem_rd_addr.write(0);
 
-    // handshake protocol for next stage is ready to receive data
+  int drain_pipeline_ = 0;
+  while ((++drain_pipeline_) < (PIPELINE_STAGE+extra_pipeline_stage_)) {
+    wait();
+  }
+
+  // handshake protocol for next stage is ready to receive data
+  for (int lane = num_lanes_-1; lane >= 0; --lane) {
+    out_lane_select.write(lane);
     next_layer_valid.write(1);
     do {
       wait();
     } while (!next_layer_rdy.read());
     next_layer_valid.write(0);
+  }
 
-    // clear the output register after successful sending out 1 pixel
-    demux_out_reg_clear.write(1);
-  } // while (true)
+  // clear the output register after successful sending out 1 pixel
+  demux_out_reg_clear.write(1);
 }
 
 void ConvLayerCtrl::MultArrayCtrlProc() {
@@ -8,38 +8,50 @@
 using namespace std;
 using namespace config;
 
+// module name of the lane: the lane index is appended if Pw > 1
+static void LaneModuleName(char* name, const char* module, int lane, int Pw) {
+  if (Pw > 1) {
+    sprintf(name, "%s_%d", module, lane);
+  } else {
+    sprintf(name, "%s", module);
+  }
+}
+
 /*
  * Implementation notes: Constructor
  * ----------------------------------
  * The constructor mainly initializes all the required modules in the
  * convolution layer Processing Element, and makes the connections of each
- * module.
+ * module. The interconnections of the lanes are allocated back to back, e.g.
+ * the output registers of lane k are out_reg_data_[k*Nout:(k+1)*Nout].
  */
 ConvLayerPe::ConvLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
     int w, int Nin, int Nout, int Pin, int Pout, int Pk, int Pad_h, int Pad_w,
     int Stride_h, int Stride_w, ConfigParameter_MemoryType memory_type,
-    int bit_width, int tech_node, double clk_freq)
+    int bit_width, int tech_node, double clk_freq, bool zero_skipping, int Pw)
   : sc_module(module_name), Nin_(Nin), Nout_(Nout), Pout_(Pout), Pin_(Pin),
-  Pk_(Pk) {
-  // allocate the ports and interconnections
-  prev_layer_data = new sc_in<Payload> [Nin];
-  next_layer_data = new sc_out<Payload> [Nout];
-  line_buffer_in_data_ = new sc_signal<Payload> [Nin];
-  line_buffer_out_data_ = new sc_signal<Payload> [Nin*Kh*Kw];
-  line_buffer_mux_out_data_ = new sc_signal<Payload> [Pin*Kh*Kw];
+  Pk_(Pk), Pw_(Pw), zero_skipping_(zero_skipping), next_data_(Nout),
+  zero_data_(Nin*((Pw > 1) ? Pw*Stride_w : 1)) {
+  pointwise_ = ConvLayerCtrl::IsPointwise(Kh, Kw, Pad_h, Pad_w);
+  // allocate the interconnections (of the line buffer unless pointwise)
+  line_buffer_in_data_ = pointwise_ ? NULL :
+    new PayloadBusSignal(zero_data_.width());
+  line_buffer_out_data_ = pointwise_ ? NULL :
+    new sc_signal<Payload> [Pw*Nin*Kh*Kw];
+  line_buffer_mux_out_data_ = new sc_signal<Payload> [Pw*Pin*Kh*Kw];
   weight_mem_rd_data_ = new sc_signal<Payload> [Pout*Pin*Pk];
   mult_array_in_valid_ = new sc_signal<bool> [Pout*Pin*Pk];
-  mult_array_out_data_ = new sc_signal<Payload> [Pout*Pin*Pk];
+  mult_array_out_data_ = new sc_signal<Payload> [Pw*Pout*Pin*Pk];
   add_array_in_valid_ = new sc_signal<bool> [Pout];
-  add_array_reg_in_data_ = new sc_signal<Payload> [Pout];
-  add_array_out_data_ = new sc_signal<Payload> [Pout];
-  out_reg_data_ = new sc_signal<Payload> [Nout];
+  add_array_reg_in_data_ = new sc_signal<Payload> [Pw*Pout];
+  add_array_out_data_ = new sc_signal<Payload> [Pw*Pout];
+  out_reg_data_ = new sc_signal<Payload> [Pw*Nout];
 
   char name[100];
   // initialize the FSM controller
   sprintf(name, "%s", "controller");
   conv_layer_ctrl_ = new ConvLayerCtrl(name, Kh, Kw, h, w, Nin, Nout, Pin,
-      Pout, Pk, Pad_h, Pad_w, Stride_h, Stride_w);
+      Pout, Pk, Pad_h, Pad_w, Stride_h, Stride_w, 0, Pw);
   conv_layer_ctrl_->clock(clock);
   conv_layer_ctrl_->reset(reset);
   conv_layer_ctrl_->prev_layer_valid(prev_layer_valid);
@@ -48,6 +60,8 @@ ConvLayerPe::ConvLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
   conv_layer_ctrl_->next_layer_valid(next_layer_valid);
   conv_layer_ctrl_->line_buffer_valid(line_buffer_valid_);
   conv_layer_ctrl_->line_buffer_zero_in(line_buffer_zero_in_);
+  conv_layer_ctrl_->line_buffer_pixel_num(line_buffer_pixel_num_);
+  conv_layer_ctrl_->line_buffer_window_offset(line_buffer_window_offset_);
   conv_layer_ctrl_->line_buffer_mux_en(line_buffer_mux_en_);
   conv_layer_ctrl_->line_buffer_mux_select(line_buffer_mux_select_);
   conv_layer_ctrl_->weight_mem_rd_en(weight_mem_rd_en_);
@@ -67,36 +81,60 @@ ConvLayerPe::ConvLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
   conv_layer_ctrl_->demux_out_reg_clear(demux_out_reg_clear_);
   conv_layer_ctrl_->demux_out_reg_enable(demux_out_reg_enable_);
   conv_layer_ctrl_->demux_select(demux_select_);
+  conv_layer_ctrl_->out_lane_select(out_lane_select_);
 
-  // initialize the line buffer arrays
-  line_buffer_array_ = new LineBufferArray("line_buffer_array", Kh, Kw,
-      h+2*Pad_h, w+2*Pad_w, Nin, bit_width, tech_node, clk_freq);
-  line_buffer_array_->clock(clock);
-  line_buffer_array_->reset(reset);
-  line_buffer_array_->input_data_valid(line_buffer_valid_);
-  for (int i = 0; i < Nin; ++i) {
-    line_buffer_array_->input_data[i](line_buffer_in_data_[i]);
-  }
-  for (int i = 0; i < Nin*Kh*Kw; ++i) {
-    line_buffer_array_->output_data[i](line_buffer_out_data_[i]);
-  }
+  if (pointwise_) {
+    // initialize the pixel mux in place of the line buffer & its mux
+    line_buffer_array_ = NULL;
+    sprintf(name, "%s", "pixel_mux");
+    pixel_mux_ = new PixelMux(name, Nin, Pin, bit_width, tech_node, clk_freq);
+    pixel_mux_->clock(clock);
+    pixel_mux_->reset(reset);
+    pixel_mux_->pixel_load(line_buffer_valid_);
+    pixel_mux_->pixel_data(prev_layer_data);
+    pixel_mux_->mux_en(line_buffer_mux_en_);
+    pixel_mux_->mux_select(line_buffer_mux_select_);
+    for (int i = 0; i < Pin; ++i) {
+      pixel_mux_->mux_data_out[i](line_buffer_mux_out_data_[i]);
+    }
+  } else {
+    pixel_mux_ = NULL;
+    // initialize the line buffer arrays
+    line_buffer_array_ = new LineBufferArray("line_buffer_array", Kh, Kw,
+        h+2*Pad_h, w+2*Pad_w, Nin, bit_width, tech_node, clk_freq, Pw,
+        Stride_w);
+    line_buffer_array_->clock(clock);
+    line_buffer_array_->reset(reset);
+    line_buffer_array_->input_data_valid(line_buffer_valid_);
+    line_buffer_array_->input_data(*line_buffer_in_data_);
+    line_buffer_array_->input_pixel_num(line_buffer_pixel_num_);
+    line_buffer_array_->output_window_offset(line_buffer_window_offset_);
+    for (int i = 0; i < Pw*Nin*Kh*Kw; ++i) {
+      line_buffer_array_->output_data[i](line_buffer_out_data_[i]);
+    }
 
-  // initialize line buffer mux
-  sprintf(name, "%s", "line_buffer_mux");
-  line_buffer_mux_ = new LineBufferMux(name, Kh, Kw, Nin, Pin, bit_width,
-      tech_node, clk_freq);
-  line_buffer_mux_->clock(clock);
-  line_buffer_mux_->reset(reset);
-  line_buffer_mux_->mux_en(line_buffer_mux_en_);
-  for (int i = 0; i < Nin*Kh*Kw; ++i) {
-    line_buffer_mux_->line_buffer_data[i](line_buffer_out_data_[i]);
-  }
-  line_buffer_mux_->mux_select(line_buffer_mux_select_);
-  for (int i = 0; i < Pin*Kh*Kw; ++i) {
-    line_buffer_mux_->mux_data_out[i](line_buffer_mux_out_data_[i]);
+    // initialize line buffer mux of each lane
+    for (int k = 0; k < Pw; ++k) {
+      LaneModuleName(name, "line_buffer_mux", k, Pw);
+      LineBufferMux* line_buffer_mux = new LineBufferMux(name, Kh, Kw, Nin, Pin,
+          bit_width, tech_node, clk_freq);
+      line_buffer_mux->clock(clock);
+      line_buffer_mux->reset(reset);
+      line_buffer_mux->mux_en(line_buffer_mux_en_);
+      for (int i = 0; i < Nin*Kh*Kw; ++i) {
+        line_buffer_mux->line_buffer_data[i](
+            line_buffer_out_data_[k*Nin*Kh*Kw+i]);
+      }
+      line_buffer_mux->mux_select(line_buffer_mux_select_);
+      for (int i = 0; i < Pin*Kh*Kw; ++i) {
+        line_buffer_mux->mux_data_out[i](
+            line_buffer_mux_out_data_[k*Pin*Kh*Kw+i]);
+      }
+      line_buffer_mux_.push_back(line_buffer_mux);
+    }
   }
 
-  // initialize weight memory
+  // initialize weight memory (shared by the lanes)
   sprintf(name, "%s", "weight_mem");
   weight_mem_ = new WeightMem(name, Kh, Kw, Pin, Pout, Pk, Nin, Nout,
       memory_type, bit_width, tech_node, clk_freq);
@@ -108,110 +146,123 @@ ConvLayerPe::ConvLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
     weight_mem_->mem_rd_data[i](weight_mem_rd_data_[i]);
   }
 
-  // initialize multiplier array
-  sprintf(name, "%s", "mult_array");
-  mult_array_ = new MultArray(name, Kh, Kw, Pin, Pout, Pk, bit_width, tech_node,
-      clk_freq);
-  mult_array_->clock(clock);
-  mult_array_->reset(reset);
-  mult_array_->mult_array_en(mult_array_en_);
-  mult_array_->mult_array_kernel_idx(mult_array_kernel_idx_);
-  for (int i = 0; i < Pout*Pin*Pk; ++i) {
-    mult_array_->mult_array_in_valid[i](mult_array_in_valid_[i]);
-  }
-  for (int i = 0; i < Pin*Kh*Kw; ++i) {
-    mult_array_->mult_array_act_in_data[i](line_buffer_mux_out_data_[i]);
-  }
-  for (int i = 0; i < Pout*Pin*Pk; ++i) {
-    mult_array_->mult_array_weight_in_data[i](weight_mem_rd_data_[i]);
-  }
-  for (int i = 0; i < Pout*Pin*Pk; ++i) {
-    mult_array_->mult_array_output_data[i](mult_array_out_data_[i]);
-  }
+  for (int k = 0; k < Pw; ++k) {
+    // initialize multiplier array
+    LaneModuleName(name, "mult_array", k, Pw);
+    MultArray* mult_array = new MultArray(name, Kh, Kw, Pin, Pout, Pk,
+        bit_width, tech_node, clk_freq, zero_skipping);
+    mult_array->clock(clock);
+    mult_array->reset(reset);
+    mult_array->mult_array_en(mult_array_en_);
+    mult_array->mult_array_kernel_idx(mult_array_kernel_idx_);
+    for (int i = 0; i < Pout*Pin*Pk; ++i) {
+      mult_array->mult_array_in_valid[i](mult_array_in_valid_[i]);
+    }
+    for (int i = 0; i < Pin*Kh*Kw; ++i) {
+      mult_array->mult_array_act_in_data[i](
+          line_buffer_mux_out_data_[k*Pin*Kh*Kw+i]);
+    }
+    for (int i = 0; i < Pout*Pin*Pk; ++i) {
+      mult_array->mult_array_weight_in_data[i](weight_mem_rd_data_[i]);
+    }
+    for (int i = 0; i < Pout*Pin*Pk; ++i) {
+      mult_array->mult_array_output_data[i](
+          mult_array_out_data_[k*Pout*Pin*Pk+i]);
+    }
+    mult_array_.push_back(mult_array);
 
-  // initialize the add array
-  sprintf(name, "%s", "add_array");
-  add_array_ = new AddArray(name, Kh, Kw, Pin, Pout, Pk, bit_width, tech_node,
-      clk_freq);
-  add_array_->clock(clock);
-  add_array_->reset(reset);
-  add_array_->add_array_enable(add_array_en_);
-  for (int i = 0; i < Pout; ++i) {
-    add_array_->add_array_in_valid[i](add_array_in_valid_[i]);
-  }
-  add_array_->add_array_accumulate_kernel(add_array_accumulate_kernel_);
-  add_array_->add_array_accumulate_out_reg(add_array_accumulate_out_reg_);
-  for (int i = 0; i < Pout*Pin*Pk; ++i) {
-    add_array_->add_array_mult_in_data[i](mult_array_out_data_[i]);
-  }
-  for (int i = 0; i < Pout; ++i) {
-    add_array_->add_array_reg_in_data[i](add_array_reg_in_data_[i]);
-  }
-  for (int i = 0; i < Pout; ++i) {
-    add_array_->add_array_out_data[i](add_array_out_data_[i]);
-  }
+    // initialize the add array
+    LaneModuleName(name, "add_array", k, Pw);
+    AddArray* add_array = new AddArray(name, Kh, Kw, Pin, Pout, Pk, bit_width,
+        tech_node, clk_freq);
+    add_array->clock(clock);
+    add_array->reset(reset);
+    add_array->add_array_enable(add_array_en_);
+    for (int i = 0; i < Pout; ++i) {
+      add_array->add_array_in_valid[i](add_array_in_valid_[i]);
+    }
+    add_array->add_array_accumulate_kernel(add_array_accumulate_kernel_);
+    add_array->add_array_accumulate_out_reg(add_array_accumulate_out_reg_);
+    for (int i = 0; i < Pout*Pin*Pk; ++i) {
+      add_array->add_array_mult_in_data[i](
+          mult_array_out_data_[k*Pout*Pin*Pk+i]);
+    }
+    for (int i = 0; i < Pout; ++i) {
+      add_array->add_array_reg_in_data[i](add_array_reg_in_data_[k*Pout+i]);
+    }
+    for (int i = 0; i < Pout; ++i) {
+      add_array->add_array_out_data[i](add_array_out_data_[k*Pout+i]);
+    }
+    add_array_.push_back(add_array);
 
-  // initialize the demux output register
-  sprintf(name, "%s", "demux_out_reg");
-  demux_out_reg_ = new DemuxOutReg(name, Nout, Pout, bit_width, tech_node,
-      clk_freq);
-  demux_out_reg_->clock(clock);
-  demux_out_reg_->reset(reset);
-  demux_out_reg_->demux_out_reg_clear(demux_out_reg_clear_);
-  demux_out_reg_->demux_out_reg_enable(demux_out_reg_enable_);
-  demux_out_reg_->demux_select(demux_select_);
-  for (int i = 0; i < Pout; ++i) {
-    demux_out_reg_->in_data[i](add_array_out_data_[i]);
-  }
-  for (int i = 0; i < Nout; ++i) {
-    demux_out_reg_->out_data[i](out_reg_data_[i]);
+    // initialize the demux output register
+    LaneModuleName(name, "demux_out_reg", k, Pw);
+    DemuxOutReg* demux_out_reg = new DemuxOutReg(name, Nout, Pout, bit_width,
+        tech_node, clk_freq);
+    demux_out_reg->clock(clock);
+    demux_out_reg->reset(reset);
+    demux_out_reg->demux_out_reg_clear(demux_out_reg_clear_);
+    demux_out_reg->demux_out_reg_enable(demux_out_reg_enable_);
+    demux_out_reg->demux_select(demux_select_);
+    for (int i = 0; i < Pout; ++i) {
+      demux_out_reg->in_data[i](add_array_out_data_[k*Pout+i]);
+    }
+    for (int i = 0; i < Nout; ++i) {
+      demux_out_reg->out_data[i](out_reg_data_[k*Nout+i]);
+    }
+    demux_out_reg_.push_back(demux_out_reg);
   }
 
-  // connect output register to the interface
+  // connect output register of the selected lane to the interface
   SC_METHOD(NextLayerDataConnect);
-  for (int i = 0; i < Nout; ++i) {
+  sensitive << out_lane_select_;
+  for (int i = 0; i < Pw*Nout; ++i) {
     sensitive << out_reg_data_[i];
   }
 
-  // additional process dealing with mux input
-  SC_METHOD(LineBufferInMux);
-  sensitive << line_buffer_zero_in_;
-  for (int i = 0; i < Nin; ++i) {
-    sensitive << prev_layer_data[i];
+  // additional process dealing with mux input (no zero padding of the
+  // pointwise layer)
+  if (!pointwise_) {
+    SC_METHOD(LineBufferInMux);
+    sensitive << line_buffer_zero_in_ << prev_layer_data;
   }
 
   // additional process dealing with partial output results from the output
   // registers
   SC_METHOD(AddArrayRegInMux);
   sensitive << add_array_out_reg_select_;
-  for (int i = 0; i < Nout; ++i) {
+  for (int i = 0; i < Pw*Nout; ++i) {
     sensitive << out_reg_data_[i];
   }
 }
 
 void ConvLayerPe::NextLayerDataConnect() {
+  const sc_signal<Payload>* out_reg_data =
+    &out_reg_data_[out_lane_select_.read()*Nout_];
   for (int i = 0; i < Nout_; ++i) {
-    next_layer_data[i].write(out_reg_data_[i]);
+    next_data_[i] = out_reg_data[i].read();
   }
+  next_layer_data.write(next_data_);
 }
 
 void ConvLayerPe::LineBufferInMux() {
-  for (int i = 0; i < Nin_; ++i) {
-    if (line_buffer_zero_in_.read()) {
-      line_buffer_in_data_[i] = Payload(0);
-    } else {
-      line_buffer_in_data_[i] = prev_layer_data[i];
-    }
+  if (line_buffer_zero_in_.read()) {
+    line_buffer_in_data_->write(zero_data_);
+  } else {
+    line_buffer_in_data_->write(prev_layer_data.read());
   }
 }
 
 void ConvLayerPe::AddArrayRegInMux() {
-  for (int i = 0; i < Pout_; ++i) {
-    const int output_feat_start_idx = add_array_out_reg_select_.read();
-    if (output_feat_start_idx+i < Nout_) {
-      add_array_reg_in_data_[i] = out_reg_data_[output_feat_start_idx+i];
-    } else {
-      add_array_reg_in_data_[i] = Payload(0);
+  const int output_feat_start_idx = add_array_out_reg_select_.read();
+  for (int k = 0; k < Pw_; ++k) {
+    for (int i = 0; i < Pout_; ++i) {
+      if (output_feat_start_idx+i < Nout_) {
+        add_array_reg_in_data_[k*Pout_+i] =
+          out_reg_data_[k*Nout_+output_feat_start_idx+i];
+      } else {
+        add_array_reg_in_data_[k*Pout_+i] = Payload(0);
+      }
     }
   }
 }
@@ -222,9 +273,7 @@ void ConvLayerPe::AddArrayRegInMux() {
  * Free the dynamic allocated memory space associated with the ConvLayerPe.
  */
 ConvLayerPe::~ConvLayerPe() {
-  delete [] prev_layer_data;
-  delete [] next_layer_data;
-  delete [] line_buffer_in_data_;
+  delete line_buffer_in_data_;
   delete [] line_buffer_out_data_;
   delete [] line_buffer_mux_out_data_;
   delete [] weight_mem_rd_data_;
@@ -236,11 +285,31 @@ ConvLayerPe::~ConvLayerPe() {
 
   delete conv_layer_ctrl_;
   delete line_buffer_array_;
-  delete line_buffer_mux_;
+  delete pixel_mux_;
   delete weight_mem_;
-  delete mult_array_;
-  delete add_array_;
-  delete demux_out_reg_;
+  for (size_t k = 0; k < line_buffer_mux_.size(); ++k) {
+    delete line_buffer_mux_[k];
+  }
+  for (int k = 0; k < Pw_; ++k) {
+    delete mult_array_[k];
+    delete add_array_[k];
+    delete demux_out_reg_[k];
+  }
+}
+
+void ConvLayerPe::LoadWeights(const vector<int>& weights) {
+  weight_mem_->LoadWeights(weights, zero_skipping_);
+  conv_layer_ctrl_->SetTileSchedule(weight_mem_->tile_row_ptr(),
+      weight_mem_->tile_col_idx());
+}
+
+double ConvLayerPe::GatedMultRatio() const {
+  long int num_ops = 0, num_gated_ops = 0;
+  for (int k = 0; k < Pw_; ++k) {
+    num_ops += mult_array_[k]->num_ops();
+    num_gated_ops += mult_array_[k]->num_gated_ops();
+  }
+  return (num_ops == 0) ? 0. : static_cast<double>(num_gated_ops) / num_ops;
 }
 
 /*
@@ -252,18 +321,26 @@ ConvLayerPe::~ConvLayerPe() {
 double ConvLayerPe::Area() const {
   double total_area = 0.;
   // line buffer area: centralized implementation
-  // where the width is concatenation over all channels
-  total_area += line_buffer_array_->Area();
-  // line buffer mux
-  total_area += line_buffer_mux_->Area();
+  // where the width is concatenation over all channels, & the line buffer mux
+  // (the pixel mux replaces both in the pointwise layer)
+  if (pointwise_) {
+    total_area += pixel_mux_->Area();
+  } else {
+    total_area += line_buffer_array_->Area();
+  }
   // weight memory
   total_area += weight_mem_->Area();
-  // multiplier array
-  total_area += mult_array_->Area();
-  // adder array
-  total_area += add_array_->Area();
-  // demux reg
-  total_area += demux_out_reg_->Area();
+  for (int k = 0; k < Pw_; ++k) {
+    if (!pointwise_) {
+      total_area += line_buffer_mux_[k]->Area();
+    }
+    // multiplier array
+    total_area += mult_array_[k]->Area();
+    // adder array
+    total_area += add_array_[k]->Area();
+    // demux reg
+    total_area += demux_out_reg_[k]->Area();
+  }
 
   return total_area;
 }
@@ -271,24 +348,40 @@ double ConvLayerPe::Area() const {
 double ConvLayerPe::StaticPower() const {
   double total_power = 0.;
   // accumulate the static power of all components
-  total_power += line_buffer_array_->StaticPower();
-  total_power += line_buffer_mux_->StaticPower();
+  if (pointwise_) {
+    total_power += pixel_mux_->StaticPower();
+  } else {
+    total_power += line_buffer_array_->StaticPower();
+  }
   total_power += weight_mem_->StaticPower();
-  total_power += mult_array_->StaticPower();
-  total_power += add_array_->StaticPower();
-  total_power += demux_out_reg_->StaticPower();
+  for (int k = 0; k < Pw_; ++k) {
+    if (!pointwise_) {
+      total_power += line_buffer_mux_[k]->StaticPower();
+    }
+    total_power += mult_array_[k]->StaticPower();
+    total_power += add_array_[k]->StaticPower();
+    total_power += demux_out_reg_[k]->StaticPower();
+  }
   return total_power;
 }
 
 double ConvLayerPe::DynamicPower() const {
   double total_power = 0.;
   // accumulate the dynamic power of all components
-  total_power += line_buffer_array_->DynamicPower();
-  total_power += line_buffer_mux_->DynamicPower();
+  if (pointwise_) {
+    total_power += pixel_mux_->DynamicPower();
+  } else {
+    total_power += line_buffer_array_->DynamicPower();
+  }
   total_power += weight_mem_->DynamicPower();
-  total_power += mult_array_->DynamicPower();
-  total_power += add_array_->DynamicPower();
-  total_power += demux_out_reg_->DynamicPower();
+  for (int k = 0; k < Pw_; ++k) {
+    if (!pointwise_) {
+      total_power += line_buffer_mux_[k]->DynamicPower();
+    }
+    total_power += mult_array_[k]->DynamicPower();
+    total_power += add_array_[k]->DynamicPower();
+    total_power += demux_out_reg_[k]->DynamicPower();
+  }
   return total_power;
 }
 
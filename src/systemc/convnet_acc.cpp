@@ -8,6 +8,9 @@
 #include "header/caffe/layers/conv_layer.hpp"
 #include "header/caffe/layers/inner_product_layer.hpp"
 #include "header/caffe/layers/pooling_layer.hpp"
+#include "header/systemc/parallelism_allocator.hpp"
+#include "header/layer_precision.hpp"
+#include "header/logger.hpp"
 
 using namespace std;
 using namespace config;
@@ -23,28 +26,44 @@ ConvNetAcc::ConvNetAcc(sc_module_name module_name, const Net& net,
   clk_freq_ = config_param.clk_freq();
   memory_type_ = config_param.memory_type();
   kernel_unrolling_flag_ = config_param.kernel_unrolling_flag();
+  zero_skipping_ = config_param.zero_skipping();
+  // bit width of each processing element & channel buffer
+  layer_precision_ = new LayerPrecision(net, config_param);
+#ifdef PAYLOAD_BIT_WIDTH
+  // the fixed-point data path is compiled with the (widest) bit width
+  if (layer_precision_->MaxBitWidth() != PAYLOAD_BIT_WIDTH) {
+    cerr << "bit width " << layer_precision_->MaxBitWidth() << " mismatches "
+      << "the compiled payload bit width " << PAYLOAD_BIT_WIDTH << endl;
+    exit(1);
+  }
+#endif
 
   // initialize the parallelism
-  InitParallelism(net, config_param.pixel_inference_rate());
+  if (config_param.multiplier_budget() > 0 || config_param.area_budget() > 0) {
+    InitParallelismUnderBudget(net, config_param);
+  } else {
+    InitParallelism(net, config_param);
+  }
 
-  // initialize the network processing elements
+  // initialize the network processing elements, where the weights are loaded
+  // from the caffemodel (if any)
+  weight_loader_ = config_param.weight_file().empty() ? NULL :
+    new WeightLoader(config_param.weight_file());
   Init(net);
+  delete weight_loader_;
+  weight_loader_ = NULL;
+  delete layer_precision_;
+  layer_precision_ = NULL;
 
-  // Allocates & makes the input layer connections
-  input_layer_data = new sc_in<Payload> [Nin_];
+  // Makes the input layer connections
   SC_METHOD(InputLayerConnections);
-  sensitive << input_layer_valid << *layer_rdy_[input_blob_idx_];
-  for (int i = 0; i < Nin_; ++i) {
-    sensitive << input_layer_data[i];
-  }
+  sensitive << input_layer_valid << *layer_rdy_[input_blob_idx_]
+    << input_layer_data;
 
-  // Allocates & makes the output layer connections
-  output_layer_data = new sc_out<Payload> [Nout_];
+  // Makes the output layer connections
   SC_METHOD(OutputLayerConnections);
-  sensitive << output_layer_rdy << *layer_valid_[output_blob_idx_];
-  for (int i = 0; i < Nout_; ++i) {
-    sensitive << layer_data_[output_blob_idx_][i];
-  }
+  sensitive << output_layer_rdy << *layer_valid_[output_blob_idx_]
+    << *layer_data_[output_blob_idx_];
 
   //cout << "Nin: " << Nin_ << " Nout: " << Nout_ << endl;
 }
@@ -52,202 +71,97 @@ ConvNetAcc::ConvNetAcc(sc_module_name module_name, const Net& net,
 void ConvNetAcc::InputLayerConnections() {
   layer_valid_[input_blob_idx_]->write(input_layer_valid.read());
   input_layer_rdy.write(layer_rdy_[input_blob_idx_]->read());
-  for (int i = 0; i < Nin_; ++i) {
-    layer_data_[input_blob_idx_][i].write(input_layer_data[i].read());
-  }
+  layer_data_[input_blob_idx_]->write(input_layer_data.read());
 }
 
 void ConvNetAcc::OutputLayerConnections() {
   layer_rdy_[output_blob_idx_]->write(output_layer_rdy.read());
   output_layer_valid.write(layer_valid_[output_blob_idx_]->read());
-  for (int i = 0; i < Nout_; ++i) {
-    output_layer_data[i].write(layer_data_[output_blob_idx_][i].read());
-  }
+  output_layer_data.write(layer_data_[output_blob_idx_]->read());
 }
 
 /*
  * Implementation notes: InitParallelism
  * --------------------------------------
  * Determine the parallelism of each layer based on the specified
- * pixel_inference_rate.
+ * pixel_inference_rate. The calculation is delegated to the
+ * ParallelismAllocator, which is shared with the design space exploration.
  */
-void ConvNetAcc::InitParallelism(const Net& net, int pixel_inference_rate) {
-  int max_inference_rate = 0;
-  vector< pair<int, int> > inference_rate_array;
-  int layer_inference_rate = 0;
+void ConvNetAcc::InitParallelism(const Net& net,
+    const ConfigParameter& config_param) {
   // the actual pixel inference rate for the accelerator is
   // pixel_inference_rate = ceil(Nin/Pin) * ceil(Nout/Pout) + pipeline_stage
-  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
-    const Layer* layer = net.layers_[layer_id];
-    const string layer_name = layer->layer_param().name();
-    if (layer->layer_param().type() == "Input") {
-      // dimension: (N, C, H, W)
-      const int h = net.top_blobs_shape_ptr_[layer_id][0]->at(2);
-      const int w = net.top_blobs_shape_ptr_[layer_id][0]->at(3);
-      input_spatial_dim_ = h * w;
-      layer_inference_rate = input_spatial_dim_ * pixel_inference_rate;
-      cout << "layer_inference_rate: " << layer_inference_rate << endl;
-      continue;
-    } else if (layer->layer_param().type() == "Convolution") {
-      const int Nin = dynamic_cast<const ConvolutionLayer*>(layer)->num_input_;
-      const int Nout = dynamic_cast<const ConvolutionLayer*>(layer)->
-        num_output_;
-      const int Kh = dynamic_cast<const ConvolutionLayer*>(layer)->kh_;
-      const int Kw = dynamic_cast<const ConvolutionLayer*>(layer)->kw_;
-      const int h = net.top_blobs_shape_ptr_[layer_id][0]->at(2);
-      const int w = net.top_blobs_shape_ptr_[layer_id][0]->at(3);
-      parallelism_[layer_id] = CalculateParallelsim(Nin, Nout, Kh, Kw, h, w,
-          layer_inference_rate);
-      const int inference_rate = static_cast<int>(
-          (ceil(static_cast<double>(Nin)/parallelism_[layer_id].first.first) *
-           ceil(static_cast<double>(Nout)/parallelism_[layer_id].first.second) *
-           ceil(static_cast<double>(Kh*Kw)/parallelism_[layer_id].second) +
-           pipeline_stage_) * h * w);
-      if (max_inference_rate < inference_rate) {
-        max_inference_rate = inference_rate;
-      }
-      inference_rate_array.push_back(make_pair(layer_id, inference_rate));
-    } else if (layer->layer_param().type() == "InnerProduct") {
-      const int Nin = net.bottom_blobs_shape_ptr_[layer_id][0]->at(1);
-      const int Nout = dynamic_cast<const InnerProductLayer*>(layer)->
-        num_output_;
-      int Kh, Kw;
-      if (net.bottom_blobs_shape_ptr_[layer_id][0]->size() == 4) {
-        Kh = net.bottom_blobs_shape_ptr_[layer_id][0]->at(2);
-        Kw = net.bottom_blobs_shape_ptr_[layer_id][0]->at(3);
-      } else if (net.bottom_blobs_shape_ptr_[layer_id][0]->size() == 2) {
-        Kh = Kw = 1;
-      } else {
-        cerr << "unexpected bottom blob dimension for FC layer" << endl;
-        exit(1);
-      }
-      const int h = 1;
-      const int w = 1;
-      parallelism_[layer_id] = CalculateParallelsim(Nin, Nout, Kh, Kw, h, w,
-          layer_inference_rate);
-      const int inference_rate = static_cast<int>(
-          (ceil(static_cast<double>(Nin)/parallelism_[layer_id].first.first) *
-           ceil(static_cast<double>(Nout)/parallelism_[layer_id].first.second) *
-           ceil(static_cast<double>(Kh*Kw)/parallelism_[layer_id].second) +
-           pipeline_stage_) * h * w);
-      if (max_inference_rate < inference_rate) {
-        max_inference_rate = inference_rate;
-      }
-      inference_rate_array.push_back(make_pair(layer_id, inference_rate));
-    } else if (layer->layer_param().type() == "Pooling") {
-      const int Nin = dynamic_cast<const PoolingLayer*>(layer)->num_input_;
-      const int h = net.top_blobs_shape_ptr_[layer_id][0]->at(2);
-      const int w = net.top_blobs_shape_ptr_[layer_id][0]->at(3);
-      // no kernel unrolling for pooling layer
-      const int Kh = 0;
-      const int Kw = 0;
-      parallelism_[layer_id] = CalculateParallelsim(Nin, 0, Kh, Kw, h, w,
-          layer_inference_rate);
-      const int inference_rate = static_cast<int>((ceil(static_cast<double>(Nin)
-          / parallelism_[layer_id].first.first) + pipeline_stage_) * h * w);
-      if (max_inference_rate < inference_rate) {
-        max_inference_rate = inference_rate;
-      }
-      inference_rate_array.push_back(make_pair(layer_id, inference_rate));
-    } else {
-      // bypass the other types, there is no need to determine the parallelism
-      // for such layers
-      continue;
+  ParallelismAllocator allocator(net, config_param, pipeline_stage_);
+  allocator.AllocateByRate(config_param.pixel_inference_rate());
+  input_spatial_dim_ = allocator.input_spatial_dim();
+  output_spatial_dim_ = allocator.output_spatial_dim();
+  cout << "layer_inference_rate: " << input_spatial_dim_ *
+    config_param.pixel_inference_rate() << endl;
+
+  const map<int, ParallelismAllocator::LayerAllocation>& allocation =
+    allocator.allocation();
+  for (map<int, ParallelismAllocator::LayerAllocation>::const_iterator iter =
+      allocation.begin(); iter != allocation.end(); ++iter) {
+    parallelism_[iter->first] = make_pair(make_pair(iter->second.Pin,
+          iter->second.Pout), iter->second.Pk);
+    if (iter->second.Pw > 1) {
+      spatial_parallelism_[iter->first] = iter->second.Pw;
     }
-    cout << "- set " << layer_name << " Pin: "
-      << parallelism_[layer_id].first.first << " Pout: "
-      << parallelism_[layer_id].first.second << " Pk: "
-      << parallelism_[layer_id].second << endl;
+    cout << "- set " << net.layers_[iter->first]->layer_param().name()
+      << " Pin: " << iter->second.Pin << " Pout: " << iter->second.Pout
+      << " Pk: " << iter->second.Pk << " Pw: " << iter->second.Pw << endl;
   }
+  input_width_ = allocator.input_width();
+  input_pixels_ = allocator.InputPixels();
 
   cout << "################################" << endl;
   cout << "# Resulted layer inference rate " << endl;
   cout << "################################" << endl;
-  for (size_t i = 0; i < inference_rate_array.size(); ++i) {
-    const int layer_id = inference_rate_array[i].first;
-    const int inference_rate = inference_rate_array[i].second;
-    cout << "- " << net.layers_[layer_id]->layer_param().name() << " with rate "
-      << inference_rate << endl;
+  for (map<int, ParallelismAllocator::LayerAllocation>::const_iterator iter =
+      allocation.begin(); iter != allocation.end(); ++iter) {
+    cout << "- " << net.layers_[iter->first]->layer_param().name()
+      << " with rate " << iter->second.inference_rate << endl;
   }
-  cout << "Max layer inference rate: " << max_inference_rate << endl;
-  cout << "Press ENTER to continue";
-  cin.get();
+  cout << "Max layer inference rate: " << allocator.max_inference_rate()
+    << endl;
 }
 
-pair<pair<int, int>, int> ConvNetAcc::CalculateParallelsim(int Nin, int Nout,
-    int Kh, int Kw, int h, int w, int layer_inference_rate) const {
-  // regularize the layer_inference_rate
-  if (layer_inference_rate <= 0) {
-    layer_inference_rate = 1;
+/*
+ * Implementation notes: InitParallelismUnderBudget
+ * -------------------------------------------------
+ * Determine the parallelism of all layers jointly with the
+ * ParallelismAllocator, which minimizes the max layer inference rate under the
+ * multiplier or area budget.
+ */
+void ConvNetAcc::InitParallelismUnderBudget(const Net& net,
+    const ConfigParameter& config_param) {
+  if (config_param.multiplier_budget() > 0 && config_param.area_budget() > 0) {
+    cerr << "only one of multiplier_budget & area_budget can be set" << endl;
+    exit(1);
   }
-
-  if (Nout == 0) {
-    // POOL: pixel inference rate = Nin / Pin + pipeline_stage
-    double pixel_inference_rate = static_cast<double>(layer_inference_rate) /
-      (h * w) - pipeline_stage_;
-    if (pixel_inference_rate <= 0) {
-      pixel_inference_rate = 1;
-    }
-    int Pin = static_cast<int>(round(static_cast<double>(Nin) /
-        static_cast<double>(pixel_inference_rate)));
-    // regularize the parallelism
-    if (Pin <= 0) Pin = 1;
-    if (Pin > Nin) Pin = Nin;
-    return make_pair(make_pair(Pin, 0), 0);
+  ParallelismAllocator allocator(net, config_param, pipeline_stage_);
+  if (config_param.multiplier_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::MULTIPLIER,
+        config_param.multiplier_budget());
   } else {
-    // CONV or FC: inference rate = Nin * Nout / Pin / Pout + pipeline_stage
-    double pixel_inference_rate = static_cast<double>(layer_inference_rate) /
-      (h * w) - pipeline_stage_;
-    if (pixel_inference_rate <= 0) {
-      pixel_inference_rate = 1;
-    }
-    /*
-    double k = sqrt(1. / static_cast<double>(pixel_inference_rate));
-    int Pin = round(k * Nin);
-    int Pout = round(k * Nout);
-    // regularize the parallelism
-    if (Pin <= 0) Pin = 1;
-    if (Pin > Nin) Pin = Nin;
-    if (Pout <= 0) Pout = 1;
-    if (Pout > Nout) Pout = Nout;
-    return make_pair(Pin, Pout);*/
-    return CalculateParallelsimBruteForce(Nin, Nout, Kh, Kw,
-        pixel_inference_rate);
+    allocator.Allocate(ParallelismAllocator::AREA, config_param.area_budget());
   }
-}
-
-/*
- * Implementation notes: CalculateParallelsimBruteForce
- * -----------------------------------------------------
- * Search for the tuple (Pin, Pout) so that the expected rate is as close as the
- * target one. The expected rate is calculated as follows:
- *
- *  ceil(Nin/Pin) * ceil(Nout/Pout) = rate
- */
-pair<pair<int, int>, int> ConvNetAcc::CalculateParallelsimBruteForce(int Nin,
-    int Nout, int Kh, int Kw, double rate) const {
-  int Pin = 1, Pout = 1, Pk = 1;
-  double min = std::numeric_limits<double>::max();
-  for (int Pin_ = 1; Pin_ <= Nin; ++Pin_) {
-    for (int Pout_ = 1; Pout_ <= Nout; ++Pout_) {
-      for (int Pk_ = 1; Pk_ <= Kh*Kw; ++Pk_) {
-        if (kernel_unrolling_flag_ == false && Pk_ != Kh*Kw) {
-          // Pk = Kernel size if kernel unrolling option is disabled
-          continue;
-        }
-        double calculated_rate = ceil(static_cast<double>(Nin) / Pin_) *
-          ceil(static_cast<double>(Nout) / Pout_) *
-          ceil(static_cast<double>(Kh*Kw) / Pk_);
-        if (abs(calculated_rate - rate) < min) {
-          min = abs(calculated_rate - rate);
-          Pin = Pin_;
-          Pout = Pout_;
-          Pk = Pk_;
-        }
-      }
+  allocator.Summary();
+
+  input_spatial_dim_ = allocator.input_spatial_dim();
+  output_spatial_dim_ = allocator.output_spatial_dim();
+  const map<int, ParallelismAllocator::LayerAllocation>& allocation =
+    allocator.allocation();
+  for (map<int, ParallelismAllocator::LayerAllocation>::const_iterator iter =
+      allocation.begin(); iter != allocation.end(); ++iter) {
+    parallelism_[iter->first] = make_pair(make_pair(iter->second.Pin,
+          iter->second.Pout), iter->second.Pk);
+    if (iter->second.Pw > 1) {
+      spatial_parallelism_[iter->first] = iter->second.Pw;
     }
   }
-  return make_pair(make_pair(Pin, Pout), Pk);
+  input_width_ = allocator.input_width();
+  input_pixels_ = allocator.InputPixels();
 }
 
 /*
@@ -258,7 +172,7 @@ pair<pair<int, int>, int> ConvNetAcc::CalculateParallelsimBruteForce(int Nin,
 void ConvNetAcc::Init(const Net& net) {
   for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
     const Layer* layer = net.layers_[layer_id];
-    cout << "ConvNetAcc[" << layer_id << "] of type: "
+    LOG(CONVNET_ACC, DETAIL) << "ConvNetAcc[" << layer_id << "] of type: "
       << layer->layer_param().type() << endl;
 
     // input layer
@@ -277,9 +191,15 @@ void ConvNetAcc::Init(const Net& net) {
     } else if (layer->layer_param().type() == "Split") {
       // instantiates the split layer pe in the ConvNetAcc
       InitSplitLayer(net, layer_id);
+    } else if (layer->layer_param().type() == "Slice") {
+      // instantiates the slice layer pe in the ConvNetAcc
+      InitSliceLayer(net, layer_id);
     } else if (layer->layer_param().type() == "Concat") {
       // instantiates the concat layer pe in the ConvNetAcc
       InitConcatLayer(net, layer_id);
+    } else if (layer->layer_param().type() == "Eltwise") {
+      // instantiates the element-wise layer pe in the ConvNetAcc
+      InitEltwiseLayer(net, layer_id);
     } else {
       // bypass the remaining layers
       BypassLayer(net, layer_id);
@@ -299,7 +219,8 @@ void ConvNetAcc::InitInputLayer(const Net& net, int layer_id) {
   const string next_connection = layer->layer_param().top(0);
   layer_valid_.push_back(new sc_signal<bool>);
   layer_rdy_.push_back(new sc_signal<bool>);
-  layer_data_.push_back(new sc_signal<Payload> [Nin]);
+  // the input pixels of one handshake are concatenated on the bus
+  layer_data_.push_back(new PayloadBusSignal(Nin*input_pixels_));
   interconnections_to_idx_[next_connection] =
     layer_valid_.size() - 1;
   // record the input blob index & number
@@ -314,14 +235,12 @@ void ConvNetAcc::InitInputLayer(const Net& net, int layer_id) {
     sc_trace(tf_, *layer_valid_.back(), name);
     sprintf(name, "%s_rdy", layer_name.c_str());
     sc_trace(tf_, *layer_rdy_.back(), name);
-    for (int i = 0; i < Nin_; ++i) {
-      sprintf(name, "%s_data_%d", layer_name.c_str(), i);
-      sc_trace(tf_, layer_data_.back()[i], name);
-    }
+    sprintf(name, "%s_data", layer_name.c_str());
+    sc_trace(tf_, *layer_data_.back(), name);
   }
 
   // log info: map the interconnection name to the the interconnection index
-  cout << "Input layer: " << net.layers_name_[layer_id]
+  LOG(CONVNET_ACC, DETAIL) << "Input layer: " << net.layers_name_[layer_id]
     << " allocates new connections: " << next_connection
     << " to index " << layer_valid_.size() - 1 << endl;
 
@@ -358,11 +277,12 @@ void ConvNetAcc::BypassLayer(const Net& net, int layer_id) {
     if (prev_connection != next_connection) {
       // register the new interconnection name
       interconnections_to_idx_[next_connection] = prev_connection_idx;
-      cout << "register new connection: " << next_connection << " to idx "
-        << prev_connection_idx << endl;
+      LOG(CONVNET_ACC, DETAIL) << "register new connection: " << next_connection
+        << " to idx " << prev_connection_idx << endl;
     }
   }
-  cout << "Bypass layer " << net.layers_name_[layer_id] << endl;
+  LOG(CONVNET_ACC, DETAIL) << "Bypass layer " << net.layers_name_[layer_id]
+    << endl;
 }
 
 void ConvNetAcc::InitPoolingPe(const Net& net, int layer_id) {
@@ -398,14 +318,6 @@ void ConvNetAcc::InitPoolingPe(const Net& net, int layer_id) {
   //const int Pin = 1;
   const int Pin = parallelism_[layer_id].first.first;
 
-  // allocate the new PoolLayerPe
-  PoolLayerPe* pool_layer_pe = new PoolLayerPe(module_name, Kh, Kw, h, w, Nin,
-      Pin, Pad_h, Pad_w, Stride_h, Stride_w, pool_method, bit_width_,
-      tech_node_, clk_freq_);
-  pool_layer_pe_.push_back(pool_layer_pe);
-  // make the connections
-  pool_layer_pe->clock(clock);
-  pool_layer_pe->reset(reset);
   // look for the previous layer connections (bottom blobs in Caffe)
   const string prev_connection = layer->layer_param().bottom(0);
   if (interconnections_to_idx_.find(prev_connection) ==
@@ -415,11 +327,6 @@ void ConvNetAcc::InitPoolingPe(const Net& net, int layer_id) {
     exit(1);
   }
   const int prev_connection_idx = interconnections_to_idx_[prev_connection];
-  pool_layer_pe->prev_layer_valid(*layer_valid_[prev_connection_idx]);
-  pool_layer_pe->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
-  for (int i = 0; i < Nin; ++i) {
-    pool_layer_pe->prev_layer_data[i](layer_data_[prev_connection_idx][i]);
-  }
   // allocate the next layer connections (top blobs in Caffe)
   // Nout = Nin for pooling layer
   const int Nout = Nin;
@@ -427,14 +334,40 @@ void ConvNetAcc::InitPoolingPe(const Net& net, int layer_id) {
     "_append_channel_buffer";
   layer_valid_.push_back(new sc_signal<bool>);
   layer_rdy_.push_back(new sc_signal<bool>);
-  layer_data_.push_back(new sc_signal<Payload> [Nout]);
+  layer_data_.push_back(new PayloadBusSignal(Nout));
   // record the interconnections to the map
   interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
-  // make the connections of the current convolution pe
-  pool_layer_pe->next_layer_rdy(*layer_rdy_.back());
-  pool_layer_pe->next_layer_valid(*layer_valid_.back());
-  for (int i = 0; i < Nout; ++i) {
-    pool_layer_pe->next_layer_data[i](layer_data_.back()[i]);
+
+  if (dynamic_cast<const PoolingLayer*>(layer)->global_pooling()) {
+    // allocate the new GlobalPoolPe: accumulators instead of the line buffer
+    GlobalPoolPe* global_pool_pe = new GlobalPoolPe(module_name, h, w, Nin,
+        Pin, pool_method, layer_precision_->LayerBitWidth(layer_id),
+        tech_node_, clk_freq_);
+    global_pool_pe_.push_back(global_pool_pe);
+    // make the connections
+    global_pool_pe->clock(clock);
+    global_pool_pe->reset(reset);
+    global_pool_pe->prev_layer_valid(*layer_valid_[prev_connection_idx]);
+    global_pool_pe->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
+    global_pool_pe->prev_layer_data(*layer_data_[prev_connection_idx]);
+    global_pool_pe->next_layer_rdy(*layer_rdy_.back());
+    global_pool_pe->next_layer_valid(*layer_valid_.back());
+    global_pool_pe->next_layer_data(*layer_data_.back());
+  } else {
+    // allocate the new PoolLayerPe
+    PoolLayerPe* pool_layer_pe = new PoolLayerPe(module_name, Kh, Kw, h, w,
+        Nin, Pin, Pad_h, Pad_w, Stride_h, Stride_w, pool_method,
+        layer_precision_->LayerBitWidth(layer_id), tech_node_, clk_freq_);
+    pool_layer_pe_.push_back(pool_layer_pe);
+    // make the connections
+    pool_layer_pe->clock(clock);
+    pool_layer_pe->reset(reset);
+    pool_layer_pe->prev_layer_valid(*layer_valid_[prev_connection_idx]);
+    pool_layer_pe->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
+    pool_layer_pe->prev_layer_data(*layer_data_[prev_connection_idx]);
+    pool_layer_pe->next_layer_rdy(*layer_rdy_.back());
+    pool_layer_pe->next_layer_valid(*layer_valid_.back());
+    pool_layer_pe->next_layer_data(*layer_data_.back());
   }
   // add the data path to trace file
   if (tf_) {
@@ -445,22 +378,20 @@ void ConvNetAcc::InitPoolingPe(const Net& net, int layer_id) {
     sprintf(name, "%s_rdy", layer_name.c_str());
     sc_trace(tf_, *layer_rdy_.back(), name);
 #ifdef DATA_PATH
-    for (int i = 0; i < Nout; ++i) {
-      sprintf(name, "%s_data_%d", layer_name.c_str(), i);
-      sc_trace(tf_, layer_data_.back()[i], name);
-    }
+    sprintf(name, "%s_data", layer_name.c_str());
+    sc_trace(tf_, *layer_data_.back(), name);
 #endif
   }
 
-  cout << "Pool: " << module_name << " - Nin: " << Nin << " Nout: " << Nout
-    << " Kh: " << Kh << " Kw: " << Kw << " h: " << h << " w: " << w
-    << " Sh: " << Stride_h << " Sw: " << Stride_w << " Ph: " << Pad_h
-    << " Pw: " << Pad_w << endl;
+  LOG(CONVNET_ACC, DETAIL) << "Pool: " << module_name << " - Nin: " << Nin
+    << " Nout: " << Nout << " Kh: " << Kh << " Kw: " << Kw << " h: " << h
+    << " w: " << w << " Sh: " << Stride_h << " Sw: " << Stride_w << " Ph: "
+    << Pad_h << " Pw: " << Pad_w << endl;
 
-  cout << "previous connections: " << layer->layer_param().bottom(0) 
-    << " of idx " << prev_connection_idx  << " allocate next connections: "
-    << next_connection << " of idx " << layer_valid_.size()-1
-    << endl;
+  LOG(CONVNET_ACC, DETAIL) << "previous connections: "
+    << layer->layer_param().bottom(0) << " of idx " << prev_connection_idx
+    << " allocate next connections: " << next_connection << " of idx "
+    << layer_valid_.size()-1 << endl;
 
   // append the channel buffer to the end of the current layer
   AppendChannelBuffer(net, layer_id, 0, append_buffer_capacity_);
@@ -520,10 +451,13 @@ void ConvNetAcc::InitInnerProductLayer(const Net& net, int layer_id) {
   const int Pk = parallelism_[layer_id].second;
 
   // allocate the new ConvLayerPe
+  const int bit_width = layer_precision_->LayerBitWidth(layer_id);
   ConvLayerPe* fc_layer_pe = new ConvLayerPe(module_name, Kh, Kw, h, w, Nin,
       Nout, Pin, Pout, Pk, Pad_h, Pad_w, Stride_h, Stride_w, memory_type_,
-      bit_width_, tech_node_, clk_freq_);
+      bit_width, tech_node_, clk_freq_, zero_skipping_);
   conv_layer_pe_.push_back(fc_layer_pe);
+  LoadWeights(net.SourceLayers(layer->layer_param().name()), fc_layer_pe, Nin,
+      Nout, Kh*Kw, bit_width);
   // make the connections
   fc_layer_pe->clock(clock);
   fc_layer_pe->reset(reset);
@@ -538,23 +472,19 @@ void ConvNetAcc::InitInnerProductLayer(const Net& net, int layer_id) {
   const int prev_connection_idx = interconnections_to_idx_[prev_connection];
   fc_layer_pe->prev_layer_valid(*layer_valid_[prev_connection_idx]);
   fc_layer_pe->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
-  for (int i = 0; i < Nin; ++i) {
-    fc_layer_pe->prev_layer_data[i](layer_data_[prev_connection_idx][i]);
-  }
+  fc_layer_pe->prev_layer_data(*layer_data_[prev_connection_idx]);
   // allocate the next layer connections (top blobs in Caffe)
   const string next_connection = layer->layer_param().top(0) +
     "_append_channel_buffer";
   layer_valid_.push_back(new sc_signal<bool>);
   layer_rdy_.push_back(new sc_signal<bool>);
-  layer_data_.push_back(new sc_signal<Payload> [Nout]);
+  layer_data_.push_back(new PayloadBusSignal(Nout));
   // record the interconnections to the map
   interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
   // make the connections of the current convolution pe
   fc_layer_pe->next_layer_rdy(*layer_rdy_.back());
   fc_layer_pe->next_layer_valid(*layer_valid_.back());
-  for (int i = 0; i < Nout; ++i) {
-    fc_layer_pe->next_layer_data[i](layer_data_.back()[i]);
-  }
+  fc_layer_pe->next_layer_data(*layer_data_.back());
   // add the data path to trace file
   if (tf_) {
     const string layer_name = next_connection;
@@ -564,22 +494,20 @@ void ConvNetAcc::InitInnerProductLayer(const Net& net, int layer_id) {
     sprintf(name, "%s_rdy", layer_name.c_str());
     sc_trace(tf_, *layer_rdy_.back(), name);
 #ifdef DATA_PATH
-    for (int i = 0; i < Nout; ++i) {
-      sprintf(name, "%s_data_%d", layer_name.c_str(), i);
-      sc_trace(tf_, layer_data_.back()[i], name);
-    }
+    sprintf(name, "%s_data", layer_name.c_str());
+    sc_trace(tf_, *layer_data_.back(), name);
 #endif
   }
 
-  cout << "FC: " << module_name << " - Nin: " << Nin << " Nout: " << Nout
-    << " Kh: " << Kh << " Kw: " << Kw << " h: " << h << " w: " << w
-    << " Sh: " << Stride_h << " Sw: " << Stride_w << " Ph: " << Pad_h
-    << " Pw: " << Pad_w << endl;
+  LOG(CONVNET_ACC, DETAIL) << "FC: " << module_name << " - Nin: " << Nin
+    << " Nout: " << Nout << " Kh: " << Kh << " Kw: " << Kw << " h: " << h
+    << " w: " << w << " Sh: " << Stride_h << " Sw: " << Stride_w << " Ph: "
+    << Pad_h << " Pw: " << Pad_w << endl;
 
-  cout << "previous connections: " << layer->layer_param().bottom(0)
-    << " of idx " << prev_connection_idx  << " allocate next connections: "
-    << next_connection << " of idx " << layer_valid_.size()-1
-    << endl;
+  LOG(CONVNET_ACC, DETAIL) << "previous connections: "
+    << layer->layer_param().bottom(0) << " of idx " << prev_connection_idx
+    << " allocate next connections: " << next_connection << " of idx "
+    << layer_valid_.size()-1 << endl;
 
   // append the channel buffer the end of the current layer
   AppendChannelBuffer(net, layer_id, 0, append_buffer_capacity_);
@@ -607,7 +535,7 @@ void ConvNetAcc::InitConcatLayer(const Net& net, int layer_id) {
   const string next_connection = layer->layer_param().top(0);
   layer_valid_.push_back(new sc_signal<bool>);
   layer_rdy_.push_back(new sc_signal<bool>);
-  layer_data_.push_back(new sc_signal<Payload> [Nin]);
+  layer_data_.push_back(new PayloadBusSignal(Nin));
   // record the interconnections to the map
   interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
   // connect the next layer valid & ready signal
@@ -617,7 +545,6 @@ void ConvNetAcc::InitConcatLayer(const Net& net, int layer_id) {
   Nout_ = Nin;
   output_blob_idx_ = layer_valid_.size() - 1;
 
-  int cur_data_blob_idx = 0;
   for (int blob_id = 0; blob_id < layer->layer_param().bottom_size();
       ++blob_id) {
     const string prev_connection = layer->layer_param().bottom(blob_id);
@@ -642,23 +569,11 @@ void ConvNetAcc::InitConcatLayer(const Net& net, int layer_id) {
       "_prepend_channel_buffer"];
     concat_pe->prev_layer_valid[blob_id](*layer_valid_[prev_connection_idx]);
     concat_pe->prev_layer_rdy[blob_id](*layer_rdy_[prev_connection_idx]);
-    const int channel_depth = net.bottom_blobs_shape_ptr_[layer_id][blob_id]->
-      at(1);
-    for (int i = 0; i < channel_depth; ++i) {
-      concat_pe->prev_layer_data[cur_data_blob_idx+i](
-          layer_data_[prev_connection_idx][i]);
-    }
-
-    // connect the next layer data connection
-    const int next_connection_idx = interconnections_to_idx_[next_connection];
-    for (int i = 0; i < channel_depth; ++i) {
-      concat_pe->next_layer_data[cur_data_blob_idx+i](
-          layer_data_[next_connection_idx][cur_data_blob_idx+i]);
-    }
-
-    // update the data blob index
-    cur_data_blob_idx += channel_depth;
+    concat_pe->prev_layer_data[blob_id](*layer_data_[prev_connection_idx]);
   }
+  // connect the next layer data connection
+  concat_pe->next_layer_data(*layer_data_[
+      interconnections_to_idx_[next_connection]]);
 
   // add the signals to the trace file
   if (tf_) {
@@ -670,10 +585,68 @@ void ConvNetAcc::InitConcatLayer(const Net& net, int layer_id) {
     sprintf(name, "%s_rdy", layer_name.c_str());
     sc_trace(tf_, *layer_rdy_[next_connection_idx], name);
 #ifdef DATA_PATH
-    for (int i = 0; i < Nin; ++i) {
-      sprintf(name, "%s_data_%d", layer_name.c_str(), i);
-      sc_trace(tf_, layer_data_[next_connection_idx][i], name);
-    }
+    sprintf(name, "%s_data", layer_name.c_str());
+    sc_trace(tf_, *layer_data_[next_connection_idx], name);
+#endif
+  }
+}
+
+/*
+ * Implementation notes: InitEltwiseLayer
+ * ---------------------------------------
+ * The shortcut of the residual block delivers its pixels long before the
+ * residual branch warms up, so each bottom blob gets a prepended channel
+ * buffer of the infinite capacity, whose max depth is the skip buffer depth.
+ */
+void ConvNetAcc::InitEltwiseLayer(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "Eltwise");
+
+  // instantiates the element-wise pe in the ConvNetAcc
+  char module_name[100];
+  sprintf(module_name, "%s_pe", net.layers_name_[layer_id].c_str());
+  const int Nin = net.top_blobs_shape_ptr_[layer_id][0]->at(1);
+  const int numInputs = net.bottom_blobs_shape_ptr_[layer_id].size();
+  EltwisePe *eltwise_pe = new EltwisePe(module_name, Nin, numInputs,
+      layer->layer_param().eltwise_param().operation());
+  eltwise_layer_pe_.push_back(eltwise_pe);
+  // allocate the next layer connections (top blobs in Caffe)
+  const string next_connection = layer->layer_param().top(0);
+  layer_valid_.push_back(new sc_signal<bool>);
+  layer_rdy_.push_back(new sc_signal<bool>);
+  layer_data_.push_back(new PayloadBusSignal(Nin));
+  const int next_connection_idx = layer_valid_.size() - 1;
+  eltwise_pe->next_layer_rdy(*layer_rdy_[next_connection_idx]);
+  eltwise_pe->next_layer_valid(*layer_valid_[next_connection_idx]);
+  eltwise_pe->next_layer_data(*layer_data_[next_connection_idx]);
+  // update the output channel number
+  Nout_ = Nin;
+  output_blob_idx_ = next_connection_idx;
+
+  for (int blob_id = 0; blob_id < numInputs; ++blob_id) {
+    const string prev_connection = layer->layer_param().bottom(blob_id);
+    // prepend the skip channel buffer with the infinite capacity
+    PrependChannelBuffer(net, layer_id, blob_id);
+    const int prev_connection_idx = interconnections_to_idx_[prev_connection +
+      "_prepend_channel_buffer"];
+    eltwise_pe->prev_layer_valid[blob_id](*layer_valid_[prev_connection_idx]);
+    eltwise_pe->prev_layer_rdy[blob_id](*layer_rdy_[prev_connection_idx]);
+    eltwise_pe->prev_layer_data[blob_id](*layer_data_[prev_connection_idx]);
+  }
+  // record the interconnections to the map once the bottom blobs are bound
+  interconnections_to_idx_[next_connection] = next_connection_idx;
+
+  // add the signals to the trace file
+  if (tf_) {
+    char name [100];
+    sprintf(name, "%s_valid", next_connection.c_str());
+    sc_trace(tf_, *layer_valid_[next_connection_idx], name);
+    sprintf(name, "%s_rdy", next_connection.c_str());
+    sc_trace(tf_, *layer_rdy_[next_connection_idx], name);
+#ifdef DATA_PATH
+    sprintf(name, "%s_data", next_connection.c_str());
+    sc_trace(tf_, *layer_data_[next_connection_idx], name);
 #endif
   }
 }
@@ -686,9 +659,11 @@ void ConvNetAcc::AppendChannelBuffer(const Net& net, int layer_id, int blob_id,
       net.layers_name_[layer_id].c_str(), blob_id);
   // obtain the input channel depth
   const int Nin = net.top_blobs_shape_ptr_[layer_id][blob_id]->at(1);
-  // allocate the channel buffer
+  // allocate the channel buffer, holding the pixels requantized to the next
+  // layers
   ChannelBuffer *channel_buffer = new ChannelBuffer(module_name, Nin, capacity,
-      bit_width_, tech_node_, clk_freq_);
+      layer_precision_->BlobBitWidth(layer->layer_param().top(blob_id)),
+      tech_node_, clk_freq_);
   channel_buffer_.push_back(channel_buffer);
   // make the connections
   channel_buffer->clock(clock);
@@ -704,22 +679,18 @@ void ConvNetAcc::AppendChannelBuffer(const Net& net, int layer_id, int blob_id,
   const int prev_connection_idx = interconnections_to_idx_[prev_connection];
   channel_buffer->prev_layer_valid(*layer_valid_[prev_connection_idx]);
   channel_buffer->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
-  for (int i = 0; i < Nin; ++i) {
-    channel_buffer->prev_layer_data[i](layer_data_[prev_connection_idx][i]);
-  }
+  channel_buffer->prev_layer_data(*layer_data_[prev_connection_idx]);
   // allocate the next layer connections
   const string next_connection = layer->layer_param().top(blob_id);
   layer_valid_.push_back(new sc_signal<bool>);
   layer_rdy_.push_back(new sc_signal<bool>);
-  layer_data_.push_back(new sc_signal<Payload> [Nin]);
+  layer_data_.push_back(new PayloadBusSignal(Nin));
   // record the interconnection to the map
   interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
   // make the connection to the channle buffer
   channel_buffer->next_layer_valid(*layer_valid_.back());
   channel_buffer->next_layer_rdy(*layer_rdy_.back());
-  for (int i = 0; i < Nin; ++i) {
-    channel_buffer->next_layer_data[i](layer_data_.back()[i]);
-  }
+  channel_buffer->next_layer_data(*layer_data_.back());
 
   // add the signals to the trace file
   if (tf_) {
@@ -729,24 +700,24 @@ void ConvNetAcc::AppendChannelBuffer(const Net& net, int layer_id, int blob_id,
     sprintf(name, "%s_rdy", next_connection.c_str());
     sc_trace(tf_, *layer_rdy_.back(), name);
 #ifdef DATA_PATH
-    for (int i = 0; i < Nin; ++i) {
-      sprintf(name, "%s_data_%d", next_connection.c_str(), i);
-      sc_trace(tf_, layer_data_.back()[i], name);
-    }
+    sprintf(name, "%s_data", next_connection.c_str());
+    sc_trace(tf_, *layer_data_.back(), name);
 #endif
   }
-  cout << "previous connections: " << prev_connection
+  LOG(CONVNET_ACC, DETAIL) << "previous connections: " << prev_connection
     << " of idx " << prev_connection_idx  << " allocate next connections: "
     << next_connection << " of idx " << layer_valid_.size()-1
     << endl;
-  cout << "Channel buffer: " << module_name << " Nin: " << Nin << endl;
+  LOG(CONVNET_ACC, DETAIL) << "Channel buffer: " << module_name << " Nin: "
+    << Nin << endl;
 }
 
 void ConvNetAcc::PrependChannelBuffer(const Net& net, int layer_id, int blob_id,
     int capacity) {
   const Layer* layer = net.layers_[layer_id];
-  // we only add the channel buffer in the concatenation layer
-  assert(layer->layer_param().type() == "Concat");
+  // we only add the channel buffer in the concatenation & element-wise layer
+  assert(layer->layer_param().type() == "Concat" ||
+      layer->layer_param().type() == "Eltwise");
   char module_name[100];
   sprintf(module_name, "%s_prepend_channel_buffer_%d",
       net.layers_name_[layer_id].c_str(), blob_id);
@@ -754,7 +725,8 @@ void ConvNetAcc::PrependChannelBuffer(const Net& net, int layer_id, int blob_id,
   const int Nin = net.bottom_blobs_shape_ptr_[layer_id][blob_id]->at(1);
   // allocate the channel buffer
   ChannelBuffer *channel_buffer = new ChannelBuffer(module_name, Nin, capacity,
-      bit_width_, tech_node_, clk_freq_);
+      layer_precision_->BlobBitWidth(layer->layer_param().bottom(blob_id)),
+      tech_node_, clk_freq_);
   channel_buffer_.push_back(channel_buffer);
   // make the connections
   channel_buffer->clock(clock);
@@ -769,23 +741,19 @@ void ConvNetAcc::PrependChannelBuffer(const Net& net, int layer_id, int blob_id,
   const int prev_connection_idx = interconnections_to_idx_[prev_connection];
   channel_buffer->prev_layer_valid(*layer_valid_[prev_connection_idx]);
   channel_buffer->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
-  for (int i = 0; i < Nin; ++i) {
-    channel_buffer->prev_layer_data[i](layer_data_[prev_connection_idx][i]);
-  }
+  channel_buffer->prev_layer_data(*layer_data_[prev_connection_idx]);
   // allocate the next layer outputs
   // append the name with channel_buffer
   const string next_connection = prev_connection + "_prepend_channel_buffer";
   layer_valid_.push_back(new sc_signal<bool>);
   layer_rdy_.push_back(new sc_signal<bool>);
-  layer_data_.push_back(new sc_signal<Payload> [Nin]);
+  layer_data_.push_back(new PayloadBusSignal(Nin));
   // record the interconnection to the map
   interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
   // make the connection of the channel buffer
   channel_buffer->next_layer_valid(*layer_valid_.back());
   channel_buffer->next_layer_rdy(*layer_rdy_.back());
-  for (int i = 0; i < Nin; ++i) {
-    channel_buffer->next_layer_data[i](layer_data_.back()[i]);
-  }
+  channel_buffer->next_layer_data(*layer_data_.back());
 
   // add the signals to the trace file
   if (tf_) {
@@ -795,17 +763,16 @@ void ConvNetAcc::PrependChannelBuffer(const Net& net, int layer_id, int blob_id,
     sprintf(name, "%s_rdy", next_connection.c_str());
     sc_trace(tf_, *layer_rdy_.back(), name);
 #ifdef DATA_PATH
-    for (int i = 0; i < Nin; ++i) {
-      sprintf(name, "%s_data_%d", next_connection.c_str(), i);
-      sc_trace(tf_, layer_data_.back()[i], name);
-    }
+    sprintf(name, "%s_data", next_connection.c_str());
+    sc_trace(tf_, *layer_data_.back(), name);
 #endif
   }
-  cout << "previous connections: " << layer->layer_param().bottom(blob_id)
-    << " of idx " << prev_connection_idx  << " allocate next connections: "
-    << next_connection << " of idx " << layer_valid_.size()-1
-    << endl;
-  cout << "Channel buffer: " << module_name << " Nin: " << Nin << endl;
+  LOG(CONVNET_ACC, DETAIL) << "previous connections: "
+    << layer->layer_param().bottom(blob_id) << " of idx "
+    << prev_connection_idx  << " allocate next connections: " << next_connection
+    << " of idx " << layer_valid_.size()-1 << endl;
+  LOG(CONVNET_ACC, DETAIL) << "Channel buffer: " << module_name << " Nin: "
+    << Nin << endl;
 }
 
 void ConvNetAcc::InitSplitLayer(const Net& net, int layer_id) {
@@ -834,24 +801,20 @@ void ConvNetAcc::InitSplitLayer(const Net& net, int layer_id) {
   const int prev_connection_idx = interconnections_to_idx_[prev_connection];
   split_pe->prev_layer_valid(*layer_valid_[prev_connection_idx]);
   split_pe->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
-  for (int i = 0; i < Nin; ++i) {
-    split_pe->prev_layer_data[i](layer_data_[prev_connection_idx][i]);
-  }
+  split_pe->prev_layer_data(*layer_data_[prev_connection_idx]);
   // allocate the next layer connections (top blobs in Caffe)
   // split layer has more than one top blobs
   for (int blob_id = 0; blob_id < layer->layer_param().top_size(); ++blob_id) {
     const string next_connection = layer->layer_param().top(blob_id);
     layer_valid_.push_back(new sc_signal<bool>);
     layer_rdy_.push_back(new sc_signal<bool>);
-    layer_data_.push_back(new sc_signal<Payload> [Nin]);
+    layer_data_.push_back(new PayloadBusSignal(Nin));
     // record the interconnections to the map
     interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
     // make the connections to the newly allocated port
     split_pe->next_layer_rdy[blob_id](*layer_rdy_.back());
     split_pe->next_layer_valid[blob_id](*layer_valid_.back());
-    for (int i = 0; i < Nin; ++i) {
-      split_pe->next_layer_data[blob_id*Nin+i](layer_data_.back()[i]);
-    }
+    split_pe->next_layer_data[blob_id](*layer_data_.back());
 
     // add the data path to the trace file
     if (tf_) {
@@ -862,21 +825,85 @@ void ConvNetAcc::InitSplitLayer(const Net& net, int layer_id) {
       sprintf(name, "%s_rdy", layer_name.c_str());
       sc_trace(tf_, *layer_rdy_.back(), name);
 #ifdef DATA_PATH
-      for (int i = 0; i < Nin; ++i) {
-        sprintf(name, "%s_data_%d", layer_name.c_str(), i);
-        sc_trace(tf_, layer_data_.back()[i], name);
-      }
+      sprintf(name, "%s_data", layer_name.c_str());
+      sc_trace(tf_, *layer_data_.back(), name);
 #endif
     }
 
-    cout << "previous connections: " << layer->layer_param().bottom(0)
-      << " of idx " << prev_connection_idx  << " allocate next connections: "
-      << layer->layer_param().top(blob_id) << " of idx " << layer_valid_.size()-1
+    LOG(CONVNET_ACC, DETAIL) << "previous connections: "
+      << layer->layer_param().bottom(0) << " of idx " << prev_connection_idx
+      << " allocate next connections: " << layer->layer_param().top(blob_id)
+      << " of idx " << layer_valid_.size()-1 << endl;
+  }
+
+  LOG(CONVNET_ACC, DETAIL) << "Split: " << module_name << " - Nin: " << Nin
+    << " numSplits: " << numSplits << endl;
+}
+
+void ConvNetAcc::InitSliceLayer(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "Slice");
+
+  // instantiates the slice pe in the ConvNetAcc
+  char module_name[100];
+  sprintf(module_name, "%s_pe", net.layers_name_[layer_id].c_str());
+  // the channels of each slice from the top blob shapes
+  const int Nin = net.bottom_blobs_shape_ptr_[layer_id][0]->at(1);
+  vector<int> Nout;
+  for (size_t blob_id = 0; blob_id < net.top_blobs_shape_ptr_[layer_id].size();
+      ++blob_id) {
+    Nout.push_back(net.top_blobs_shape_ptr_[layer_id][blob_id]->at(1));
+  }
+  SlicePe* slice_pe = new SlicePe(module_name, Nin, Nout);
+  slice_layer_pe_.push_back(slice_pe);
+  // make the connections
+  // look for the previous layer connections
+  const string prev_connection = layer->layer_param().bottom(0);
+  if (interconnections_to_idx_.find(prev_connection) ==
+      interconnections_to_idx_.end()) {
+    cerr << "undefined previous layer connections: " << prev_connection
       << endl;
+    exit(1);
   }
+  const int prev_connection_idx = interconnections_to_idx_[prev_connection];
+  slice_pe->prev_layer_valid(*layer_valid_[prev_connection_idx]);
+  slice_pe->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
+  slice_pe->prev_layer_data(*layer_data_[prev_connection_idx]);
+  // allocate the next layer connections (top blobs in Caffe) of the width of
+  // each slice
+  for (int blob_id = 0; blob_id < layer->layer_param().top_size(); ++blob_id) {
+    const string next_connection = layer->layer_param().top(blob_id);
+    layer_valid_.push_back(new sc_signal<bool>);
+    layer_rdy_.push_back(new sc_signal<bool>);
+    layer_data_.push_back(new PayloadBusSignal(Nout[blob_id]));
+    // record the interconnections to the map
+    interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
+    // make the connections to the newly allocated port
+    slice_pe->next_layer_rdy[blob_id](*layer_rdy_.back());
+    slice_pe->next_layer_valid[blob_id](*layer_valid_.back());
+    slice_pe->next_layer_data[blob_id](*layer_data_.back());
+
+    // add the data path to the trace file
+    if (tf_) {
+      char name[100];
+      sprintf(name, "%s_valid", next_connection.c_str());
+      sc_trace(tf_, *layer_valid_.back(), name);
+      sprintf(name, "%s_rdy", next_connection.c_str());
+      sc_trace(tf_, *layer_rdy_.back(), name);
+#ifdef DATA_PATH
+      sprintf(name, "%s_data", next_connection.c_str());
+      sc_trace(tf_, *layer_data_.back(), name);
+#endif
+    }
 
-  cout << "Split: " << module_name << " - Nin: " << Nin << " numSplits: "
-    << numSplits << endl;
+    LOG(CONVNET_ACC, DETAIL) << "previous connections: " << prev_connection
+      << " of idx " << prev_connection_idx << " allocate next connections: "
+      << next_connection << " of idx " << layer_valid_.size()-1 << endl;
+  }
+
+  LOG(CONVNET_ACC, DETAIL) << "Slice: " << module_name << " - Nin: " << Nin
+    << " numSlices: " << Nout.size() << endl;
 }
 
 void ConvNetAcc::InitConvolutionPe(const Net& net, int layer_id) {
@@ -907,10 +934,16 @@ void ConvNetAcc::InitConvolutionPe(const Net& net, int layer_id) {
   const int Pk = parallelism_[layer_id].second;
 
   // allocate the new ConvLayerPe
+  const int bit_width = layer_precision_->LayerBitWidth(layer_id);
+  const int Pw = (spatial_parallelism_.find(layer_id) ==
+      spatial_parallelism_.end()) ? 1 : spatial_parallelism_[layer_id];
   ConvLayerPe* conv_layer_pe = new ConvLayerPe(module_name, Kh, Kw, h, w, Nin,
       Nout, Pin, Pout, Pk, Pad_h, Pad_w, Stride_h, Stride_w, memory_type_,
-      bit_width_, tech_node_, clk_freq_);
+      bit_width, tech_node_, clk_freq_, zero_skipping_, Pw);
   conv_layer_pe_.push_back(conv_layer_pe);
+  LoadWeights(net.SourceLayers(layer->layer_param().name()), conv_layer_pe,
+      Nin, Nout, Kh*Kw, bit_width,
+      dynamic_cast<const ConvolutionLayer*>(layer)->group_);
   // make the connections
   conv_layer_pe->clock(clock);
   conv_layer_pe->reset(reset);
@@ -925,23 +958,19 @@ void ConvNetAcc::InitConvolutionPe(const Net& net, int layer_id) {
   const int prev_connection_idx = interconnections_to_idx_[prev_connection];
   conv_layer_pe->prev_layer_valid(*layer_valid_[prev_connection_idx]);
   conv_layer_pe->prev_layer_rdy(*layer_rdy_[prev_connection_idx]);
-  for (int i = 0; i < Nin; ++i) {
-    conv_layer_pe->prev_layer_data[i](layer_data_[prev_connection_idx][i]);
-  }
+  conv_layer_pe->prev_layer_data(*layer_data_[prev_connection_idx]);
   // allocate the next layer connections (top blobs in Caffe)
   const string next_connection = layer->layer_param().top(0) +
     "_append_channel_buffer";
   layer_valid_.push_back(new sc_signal<bool>);
   layer_rdy_.push_back(new sc_signal<bool>);
-  layer_data_.push_back(new sc_signal<Payload> [Nout]);
+  layer_data_.push_back(new PayloadBusSignal(Nout));
   // record the interconnections to the map
   interconnections_to_idx_[next_connection] = layer_valid_.size() - 1;
   // make the connections of the current convolution pe
   conv_layer_pe->next_layer_rdy(*layer_rdy_.back());
   conv_layer_pe->next_layer_valid(*layer_valid_.back());
-  for (int i = 0; i < Nout; ++i) {
-    conv_layer_pe->next_layer_data[i](layer_data_.back()[i]);
-  }
+  conv_layer_pe->next_layer_data(*layer_data_.back());
   // add the data path to trace file
   if (tf_) {
     const string layer_name = next_connection;
@@ -951,10 +980,8 @@ void ConvNetAcc::InitConvolutionPe(const Net& net, int layer_id) {
     sprintf(name, "%s_rdy", layer_name.c_str());
     sc_trace(tf_, *layer_rdy_.back(), name);
 #ifdef DATA_PATH
-    for (int i = 0; i < Nout; ++i) {
-      sprintf(name, "%s_data_%d", layer_name.c_str(), i);
-      sc_trace(tf_, layer_data_.back()[i], name);
-    }
+    sprintf(name, "%s_data", layer_name.c_str());
+    sc_trace(tf_, *layer_data_.back(), name);
 
     // verbose trace
     sprintf(name, "%s_line_buffer_valid", layer->layer_param().name().c_str());
@@ -976,15 +1003,15 @@ void ConvNetAcc::InitConvolutionPe(const Net& net, int layer_id) {
 #endif
   }
 
-  cout << "Conv: " << module_name << " - Nin: " << Nin << " Nout: " << Nout
-    << " Kh: " << Kh << " Kw: " << Kw << " h: " << h << " w: " << w
-    << " Sh: " << Stride_h << " Sw: " << Stride_w << " Ph: " << Pad_h
-    << " Pw: " << Pad_w << endl;
+  LOG(CONVNET_ACC, DETAIL) << "Conv: " << module_name << " - Nin: " << Nin
+    << " Nout: " << Nout << " Kh: " << Kh << " Kw: " << Kw << " h: " << h
+    << " w: " << w << " Sh: " << Stride_h << " Sw: " << Stride_w << " Ph: "
+    << Pad_h << " Pw: " << Pad_w << endl;
 
-  cout << "previous connections: " << layer->layer_param().bottom(0)
-    << " of idx " << prev_connection_idx  << " allocate next connections: "
-    << next_connection << " of idx " << layer_valid_.size()-1
-    << endl;
+  LOG(CONVNET_ACC, DETAIL) << "previous connections: "
+    << layer->layer_param().bottom(0) << " of idx " << prev_connection_idx
+    << " allocate next connections: " << next_connection << " of idx "
+    << layer_valid_.size()-1 << endl;
 
   // append the channel buffer to the end of the current layer
   AppendChannelBuffer(net, layer_id, 0, append_buffer_capacity_);
@@ -1011,7 +1038,11 @@ double ConvNetAcc::Area() const {
       iter != pool_layer_pe_.end(); ++iter) {
     total_area += (*iter)->Area();
   }
-  // no area model for the split pe & concat pe
+  for (vector<GlobalPoolPe *>::const_iterator iter =
+      global_pool_pe_.begin(); iter != global_pool_pe_.end(); ++iter) {
+    total_area += (*iter)->Area();
+  }
+  // no area model for the split pe, concat pe & eltwise pe
   // can be added here
 
   // channel buffer area
@@ -1040,7 +1071,11 @@ double ConvNetAcc::StaticPower() const {
       iter != pool_layer_pe_.end(); ++iter) {
     total_power += (*iter)->StaticPower();
   }
-  // no power model for the split pe & concat pe
+  for (vector<GlobalPoolPe *>::const_iterator iter =
+      global_pool_pe_.begin(); iter != global_pool_pe_.end(); ++iter) {
+    total_power += (*iter)->StaticPower();
+  }
+  // no power model for the split pe, concat pe & eltwise pe
 
   // channel buffer static power
   for (vector<ChannelBuffer *>::const_iterator iter = channel_buffer_.begin();
@@ -1063,7 +1098,11 @@ double ConvNetAcc::DynamicPower() const {
       iter != pool_layer_pe_.end(); ++iter) {
     total_power += (*iter)->DynamicPower();
   }
-  // no power model for the split pe & concat pe
+  for (vector<GlobalPoolPe *>::const_iterator iter =
+      global_pool_pe_.begin(); iter != global_pool_pe_.end(); ++iter) {
+    total_power += (*iter)->DynamicPower();
+  }
+  // no power model for the split pe, concat pe & eltwise pe
 
   // channel buffer dynamic power
   for (vector<ChannelBuffer *>::const_iterator iter = channel_buffer_.begin();
@@ -1078,6 +1117,29 @@ double ConvNetAcc::TotalPower() const {
   return StaticPower() + DynamicPower();
 }
 
+/*
+ * Implementation notes: LoadWeights
+ * ----------------------------------
+ * The weights are quantized to the bit width of the layer. Without the
+ * caffemodel, the weight memory keeps the full ones.
+ */
+void ConvNetAcc::LoadWeights(const vector<string>& layer_names,
+    ConvLayerPe* layer_pe, int Nin, int Nout, int kernel_size, int bit_width,
+    int group) {
+  if (weight_loader_ == NULL) {
+    return;
+  }
+  vector<int> weights;
+  const int frac_bits = weight_loader_->QuantizeWeights(layer_names, Nout, Nin,
+      kernel_size, group, bit_width, weights);
+  cout << "Load weights: " << layer_names[0];
+  for (size_t i = 1; i < layer_names.size(); ++i) {
+    cout << " + " << layer_names[i];
+  }
+  cout << " - fraction bits: " << frac_bits << endl;
+  layer_pe->LoadWeights(weights);
+}
+
 /*
  * Implementation notes: clear
  * ----------------------------
@@ -1087,8 +1149,6 @@ double ConvNetAcc::TotalPower() const {
  */
 void ConvNetAcc::clear() {
   // remove all the data structures
-  delete [] input_layer_data;
-  delete [] output_layer_data;
   //for (size_t i = 0; i < conv_layer_pe_.size(); ++i) {
   //  delete conv_layer_pe_[i];
   //}
@@ -1097,14 +1157,26 @@ void ConvNetAcc::clear() {
   //  delete pool_layer_pe_[i];
   //}
   pool_layer_pe_.clear();
+  //for (size_t i = 0; i < global_pool_pe_.size(); ++i) {
+  //  delete global_pool_pe_[i];
+  //}
+  global_pool_pe_.clear();
   //for (size_t i = 0; i < split_layer_pe_.size(); ++i) {
   //  delete split_layer_pe_[i];
   //}
   split_layer_pe_.clear();
+  //for (size_t i = 0; i < slice_layer_pe_.size(); ++i) {
+  //  delete slice_layer_pe_[i];
+  //}
+  slice_layer_pe_.clear();
   //for (size_t i = 0; i < concat_layer_pe_.size(); ++i) {
   //  delete concat_layer_pe_[i];
   //}
   concat_layer_pe_.clear();
+  //for (size_t i = 0; i < eltwise_layer_pe_.size(); ++i) {
+  //  delete eltwise_layer_pe_[i];
+  //}
+  eltwise_layer_pe_.clear();
   //for (size_t i = 0; i < channel_buffer_.size(); ++i) {
   //  delete channel_buffer_[i];
   //}
@@ -1119,7 +1191,7 @@ void ConvNetAcc::clear() {
   //}
   layer_rdy_.clear();
   //for (size_t i = 0; i < layer_data_.size(); ++i) {
-  //  delete [] layer_data_[i];
+  //  delete layer_data_[i];
   //}
   layer_data_.clear();
 
@@ -5,6 +5,7 @@
  */
 
 #include "header/systemc/demux_out_reg.hpp"
+#include "header/systemc/event_gating.hpp"
 using namespace std;
 
 DemuxOutReg::DemuxOutReg(sc_module_name module_name, int Nout, int Pout,
@@ -34,6 +35,9 @@ DemuxOutReg::~DemuxOutReg() {
 }
 
 void DemuxOutReg::DemuxOutRegProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
   if (reset.read() || demux_out_reg_clear.read()) {
     for (int i = 0; i < Nout_; ++i) {
       out_data[i].write(Payload(0));
@@ -56,6 +60,12 @@ void DemuxOutReg::DemuxOutRegProc() {
     }
 #endif
   }
+
+  // sleep until enabled or cleared, as clearing again keeps the output
+  if (!demux_out_reg_enable.read()) {
+    next_trigger(demux_out_reg_enable.posedge_event() |
+        demux_out_reg_clear.posedge_event() | reset.value_changed_event());
+  }
 }
 
 double DemuxOutReg::Area() const {
@@ -0,0 +1,113 @@
+/*
+ * Filename: eltwise_pe.cpp
+ * -------------------------
+ * This file implements the class EltwisePe.
+ */
+
+#include "header/systemc/eltwise_pe.hpp"
+using namespace std;
+using namespace caffe;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The constructor allocates the ports of the block.
+ */
+EltwisePe::EltwisePe(sc_module_name module_name, int Nin, int numInputs,
+    EltwiseParameter_EltwiseOp op) : sc_module(module_name), Nin_(Nin),
+  numInputs_(numInputs), op_(op), eltwise_data_(Nin) {
+  // sanity check: the number of bottom blobs should be greater than 1
+  assert(numInputs > 1);
+  // allocates the ports
+  prev_layer_valid = new sc_in<bool> [numInputs];
+  prev_layer_rdy = new sc_out<bool> [numInputs];
+  prev_layer_data = new sc_in<PayloadBus> [numInputs];
+
+  SC_METHOD(EltwisePeNextData);
+  for (int i = 0; i < numInputs; ++i) {
+    sensitive << prev_layer_data[i];
+  }
+
+  SC_METHOD(EltwisePeNextValid);
+  for (int i = 0; i < numInputs; ++i) {
+    sensitive << prev_layer_valid[i];
+  }
+
+  SC_METHOD(EltwisePePreRdy);
+  sensitive << next_layer_rdy;
+  for (int i = 0; i < numInputs; ++i) {
+    sensitive << prev_layer_valid[i];
+  }
+}
+
+EltwisePe::~EltwisePe() {
+  delete [] prev_layer_valid;
+  delete [] prev_layer_rdy;
+  delete [] prev_layer_data;
+}
+
+/*
+ * Implementation notes: EltwisePeNextData
+ * ----------------------------------------
+ * Combine the bottom blobs channel by channel in the order of the bottom blobs.
+ * The fixed-point payload wraps around on overflow as the RTL data path.
+ */
+void EltwisePe::EltwisePeNextData() {
+  const PayloadBus& first_data = prev_layer_data[0].read();
+  assert(first_data.width() == Nin_);
+  for (int j = 0; j < Nin_; ++j) {
+    eltwise_data_[j] = first_data[j];
+  }
+  for (int i = 1; i < numInputs_; ++i) {
+    const PayloadBus& prev_data = prev_layer_data[i].read();
+    // sanity check: the bottom blobs are of the same depth
+    assert(prev_data.width() == Nin_);
+    for (int j = 0; j < Nin_; ++j) {
+      switch (op_) {
+        case EltwiseParameter_EltwiseOp_PROD:
+          eltwise_data_[j] = eltwise_data_[j] * prev_data[j];
+          break;
+        case EltwiseParameter_EltwiseOp_MAX:
+          if (eltwise_data_[j] < prev_data[j]) {
+            eltwise_data_[j] = prev_data[j];
+          }
+          break;
+        default:
+          eltwise_data_[j] = eltwise_data_[j] + prev_data[j];
+          break;
+      }
+    }
+  }
+  next_layer_data.write(eltwise_data_);
+}
+
+/*
+ * Implementation notes: EltwisePeNextValid
+ * -----------------------------------------
+ * AND all the previous valid signals.
+ */
+void EltwisePe::EltwisePeNextValid() {
+  next_layer_valid.write(PrevLayerAllValid());
+}
+
+/*
+ * Implementation notes: EltwisePePreRdy
+ * --------------------------------------
+ * Bypass the next layer ready when all the proceeding valids are asserted, so
+ * the pixels of all the bottom blobs are consumed together.
+ */
+void EltwisePe::EltwisePePreRdy() {
+  const bool rdy = PrevLayerAllValid() && next_layer_rdy.read();
+  for (int i = 0; i < numInputs_; ++i) {
+    prev_layer_rdy[i].write(rdy);
+  }
+}
+
+bool EltwisePe::PrevLayerAllValid() const {
+  for (int i = 0; i < numInputs_; ++i) {
+    if (!prev_layer_valid[i].read()) {
+      return false;
+    }
+  }
+  return true;
+}
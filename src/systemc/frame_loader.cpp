@@ -0,0 +1,160 @@
+/*
+ * Filename: frame_loader.cpp
+ * ---------------------------
+ * This file implements the class FrameLoader.
+ */
+
+#include "header/systemc/frame_loader.hpp"
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+void FrameLoader::Load(const string& filename, vector<double>* pixels) const {
+  ifstream inFile(filename.c_str(), ios::in | ios::binary);
+  if (!inFile) {
+    cerr << "[ERROR]: input frame " << filename << " can NOT open!" << endl;
+    exit(1);
+  }
+  vector<uint8_t> buffer((istreambuf_iterator<char>(inFile)),
+      istreambuf_iterator<char>());
+  inFile.close();
+
+  // raw file of float32 unless it starts with the .npy magic string
+  string descr = "<f4";
+  size_t offset = 0;
+  long int count = buffer.size() / 4;
+  if (buffer.size() >= 6 && memcmp(&buffer[0], "\x93NUMPY", 6) == 0) {
+    offset = ParseNpyHeader(filename, buffer, &descr, &count);
+  } else if (buffer.size() % 4 != 0) {
+    count = -1;
+  }
+  const long int frame_size = static_cast<long int>(Nin_) * spatial_dim_;
+  const size_t element_size = (descr == "<f8") ? 8 : (descr == "<f4") ? 4 : 1;
+  if (count != frame_size || buffer.size() < offset + count*element_size) {
+    cerr << "[ERROR]: input frame " << filename << " has " << count
+      << " elements, expect " << Nin_ << "x" << spatial_dim_ << endl;
+    exit(1);
+  }
+
+  // (C, H, W) to the channel-interleaved streaming order
+  pixels->resize(frame_size);
+  for (int c = 0; c < Nin_; ++c) {
+    for (int p = 0; p < spatial_dim_; ++p) {
+      (*pixels)[static_cast<long int>(p)*Nin_+c] = Decode(&buffer[offset],
+          descr, static_cast<long int>(c)*spatial_dim_+p);
+    }
+  }
+}
+
+/*
+ * Implementation notes: ParseNpyHeader
+ * -------------------------------------
+ * The .npy file starts with the magic string, the version & the length of the
+ * header (2 bytes for version 1.0, 4 bytes for 2.0 & 3.0), followed by the
+ * header in the literal of the python dict, e.g.
+ *
+ *  {'descr': '<f4', 'fortran_order': False, 'shape': (3, 224, 224), }
+ */
+size_t FrameLoader::ParseNpyHeader(const string& filename,
+    const vector<uint8_t>& buffer, string* descr, long int* count) {
+  if (buffer.size() < 10) {
+    cerr << "[ERROR]: malformed npy file " << filename << endl;
+    exit(1);
+  }
+  const int major_version = buffer[6];
+  size_t header_len, header_start;
+  if (major_version == 1) {
+    header_len = buffer[8] | (buffer[9] << 8);
+    header_start = 10;
+  } else if (buffer.size() >= 12) {
+    header_len = buffer[8] | (buffer[9] << 8) | (buffer[10] << 16) |
+      (static_cast<size_t>(buffer[11]) << 24);
+    header_start = 12;
+  } else {
+    header_len = 0;
+    header_start = buffer.size();
+  }
+  if (header_start + header_len > buffer.size()) {
+    cerr << "[ERROR]: malformed npy file " << filename << endl;
+    exit(1);
+  }
+  const string header(buffer.begin()+header_start,
+      buffer.begin()+header_start+header_len);
+
+  const size_t descr_pos = header.find("'descr'");
+  const size_t shape_pos = header.find("'shape'");
+  if (descr_pos == string::npos || shape_pos == string::npos) {
+    cerr << "[ERROR]: malformed npy header of " << filename << endl;
+    exit(1);
+  }
+
+  // element type
+  const size_t descr_start = header.find('\'', header.find(':', descr_pos)) +
+    1;
+  *descr = header.substr(descr_start, header.find('\'', descr_start) -
+      descr_start);
+  if (*descr == "|u1" || *descr == "<u1") {
+    *descr = "|u1";
+  } else if (*descr == "|i1" || *descr == "<i1") {
+    *descr = "|i1";
+  } else if (*descr != "<f4" && *descr != "<f8") {
+    cerr << "[ERROR]: unsupported npy type " << *descr << " of " << filename
+      << ", expect <f4, <f8, |u1 or |i1" << endl;
+    exit(1);
+  }
+  if (header.find("'fortran_order': True") != string::npos) {
+    cerr << "[ERROR]: fortran order of npy file " << filename
+      << " is not supported" << endl;
+    exit(1);
+  }
+
+  // no. of elements: product of the shape tuple
+  const size_t shape_start = header.find('(', shape_pos);
+  const size_t shape_end = header.find(')', shape_pos);
+  if (shape_start == string::npos || shape_end == string::npos) {
+    cerr << "[ERROR]: malformed npy header of " << filename << endl;
+    exit(1);
+  }
+  *count = 1;
+  const char* dim = header.c_str() + shape_start + 1;
+  char* end;
+  while (dim < header.c_str() + shape_end) {
+    const long int size = strtol(dim, &end, 10);
+    if (end == dim) {
+      ++dim;
+    } else {
+      *count *= size;
+      dim = end;
+    }
+  }
+  return header_start + header_len;
+}
+
+double FrameLoader::Decode(const uint8_t* data, const string& descr,
+    long int i) {
+  if (descr == "|u1") {
+    return data[i];
+  } else if (descr == "|i1") {
+    return static_cast<int8_t>(data[i]);
+  } else if (descr == "<f4") {
+    const uint8_t* bytes = data + 4*i;
+    const uint32_t bits = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+      (static_cast<uint32_t>(bytes[3]) << 24);
+    float value;
+    memcpy(&value, &bits, sizeof(float));
+    return value;
+  } else {
+    const uint8_t* bytes = data + 8*i;
+    uint64_t bits = 0;
+    for (int b = 7; b >= 0; --b) {
+      bits = (bits << 8) | bytes[b];
+    }
+    double value;
+    memcpy(&value, &bits, sizeof(double));
+    return value;
+  }
+}
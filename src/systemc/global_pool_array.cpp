@@ -0,0 +1,162 @@
+/*
+ * Filename: global_pool_array.cpp
+ * --------------------------------
+ * This file implements the class GlobalPoolArray.
+ */
+
+#include "header/systemc/global_pool_array.hpp"
+#include "header/systemc/event_gating.hpp"
+#include "header/logger.hpp"
+#include <algorithm>
+using namespace std;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The AVG accumulators are widened by ceil(log2(h*w)) bits to hold the sum of
+ * the frame without overflow, as the generated RTL does. The accumulators are
+ * modeled as a RAM of ceil(Nin/Pin) words, one input tile per word.
+ */
+GlobalPoolArray::GlobalPoolArray(sc_module_name module_name, int h, int w,
+    int Nin, int Pin, PoolArray::PoolMethod pool_method, int bit_width,
+    int tech_node, double clk_freq) :
+  sc_module(module_name), h_(h), w_(w), Nin_(Nin), Pin_(Pin),
+  pool_method_(pool_method), acc_(Nin, 0.), reset_acc_(Nin, 0.) {
+  // data port width no.: Pin for pooling layer
+  pool_array_in_data = new sc_in<Payload> [Pin_];
+  pool_array_out_data = new sc_out<Payload> [Pin_];
+
+  // GlobalPoolArrayProc: synchronous with clock and reset
+  SC_METHOD(GlobalPoolArrayProc);
+  sensitive << clock.pos() << reset;
+
+  int acc_bit_width = bit_width;
+  if (pool_method == PoolArray::AVG) {
+    acc_bit_width += static_cast<int>(ceil(log2(static_cast<double>(h*w))));
+    adder_model_ = new AdderModel(acc_bit_width, tech_node, clk_freq);
+    comparator_model_ = NULL;
+  } else {
+    adder_model_ = NULL;
+    comparator_model_ = new ComparatorModel(bit_width, tech_node, clk_freq);
+  }
+  const int tiled_in = static_cast<int>(ceil(static_cast<double>(Nin)/Pin));
+  acc_model_ = new MemoryModel(Pin*acc_bit_width, tiled_in, tech_node,
+      config::ConfigParameter_MemoryType_RAM, clk_freq);
+  dynamic_energy_ = 0.;
+}
+
+GlobalPoolArray::~GlobalPoolArray() {
+  delete [] pool_array_in_data;
+  delete [] pool_array_out_data;
+
+  if (adder_model_) {
+    delete adder_model_;
+  }
+  if (comparator_model_) {
+    delete comparator_model_;
+  }
+  delete acc_model_;
+}
+
+void GlobalPoolArray::SaveState(Checkpoint* checkpoint) const {
+  checkpoint->WriteVector(name(), acc_);
+}
+
+void GlobalPoolArray::RestoreState(Checkpoint* checkpoint) {
+  checkpoint->ReadVector(name(), &reset_acc_);
+  if (static_cast<int>(reset_acc_.size()) != Nin_) {
+    cerr << "[ERROR]: checkpoint of " << name() << " does not match the "
+      "channel number" << endl;
+    exit(1);
+  }
+}
+
+/*
+ * Implementation notes: GlobalPoolArrayProc
+ * ------------------------------------------
+ * The first pixel of the frame loads the accumulators of the selected tile,
+ * and the following pixels are compared or added to them. The results are
+ * only output for the last pixel, where the AVG sum is divided by h*w.
+ */
+void GlobalPoolArray::GlobalPoolArrayProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
+  if (reset.read()) {
+    // reset the accumulators (to the restored state if any)
+    acc_ = reset_acc_;
+    for (int i = 0; i < Pin_; ++i) {
+      pool_array_out_data[i].write(Payload(0));
+    }
+  } else if (pool_array_en.read()) {
+    const int select = pool_array_select.read();
+    const bool first = pool_array_first.read();
+    const bool last = pool_array_last.read();
+    // read & write back the accumulators of the tile
+    dynamic_energy_ += acc_model_->DynamicEnergyOfReadOperation() +
+      acc_model_->DynamicEnergyOfWriteOperation();
+    for (int i = 0; i < Pin_; ++i) {
+      const int channel = select*Pin_ + i;
+      if (channel >= Nin_) {
+        // out-of range due to non-integer case
+        if (last) {
+          pool_array_out_data[i].write(Payload(0));
+        }
+        continue;
+      }
+      if (!first) {
+        dynamic_energy_ += (pool_method_ == PoolArray::MAX) ?
+          comparator_model_->DynamicEnergyOfOneOperation() :
+          adder_model_->DynamicEnergyOfOneOperation();
+      }
+#ifdef DATA_PATH
+      const double in_data = pool_array_in_data[i].read().value();
+      if (first) {
+        acc_[channel] = in_data;
+      } else if (pool_method_ == PoolArray::MAX) {
+        acc_[channel] = max(acc_[channel], in_data);
+      } else {
+        acc_[channel] += in_data;
+      }
+      if (last) {
+        const Payload result = (pool_method_ == PoolArray::AVG) ?
+          Payload(acc_[channel] / (h_*w_)) : Payload(acc_[channel]);
+        pool_array_out_data[i].write(result);
+        LOG(POOL_ARRAY, TRACE) << "@" << sc_time_stamp() << " " << name()
+          << " outputs channel " << channel << ": " << result.value() << endl;
+      }
+#endif
+    }
+  }
+
+  SleepUntilEnabled(pool_array_en, reset);
+}
+
+/*
+ * Implmentation notes: Area
+ * --------------------------
+ * Pin comparators or adders, together with the accumulator memory.
+ */
+double GlobalPoolArray::Area() const {
+  const double unit_area = (pool_method_ == PoolArray::MAX) ?
+    comparator_model_->Area() : adder_model_->Area();
+  return Pin_ * unit_area + acc_model_->Area();
+}
+
+double GlobalPoolArray::StaticPower() const {
+  const double unit_power = (pool_method_ == PoolArray::MAX) ?
+    comparator_model_->StaticPower() : adder_model_->StaticPower();
+  return Pin_ * unit_power + acc_model_->StaticPower();
+}
+
+double GlobalPoolArray::DynamicPower() const {
+  sc_time clock_period = dynamic_cast<const sc_clock*>(clock.get_interface())->
+    period();
+  sc_time sim_time = sc_time_stamp();
+  double total_cycles = sim_time / clock_period;
+  return dynamic_energy_ / total_cycles;
+}
+
+double GlobalPoolArray::TotalPower() const {
+  return StaticPower() + DynamicPower();
+}
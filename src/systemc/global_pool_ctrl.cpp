@@ -0,0 +1,185 @@
+/*
+ * Filename: global_pool_ctrl.cpp
+ * -------------------------------
+ * This file implements the class GlobalPoolCtrl.
+ */
+
+#include "header/systemc/global_pool_ctrl.hpp"
+using namespace std;
+
+GlobalPoolCtrl::GlobalPoolCtrl(sc_module_name module_name, int h, int w,
+    int Nin, int Pin, int extra_pipeline_stage)
+  : sc_module(module_name) {
+  // assign the parameters to the instance variables
+  h_ = h;
+  w_ = w;
+  Nin_ = Nin;
+  Pin_ = Pin;
+  extra_pipeline_stage_ = extra_pipeline_stage;
+  // start from the first pixel unless restored from the checkpoint
+  feat_pixel_counter_ = reset_feat_pixel_counter_ = 0;
+  waiting_input_ = false;
+
+  // synchronous to clock & reset
+  SC_CTHREAD(GlobalPoolCtrlProc, clock.pos());
+  reset_signal_is(reset, true);
+
+  SC_METHOD(PoolArrayCtrlProc);
+  sensitive << clock.pos() << reset;
+
+  SC_METHOD(DemuxOutRegCtrlProc);
+  sensitive << clock.pos() << reset;
+
+  SC_METHOD(PixelLoad);
+  sensitive << prev_layer_rdy << prev_layer_valid;
+}
+
+// the partial results of the frame are held by the GlobalPoolArray, so only
+// the counter is kept
+void GlobalPoolCtrl::SaveState(Checkpoint* checkpoint) const {
+  checkpoint->Write(name(), feat_pixel_counter_);
+}
+
+void GlobalPoolCtrl::RestoreState(Checkpoint* checkpoint) {
+  checkpoint->Read(name(), &reset_feat_pixel_counter_);
+  if (reset_feat_pixel_counter_ < 0 || reset_feat_pixel_counter_ > h_*w_) {
+    cerr << "[ERROR]: checkpoint of " << name() << " does not match the "
+      "feature map size" << endl;
+    exit(1);
+  }
+}
+
+void GlobalPoolCtrl::PixelLoad() {
+  pixel_load.write(prev_layer_rdy.read() && prev_layer_valid.read());
+}
+
+/*
+ * Implementation notes: GlobalPoolCtrlProc
+ * -----------------------------------------
+ * The accepted pixel is loaded into the PixelMux in the handshake cycle, which
+ * outputs the first input tile, so the mux is only enabled for the following
+ * tiles. The pipeline is drained and the output pixel is sent only after the
+ * last pixel of the frame; otherwise the next pixel is accepted right away.
+ */
+void GlobalPoolCtrl::GlobalPoolCtrlProc() {
+  // reset behavior
+  prev_layer_rdy.write(0);    // not ready for the previous layer
+  next_layer_valid.write(0);  // invalid for the next layer
+  // disable & invalid for all the internal units
+  pixel_mux_en.write(0);
+  pixel_mux_select.write(0);
+  pipeline_flags_[0] = false;
+  tile_idx_pool_ctrl_ = 0;
+  first_pixel_pool_ctrl_ = false;
+  last_pixel_pool_ctrl_ = false;
+
+  // total feature map pixels
+  const int feat_pixels = h_ * w_;
+  const int tiled_in = static_cast<int>(ceil(static_cast<double>(Nin_)/Pin_));
+  // feature map received counter
+  feat_pixel_counter_ = reset_feat_pixel_counter_;
+  waiting_input_ = false;
+
+  wait();
+
+  while (true) {
+    // reset feat_pixel_counter_
+    if (feat_pixel_counter_ == feat_pixels) {
+      feat_pixel_counter_ = 0;
+    }
+    const bool first_pixel = (feat_pixel_counter_ == 0);
+
+    // accept data from the previous layer
+    prev_layer_rdy.write(1);
+    waiting_input_ = true;
+    do {
+      wait();
+    } while (!prev_layer_valid.read());
+    waiting_input_ = false;
+    // deassert the ready
+    prev_layer_rdy.write(0);
+    ++feat_pixel_counter_;
+    const bool last_pixel = (feat_pixel_counter_ == feat_pixels);
+
+    // fold the pixel into the accumulators of all the input tiles
+    pipeline_flags_[0] = true;
+    first_pixel_pool_ctrl_ = first_pixel;
+    last_pixel_pool_ctrl_ = last_pixel;
+    for (int i = 0; i < tiled_in; ++i) {
+      if (i > 0) {
+        pixel_mux_en.write(1);
+        pixel_mux_select.write(i);
+      }
+      // store the input tile index to the instance variable
+      tile_idx_pool_ctrl_ = i;
+      wait();
+    }
+    // deassert all the arithmetic stages
+    pipeline_flags_[0] = false;
+    pixel_mux_en.write(0);
+    pixel_mux_select.write(0);
+
+    if (!last_pixel) {
+      continue;
+    }
+
+    // drain the calculation
+    int drain_pipeline_ = 0;
+    while ((++drain_pipeline_) < (PIPELINE_STAGE+extra_pipeline_stage_)) {
+      wait();
+    }
+
+    // handshake protocol for next stage is ready to receive data
+    next_layer_valid.write(1);
+    do {
+      wait();
+    } while (!next_layer_rdy.read());
+    next_layer_valid.write(0);
+  }   // while (true)
+}
+
+void GlobalPoolCtrl::PoolArrayCtrlProc() {
+  if (reset.read()) {
+    pipeline_flags_[1] = false;
+    pool_array_en.write(0);
+    pool_array_select.write(0);
+    pool_array_first.write(0);
+    pool_array_last.write(0);
+    tile_idx_demux_out_ctrl_ = 0;
+    last_pixel_demux_out_ctrl_ = false;
+  } else if (pipeline_flags_[0]) {
+    pipeline_flags_[1] = true;
+    pool_array_en.write(1);
+    pool_array_select.write(tile_idx_pool_ctrl_);
+    pool_array_first.write(first_pixel_pool_ctrl_);
+    pool_array_last.write(last_pixel_pool_ctrl_);
+    // pipeline the tile index & last pixel to the demux output register
+    tile_idx_demux_out_ctrl_ = tile_idx_pool_ctrl_;
+    last_pixel_demux_out_ctrl_ = last_pixel_pool_ctrl_;
+  } else {
+    pipeline_flags_[1] = false;
+    pool_array_en.write(0);
+    pool_array_select.write(0);
+    pool_array_first.write(0);
+    pool_array_last.write(0);
+    tile_idx_demux_out_ctrl_ = 0;
+    last_pixel_demux_out_ctrl_ = false;
+  }
+}
+
+void GlobalPoolCtrl::DemuxOutRegCtrlProc() {
+  if (reset.read()) {
+    pipeline_flags_[2] = false;
+    demux_out_reg_enable.write(0);
+    demux_select.write(0);
+  } else if (pipeline_flags_[1] && last_pixel_demux_out_ctrl_) {
+    // only the results of the last pixel are written to the output register
+    pipeline_flags_[2] = true;
+    demux_out_reg_enable.write(1);
+    demux_select.write(tile_idx_demux_out_ctrl_*Pin_);
+  } else {
+    pipeline_flags_[2] = false;
+    demux_out_reg_enable.write(0);
+    demux_select.write(0);
+  }
+}
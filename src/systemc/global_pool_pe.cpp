@@ -0,0 +1,158 @@
+/*
+ * Filename: global_pool_pe.cpp
+ * -----------------------------
+ * This file implements the class GlobalPoolPe.
+ */
+
+#include "header/systemc/global_pool_pe.hpp"
+using namespace std;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The constructor initializes the modules in the global pooling layer
+ * processing elements, and makes the connections of each module. The pixel
+ * mux loads the input pixel in the handshake cycle, so it is connected to the
+ * input data port directly.
+ */
+GlobalPoolPe::GlobalPoolPe(sc_module_name module_name, int h, int w, int Nin,
+    int Pin, PoolArray::PoolMethod pool_method, int bit_width, int tech_node,
+    double clk_freq)
+  : sc_module(module_name), Nin_(Nin), Pin_(Pin), next_data_(Nin) {
+  // pooling layer: same input & output channel depth / parallelism
+  const int Nout = Nin;
+  const int Pout = Pin;
+  // allocate the interconnections
+  pixel_mux_out_data_ = new sc_signal<Payload> [Pin];
+  pool_array_out_data_ = new sc_signal<Payload> [Pout];
+  out_reg_data_ = new sc_signal<Payload> [Nout];
+
+  char name[100];
+  // initialize the FSM controller
+  sprintf(name, "%s", "controller");
+  global_pool_ctrl_ = new GlobalPoolCtrl(name, h, w, Nin, Pin);
+  global_pool_ctrl_->clock(clock);
+  global_pool_ctrl_->reset(reset);
+  global_pool_ctrl_->prev_layer_valid(prev_layer_valid);
+  global_pool_ctrl_->prev_layer_rdy(prev_layer_rdy);
+  global_pool_ctrl_->next_layer_rdy(next_layer_rdy);
+  global_pool_ctrl_->next_layer_valid(next_layer_valid);
+  global_pool_ctrl_->pixel_load(pixel_load_);
+  global_pool_ctrl_->pixel_mux_en(pixel_mux_en_);
+  global_pool_ctrl_->pixel_mux_select(pixel_mux_select_);
+  global_pool_ctrl_->pool_array_en(pool_array_en_);
+  global_pool_ctrl_->pool_array_select(pool_array_select_);
+  global_pool_ctrl_->pool_array_first(pool_array_first_);
+  global_pool_ctrl_->pool_array_last(pool_array_last_);
+  global_pool_ctrl_->demux_out_reg_enable(demux_out_reg_enable_);
+  global_pool_ctrl_->demux_select(demux_select_);
+
+  // initialize the pixel mux
+  sprintf(name, "%s", "pixel_mux");
+  pixel_mux_ = new PixelMux(name, Nin, Pin, bit_width, tech_node, clk_freq);
+  pixel_mux_->clock(clock);
+  pixel_mux_->reset(reset);
+  pixel_mux_->pixel_load(pixel_load_);
+  pixel_mux_->pixel_data(prev_layer_data);
+  pixel_mux_->mux_en(pixel_mux_en_);
+  pixel_mux_->mux_select(pixel_mux_select_);
+  for (int i = 0; i < Pin; ++i) {
+    pixel_mux_->mux_data_out[i](pixel_mux_out_data_[i]);
+  }
+
+  // initialize the global pooling array (max/avg)
+  sprintf(name, "%s", "global_pool_array");
+  global_pool_array_ = new GlobalPoolArray(name, h, w, Nin, Pin, pool_method,
+      bit_width, tech_node, clk_freq);
+  global_pool_array_->clock(clock);
+  global_pool_array_->reset(reset);
+  global_pool_array_->pool_array_en(pool_array_en_);
+  global_pool_array_->pool_array_select(pool_array_select_);
+  global_pool_array_->pool_array_first(pool_array_first_);
+  global_pool_array_->pool_array_last(pool_array_last_);
+  for (int i = 0; i < Pin; ++i) {
+    global_pool_array_->pool_array_in_data[i](pixel_mux_out_data_[i]);
+  }
+  for (int i = 0; i < Pout; ++i) {
+    global_pool_array_->pool_array_out_data[i](pool_array_out_data_[i]);
+  }
+
+  // initialize the demux output register
+  sprintf(name, "%s", "demux_out_reg");
+  demux_out_reg_ = new DemuxOutReg(name, Nout, Pout, bit_width, tech_node,
+      clk_freq);
+  demux_out_reg_->clock(clock);
+  demux_out_reg_->reset(reset);
+  demux_out_reg_->demux_out_reg_clear(demux_out_reg_clear_);
+  demux_out_reg_->demux_out_reg_enable(demux_out_reg_enable_);
+  demux_out_reg_->demux_select(demux_select_);
+  for (int i = 0; i < Pout; ++i) {
+    demux_out_reg_->in_data[i](pool_array_out_data_[i]);
+  }
+  for (int i = 0; i < Nout; ++i) {
+    demux_out_reg_->out_data[i](out_reg_data_[i]);
+  }
+
+  // connect output register to the interface
+  SC_METHOD(NextLayerDataConnect);
+  for (int i = 0; i < Nout; ++i) {
+    sensitive << out_reg_data_[i];
+  }
+}
+
+void GlobalPoolPe::NextLayerDataConnect() {
+  for (int i = 0; i < Nin_; ++i) {
+    next_data_[i] = out_reg_data_[i].read();
+  }
+  next_layer_data.write(next_data_);
+}
+
+GlobalPoolPe::~GlobalPoolPe() {
+  delete [] pixel_mux_out_data_;
+  delete [] pool_array_out_data_;
+  delete [] out_reg_data_;
+
+  delete global_pool_ctrl_;
+  delete pixel_mux_;
+  delete global_pool_array_;
+  delete demux_out_reg_;
+}
+
+/*
+ * Implementation notes: Area
+ * ---------------------------
+ * Accumulate all the components within the global pool layer.
+ */
+double GlobalPoolPe::Area() const {
+  double total_area = 0.;
+  // pixel mux area
+  total_area += pixel_mux_->Area();
+  // pool array, including the accumulators
+  total_area += global_pool_array_->Area();
+  // demux reg
+  total_area += demux_out_reg_->Area();
+
+  return total_area;
+}
+
+double GlobalPoolPe::StaticPower() const {
+  double total_power = 0.;
+  // accumulate the static power of all components
+  total_power += pixel_mux_->StaticPower();
+  total_power += global_pool_array_->StaticPower();
+  total_power += demux_out_reg_->StaticPower();
+  return total_power;
+}
+
+double GlobalPoolPe::DynamicPower() const {
+  double total_power = 0.;
+  // accumulate the dynamic power of all components
+  total_power += pixel_mux_->DynamicPower();
+  total_power += global_pool_array_->DynamicPower();
+  total_power += demux_out_reg_->DynamicPower();
+  return total_power;
+}
+
+double GlobalPoolPe::TotalPower() const {
+  return StaticPower() + DynamicPower();
+}
@@ -5,48 +5,53 @@
  */
 
 #include "header/systemc/line_buffer_array.hpp"
+#include "header/systemc/event_gating.hpp"
 using namespace std;
 
 /*
  * Implementation notes: Constructor
  * ----------------------------------
- * The constructor mainly initializes Nin line buffers and makes the
- * interconnections.
+ * Each line buffer is the streaming connection of Kh rows of Kw DFFs, where two
+ * adjacent rows are connected by the SRAM of depth w-Kw. It is equivalent to a
+ * shift register of (Kh-1)*w+Kw pixels (Kh*Kw pixels without SRAM), so the Nin
+ * line buffers share one circular buffer of that many pixels of Nin channels.
+ * Writing up to G = Pw*Stride_w pixels at once keeps G-1 more pixels, and the
+ * SRAM stores G pixels per word.
  */
 LineBufferArray::LineBufferArray(sc_module_name module_name, int Kh, int Kw,
-    int h, int w, int Nin, int bit_width, int tech_node, double clk_freq)
-  : sc_module(module_name), Kh_(Kh), Kw_(Kw), h_(h), w_(w), Nin_(Nin) {
+    int h, int w, int Nin, int bit_width, int tech_node, double clk_freq,
+    int Pw, int Stride_w)
+  : sc_module(module_name), Kh_(Kh), Kw_(Kw), h_(h), w_(w), Nin_(Nin),
+  Pw_(Pw), Stride_w_(Stride_w) {
+  pixels_ = (Pw > 1) ? Pw*Stride_w : 1;
   // allocate the ports
-  input_data = new sc_in<Payload> [Nin];
-  output_data = new sc_out<Payload> [Nin*Kh*Kw];
+  output_data = new sc_out<Payload> [Pw*Nin*Kh*Kw];
 
-  // allocate Nin line buffers
-  char name [100];
-  line_buffer_ = new LineBuffer* [Nin];
-  for (int i = 0; i < Nin; ++i) {
-    sprintf(name, "line_buffer_%d", i);
-    line_buffer_[i] = new LineBuffer(name, Kh, Kw, h, w, bit_width, tech_node,
-        clk_freq);
-    line_buffer_[i]->clock(clock);
-    line_buffer_[i]->reset(reset);
-    line_buffer_[i]->input_data(input_data[i]);
-    line_buffer_[i]->input_data_valid(input_data_valid);
-    for (int j = 0; j < Kh*Kw; ++j) {
-      line_buffer_[i]->output_data[j](output_data[i*Kh*Kw+j]);
-    }
+  // the number of sram is Kh-1, each sram is of depth w-Kw
+  if (Kh-1 <= 0 || w-Kw <= 0) {
+    sram_depth_ = 0;
+  } else {
+    sram_depth_ = w-Kw;
   }
+  window_size_ = (Kh-1)*(Kw+sram_depth_) + Kw;
+  ring_size_ = window_size_ + pixels_ - 1;
+  ring_.assign(ring_size_*Nin, Payload(0));
+  head_ = 0;
+  reset_ring_ = ring_;
+  reset_head_ = 0;
 
   // we use the centralized model of Nin line buffers (data width is incremented
   // by Nin times)
-  const int centralized_memory_depth = line_buffer_[0]->MemoryDepth();
-  const int centralized_memory_width = Nin * line_buffer_[0]->MemoryWidth();
+  const int centralized_memory_depth = (sram_depth_ + pixels_ - 1) / pixels_;
+  const int centralized_memory_width = pixels_ * Nin * (Kh-1) * bit_width;
   memory_model_ = new MemoryModel(centralized_memory_width,
       centralized_memory_depth, tech_node,
       config::ConfigParameter_MemoryType_RAM, clk_freq);
   dynamic_energy_ = 0.;
 
-  SC_METHOD(PowerManagement);
-  sensitive << clock.pos();
+  // LineBufferArrayProc: synchronous with clock and reset
+  SC_METHOD(LineBufferArrayProc);
+  sensitive << clock.pos() << reset;
 }
 
 /*
@@ -55,13 +60,86 @@ LineBufferArray::LineBufferArray(sc_module_name module_name, int Kh, int Kw,
  * Free the allocated dynamic space.
  */
 LineBufferArray::~LineBufferArray() {
-  for (int i = 0; i < Nin_; ++i) {
-    delete line_buffer_[i];
-  }
-  delete [] line_buffer_;
+  delete [] output_data;
   delete memory_model_;
 }
 
+/*
+ * Implementation notes: LineBufferArrayProc
+ * ------------------------------------------
+ * Streaming n pixels in moves the head backward by n slots, overwriting the
+ * oldest pixels, instead of shifting all DFFs & SRAMs. The DFF of row i and
+ * column j holds the pixel streamed in i*(Kw+sram_depth_)+j pixels ago. The
+ * pixels of one write are ordered from the oldest (the leftmost) one.
+ */
+void LineBufferArray::LineBufferArrayProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
+  if (reset.read()) {
+    // reset DFFs & SRAMs (to the restored state if any)
+    ring_ = reset_ring_;
+    head_ = reset_head_;
+    WriteWindow();
+  } else if (input_data_valid.read()) {
+    // adds one operation of energy
+    dynamic_energy_ += (memory_model_->DynamicEnergyOfReadOperation() +
+        memory_model_->DynamicEnergyOfWriteOperation());
+#ifdef DATA_PATH
+    // not reset & input data valid
+    const int n = (pixels_ > 1) ? input_pixel_num.read() : 1;
+    head_ = (head_ < n) ? head_+ring_size_-n : head_-n;
+    const PayloadBus& streamed_data = input_data.read();
+    for (int p = 0; p < n; ++p) {
+      int slot = head_ + n-1-p;
+      if (slot >= ring_size_) {
+        slot -= ring_size_;
+      }
+      Payload* pixel = &ring_[slot*Nin_];
+      for (int c = 0; c < Nin_; ++c) {
+        pixel[c] = streamed_data[p*Nin_+c];
+      }
+    }
+    WriteWindow();
+#endif
+  }
+
+  SleepUntilEnabled(input_data_valid, reset);
+}
+
+void LineBufferArray::WriteWindow() {
+  const int offset = (Pw_ > 1) ? output_window_offset.read() : 0;
+  for (int k = 0; k < Pw_; ++k) {
+    sc_out<Payload>* window = &output_data[k*Nin_*Kh_*Kw_];
+    for (int i = 0; i < Kh_; ++i) {
+      for (int j = 0; j < Kw_; ++j) {
+        const int slot = (head_ + offset + k*Stride_w_ + i*(Kw_+sram_depth_) +
+            j) % ring_size_;
+        const Payload* pixel = &ring_[slot*Nin_];
+        for (int c = 0; c < Nin_; ++c) {
+          window[c*Kh_*Kw_+i*Kw_+j].write(pixel[c]);
+        }
+      }
+    }
+  }
+}
+
+void LineBufferArray::SaveState(Checkpoint* checkpoint) const {
+  checkpoint->WriteVector(name(), ring_);
+  checkpoint->Write(name(), head_);
+}
+
+void LineBufferArray::RestoreState(Checkpoint* checkpoint) {
+  checkpoint->ReadVector(name(), &reset_ring_);
+  checkpoint->Read(name(), &reset_head_);
+  if (static_cast<int>(reset_ring_.size()) != ring_size_*Nin_ ||
+      reset_head_ < 0 || reset_head_ >= ring_size_) {
+    cerr << "[ERROR]: checkpoint of " << name() << " does not match the "
+      "line buffer size" << endl;
+    exit(1);
+  }
+}
+
 /*
  * Implementation notes: Area
  * ---------------------------
@@ -87,16 +165,3 @@ double LineBufferArray::DynamicPower() const {
 double LineBufferArray::TotalPower() const {
   return StaticPower() + DynamicPower();
 }
-
-/*
- * Implementation notes: PowerManagement
- * --------------------------------------
- * Update the dynamic power consumption when the input data is valid. I.e one
- * memory access is underwent.
- */
-void LineBufferArray::PowerManagement() {
-  if (input_data_valid.read()) {
-    dynamic_energy_ += (memory_model_->DynamicEnergyOfReadOperation() +
-      memory_model_->DynamicEnergyOfWriteOperation());
-  }
-}
@@ -5,6 +5,7 @@
  */
 
 #include "header/systemc/line_buffer_mux.hpp"
+#include "header/systemc/event_gating.hpp"
 using namespace std;
 
 LineBufferMux::LineBufferMux(sc_module_name module_name, int Kh, int Kw,
@@ -24,6 +25,15 @@ LineBufferMux::LineBufferMux(sc_module_name module_name, int Kh, int Kw,
     const int num_inputs = static_cast<int>(ceil(static_cast<double>(Nin)/Pin));
     mux_model_ = new MuxModel(Kh*Kw*bit_width, num_inputs, tech_node, clk_freq);
     dynamic_energy_ = 0.;
+
+    // fast paths of the common kernel shapes: 1x1, 1x7/7x1, 3x3 & 5x5
+    switch (Kh_*Kw_) {
+      case 1: select_windows_ = &LineBufferMux::SelectWindows<1>; break;
+      case 7: select_windows_ = &LineBufferMux::SelectWindows<7>; break;
+      case 9: select_windows_ = &LineBufferMux::SelectWindows<9>; break;
+      case 25: select_windows_ = &LineBufferMux::SelectWindows<25>; break;
+      default: select_windows_ = &LineBufferMux::SelectWindows<0>; break;
+    }
   }
 
 LineBufferMux::~LineBufferMux() {
@@ -33,6 +43,9 @@ LineBufferMux::~LineBufferMux() {
 }
 
 void LineBufferMux::LineBufferMuxProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
   if (reset.read()) {
     // reset, simply output full 0s
     for (int i = 0; i < Pin_*Kh_*Kw_; ++i) {
@@ -51,23 +64,38 @@ void LineBufferMux::LineBufferMuxProc() {
           Pin_));
     // sanity check the select signals
     assert(mux_select.read() >= 0 && mux_select.read() < mux_select_max);
-    const int line_buffer_start_idx = mux_select.read()*Pin_*Kh_*Kw_;
-    for (int i = 0; i < Pin_; ++i) {
-      for (int m = 0; m < Kh_; ++m) {
-        for (int n = 0; n < Kw_; ++n) {
-          // read index referred to the line buffer input
-          const int read_idx = line_buffer_start_idx + i*Kh_*Kw_+m*Kw_+n;
-          if (read_idx < Nin_*Kh_*Kw_) {
-            mux_data_out[i*Kh_*Kw_+m*Kw_+n].write(
-                line_buffer_data[read_idx].read());
-          } else {
-            // out-of range due to non-integer case
-            mux_data_out[i*Kh_*Kw_+m*Kw_+n].write(Payload(0));
-          }
-        }
+    (this->*select_windows_)(mux_select.read());
+#endif
+  }
+
+  SleepUntilEnabled(mux_en, reset);
+}
+
+/*
+ * Implementation notes: SelectWindows
+ * ------------------------------------
+ * The sliding window of one channel is contiguous in both the line buffer
+ * outputs & the mux outputs, so the copy of a window is unrolled for the
+ * kernel size known at compile time, e.g. 1x7 & 7x1 share the same path.
+ */
+template <int KERNEL_SIZE>
+void LineBufferMux::SelectWindows(int select) {
+  const int kernel_size = (KERNEL_SIZE > 0) ? KERNEL_SIZE : Kh_*Kw_;
+  for (int i = 0; i < Pin_; ++i) {
+    const int channel = select*Pin_ + i;
+    sc_out<Payload>* window = &mux_data_out[i*kernel_size];
+    if (channel < Nin_) {
+      const sc_in<Payload>* line_buffer_window =
+        &line_buffer_data[channel*kernel_size];
+      for (int j = 0; j < kernel_size; ++j) {
+        window[j].write(line_buffer_window[j].read());
+      }
+    } else {
+      // out-of range due to non-integer case
+      for (int j = 0; j < kernel_size; ++j) {
+        window[j].write(Payload(0));
       }
     }
-#endif
   }
 }
 
@@ -6,6 +6,8 @@
  */
 
 #include "header/systemc/mult_array.hpp"
+#include "header/systemc/event_gating.hpp"
+#include "header/logger.hpp"
 using namespace std;
 
 /*
@@ -14,8 +16,10 @@ using namespace std;
  * Allocates the input & output data port of the multiplier array.
  */
 MultArray::MultArray(sc_module_name module_name, int Kh, int Kw, int Pin,
-    int Pout, int Pk, int bit_width, int tech_node, double clk_freq)
-  : sc_module(module_name), Kh_(Kh), Kw_(Kw), Pin_(Pin), Pout_(Pout), Pk_(Pk) {
+    int Pout, int Pk, int bit_width, int tech_node, double clk_freq,
+    bool zero_gating)
+  : sc_module(module_name), Kh_(Kh), Kw_(Kw), Pin_(Pin), Pout_(Pout), Pk_(Pk),
+  zero_gating_(zero_gating), num_ops_(0), num_gated_ops_(0) {
     // the input data valid signal w.r.t. each input sliding window
     mult_array_in_valid = new sc_in<bool>[Pout_*Pin_*Pk_];
     mult_array_act_in_data = new sc_in<Payload>[Pin_*Kh_*Kw_];
@@ -29,6 +33,16 @@ MultArray::MultArray(sc_module_name module_name, int Kh, int Kw, int Pin,
     // one multiplier model
     mult_model_ = new MultModel(bit_width, tech_node, clk_freq);
     dynamic_energy_ = 0.;
+
+    // fast paths of the common kernel parallelism: 1x1 (or kernel not
+    // unrolled), 1x7/7x1, 3x3 & 5x5 unrolled
+    switch (Pk_) {
+      case 1: multiply_ = &MultArray::Multiply<1>; break;
+      case 7: multiply_ = &MultArray::Multiply<7>; break;
+      case 9: multiply_ = &MultArray::Multiply<9>; break;
+      case 25: multiply_ = &MultArray::Multiply<25>; break;
+      default: multiply_ = &MultArray::Multiply<0>; break;
+    }
 }
 
 /*
@@ -48,9 +62,14 @@ MultArray::~MultArray() {
  * Implmentation notes: MultArrayProc
  * -----------------------------------
  * The multiplier works as the multiplication of kernel and input feature map if
- * the enable signal and valid signal are asserted together.
+ * the enable signal and valid signal are asserted together. With zero gating,
+ * the multiplier of a zero operand is bypassed as the multiplier.v, which
+ * costs no dynamic energy.
  */
 void MultArray::MultArrayProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
   if (reset.read()) {
     // reset behavior, reset the output to full 0s
     for (int i = 0; i < Pout_*Pin_*Pk_; ++i) {
@@ -58,52 +77,73 @@ void MultArray::MultArrayProc() {
     }
   } else if (mult_array_en.read()) {
 #ifdef DATA_PATH
-    // only do the calculation when the valid signal is asserted
+    (this->*multiply_)();
+#else
+    // track the dynamic power consumption
     for (int o = 0; o < Pout_; ++o) {
       for (int i = 0; i < Pin_; ++i) {
         for (int k = 0; k < Pk_; ++k) {
           if (mult_array_in_valid[o*Pin_*Pk_+i*Pk_+k].read()) {
-            // increments the calculation power within the current kernel
+            // the operands are not modeled without the data path
+            ++num_ops_;
             dynamic_energy_ += mult_model_->DynamicEnergyOfOneOperation();
-            // print the log info
-            if (o == 0 && k == 0) {
-              cout << "@" << sc_time_stamp() << " MultArray received sliding "
-                "window from Pin " << i <<  ": ";
-              for (int m = 0; m < Kh_; ++m) {
-                for (int n = 0; n < Kw_; ++n) {
-                  cout << mult_array_act_in_data[i*Kh_*Kw_+m*Kw_+n].read().data
-                    << " ";
-                }
-              }
-              cout << endl;
-            }
-            // when the input valid signal is valid, do the multiplication over
-            // current kernel
-            // here there is a small mux, we are not model it explicitly
-            const Payload& feat = mult_array_act_in_data[i*Kh_*Kw_ +
-              mult_array_kernel_idx.read() + k];
-            mult_array_output_data[o*Pin_*Pk_+i*Pk_+k].write(feat *
-                mult_array_weight_in_data[o*Pin_*Pk_+i*Pk_+k].read());
-          } else {
-            // otherwise, zero the multiplication results. It occurs when the
-            // parallelism is non-divisible by the channel depth
-            mult_array_output_data[o*Pin_*Pk_+i*Pk_+k].write(Payload(0));
           }
         }
       }
     }
-#else
-    // track the dynamic power consumption
-    for (int o = 0; o < Pout_; ++o) {
-      for (int i = 0; i < Pin_; ++i) {
-        for (int k = 0; k < Pk_; ++k) {
-          if (mult_array_in_valid[o*Pin_*Pk_+i*Pk_+k].read()) {
-            dynamic_energy_ += mult_model_->DynamicEnergyOfOneOperation();
+#endif
+  }
+
+  SleepUntilEnabled(mult_array_en, reset);
+}
+
+/*
+ * Implmentation notes: Multiply
+ * ------------------------------
+ * The multiplications of the Pk kernel locations are unrolled for the kernel
+ * parallelism known at compile time. The kernel index is read once per cycle.
+ */
+template <int PK>
+void MultArray::Multiply() {
+  const int Pk = (PK > 0) ? PK : Pk_;
+  const int kernel_size = Kh_*Kw_;
+  const int kernel_idx = mult_array_kernel_idx.read();
+  for (int o = 0; o < Pout_; ++o) {
+    for (int i = 0; i < Pin_; ++i) {
+      // the Pk multipliers of the (o, i) pair & the sliding window of input i
+      const int mult_idx = (o*Pin_+i)*Pk;
+      const int act_idx = i*kernel_size + kernel_idx;
+      for (int k = 0; k < Pk; ++k) {
+        if (!mult_array_in_valid[mult_idx+k].read()) {
+          // zero the multiplication results. It occurs when the parallelism is
+          // non-divisible by the channel depth
+          mult_array_output_data[mult_idx+k].write(Payload(0));
+          continue;
+        }
+        // here there is a small mux, we are not model it explicitly
+        const Payload& feat = mult_array_act_in_data[act_idx+k].read();
+        const Payload& weight = mult_array_weight_in_data[mult_idx+k].read();
+        ++num_ops_;
+        if (zero_gating_ && (feat == Payload(0) || weight == Payload(0))) {
+          ++num_gated_ops_;
+          mult_array_output_data[mult_idx+k].write(Payload(0));
+          continue;
+        }
+        // increments the calculation power within the current kernel
+        dynamic_energy_ += mult_model_->DynamicEnergyOfOneOperation();
+        // print the log info
+        if (o == 0 && k == 0 && LOG_ENABLED(MULT_ARRAY, TRACE)) {
+          cout << "@" << sc_time_stamp() << " MultArray received sliding "
+            "window from Pin " << i <<  ": ";
+          for (int m = 0; m < kernel_size; ++m) {
+            cout << mult_array_act_in_data[i*kernel_size+m].read().value()
+              << " ";
           }
+          cout << endl;
         }
+        mult_array_output_data[mult_idx+k].write(feat * weight);
       }
     }
-#endif
   }
 }
 
@@ -0,0 +1,623 @@
+/*
+ * Filename: parallelism_allocator.cpp
+ * ------------------------------------
+ * This file implements the class ParallelismAllocator.
+ */
+
+#include "header/systemc/parallelism_allocator.hpp"
+#include "header/systemc/models/mult_model.hpp"
+#include "header/systemc/models/adder_model.hpp"
+#include "header/systemc/models/comparator_model.hpp"
+#include "header/systemc/models/memory_model.hpp"
+#include "header/systemc/models/mux_model.hpp"
+#include "header/systemc/models/demux_model.hpp"
+#include "header/caffe/layers/conv_layer.hpp"
+#include "header/caffe/layers/inner_product_layer.hpp"
+#include "header/caffe/layers/pooling_layer.hpp"
+#include "header/parallelism_solver.hpp"
+#include "header/layer_precision.hpp"
+#include <cstdlib>
+#include <cmath>
+
+using namespace std;
+using namespace config;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * Extract the dimension of the layers requiring the parallelism, i.e.
+ * Convolution, InnerProduct and Pooling. The dimension is consistent with
+ * ConvNetAcc::InitParallelism. Only the convolution reading the input layer
+ * through its line buffer (i.e. not pointwise) is spatially unrolled: its
+ * input pixels arrive from the testbench, which can inject several of them per
+ * handshake, whereas the other layers receive one pixel per handshake.
+ */
+ParallelismAllocator::ParallelismAllocator(const Net& net,
+    const ConfigParameter& config_param, int pipeline_stage, int min_out_iter,
+    bool spatial_unrolling) {
+  pipeline_stage_ = pipeline_stage;
+  min_out_iter_ = min_out_iter;
+  tech_node_ = config_param.tech_node();
+  clk_freq_ = config_param.clk_freq();
+  memory_type_ = config_param.memory_type();
+  kernel_unrolling_flag_ = config_param.kernel_unrolling_flag();
+  append_buffer_capacity_ = config_param.append_buffer_capacity();
+  input_spatial_dim_ = 0;
+  input_width_ = 1;
+  max_inference_rate_ = 0;
+  string input_blob;
+  const LayerPrecision layer_precision(net, config_param);
+
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    const Layer* layer = net.layers_[layer_id];
+    LayerDim dim;
+    dim.layer_id = layer_id;
+    dim.name = layer->layer_param().name();
+    dim.type = layer->layer_param().type();
+    dim.max_pool = false;
+    dim.global_pool = false;
+    dim.stride_w = 1;
+    dim.spatial_unrolling = false;
+    if (dim.type == "Input") {
+      // dimension: (N, C, H, W)
+      input_spatial_dim_ = net.top_blobs_shape_ptr_[layer_id][0]->at(2) *
+        net.top_blobs_shape_ptr_[layer_id][0]->at(3);
+      input_width_ = net.top_blobs_shape_ptr_[layer_id][0]->at(3);
+      input_blob = layer->layer_param().top(0);
+      continue;
+    } else if (dim.type == "Convolution") {
+      const ConvolutionLayer* conv_layer =
+        dynamic_cast<const ConvolutionLayer*>(layer);
+      dim.Nin = conv_layer->num_input_;
+      dim.Nout = conv_layer->num_output_;
+      dim.Kh = conv_layer->kh_;
+      dim.Kw = conv_layer->kw_;
+      dim.h = net.top_blobs_shape_ptr_[layer_id][0]->at(2);
+      dim.w = net.top_blobs_shape_ptr_[layer_id][0]->at(3);
+      dim.in_h = conv_layer->h_;
+      dim.in_w = conv_layer->w_;
+      dim.pad_h = conv_layer->pad_h_;
+      dim.pad_w = conv_layer->pad_w_;
+      dim.stride_w = conv_layer->stride_w_;
+      dim.spatial_unrolling = spatial_unrolling &&
+        (layer->layer_param().bottom(0) == input_blob) &&
+        !(dim.Kh == 1 && dim.Kw == 1 && dim.pad_h == 0 && dim.pad_w == 0);
+    } else if (dim.type == "InnerProduct") {
+      dim.Nin = net.bottom_blobs_shape_ptr_[layer_id][0]->at(1);
+      dim.Nout = dynamic_cast<const InnerProductLayer*>(layer)->num_output_;
+      if (net.bottom_blobs_shape_ptr_[layer_id][0]->size() == 4) {
+        dim.Kh = net.bottom_blobs_shape_ptr_[layer_id][0]->at(2);
+        dim.Kw = net.bottom_blobs_shape_ptr_[layer_id][0]->at(3);
+      } else if (net.bottom_blobs_shape_ptr_[layer_id][0]->size() == 2) {
+        dim.Kh = dim.Kw = 1;
+      } else {
+        cerr << "unexpected bottom blob dimension for FC layer" << endl;
+        exit(1);
+      }
+      dim.h = dim.w = 1;
+      // the kernel covers the entire input feature map without padding
+      dim.in_h = dim.Kh;
+      dim.in_w = dim.Kw;
+      dim.pad_h = dim.pad_w = 0;
+    } else if (dim.type == "Pooling") {
+      const PoolingLayer* pool_layer = dynamic_cast<const PoolingLayer*>(layer);
+      dim.Nin = pool_layer->num_input_;
+      dim.Nout = 0;
+      dim.Kh = pool_layer->kh_;
+      dim.Kw = pool_layer->kw_;
+      dim.h = net.top_blobs_shape_ptr_[layer_id][0]->at(2);
+      dim.w = net.top_blobs_shape_ptr_[layer_id][0]->at(3);
+      dim.max_pool = (pool_layer->pool_method_ == caffe::PoolingParameter::MAX);
+      dim.in_h = pool_layer->h_;
+      dim.in_w = pool_layer->w_;
+      dim.pad_h = pool_layer->pad_h_;
+      dim.pad_w = pool_layer->pad_w_;
+      if (pool_layer->global_pooling()) {
+        // the GlobalPoolPe folds each input pixel into the accumulators
+        // through the pixel mux (no line buffer), so its rate is counted over
+        // the input pixels
+        dim.global_pool = true;
+        dim.Kh = dim.Kw = 1;
+        dim.h = dim.in_h;
+        dim.w = dim.in_w;
+      }
+    } else {
+      // no parallelism for the remaining layers
+      continue;
+    }
+    dim.bit_width = layer_precision.LayerBitWidth(layer_id);
+    dim.out_bit_width = layer_precision.BlobBitWidth(
+        layer->layer_param().top(0));
+    if (mult_area_.find(dim.bit_width) == mult_area_.end()) {
+      mult_area_[dim.bit_width] = MultModel(dim.bit_width, tech_node_,
+          clk_freq_).Area();
+      adder_area_[dim.bit_width] = AdderModel(dim.bit_width, tech_node_,
+          clk_freq_).Area();
+      comparator_area_[dim.bit_width] = ComparatorModel(dim.bit_width,
+          tech_node_, clk_freq_).Area();
+    }
+    layers_.push_back(dim);
+  }
+
+  // dimension of the network output: (N, C, H, W) or (N, C)
+  const vector<int>* output_shape = net.top_blobs_shape_ptr_.back()[0];
+  output_spatial_dim_ = (output_shape->size() == 4) ? output_shape->at(2) *
+    output_shape->at(3) : 1;
+}
+
+/*
+ * Implementation notes: CalculateParallelsim
+ * -------------------------------------------
+ * Consistent with the original ConvNetAcc::CalculateParallelsim. For POOL, the
+ * Pin is rounded from Nin / pixel rate. For CONV & FC, the (Pin, Pout, Pk)
+ * giving the closest ceil(Nin/Pin) * ceil(Nout/Pout) * ceil(K/Pk) to the pixel
+ * rate is searched by SolveParallelism. If even one iteration per pixel misses
+ * the rate of a spatially unrolled layer, the smallest Pw reaching one
+ * iteration per pass (or else the Pw of the most iterations) is taken first,
+ * and the search runs on the iterations per pass.
+ */
+void ParallelismAllocator::CalculateParallelsim(const LayerDim& layer,
+    int layer_inference_rate, LayerAllocation* result) const {
+  // regularize the layer_inference_rate
+  if (layer_inference_rate <= 0) {
+    layer_inference_rate = 1;
+  }
+  const long int spatial_dim = static_cast<long int>(layer.h) * layer.w;
+  double pixel_inference_rate = static_cast<double>(layer_inference_rate) /
+    spatial_dim - pipeline_stage_;
+  int Pw = 1;
+  if (pixel_inference_rate < 1) {
+    for (int P = 2; P <= MaxSpatialParallelism(layer); ++P) {
+      // iterations per pass: the Pw outputs of the pass take Pw-1 more cycles
+      const double pass_inference_rate = static_cast<double>(
+          layer_inference_rate) / (layer.h * ((layer.w + P - 1) / P)) -
+        pipeline_stage_ - (P - 1);
+      if (pass_inference_rate > pixel_inference_rate) {
+        Pw = P;
+        pixel_inference_rate = pass_inference_rate;
+      }
+      if (pixel_inference_rate >= 1) {
+        break;
+      }
+    }
+  }
+  if (pixel_inference_rate <= 0) {
+    pixel_inference_rate = 1;
+  }
+
+  if (layer.Nout == 0) {
+    // POOL: pixel inference rate = Nin / Pin + pipeline_stage
+    int Pin = static_cast<int>(round(static_cast<double>(layer.Nin) /
+          pixel_inference_rate));
+    // regularize the parallelism
+    if (Pin <= 0) Pin = 1;
+    if (Pin > layer.Nin) Pin = layer.Nin;
+    result->Pin = Pin;
+    result->Pout = 0;
+    result->Pk = 0;
+    result->inference_rate = LayerRate(layer, (layer.Nin + Pin - 1) / Pin, 1);
+  } else {
+    // CONV or FC: inference rate = Nin * Nout / Pin / Pout + pipeline_stage
+    const int K = layer.Kh * layer.Kw;
+    const pair<pair<int, int>, int> parallelism = SolveParallelism(layer.Nin,
+        layer.Nout, K, kernel_unrolling_flag_, pixel_inference_rate);
+    result->Pin = parallelism.first.first;
+    result->Pout = parallelism.first.second;
+    result->Pk = parallelism.second;
+    result->inference_rate = LayerRate(layer, static_cast<long int>(
+          (layer.Nin + result->Pin - 1) / result->Pin) *
+        ((layer.Nout + result->Pout - 1) / result->Pout) *
+        ((K + result->Pk - 1) / result->Pk), Pw);
+  }
+  result->Pw = Pw;
+  result->num_mults = Pw * result->Pin * result->Pout * result->Pk;
+  result->area = LayerArea(layer, result->Pin, result->Pout, result->Pk, Pw);
+}
+
+/*
+ * Implementation notes: AllocateByRate
+ * -------------------------------------
+ * The target layer inference rate of all layers is the one of the input layer,
+ * i.e. input spatial dimension * pixel_inference_rate.
+ */
+void ParallelismAllocator::AllocateByRate(int pixel_inference_rate) {
+  const int layer_inference_rate = input_spatial_dim_ * pixel_inference_rate;
+  allocation_.clear();
+  max_inference_rate_ = 0;
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    LayerAllocation layer_allocation;
+    CalculateParallelsim(*iter, layer_inference_rate, &layer_allocation);
+    allocation_[iter->layer_id] = layer_allocation;
+    max_inference_rate_ = max(max_inference_rate_,
+        layer_allocation.inference_rate);
+  }
+}
+
+/*
+ * Implementation notes: LayerArea
+ * --------------------------------
+ * Only the parallelism dependent part is counted. For CONV & FC, it consists of
+ * Pw*Pin*Pout*Pk multipliers and adders as well as the weight memory of width
+ * Pin*Pout*Pk and depth ceil(Nin/Pin)*ceil(Nout/Pout)*ceil(K/Pk), which is
+ * shared by the Pw output columns. For POOL, it
+ * is the Pin*(K-1) comparators or adders (Pin for the global POOL). The line
+ * buffer is independent of the parallelism and thus excluded.
+ */
+double ParallelismAllocator::LayerArea(const LayerDim& layer, int Pin,
+    int Pout, int Pk, int Pw) const {
+  const double adder_area = adder_area_.find(layer.bit_width)->second;
+  if (layer.Nout == 0) {
+    const int num_units = layer.global_pool ? Pin :
+      Pin * (layer.Kh * layer.Kw - 1);
+    return num_units * (layer.max_pool ?
+        comparator_area_.find(layer.bit_width)->second : adder_area);
+  }
+  const int num_mults = Pin * Pout * Pk;
+  const int mem_depth = static_cast<int>(
+      ceil(static_cast<double>(layer.Nin)/Pin) *
+      ceil(static_cast<double>(layer.Nout)/Pout) *
+      ceil(static_cast<double>(layer.Kh*layer.Kw)/Pk));
+  MemoryModel weight_mem(num_mults * layer.bit_width, mem_depth, tech_node_,
+      memory_type_, clk_freq_);
+  return Pw * num_mults * (mult_area_.find(layer.bit_width)->second +
+      adder_area) + weight_mem.Area();
+}
+
+/*
+ * Implementation notes: LayerRate
+ * --------------------------------
+ * A pass iterates over the tiles for Pw adjacent output columns at once, then
+ * drains the pipeline and sends the Pw output pixels one per cycle. There are
+ * ceil(w/Pw) passes per output row.
+ */
+long int ParallelismAllocator::LayerRate(const LayerDim& layer, long int iter,
+    int Pw) const {
+  return (iter + pipeline_stage_ + Pw - 1) * layer.h *
+    ((layer.w + Pw - 1) / Pw);
+}
+
+/*
+ * Implementation notes: AllocateLayer
+ * ------------------------------------
+ * The layer inference rate is (ceil(Nin/Pin)*ceil(Nout/Pout)*ceil(K/Pk) +
+ * pipeline_stage) * h * w. For each distinct ceil(Nin/Pin) and ceil(Nout/Pout),
+ * the fewest multipliers are given by the largest ceil(K/Pk) meeting the rate.
+ * The area is not monotonic in Pk though, since the banking of the weight
+ * memory changes with its width & depth, so all the feasible Pk are compared
+ * under the AREA budget. A spatially unrolled layer takes the smallest Pw
+ * allowing one iteration per pass (see LayerRate). The ceil(Nout/Pout) below
+ * min_out_iter are skipped, unless Nout itself is below it.
+ */
+bool ParallelismAllocator::AllocateLayer(const LayerDim& layer,
+    long int max_rate, BudgetType budget_type, LayerAllocation* result) const {
+  // max iterations per pass within the rate (see LayerRate)
+  int Pw = 1;
+  long int max_iter = max_rate / (static_cast<long int>(layer.h) * layer.w) -
+    pipeline_stage_;
+  while (max_iter < 1 && Pw < MaxSpatialParallelism(layer)) {
+    ++Pw;
+    max_iter = max_rate / (static_cast<long int>(layer.h) *
+        ((layer.w + Pw - 1) / Pw)) - pipeline_stage_ - (Pw - 1);
+  }
+  if (max_iter < 1) {
+    return false;
+  }
+
+  if (layer.Nout == 0) {
+    // POOL: the smallest Pin such that ceil(Nin/Pin) <= max_iter
+    int Pin = static_cast<int>((layer.Nin + max_iter - 1) / max_iter);
+    if (Pin < 1) Pin = 1;
+    result->Pin = Pin;
+    result->Pout = 0;
+    result->Pk = 0;
+    result->Pw = 1;
+    result->inference_rate = LayerRate(layer, (layer.Nin + Pin - 1) / Pin, 1);
+    result->num_mults = 0;
+    result->area = LayerArea(layer, Pin, 0, 0);
+    return true;
+  }
+
+  const int K = layer.Kh * layer.Kw;
+  vector<pair<int, int> > in_candidates, out_candidates, k_candidates;
+  CeilQuotientCandidates(layer.Nin, &in_candidates);
+  CeilQuotientCandidates(layer.Nout, &out_candidates);
+  const int min_out_iter = min(min_out_iter_, layer.Nout);
+  if (kernel_unrolling_flag_) {
+    CeilQuotientCandidates(K, &k_candidates);
+  } else {
+    // Pk = Kernel size if kernel unrolling option is disabled
+    k_candidates.push_back(make_pair(1, K));
+  }
+
+  bool found = false;
+  double min_cost = 0.;
+  for (vector<pair<int, int> >::const_iterator in_iter = in_candidates.begin();
+      in_iter != in_candidates.end(); ++in_iter) {
+    if (in_iter->first > max_iter) {
+      continue;
+    }
+    for (vector<pair<int, int> >::const_iterator out_iter =
+        out_candidates.begin(); out_iter != out_candidates.end(); ++out_iter) {
+      const long int in_out_iter = static_cast<long int>(in_iter->first) *
+        out_iter->first;
+      if (out_iter->first < min_out_iter || in_out_iter > max_iter) {
+        continue;
+      }
+      // largest kernel quotient within the rate (candidates are decreasing)
+      vector<pair<int, int> >::const_iterator k_iter = k_candidates.begin();
+      while (k_iter->first > max_iter / in_out_iter) {
+        ++k_iter;
+      }
+      for (; k_iter != k_candidates.end(); ++k_iter) {
+        const int Pin = in_iter->second;
+        const int Pout = out_iter->second;
+        const int Pk = k_iter->second;
+        const double cost = (budget_type == MULTIPLIER) ?
+          static_cast<double>(Pw) * Pin * Pout * Pk :
+          LayerArea(layer, Pin, Pout, Pk, Pw);
+        if (!found || cost < min_cost) {
+          found = true;
+          min_cost = cost;
+          result->Pin = Pin;
+          result->Pout = Pout;
+          result->Pk = Pk;
+          result->inference_rate = LayerRate(layer,
+              in_out_iter * k_iter->first, Pw);
+        }
+        if (budget_type == MULTIPLIER) {
+          // the smallest feasible Pk has the fewest multipliers
+          break;
+        }
+      }
+    }
+  }
+  if (found) {
+    result->Pw = Pw;
+    result->num_mults = Pw * result->Pin * result->Pout * result->Pk;
+    result->area = LayerArea(layer, result->Pin, result->Pout, result->Pk, Pw);
+  }
+  return found;
+}
+
+double ParallelismAllocator::TotalCost(long int max_rate,
+    BudgetType budget_type) const {
+  double total_cost = 0.;
+  LayerAllocation layer_allocation;
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    if (!AllocateLayer(*iter, max_rate, budget_type, &layer_allocation)) {
+      return -1.;
+    }
+    total_cost += (budget_type == MULTIPLIER) ? layer_allocation.num_mults :
+      layer_allocation.area;
+  }
+  return total_cost;
+}
+
+/*
+ * Implementation notes: Allocate
+ * -------------------------------
+ * The cheapest cost of each layer is non-increasing with the allowed layer
+ * inference rate, so is the total cost. We therefore binary search the minimum
+ * bottleneck rate between the fully parallel design (one iteration per pass,
+ * at the best Pw) and the fully sequential design (Pin = Pout = Pk = Pw = 1)
+ * whose total cost fits in the budget.
+ */
+void ParallelismAllocator::Allocate(BudgetType budget_type, double budget) {
+  long int low = 0, high = 0;
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    const long int spatial_dim = static_cast<long int>(iter->h) * iter->w;
+    long int max_iter = iter->Nin;
+    if (iter->Nout > 0) {
+      max_iter *= iter->Nout;
+      if (kernel_unrolling_flag_) {
+        max_iter *= iter->Kh * iter->Kw;
+      }
+    }
+    long int min_rate = (1 + pipeline_stage_) * spatial_dim;
+    for (int Pw = 2; Pw <= MaxSpatialParallelism(*iter); ++Pw) {
+      min_rate = min(min_rate, LayerRate(*iter, 1, Pw));
+    }
+    low = max(low, min_rate);
+    high = max(high, (max_iter + pipeline_stage_) * spatial_dim);
+  }
+
+  const double min_cost = TotalCost(high, budget_type);
+  if (min_cost > budget) {
+    cerr << "budget " << budget << " is insufficient, at least " << min_cost
+      << " is required" << endl;
+    exit(1);
+  }
+  // invariant: cost(high) <= budget
+  while (low < high) {
+    const long int mid = low + (high - low) / 2;
+    const double cost = TotalCost(mid, budget_type);
+    if (cost >= 0 && cost <= budget) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+
+  allocation_.clear();
+  max_inference_rate_ = 0;
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    LayerAllocation layer_allocation;
+    if (!AllocateLayer(*iter, high, budget_type, &layer_allocation)) {
+      cerr << "[ERROR]: layer " << iter->name << " can NOT meet the layer "
+        << "inference rate " << high << endl;
+      exit(1);
+    }
+    allocation_[iter->layer_id] = layer_allocation;
+    max_inference_rate_ = max(max_inference_rate_,
+        layer_allocation.inference_rate);
+  }
+}
+
+void ParallelismAllocator::Summary(ostream& os) const {
+  int total_mults = 0;
+  double total_area = 0.;
+  os << "################################" << endl;
+  os << "# Parallelism allocation " << endl;
+  os << "################################" << endl;
+  os << "layer\ttype\tNin\tNout\tKh\tKw\th\tw\tPin\tPout\tPk\tPw\t"
+    << "mults\tarea[um2]\trate" << endl;
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    map<int, LayerAllocation>::const_iterator allocation_iter =
+      allocation_.find(iter->layer_id);
+    if (allocation_iter == allocation_.end()) {
+      continue;
+    }
+    const LayerAllocation& layer_allocation = allocation_iter->second;
+    os << iter->name << "\t" << iter->type << "\t" << iter->Nin << "\t"
+      << iter->Nout << "\t" << iter->Kh << "\t" << iter->Kw << "\t"
+      << iter->h << "\t" << iter->w << "\t" << layer_allocation.Pin << "\t"
+      << layer_allocation.Pout << "\t" << layer_allocation.Pk << "\t"
+      << layer_allocation.Pw << "\t" << layer_allocation.num_mults << "\t"
+      << layer_allocation.area << "\t" << layer_allocation.inference_rate
+      << endl;
+    total_mults += layer_allocation.num_mults;
+    total_area += layer_allocation.area;
+  }
+  os << "Total multipliers: " << total_mults << endl;
+  os << "Total parallelism dependent area [um2]: " << total_area << endl;
+  os << "Max layer inference rate: " << max_inference_rate_ << endl;
+}
+
+/*
+ * Implementation notes: LayerMetric
+ * ----------------------------------
+ * Mirror the submodules instantiated by ConvNetAcc for one layer:
+ *  - line buffer array: RAM of width Nin*(Kh-1)*bit_width and depth W-Kw,
+ *    where W is the padded input width; a spatially unrolled layer writes G
+ *    pixels per RAM word, i.e. G times the width and 1/G of the depth
+ *  - line buffer mux: Pin muxes of ceil(Nin/Pin) inputs per output column
+ *  - weight memory, multiplier & adder array (CONV & FC), where the weights
+ *    are shared by the Pw output columns
+ *  - pool array of Pin*(K-1) comparators or adders (POOL), or Pin of them
+ *    with the accumulator memory of ceil(Nin/Pin) words (global POOL)
+ *  - demux output register: Pout demuxes of ceil(Nout/Pout) outputs per output
+ *    column
+ *  - appended channel buffer: RAM of width Nout*out_bit_width (requantized to
+ *    the next layers) and depth of the append buffer capacity
+ * Each of them is at the bit width of the layer.
+ */
+double ParallelismAllocator::LayerMetric(const LayerDim& layer,
+    const LayerAllocation& allocation, bool area) const {
+  const int K = layer.Kh * layer.Kw;
+  const int padded_w = layer.in_w + 2 * layer.pad_w;
+  const bool pool = (layer.Nout == 0);
+  const int Nout = pool ? layer.Nin : layer.Nout;
+  const int Pout = pool ? allocation.Pin : allocation.Pout;
+  // input pixels per line buffer write, consistent with LineBufferArray
+  const int pixels = (allocation.Pw > 1) ? allocation.Pw * layer.stride_w : 1;
+  double metric = 0.;
+
+  // line buffer array
+  const int line_buffer_depth = (layer.Kh-1 <= 0 || padded_w-layer.Kw <= 0) ?
+    0 : padded_w - layer.Kw;
+  MemoryModel line_buffer(pixels * layer.Nin * (layer.Kh-1) * layer.bit_width,
+      (line_buffer_depth + pixels - 1) / pixels, tech_node_,
+      ConfigParameter_MemoryType_RAM, clk_freq_);
+  metric += area ? line_buffer.Area() : line_buffer.StaticPower();
+  // line buffer mux
+  MuxModel mux(K * layer.bit_width, static_cast<int>(ceil(
+          static_cast<double>(layer.Nin) / allocation.Pin)), tech_node_,
+      clk_freq_);
+  metric += allocation.Pw * allocation.Pin * (area ? mux.Area() :
+      mux.StaticPower());
+
+  if (pool) {
+    // pool array
+    const int num_units = layer.global_pool ? allocation.Pin :
+      allocation.Pin * (K - 1);
+    // the AVG accumulators of the global pooling hold the sum of the frame
+    const int acc_bit_width = (layer.global_pool && !layer.max_pool) ?
+      layer.bit_width + static_cast<int>(ceil(log2(static_cast<double>(
+                layer.in_h * layer.in_w)))) : layer.bit_width;
+    if (layer.max_pool) {
+      ComparatorModel comparator(layer.bit_width, tech_node_, clk_freq_);
+      metric += num_units * (area ? comparator.Area() :
+          comparator.StaticPower());
+    } else {
+      AdderModel adder(acc_bit_width, tech_node_, clk_freq_);
+      metric += num_units * (area ? adder.Area() : adder.StaticPower());
+    }
+    if (layer.global_pool) {
+      // accumulator memory: ceil(Nin/Pin) tiles of Pin accumulators
+      MemoryModel acc_mem(allocation.Pin * acc_bit_width, static_cast<int>(
+            ceil(static_cast<double>(layer.Nin) / allocation.Pin)),
+          tech_node_, ConfigParameter_MemoryType_RAM, clk_freq_);
+      metric += area ? acc_mem.Area() : acc_mem.StaticPower();
+    }
+  } else {
+    // weight memory, multiplier array & adder array
+    const int mem_depth = static_cast<int>(
+        ceil(static_cast<double>(layer.Nin)/allocation.Pin) *
+        ceil(static_cast<double>(layer.Nout)/allocation.Pout) *
+        ceil(static_cast<double>(K)/allocation.Pk));
+    MemoryModel weight_mem(allocation.Pin * allocation.Pout * allocation.Pk *
+        layer.bit_width, mem_depth, tech_node_, memory_type_, clk_freq_);
+    MultModel mult(layer.bit_width, tech_node_, clk_freq_);
+    AdderModel adder(layer.bit_width, tech_node_, clk_freq_);
+    metric += area ? weight_mem.Area() : weight_mem.StaticPower();
+    metric += allocation.num_mults * (area ? mult.Area() + adder.Area() :
+        mult.StaticPower() + adder.StaticPower());
+  }
+
+  // demux output register
+  DemuxModel demux(layer.bit_width, static_cast<int>(ceil(
+          static_cast<double>(Nout) / Pout)), tech_node_, clk_freq_);
+  metric += allocation.Pw * Pout * (area ? demux.Area() :
+      demux.StaticPower());
+  // appended channel buffer
+  MemoryModel channel_buffer(Nout * layer.out_bit_width,
+      append_buffer_capacity_, tech_node_, ConfigParameter_MemoryType_RAM,
+      clk_freq_);
+  metric += area ? channel_buffer.Area() : channel_buffer.StaticPower();
+
+  return metric;
+}
+
+int ParallelismAllocator::InputPixels() const {
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    map<int, LayerAllocation>::const_iterator allocation_iter =
+      allocation_.find(iter->layer_id);
+    if (iter->spatial_unrolling && allocation_iter != allocation_.end() &&
+        allocation_iter->second.Pw > 1) {
+      return allocation_iter->second.Pw * iter->stride_w;
+    }
+  }
+  return 1;
+}
+
+double ParallelismAllocator::Area() const {
+  double total_area = 0.;
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    map<int, LayerAllocation>::const_iterator allocation_iter =
+      allocation_.find(iter->layer_id);
+    if (allocation_iter != allocation_.end()) {
+      total_area += LayerMetric(*iter, allocation_iter->second, true);
+    }
+  }
+  return total_area;
+}
+
+double ParallelismAllocator::StaticPower() const {
+  double total_power = 0.;
+  for (vector<LayerDim>::const_iterator iter = layers_.begin();
+      iter != layers_.end(); ++iter) {
+    map<int, LayerAllocation>::const_iterator allocation_iter =
+      allocation_.find(iter->layer_id);
+    if (allocation_iter != allocation_.end()) {
+      total_power += LayerMetric(*iter, allocation_iter->second, false);
+    }
+  }
+  return total_power;
+}
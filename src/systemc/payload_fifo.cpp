@@ -0,0 +1,62 @@
+/*
+ * Filename: payload_fifo.cpp
+ * ---------------------------
+ * This file implements the class PayloadFifo.
+ */
+
+#include "header/systemc/payload_fifo.hpp"
+#include <algorithm>
+#include <cassert>
+#include <limits.h>
+using namespace std;
+
+PayloadFifo::PayloadFifo(int width, int capacity) : width_(width),
+  capacity_(capacity), head_(0), size_(0) {
+  num_slots_ = (capacity == INT_MAX) ? INIT_SLOTS : max(capacity, 0);
+  ring_.resize(static_cast<long int>(num_slots_)*width_);
+}
+
+void PayloadFifo::Push(const Payload* pixel) {
+  assert(size_ < capacity_);
+  if (size_ == num_slots_) {
+    Grow();
+  }
+  int slot = head_ + size_;
+  if (slot >= num_slots_) {
+    slot -= num_slots_;
+  }
+  copy(pixel, pixel+width_, ring_.begin() + static_cast<long int>(slot)*width_);
+  ++size_;
+}
+
+void PayloadFifo::Front(PayloadBus* pixel) const {
+  assert(size_ > 0 && pixel->width() == width_);
+  const Payload* front = At(0);
+  copy(front, front+width_, pixel->data.begin());
+}
+
+void PayloadFifo::Pop() {
+  assert(size_ > 0);
+  if (++head_ == num_slots_) {
+    head_ = 0;
+  }
+  --size_;
+}
+
+/*
+ * Implementation notes: Grow
+ * ---------------------------
+ * The pixels are unwrapped to the front of the doubled ring, so the push is
+ * amortized constant time.
+ */
+void PayloadFifo::Grow() {
+  const int num_slots = max(2*num_slots_, static_cast<int>(INIT_SLOTS));
+  vector<Payload> ring(static_cast<long int>(num_slots)*width_);
+  for (int i = 0; i < size_; ++i) {
+    const Payload* pixel = At(i);
+    copy(pixel, pixel+width_, ring.begin() + static_cast<long int>(i)*width_);
+  }
+  ring_.swap(ring);
+  num_slots_ = num_slots;
+  head_ = 0;
+}
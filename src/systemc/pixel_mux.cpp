@@ -0,0 +1,106 @@
+/*
+ * Filename: pixel_mux.cpp
+ * ------------------------
+ * This file implements the class PixelMux.
+ */
+
+#include "header/systemc/pixel_mux.hpp"
+#include "header/systemc/event_gating.hpp"
+using namespace std;
+
+PixelMux::PixelMux(sc_module_name module_name, int Nin, int Pin,
+    int bit_width, int tech_node, double clk_freq) :
+  sc_module(module_name), Nin_(Nin), Pin_(Pin), pixel_(Nin) {
+  // output data to Pin multiplier array
+  mux_data_out = new sc_out<Payload>[Pin_];
+
+  // PixelMux: synchronous with clock and reset
+  SC_METHOD(PixelMuxProc);
+  sensitive << clock.pos() << reset;
+
+  // same mux model as the LineBufferMux of the 1x1 kernel
+  const int num_inputs = static_cast<int>(ceil(static_cast<double>(Nin)/Pin));
+  mux_model_ = new MuxModel(bit_width, num_inputs, tech_node, clk_freq);
+  dynamic_energy_ = 0.;
+}
+
+PixelMux::~PixelMux() {
+  delete [] mux_data_out;
+  delete mux_model_;
+}
+
+/*
+ * Implementation notes: PixelMuxProc
+ * -----------------------------------
+ * The process sleeps until the pixel is loaded or the mux is enabled. Both
+ * rise in a delta cycle after the clock edge, so the woken process only waits
+ * for the next clock edge to sample them.
+ */
+void PixelMux::PixelMuxProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
+  if (reset.read()) {
+    // reset, simply output full 0s
+    for (int i = 0; i < Pin_; ++i) {
+      mux_data_out[i].write(Payload(0));
+    }
+  } else if (pixel_load.read()) {
+    // the first input tile is selected from the input pixel
+    const int active_mux_num = min(Pin_, Nin_);
+    dynamic_energy_ += active_mux_num *
+      mux_model_->DynamicEnergyOfOneOperation();
+#ifdef DATA_PATH
+    const PayloadBus& pixel = pixel_data.read();
+    assert(pixel.width() == Nin_);
+    pixel_.assign(pixel.data.begin(), pixel.data.end());
+    SelectTile(pixel_, 0);
+#endif
+  } else if (mux_en.read()) {
+    // for a specified select i, the input range covers [i*Pin, (i+1)*Pin-1]
+    const int active_mux_num = (Nin_ - (mux_select.read()+1) * Pin_) >= 0
+      ? Pin_ : Nin_ - mux_select.read() * Pin_;
+    dynamic_energy_ += active_mux_num *
+      mux_model_->DynamicEnergyOfOneOperation();
+#ifdef DATA_PATH
+    SelectTile(pixel_, mux_select.read());
+#endif
+  }
+
+  if (!pixel_load.read() && !mux_en.read()) {
+    next_trigger(pixel_load.posedge_event() | mux_en.posedge_event() |
+        reset.value_changed_event());
+  }
+}
+
+void PixelMux::SelectTile(const vector<Payload>& pixel, int select) {
+  for (int i = 0; i < Pin_; ++i) {
+    const int channel = select*Pin_ + i;
+    if (channel < Nin_) {
+      mux_data_out[i].write(pixel[channel]);
+    } else {
+      // out-of range due to non-integer case
+      mux_data_out[i].write(Payload(0));
+    }
+  }
+}
+
+double PixelMux::Area() const {
+  return Pin_ * mux_model_->Area();
+}
+
+double PixelMux::StaticPower() const {
+  return Pin_ * mux_model_->StaticPower();
+}
+
+double PixelMux::DynamicPower() const {
+  sc_time clock_period = dynamic_cast<const sc_clock*>(clock.get_interface())->
+    period();
+  sc_time sim_time = sc_time_stamp();
+  double total_cycles = sim_time / clock_period;
+  return dynamic_energy_ / total_cycles;
+}
+
+double PixelMux::TotalPower() const {
+  return StaticPower() + DynamicPower();
+}
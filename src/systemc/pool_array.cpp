@@ -6,6 +6,8 @@
  */
 
 #include "header/systemc/pool_array.hpp"
+#include "header/systemc/event_gating.hpp"
+#include "header/logger.hpp"
 using namespace std;
 
 /*
@@ -60,6 +62,9 @@ PoolArray::~PoolArray() {
 }
 
 void PoolArray::PoolArrayProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
   if (reset.read()) {
     for (int i = 0; i < Pin_; ++i) {
       pool_array_out_data[i].write(Payload(0));
@@ -71,14 +76,17 @@ void PoolArray::PoolArrayProc() {
     for (int i = 0; i < Pin_; ++i) {
       if (pool_array_in_valid[i].read()) {
         // print the log info
-        cout << "@" << sc_time_stamp() << " PoolArray received sliding window"
-          " from Pin " << i << ": ";
-        for (int m = 0; m < Kh_; ++m) {
-          for (int n = 0; n < Kw_; ++n) {
-            cout << pool_array_in_data[i*Kh_*Kw_+m*Kw_+n].read().data << " ";
+        if (LOG_ENABLED(POOL_ARRAY, TRACE)) {
+          cout << "@" << sc_time_stamp() << " PoolArray received sliding "
+            "window from Pin " << i << ": ";
+          for (int m = 0; m < Kh_; ++m) {
+            for (int n = 0; n < Kw_; ++n) {
+              cout << pool_array_in_data[i*Kh_*Kw_+m*Kw_+n].read().value()
+                << " ";
+            }
           }
+          cout << endl;
         }
-        cout << endl;
 
         // do the real computation
         Payload result(0);
@@ -141,6 +149,8 @@ void PoolArray::PoolArrayProc() {
     }
 #endif
   }
+
+  SleepUntilEnabled(pool_array_en, reset);
 }
 
 /*
@@ -23,6 +23,9 @@ PoolLayerCtrl::PoolLayerCtrl(sc_module_name module_name, int Kh, int Kw, int h,
   Stride_h_ = Stride_h;
   Stride_w_ = Stride_w;
   extra_pipeline_stage_ = extra_pipeline_stage;
+  // start from the first pixel unless restored from the checkpoint
+  feat_pixel_counter_ = reset_feat_pixel_counter_ = 0;
+  waiting_input_ = false;
 
   // allocate the ports
   pool_array_in_valid = new sc_out<bool> [Pin_];
@@ -45,6 +48,22 @@ PoolLayerCtrl::~PoolLayerCtrl() {
   delete [] pool_array_in_valid;
 }
 
+// the controller is drained when saved, so only the counter is kept
+void PoolLayerCtrl::SaveState(Checkpoint* checkpoint) const {
+  checkpoint->Write(name(), feat_pixel_counter_);
+}
+
+void PoolLayerCtrl::RestoreState(Checkpoint* checkpoint) {
+  checkpoint->Read(name(), &reset_feat_pixel_counter_);
+  const int feat_pixels = (h_+2*Pad_h_) * (w_+2*Pad_w_);
+  if (reset_feat_pixel_counter_ < 0 ||
+      reset_feat_pixel_counter_ > feat_pixels) {
+    cerr << "[ERROR]: checkpoint of " << name() << " does not match the "
+      "feature map size" << endl;
+    exit(1);
+  }
+}
+
 void PoolLayerCtrl::LineBufferValid() {
   if (line_buffer_zero_in) {
     line_buffer_valid.write(1);
@@ -73,72 +92,75 @@ void PoolLayerCtrl::PoolLayerCtrlProc() {
   // total feature map pixels
   const int feat_pixels = (h_ + 2*Pad_h_) * (w_ + 2*Pad_w_);
   // feature map received counter
-  int feat_pixel_counter = 0;
+  feat_pixel_counter_ = reset_feat_pixel_counter_;
+  waiting_input_ = false;
 
   wait();
 
   while (true) {
-    // reset feat_pixel_counter
-    if (feat_pixel_counter == feat_pixels) {
-      feat_pixel_counter = 0;
+    // reset feat_pixel_counter_
+    if (feat_pixel_counter_ == feat_pixels) {
+      feat_pixel_counter_ = 0;
     }
 
     // pad zero or receive the data from primary input
-    if (feat_pixel_counter < Pad_h_*(w_+2*Pad_w_)) {
+    if (feat_pixel_counter_ < Pad_h_*(w_+2*Pad_w_)) {
       // padding leading zeros: first Pad_h rows
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
-    else if (feat_pixel_counter % (w_+2*Pad_w_) >= 0 &&
-        feat_pixel_counter % (w_+2*Pad_w_) < Pad_w_) {
+    else if (feat_pixel_counter_ % (w_+2*Pad_w_) >= 0 &&
+        feat_pixel_counter_ % (w_+2*Pad_w_) < Pad_w_) {
       // padding leading zeros: first Pad_w 0s
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
-    else if (feat_pixel_counter % (w_+2*Pad_w_) >= w_+Pad_w_) {
+    else if (feat_pixel_counter_ % (w_+2*Pad_w_) >= w_+Pad_w_) {
       // padding tailing zeros: last Pad_w 0s
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
-    else if (feat_pixel_counter >= (w_+2*Pad_w_)*(h_+Pad_h_) &&
-        feat_pixel_counter < feat_pixels) {
+    else if (feat_pixel_counter_ >= (w_+2*Pad_w_)*(h_+Pad_h_) &&
+        feat_pixel_counter_ < feat_pixels) {
       // padding tailing zeros: last Pad_h rows 0s
       line_buffer_zero_in.write(1);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
       wait();
       line_buffer_zero_in.write(0);
     }
     else {
       // accept data from the previous layer
       prev_layer_rdy.write(1);
+      waiting_input_ = true;
       do {
         wait();
       } while (!prev_layer_valid.read());
+      waiting_input_ = false;
       // deassert the ready
       prev_layer_rdy.write(0);
-      ++feat_pixel_counter;
+      ++feat_pixel_counter_;
     }
 
     // warm up cycles
-    if (feat_pixel_counter < warm_up_cycles) {
+    if (feat_pixel_counter_ < warm_up_cycles) {
       continue;
     }
 
     // go across the row of feature map
-    if (feat_pixel_counter % (w_+2*Pad_w_) < Kw_ &&
-        feat_pixel_counter % (w_+2*Pad_w_) > 0) {
+    if (feat_pixel_counter_ % (w_+2*Pad_w_) < Kw_ &&
+        feat_pixel_counter_ % (w_+2*Pad_w_) > 0) {
       continue;
     }
 
     // stride bypass
-    const int row_idx = 1 + (feat_pixel_counter-1) % (w_+2*Pad_w_);
-    const int col_idx = 1 + (feat_pixel_counter-1) / (w_+2*Pad_w_);
+    const int row_idx = 1 + (feat_pixel_counter_-1) % (w_+2*Pad_w_);
+    const int col_idx = 1 + (feat_pixel_counter_-1) / (w_+2*Pad_w_);
     if ((row_idx-Kw_) % Stride_w_ != 0 || (col_idx-Kh_) % Stride_h_ != 0) {
       continue;
     }
@@ -17,18 +17,18 @@ PoolLayerPe::PoolLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
     int w, int Nin, int Pin, int Pad_h, int Pad_w, int Stride_h, int Stride_w,
     PoolArray::PoolMethod pool_method, int bit_width, int tech_node,
     double clk_freq)
-  : sc_module(module_name), Nin_(Nin), Pin_(Pin) {
+  : sc_module(module_name), Nin_(Nin), Pin_(Pin), next_data_(Nin),
+  zero_data_(Nin) {
   // pooling layer: same input & output channel depth / parallelism
   const int Nout = Nin;
   const int Pout = Pin;
-  // allocate the ports and interconnections
-  prev_layer_data = new sc_in<Payload> [Nin];
-  next_layer_data = new sc_out<Payload> [Nout];
-  line_buffer_in_data_ = new sc_signal<Payload> [Nin];
+  // allocate the interconnections
+  line_buffer_in_data_ = new PayloadBusSignal(Nin);
   line_buffer_out_data_ = new sc_signal<Payload> [Nin*Kh*Kw];
   line_buffer_mux_out_data_ = new sc_signal<Payload> [Pin*Kh*Kw];
   pool_array_in_valid_ = new sc_signal<bool> [Pin];
   pool_array_out_data_ = new sc_signal<Payload> [Pout];
+  out_reg_data_ = new sc_signal<Payload> [Nout];
 
   char name[100];
   // initialize the FSM controller
@@ -59,9 +59,9 @@ PoolLayerPe::PoolLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
   line_buffer_array_->clock(clock);
   line_buffer_array_->reset(reset);
   line_buffer_array_->input_data_valid(line_buffer_valid_);
-  for (int i = 0; i < Nin; ++i) {
-    line_buffer_array_->input_data[i](line_buffer_in_data_[i]);
-  }
+  line_buffer_array_->input_data(*line_buffer_in_data_);
+  line_buffer_array_->input_pixel_num(line_buffer_pixel_num_);
+  line_buffer_array_->output_window_offset(line_buffer_window_offset_);
   for (int i = 0; i < Nin*Kh*Kw; ++i) {
     line_buffer_array_->output_data[i](line_buffer_out_data_[i]);
   }
@@ -111,35 +111,42 @@ PoolLayerPe::PoolLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
     demux_out_reg_->in_data[i](pool_array_out_data_[i]);
   }
   for (int i = 0; i < Nout; ++i) {
-    demux_out_reg_->out_data[i](next_layer_data[i]);
+    demux_out_reg_->out_data[i](out_reg_data_[i]);
+  }
+
+  // connect output register to the interface
+  SC_METHOD(NextLayerDataConnect);
+  for (int i = 0; i < Nout; ++i) {
+    sensitive << out_reg_data_[i];
   }
 
   // process dealing with line buffer zero padding
   SC_METHOD(LineBufferInMux);
-  sensitive << line_buffer_zero_in_;
-  for (int i = 0; i < Nin; ++i) {
-    sensitive << prev_layer_data[i];
-  }
+  sensitive << line_buffer_zero_in_ << prev_layer_data;
 }
 
 void PoolLayerPe::LineBufferInMux() {
+  if (line_buffer_zero_in_.read()) {
+    line_buffer_in_data_->write(zero_data_);
+  } else {
+    line_buffer_in_data_->write(prev_layer_data.read());
+  }
+}
+
+void PoolLayerPe::NextLayerDataConnect() {
   for (int i = 0; i < Nin_; ++i) {
-    if (line_buffer_zero_in_.read()) {
-      line_buffer_in_data_[i] = Payload(0);
-    } else {
-      line_buffer_in_data_[i] = prev_layer_data[i];
-    }
+    next_data_[i] = out_reg_data_[i].read();
   }
+  next_layer_data.write(next_data_);
 }
 
 PoolLayerPe::~PoolLayerPe() {
-  delete [] prev_layer_data;
-  delete [] next_layer_data;
-  delete [] line_buffer_in_data_;
+  delete line_buffer_in_data_;
   delete [] line_buffer_out_data_;
   delete [] line_buffer_mux_out_data_;
   delete [] pool_array_in_valid_;
   delete [] pool_array_out_data_;
+  delete [] out_reg_data_;
 
   delete pool_layer_ctrl_;
   delete line_buffer_array_;
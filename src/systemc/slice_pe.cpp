@@ -0,0 +1,101 @@
+/*
+ * Filename: slice_pe.cpp
+ * -----------------------
+ * This file implements the class SlicePe.
+ */
+
+#include "header/systemc/slice_pe.hpp"
+using namespace std;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The constructor allocates the ports of the block & the data of each slice.
+ */
+SlicePe::SlicePe(sc_module_name module_name, int Nin, const vector<int>& Nout)
+  : sc_module(module_name), Nin_(Nin), numSlices_(Nout.size()) {
+  // sanity check
+  assert(numSlices_ > 1);
+  int total_channels = 0;
+  for (int i = 0; i < numSlices_; ++i) {
+    slice_data_.push_back(PayloadBus(Nout[i]));
+    total_channels += Nout[i];
+  }
+  assert(total_channels == Nin_);
+  // allocate the ports
+  next_layer_rdy = new sc_in<bool> [numSlices_];
+  next_layer_valid = new sc_out<bool> [numSlices_];
+  next_layer_data = new sc_out<PayloadBus> [numSlices_];
+
+  // data path: slice the previous layer data
+  SC_METHOD(SlicePeNextData);
+  sensitive << prev_layer_data;
+
+  // ready path: AND of next ready signals
+  SC_METHOD(SlicePePrevRdy);
+  for (int i = 0; i < numSlices_; ++i) {
+    sensitive << next_layer_rdy[i];
+  }
+
+  // valid path: transmit the previous valid iff all next layers are ready
+  SC_METHOD(SlicePeNextValid);
+  sensitive << prev_layer_valid;
+  for (int i = 0; i < numSlices_; ++i) {
+    sensitive << next_layer_rdy[i];
+  }
+}
+
+SlicePe::~SlicePe() {
+  delete [] next_layer_rdy;
+  delete [] next_layer_valid;
+  delete [] next_layer_data;
+}
+
+/*
+ * Implementation notes: SlicePeNextData
+ * --------------------------------------
+ * The ith next layer data is the ith channel range of the previous layer data,
+ * in the order of the top blobs.
+ */
+void SlicePe::SlicePeNextData() {
+  const PayloadBus& prev_data = prev_layer_data.read();
+  int cur_data_blob_idx = 0;
+  for (int i = 0; i < numSlices_; ++i) {
+    PayloadBus& slice = slice_data_[i];
+    for (int j = 0; j < slice.width(); ++j) {
+      slice[j] = prev_data[cur_data_blob_idx+j];
+    }
+    cur_data_blob_idx += slice.width();
+    next_layer_data[i].write(slice);
+  }
+}
+
+/*
+ * Implementation notes: SlicePePrevRdy
+ * -------------------------------------
+ * AND all the next layer ready signals, as the slices are of the same pixel.
+ */
+void SlicePe::SlicePePrevRdy() {
+  prev_layer_rdy.write(NextLayerAllReady());
+}
+
+/*
+ * Implementation notes: SlicePeNextValid
+ * ---------------------------------------
+ * Only bypass the previous valid when all the following layers are ready.
+ */
+void SlicePe::SlicePeNextValid() {
+  const bool valid = prev_layer_valid.read() && NextLayerAllReady();
+  for (int i = 0; i < numSlices_; ++i) {
+    next_layer_valid[i].write(valid);
+  }
+}
+
+bool SlicePe::NextLayerAllReady() const {
+  for (int i = 0; i < numSlices_; ++i) {
+    if (!next_layer_rdy[i].read()) {
+      return false;
+    }
+  }
+  return true;
+}
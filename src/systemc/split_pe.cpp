@@ -17,17 +17,14 @@ SplitPe::SplitPe(sc_module_name module_name, int Nin, int numSplits):
   // sanity check
   assert(numSplits > 1);
   // allocate the ports
-  prev_layer_data = new sc_in<Payload> [Nin_];
   next_layer_rdy = new sc_in<bool> [numSplits_];
   next_layer_valid = new sc_out<bool> [numSplits_];
-  next_layer_data = new sc_out<Payload> [numSplits_*Nin_];
+  next_layer_data = new sc_out<PayloadBus> [numSplits_];
 
   // the main process of the split process
   // data path: bypass the previous layer
   SC_METHOD(SplitPeNextData);
-  for (int i = 0; i < Nin_; ++i) {
-    sensitive << prev_layer_data[i];
-  }
+  sensitive << prev_layer_data;
 
   // ready path: AND of next ready signals
   SC_METHOD(SplitPePrevRdy);
@@ -44,7 +41,6 @@ SplitPe::SplitPe(sc_module_name module_name, int Nin, int numSplits):
 }
 
 SplitPe::~SplitPe() {
-  delete [] prev_layer_data;
   delete [] next_layer_rdy;
   delete [] next_layer_valid;
   delete [] next_layer_data;
@@ -57,9 +53,7 @@ SplitPe::~SplitPe() {
  */
 void SplitPe::SplitPeNextData() {
   for (int i = 0; i < numSplits_; ++i) {
-    for (int j = 0; j < Nin_; ++j) {
-      next_layer_data[i*Nin_+j].write(prev_layer_data[i].read());
-    }
+    next_layer_data[i].write(prev_layer_data.read());
   }
 }
 
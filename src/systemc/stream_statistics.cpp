@@ -0,0 +1,159 @@
+/*
+ * Filename: stream_statistics.cpp
+ * --------------------------------
+ * This file implements the class StreamStatistics.
+ */
+
+#include "header/systemc/stream_statistics.hpp"
+#include <algorithm>
+#include <cmath>
+using namespace std;
+
+StreamStatistics::StreamStatistics(int input_frame_pixels,
+    int output_frame_pixels) : input_frame_pixels_(input_frame_pixels),
+  output_frame_pixels_(output_frame_pixels), num_injections_(0),
+  num_output_pixels_(0), completed_frames_(0), injection_offset_(0),
+  output_offset_(0), untracked_frames_(0) {
+}
+
+void StreamStatistics::Resume(long int injected_pixels,
+    long int output_pixels) {
+  injection_offset_ = injected_pixels;
+  output_offset_ = output_pixels;
+  // the started frames that are not completed yet
+  untracked_frames_ = (injected_pixels+input_frame_pixels_-1) /
+    input_frame_pixels_ - output_pixels / output_frame_pixels_;
+}
+
+void StreamStatistics::RecordInjection(const sc_time& time) {
+  if (num_injections_ == 0) {
+    first_injection_ = time;
+  } else {
+    const sc_time interval = time - last_injection_;
+    if (num_injections_ == 1 || interval < min_interval_) {
+      min_interval_ = interval;
+    }
+    if (num_injections_ == 1 || interval > max_interval_) {
+      max_interval_ = interval;
+    }
+  }
+  // the first pixel of a frame
+  if ((injection_offset_+num_injections_) % input_frame_pixels_ == 0) {
+    frame_start_.push_back(time);
+  }
+  last_injection_ = time;
+  ++num_injections_;
+}
+
+/*
+ * Implementation notes: RecordOutput
+ * -----------------------------------
+ * The pipeline is in order, so the frames are output in the injection order:
+ * the last output pixel of a frame completes the oldest frame in flight. The
+ * latency bin keeps the PRECISION_BITS most significant bits, i.e. the latency
+ * is rounded down by less than 2^-(PRECISION_BITS-1) of itself.
+ */
+void StreamStatistics::RecordOutput(const sc_time& time) {
+  ++num_output_pixels_;
+  if (stream_output_pixels() % output_frame_pixels_ != 0) {
+    return;
+  }
+  if (untracked_frames_ > 0) {
+    --untracked_frames_;
+    return;
+  }
+  if (frame_start_.empty()) {
+    return;
+  }
+  const sc_time latency = time - frame_start_.front();
+  frame_start_.pop_front();
+
+  sc_dt::uint64 bin = latency.value();
+  int shift = 0;
+  while ((bin >> shift) >= (static_cast<sc_dt::uint64>(1) << PRECISION_BITS)) {
+    ++shift;
+  }
+  bin = (bin >> shift) << shift;
+  ++latency_histogram_[bin];
+
+  if (completed_frames_ == 0 || latency < min_latency_) {
+    min_latency_ = latency;
+  }
+  if (completed_frames_ == 0 || latency > max_latency_) {
+    max_latency_ = latency;
+  }
+  total_latency_ += latency;
+  ++completed_frames_;
+}
+
+sc_dt::uint64 StreamStatistics::LatencyPercentile(double p) const {
+  // nearest rank of the pth percentile
+  long int rank = static_cast<long int>(ceil(p / 100. * completed_frames_));
+  if (rank < 1) rank = 1;
+  long int count = 0;
+  for (map<sc_dt::uint64, long int>::const_iterator iter =
+      latency_histogram_.begin(); iter != latency_histogram_.end(); ++iter) {
+    count += iter->second;
+    if (count >= rank) {
+      // the bin can not exceed the exact bounds
+      return max(iter->first, min_latency_.value());
+    }
+  }
+  return max_latency_.value();
+}
+
+void StreamStatistics::Report(const sc_time& clock_period,
+    const sc_time& start_of_frame, const sc_time& end_of_frame,
+    int frame_pixels, ostream& os) const {
+  os << "#############################" << endl;
+  os << "# Statistics of ConvNet Asic " << endl;
+  os << "#############################" << endl;
+  if (num_injections_ < 2) {
+    os << "INFO: Not enough simulation time" << endl;
+    return;
+  }
+  // Avg interval: throughput
+  const sc_time avg_interval = AvgInterval(start_of_frame, end_of_frame,
+      frame_pixels);
+  os << "# Total injection pixels no.: " << num_injections_ << endl;
+  os << "# Min injection interval [cycles]: " << min_interval_ / clock_period
+    << endl;
+  os << "# Max injection interval [cycles]: " << max_interval_ / clock_period
+    << endl;
+  os << "# Avg injection interval (throughput) [cycles]: " << avg_interval /
+    clock_period << endl;
+
+  // frame latency
+  os << "# Completed frames no.: " << completed_frames_ << endl;
+  if (completed_frames_ == 0) {
+    return;
+  }
+  const double period = static_cast<double>(clock_period.value());
+  os << "# Frame latency p50 [cycles]: " << LatencyPercentile(50) / period
+    << endl;
+  os << "# Frame latency p95 [cycles]: " << LatencyPercentile(95) / period
+    << endl;
+  os << "# Frame latency p99 [cycles]: " << LatencyPercentile(99) / period
+    << endl;
+  os << "# Min frame latency [cycles]: " << min_latency_ / clock_period << endl;
+  os << "# Max frame latency [cycles]: " << max_latency_ / clock_period << endl;
+  os << "# Avg frame latency [cycles]: " << AvgLatency() / clock_period
+    << endl;
+}
+
+sc_time StreamStatistics::AvgInterval(const sc_time& start_of_frame,
+    const sc_time& end_of_frame, int frame_pixels) const {
+  if (start_of_frame.to_double() != 0 && end_of_frame.to_double() != 0) {
+    return (end_of_frame - start_of_frame) / (frame_pixels-1);
+  } else if (num_injections_ < 2) {
+    return SC_ZERO_TIME;
+  }
+  return (last_injection_ - first_injection_) / (num_injections_ - 1);
+}
+
+sc_time StreamStatistics::AvgLatency() const {
+  if (completed_frames_ == 0) {
+    return SC_ZERO_TIME;
+  }
+  return total_latency_ / completed_frames_;
+}
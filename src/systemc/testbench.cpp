@@ -5,35 +5,83 @@
  */
 
 #include "header/systemc/testbench.hpp"
+#include "header/logger.hpp"
 using namespace std;
 
+/*
+ * Implementation notes: InputLayerProc
+ * -------------------------------------
+ * The pixels of a frame are read from the input file when its first pixel is
+ * sent, and the input files are reused in turn for the following frames. The
+ * pixels are tagged by the frame in the stream order, since the pipeline does
+ * not reorder them. The pixels of one handshake never cross the end of a row,
+ * and the unused ones on the bus are zeros.
+ */
 void Testbench::InputLayerProc() {
   // reset behavior
   input_layer_valid.write(0);
-  for (int i = 0; i < Nin_; ++i) {
-    input_layer_data[i].write(Payload(0));
-  }
+  input_layer_data.write(PayloadBus(Nin_*input_pixels_));
   start_of_frame_ = end_of_frame_ = sc_time(0, SC_NS);
   start_frame_data_ = 0;
   // synthetic data for ConvNetAcc
-  int data = 0;
+  data_ = reset_data_;
+  // pixels of the current input frame
+  vector<double> frame;
+  int loaded_file = -1;
   wait();
 
   while (true) {
+    const long int pixel = data_;
+    if (num_frames_ > 0 && pixel == static_cast<long int>(num_frames_) *
+        input_spatial_dim_) {
+      // all the frames are sent
+      input_layer_valid.write(0);
+      while (true) {
+        wait();
+      }
+    }
+    if (pause_after_warm_up_ && received_output_) {
+      // the valid is deasserted, wait until resumed
+      pause_after_warm_up_ = false;
+      paused_ = true;
+      while (paused_) {
+        wait();
+      }
+    }
     input_layer_valid.write(1);
-    data++;
-    for (int i = 0; i < Nin_; ++i) {
-      input_layer_data[i].write(Payload(data));
+    const int pixel_id = pixel % input_spatial_dim_;
+    // pixels of the handshake
+    const int n = min(input_pixels_, input_width_ - pixel_id % input_width_);
+    data_ += n;
+    PayloadBus input_data(Nin_*input_pixels_);
+    if (input_files_.empty()) {
+      for (int i = 0; i < n*Nin_; ++i) {
+        input_data[i] = Payload(pixel + i/Nin_ + 1);
+      }
+    } else {
+      const int file_id = (pixel / input_spatial_dim_) % input_files_.size();
+      if (file_id != loaded_file) {
+        frame_loader_.Load(input_files_[file_id], &frame);
+        loaded_file = file_id;
+      }
+      for (int i = 0; i < n*Nin_; ++i) {
+        input_data[i] = Payload(frame[static_cast<long int>(pixel_id)*Nin_+i]);
+      }
     }
+    input_layer_data.write(input_data);
     // record the packet injection time
-    inject_time_.push_back(sc_time_stamp());
+    for (int i = 0; i < n; ++i) {
+      statistics_.RecordInjection(sc_time_stamp());
+    }
     if (received_output_ && start_of_frame_ == sc_time(0, SC_NS)) {
       start_of_frame_ = sc_time_stamp();
-      start_frame_data_ = data;
+      start_frame_data_ = data_;
     }
-    // early stop
-    if (received_output_ && data == (1+start_frame_data_+early_stop_frame_size_*
-          input_spatial_dim_)) {
+    // early stop: the handshake sends the target pixel
+    const int stop_data = start_frame_data_ + early_stop_frame_size_*
+      input_spatial_dim_;
+    if (num_frames_ <= 0 && received_output_ && data_-n <= stop_data &&
+        stop_data < data_) {
       cout << "Early stop. Sent a complete frame after pipeline stage is fully"
         " warmed up!" << endl;
       end_of_frame_ = sc_time_stamp();
@@ -46,7 +94,8 @@ void Testbench::InputLayerProc() {
     } while (!input_layer_rdy.read());
 
     // output info for tracking status
-    cout << "@" << sc_time_stamp() << " Testbench sends data " << data << endl;
+    LOG(TESTBENCH, TRACE) << "@" << sc_time_stamp() << " Testbench sends data "
+      << data_ << endl;
 
     // not require to wait for 1 CC
     input_layer_valid.write(0);
@@ -56,7 +105,7 @@ void Testbench::InputLayerProc() {
 void Testbench::OutputLayerProc() {
   // reset behavior
   output_layer_rdy.write(0);
-  received_output_ = false;
+  received_output_ = reset_received_output_;
   wait();
 
   while (true) {
@@ -66,12 +115,20 @@ void Testbench::OutputLayerProc() {
     } while (!output_layer_valid.read());
 
     // output info
-    cout << "@" << sc_time_stamp() << " Testbench receives output layer: ";
     received_output_ = true;
-    for (int i = 0; i < Nout_; ++i) {
-      cout << output_layer_data[i].read().data << " ";
+    if (LOG_ENABLED(TESTBENCH, TRACE)) {
+      cout << "@" << sc_time_stamp() << " Testbench receives output layer: ";
+      const PayloadBus& output_data = output_layer_data.read();
+      for (int i = 0; i < Nout_; ++i) {
+        cout << output_data[i].value() << " ";
+      }
+      cout << endl;
+    }
+    statistics_.RecordOutput(sc_time_stamp());
+    if (num_frames_ > 0 && statistics_.stream_output_frames() == num_frames_) {
+      cout << "Received all the " << num_frames_ << " frames!" << endl;
+      sc_stop();
     }
-    cout << endl;
 
     // does not matter whether we require to wait for 1 CC
     output_layer_rdy.write(0);
@@ -79,41 +136,30 @@ void Testbench::OutputLayerProc() {
 }
 
 void Testbench::ReportStatistics() const {
-  cout << "#############################" << endl;
-  cout << "# Statistics of ConvNet Asic " << endl;
-  cout << "#############################" << endl;
-  if (inject_time_.size() < 2) {
-    cout << "INFO: Not enough simulation time" << endl;
-    return;
-  }
-  sc_time min_interval = inject_time_[1] - inject_time_[0];
-  sc_time max_interval = inject_time_[1] - inject_time_[0];
-
-  for (size_t i = 0; i < inject_time_.size()-1; ++i) {
-    if ((inject_time_[i+1] - inject_time_[i]) < min_interval) {
-      min_interval = inject_time_[i+1] - inject_time_[i];
-    }
-    if ((inject_time_[i+1] - inject_time_[i]) > max_interval) {
-      max_interval = inject_time_[i+1] - inject_time_[i];
-    }
-  }
-  // Avg interval: throughput
-  sc_time avg_interval;
-  if (start_of_frame_.to_double() != 0 && end_of_frame_.to_double() != 0) {
-    avg_interval = (end_of_frame_ - start_of_frame_) / (early_stop_frame_size_*
-        input_spatial_dim_-1);
-  } else {
-    avg_interval = (inject_time_.back() - inject_time_.front()) /
-      (inject_time_.size() - 1);
-  }
   // obtain the clock period
   sc_time clock_period = dynamic_cast<const sc_clock *>(clock.get_interface())->
     period();
-  cout << "# Total injection pixels no.: " << inject_time_.size() << endl;
-  cout << "# Min injection interval [cycles]: " << min_interval / clock_period
-    << endl;
-  cout << "# Max injection interval [cycles]: " << max_interval / clock_period
-    << endl;
-  cout << "# Avg injection interval (throughput) [cycles]: " << avg_interval /
-    clock_period << endl;
+  statistics_.Report(clock_period, start_of_frame_, end_of_frame_,
+      early_stop_frame_size_*input_spatial_dim_);
+}
+
+/*
+ * Implementation notes: SaveState
+ * --------------------------------
+ * The stream is saved when paused, i.e. between two pixels. The restored
+ * Testbench has received the output, so the early stop measures the throughput
+ * from the first pixel sent.
+ */
+void Testbench::SaveState(Checkpoint* checkpoint) const {
+  const long int output_pixels = statistics_.stream_output_pixels();
+  checkpoint->Write(name(), data_);
+  checkpoint->Write(name(), output_pixels);
+}
+
+void Testbench::RestoreState(Checkpoint* checkpoint) {
+  long int output_pixels;
+  checkpoint->Read(name(), &reset_data_);
+  checkpoint->Read(name(), &output_pixels);
+  reset_received_output_ = true;
+  statistics_.Resume(reset_data_, output_pixels);
 }
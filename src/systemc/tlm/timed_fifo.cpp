@@ -0,0 +1,56 @@
+/*
+ * Filename: timed_fifo.cpp
+ * -------------------------
+ * This file implements the class TimedFifo.
+ */
+
+#include "header/systemc/tlm/timed_fifo.hpp"
+#include <algorithm>
+using namespace std;
+
+TimedFifo::TimedFifo(const string& name, int capacity) : name_(name),
+  capacity_(capacity), size_(0), max_size_(0), num_written_(0), num_read_(0),
+  reader_waiting_(false) {
+  // sanity check
+  assert(capacity >= 0);
+}
+
+/*
+ * Implementation notes: Write
+ * ----------------------------
+ * The fifo without capacity still holds one pixel, which is handed over to the
+ * reader directly. Likewise, the pixel written to the empty fifo with a waiting
+ * reader bypasses the buffer, so it is not counted in the max buffer depth.
+ */
+void TimedFifo::Write() {
+  while (size_ > 0 && size_ >= capacity_) {
+    wait(read_event_);
+  }
+  ++size_;
+  const long int pixel_idx = ++num_written_;
+  max_size_ = max(max_size_, reader_waiting_ ? size_-1 : size_);
+  write_event_.notify(SC_ZERO_TIME);
+
+  if (capacity_ == 0) {
+    // combinational handshake: wait for the reader
+    while (num_read_ < pixel_idx) {
+      wait(read_event_);
+    }
+  }
+}
+
+void TimedFifo::WaitForData() {
+  while (size_ == 0) {
+    reader_waiting_ = true;
+    wait(write_event_);
+  }
+  reader_waiting_ = false;
+}
+
+void TimedFifo::Pop() {
+  // sanity check
+  assert(size_ > 0);
+  --size_;
+  ++num_read_;
+  read_event_.notify(SC_ZERO_TIME);
+}
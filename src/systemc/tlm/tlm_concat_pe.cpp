@@ -0,0 +1,73 @@
+/*
+ * Filename: tlm_concat_pe.cpp
+ * ----------------------------
+ * This file implements the class TlmConcatPe.
+ */
+
+#include "header/systemc/tlm/tlm_concat_pe.hpp"
+using namespace std;
+
+TlmConcatPe::TlmConcatPe(sc_module_name module_name, int numSplits,
+    int buffer_capacity) : sc_module(module_name), numSplits_(numSplits) {
+  // sanity check
+  assert(numSplits > 1);
+  prev_layer_socket =
+    new tlm_utils::simple_target_socket_tagged<TlmConcatPe> [numSplits_];
+  for (int i = 0; i < numSplits_; ++i) {
+    prev_layer_socket[i].register_b_transport(this,
+        &TlmConcatPe::PrevLayerTransport, i);
+    char fifo_name[100];
+    sprintf(fifo_name, "%s_input_fifo_%d", name(), i);
+    input_fifo_.push_back(new TimedFifo(fifo_name, buffer_capacity));
+  }
+
+  SC_THREAD(TlmConcatPeProc);
+}
+
+TlmConcatPe::~TlmConcatPe() {
+  delete [] prev_layer_socket;
+  for (size_t i = 0; i < input_fifo_.size(); ++i) {
+    delete input_fifo_[i];
+  }
+}
+
+void TlmConcatPe::PrevLayerTransport(int id, tlm::tlm_generic_payload& trans,
+    sc_time& delay) {
+  wait(delay);
+  delay = SC_ZERO_TIME;
+  input_fifo_[id]->Write();
+  trans.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+/*
+ * Implementation notes: TlmConcatPeProc
+ * --------------------------------------
+ * The ConcatPe is combinational: the concatenated pixel is transmitted in the
+ * same cycle when all the bottom blobs are valid, so no cycle is consumed here.
+ */
+void TlmConcatPe::TlmConcatPeProc() {
+  tlm::tlm_generic_payload trans;
+  trans.set_command(tlm::TLM_WRITE_COMMAND);
+  trans.set_address(0);
+  trans.set_data_ptr(NULL);
+  trans.set_data_length(0);
+  trans.set_streaming_width(0);
+  trans.set_byte_enable_ptr(NULL);
+  trans.set_dmi_allowed(false);
+
+  while (true) {
+    for (int i = 0; i < numSplits_; ++i) {
+      input_fifo_[i]->WaitForData();
+    }
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    next_layer_socket->b_transport(trans, delay);
+    if (trans.is_response_error()) {
+      cerr << name() << ": error response of the next layer" << endl;
+      exit(1);
+    }
+    for (int i = 0; i < numSplits_; ++i) {
+      input_fifo_[i]->Pop();
+    }
+  }
+}
@@ -0,0 +1,367 @@
+/*
+ * Filename: tlm_convnet_acc.cpp
+ * ------------------------------
+ * This file implements the class TlmConvNetAcc.
+ */
+
+#include "header/systemc/tlm/tlm_convnet_acc.hpp"
+#include "header/systemc/conv_layer_ctrl.hpp"
+#include "header/systemc/pool_layer_ctrl.hpp"
+#include "header/systemc/global_pool_ctrl.hpp"
+#include "header/caffe/layers/conv_layer.hpp"
+#include "header/caffe/layers/inner_product_layer.hpp"
+#include "header/caffe/layers/pooling_layer.hpp"
+#include "header/logger.hpp"
+#include <limits.h>
+
+using namespace std;
+using namespace config;
+
+// ceil(a/b) of the positive integers
+static inline int CeilDiv(int a, int b) {
+  return (a + b - 1) / b;
+}
+
+TlmConvNetAcc::TlmConvNetAcc(sc_module_name module_name, const Net& net,
+    const ConfigParameter& config_param) : sc_module(module_name),
+  input_layer_socket("input_layer_socket"),
+  output_layer_socket("output_layer_socket") {
+  append_buffer_capacity_ = config_param.append_buffer_capacity();
+  // clock frequency [GHz]
+  clock_period_ = sc_time(1./config_param.clk_freq(), SC_NS);
+
+  // initialize the parallelism
+  InitParallelism(net, config_param);
+
+  // initialize the network processing elements
+  Init(net);
+
+  // connect the final output layer
+  if (interconnections_.find(output_connection_) == interconnections_.end() ||
+      interconnections_[output_connection_].socket == NULL) {
+    cerr << "undefined output layer connections: " << output_connection_
+      << endl;
+    exit(1);
+  }
+  interconnections_[output_connection_].socket->bind(output_layer_socket);
+}
+
+TlmConvNetAcc::~TlmConvNetAcc() {
+  for (size_t i = 0; i < layer_pe_.size(); ++i) {
+    delete layer_pe_[i];
+  }
+  for (size_t i = 0; i < split_layer_pe_.size(); ++i) {
+    delete split_layer_pe_[i];
+  }
+  for (size_t i = 0; i < concat_layer_pe_.size(); ++i) {
+    delete concat_layer_pe_[i];
+  }
+}
+
+/*
+ * Implementation notes: InitParallelism
+ * --------------------------------------
+ * The parallelism is determined in the same way as the ConvNetAcc: by the
+ * multiplier/area budget if specified, by the pixel_inference_rate otherwise.
+ */
+void TlmConvNetAcc::InitParallelism(const Net& net,
+    const ConfigParameter& config_param) {
+  if (config_param.multiplier_budget() > 0 && config_param.area_budget() > 0) {
+    cerr << "only one of multiplier_budget & area_budget can be set" << endl;
+    exit(1);
+  }
+  ParallelismAllocator allocator(net, config_param);
+  if (config_param.multiplier_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::MULTIPLIER,
+        config_param.multiplier_budget());
+  } else if (config_param.area_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::AREA, config_param.area_budget());
+  } else {
+    allocator.AllocateByRate(config_param.pixel_inference_rate());
+  }
+  input_spatial_dim_ = allocator.input_spatial_dim();
+  output_spatial_dim_ = allocator.output_spatial_dim();
+  input_width_ = allocator.input_width();
+  input_pixels_ = allocator.InputPixels();
+
+  const map<int, ParallelismAllocator::LayerAllocation>& allocation =
+    allocator.allocation();
+  for (map<int, ParallelismAllocator::LayerAllocation>::const_iterator iter =
+      allocation.begin(); iter != allocation.end(); ++iter) {
+    parallelism_[iter->first] = make_pair(make_pair(iter->second.Pin,
+          iter->second.Pout), iter->second.Pk);
+    if (iter->second.Pw > 1) {
+      spatial_parallelism_[iter->first] = iter->second.Pw;
+    }
+  }
+  cout << "Max layer inference rate: " << allocator.max_inference_rate()
+    << endl;
+}
+
+void TlmConvNetAcc::Init(const Net& net) {
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    const Layer* layer = net.layers_[layer_id];
+    if (layer->layer_param().type() == "Input") {
+      InitInputLayer(net, layer_id);
+    } else if (layer->layer_param().type() == "Convolution") {
+      InitConvolutionPe(net, layer_id);
+    } else if (layer->layer_param().type() == "InnerProduct") {
+      InitInnerProductLayer(net, layer_id);
+    } else if (layer->layer_param().type() == "Pooling") {
+      InitPoolingPe(net, layer_id);
+    } else if (layer->layer_param().type() == "Split" ||
+        layer->layer_param().type() == "Slice") {
+      InitSplitLayer(net, layer_id);
+    } else if (layer->layer_param().type() == "Concat" ||
+        layer->layer_param().type() == "Eltwise") {
+      // no data path is simulated, so the EltwisePe shares the timing model
+      // of the ConcatPe
+      InitConcatLayer(net, layer_id);
+    } else {
+      BypassLayer(net, layer_id);
+    }
+  }
+}
+
+void TlmConvNetAcc::InitInputLayer(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "Input");
+  // the input layer is driven by the hierarchical input socket
+  Interconnection input_connection;
+  input_connection.socket = NULL;
+  input_connection.buffer_capacity = 0;
+  interconnections_[layer->layer_param().top(0)] = input_connection;
+}
+
+void TlmConvNetAcc::BypassLayer(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check: we only skip the layers with the single bottom blob
+  assert(layer->layer_param().bottom_size() == 1);
+
+  const string prev_connection = layer->layer_param().bottom(0);
+  if (interconnections_.find(prev_connection) == interconnections_.end()) {
+    cerr << "undefined previous layer connections: " << prev_connection
+      << endl;
+    exit(1);
+  }
+  for (int top_id = 0; top_id < layer->layer_param().top_size(); ++top_id) {
+    const string next_connection = layer->layer_param().top(top_id);
+    if (prev_connection != next_connection) {
+      interconnections_[next_connection] = interconnections_[prev_connection];
+    }
+  }
+}
+
+/*
+ * Implementation notes: ConnectPrevLayer
+ * ---------------------------------------
+ * The consumer fifo takes the capacity of the channel buffer appended to the
+ * producer, or the infinite capacity of the channel buffer prepended to the
+ * ConcatPe (or EltwisePe).
+ */
+void TlmConvNetAcc::ConnectPrevLayer(const string& prev_connection,
+    tlm::tlm_target_socket<>& target_socket, TimedFifo* fifo,
+    bool prepend_buffer) {
+  if (interconnections_.find(prev_connection) == interconnections_.end()) {
+    cerr << "undefined previous layer connections: " << prev_connection
+      << endl;
+    exit(1);
+  }
+  const Interconnection& interconnection = interconnections_[prev_connection];
+  if (interconnection.socket) {
+    interconnection.socket->bind(target_socket);
+  } else {
+    input_layer_socket.bind(target_socket);
+  }
+  if (fifo) {
+    fifo->set_capacity(prepend_buffer ? INT_MAX :
+        interconnection.buffer_capacity);
+    if (fifo->capacity() > 0) {
+      channel_buffers_.push_back(make_pair(prev_connection, fifo));
+    }
+  }
+}
+
+void TlmConvNetAcc::InitLayerPe(const Net& net, int layer_id, int Kh, int Kw,
+    int h, int w, int Pad_h, int Pad_w, int Stride_h, int Stride_w,
+    int latency, int pixel_latency, int Pw) {
+  const Layer* layer = net.layers_[layer_id];
+  char module_name[100];
+  sprintf(module_name, "%s_pe", net.layers_name_[layer_id].c_str());
+  TlmLayerPe* layer_pe = new TlmLayerPe(module_name, Kh, Kw, h, w, Pad_h,
+      Pad_w, Stride_h, Stride_w, latency, clock_period_, 0, pixel_latency, Pw);
+  layer_pe_.push_back(layer_pe);
+
+  ConnectPrevLayer(layer->layer_param().bottom(0),
+      layer_pe->prev_layer_socket, &layer_pe->input_fifo());
+  // the channel buffer is appended to the end of the current layer
+  Interconnection next_connection;
+  next_connection.socket = &layer_pe->next_layer_socket;
+  next_connection.buffer_capacity = append_buffer_capacity_;
+  interconnections_[layer->layer_param().top(0)] = next_connection;
+  output_connection_ = layer->layer_param().top(0);
+
+  LOG(TLM, DETAIL) << "TLM: " << module_name << " - latency: " << latency
+    << endl;
+}
+
+/*
+ * Implementation notes: InitConvolutionPe
+ * ----------------------------------------
+ * Each output pixel takes ceil(Nin/Pin)*ceil(Nout/Pout)*ceil(Kh*Kw/Pk) cycles
+ * of computation, followed by draining the pipeline of the ConvLayerCtrl. The
+ * Pw output pixels of a pass share the computation.
+ */
+void TlmConvNetAcc::InitConvolutionPe(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "Convolution");
+
+  const ConvolutionLayer* conv_layer =
+    dynamic_cast<const ConvolutionLayer*>(layer);
+  const int Pin = parallelism_[layer_id].first.first;
+  const int Pout = parallelism_[layer_id].first.second;
+  const int Pk = parallelism_[layer_id].second;
+  const int latency = CeilDiv(conv_layer->num_input_, Pin) *
+    CeilDiv(conv_layer->num_output_, Pout) *
+    CeilDiv(conv_layer->kh_*conv_layer->kw_, Pk) +
+    ConvLayerCtrl::PIPELINE_STAGE - 1;
+  const int Pw = (spatial_parallelism_.find(layer_id) ==
+      spatial_parallelism_.end()) ? 1 : spatial_parallelism_[layer_id];
+  InitLayerPe(net, layer_id, conv_layer->kh_, conv_layer->kw_, conv_layer->h_,
+      conv_layer->w_, conv_layer->pad_h_, conv_layer->pad_w_,
+      conv_layer->stride_h_, conv_layer->stride_w_, latency, 0, Pw);
+}
+
+void TlmConvNetAcc::InitInnerProductLayer(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "InnerProduct");
+
+  // convert the inner product layer to the convolution layer
+  int Nin, Kh, Kw, h, w;
+  if (net.bottom_blobs_shape_ptr_[layer_id][0]->size() == 4) {
+    // of shape (N, C, H, W)
+    Nin = net.bottom_blobs_shape_ptr_[layer_id][0]->at(1);
+    h = Kh = net.bottom_blobs_shape_ptr_[layer_id][0]->at(2);
+    w = Kw = net.bottom_blobs_shape_ptr_[layer_id][0]->at(3);
+  } else if (net.bottom_blobs_shape_ptr_[layer_id][0]->size() == 2) {
+    // of shape (N, C)
+    Nin = net.bottom_blobs_shape_ptr_[layer_id][0]->at(1);
+    h = w = Kh = Kw = 1;
+  } else {
+    cerr << "unexpected bottom blob shape: "
+      << net.bottom_blobs_shape_ptr_[layer_id][0]->size() << endl;
+    exit(1);
+  }
+  const int Nout = dynamic_cast<const InnerProductLayer*>(layer)->num_output_;
+  const int Pin = parallelism_[layer_id].first.first;
+  const int Pout = parallelism_[layer_id].first.second;
+  const int Pk = parallelism_[layer_id].second;
+  const int latency = CeilDiv(Nin, Pin) * CeilDiv(Nout, Pout) *
+    CeilDiv(Kh*Kw, Pk) + ConvLayerCtrl::PIPELINE_STAGE - 1;
+  // unit stride & zero padding for fully-connected layer
+  InitLayerPe(net, layer_id, Kh, Kw, h, w, 0, 0, 1, 1, latency);
+}
+
+/*
+ * Implementation notes: InitPoolingPe
+ * ------------------------------------
+ * Each output pixel takes ceil(Nin/Pin) cycles of computation, followed by
+ * draining the pipeline of the PoolLayerCtrl. The global pooling computes the
+ * ceil(Nin/Pin) cycles on each input pixel instead, and only drains the
+ * pipeline of the GlobalPoolCtrl after the last one.
+ */
+void TlmConvNetAcc::InitPoolingPe(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "Pooling");
+
+  const PoolingLayer* pool_layer = dynamic_cast<const PoolingLayer*>(layer);
+  const int Pin = parallelism_[layer_id].first.first;
+  if (pool_layer->global_pooling()) {
+    InitLayerPe(net, layer_id, pool_layer->kh_, pool_layer->kw_,
+        pool_layer->h_, pool_layer->w_, 0, 0, 1, 1,
+        GlobalPoolCtrl::PIPELINE_STAGE - 1,
+        CeilDiv(pool_layer->num_input_, Pin));
+    return;
+  }
+  const int latency = CeilDiv(pool_layer->num_input_, Pin) +
+    PoolLayerCtrl::PIPELINE_STAGE - 1;
+  InitLayerPe(net, layer_id, pool_layer->kh_, pool_layer->kw_, pool_layer->h_,
+      pool_layer->w_, pool_layer->pad_h_, pool_layer->pad_w_,
+      pool_layer->stride_h_, pool_layer->stride_w_, latency);
+}
+
+/*
+ * Implementation notes: InitSplitLayer
+ * -------------------------------------
+ * The SplitPe has no buffer: the channel buffer appended to the bottom blob is
+ * modeled at the input fifo of each next layer. The transactions carry no
+ * data, so the SlicePe of the fused convolution is timed as a SplitPe.
+ */
+void TlmConvNetAcc::InitSplitLayer(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "Split" ||
+      layer->layer_param().type() == "Slice");
+
+  char module_name[100];
+  sprintf(module_name, "%s_pe", net.layers_name_[layer_id].c_str());
+  const int numSplits = layer->layer_param().top_size();
+  TlmSplitPe* split_pe = new TlmSplitPe(module_name, numSplits);
+  split_layer_pe_.push_back(split_pe);
+
+  const string prev_connection = layer->layer_param().bottom(0);
+  ConnectPrevLayer(prev_connection, split_pe->prev_layer_socket, NULL);
+  for (int blob_id = 0; blob_id < numSplits; ++blob_id) {
+    Interconnection next_connection;
+    next_connection.socket = &split_pe->next_layer_socket[blob_id];
+    next_connection.buffer_capacity =
+      interconnections_[prev_connection].buffer_capacity;
+    interconnections_[layer->layer_param().top(blob_id)] = next_connection;
+  }
+}
+
+void TlmConvNetAcc::InitConcatLayer(const Net& net, int layer_id) {
+  const Layer* layer = net.layers_[layer_id];
+  // sanity check
+  assert(layer->layer_param().type() == "Concat" ||
+      layer->layer_param().type() == "Eltwise");
+
+  char module_name[100];
+  sprintf(module_name, "%s_pe", net.layers_name_[layer_id].c_str());
+  const int numSplits = layer->layer_param().bottom_size();
+  TlmConcatPe* concat_pe = new TlmConcatPe(module_name, numSplits, INT_MAX);
+  concat_layer_pe_.push_back(concat_pe);
+
+  // prepend the channel buffer with the infinite capacity to each bottom blob
+  for (int blob_id = 0; blob_id < numSplits; ++blob_id) {
+    ConnectPrevLayer(layer->layer_param().bottom(blob_id),
+        concat_pe->prev_layer_socket[blob_id], &concat_pe->input_fifo(blob_id),
+        true);
+  }
+  Interconnection next_connection;
+  next_connection.socket = &concat_pe->next_layer_socket;
+  next_connection.buffer_capacity = 0;
+  interconnections_[layer->layer_param().top(0)] = next_connection;
+  output_connection_ = layer->layer_param().top(0);
+}
+
+void TlmConvNetAcc::ReportBufferDepth(ostream& os) const {
+  os << "#############################" << endl;
+  os << "# Channel buffer depth (TLM)" << endl;
+  os << "#############################" << endl;
+  for (size_t i = 0; i < channel_buffers_.size(); ++i) {
+    const TimedFifo* fifo = channel_buffers_[i].second;
+    os << fifo->name() << " from " << channel_buffers_[i].first
+      << " with capacity ";
+    if (fifo->capacity() == INT_MAX) {
+      os << "inf";
+    } else {
+      os << fifo->capacity();
+    }
+    os << " max buffer depth: " << fifo->max_size() << endl;
+  }
+}
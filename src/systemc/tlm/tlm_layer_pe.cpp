@@ -0,0 +1,133 @@
+/*
+ * Filename: tlm_layer_pe.cpp
+ * ---------------------------
+ * This file implements the class TlmLayerPe.
+ */
+
+#include "header/systemc/tlm/tlm_layer_pe.hpp"
+using namespace std;
+
+TlmLayerPe::TlmLayerPe(sc_module_name module_name, int Kh, int Kw, int h,
+    int w, int Pad_h, int Pad_w, int Stride_h, int Stride_w, int latency,
+    const sc_time& clock_period, int buffer_capacity, int pixel_latency,
+    int Pw)
+  : sc_module(module_name), Kh_(Kh), Kw_(Kw), h_(h), w_(w), Pad_h_(Pad_h),
+  Pad_w_(Pad_w), Stride_h_(Stride_h), Stride_w_(Stride_w), latency_(latency),
+  pixel_latency_(pixel_latency), Pw_(Pw), clock_period_(clock_period),
+  input_fifo_(string(name()) + "_input_fifo", buffer_capacity) {
+  prev_layer_socket.register_b_transport(this,
+      &TlmLayerPe::PrevLayerTransport);
+
+  SC_THREAD(TlmLayerPeProc);
+}
+
+/*
+ * Implementation notes: PrevLayerTransport
+ * -----------------------------------------
+ * The annotated delay (the computation latency of the previous layer) is
+ * consumed before the pixel arrives at the input fifo. The initiator is
+ * blocked until the fifo accepts the pixel, which models the back pressure of
+ * the valid-rdy handshake.
+ */
+void TlmLayerPe::PrevLayerTransport(tlm::tlm_generic_payload& trans,
+    sc_time& delay) {
+  wait(delay);
+  delay = SC_ZERO_TIME;
+  input_fifo_.Write();
+  trans.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+bool TlmLayerPe::IsPadding(int feat_pixel_counter) const {
+  const int row_pos = feat_pixel_counter % (w_+2*Pad_w_);
+  return feat_pixel_counter < Pad_h_*(w_+2*Pad_w_) || row_pos < Pad_w_ ||
+    row_pos >= w_+Pad_w_ || feat_pixel_counter >= (w_+2*Pad_w_)*(h_+Pad_h_);
+}
+
+/*
+ * Implementation notes: IsOutputPixel
+ * ------------------------------------
+ * Same conditions as the ConvLayerCtrl & PoolLayerCtrl, where the counter has
+ * been incremented by the current pixel.
+ */
+bool TlmLayerPe::IsOutputPixel(int feat_pixel_counter) const {
+  // warm up the line buffer at first
+  const int warm_up_cycles = (w_+2*Pad_w_) * (Kh_-1) + Kw_-1;
+  if (feat_pixel_counter < warm_up_cycles) {
+    return false;
+  }
+  // go across the row of feature map
+  if (feat_pixel_counter % (w_+2*Pad_w_) < Kw_ &&
+      feat_pixel_counter % (w_+2*Pad_w_) > 0) {
+    return false;
+  }
+  // stride bypass
+  const int row_idx = 1 + (feat_pixel_counter-1) % (w_+2*Pad_w_);
+  const int col_idx = 1 + (feat_pixel_counter-1) / (w_+2*Pad_w_);
+  return (row_idx-Kw_) % Stride_w_ == 0 && (col_idx-Kh_) % Stride_h_ == 0;
+}
+
+/*
+ * Implementation notes: TlmLayerPeProc
+ * -------------------------------------
+ * Each padding zero & input pixel takes 1 cycle, plus the pixel latency of the
+ * input pixel. After the sliding window is completed, the output pixel is sent
+ * with the annotated latency, and the handshake with the next layer takes
+ * another cycle. If Pw > 1, the output pixels completed by the same group of
+ * input pixels are computed together, so only the first one is annotated.
+ */
+void TlmLayerPe::TlmLayerPeProc() {
+  // total feature map pixels
+  const int feat_pixels = (h_+2*Pad_h_) * (w_+2*Pad_w_);
+  int feat_pixel_counter = 0;
+
+  tlm::tlm_generic_payload trans;
+  trans.set_command(tlm::TLM_WRITE_COMMAND);
+  trans.set_address(0);
+  trans.set_data_ptr(NULL);
+  trans.set_data_length(0);
+  trans.set_streaming_width(0);
+  trans.set_byte_enable_ptr(NULL);
+  trans.set_dmi_allowed(false);
+
+  while (true) {
+    if (feat_pixel_counter == feat_pixels) {
+      feat_pixel_counter = 0;
+    }
+
+    // a padding zero or the (group of) pixels
+    int num_pixels = 1;
+    if (!IsPadding(feat_pixel_counter)) {
+      if (Pw_ > 1) {
+        num_pixels = min(Pw_*Stride_w_, w_+Pad_w_ -
+            feat_pixel_counter % (w_+2*Pad_w_));
+      }
+      // accept the pixels from previous layers
+      for (int i = 0; i < num_pixels; ++i) {
+        input_fifo_.Read();
+      }
+      if (pixel_latency_ > 0) {
+        wait(clock_period_ * pixel_latency_);
+      }
+    }
+    int num_outputs = 0;
+    for (int i = 0; i < num_pixels; ++i) {
+      if (IsOutputPixel(++feat_pixel_counter)) {
+        ++num_outputs;
+      }
+    }
+    wait(clock_period_);
+
+    for (int i = 0; i < num_outputs; ++i) {
+      // computation & pipeline drain, annotated on the first output pixel
+      sc_time delay = (i == 0) ? clock_period_ * latency_ : SC_ZERO_TIME;
+      trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+      next_layer_socket->b_transport(trans, delay);
+      if (trans.is_response_error()) {
+        cerr << name() << ": error response of the next layer" << endl;
+        exit(1);
+      }
+      wait(delay);
+      wait(clock_period_);
+    }
+  }
+}
@@ -0,0 +1,39 @@
+/*
+ * Filename: tlm_split_pe.cpp
+ * ---------------------------
+ * This file implements the class TlmSplitPe.
+ */
+
+#include "header/systemc/tlm/tlm_split_pe.hpp"
+using namespace std;
+
+TlmSplitPe::TlmSplitPe(sc_module_name module_name, int numSplits)
+  : sc_module(module_name), numSplits_(numSplits) {
+  // sanity check
+  assert(numSplits > 1);
+  next_layer_socket =
+    new tlm_utils::simple_initiator_socket<TlmSplitPe> [numSplits_];
+  prev_layer_socket.register_b_transport(this,
+      &TlmSplitPe::PrevLayerTransport);
+}
+
+TlmSplitPe::~TlmSplitPe() {
+  delete [] next_layer_socket;
+}
+
+/*
+ * Implementation notes: PrevLayerTransport
+ * -----------------------------------------
+ * The SplitPe only transmits the pixel when all the next layers are ready. The
+ * pixel is forwarded to the next layers one after another instead, and the
+ * transaction returns after the last next layer accepts it.
+ */
+void TlmSplitPe::PrevLayerTransport(tlm::tlm_generic_payload& trans,
+    sc_time& delay) {
+  for (int i = 0; i < numSplits_; ++i) {
+    next_layer_socket[i]->b_transport(trans, delay);
+    if (trans.is_response_error()) {
+      return;
+    }
+  }
+}
@@ -0,0 +1,113 @@
+/*
+ * Filename: tlm_testbench.cpp
+ * ----------------------------
+ * This file implements the class TlmTestbench.
+ */
+
+#include "header/systemc/tlm/tlm_testbench.hpp"
+using namespace std;
+
+TlmTestbench::TlmTestbench(sc_module_name module_name, int input_spatial_dim,
+    int output_spatial_dim, int early_stop_frame_size, int num_frames,
+    const sc_time& clock_period, int input_width, int input_pixels)
+  : sc_module(module_name), input_spatial_dim_(input_spatial_dim),
+  input_width_(input_width), input_pixels_(input_pixels),
+  early_stop_frame_size_(early_stop_frame_size), num_frames_(num_frames),
+  clock_period_(clock_period), statistics_(input_spatial_dim,
+      output_spatial_dim), start_frame_data_(0), received_output_(false) {
+  output_layer_socket.register_b_transport(this,
+      &TlmTestbench::OutputLayerTransport);
+
+  SC_THREAD(InputLayerProc);
+}
+
+/*
+ * Implementation notes: InputLayerProc
+ * -------------------------------------
+ * Mirror the Testbench: the injection time of each pixel is recorded when it is
+ * offered to the ConvNetAcc, and the next pixel (or group of pixels) is offered
+ * 1 cycle after the current one is accepted.
+ */
+void TlmTestbench::InputLayerProc() {
+  start_of_frame_ = end_of_frame_ = sc_time(0, SC_NS);
+  int data = 0;
+  tlm::tlm_generic_payload trans;
+  trans.set_command(tlm::TLM_WRITE_COMMAND);
+  trans.set_data_ptr(NULL);
+  trans.set_data_length(0);
+  trans.set_streaming_width(0);
+  trans.set_byte_enable_ptr(NULL);
+  trans.set_dmi_allowed(false);
+
+  while (true) {
+    if (num_frames_ > 0 && data == static_cast<long int>(num_frames_) *
+        input_spatial_dim_) {
+      // all the frames are sent
+      return;
+    }
+    // pixels of the group, which never crosses the end of a row
+    const int n = min(input_pixels_, input_width_ -
+        (data % input_spatial_dim_) % input_width_);
+    data += n;
+    // record the packet injection time
+    for (int i = 0; i < n; ++i) {
+      statistics_.RecordInjection(sc_time_stamp());
+    }
+    if (received_output_ && start_of_frame_ == sc_time(0, SC_NS)) {
+      start_of_frame_ = sc_time_stamp();
+      start_frame_data_ = data;
+    }
+    // early stop: the group sends the target pixel
+    const int stop_data = start_frame_data_ + early_stop_frame_size_*
+      input_spatial_dim_;
+    if (num_frames_ <= 0 && received_output_ && data-n <= stop_data &&
+        stop_data < data) {
+      cout << "Early stop. Sent a complete frame after pipeline stage is fully"
+        " warmed up!" << endl;
+      end_of_frame_ = sc_time_stamp();
+      sc_stop();
+      return;
+    }
+
+    for (int i = n-1; i >= 0; --i) {
+      sc_time delay = SC_ZERO_TIME;
+      trans.set_address(data-i);
+      trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+      input_layer_socket->b_transport(trans, delay);
+      if (trans.is_response_error()) {
+        cerr << name() << ": error response of the input layer" << endl;
+        exit(1);
+      }
+      wait(delay);
+    }
+    wait(clock_period_);
+  }
+}
+
+void TlmTestbench::OutputLayerTransport(tlm::tlm_generic_payload& trans,
+    sc_time& delay) {
+  // the output layer is always ready
+  wait(delay);
+  delay = SC_ZERO_TIME;
+  received_output_ = true;
+  statistics_.RecordOutput(sc_time_stamp());
+  if (num_frames_ > 0 && statistics_.completed_frames() == num_frames_) {
+    cout << "Received all the " << num_frames_ << " frames!" << endl;
+    sc_stop();
+  }
+  trans.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+void TlmTestbench::ReportStatistics() const {
+  statistics_.Report(clock_period_, start_of_frame_, end_of_frame_,
+      early_stop_frame_size_*input_spatial_dim_);
+}
+
+double TlmTestbench::AvgInjectionInterval() const {
+  return statistics_.AvgInterval(start_of_frame_, end_of_frame_,
+      early_stop_frame_size_*input_spatial_dim_) / clock_period_;
+}
+
+double TlmTestbench::AvgFrameLatency() const {
+  return statistics_.AvgLatency() / clock_period_;
+}
@@ -17,42 +17,172 @@ Top::Top(sc_module_name module_name, const Net& net,
   convnet_acc->input_layer_valid(input_layer_valid);
   convnet_acc->input_layer_rdy(input_layer_rdy);
   // allocate the input data
-  input_layer_data = new sc_signal<Payload> [convnet_acc->Nin_];
-  for (int i = 0; i < convnet_acc->Nin_; ++i) {
-    convnet_acc->input_layer_data[i](input_layer_data[i]);
-  }
+  input_layer_data = new PayloadBusSignal("input_layer_data",
+      convnet_acc->Nin_*convnet_acc->input_pixels_);
+  convnet_acc->input_layer_data(*input_layer_data);
   convnet_acc->output_layer_valid(output_layer_valid);
   convnet_acc->output_layer_rdy(output_layer_rdy);
   // allocate the output data
-  output_layer_data = new sc_signal<Payload> [convnet_acc->Nout_];
-  for (int i = 0; i < convnet_acc->Nout_; ++i) {
-    convnet_acc->output_layer_data[i](output_layer_data[i]);
-  }
+  output_layer_data = new PayloadBusSignal("output_layer_data",
+      convnet_acc->Nout_);
+  convnet_acc->output_layer_data(*output_layer_data);
 
   // allocate the Testbench
+  const vector<string> input_files(config_param.input_file().begin(),
+      config_param.input_file().end());
   testbench = new Testbench("testbench", convnet_acc->Nin_, convnet_acc->Nout_,
-      convnet_acc->input_spatial_dim_, config_param.early_stop_frame_size());
+      convnet_acc->input_spatial_dim_, convnet_acc->output_spatial_dim_,
+      config_param.early_stop_frame_size(), config_param.num_frames(),
+      input_files, convnet_acc->input_width_, convnet_acc->input_pixels_);
   testbench->clock(clock);
   testbench->reset(reset);
   testbench->input_layer_valid(input_layer_valid);
   testbench->input_layer_rdy(input_layer_rdy);
-  for (int i = 0; i < convnet_acc->Nin_; ++i) {
-    testbench->input_layer_data[i](input_layer_data[i]);
-  }
+  testbench->input_layer_data(*input_layer_data);
   testbench->output_layer_rdy(output_layer_rdy);
   testbench->output_layer_valid(output_layer_valid);
-  for (int i = 0; i < convnet_acc->Nout_; ++i) {
-    testbench->output_layer_data[i](output_layer_data[i]);
+  testbench->output_layer_data(*output_layer_data);
+
+  // warmed-up state from the checkpoint
+  if (!config_param.restore_file().empty()) {
+    RestoreCheckpoint(config_param.restore_file());
+  }
+  checkpoint_file_ = config_param.checkpoint_file();
+  if (!checkpoint_file_.empty()) {
+    testbench->PauseAfterWarmUp();
+    SC_CTHREAD(CheckpointProc, clock.pos());
+    reset_signal_is(reset, true);
   }
 }
 
 Top::~Top() {
-  delete [] input_layer_data;
-  delete [] output_layer_data;
+  delete input_layer_data;
+  delete output_layer_data;
   delete testbench;
   delete convnet_acc;
 }
 
+/*
+ * Implementation notes: CheckpointProc
+ * -------------------------------------
+ * The Testbench pauses the stream after the first output, when the line
+ * buffers & channel buffers are warmed up. The pixels in flight are drained
+ * until all the controllers wait for the input for 2 cycles in a row. Then the
+ * pipeline registers are cleared, and the state is kept by the line buffers,
+ * the channel buffers, the controller counters & the stream progress.
+ */
+void Top::CheckpointProc() {
+  // reset behavior
+  wait();
+
+  while (!testbench->Paused()) {
+    wait();
+  }
+  int drained_cycles = 0;
+  while (drained_cycles < 2) {
+    wait();
+    drained_cycles = Drained() ? drained_cycles+1 : 0;
+  }
+  SaveCheckpoint(checkpoint_file_);
+  cout << "@" << sc_time_stamp() << " Saved the warmed-up state to "
+    << checkpoint_file_ << endl;
+  testbench->Resume();
+
+  while (true) {
+    wait();
+  }
+}
+
+bool Top::Drained() const {
+  for (size_t i = 0; i < convnet_acc->conv_layer_pe_.size(); ++i) {
+    if (!convnet_acc->conv_layer_pe_[i]->conv_layer_ctrl_->WaitingInput()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < convnet_acc->pool_layer_pe_.size(); ++i) {
+    if (!convnet_acc->pool_layer_pe_[i]->pool_layer_ctrl_->WaitingInput()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < convnet_acc->global_pool_pe_.size(); ++i) {
+    if (!convnet_acc->global_pool_pe_[i]->global_pool_ctrl_->WaitingInput()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Top::SaveCheckpoint(const string& filename) const {
+  Checkpoint checkpoint;
+  for (size_t i = 0; i < convnet_acc->conv_layer_pe_.size(); ++i) {
+    const ConvLayerPe* conv_layer_pe = convnet_acc->conv_layer_pe_[i];
+    conv_layer_pe->conv_layer_ctrl_->SaveState(&checkpoint);
+    // the pointwise layer holds no pixel while waiting for the input
+    if (!conv_layer_pe->pointwise_) {
+      conv_layer_pe->line_buffer_array_->SaveState(&checkpoint);
+    }
+  }
+  for (size_t i = 0; i < convnet_acc->pool_layer_pe_.size(); ++i) {
+    const PoolLayerPe* pool_layer_pe = convnet_acc->pool_layer_pe_[i];
+    pool_layer_pe->pool_layer_ctrl_->SaveState(&checkpoint);
+    pool_layer_pe->line_buffer_array_->SaveState(&checkpoint);
+  }
+  for (size_t i = 0; i < convnet_acc->global_pool_pe_.size(); ++i) {
+    const GlobalPoolPe* global_pool_pe = convnet_acc->global_pool_pe_[i];
+    global_pool_pe->global_pool_ctrl_->SaveState(&checkpoint);
+    // the partial results of the frame in flight
+    global_pool_pe->global_pool_array_->SaveState(&checkpoint);
+  }
+  for (size_t i = 0; i < convnet_acc->channel_buffer_.size(); ++i) {
+    convnet_acc->channel_buffer_[i]->SaveState(&checkpoint);
+  }
+  testbench->SaveState(&checkpoint);
+  checkpoint.Save(filename);
+}
+
+void Top::RestoreCheckpoint(const string& filename) {
+  Checkpoint checkpoint;
+  checkpoint.Load(filename);
+  for (size_t i = 0; i < convnet_acc->conv_layer_pe_.size(); ++i) {
+    ConvLayerPe* conv_layer_pe = convnet_acc->conv_layer_pe_[i];
+    conv_layer_pe->conv_layer_ctrl_->RestoreState(&checkpoint);
+    if (!conv_layer_pe->pointwise_) {
+      conv_layer_pe->line_buffer_array_->RestoreState(&checkpoint);
+    }
+  }
+  for (size_t i = 0; i < convnet_acc->pool_layer_pe_.size(); ++i) {
+    PoolLayerPe* pool_layer_pe = convnet_acc->pool_layer_pe_[i];
+    pool_layer_pe->pool_layer_ctrl_->RestoreState(&checkpoint);
+    pool_layer_pe->line_buffer_array_->RestoreState(&checkpoint);
+  }
+  for (size_t i = 0; i < convnet_acc->global_pool_pe_.size(); ++i) {
+    GlobalPoolPe* global_pool_pe = convnet_acc->global_pool_pe_[i];
+    global_pool_pe->global_pool_ctrl_->RestoreState(&checkpoint);
+    global_pool_pe->global_pool_array_->RestoreState(&checkpoint);
+  }
+  for (size_t i = 0; i < convnet_acc->channel_buffer_.size(); ++i) {
+    convnet_acc->channel_buffer_[i]->RestoreState(&checkpoint);
+  }
+  testbench->RestoreState(&checkpoint);
+  cout << "Restored the warmed-up state from " << filename << endl;
+}
+
+/*
+ * Implementation notes: LaneSum
+ * ------------------------------
+ * The ConvLayerPe instantiates one line buffer mux, multiplier array, adder
+ * array & output register per lane, whose metrics are reported in total.
+ */
+template <class Unit>
+static double LaneSum(const vector<Unit*>& lanes,
+    double (Unit::*metric)() const) {
+  double sum = 0.;
+  for (size_t k = 0; k < lanes.size(); ++k) {
+    sum += (lanes[k]->*metric)();
+  }
+  return sum;
+}
+
 void Top::ReportAreaBreakdown() const {
   cout << "###################################" << endl;
   cout << "# ConvNetAsic Area Breakdown [um2]" << endl;
@@ -68,27 +198,43 @@ void Top::ReportAreaBreakdown() const {
   // convolutional layer pe
   for (size_t i = 0; i < convnet_acc->conv_layer_pe_.size(); ++i) {
     const ConvLayerPe* conv_layer_pe = convnet_acc->conv_layer_pe_[i];
+    // lanes of the convolution layer pe
+    const double lane_mux_area = LaneSum(conv_layer_pe->line_buffer_mux_,
+        &LineBufferMux::Area);
+    const double lane_mult_area = LaneSum(conv_layer_pe->mult_array_,
+        &MultArray::Area);
+    const double lane_adder_area = LaneSum(conv_layer_pe->add_array_,
+        &AddArray::Area);
+    const double lane_demux_area = LaneSum(conv_layer_pe->demux_out_reg_,
+        &DemuxOutReg::Area);
     // hierarchy of convolution layer pe
     // centralized line buffer implementation
     // where the width is concatenation over all channels
-    line_buffer_area += conv_layer_pe->line_buffer_array_->Area();
-    line_buffer_mux_area += conv_layer_pe->line_buffer_mux_->Area();
+    if (conv_layer_pe->pointwise_) {
+      // the pixel mux is accounted as the line buffer mux
+      line_buffer_mux_area += conv_layer_pe->pixel_mux_->Area();
+    } else {
+      line_buffer_area += conv_layer_pe->line_buffer_array_->Area();
+      line_buffer_mux_area += lane_mux_area;
+    }
     weight_mem_area += conv_layer_pe->weight_mem_->Area();
-    mult_area += conv_layer_pe->mult_array_->Area();
-    adder_area += conv_layer_pe->add_array_->Area();
-    demux_area += conv_layer_pe->demux_out_reg_->Area();
+    mult_area += lane_mult_area;
+    adder_area += lane_adder_area;
+    demux_area += lane_demux_area;
 
     // LOG info
     cout << conv_layer_pe->basename() << ": " << conv_layer_pe->Area() << endl;
-    cout << "\tLine Buffer: " << conv_layer_pe->line_buffer_array_->Area()
-      << endl;
-    cout << "\tLine Buffer Mux: " << conv_layer_pe->line_buffer_mux_->Area()
-      << endl;
+    if (conv_layer_pe->pointwise_) {
+      cout << "\tPixel Mux: " << conv_layer_pe->pixel_mux_->Area() << endl;
+    } else {
+      cout << "\tLine Buffer: " << conv_layer_pe->line_buffer_array_->Area()
+        << endl;
+      cout << "\tLine Buffer Mux: " << lane_mux_area << endl;
+    }
     cout << "\tWeight Mem: " << conv_layer_pe->weight_mem_->Area() << endl;
-    cout << "\tMultipier Array: " << conv_layer_pe->mult_array_->Area()
-      << endl;
-    cout << "\tAdder Array: " << conv_layer_pe->add_array_->Area() << endl;
-    cout << "\tDemux: " << conv_layer_pe->demux_out_reg_->Area() << endl;
+    cout << "\tMultipier Array: " << lane_mult_area << endl;
+    cout << "\tAdder Array: " << lane_adder_area << endl;
+    cout << "\tDemux: " << lane_demux_area << endl;
   }
 
   // pooling layer pe
@@ -114,6 +260,23 @@ void Top::ReportAreaBreakdown() const {
     cout << "\tDemux: " << pool_layer_pe->demux_out_reg_->Area() << endl;
   }
 
+  // global pooling layer pe
+  for (size_t i = 0; i < convnet_acc->global_pool_pe_.size(); ++i) {
+    const GlobalPoolPe* global_pool_pe = convnet_acc->global_pool_pe_[i];
+    // the pixel mux is accounted as the line buffer mux
+    line_buffer_mux_area += global_pool_pe->pixel_mux_->Area();
+    pool_array_area += global_pool_pe->global_pool_array_->Area();
+    demux_area += global_pool_pe->demux_out_reg_->Area();
+
+    // LOG info
+    cout << global_pool_pe->basename() << ": " << global_pool_pe->Area()
+      << endl;
+    cout << "\tPixel Mux: " << global_pool_pe->pixel_mux_->Area() << endl;
+    cout << "\tGlobal Pool Array: " << global_pool_pe->global_pool_array_->
+      Area() << endl;
+    cout << "\tDemux: " << global_pool_pe->demux_out_reg_->Area() << endl;
+  }
+
   // channel buffer
   for (size_t i = 0; i < convnet_acc->channel_buffer_.size(); ++i) {
     const ChannelBuffer* channel_buffer = convnet_acc->channel_buffer_[i];
@@ -152,43 +315,72 @@ void Top::ReportPowerBreakdown() const {
   // convolutional layer pe
   for (size_t i = 0; i < convnet_acc->conv_layer_pe_.size(); ++i) {
     const ConvLayerPe* conv_layer_pe = convnet_acc->conv_layer_pe_[i];
+    // lanes of the convolution layer pe
+    const double lane_mux_static = LaneSum(conv_layer_pe->line_buffer_mux_,
+        &LineBufferMux::StaticPower);
+    const double lane_mux_dynamic = LaneSum(conv_layer_pe->line_buffer_mux_,
+        &LineBufferMux::DynamicPower);
+    const double lane_mult_static = LaneSum(conv_layer_pe->mult_array_,
+        &MultArray::StaticPower);
+    const double lane_mult_dynamic = LaneSum(conv_layer_pe->mult_array_,
+        &MultArray::DynamicPower);
+    const double lane_adder_static = LaneSum(conv_layer_pe->add_array_,
+        &AddArray::StaticPower);
+    const double lane_adder_dynamic = LaneSum(conv_layer_pe->add_array_,
+        &AddArray::DynamicPower);
+    const double lane_demux_static = LaneSum(conv_layer_pe->demux_out_reg_,
+        &DemuxOutReg::StaticPower);
+    const double lane_demux_dynamic = LaneSum(conv_layer_pe->demux_out_reg_,
+        &DemuxOutReg::DynamicPower);
     // hierarchy of convolution layer pe
-    line_buffer_static += conv_layer_pe->line_buffer_array_->StaticPower();
-    line_buffer_dynamic += conv_layer_pe->line_buffer_array_->DynamicPower();
-    line_buffer_mux_static += conv_layer_pe->line_buffer_mux_->StaticPower();
-    line_buffer_mux_dynamic += conv_layer_pe->line_buffer_mux_->DynamicPower();
+    if (conv_layer_pe->pointwise_) {
+      line_buffer_mux_static += conv_layer_pe->pixel_mux_->StaticPower();
+      line_buffer_mux_dynamic += conv_layer_pe->pixel_mux_->DynamicPower();
+    } else {
+      line_buffer_static += conv_layer_pe->line_buffer_array_->StaticPower();
+      line_buffer_dynamic += conv_layer_pe->line_buffer_array_->DynamicPower();
+      line_buffer_mux_static += lane_mux_static;
+      line_buffer_mux_dynamic += lane_mux_dynamic;
+    }
     weight_mem_static += conv_layer_pe->weight_mem_->StaticPower();
     weight_mem_dynamic += conv_layer_pe->weight_mem_->DynamicPower();
-    mult_static += conv_layer_pe->mult_array_->StaticPower();
-    mult_dynamic += conv_layer_pe->mult_array_->DynamicPower();
-    adder_static += conv_layer_pe->add_array_->StaticPower();
-    adder_dynamic += conv_layer_pe->add_array_->DynamicPower();
-    demux_static += conv_layer_pe->demux_out_reg_->StaticPower();
-    demux_dynamic += conv_layer_pe->demux_out_reg_->DynamicPower();
+    mult_static += lane_mult_static;
+    mult_dynamic += lane_mult_dynamic;
+    adder_static += lane_adder_static;
+    adder_dynamic += lane_adder_dynamic;
+    demux_static += lane_demux_static;
+    demux_dynamic += lane_demux_dynamic;
 
     // LOG info
     cout << conv_layer_pe->basename() << ": " << conv_layer_pe->TotalPower()
       << endl;
-    cout << "\tLine Buffer: [S]: " << conv_layer_pe->line_buffer_array_->
-      StaticPower() << " [D]: " << conv_layer_pe->line_buffer_array_->
-      DynamicPower() << " [T]: " << conv_layer_pe->line_buffer_array_->
-      TotalPower()<< endl;
-    cout << "\tLine Buffer Mux: [S]: " << conv_layer_pe->line_buffer_mux_->
-      StaticPower() << " [D]: " << conv_layer_pe->line_buffer_mux_->
-      DynamicPower() << " [T]: " << conv_layer_pe->line_buffer_mux_->
-      TotalPower() << endl;
+    if (conv_layer_pe->pointwise_) {
+      cout << "\tPixel Mux: [S]: " << conv_layer_pe->pixel_mux_->StaticPower()
+        << " [D]: " << conv_layer_pe->pixel_mux_->DynamicPower()
+        << " [T]: " << conv_layer_pe->pixel_mux_->TotalPower() << endl;
+    } else {
+      cout << "\tLine Buffer: [S]: " << conv_layer_pe->line_buffer_array_->
+        StaticPower() << " [D]: " << conv_layer_pe->line_buffer_array_->
+        DynamicPower() << " [T]: " << conv_layer_pe->line_buffer_array_->
+        TotalPower()<< endl;
+      cout << "\tLine Buffer Mux: [S]: " << lane_mux_static << " [D]: "
+        << lane_mux_dynamic << " [T]: " << lane_mux_static + lane_mux_dynamic
+        << endl;
+    }
     cout << "\tWeight Mem: [S]: " << conv_layer_pe->weight_mem_->StaticPower()
      << " [D]: " << conv_layer_pe->weight_mem_->DynamicPower()
      << " [T]: " << conv_layer_pe->weight_mem_->TotalPower() << endl;
-    cout << "\tMultipier Array: [S]: " << conv_layer_pe->mult_array_->
-      StaticPower() << " [D]: " << conv_layer_pe->mult_array_->DynamicPower()
-      << " [T]: " << conv_layer_pe->mult_array_->TotalPower() << endl;
-    cout << "\tAdder Array: [S]: " << conv_layer_pe->add_array_->StaticPower()
-     << " [D]: " << conv_layer_pe->add_array_->DynamicPower()
-     << " [T]: " << conv_layer_pe->add_array_->TotalPower() << endl;
-    cout << "\tDemux: [S]: " << conv_layer_pe->demux_out_reg_->StaticPower()
-      << " [D]: " << conv_layer_pe->demux_out_reg_->DynamicPower()
-      << " [T]: " << conv_layer_pe->demux_out_reg_->TotalPower() << endl;
+    cout << "\tMultipier Array: [S]: " << lane_mult_static << " [D]: "
+      << lane_mult_dynamic << " [T]: " << lane_mult_static + lane_mult_dynamic
+      << endl;
+    cout << "\tGated Multiplications: " << conv_layer_pe->GatedMultRatio()*100.
+      << "%" << endl;
+    cout << "\tAdder Array: [S]: " << lane_adder_static << " [D]: "
+      << lane_adder_dynamic << " [T]: " << lane_adder_static +
+      lane_adder_dynamic << endl;
+    cout << "\tDemux: [S]: " << lane_demux_static << " [D]: "
+      << lane_demux_dynamic << " [T]: " << lane_demux_static +
+      lane_demux_dynamic << endl;
   }
 
   // pooling layer pe
@@ -222,6 +414,32 @@ void Top::ReportPowerBreakdown() const {
       << " [T]: " << pool_layer_pe->demux_out_reg_->TotalPower() << endl;
   }
 
+  // global pooling layer pe
+  for (size_t i = 0; i < convnet_acc->global_pool_pe_.size(); ++i) {
+    const GlobalPoolPe* global_pool_pe = convnet_acc->global_pool_pe_[i];
+    const GlobalPoolArray* global_pool_array =
+      global_pool_pe->global_pool_array_;
+    line_buffer_mux_static += global_pool_pe->pixel_mux_->StaticPower();
+    line_buffer_mux_dynamic += global_pool_pe->pixel_mux_->DynamicPower();
+    pool_array_static += global_pool_array->StaticPower();
+    pool_array_dynamic += global_pool_array->DynamicPower();
+    demux_static += global_pool_pe->demux_out_reg_->StaticPower();
+    demux_dynamic += global_pool_pe->demux_out_reg_->DynamicPower();
+
+    // LOG info
+    cout << global_pool_pe->basename() << ": " << global_pool_pe->TotalPower()
+      << endl;
+    cout << "\tPixel Mux: [S]: " << global_pool_pe->pixel_mux_->StaticPower()
+      << " [D]: " << global_pool_pe->pixel_mux_->DynamicPower()
+      << " [T]: " << global_pool_pe->pixel_mux_->TotalPower() << endl;
+    cout << "\tGlobal Pool Array: [S]: " << global_pool_array->StaticPower()
+      << " [D]: " << global_pool_array->DynamicPower()
+      << " [T]: " << global_pool_array->TotalPower() << endl;
+    cout << "\tDemux: [S]: " << global_pool_pe->demux_out_reg_->StaticPower()
+      << " [D]: " << global_pool_pe->demux_out_reg_->DynamicPower()
+      << " [T]: " << global_pool_pe->demux_out_reg_->TotalPower() << endl;
+  }
+
   // channel buffer
   for (size_t i = 0; i < convnet_acc->channel_buffer_.size(); ++i) {
     const ChannelBuffer* channel_buffer = convnet_acc->channel_buffer_[i];
@@ -276,9 +494,11 @@ void Top::ReportMemoryDistribution() const {
   for (size_t i = 0; i < convnet_acc->conv_layer_pe_.size(); ++i) {
     const ConvLayerPe* conv_layer_pe = convnet_acc->conv_layer_pe_[i];
     cout << "#" << conv_layer_pe->basename() << endl;
-    cout << "\t" << "line buffer: " << conv_layer_pe->line_buffer_array_->
-      MemoryDepth() << "x" << conv_layer_pe->line_buffer_array_->MemoryWidth()
-      << endl;
+    if (!conv_layer_pe->pointwise_) {
+      cout << "\t" << "line buffer: " << conv_layer_pe->line_buffer_array_->
+        MemoryDepth() << "x" << conv_layer_pe->line_buffer_array_->
+        MemoryWidth() << endl;
+    }
     cout << "\t" << "weight memory: " << conv_layer_pe->weight_mem_->
       MemoryDepth() << "x" << conv_layer_pe->weight_mem_->MemoryWidth() << endl;
   }
@@ -294,6 +514,13 @@ void Top::ReportMemoryDistribution() const {
       MemoryDepth() << "x" << pool_layer_pe->line_buffer_array_->MemoryWidth()
       << endl;
   }
+  for (size_t i = 0; i < convnet_acc->global_pool_pe_.size(); ++i) {
+    const GlobalPoolPe* global_pool_pe = convnet_acc->global_pool_pe_[i];
+    cout << "#" << global_pool_pe->basename() << endl;
+    cout << "\t" << "accumulator: " << global_pool_pe->global_pool_array_->
+      MemoryDepth() << "x" << global_pool_pe->global_pool_array_->
+      MemoryWidth() << endl;
+  }
 
   // channel buffer
   cout << "#########################" << endl;
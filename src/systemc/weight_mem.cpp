@@ -5,6 +5,8 @@
  */
 
 #include "header/systemc/weight_mem.hpp"
+#include "header/systemc/event_gating.hpp"
+#include <algorithm>
 using namespace std;
 using namespace config;
 
@@ -23,11 +25,23 @@ WeightMem::WeightMem(sc_module_name module_name, int Kh, int Kw, int Pin,
       ceil(static_cast<double>(Nin_)/Pin_) * ceil(static_cast<double>(Kh_*Kw_)/
         Pk_));
 
-    // TODO: for now, we simply assume the elements in memory are initialized as
-    // full ones
+    // the elements in memory are initialized as full ones unless the weights
+    // are loaded
     for (int i = 0; i < mem_width_*mem_depth_; ++i) {
       mem_.push_back(Payload(1));
     }
+    // all the (input, output) tiles are stored
+    const int tiled_in = static_cast<int>(ceil(static_cast<double>(Nin_)/
+          Pin_));
+    const int tiled_out = static_cast<int>(ceil(static_cast<double>(Nout_)/
+          Pout_));
+    for (int i = 0; i < tiled_in; ++i) {
+      tile_row_ptr_.push_back(i*tiled_out);
+      for (int o = 0; o < tiled_out; ++o) {
+        tile_col_idx_.push_back(o);
+      }
+    }
+    tile_row_ptr_.push_back(tiled_in*tiled_out);
 
     // WeightMemProc: synchronous with clock and reset
     SC_METHOD(WeightMemProc);
@@ -48,6 +62,9 @@ WeightMem::~WeightMem() {
 }
 
 void WeightMem::WeightMemProc() {
+  if (WokenUpByEnable(clock, reset)) {
+    return;
+  }
   if (reset.read()) {
     // reset
     for (int i = 0; i < mem_width_; ++i) {
@@ -63,6 +80,75 @@ void WeightMem::WeightMemProc() {
     }
 #endif
   }
+
+  SleepUntilEnabled(mem_rd_en, reset);
+}
+
+/*
+ * Implementation notes: LoadWeights
+ * ----------------------------------
+ * The memory word of address (i, o, k) holds the weights of the ith input
+ * tile, oth output tile & kth kernel tile, following the access order of the
+ * ConvLayerCtrl. Within the word, the weight of the oth output, ith input &
+ * kth kernel location of the tile is at o*Pin*Pk+i*Pk+k, as consumed by the
+ * MultArray. The locations beyond the channel depth & kernel size are zeros.
+ * With zero skipping, the (input, output) tiles of all-zero weights are
+ * dropped from the memory, which shrinks the memory depth accordingly.
+ */
+void WeightMem::LoadWeights(const vector<int>& weights, bool zero_skipping) {
+  const int kernel_size = Kh_*Kw_;
+  const int tiled_in = static_cast<int>(ceil(static_cast<double>(Nin_)/Pin_));
+  const int tiled_out = static_cast<int>(ceil(static_cast<double>(Nout_)/
+        Pout_));
+  const int tiled_kernel = static_cast<int>(ceil(static_cast<double>(
+          kernel_size)/Pk_));
+  if (static_cast<int>(weights.size()) != Nout_*Nin_*kernel_size) {
+    cerr << name() << ": unexpected no. of weights " << weights.size() << endl;
+    exit(1);
+  }
+
+  mem_.clear();
+  tile_row_ptr_.clear();
+  tile_col_idx_.clear();
+  for (int ti = 0; ti < tiled_in; ++ti) {
+    tile_row_ptr_.push_back(tile_col_idx_.size());
+    for (int to = 0; to < tiled_out; ++to) {
+      const size_t tile_start = mem_.size();
+      bool all_zeros = true;
+      for (int tk = 0; tk < tiled_kernel; ++tk) {
+        for (int o = 0; o < Pout_; ++o) {
+          for (int i = 0; i < Pin_; ++i) {
+            for (int k = 0; k < Pk_; ++k) {
+              const int out = to*Pout_ + o;
+              const int in = ti*Pin_ + i;
+              const int kernel = tk*Pk_ + k;
+              const bool valid = out < Nout_ && in < Nin_ &&
+                kernel < kernel_size;
+              const int weight = valid ?
+                weights[(out*Nin_+in)*kernel_size+kernel] : 0;
+              all_zeros = all_zeros && weight == 0;
+              mem_.push_back(Payload(weight));
+            }
+          }
+        }
+      }
+      if (zero_skipping && all_zeros) {
+        // drop the tile
+        mem_.resize(tile_start);
+      } else {
+        tile_col_idx_.push_back(to);
+      }
+    }
+  }
+  tile_row_ptr_.push_back(tile_col_idx_.size());
+
+  // resize the memory model
+  mem_depth_ = tile_col_idx_.size() * tiled_kernel;
+  memory_model_->SetMemoryDepth(max(mem_depth_, 1));
+  if (zero_skipping) {
+    cout << name() << ": stored " << tile_col_idx_.size() << "/"
+      << tiled_in*tiled_out << " non-zero weight tiles" << endl;
+  }
 }
 
 /*
@@ -0,0 +1,267 @@
+/*
+ * Filename: throughput_analyzer.cpp
+ * ----------------------------------
+ * This file implements the class ThroughputAnalyzer.
+ */
+
+#include "header/throughput_analyzer.hpp"
+#include "header/caffe/layer.hpp"
+#include "header/caffe/layers/conv_layer.hpp"
+#include "header/caffe/layers/inner_product_layer.hpp"
+#include "header/caffe/layers/pooling_layer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace std;
+
+/*
+ * Implementation notes: Constructor
+ * ----------------------------------
+ * The first pass determines the frame period of each processing element, and
+ * the bottleneck one paces the whole accelerator (at most 1 input pixel per
+ * cycle). The second pass propagates the first pixel arrival time in the
+ * topological order of the layers, assuming the pixels of each blob are evenly
+ * spread over the frame period:
+ *  - a layer emits its first pixel after receiving the input pixels of the
+ *    first sliding window plus its latency & output handshake
+ *  - a concat layer waits for the latest bottom blob, and the inception buffer
+ *    of each bottom blob holds the pixels arriving during the skew
+ *  - so does an eltwise layer, where the skip buffer of the shortcut holds the
+ *    pixels arriving during the latency of the residual branch
+ *  - the channel buffer appended to the previous layer holds the pixels
+ *    arriving while the next layer is computing an output pixel
+ */
+ThroughputAnalyzer::ThroughputAnalyzer(const Net& net,
+    const map<int, int>& layer_latency) : net_(net),
+  layer_latency_(layer_latency), input_spatial_dim_(1), frame_period_(1),
+  bottleneck_layer_(-1) {
+  // first pass: frame period of each processing element
+  map<int, LayerDim> layer_dims;
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    const string type = net.layers_[layer_id]->layer_param().type();
+    if (type == "Input") {
+      const vector<int>* shape = net.top_blobs_shape_ptr_[layer_id][0];
+      input_spatial_dim_ = (shape->size() == 4) ? shape->at(2)*shape->at(3) :
+        1;
+    } else if (type == "Convolution" || type == "InnerProduct" ||
+        type == "Pooling") {
+      if (layer_latency_.find(layer_id) == layer_latency_.end()) {
+        cerr << "undefined latency of layer: "
+          << net.layers_[layer_id]->layer_param().name() << endl;
+        exit(1);
+      }
+      const LayerDim dim = ExtractLayerDim(layer_id);
+      layer_dims[layer_id] = dim;
+      if (dim.global_pool) {
+        // the input pixels are computed one after another
+        layer_frame_period_[layer_id] = static_cast<long int>(dim.h) * dim.w *
+          (layer_latency_[layer_id]+1);
+      } else {
+        layer_frame_period_[layer_id] =
+          static_cast<long int>(dim.h+2*dim.pad_h) * (dim.w+2*dim.pad_w) +
+          static_cast<long int>(dim.out_pixels) * (layer_latency_[layer_id]+1);
+      }
+    }
+  }
+  frame_period_ = input_spatial_dim_;
+  for (map<int, long int>::const_iterator iter = layer_frame_period_.begin();
+      iter != layer_frame_period_.end(); ++iter) {
+    if (iter->second > frame_period_) {
+      frame_period_ = iter->second;
+      bottleneck_layer_ = iter->first;
+    }
+  }
+
+  // second pass: propagate the first pixel arrival time
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    const caffe::LayerParameter& layer_param =
+      net.layers_[layer_id]->layer_param();
+    const string& type = layer_param.type();
+    if (type == "Input") {
+      BlobTiming timing;
+      timing.first_pixel = 0.;
+      timing.pixels = input_spatial_dim_;
+      timing.producer = -1;
+      blob_timing_[layer_param.top(0)] = timing;
+    } else if (type == "Convolution" || type == "InnerProduct" ||
+        type == "Pooling") {
+      const BlobTiming& bottom = BottomTiming(layer_id, 0);
+      const LayerDim& dim = layer_dims[layer_id];
+      const int latency = layer_latency_[layer_id];
+      // arrival interval of the input pixels
+      const double interval = static_cast<double>(frame_period_) /
+        bottom.pixels;
+      if (bottom.producer >= 0) {
+        const int depth = max(0, static_cast<int>(ceil((latency+1) /
+                interval)) - 1);
+        inter_layer_buffer_depth_[bottom.producer] = max(depth,
+            inter_layer_buffer_depth_[bottom.producer]);
+      }
+      // updated by the next layers
+      inter_layer_buffer_depth_[layer_id] = 0;
+
+      BlobTiming timing;
+      timing.first_pixel = bottom.first_pixel + (WarmUpPixels(dim)-1) *
+        interval + latency + 1;
+      timing.pixels = dim.out_pixels;
+      timing.producer = layer_id;
+      blob_timing_[layer_param.top(0)] = timing;
+    } else if (type == "Split") {
+      const BlobTiming bottom = BottomTiming(layer_id, 0);
+      for (int blob_id = 0; blob_id < layer_param.top_size(); ++blob_id) {
+        blob_timing_[layer_param.top(blob_id)] = bottom;
+      }
+    } else if (type == "Concat" || type == "Eltwise") {
+      BlobTiming timing;
+      timing.first_pixel = AlignBottomBlobs(layer_id, (type == "Concat") ?
+          &inception_buffer_depth_ : &skip_buffer_depth_);
+      timing.pixels = BottomTiming(layer_id, 0).pixels;
+      timing.producer = -1;
+      blob_timing_[layer_param.top(0)] = timing;
+    } else {
+      // bypass the remaining layers with the timing of the bottom blob
+      const BlobTiming bottom = BottomTiming(layer_id, 0);
+      for (int top_id = 0; top_id < layer_param.top_size(); ++top_id) {
+        blob_timing_[layer_param.top(top_id)] = bottom;
+      }
+    }
+  }
+}
+
+ThroughputAnalyzer::LayerDim ThroughputAnalyzer::ExtractLayerDim(int layer_id)
+  const {
+  const Layer* layer = net_.layers_[layer_id];
+  const vector<int>* top_shape = net_.top_blobs_shape_ptr_[layer_id][0];
+  LayerDim dim;
+  dim.out_pixels = (top_shape->size() == 4) ?
+    top_shape->at(2)*top_shape->at(3) : 1;
+  dim.global_pool = false;
+  if (layer->layer_param().type() == "Convolution") {
+    const ConvolutionLayer* conv_layer =
+      dynamic_cast<const ConvolutionLayer*>(layer);
+    dim.Kh = conv_layer->kh_;
+    dim.Kw = conv_layer->kw_;
+    dim.h = conv_layer->h_;
+    dim.w = conv_layer->w_;
+    dim.pad_h = conv_layer->pad_h_;
+    dim.pad_w = conv_layer->pad_w_;
+  } else if (layer->layer_param().type() == "Pooling") {
+    const PoolingLayer* pool_layer = dynamic_cast<const PoolingLayer*>(layer);
+    dim.Kh = pool_layer->kh_;
+    dim.Kw = pool_layer->kw_;
+    dim.h = pool_layer->h_;
+    dim.w = pool_layer->w_;
+    dim.pad_h = pool_layer->pad_h_;
+    dim.pad_w = pool_layer->pad_w_;
+    dim.global_pool = pool_layer->global_pooling();
+  } else {
+    // inner product layer: the kernel covers the whole bottom feature map
+    const vector<int>* bottom_shape =
+      net_.bottom_blobs_shape_ptr_[layer_id][0];
+    if (bottom_shape->size() == 4) {
+      dim.Kh = dim.h = bottom_shape->at(2);
+      dim.Kw = dim.w = bottom_shape->at(3);
+    } else {
+      dim.Kh = dim.Kw = dim.h = dim.w = 1;
+    }
+    dim.pad_h = dim.pad_w = 0;
+  }
+  return dim;
+}
+
+/*
+ * Implementation notes: WarmUpPixels
+ * -----------------------------------
+ * The first sliding window is complete after Kh-1 padded rows plus Kw padded
+ * pixels, only the pixels within the feature map are streamed in.
+ */
+int ThroughputAnalyzer::WarmUpPixels(const LayerDim& dim) {
+  // full rows of the feature map in the first Kh-1 padded rows
+  const int full_rows = max(0, min(dim.Kh-1, dim.pad_h+dim.h) - dim.pad_h);
+  int pixels = full_rows * dim.w;
+  // partial row of the last kernel row
+  if (dim.Kh-1 >= dim.pad_h && dim.Kh-1 < dim.pad_h+dim.h) {
+    pixels += max(0, min(dim.Kw, dim.pad_w+dim.w) - dim.pad_w);
+  }
+  return max(1, pixels);
+}
+
+double ThroughputAnalyzer::AlignBottomBlobs(int layer_id,
+    map<pair<int, int>, int>* buffer_depth) {
+  const caffe::LayerParameter& layer_param =
+    net_.layers_[layer_id]->layer_param();
+  double first_pixel = 0.;
+  for (int blob_id = 0; blob_id < layer_param.bottom_size(); ++blob_id) {
+    first_pixel = max(first_pixel,
+        BottomTiming(layer_id, blob_id).first_pixel);
+  }
+  for (int blob_id = 0; blob_id < layer_param.bottom_size(); ++blob_id) {
+    const BlobTiming& bottom = BottomTiming(layer_id, blob_id);
+    (*buffer_depth)[make_pair(layer_id, blob_id)] =
+      static_cast<int>(ceil((first_pixel - bottom.first_pixel) *
+            bottom.pixels / frame_period_));
+  }
+  return first_pixel;
+}
+
+const ThroughputAnalyzer::BlobTiming& ThroughputAnalyzer::BottomTiming(
+    int layer_id, int blob_id) const {
+  const string bottom = net_.layers_[layer_id]->layer_param().bottom(blob_id);
+  map<string, BlobTiming>::const_iterator iter = blob_timing_.find(bottom);
+  if (iter == blob_timing_.end()) {
+    cerr << "undefined previous layer connections: " << bottom << endl;
+    exit(1);
+  }
+  return iter->second;
+}
+
+int ThroughputAnalyzer::InterLayerBufferDepth(int layer_id) const {
+  map<int, int>::const_iterator iter =
+    inter_layer_buffer_depth_.find(layer_id);
+  return (iter == inter_layer_buffer_depth_.end()) ? 0 : iter->second;
+}
+
+int ThroughputAnalyzer::InceptionBufferDepth(int layer_id, int blob_id) const {
+  map<pair<int, int>, int>::const_iterator iter =
+    inception_buffer_depth_.find(make_pair(layer_id, blob_id));
+  return (iter == inception_buffer_depth_.end()) ? 0 : iter->second;
+}
+
+int ThroughputAnalyzer::SkipBufferDepth(int layer_id, int blob_id) const {
+  map<pair<int, int>, int>::const_iterator iter =
+    skip_buffer_depth_.find(make_pair(layer_id, blob_id));
+  return (iter == skip_buffer_depth_.end()) ? 0 : iter->second;
+}
+
+void ThroughputAnalyzer::Summary(ostream& os) const {
+  os << "################################" << endl;
+  os << "# Analytical throughput & buffer depth" << endl;
+  os << "################################" << endl;
+  for (map<int, long int>::const_iterator iter = layer_frame_period_.begin();
+      iter != layer_frame_period_.end(); ++iter) {
+    os << "- " << net_.layers_[iter->first]->layer_param().name()
+      << " frame period: " << iter->second << " inter-layer buffer depth: "
+      << InterLayerBufferDepth(iter->first) << endl;
+  }
+  for (map<pair<int, int>, int>::const_iterator iter =
+      inception_buffer_depth_.begin(); iter != inception_buffer_depth_.end();
+      ++iter) {
+    os << "- " << net_.layers_[iter->first.first]->layer_param().name()
+      << " inception buffer " << iter->first.second << " depth: "
+      << iter->second << endl;
+  }
+  for (map<pair<int, int>, int>::const_iterator iter =
+      skip_buffer_depth_.begin(); iter != skip_buffer_depth_.end(); ++iter) {
+    os << "- " << net_.layers_[iter->first.first]->layer_param().name()
+      << " skip buffer " << iter->first.second << " depth: " << iter->second
+      << endl;
+  }
+  if (bottleneck_layer_ >= 0) {
+    os << "Bottleneck layer: "
+      << net_.layers_[bottleneck_layer_]->layer_param().name() << endl;
+  }
+  os << "Steady-state frame period [cycle]: " << frame_period_ << endl;
+  os << "Steady-state injection interval [cycle/pixel]: "
+    << injection_interval() << endl;
+}
@@ -1,12 +1,14 @@
 // -----------------------------------------------------------------------------
 // This file exports the module `channel_buffer`, including the synchronous FIFO
-// as the basic memory system to store the data.
+// as the basic memory system to store the data. The input pixels are
+// requantized from BIT_WIDTH to OUT_BIT_WIDTH before being stored.
 // -----------------------------------------------------------------------------
 
 module channel_buffer #(
   parameter                           BIT_WIDTH = 8,        // bit width
   parameter                           BUFFER_DEPTH = 8,     // buffer depth
-  parameter                           NUM_CHANNEL = 3       // channel number
+  parameter                           NUM_CHANNEL = 3,      // channel number
+  parameter                           OUT_BIT_WIDTH = BIT_WIDTH // output bit width
 ) (
   input wire                          clk,                  // system clock
   input wire                          rst,                  // system reset
@@ -20,31 +22,42 @@ module channel_buffer #(
   // output data path & its handshake
   input wire                          next_layer_rdy,       // next layer ready
   output wire                         next_layer_valid,     // next layer valid
-  output wire [NUM_CHANNEL*BIT_WIDTH-1:0]
+  output wire [NUM_CHANNEL*OUT_BIT_WIDTH-1:0]
                                       next_layer_data       // next layer data
 );
 
+// requantized input data
+wire [NUM_CHANNEL*OUT_BIT_WIDTH-1:0] prev_layer_data_requant;
+requantize #(
+  .IN_BIT_WIDTH           (BIT_WIDTH),              // input bit width
+  .OUT_BIT_WIDTH          (OUT_BIT_WIDTH),          // output bit width
+  .NUM_CHANNEL            (NUM_CHANNEL)             // channel number
+) requantize_inst (
+  .in_data                (prev_layer_data),        // input data
+  .out_data               (prev_layer_data_requant) // output data
+);
+
 generate
 if (BUFFER_DEPTH == 0) begin: genblk0
   // no buffer depth: simple wire connection
   assign next_layer_valid = prev_layer_valid;
   assign prev_layer_rdy   = next_layer_rdy;
-  assign next_layer_data  = prev_layer_data;
+  assign next_layer_data  = prev_layer_data_requant;
 end else begin: genblk1
   // use FIFO as the storage element
   reg fifo_write_en, fifo_read_en;
-  reg [NUM_CHANNEL*BIT_WIDTH-1:0] fifo_write_data;
-  wire [NUM_CHANNEL*BIT_WIDTH-1:0] fifo_read_data;
+  reg [NUM_CHANNEL*OUT_BIT_WIDTH-1:0] fifo_write_data;
+  wire [NUM_CHANNEL*OUT_BIT_WIDTH-1:0] fifo_read_data;
   wire fifo_empty, fifo_full;
   localparam  TX_IDLE         = 1'b0,
               TX_WAIT_FOR_RDY = 1'b1;
   reg next_layer_valid_reg, next_layer_valid_next;
-  reg [NUM_CHANNEL*BIT_WIDTH-1:0] next_layer_data_reg, next_layer_data_next;
+  reg [NUM_CHANNEL*OUT_BIT_WIDTH-1:0] next_layer_data_reg, next_layer_data_next;
   reg state_reg, state_next;
   // FIFO bypass: it is possible to directly output the signal
   wire fifo_bypass = (state_reg == TX_IDLE && next_layer_rdy);
   fifo_sync #(
-    .BIT_WIDTH            (NUM_CHANNEL*BIT_WIDTH),  // bit width
+    .BIT_WIDTH            (NUM_CHANNEL*OUT_BIT_WIDTH),  // bit width
     .FIFO_DEPTH           (BUFFER_DEPTH)            // fifo depth
   ) fifo_sync_inst (
     .clk                  (clk),                    // system clock
@@ -72,10 +85,10 @@ end else begin: genblk1
   always @ (*) begin
     if (!fifo_full && prev_layer_valid && !fifo_bypass) begin
       fifo_write_en       = 1'b1;
-      fifo_write_data     = prev_layer_data;
+      fifo_write_data     = prev_layer_data_requant;
     end else begin
       fifo_write_en       = 1'b0;
-      fifo_write_data     = {(NUM_CHANNEL*BIT_WIDTH){1'b0}};
+      fifo_write_data     = {(NUM_CHANNEL*OUT_BIT_WIDTH){1'b0}};
     end
   end
 
@@ -130,7 +143,8 @@ end else begin: genblk1
   // ---------------------------
   // Primiary output assignment
   // ---------------------------
-  assign next_layer_data = fifo_bypass ? prev_layer_data : next_layer_data_reg;
+  assign next_layer_data = fifo_bypass ? prev_layer_data_requant :
+    next_layer_data_reg;
   assign next_layer_valid = fifo_bypass ? prev_layer_valid : next_layer_valid_reg;
 
 end
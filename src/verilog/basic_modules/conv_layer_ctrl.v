@@ -413,8 +413,10 @@ always @ (*) begin
           tile_in_idx_increment : tiled_in_idx_reg;
       end
 
-      // increment the kernel memory access address
-      kernel_mem_addr_next  = kernel_mem_addr_next + 1;
+      // increment the kernel memory access address: it follows the tiled
+      // input & output index, i.e. tiled_in_idx*TILED_OUT_PARALLEL +
+      // tiled_out_idx
+      kernel_mem_addr_next  = kernel_mem_addr + 1'b1;
 
       // state transfer
       if (tiled_out_idx_reg == TILED_OUT_PARALLEL-1 &&
@@ -2,6 +2,10 @@
 // This file exports the module `conv_layer_pe, which is the top module of the
 // convolutional processing element (pe). It includes the FSM controller to
 // coordinate each component within the datapath to operate well.
+// The pointwise layer (1x1 kernel without padding) is neither padded nor
+// buffered for the sliding window, so its line buffer array & mux array are
+// replaced by the `pixel_mux`, which loads the accepted pixel straight into the
+// multiplier array input register.
 // -----------------------------------------------------------------------------
 
 module conv_layer_pe #(
@@ -33,7 +37,10 @@ module conv_layer_pe #(
   parameter                       NONLIN_PIPELINE = 1,
   // switch for turn on the bias enable and nonlinear enable
   parameter                       BIAS_EN = 1,
-  parameter                       NONLIN_EN = 1
+  parameter                       NONLIN_EN = 1,
+  // initialize the kernel memory with the weight files (behavior simulation)
+  parameter                       WEIGHT_INIT = 0,
+  parameter                       WEIGHT_FILE = "weight"
 ) (
   input wire                      clk,              // system clock
   input wire                      rst,              // system reset (active high)
@@ -68,6 +75,8 @@ module conv_layer_pe #(
 // -----------------------
 localparam    PADDED_H = h + 2*pad_h;               // padded feature map dim
 localparam    PADDED_W = w + 2*pad_w;
+// 1x1 kernel without padding
+localparam    POINTWISE = (Kh == 1 && Kw == 1 && pad_h == 0 && pad_w == 0);
 // tiled input & output parallelism
 localparam    TILED_IN_PARALLEL = ceil_div(Nin, Pin);
 localparam    TILED_OUT_PARALLEL = ceil_div(Nout, Pout);
@@ -84,8 +93,8 @@ genvar i, j, k, l;
 // ----------------------------
 // line buffer
 // ----------------------------
-wire line_buffer_valid; // line buffer valid
-wire line_buffer_zero;  // line buffer zero input
+wire line_buffer_valid; // line buffer valid (pixel load if pointwise)
+wire line_buffer_zero;  // line buffer zero input (never raised if pointwise)
 // line buffer sliding window data (Nin input feature maps)
 wire [Nin*Kh*Kw*BIT_WIDTH-1:0] line_buffer_data;
 // --------------------------
@@ -200,47 +209,72 @@ conv_layer_ctrl #(
   .out_regfile_waddr  (out_regfile_waddr)   // output register file write address
 );
 
-// -----------------------------------------------------------------------------
-// Line buffer array: includes Nin line buffers. It is possible to share all Nin
-// line buffers as a single SRAM to save the hardware resources (TODO)
-// -----------------------------------------------------------------------------
-line_buffer_array #(
-  .Kh                 (Kh),                 // convolutional kernel dimension
-  .Kw                 (Kw),
-  .h                  (h),                  // input feature map spatial dimension
-  .w                  (w),
-  .Nin                (Nin),                // input feature map no.
-  .pad_h              (pad_h),              // padding dimension
-  .pad_w              (pad_w),
-  .BIT_WIDTH          (BIT_WIDTH)           // bit width of the data path
-) line_buffer_array_inst
-(
-  .clk                (clk),                // system clock
-  .rst                (rst),                // system reset
-
-  // control signal
-  .line_buffer_valid  (line_buffer_valid),  // line buffer valid
-  .line_buffer_zero   (line_buffer_zero),   // line buffer zero flag
-  // data path
-  .prev_layer_data    (prev_layer_data),    // previous layer data
-  .line_buffer_data   (line_buffer_data)    // line buffer sliding window data
-);
+generate
+if (POINTWISE) begin: pointwise
+  // ---------------------------------------------------------------------------
+  // Pixel mux: a seperate pipeline stage as the mux array. It loads the first
+  // Pin input feature maps of the accepted pixel, & holds the rest for the
+  // following input tiles
+  // ---------------------------------------------------------------------------
+  pixel_mux #(
+    .Nin                (Nin),                // input feature map number
+    .Pin                (Pin),                // input feature map parallelism
+    .BIT_WIDTH          (BIT_WIDTH)           // bit width
+  ) pixel_mux_inst (
+    .clk                (clk),                // system clock
+    .pixel_load         (line_buffer_valid),  // load the accepted pixel
+    .prev_layer_data    (prev_layer_data),    // previous layer data
+    .mux_enable         (mux_enable),         // enable (active high)
+    .mux_select         (mux_select),         // mux select signal
+    .mux_array_out_data (mux_array_data)      // mux array output data
+  );
+
+  // the pixel is not buffered for the sliding window
+  assign line_buffer_data = prev_layer_data;
+end else begin: sliding_window
+  // ---------------------------------------------------------------------------
+  // Line buffer array: includes Nin line buffers. It is possible to share all
+  // Nin line buffers as a single SRAM to save the hardware resources (TODO)
+  // ---------------------------------------------------------------------------
+  line_buffer_array #(
+    .Kh                 (Kh),                 // convolutional kernel dimension
+    .Kw                 (Kw),
+    .h                  (h),                  // input feature map spatial dimension
+    .w                  (w),
+    .Nin                (Nin),                // input feature map no.
+    .pad_h              (pad_h),              // padding dimension
+    .pad_w              (pad_w),
+    .BIT_WIDTH          (BIT_WIDTH)           // bit width of the data path
+  ) line_buffer_array_inst
+  (
+    .clk                (clk),                // system clock
+    .rst                (rst),                // system reset
+
+    // control signal
+    .line_buffer_valid  (line_buffer_valid),  // line buffer valid
+    .line_buffer_zero   (line_buffer_zero),   // line buffer zero flag
+    // data path
+    .prev_layer_data    (prev_layer_data),    // previous layer data
+    .line_buffer_data   (line_buffer_data)    // line buffer sliding window data
+  );
 
-// ---------------------------------------------------------------------------
-// Line buffer mux: the mux array is a seperate pipeline stage. It select the
-// desired Pin data from the Nin input feature maps
-// ---------------------------------------------------------------------------
-mux_array #(
-  .Nin                (Nin),                // input feature map number
-  .Pin                (Pin),                // input feature map parallelism
-  .BIT_WIDTH          (Kh*Kw*BIT_WIDTH)     // bit width
-) mux_array_inst (
-  .clk                (clk),                // system clock
-  .mux_enable         (mux_enable),         // enable (active high)
-  .mux_select         (mux_select),         // mux select signal
-  .line_buffer_data   (line_buffer_data),   // line buffer sliding window data
-  .mux_array_out_data (mux_array_data)      // mux array output data
-);
+  // ---------------------------------------------------------------------------
+  // Line buffer mux: the mux array is a seperate pipeline stage. It select the
+  // desired Pin data from the Nin input feature maps
+  // ---------------------------------------------------------------------------
+  mux_array #(
+    .Nin                (Nin),                // input feature map number
+    .Pin                (Pin),                // input feature map parallelism
+    .BIT_WIDTH          (Kh*Kw*BIT_WIDTH)     // bit width
+  ) mux_array_inst (
+    .clk                (clk),                // system clock
+    .mux_enable         (mux_enable),         // enable (active high)
+    .mux_select         (mux_select),         // mux select signal
+    .line_buffer_data   (line_buffer_data),   // line buffer sliding window data
+    .mux_array_out_data (mux_array_data)      // mux array output data
+  );
+end
+endgenerate
 
 // --------------------------------------------------------------------------
 // TODO
@@ -256,7 +290,9 @@ kernel_mem #(
   .Nout               (Nout),                // output feature map no.
   .Pin                (Pin),                 // input feature map parallelism
   .Pout               (Pout),                // output feature map parallelism
-  .BIT_WIDTH          (BIT_WIDTH)            // bit width of the data path
+  .BIT_WIDTH          (BIT_WIDTH),           // bit width of the data path
+  .WEIGHT_INIT        (WEIGHT_INIT),         // weight file initialization
+  .WEIGHT_FILE        (WEIGHT_FILE)
 ) kernel_mem_inst (
   .clk                (clk),                 // system clock
   .mem_en             (kernel_mem_en),       // memory enable (active low)
@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------
+// This file exports the module `eltwise`, which is the basic module for the
+// residual block. The shortcut and the residual branch are merged by the
+// element-wise operation on each channel of the feature map. This module
+// mainly deal with the element-wise operation as well as the valid-ready pair.
+// -----------------------------------------------------------------------------
+
+module eltwise #(
+  parameter                           Nin = 3,            // input feature map no. of each input
+  parameter                           NUM_INPUT = 2,      // number of inputs to be merged
+  parameter                           BIT_WIDTH = 8,      // bit width of the data path
+  // element-wise operation: support for {SUM, PROD, MAX}
+  parameter                           ELTWISE_OP = "SUM"
+) (
+  // previous layer data & valid-ready pair
+  input wire  [NUM_INPUT-1:0]         prev_layer_valid,   // previous layer valid
+  output reg  [NUM_INPUT-1:0]         prev_layer_rdy,     // previous layer ready
+  input wire  [NUM_INPUT*Nin*BIT_WIDTH-1:0]
+                                      prev_layer_data,    // previous layer data
+  // next layer data & valid-ready pair
+  input wire                          next_layer_rdy,     // next layer ready
+  output wire                         next_layer_valid,   // next layer valid
+  output wire [Nin*BIT_WIDTH-1:0]     next_layer_data     // next layer data
+);
+
+// element-wise results of each channel
+reg [BIT_WIDTH-1:0] eltwise_result [Nin-1:0];
+
+integer i;
+genvar g;
+
+// ----------------------------------------------------------------------------
+// Next layer data: merge the same channel of all inputs, the results wrap
+// around on overflow (the lower BIT_WIDTH bits are kept)
+// ----------------------------------------------------------------------------
+generate
+  for (g = 0; g < Nin; g = g + 1) begin: eltwise_result_g
+    always @ (*) begin
+      eltwise_result[g]             = prev_layer_data[g*BIT_WIDTH +: BIT_WIDTH];
+      for (i = 1; i < NUM_INPUT; i = i + 1) begin
+        if (ELTWISE_OP == "PROD") begin
+          eltwise_result[g]         = eltwise_result[g] *
+            prev_layer_data[(i*Nin+g)*BIT_WIDTH +: BIT_WIDTH];
+        end else if (ELTWISE_OP == "MAX") begin
+          if ($signed(eltwise_result[g]) <
+              $signed(prev_layer_data[(i*Nin+g)*BIT_WIDTH +: BIT_WIDTH])) begin
+            eltwise_result[g]       = prev_layer_data[(i*Nin+g)*BIT_WIDTH +: BIT_WIDTH];
+          end
+        end else begin
+          eltwise_result[g]         = eltwise_result[g] +
+            prev_layer_data[(i*Nin+g)*BIT_WIDTH +: BIT_WIDTH];
+        end
+      end
+    end
+    assign next_layer_data[g*BIT_WIDTH +: BIT_WIDTH] = eltwise_result[g];
+  end
+endgenerate
+
+// ----------------------------------------------------------------------------
+// Previous layer ready: only pass the next layer ready when all the inputs are
+// valid, so the pixels of all inputs are consumed together
+// ----------------------------------------------------------------------------
+generate
+  for (g = 0; g < NUM_INPUT; g = g + 1) begin: prev_layer_rdy_g
+    always @ (*) begin
+      if (&prev_layer_valid) begin
+        prev_layer_rdy[g]           = next_layer_rdy;
+      end else begin
+        prev_layer_rdy[g]           = 1'b0;
+      end
+    end
+  end
+endgenerate
+
+// ----------------------------------------------------
+// Next layer valid: AND all previous valid signals
+// ----------------------------------------------------
+assign next_layer_valid = &prev_layer_valid;
+
+endmodule
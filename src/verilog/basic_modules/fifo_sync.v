@@ -132,18 +132,21 @@ end
 
 // ------------------------------------------------------------------
 // Behavior simulation: additional counter tracking the buffer depth
-// and the max buffer depth during the simulation
+// and the max buffer depth during the simulation, which counts up to
+// FIFO_DEPTH (the full fifo) without wrapping around
 // ------------------------------------------------------------------
 `ifdef BEHAV_SIM
 
-reg [ADDR_WIDTH-1:0] fifo_depth_reg;
-reg [ADDR_WIDTH-1:0] fifo_max_depth;
+localparam DEPTH_WIDTH = clog2(FIFO_DEPTH+1);
+
+reg [DEPTH_WIDTH-1:0] fifo_depth_reg;
+reg [DEPTH_WIDTH-1:0] fifo_max_depth;
 wire fifo_depth_incre = write_en && !fifo_full_reg && !read_en;
 wire fifo_depth_decre = read_en && !fifo_empty_reg && !write_en;
 
 always @ (posedge clk or posedge rst) begin
   if (rst) begin
-    fifo_depth_reg    <= {ADDR_WIDTH{1'b0}};
+    fifo_depth_reg    <= {DEPTH_WIDTH{1'b0}};
   end else if (fifo_depth_incre) begin
     fifo_depth_reg    <= fifo_depth_reg + 1;
   end else if (fifo_depth_decre) begin
@@ -153,7 +156,7 @@ end
 
 always @ (posedge clk or negedge rst) begin
   if (rst) begin
-    fifo_max_depth    <= {ADDR_WIDTH{1'b0}};
+    fifo_max_depth    <= {DEPTH_WIDTH{1'b0}};
   end else if (fifo_max_depth < fifo_depth_reg) begin
     fifo_max_depth    <= fifo_depth_reg;
   end
@@ -0,0 +1,114 @@
+// -----------------------------------------------------------------------------
+// This file exports the module `global_pool_array`, which folds the input tiles
+// into the channel accumulators of the global pooling layer (max or avg). The
+// first pixel of the frame loads the accumulators, and the results are only
+// output for the last pixel.
+// -----------------------------------------------------------------------------
+
+module global_pool_array #(
+  parameter                         h = 7,            // input feature map spatial dim
+  parameter                         w = 7,
+  parameter                         Nin = 3,          // input feature map no.
+  parameter                         Pin = 2,          // input feature map parallelism
+  parameter                         BIT_WIDTH = 8,    // bit width of the data path
+  // pooling method: support for {MAX, AVG}
+  parameter                         POOL_METHOD = "AVG"
+) (
+  input wire                        clk,              // system clock
+  input wire                        rst,              // system reset
+  input wire                        pool_array_en,    // pool array enable
+  input wire  [clog2(ceil_div(Nin, Pin))-1:0]
+                                    pool_array_select,// accumulator tile index
+  input wire                        pool_array_first, // first pixel of the frame
+  input wire                        pool_array_last,  // last pixel of the frame
+  input wire  [Pin*BIT_WIDTH-1:0]   pool_data,        // pool data (from pixel mux)
+
+  output reg                        pool_array_valid, // pool array valid signal
+  output reg  [Pin*BIT_WIDTH-1:0]   pool_array_data
+);
+
+`include "functions.v"
+
+// --------------------
+// Inferred parameters
+// --------------------
+// tiled input parallelism
+localparam      TILED_IN_PARALLEL = ceil_div(Nin, Pin);
+// accumulator bit width: the sum of the frame never overflows
+localparam      ACC_WIDTH = (POOL_METHOD == "AVG") ?
+                  BIT_WIDTH + clog2(h*w) : BIT_WIDTH;
+
+// -------------------
+// interconnections
+// -------------------
+// accumulators: one word per input tile
+reg [Pin*ACC_WIDTH-1:0] acc_mem [TILED_IN_PARALLEL-1:0];
+// accumulated results of the current tile
+reg signed [ACC_WIDTH-1:0] acc_result [Pin-1:0];
+// pool array calculated results
+reg signed [ACC_WIDTH-1:0] pool_result [Pin-1:0];
+wire [Pin*BIT_WIDTH-1:0] pool_result_flatten;
+
+integer i;
+genvar g;
+
+// ------------------------------------------------
+// Accumulation: load on the 1st pixel of the frame
+// ------------------------------------------------
+generate
+  for (g = 0; g < Pin; g = g + 1) begin: acc_array_g
+    // sign extended input data & current accumulator
+    wire signed [ACC_WIDTH-1:0] in_data =
+      $signed(pool_data[g*BIT_WIDTH +: BIT_WIDTH]);
+    wire signed [ACC_WIDTH-1:0] acc_data =
+      acc_mem[pool_array_select][g*ACC_WIDTH +: ACC_WIDTH];
+
+    if (POOL_METHOD == "MAX") begin
+      always @ (*) begin
+        acc_result[g]     = acc_data;
+        if (pool_array_first || acc_data < in_data) begin
+          acc_result[g]   = in_data;
+        end
+        pool_result[g]    = acc_result[g];
+      end
+    end else if (POOL_METHOD == "AVG") begin
+      always @ (*) begin
+        acc_result[g]     = pool_array_first ? in_data : acc_data + in_data;
+        // TODO: divided by a constant
+        pool_result[g]    = acc_result[g] / (h*w);
+      end
+    end else begin
+      //$display("undefined pooling method: %s", POOL_METHOD);
+    end
+
+    assign pool_result_flatten[g*BIT_WIDTH+:BIT_WIDTH] =
+      pool_result[g][BIT_WIDTH-1:0];
+  end
+endgenerate
+
+// write back the accumulators of the tile
+always @ (posedge clk) begin
+  if (pool_array_en) begin
+    for (i = 0; i < Pin; i = i + 1) begin
+      acc_mem[pool_array_select][i*ACC_WIDTH +: ACC_WIDTH] <= acc_result[i];
+    end
+  end
+end
+
+// ---------------------------------------------
+// Output stage: only valid for the last pixel
+// ---------------------------------------------
+always @ (posedge clk or posedge rst) begin
+  if (rst) begin
+    pool_array_valid    <= 1'b0;
+  end else begin
+    pool_array_valid    <= pool_array_en & pool_array_last;
+  end
+end
+always @ (posedge clk) begin
+  if (pool_array_en & pool_array_last) begin
+    pool_array_data     <= pool_result_flatten;
+  end
+end
+
+endmodule
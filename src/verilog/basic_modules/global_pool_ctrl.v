@@ -0,0 +1,285 @@
+// -----------------------------------------------------------------------------
+// This file exports the module `global_pool_ctrl`, which tracks the computation
+// status for a global pooling layer. Each accepted pixel is folded into the
+// channel accumulators tile by tile, and the output pixel is only sent after
+// the last pixel of the feature map.
+// -----------------------------------------------------------------------------
+
+module global_pool_ctrl #(
+  parameter                       h = 7,            // input feature map spatial dim
+  parameter                       w = 7,
+  parameter                       Nin = 3,          // input feature map no.
+  parameter                       Pin = 1,          // input feature map parallelism
+  parameter                       BIT_WIDTH = 8     // bit width of data
+)
+(
+  input wire                      clk,              // system clock
+  input wire                      rst,              // system reset (active high)
+
+  // global control to enable the computation
+  input wire                      enable,           // enable computation
+
+  // handshake of previous layer & next layer
+  input wire                      prev_layer_valid, // previous layer valid
+  output reg                      prev_layer_rdy,   // previous layer ready
+  input wire                      next_layer_rdy,   // next layer ready
+  output reg                      next_layer_valid, // next layer valid
+
+  // -----------------------
+  // data path contol logic
+  // -----------------------
+  // data path: pixel mux
+  output reg                      pixel_load,       // load the accepted pixel
+  output reg                      mux_enable,       // pixel mux enable
+  output reg  [clog2(ceil_div(Nin, Pin))-1:0]
+                                  mux_select,       // pixel mux select
+
+  // data path: global pooling unit
+  output reg                      pool_array_en,    // pool array enable
+  output reg  [clog2(ceil_div(Nin, Pin))-1:0]
+                                  pool_array_select,// accumulator tile index
+  output reg                      pool_array_first, // first pixel of the frame
+  output reg                      pool_array_last,  // last pixel of the frame
+
+  // data path: output register file write path
+  // write enable is provided by the global pooling unit
+  output reg  [clog2(ceil_div(Nin, Pin))-1:0]
+                                  out_regfile_waddr // output register file write address
+);
+
+`include "functions.v"
+
+// --------------------
+// Inferred parameters
+// --------------------
+// tiled input parallelism
+localparam      TILED_IN_PARALLEL = ceil_div(Nin, Pin);
+// pixel number of the input feature map
+localparam      NUM_PIXELS = h * w;
+// output register file write pipeline stage: pixel mux & accumulator
+localparam      OUT_REGFILE_WRITE_PIPELINE = 2;
+// output ready status counter: pixel mux, accumulator & output register
+localparam      OUT_READY_CNT = 3;
+
+// ---------------------------
+// FSM related states
+// ---------------------------
+localparam      STATE_IDLE = 2'd0,
+                STATE_WAIT_FOR_INPUT = 2'd1,
+                STATE_DO_POOLING = 2'd2,
+                STATE_WAIT_FOR_OUT_READY = 2'd3;
+
+// generation iterator
+genvar g;
+
+// FSM state register
+reg [1:0] state_reg, state_next;
+// pixel track index of the feature map
+reg [clog2(NUM_PIXELS+1)-1:0] pixel_idx_reg, pixel_idx_next;
+// first & last pixel flags of the accepted pixel
+reg first_pixel_reg, first_pixel_next;
+reg last_pixel_reg, last_pixel_next;
+// output ready status counter
+reg [clog2(OUT_READY_CNT)-1:0] out_ready_counter, out_ready_counter_next;
+
+// computation related register
+// input tiled parallelism index
+reg [clog2(TILED_IN_PARALLEL)-1:0] tiled_in_idx_reg, tiled_in_idx_next;
+wire [clog2(TILED_IN_PARALLEL)-1:0] tile_in_idx_increment;
+
+// output register module control signals (pipeline to align with the data path)
+reg [clog2(ceil_div(Nin, Pin))-1:0] out_regfile_waddr_;
+// pipeline signals
+reg [clog2(ceil_div(Nin, Pin))-1:0] out_regfile_waddr_pipeline
+    [OUT_REGFILE_WRITE_PIPELINE-1:0];
+
+// ------------------------------
+// increments of the tiled index
+// ------------------------------
+assign tile_in_idx_increment    = tiled_in_idx_reg + 1;
+
+// ---------------
+// FSM definition
+// ---------------
+always @ (posedge clk or posedge rst) begin
+  if (rst) begin
+    state_reg   <= STATE_IDLE;
+  end else begin
+    state_reg   <= state_next;
+  end
+end
+// FSM next state logic
+always @ (*) begin
+  // default values (avoid latches)
+  pixel_idx_next    = pixel_idx_reg;
+  first_pixel_next  = first_pixel_reg;
+  last_pixel_next   = last_pixel_reg;
+  state_next        = state_reg;
+  tiled_in_idx_next = tiled_in_idx_reg;
+  out_ready_counter_next  = out_ready_counter;
+  // disable the pixel load by default
+  pixel_load        = 1'b0;
+  // disable the ready signal for the previous layer
+  prev_layer_rdy    = 1'b0;
+  // disbale the valid signal for the next layer
+  next_layer_valid  = 1'b0;
+
+  case (state_reg)
+    STATE_IDLE: begin
+      if (rst == 1'b0 && enable == 1'b1) begin
+        state_next  = STATE_WAIT_FOR_INPUT;
+      end
+    end
+
+    STATE_WAIT_FOR_INPUT: begin
+      prev_layer_rdy      = 1'b1;
+      if (prev_layer_valid) begin
+        // load the 1st input tile into the pixel mux
+        pixel_load        = 1'b1;
+        // flag the first & last pixel of the feature map
+        first_pixel_next  = (pixel_idx_reg == 0);
+        last_pixel_next   = (pixel_idx_reg == NUM_PIXELS-1);
+        // increments the track index
+        pixel_idx_next    = (pixel_idx_reg == NUM_PIXELS-1) ? 0 :
+          pixel_idx_reg + 1;
+
+        // fold the pixel into the accumulators in the next state
+        state_next        = STATE_DO_POOLING;
+        // reset the computation registers
+        tiled_in_idx_next = {clog2(TILED_IN_PARALLEL){1'b0}};
+      end
+    end
+
+    STATE_DO_POOLING: begin
+      // for global pooling only 1 level of loop unroll is applied
+      tiled_in_idx_next = (tiled_in_idx_reg == TILED_IN_PARALLEL-1) ?
+        {clog2(TILED_IN_PARALLEL){1'b0}} : tile_in_idx_increment;
+
+      // state transfer
+      if (tiled_in_idx_reg == TILED_IN_PARALLEL-1) begin
+        if (last_pixel_reg) begin
+          // the output pixel is ready after draining the pipeline
+          state_next    = STATE_WAIT_FOR_OUT_READY;
+          // clear the out ready counter
+          out_ready_counter_next  = {clog2(OUT_READY_CNT){1'b0}};
+        end else begin
+          state_next    = STATE_WAIT_FOR_INPUT;
+        end
+      end
+    end
+
+    STATE_WAIT_FOR_OUT_READY: begin
+      if (out_ready_counter == OUT_READY_CNT-1) begin
+        next_layer_valid  = 1'b1;
+        if (next_layer_rdy) begin
+          // finish computation of the one entire feature map
+          state_next      = STATE_IDLE;
+        end
+      end else begin
+        out_ready_counter_next  = out_ready_counter + 1;
+      end
+    end
+  endcase
+end
+
+// ------------------------
+// Feature map track index
+// ------------------------
+always @ (posedge clk or posedge rst) begin
+  if (rst) begin
+    pixel_idx_reg   <= {clog2(NUM_PIXELS+1){1'b0}};
+    first_pixel_reg <= 1'b0;
+    last_pixel_reg  <= 1'b0;
+  end else begin
+    pixel_idx_reg   <= pixel_idx_next;
+    first_pixel_reg <= first_pixel_next;
+    last_pixel_reg  <= last_pixel_next;
+  end
+end
+
+// --------------------------------------------------------
+// Output ready status counter: finish the entire pipeline
+// --------------------------------------------------------
+always @(posedge clk or posedge rst) begin
+  if (rst) begin
+    out_ready_counter <= {clog2(OUT_READY_CNT){1'b0}};
+  end else begin
+    out_ready_counter <= out_ready_counter_next;
+  end
+end
+
+// ---------------------------
+// computing related register
+// ---------------------------
+always @ (posedge clk or posedge rst) begin
+  if (rst) begin
+    tiled_in_idx_reg  <= {clog2(TILED_IN_PARALLEL){1'b0}};
+  end else begin
+    tiled_in_idx_reg  <= tiled_in_idx_next;
+  end
+end
+
+// ------------------------------
+// pixel mux control logic
+// ------------------------------
+always @ (*) begin
+  // disable the pixel mux enable by default
+  mux_enable    = 1'b0;
+
+  if (state_reg == STATE_DO_POOLING) begin
+    // the 1st tile has been loaded in the handshake cycle
+    mux_enable  = 1'b1;
+  end
+end
+
+always @ (*) begin
+  mux_select    = tiled_in_idx_reg;
+end
+
+// ----------------------------
+// Global pooling array control
+// ----------------------------
+// pool array control: delay one cycle to align with the pixel mux output
+always @ (posedge clk or posedge rst) begin
+  if (rst) begin
+    pool_array_en         <= 1'b0;
+    pool_array_select     <= {clog2(ceil_div(Nin, Pin)){1'b0}};
+    pool_array_first      <= 1'b0;
+    pool_array_last       <= 1'b0;
+  end else begin
+    pool_array_en         <= (state_reg == STATE_DO_POOLING);
+    pool_array_select     <= tiled_in_idx_reg;
+    pool_array_first      <= first_pixel_reg;
+    pool_array_last       <= last_pixel_reg;
+  end
+end
+
+// -------------------------------------
+// Output register file write path
+// -------------------------------------
+always @(*) begin
+  out_regfile_waddr_    = {clog2(ceil_div(Nin, Pin)){1'b0}};
+  if (state_reg == STATE_DO_POOLING) begin
+    out_regfile_waddr_  = tiled_in_idx_reg;
+  end
+end
+// write data path control pipeline
+generate
+for (g = 0; g < OUT_REGFILE_WRITE_PIPELINE; g = g + 1) begin: out_regfile_write_g
+  if (g == 0) begin
+    always @(posedge clk) begin
+      out_regfile_waddr_pipeline[g] <= out_regfile_waddr_;
+    end
+  end else begin
+    always @(posedge clk) begin
+      out_regfile_waddr_pipeline[g] <= out_regfile_waddr_pipeline[g-1];
+    end
+  end
+end
+endgenerate
+// primary output assignment
+always @(*) begin
+  out_regfile_waddr = out_regfile_waddr_pipeline[OUT_REGFILE_WRITE_PIPELINE-1];
+end
+
+endmodule
@@ -0,0 +1,182 @@
+// -----------------------------------------------------------------------------
+// This file exports the module `global_pool_layer_pe`, which is the top module
+// of the global pooling processing element (pe), i.e. the pooling window covers
+// the entire input feature map without padding. It keeps one accumulator per
+// channel instead of the line buffers of the feature map.
+// -----------------------------------------------------------------------------
+
+module global_pool_layer_pe #(
+  parameter                       h = 7,            // input feature map spatial dim
+  parameter                       w = 7,
+  parameter                       Nin = 3,          // input feature map no.
+  parameter                       Pin = 1,          // input feature map parallelism
+  parameter                       BIT_WIDTH = 8,    // bit width of data
+  // pooling method: {MAX, AVG}
+  parameter                       POOL_METHOD = "AVG"
+) (
+  input wire                      clk,              // system clock
+  input wire                      rst,              // system reset
+
+  // controller enable
+  input wire                      enable,           // enable (active high)
+
+  // input data path with handshake
+  input wire                      prev_layer_valid, // previous layer valid
+  output wire                     prev_layer_rdy,   // previous layer ready
+  input wire  [Nin*BIT_WIDTH-1:0] prev_layer_data,  // previous layer data
+  // output data path with handshake
+  input wire                      next_layer_rdy,   // next layer ready
+  output wire                     next_layer_valid, // next layer data valid
+  output wire [Nin*BIT_WIDTH-1:0] next_layer_data   // next layer data
+
+`ifdef DEBUG
+, // debug io interface
+  output wire [Pin*BIT_WIDTH-1:0]             mux_array_output_data,
+  output wire [Pin*BIT_WIDTH-1:0]             pool_array_output_data
+`endif
+);
+
+`include "functions.v"
+
+// -----------------------------
+// Interconnections declaration
+// -----------------------------
+// --------------------------
+// pixel mux
+// --------------------------
+wire pixel_load;
+wire mux_enable;
+wire [clog2(ceil_div(Nin, Pin))-1:0] mux_select;
+wire [Pin*BIT_WIDTH-1:0] mux_array_data;
+// -------------------------------
+// global pool array unit
+// -------------------------------
+wire pool_array_en;
+wire [clog2(ceil_div(Nin, Pin))-1:0] pool_array_select;
+wire pool_array_first;
+wire pool_array_last;
+wire [Pin*BIT_WIDTH-1:0] pool_array_data;
+wire pool_array_valid;
+// -------------------------------
+// output register file
+// -------------------------------
+wire [clog2(ceil_div(Nin, Pin))-1:0] out_regfile_waddr;
+
+// -------------------------------
+// Main block instantiation
+// -------------------------------
+// FSM controller to coordinate the data path
+global_pool_ctrl #(
+  .h                  (h),                  // input feature map spatial dim
+  .w                  (w),
+  .Nin                (Nin),                // input feature map no.
+  .Pin                (Pin),                // input feature map parallelism
+  .BIT_WIDTH          (BIT_WIDTH)           // bit width of data
+) global_pool_ctrl_inst
+(
+  .clk                (clk),                // system clock
+  .rst                (rst),                // system reset (active high)
+
+  // global control to enable the computation
+  .enable             (enable),             // enable computation
+
+  // handshake of previous layer & next layer
+  .prev_layer_valid   (prev_layer_valid),   // previous layer valid
+  .prev_layer_rdy     (prev_layer_rdy),     // previous layer ready
+  .next_layer_rdy     (next_layer_rdy),     // next layer ready
+  .next_layer_valid   (next_layer_valid),   // next layer valid
+
+  // -----------------------
+  // data path contol logic
+  // -----------------------
+  // data path: pixel mux
+  .pixel_load         (pixel_load),         // load the accepted pixel
+  .mux_enable         (mux_enable),         // pixel mux enable
+  .mux_select         (mux_select),         // pixel mux select
+
+  // data path: global pooling unit
+  .pool_array_en      (pool_array_en),      // pool array enable
+  .pool_array_select  (pool_array_select),  // accumulator tile index
+  .pool_array_first   (pool_array_first),   // first pixel of the frame
+  .pool_array_last    (pool_array_last),    // last pixel of the frame
+
+  // data path: output register file write path
+  // write enable is provided by the global pooling unit
+  .out_regfile_waddr  (out_regfile_waddr)   // output register file write address
+);
+
+// ---------------------------------------------------------------------------
+// Pixel mux: holds the accepted pixel and selects the desired Pin channels of
+// each input tile
+// ---------------------------------------------------------------------------
+pixel_mux #(
+  .Nin                (Nin),                // input feature map number
+  .Pin                (Pin),                // input feature map parallelism
+  .BIT_WIDTH          (BIT_WIDTH)           // bit width
+) pixel_mux_inst (
+  .clk                (clk),                // system clock
+  .pixel_load         (pixel_load),         // load the accepted pixel
+  .prev_layer_data    (prev_layer_data),    // previous layer data
+  .mux_enable         (mux_enable),         // enable (active high)
+  .mux_select         (mux_select),         // mux select signal
+  .mux_array_out_data (mux_array_data)      // mux array output data
+);
+
+// -----------------------------------------------------------------------------
+// Global pooling array unit: accumulates the max or the sum of each channel
+// across the frame.
+// -----------------------------------------------------------------------------
+global_pool_array #(
+  .h                  (h),                  // input feature map spatial dim
+  .w                  (w),
+  .Nin                (Nin),                // input feature map no.
+  .Pin                (Pin),                // input feature map parallelism
+  .BIT_WIDTH          (BIT_WIDTH),          // bit width of the data path
+  // pooling method: support for {MAX, AVG}
+  .POOL_METHOD        (POOL_METHOD)
+) global_pool_array_inst (
+  .clk                (clk),                // system clock
+  .rst                (rst),                // system reset
+  .pool_array_en      (pool_array_en),      // pool array enable
+  .pool_array_select  (pool_array_select),  // accumulator tile index
+  .pool_array_first   (pool_array_first),   // first pixel of the frame
+  .pool_array_last    (pool_array_last),    // last pixel of the frame
+  .pool_data          (mux_array_data),     // pool data (from pixel mux)
+
+  .pool_array_valid   (pool_array_valid),   // pool array valid signal
+  .pool_array_data    (pool_array_data)
+);
+
+// -----------------------------------------------------------------------
+// Output register file: pooling unit does NOT require the read enable
+// -----------------------------------------------------------------------
+out_regfile #(
+  .Nout                   (Nin),            // output feature map number
+  .Pout                   (Pin),            // output feature map parallelism
+  .BIT_WIDTH              (BIT_WIDTH)       // bit width of each element
+) out_regfile_inst
+(
+  .clk                    (clk),            // system clock
+
+  // write path
+  .write_en               (pool_array_valid),   // write enable (active high)
+  .write_addr             (out_regfile_waddr),  // write address
+  .write_data             (pool_array_data),    // write data
+  // read path (disable for pooling unit)
+  .read_en                (1'b0),           // read enable (active high)
+  .read_addr              ({clog2(ceil_div(Nin, Pin)){1'b0}}),  // read address
+  .read_data              (/* floating */),     // read data (no. = Pout)
+
+  // register file memory: for output feature map
+  .regfile                (next_layer_data) // all the contents of register file
+);
+
+// --------------------------------
+// Output signals for debug
+// --------------------------------
+`ifdef DEBUG
+  assign mux_array_output_data = mux_array_data;
+  assign pool_array_output_data = pool_array_data;
+`endif
+
+endmodule
@@ -12,6 +12,10 @@ module kernel_mem #(
   parameter                     Pin = 2,          // input feature map parallelism
   parameter                     Pout = 1,         // output feature map parallelism
   parameter                     BIT_WIDTH = 8,    // bit width of the data path
+  // initialize the behavior rom with the weights in the files
+  // WEIGHT_FILE_<idx>.hex (full ones if WEIGHT_INIT = 0)
+  parameter                     WEIGHT_INIT = 0,
+  parameter                     WEIGHT_FILE = "weight",
   // unmodified inferred parameters
   parameter TILED_IN_PARALLEL   = ceil_div(Nin, Pin),
   parameter TILED_OUT_PARALLEL  = ceil_div(Nout, Pout),
@@ -43,16 +47,31 @@ genvar i, j, k, l;
 `ifdef BEHAV_SIM
 generate
   for (i = 0; i < Pin*Kh*Kw; i = i + 1) begin: rom_gen_i
-    rom_full_ones # (
-      .ROM_DEPTH          (MEM_DEPTH),
-      .NUM_DATA           (Pout),
-      .BIT_WIDTH          (BIT_WIDTH)
-    ) rom_full_ones_inst (
-      .clk                (clk),            // system clock
-      .cen                (mem_en[i]),      // chip enable
-      .A                  (mem_addr),       // rom read address
-      .Q                  (Q[i*Pout*BIT_WIDTH+:Pout*BIT_WIDTH])
-    );
+    if (WEIGHT_INIT) begin: rom_init_gen
+      rom_init_file # (
+        .ROM_DEPTH        (MEM_DEPTH),
+        .NUM_DATA         (Pout),
+        .BIT_WIDTH        (BIT_WIDTH),
+        .INIT_FILE        (WEIGHT_FILE),
+        .ROM_IDX          (i)
+      ) rom_init_file_inst (
+        .clk              (clk),            // system clock
+        .cen              (mem_en[i]),      // chip enable
+        .A                (mem_addr),       // rom read address
+        .Q                (Q[i*Pout*BIT_WIDTH+:Pout*BIT_WIDTH])
+      );
+    end else begin: rom_full_ones_gen
+      rom_full_ones # (
+        .ROM_DEPTH        (MEM_DEPTH),
+        .NUM_DATA         (Pout),
+        .BIT_WIDTH        (BIT_WIDTH)
+      ) rom_full_ones_inst (
+        .clk              (clk),            // system clock
+        .cen              (mem_en[i]),      // chip enable
+        .A                (mem_addr),       // rom read address
+        .Q                (Q[i*Pout*BIT_WIDTH+:Pout*BIT_WIDTH])
+      );
+    end
   end
 endgenerate
 `else
@@ -0,0 +1,106 @@
+// -----------------------------------------------------------------------------
+// This file exports the module `pixel_mux`, which replaces the line buffer
+// array & the mux array of the pointwise (1x1 kernel without padding)
+// convolutional layer. The first Pin channels of the accepted pixel are loaded
+// into the output register in the handshake cycle, so only the remaining
+// Nin-Pin channels are held in the pixel register for the following input
+// tiles.
+// -----------------------------------------------------------------------------
+
+module pixel_mux #(
+  parameter                           Nin = 3,        // input feature map number
+  parameter                           Pin = 2,        // input feature map parallelism
+  parameter                           BIT_WIDTH = 8,  // bit width
+
+  // unmodified parameter
+  parameter                           NUM_INPUT = ceil_div(Nin, Pin)
+) (
+  input wire                          clk,            // system clock
+  input wire                          pixel_load,     // load the accepted pixel (active high)
+  input wire  [Nin*BIT_WIDTH-1:0]     prev_layer_data,// previous layer data
+  input wire                          mux_enable,     // enable (active high)
+  input wire  [clog2(NUM_INPUT)-1:0]  mux_select,     // mux select signal
+  output reg  [Pin*BIT_WIDTH-1:0]     mux_array_out_data  // mux array output data
+);
+
+`include "functions.v"
+
+generate
+if (Nin == Pin) begin
+  // ---------------------------------------------
+  // corner case: Nin = Pin
+  // the accepted pixel is the only input tile
+  // ---------------------------------------------
+  always @(posedge clk) begin
+    if (pixel_load) begin
+      mux_array_out_data    <= prev_layer_data;
+    end
+  end
+end else begin
+  // --------------------------------------------------
+  // General case: the 1st tile is taken from the input
+  // --------------------------------------------------
+  genvar i, j;
+  reg [(Nin-Pin)*BIT_WIDTH-1:0] pixel_reg;
+  wire [NUM_INPUT*BIT_WIDTH-1:0] mux_input_data [Pin-1:0];
+  wire [BIT_WIDTH-1:0] mux_output_data [Pin-1:0];
+  // the 1st tile is selected by the pixel load, which is not re-selected by
+  // the mux enable since the input is not held after the handshake
+  wire mux_array_en = pixel_load | (mux_enable & (|mux_select));
+  wire [clog2(NUM_INPUT)-1:0] mux_array_select = pixel_load ?
+    {clog2(NUM_INPUT){1'b0}} : mux_select;
+
+  // -----------------------------------------
+  // pixel register: channels of tiles 1, 2..
+  // -----------------------------------------
+  always @(posedge clk) begin
+    if (pixel_load) begin
+      pixel_reg             <= prev_layer_data[Nin*BIT_WIDTH-1:Pin*BIT_WIDTH];
+    end
+  end
+
+  // --------------------------
+  // assign the mux input data
+  // --------------------------
+  for (i = 0; i < Pin; i = i + 1) begin: mux_input_data_i
+    for (j = 0; j < NUM_INPUT; j = j + 1) begin: mux_input_data_j
+      if (j == 0) begin
+        assign mux_input_data[i][j*BIT_WIDTH+:BIT_WIDTH] =
+          prev_layer_data[i*BIT_WIDTH+:BIT_WIDTH];
+      end else if (i+j*Pin < Nin) begin
+        assign mux_input_data[i][j*BIT_WIDTH+:BIT_WIDTH] =
+          pixel_reg[(i+(j-1)*Pin)*BIT_WIDTH+:BIT_WIDTH];
+      end else begin
+        // tailing case: non-divisble Nin / Pin
+        assign mux_input_data[i][j*BIT_WIDTH+:BIT_WIDTH] =
+          {BIT_WIDTH{1'b0}};
+      end
+    end
+  end
+
+  // ------------------
+  // mux instantiation
+  // ------------------
+  for (i = 0; i < Pin; i = i + 1) begin: mux_inst_i
+    mux #(.NUM_INPUT(NUM_INPUT), .BIT_WIDTH(BIT_WIDTH)) mux_inst (
+      .input_data    (mux_input_data[i]),                 // input data array
+      .select        (mux_array_select),                  // select control
+      .output_data   (mux_output_data[i])                 // output data
+    );
+  end
+
+  // ----------------
+  // Output pipeline
+  // ----------------
+  for (i = 0; i < Pin; i = i + 1) begin: output_reg_i
+    always @(posedge clk) begin
+      if (mux_array_en) begin
+        mux_array_out_data[i*BIT_WIDTH+:BIT_WIDTH] <=
+          mux_output_data[i];
+      end
+    end
+  end
+end // generate (Nin > Pin)
+endgenerate
+
+endmodule
@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------
+// This file exports the module `requantize`, which converts the pixel of each
+// channel from one signed bit width to another. The narrower bit width
+// saturates the pixel to its range, and the wider one sign-extends the pixel.
+// It is purely combinational.
+// -----------------------------------------------------------------------------
+
+module requantize #(
+  parameter                           IN_BIT_WIDTH = 16,    // input bit width
+  parameter                           OUT_BIT_WIDTH = 8,    // output bit width
+  parameter                           NUM_CHANNEL = 3       // channel number
+) (
+  input wire  [NUM_CHANNEL*IN_BIT_WIDTH-1:0]
+                                      in_data,              // input data
+  output wire [NUM_CHANNEL*OUT_BIT_WIDTH-1:0]
+                                      out_data              // output data
+);
+
+genvar i;
+generate
+for (i = 0; i < NUM_CHANNEL; i = i + 1) begin: gen_channel
+  wire [IN_BIT_WIDTH-1:0] in_pixel = in_data[i*IN_BIT_WIDTH +: IN_BIT_WIDTH];
+  if (OUT_BIT_WIDTH == IN_BIT_WIDTH) begin: gen_wire
+    assign out_data[i*OUT_BIT_WIDTH +: OUT_BIT_WIDTH] = in_pixel;
+  end else if (OUT_BIT_WIDTH > IN_BIT_WIDTH) begin: gen_extend
+    // sign extension
+    assign out_data[i*OUT_BIT_WIDTH +: OUT_BIT_WIDTH] =
+      {{(OUT_BIT_WIDTH-IN_BIT_WIDTH){in_pixel[IN_BIT_WIDTH-1]}}, in_pixel};
+  end else begin: gen_saturate
+    // the pixel fits if all the truncated bits equal the output sign bit
+    wire [IN_BIT_WIDTH-OUT_BIT_WIDTH:0] sign_bits =
+      in_pixel[IN_BIT_WIDTH-1:OUT_BIT_WIDTH-1];
+    wire overflow = ~((&sign_bits) | ~(|sign_bits));
+    assign out_data[i*OUT_BIT_WIDTH +: OUT_BIT_WIDTH] = ~overflow ?
+      in_pixel[OUT_BIT_WIDTH-1:0] :
+      in_pixel[IN_BIT_WIDTH-1] ? {1'b1, {(OUT_BIT_WIDTH-1){1'b0}}} :
+      {1'b0, {(OUT_BIT_WIDTH-1){1'b1}}};
+  end
+end
+endgenerate
+
+endmodule
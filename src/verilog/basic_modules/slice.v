@@ -0,0 +1,40 @@
+// -----------------------------------------------------------------------------
+// This file exports the module `slice`, which demultiplexes the output channels
+// of the fused sibling 1x1 convolutions into the branch blobs. The next layer
+// data of the NUM_SLICE branches (little endian) is exactly the previous layer
+// data, so each branch takes its channel range by the concatenation at the
+// instantiation. The ready-valid handshake is the one of the module `split`.
+// -----------------------------------------------------------------------------
+
+module slice #(
+  parameter                           Nin = 3,            // input feature map no.
+  parameter                           NUM_SLICE = 3,      // number of slices (at least 2)
+  parameter                           BIT_WIDTH = 8       // bit width of the data path
+) (
+  input wire                          prev_layer_valid,   // previous layer valid
+  output wire                         prev_layer_rdy,     // previous layer ready
+  input wire  [Nin*BIT_WIDTH-1:0]     prev_layer_data,    // previous layer data
+
+  // next layer data & its handshake of the NUM_SLICE branches
+  input wire  [NUM_SLICE-1:0]         next_layer_rdy,     // next layer ready
+  output wire [NUM_SLICE-1:0]         next_layer_valid,   // next layer valid
+  output wire [Nin*BIT_WIDTH-1:0]     next_layer_data     // next layer data
+);
+
+// -------------------------------------------------------------
+// Next layer data: the channel ranges of the previous layer data
+// -------------------------------------------------------------
+assign next_layer_data = prev_layer_data;
+
+// --------------------------------------------------
+// Previous layer ready: AND of the next layer ready
+// --------------------------------------------------
+assign prev_layer_rdy = &next_layer_rdy;
+
+// ---------------------------------------------------------------------------
+// Next layer valid: only transfer the previous layer valid when all the next
+// layer ready signals are asserted
+// ---------------------------------------------------------------------------
+assign next_layer_valid = {NUM_SLICE{prev_layer_valid & (&next_layer_rdy)}};
+
+endmodule
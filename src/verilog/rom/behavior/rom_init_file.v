@@ -0,0 +1,63 @@
+// -----------------------------------------------------------------------------
+// This file exports the behavior model of a ROM `rom_init_file` initialized
+// from the file INIT_FILE_<ROM_IDX>.hex, where each line is one memory word
+// (NUM_DATA data, the first data in the least significant bits) in hex.
+// -----------------------------------------------------------------------------
+
+// --------------------------------------
+// Active low rom access
+// --------------------------------------
+`define ROM_ENABLE 1'b0
+`define ROM_DISABLE 1'b1
+
+module rom_init_file #(
+  parameter                   ROM_DEPTH = 1024,   // rom depth
+  parameter                   NUM_DATA = 1,       // the number of data in a memory word
+  parameter                   BIT_WIDTH = 16,     // bit width of one data
+  parameter                   INIT_FILE = "weight",
+                                                  // prefix of the init file
+  parameter                   ROM_IDX = 0         // index of the init file
+) (
+  input wire                  clk,                // system clock
+  input wire                  cen,                // chip enable (active low)
+  input wire  [clog2(ROM_DEPTH)-1:0]
+                              A,                  // rom read address
+  output reg  [NUM_DATA*BIT_WIDTH-1:0]
+                              Q                   // rom read data
+);
+
+// ---------------------------
+// Ceiling of log2
+// ---------------------------
+function integer clog2(input integer n);
+  integer i;
+  begin
+    clog2 = 0;
+    for (i = n - 1; i > 0; i = i >> 1) begin
+      clog2   = clog2 + 1;
+    end
+  end
+endfunction
+
+// ---------------------------
+// Memory initialization
+// ---------------------------
+reg [NUM_DATA*BIT_WIDTH-1:0] mem [0:ROM_DEPTH-1];
+reg [8*256-1:0] filename;
+initial begin
+  $sformat(filename, "%0s_%0d.hex", INIT_FILE, ROM_IDX);
+  $readmemh(filename, mem);
+end
+
+// -----------------------------------------------------------
+// Behavior of the ROM (output the memory word when chip enable)
+// -----------------------------------------------------------
+always @(posedge clk) begin
+  if (cen == `ROM_ENABLE) begin
+    Q         <= mem[A];
+  end else begin
+    Q         <= {(NUM_DATA*BIT_WIDTH){1'bx}};
+  end
+end
+
+endmodule
@@ -9,12 +9,16 @@
 #include "header/caffe/layers/conv_layer.hpp"
 #include "header/caffe/layers/inner_product_layer.hpp"
 #include "header/caffe/layers/pooling_layer.hpp"
+#include "header/parallelism_solver.hpp"
+#include "header/systemc/parallelism_allocator.hpp"
+#include "header/throughput_analyzer.hpp"
 #include <iostream>
 #include <fstream>
 #include <ctime>
 #include <sys/stat.h>
 #include <sstream>
 #include <math.h>
+#include <algorithm>
 
 using namespace std;
 using namespace config;
@@ -39,6 +43,8 @@ VerilogCompiler::VerilogCompiler(const Net& net, const ConfigParameter&
 
   // TODO: bit width of the data path (from the configuration network)
   bit_width_ = config_param.bit_width();
+  weight_file_ = config_param.weight_file();
+  layer_precision_ = new LayerPrecision(net, config_param);
   // TODO: pipeline stage for a better performace
   mult_pipeline_ = 2;
   add_pipeline_ = 2;
@@ -50,7 +56,25 @@ VerilogCompiler::VerilogCompiler(const Net& net, const ConfigParameter&
   inception_buffer_depth_ = config_param.inception_buffer_depth();
 
   // TODO: determine the parallelism
-  InitParallelism(net, config_param.pixel_inference_rate());
+  InitParallelism(net, config_param);
+  // size each channel buffer by the analytical prediction, where the skip
+  // channel buffers of the residual blocks are always predicted: the shortcut
+  // holds the pixels arriving during the whole residual branch, far beyond
+  // any global buffer depth
+  bool has_eltwise_layer = false;
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    if (net.layers_[layer_id]->layer_param().type() == "Eltwise") {
+      has_eltwise_layer = true;
+    }
+  }
+  if (config_param.predict_buffer_depth() || has_eltwise_layer) {
+    InitBufferDepth(net, config_param.predict_buffer_depth());
+  }
+  // size each channel buffer by the profiling run
+  if (!config_param.buffer_depth_file().empty()) {
+    LoadBufferDepth(config_param.buffer_depth_file(),
+        config_param.buffer_depth_margin());
+  }
 
   // early stop frame size
   early_stop_frame_size_ = config_param.early_stop_frame_size();
@@ -88,8 +112,9 @@ VerilogCompiler::VerilogCompiler(const Net& net, const ConfigParameter&
       interconnections_name_.push_back(interconnection);
       interconnections_to_idx_[interconnection] =
         interconnections_name_.size() - 1;
-    } else if (layer->layer_param().type() == "Split") {
-      // split layer typically has multiple top blobs
+    } else if (layer->layer_param().type() == "Split" ||
+        layer->layer_param().type() == "Slice") {
+      // split & slice layer typically have multiple top blobs
       for (int blob_id = 0; blob_id < layer->layer_param().top_size();
           ++blob_id) {
         const string interconnection = layer->layer_param().top(blob_id);
@@ -97,7 +122,8 @@ VerilogCompiler::VerilogCompiler(const Net& net, const ConfigParameter&
         interconnections_to_idx_[interconnection] =
           interconnections_name_.size() - 1;
       }
-    } else if (layer->layer_param().type() == "Concat") {
+    } else if (layer->layer_param().type() == "Concat" ||
+        layer->layer_param().type() == "Eltwise") {
       const string interconnection = layer->layer_param().top(0);
       interconnections_name_.push_back(interconnection);
       interconnections_to_idx_[interconnection] =
@@ -119,12 +145,18 @@ VerilogCompiler::VerilogCompiler(const Net& net, const ConfigParameter&
 }
 
 VerilogCompiler::~VerilogCompiler() {
+  delete layer_precision_;
 }
 
-void VerilogCompiler::InitParallelism(const Net& net, int pixel_inference_rate) {
+void VerilogCompiler::InitParallelism(const Net& net,
+    const ConfigParameter& config_param) {
   // the actual pixel inference rate is:
   // - CONV: ceil(Nin/Pin) * ceil(Nout/Pout) + ALU datapath overhead
   // - POOL: ceil(Nin/Pin) + ALU datapath overhead
+  const int pixel_inference_rate = config_param.pixel_inference_rate();
+  // allocation under the budget (empty if no budget is set)
+  map<int, pair<int, int> > allocation;
+  AllocateParallelism(net, config_param, &allocation);
 
   // target layer inference rate (inferred from the input layer)
   int layer_inference_rate;
@@ -140,16 +172,19 @@ void VerilogCompiler::InitParallelism(const Net& net, int pixel_inference_rate)
       const int w = net_->top_blobs_shape_ptr_[layer_id][0]->at(3);
       input_spatial_dim_ = h * w;
       layer_inference_rate = (h * w) * pixel_inference_rate;
-      cout << "Inferred the layer inference rate: " << layer_inference_rate
-        << endl;
+      if (allocation.empty()) {
+        cout << "Inferred the layer inference rate: " << layer_inference_rate
+          << endl;
+      }
       continue;
     } else if (layer->layer_param().type() == "Convolution") {
       const int Nin = dynamic_cast<const ConvolutionLayer*>(layer)->num_input_;
       const int Nout = dynamic_cast<const ConvolutionLayer*>(layer)->num_output_;
       const int h = net_->top_blobs_shape_ptr_[layer_id][0]->at(2);
       const int w = net_->top_blobs_shape_ptr_[layer_id][0]->at(3);
-      parallelism_[layer_id] = CalculateParallelsim(Nin, Nout, h, w,
-          layer_inference_rate);
+      parallelism_[layer_id] = allocation.empty() ?
+        CalculateParallelsim(Nin, Nout, h, w, layer_inference_rate) :
+        allocation[layer_id];
       // obtain the calculated parallelism
       const int Pin = parallelism_[layer_id].first;
       const int Pout = parallelism_[layer_id].second;
@@ -163,16 +198,25 @@ void VerilogCompiler::InitParallelism(const Net& net, int pixel_inference_rate)
       }
       layer_inference_rate_array.push_back(make_pair(layer_id, inference_rate));
     } else if (layer->layer_param().type() == "Pooling") {
-      const int Nin = dynamic_cast<const PoolingLayer*>(layer)->num_input_;
+      const PoolingLayer* pool_layer = dynamic_cast<const PoolingLayer*>(
+          layer);
+      const int Nin = pool_layer->num_input_;
       const int Nout = 0;   // reserve pooling's Nout = 0
-      const int h = net_->top_blobs_shape_ptr_[layer_id][0]->at(2);
-      const int w = net_->top_blobs_shape_ptr_[layer_id][0]->at(3);
-      parallelism_[layer_id] = CalculateParallelsim(Nin, Nout, h, w,
-          layer_inference_rate);
+      // the global pooling computes each input pixel, and only emits one
+      // output pixel per frame
+      const bool global_pool = pool_layer->global_pooling();
+      const int h = global_pool ? pool_layer->h_ :
+        net_->top_blobs_shape_ptr_[layer_id][0]->at(2);
+      const int w = global_pool ? pool_layer->w_ :
+        net_->top_blobs_shape_ptr_[layer_id][0]->at(3);
+      parallelism_[layer_id] = allocation.empty() ?
+        CalculateParallelsim(Nin, Nout, h, w, layer_inference_rate) :
+        allocation[layer_id];
       // obtain the calculated parallelism
       const int Pin = parallelism_[layer_id].first;
-      // pipeline includes: mux array, pooling, write back
-      const int datapath_pipeline = 1 + pool_pipeline_ + 1;
+      // pipeline includes: mux array, pooling, write back (handshake of each
+      // input pixel for the global pooling)
+      const int datapath_pipeline = global_pool ? 1 : 1 + pool_pipeline_ + 1;
       const int inference_rate = (ceil(static_cast<double>(Nin)/Pin) +
           datapath_pipeline) * h * w;
       if (max_layer_inference_rate < inference_rate) {
@@ -186,8 +230,9 @@ void VerilogCompiler::InitParallelism(const Net& net, int pixel_inference_rate)
       // inner-product layer has the output feature map dim = 1
       const int h = 1;
       const int w = 1;
-      parallelism_[layer_id] = CalculateParallelsim(Nin, Nout, h, w,
-          layer_inference_rate);
+      parallelism_[layer_id] = allocation.empty() ?
+        CalculateParallelsim(Nin, Nout, h, w, layer_inference_rate) :
+        allocation[layer_id];
       // obtain the calculated parallelism
       const int Pin = parallelism_[layer_id].first;
       const int Pout = parallelism_[layer_id].second;
@@ -218,8 +263,51 @@ void VerilogCompiler::InitParallelism(const Net& net, int pixel_inference_rate)
       << "rate " << inference_rate << endl;
   }
   cout << "Max layer inference rate: " << max_layer_inference_rate << endl;
-  cout << "Press ENTER to continue";
-  cin.get();
+  max_layer_inference_rate_ = max_layer_inference_rate;
+}
+
+/*
+ * Implementation notes: AllocateParallelism
+ * ------------------------------------------
+ * The budget is distributed by the same ParallelismAllocator as TlmConvNetAcc
+ * & ConvNetAcc, so that the generated RTL is the simulated hardware. The
+ * allocation is constrained to the RTL datapath: the processing element
+ * computes the whole kernel at once (no kernel unrolling), takes one pixel per
+ * handshake (no spatial unrolling), has the pipeline of memory access,
+ * multiplier, adder, nonlinear & write back, and needs at least
+ * 1+nonlin_pipeline output tiles (see CalculateParallelsimSearch).
+ */
+void VerilogCompiler::AllocateParallelism(const Net& net,
+    const ConfigParameter& config_param,
+    map<int, pair<int, int> >* allocation) const {
+  if (config_param.multiplier_budget() > 0 && config_param.area_budget() > 0) {
+    cerr << "[ERROR]: only one of multiplier_budget & area_budget can be set"
+      << endl;
+    exit(1);
+  }
+  if (config_param.multiplier_budget() <= 0 &&
+      config_param.area_budget() <= 0) {
+    return;
+  }
+  ConfigParameter rtl_config = config_param;
+  rtl_config.set_kernel_unrolling_flag(false);
+  const int datapath_pipeline = 1 + mult_pipeline_ + add_pipeline_ +
+    nonlin_pipeline_ + 1;
+  ParallelismAllocator allocator(net, rtl_config, datapath_pipeline,
+      1 + nonlin_pipeline_, false);
+  if (config_param.multiplier_budget() > 0) {
+    allocator.Allocate(ParallelismAllocator::MULTIPLIER,
+        config_param.multiplier_budget());
+  } else {
+    allocator.Allocate(ParallelismAllocator::AREA, config_param.area_budget());
+  }
+  allocator.Summary();
+  for (map<int, ParallelismAllocator::LayerAllocation>::const_iterator iter =
+      allocator.allocation().begin(); iter != allocator.allocation().end();
+      ++iter) {
+    (*allocation)[iter->first] = make_pair(iter->second.Pin,
+        iter->second.Pout);
+  }
 }
 
 pair<int, int> VerilogCompiler::CalculateParallelsim(int Nin, int Nout, int h,
@@ -249,31 +337,20 @@ pair<int, int> VerilogCompiler::CalculateParallelsim(int Nin, int Nout, int h,
     double rate = static_cast<double>(layer_inference_rate) / (h * w) -
       datapath_pipeline;
     if (rate <= 0) rate = 1;
-    return CalculateParallelsimBruteForce(Nin, Nout, rate);
+    return CalculateParallelsimSearch(Nin, Nout, rate);
   }
 }
 
 // Search for the (Pin, Pout) which provides the closest results:
 //  ceil(Nin/Pin) * ceil(Nout/Pout) = rate
 // Necessary condition: ceil(Nout/Pout) >= 1 + nonlin_pipeline_
-pair<int, int> VerilogCompiler::CalculateParallelsimBruteForce(int Nin,
+pair<int, int> VerilogCompiler::CalculateParallelsimSearch(int Nin,
     int Nout, double rate) const {
-  // search through all possible combinations of Pin & Pout
-  double min = Nin * Nout;
-  int Pin = 1;
-  int Pout = 1;
-  for (int Pin_ = 1; Pin_ <= Nin; ++Pin_) {
-    for (int Pout_ = 1; Pout_ <= Nout; ++Pout_) {
-      double current_rate = ceil(static_cast<double>(Nin)/Pin_) *
-        ceil(static_cast<double>(Nout)/Pout_);
-      if (abs(current_rate - rate) < min &&
-          ceil(static_cast<double>(Nout)/Pout_) >= (1 + nonlin_pipeline_)) {
-        min = abs(current_rate - rate);
-        Pin = Pin_;
-        Pout = Pout_;
-      }
-    }
-  }
+  // search through the distinct quotients of Pin & Pout (no kernel unrolling)
+  const pair<pair<int, int>, int> parallelism = SolveParallelism(Nin, Nout, 1,
+      false, rate, 1 + nonlin_pipeline_, Nin * Nout);
+  const int Pin = parallelism.first.first;
+  const int Pout = parallelism.first.second;
   // sanity check: make sure the dependency relationship holds
   if (ceil(static_cast<double>(Nout)/Pout) < 1 + nonlin_pipeline_) {
     cout << "[ERROR]: the resource allocation has the dependency issue"
@@ -313,6 +390,10 @@ void VerilogCompiler::GenerateProj(const string& folder) {
   GenerateFlist(flist_folder);
   // Generate the simulation script
   GenerateSim(sim_folder);
+  // Generate the kernel rom init files, loaded in the simulation folder
+  if (!weight_file_.empty()) {
+    GenerateWeightInit(sim_folder);
+  }
 }
 
 void VerilogCompiler::GenerateLib(const string& folder) const {
@@ -354,7 +435,8 @@ void VerilogCompiler::GenerateSim(const string& folder) const {
     << " -f $(FLIST) $(TESTBENCH_RTL) +define+$(MACRO)"
     << " -timescale=$(TIME_SCALE) +incdir+$(SEARCH_PATH)"
     << " -v $(LIB_PATH)/rom_full_ones.v"
-    << " -v $(LIB_PATH)/rom_full_zeros.v" << endl << endl;
+    << " -v $(LIB_PATH)/rom_full_zeros.v"
+    << " -v $(LIB_PATH)/rom_init_file.v" << endl << endl;
   outFile << "clean:" << endl;
   outFile << "\trm -fr csrc simv simv.daidir" << endl;
   outFile << "\trm -fr DVE* ucli* *.vpd" << endl;
@@ -382,7 +464,11 @@ void VerilogCompiler::GenerateFlist(const string& folder) const {
   outFile << "concat.v" << endl;
   outFile << "conv_layer_ctrl.v" << endl;
   outFile << "conv_layer_pe.v" << endl;
+  outFile << "eltwise.v" << endl;
   outFile << "fifo_sync.v" << endl;
+  outFile << "global_pool_array.v" << endl;
+  outFile << "global_pool_ctrl.v" << endl;
+  outFile << "global_pool_layer_pe.v" << endl;
   outFile << "kernel_mem.v" << endl;
   outFile << "line_buffer.v" << endl;
   outFile << "line_buffer_array.v" << endl;
@@ -393,10 +479,13 @@ void VerilogCompiler::GenerateFlist(const string& folder) const {
   outFile << "mux_array.v" << endl;
   outFile << "nonlinear.v" << endl;
   outFile << "out_regfile.v" << endl;
+  outFile << "pixel_mux.v" << endl;
   outFile << "pool_array.v" << endl;
   outFile << "pool_layer_ctrl.v" << endl;
   outFile << "pool_layer_pe.v" << endl;
+  outFile << "requantize.v" << endl;
   outFile << "row_buffer.v" << endl;
+  outFile << "slice.v" << endl;
   outFile << "split.v" << endl;
 
   outFile.close();
@@ -496,10 +585,13 @@ void VerilogCompiler::GenerateSimRTL(const string& filename) const {
   outFile << "initial begin" << endl;
   outFile << "\tfp = $fopen(\"buffer_depth.list\", \"w\");" << endl;
   outFile << "\twait(stop_sim == 1'b1);" << endl;
-  for (vector<string>::const_iterator iter = channel_buffer_module_.begin();
-      iter != channel_buffer_module_.end(); ++iter) {
-    outFile << "\t$fdisplay(fp, \"" << *iter << " %d\", uut."
-      << *iter << ".genblk1.fifo_sync_inst.fifo_max_depth);" << endl;
+  for (vector<pair<string, int> >::const_iterator iter =
+      channel_buffer_module_.begin(); iter != channel_buffer_module_.end();
+      ++iter) {
+    // module name, max depth & buffer depth of the profiling run
+    outFile << "\t$fdisplay(fp, \"" << iter->first << " %0d " << iter->second
+      << "\", uut." << iter->first << ".genblk1.fifo_sync_inst.fifo_max_depth);"
+      << endl;
   }
   outFile << "\t$fclose(fp);" << endl;
   outFile << "\t$finish;" << endl;
@@ -509,6 +601,100 @@ void VerilogCompiler::GenerateSimRTL(const string& filename) const {
   outFile.close();
 }
 
+void VerilogCompiler::GenerateWeightInit(const string& folder) const {
+  const WeightLoader weight_loader(weight_file_);
+  for (size_t layer_id = 0; layer_id < net_->layers_.size(); ++layer_id) {
+    const Layer* layer = net_->layers_[layer_id];
+    if (layer->layer_param().type() == "Convolution") {
+      const ConvolutionLayer* conv_layer =
+        dynamic_cast<const ConvolutionLayer*>(layer);
+      GenerateWeightInit(folder, weight_loader, layer->layer_param().name(),
+          conv_layer->num_input_, conv_layer->num_output_, conv_layer->kh_,
+          conv_layer->kw_, conv_layer->group_,
+          parallelism_.find(layer_id)->second.first,
+          parallelism_.find(layer_id)->second.second,
+          layer_precision_->LayerBitWidth(layer_id));
+    } else if (layer->layer_param().type() == "InnerProduct") {
+      // the kernel covers the whole bottom feature map (if 4D)
+      const vector<int>* bottom_shape =
+        net_->bottom_blobs_shape_ptr_[layer_id][0];
+      const int Nin = bottom_shape->at(1);
+      const int Kh = (bottom_shape->size() == 4) ? bottom_shape->at(2) : 1;
+      const int Kw = (bottom_shape->size() == 4) ? bottom_shape->at(3) : 1;
+      GenerateWeightInit(folder, weight_loader, layer->layer_param().name(),
+          Nin, dynamic_cast<const InnerProductLayer*>(layer)->num_output_, Kh,
+          Kw, 1, parallelism_.find(layer_id)->second.first,
+          parallelism_.find(layer_id)->second.second,
+          layer_precision_->LayerBitWidth(layer_id));
+    }
+  }
+}
+
+/*
+ * Implementation notes: GenerateWeightInit
+ * -----------------------------------------
+ * The kernel_mem instantiates Pin*Kh*Kw roms, where the rom of the jth input
+ * of the tile & kernel location (k, l) is indexed by j*Kh*Kw+k*Kw+l, and its
+ * word holds the weights of the Pout outputs of the tile. The address follows
+ * the conv_layer_ctrl: tiled_in_idx*ceil(Nout/Pout)+tiled_out_idx. The weights
+ * beyond the channel depth are zeros. A fused convolution takes the weights of
+ * its sibling convolutions in the caffemodel.
+ */
+void VerilogCompiler::GenerateWeightInit(const string& folder,
+    const WeightLoader& weight_loader, const string& layer_name, int Nin,
+    int Nout, int Kh, int Kw, int group, int Pin, int Pout, int bit_width)
+  const {
+  vector<int> weights;
+  const int frac_bits = weight_loader.QuantizeWeights(
+      net_->SourceLayers(layer_name), Nout, Nin, Kh*Kw, group, bit_width,
+      weights);
+  const int tiled_in = static_cast<int>(ceil(static_cast<double>(Nin)/Pin));
+  const int tiled_out = static_cast<int>(ceil(static_cast<double>(Nout)/Pout));
+
+  for (int j = 0; j < Pin; ++j) {
+    for (int k = 0; k < Kh*Kw; ++k) {
+      stringstream filename;
+      filename << folder << "/" << layer_name << "_weight_" << j*Kh*Kw+k
+        << ".hex";
+      ofstream outFile(filename.str().c_str());
+      if (!outFile) {
+        cerr << "[ERROR]: weight file " << filename.str() << " can NOT open!"
+          << endl;
+        exit(1);
+      }
+      outFile << "// " << layer_name << ": " << bit_width << "-bit weights, "
+        << frac_bits << " fraction bits" << endl;
+      for (int ti = 0; ti < tiled_in; ++ti) {
+        for (int to = 0; to < tiled_out; ++to) {
+          // bits of the word from the MSB, zero-extended to the hex digits,
+          // where the weight of the ith output is at the least significant
+          // bits
+          string bits((4 - Pout*bit_width%4) % 4, '0');
+          for (int i = Pout-1; i >= 0; --i) {
+            const int out = to*Pout + i;
+            const int in = ti*Pin + j;
+            const int weight = (out < Nout && in < Nin) ?
+              weights[(out*Nin+in)*Kh*Kw+k] : 0;
+            for (int b = bit_width-1; b >= 0; --b) {
+              // two's complement: sign-extended beyond 32 bits
+              bits += ((weight >> min(b, 31)) & 1) ? '1' : '0';
+            }
+          }
+          for (size_t d = 0; d < bits.size(); d += 4) {
+            const int digit = (bits[d]-'0')*8 + (bits[d+1]-'0')*4 +
+              (bits[d+2]-'0')*2 + (bits[d+3]-'0');
+            outFile << "0123456789abcdef"[digit];
+          }
+          outFile << endl;
+        }
+      }
+      outFile.close();
+    }
+  }
+  cout << "Generated the kernel rom init files of " << layer_name
+    << " - fraction bits: " << frac_bits << endl;
+}
+
 void VerilogCompiler::GenerateRTL(const string& folder) {
   // copy all the basic RTL files from the basic modules to the target folder
   string cmd = "cp ./src/verilog/basic_modules/*.v " + folder;
@@ -600,34 +786,39 @@ void VerilogCompiler::GenerateInterconnections(ostream& os) const {
     if (layer->layer_param().type() == "Input") {
       const string interconnection = layer->layer_param().top(0);
       const int top_depth = net_->top_blobs_shape_ptr_[layer_id][0]->at(1);
+      const int bit_width = layer_precision_->BlobBitWidth(interconnection);
       os << "wire " << interconnection << "_valid;" << endl;
       os << "wire " << interconnection << "_rdy;" << endl;
-      os << "wire [" << top_depth*bit_width_-1 << ":0] " << interconnection
+      os << "wire [" << top_depth*bit_width-1 << ":0] " << interconnection
         << "_data;" << endl;
     } else if (layer->layer_param().type() == "Convolution" ||
         layer->layer_param().type() == "Pooling" ||
         layer->layer_param().type() == "InnerProduct") {
       const string interconnection = layer->layer_param().top(0);
       const int top_depth = net_->top_blobs_shape_ptr_[layer_id][0]->at(1);
+      const int bit_width = layer_precision_->BlobBitWidth(interconnection);
       os << "wire " << interconnection << "_valid;" << endl;
       os << "wire " << interconnection << "_rdy;" << endl;
-      os << "wire [" << top_depth*bit_width_-1 << ":0] " << interconnection
+      os << "wire [" << top_depth*bit_width-1 << ":0] " << interconnection
         << "_data;" << endl;
-      // for inter-channel buffer
+      // for inter-channel buffer: at the bit width of the layer
+      const int layer_bit_width = layer_precision_->LayerBitWidth(layer_id);
       os << "wire " << interconnection << "_inter_layer_buffer_valid;" << endl;
       os << "wire " << interconnection << "_inter_layer_buffer_rdy;" << endl;
-      os << "wire [" << top_depth*bit_width_-1 << ":0] " << interconnection
-        << "_inter_layer_buffer_data;" << endl;
-    } else if (layer->layer_param().type() == "Split") {
-      // split layer typically has multiple top blobs
+      os << "wire [" << top_depth*layer_bit_width-1 << ":0] "
+        << interconnection << "_inter_layer_buffer_data;" << endl;
+    } else if (layer->layer_param().type() == "Split" ||
+        layer->layer_param().type() == "Slice") {
+      // split & slice layer typically have multiple top blobs
       for (int blob_id = 0; blob_id < layer->layer_param().top_size();
           ++blob_id) {
         const string interconnection = layer->layer_param().top(blob_id);
         const int top_depth = net_->top_blobs_shape_ptr_[layer_id][blob_id]
           ->at(1);
+        const int bit_width = layer_precision_->BlobBitWidth(interconnection);
         os << "wire " << interconnection << "_valid;" << endl;
         os << "wire " << interconnection << "_rdy;" << endl;
-        os << "wire [" << top_depth*bit_width_-1 << ":0] " << interconnection
+        os << "wire [" << top_depth*bit_width-1 << ":0] " << interconnection
           << "_data;" << endl;
       }
     } else if (layer->layer_param().type() == "Concat") {
@@ -637,18 +828,44 @@ void VerilogCompiler::GenerateInterconnections(ostream& os) const {
         const string interconnection = layer->layer_param().bottom(blob_id);
         const int bottom_depth = net_->bottom_blobs_shape_ptr_[layer_id]
           [blob_id]->at(1);
+        const int bit_width = layer_precision_->BlobBitWidth(interconnection);
         os << "wire " << interconnection << "_inception_channel_buffer_valid;"
           << endl;
         os << "wire " << interconnection << "_inception_channel_buffer_rdy;"
           << endl;
-        os << "wire [" << bottom_depth*bit_width_-1 << ":0]" << interconnection
+        os << "wire [" << bottom_depth*bit_width-1 << ":0]" << interconnection
           << "_inception_channel_buffer_data;" << endl;
       }
       const string interconnection = layer->layer_param().top(0);
       const int top_depth = net_->top_blobs_shape_ptr_[layer_id][0]->at(1);
+      const int bit_width = layer_precision_->BlobBitWidth(interconnection);
       os << "wire " << interconnection << "_valid;" << endl;
       os << "wire " << interconnection << "_rdy;" << endl;
-      os << "wire [" << top_depth*bit_width_-1 << ":0] " << interconnection
+      os << "wire [" << top_depth*bit_width-1 << ":0] " << interconnection
+        << "_data;" << endl;
+    } else if (layer->layer_param().type() == "Eltwise") {
+      // all the bottom blobs are required to prepend skip buffer
+      for (int blob_id = 0; blob_id < layer->layer_param().bottom_size();
+          ++blob_id) {
+        const string prev_connection = layer->layer_param().bottom(blob_id);
+        const string interconnection = interconnections_name_[
+          interconnections_to_idx_.find(prev_connection)->second];
+        const int bottom_depth = net_->bottom_blobs_shape_ptr_[layer_id]
+          [blob_id]->at(1);
+        const int bit_width = layer_precision_->BlobBitWidth(prev_connection);
+        os << "wire " << interconnection << "_skip_channel_buffer_valid;"
+          << endl;
+        os << "wire " << interconnection << "_skip_channel_buffer_rdy;"
+          << endl;
+        os << "wire [" << bottom_depth*bit_width-1 << ":0] " << interconnection
+          << "_skip_channel_buffer_data;" << endl;
+      }
+      const string interconnection = layer->layer_param().top(0);
+      const int top_depth = net_->top_blobs_shape_ptr_[layer_id][0]->at(1);
+      const int bit_width = layer_precision_->BlobBitWidth(interconnection);
+      os << "wire " << interconnection << "_valid;" << endl;
+      os << "wire " << interconnection << "_rdy;" << endl;
+      os << "wire [" << top_depth*bit_width-1 << ":0] " << interconnection
         << "_data;" << endl;
     }
   }
@@ -676,12 +893,20 @@ void VerilogCompiler::GenerateInstantiation(ostream& os) {
       GenerateInterLayerChannelBuffer(os, layer_id, 0);
     } else if (layer->layer_param().type() == "Split") {
       GenerateSplitLayer(os, layer_id);
+    } else if (layer->layer_param().type() == "Slice") {
+      GenerateSliceLayer(os, layer_id);
     } else if (layer->layer_param().type() == "Concat") {
       for (int blob_id = 0; blob_id < layer->layer_param().bottom_size();
           ++blob_id) {
         GenerateInceptionChannelBuffer(os, layer_id, blob_id);
       }
       GenerateConcatLayer(os, layer_id);
+    } else if (layer->layer_param().type() == "Eltwise") {
+      for (int blob_id = 0; blob_id < layer->layer_param().bottom_size();
+          ++blob_id) {
+        GenerateSkipChannelBuffer(os, layer_id, blob_id);
+      }
+      GenerateEltwiseLayer(os, layer_id);
     }
   }
   GenerateOutputLayer(os, net_->layers_.size()-1);
@@ -743,7 +968,8 @@ void VerilogCompiler::GenerateConcatLayer(std::ostream& os, int layer_id)
   os << "concat #(" << endl;
   os << "\t.Nout\t\t\t\t" << "(" << Nout << ")," << endl;
   os << "\t.NUM_SPLIT\t\t" << "(" << numSplits << ")," << endl;
-  os << "\t.BIT_WIDTH\t\t" << "(" << bit_width_ << ")" << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->BlobBitWidth(next_name)
+    << ")" << endl;
   os << ") " << layer->layer_param().name() << " (" << endl;
   // previous ready (little endian)
   os << "\t.prev_layer_rdy\t\t" << "({";
@@ -781,6 +1007,65 @@ void VerilogCompiler::GenerateConcatLayer(std::ostream& os, int layer_id)
   os << ");" << endl;
 }
 
+void VerilogCompiler::GenerateEltwiseLayer(std::ostream& os, int layer_id)
+  const {
+  const Layer* layer = net_->layers_[layer_id];
+  // instantiate module `eltwise` for Eltwise layer
+  os << "// Layer name: " << layer->layer_param().name() << "; Type: "
+    << "Eltwise" << endl;
+  // parse the eltwise related parameters
+  const int Nin = net_->top_blobs_shape_ptr_[layer_id][0]->at(1);
+  const int numInputs = net_->bottom_blobs_shape_ptr_[layer_id].size();
+  string eltwise_op;
+  switch (layer->layer_param().eltwise_param().operation()) {
+    case caffe::EltwiseParameter_EltwiseOp_PROD:
+      eltwise_op = "PROD";
+      break;
+    case caffe::EltwiseParameter_EltwiseOp_MAX:
+      eltwise_op = "MAX";
+      break;
+    default:
+      eltwise_op = "SUM";
+      break;
+  }
+  // each bottom blob comes from its skip channel buffer
+  vector<string> prev_name;
+  for (int blob_id = 0; blob_id < layer->layer_param().bottom_size();
+      ++blob_id) {
+    const string prev_connection = layer->layer_param().bottom(blob_id);
+    const int prev_connection_idx = interconnections_to_idx_.
+      find(prev_connection)->second;
+    prev_name.push_back(interconnections_name_[prev_connection_idx] +
+        "_skip_channel_buffer");
+  }
+  const string next_name = layer->layer_param().top(0);
+
+  os << "eltwise #(" << endl;
+  os << "\t.Nin\t\t\t\t" << "(" << Nin << ")," << endl;
+  os << "\t.NUM_INPUT\t\t" << "(" << numInputs << ")," << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->BlobBitWidth(next_name)
+    << ")," << endl;
+  os << "\t.ELTWISE_OP\t\t" << "(\"" << eltwise_op << "\")" << endl;
+  os << ") " << layer->layer_param().name() << " (" << endl;
+  // previous ready, valid & data (little endian)
+  const char* prev_ports[3] = {"rdy", "valid", "data"};
+  for (int port = 0; port < 3; ++port) {
+    os << "\t.prev_layer_" << prev_ports[port] << "\t\t" << "({";
+    for (int blob_id = prev_name.size()-1; blob_id >= 0; --blob_id) {
+      os << prev_name[blob_id] << "_" << prev_ports[port];
+      if (blob_id != 0) {
+        os << ", ";
+      }
+    }
+    os << "})," << endl;
+  }
+  // next layer
+  os << "\t.next_layer_rdy\t\t" << "(" << next_name << "_rdy)," << endl;
+  os << "\t.next_layer_valid\t\t" << "(" << next_name << "_valid)," << endl;
+  os << "\t.next_layer_data\t\t" << "(" << next_name << "_data)" << endl;
+  os << ");" << endl;
+}
+
 void VerilogCompiler::GenerateSplitLayer(std::ostream& os, int layer_id) const {
   const Layer* layer = net_->layers_[layer_id];
   // instantiate module `split_layer_pe` for Split layer
@@ -802,7 +1087,8 @@ void VerilogCompiler::GenerateSplitLayer(std::ostream& os, int layer_id) const {
   os << "split #(" << endl;
   os << "\t.Nin\t\t\t\t" << "(" << Nin << ")," << endl;
   os << "\t.NUM_SPLIT\t\t" << "(" << numSplits << ")," << endl;
-  os << "\t.BIT_WIDTH\t\t" << "(" << bit_width_ << ")" << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->BlobBitWidth(
+      prev_connection) << ")" << endl;
   os << ") " << layer->layer_param().name() << " (" << endl;
   os << "\t.prev_layer_valid\t\t" << "(" << prev_name << "_valid)," << endl;
   os << "\t.prev_layer_rdy\t\t" << "(" << prev_name << "_rdy)," << endl;
@@ -839,6 +1125,44 @@ void VerilogCompiler::GenerateSplitLayer(std::ostream& os, int layer_id) const {
   os << ");" << endl;
 }
 
+void VerilogCompiler::GenerateSliceLayer(std::ostream& os, int layer_id) const {
+  const Layer* layer = net_->layers_[layer_id];
+  // instantiate module `slice` for Slice layer
+  os << "// Layer name: " << layer->layer_param().name() << "; Type: "
+    << "Slice" << endl;
+  // parse the slice related parameters
+  const int Nin = net_->bottom_blobs_shape_ptr_[layer_id][0]->at(1);
+  const int numSlices = net_->top_blobs_shape_ptr_[layer_id].size();
+  const string prev_connection = layer->layer_param().bottom(0);
+  const int prev_connection_idx = interconnections_to_idx_.find(prev_connection)
+    ->second;
+  const string prev_name = interconnections_name_[prev_connection_idx];
+
+  os << "slice #(" << endl;
+  os << "\t.Nin\t\t\t\t" << "(" << Nin << ")," << endl;
+  os << "\t.NUM_SLICE\t\t" << "(" << numSlices << ")," << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->BlobBitWidth(
+      prev_connection) << ")" << endl;
+  os << ") " << layer->layer_param().name() << " (" << endl;
+  os << "\t.prev_layer_valid\t\t" << "(" << prev_name << "_valid)," << endl;
+  os << "\t.prev_layer_rdy\t\t" << "(" << prev_name << "_rdy)," << endl;
+  os << "\t.prev_layer_data\t\t" << "(" << prev_name << "_data)," << endl;
+  // use concatenation for the slices in little endian, so each slice takes its
+  // channel range of the data
+  const char* next_ports[3] = {"rdy", "valid", "data"};
+  for (int port = 0; port < 3; ++port) {
+    os << "\t.next_layer_" << next_ports[port] << "\t\t" << "({";
+    for (int blob_id = numSlices-1; blob_id >= 0; --blob_id) {
+      os << layer->layer_param().top(blob_id) << "_" << next_ports[port];
+      if (blob_id != 0) {
+        os << ", ";
+      }
+    }
+    os << ((port < 2) ? "})," : "})") << endl;
+  }
+  os << ");" << endl;
+}
+
 void VerilogCompiler::GeneratePoolingLayer(std::ostream& os, int layer_id)
   const {
   const Layer* layer = net_->layers_[layer_id];
@@ -874,20 +1198,33 @@ void VerilogCompiler::GeneratePoolingLayer(std::ostream& os, int layer_id)
   const string prev_name = interconnections_name_[prev_connection_idx];
   const string next_name = layer->layer_param().top(0) + "_inter_layer_buffer";
 
-  os << "pool_layer_pe #(" << endl;
-  os << "\t.Kh\t\t\t\t" << "(" << Kh << ")," << endl;
-  os << "\t.Kw\t\t\t\t" << "(" << Kw << ")," << endl;
-  os << "\t.h\t\t\t\t" << "(" << h << ")," << endl;
-  os << "\t.w\t\t\t\t" << "(" << w << ")," << endl;
-  os << "\t.Nin\t\t\t\t" << "(" << Nin << ")," << endl;
-  os << "\t.pad_h\t\t" << "(" << Pad_h << ")," << endl;
-  os << "\t.pad_w\t\t" << "(" << Pad_w << ")," << endl;
-  os << "\t.stride_h\t\t" << "(" << Stride_h << ")," << endl;
-  os << "\t.stride_w\t\t" << "(" << Stride_w << ")," << endl;
-  os << "\t.Pin\t\t\t\t" << "(" << Pin << ")," << endl;
-  os << "\t.BIT_WIDTH\t\t" << "(" << bit_width_ << ")," << endl;
-  os << "\t.POOL_METHOD\t\t" << "(\"" << pool_method << "\")," << endl;
-  os << "\t.POOL_PIPELINE\t\t" << "(" << pool_pipeline_ << ")" << endl;
+  if (dynamic_cast<const PoolingLayer*>(layer)->global_pooling()) {
+    // global pooling: accumulators of each channel w/o the line buffers
+    os << "global_pool_layer_pe #(" << endl;
+    os << "\t.h\t\t\t\t" << "(" << h << ")," << endl;
+    os << "\t.w\t\t\t\t" << "(" << w << ")," << endl;
+    os << "\t.Nin\t\t\t\t" << "(" << Nin << ")," << endl;
+    os << "\t.Pin\t\t\t\t" << "(" << Pin << ")," << endl;
+    os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->LayerBitWidth(
+        layer_id) << ")," << endl;
+    os << "\t.POOL_METHOD\t\t" << "(\"" << pool_method << "\")" << endl;
+  } else {
+    os << "pool_layer_pe #(" << endl;
+    os << "\t.Kh\t\t\t\t" << "(" << Kh << ")," << endl;
+    os << "\t.Kw\t\t\t\t" << "(" << Kw << ")," << endl;
+    os << "\t.h\t\t\t\t" << "(" << h << ")," << endl;
+    os << "\t.w\t\t\t\t" << "(" << w << ")," << endl;
+    os << "\t.Nin\t\t\t\t" << "(" << Nin << ")," << endl;
+    os << "\t.pad_h\t\t" << "(" << Pad_h << ")," << endl;
+    os << "\t.pad_w\t\t" << "(" << Pad_w << ")," << endl;
+    os << "\t.stride_h\t\t" << "(" << Stride_h << ")," << endl;
+    os << "\t.stride_w\t\t" << "(" << Stride_w << ")," << endl;
+    os << "\t.Pin\t\t\t\t" << "(" << Pin << ")," << endl;
+    os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->LayerBitWidth(layer_id)
+      << ")," << endl;
+    os << "\t.POOL_METHOD\t\t" << "(\"" << pool_method << "\")," << endl;
+    os << "\t.POOL_PIPELINE\t\t" << "(" << pool_pipeline_ << ")" << endl;
+  }
   os << ") " << layer->layer_param().name() << " (" << endl;
   os << "\t.clk\t\t\t\t" << "(clk)," << endl;
   os << "\t.rst\t\t\t\t" << "(rst)," << endl;
@@ -955,13 +1292,17 @@ void VerilogCompiler::GenerateInnerProductLayer(std::ostream& os, int layer_id)
   os << "\t.stride_w\t\t\t\t" << "(" << Stride_w << ")," << endl;
   os << "\t.Pin\t\t\t\t" << "(" << Pin << ")," << endl;
   os << "\t.Pout\t\t\t\t" << "(" << Pout << ")," << endl;
-  os << "\t.BIT_WIDTH\t\t" << "(" << bit_width_ << ")," << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->LayerBitWidth(layer_id)
+    << ")," << endl;
   os << "\t.MULT_PIPELINE\t\t" << "(" << mult_pipeline_ << ")," << endl;
   os << "\t.ADD_PIPELINE\t\t" << "(" << add_pipeline_ << ")," << endl;
   os << "\t.NONLIN_PIPELINE\t\t" << "(" << nonlin_pipeline_ << ")," << endl;
   // TODO: always enable bias & nonlinear
   os << "\t.BIAS_EN\t\t" << "(1)," << endl;
-  os << "\t.NONLIN_EN\t\t" << "(1)" << endl;
+  os << "\t.NONLIN_EN\t\t" << "(1)," << endl;
+  os << "\t.WEIGHT_INIT\t\t" << "(" << !weight_file_.empty() << ")," << endl;
+  os << "\t.WEIGHT_FILE\t\t" << "(\"" << layer->layer_param().name()
+    << "_weight\")" << endl;
   os << ") " << layer->layer_param().name() << " (" << endl;
   os << "\t.clk\t\t\t\t" << "(clk)," << endl;
   os << "\t.rst\t\t\t\t" << "(rst)," << endl;
@@ -1015,13 +1356,17 @@ void VerilogCompiler::GenerateConvolutionLayer(std::ostream& os, int layer_id)
   os << "\t.stride_w\t\t\t\t" << "(" << Stride_w << ")," << endl;
   os << "\t.Pin\t\t\t\t" << "(" << Pin << ")," << endl;
   os << "\t.Pout\t\t\t\t" << "(" << Pout << ")," << endl;
-  os << "\t.BIT_WIDTH\t\t" << "(" << bit_width_ << ")," << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->LayerBitWidth(layer_id)
+    << ")," << endl;
   os << "\t.MULT_PIPELINE\t\t" << "(" << mult_pipeline_ << ")," << endl;
   os << "\t.ADD_PIPELINE\t\t" << "(" << add_pipeline_ << ")," << endl;
   os << "\t.NONLIN_PIPELINE\t\t" << "(" << nonlin_pipeline_ << ")," << endl;
   // TODO: always enable bias & nonlinear
   os << "\t.BIAS_EN\t\t" << "(1)," << endl;
-  os << "\t.NONLIN_EN\t\t" << "(1)" << endl;
+  os << "\t.NONLIN_EN\t\t" << "(1)," << endl;
+  os << "\t.WEIGHT_INIT\t\t" << "(" << !weight_file_.empty() << ")," << endl;
+  os << "\t.WEIGHT_FILE\t\t" << "(\"" << layer->layer_param().name()
+    << "_weight\")" << endl;
   os << ") " << layer->layer_param().name() << " (" << endl;
   os << "\t.clk\t\t\t\t" << "(clk)," << endl;
   os << "\t.rst\t\t\t\t" << "(rst)," << endl;
@@ -1035,6 +1380,131 @@ void VerilogCompiler::GenerateConvolutionLayer(std::ostream& os, int layer_id)
   os << ");" << endl;
 }
 
+/*
+ * Implementation notes: InitBufferDepth
+ * --------------------------------------
+ * The output pixel latency of each layer follows the inference rate of the
+ * determined parallelism in InitParallelism. The synchronous fifo of the
+ * channel buffer addresses its entries with clog2(BUFFER_DEPTH) bits, so any
+ * non-zero predicted depth is rounded up to 2, whereas a zero depth bypasses
+ * the fifo. Unless all the buffers are predicted, only the skip channel buffers
+ * are sized.
+ */
+static int RoundBufferDepth(int depth) {
+  return (depth == 0) ? 0 : max(depth, 2);
+}
+
+void VerilogCompiler::InitBufferDepth(const Net& net, bool predict_all) {
+  map<int, int> layer_latency;
+  for (map<int, pair<int, int> >::const_iterator iter = parallelism_.begin();
+      iter != parallelism_.end(); ++iter) {
+    const int layer_id = iter->first;
+    const Layer* layer = net.layers_[layer_id];
+    const int Nin = net.bottom_blobs_shape_ptr_[layer_id][0]->at(1);
+    const int Pin = iter->second.first;
+    const int Pout = iter->second.second;
+    if (layer->layer_param().type() == "Pooling" &&
+        dynamic_cast<const PoolingLayer*>(layer)->global_pooling()) {
+      // the global pooling is analyzed by the computation of each input pixel
+      layer_latency[layer_id] = ceil(static_cast<double>(Nin)/Pin);
+    } else if (layer->layer_param().type() == "Pooling") {
+      // pipeline includes: mux array, pooling, write back
+      layer_latency[layer_id] = ceil(static_cast<double>(Nin)/Pin) + 1 +
+        pool_pipeline_ + 1;
+    } else {
+      // pipeline includes: memory access, multiplier, adder, nonlinear, wb
+      const int Nout = net.top_blobs_shape_ptr_[layer_id][0]->at(1);
+      layer_latency[layer_id] = ceil(static_cast<double>(Nin)/Pin) *
+        ceil(static_cast<double>(Nout)/Pout) + 1 + mult_pipeline_ +
+        add_pipeline_ + nonlin_pipeline_ + 1;
+    }
+  }
+
+  const ThroughputAnalyzer analyzer(net, layer_latency);
+  analyzer.Summary();
+  for (size_t layer_id = 0; layer_id < net.layers_.size(); ++layer_id) {
+    const caffe::LayerParameter& layer_param =
+      net.layers_[layer_id]->layer_param();
+    if (predict_all && (layer_param.type() == "Convolution" ||
+          layer_param.type() == "InnerProduct" ||
+          layer_param.type() == "Pooling")) {
+      const int depth = analyzer.InterLayerBufferDepth(layer_id);
+      channel_buffer_depth_[layer_param.name() + "_inter_channel_buffer"] =
+        RoundBufferDepth(depth);
+    } else if (predict_all && layer_param.type() == "Concat") {
+      for (int blob_id = 0; blob_id < layer_param.bottom_size(); ++blob_id) {
+        stringstream module_name_stream;
+        module_name_stream << layer_param.name() <<
+          "_inception_channel_buffer_" << blob_id;
+        channel_buffer_depth_[module_name_stream.str()] =
+          RoundBufferDepth(analyzer.InceptionBufferDepth(layer_id, blob_id));
+      }
+    } else if (layer_param.type() == "Eltwise") {
+      for (int blob_id = 0; blob_id < layer_param.bottom_size(); ++blob_id) {
+        stringstream module_name_stream;
+        module_name_stream << layer_param.name() <<
+          "_skip_channel_buffer_" << blob_id;
+        channel_buffer_depth_[module_name_stream.str()] =
+          RoundBufferDepth(analyzer.SkipBufferDepth(layer_id, blob_id));
+      }
+    }
+  }
+}
+
+/*
+ * Implementation notes: LoadBufferDepth
+ * --------------------------------------
+ * Each line of the buffer depth file is "<module name> <max depth> <buffer
+ * depth>", as recorded by the simulation top of GenerateSimRTL. The channel
+ * buffers absent from the file (not instantiated as a fifo in the profiling
+ * run) keep their depth. The resized depth is at least 2 for the synchronous
+ * fifo. A buffer filled up in the profiling run may have stalled its
+ * producer, so its max depth is only a lower bound: it is rejected, and the
+ * profiling run is to be repeated with a larger buffer depth.
+ */
+void VerilogCompiler::LoadBufferDepth(const string& filename, int margin) {
+  ifstream inFile(filename.c_str());
+  if (!inFile) {
+    cerr << "[ERROR]: buffer depth file " << filename << " can NOT open!"
+      << endl;
+    exit(1);
+  }
+  if (margin < 0) {
+    cerr << "[ERROR]: negative buffer depth margin: " << margin << endl;
+    exit(1);
+  }
+
+  cout << "##################################################" << endl;
+  cout << "# Channel buffer depth from " << filename << endl;
+  cout << "##################################################" << endl;
+  string module_name;
+  int max_depth, capacity;
+  while (inFile >> module_name >> max_depth >> capacity) {
+    if (max_depth >= capacity) {
+      cerr << "[ERROR]: " << module_name << " is full (" << max_depth
+        << ") in the profiling run, increase its buffer depth & profile "
+        "again" << endl;
+      exit(1);
+    }
+    const int depth = max(max_depth + margin, 2);
+    cout << "- " << module_name << " max depth: " << max_depth
+      << " -> buffer depth: " << depth << endl;
+    channel_buffer_depth_[module_name] = depth;
+  }
+  if (!inFile.eof()) {
+    cerr << "[ERROR]: malformed buffer depth file " << filename << endl;
+    exit(1);
+  }
+  inFile.close();
+}
+
+int VerilogCompiler::ChannelBufferDepth(const string& module_name,
+    int default_depth) const {
+  map<string, int>::const_iterator iter =
+    channel_buffer_depth_.find(module_name);
+  return (iter == channel_buffer_depth_.end()) ? default_depth : iter->second;
+}
+
 void VerilogCompiler::GenerateInterLayerChannelBuffer(std::ostream& os,
     int layer_id, int blob_id) {
   const Layer* layer = net_->layers_[layer_id];
@@ -1049,11 +1519,16 @@ void VerilogCompiler::GenerateInterLayerChannelBuffer(std::ostream& os,
   const string module_name = layer->layer_param().name() +
     "_inter_channel_buffer";
 
+  // requantize the pixels of the layer to the next layers
   os << "channel_buffer #(" << endl;
-  os << "\t.BIT_WIDTH\t\t" << "(" << bit_width_ << ")," << endl;
-  os << "\t.BUFFER_DEPTH\t\t" << "(" << inter_layer_buffer_depth_ << "),"
-    << endl;
-  os << "\t.NUM_CHANNEL\t\t" << "(" << num_channel << ")" << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->LayerBitWidth(layer_id)
+    << ")," << endl;
+  const int buffer_depth = ChannelBufferDepth(module_name,
+      inter_layer_buffer_depth_);
+  os << "\t.BUFFER_DEPTH\t\t" << "(" << buffer_depth << ")," << endl;
+  os << "\t.NUM_CHANNEL\t\t" << "(" << num_channel << ")," << endl;
+  os << "\t.OUT_BIT_WIDTH\t\t" << "(" << layer_precision_->BlobBitWidth(
+      next_name) << ")" << endl;
   os << ") " << module_name << " (" << endl;
   os << "\t.clk\t\t\t\t" << "(clk)," << endl;
   os << "\t.rst\t\t\t\t" << "(rst)," << endl;
@@ -1068,8 +1543,8 @@ void VerilogCompiler::GenerateInterLayerChannelBuffer(std::ostream& os,
   os << ");" << endl;
 
   // record the channel buffer name
-  if (inter_layer_buffer_depth_ != 0) {
-    channel_buffer_module_.push_back(module_name);
+  if (buffer_depth != 0) {
+    channel_buffer_module_.push_back(make_pair(module_name, buffer_depth));
   }
 }
 
@@ -1089,8 +1564,52 @@ void VerilogCompiler::GenerateInceptionChannelBuffer(std::ostream& os,
   const string module_name = module_name_stream.str();
 
   os << "channel_buffer #(" << endl;
-  os << "\t.BIT_WIDTH\t\t" << "(" << bit_width_ << ")," << endl;
-  os << "\t.BUFFER_DEPTH\t\t" << "(" << inception_buffer_depth_ << ")," << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->BlobBitWidth(
+      prev_name) << ")," << endl;
+  const int buffer_depth = ChannelBufferDepth(module_name,
+      inception_buffer_depth_);
+  os << "\t.BUFFER_DEPTH\t\t" << "(" << buffer_depth << ")," << endl;
+  os << "\t.NUM_CHANNEL\t\t" << "(" << num_channel << ")" << endl;
+  os << ") " << module_name << " (" << endl;
+  os << "\t.clk\t\t\t\t" << "(clk)," << endl;
+  os << "\t.rst\t\t\t\t" << "(rst)," << endl;
+  os << "\t.prev_layer_valid\t\t" << "(" << prev_name << "_valid)," << endl;
+  os << "\t.prev_layer_rdy\t\t" << "(" << prev_name << "_rdy)," << endl;
+  os << "\t.prev_layer_data\t\t" << "(" << prev_name << "_data)," << endl;
+  os << "\t.next_layer_rdy\t\t" << "(" << next_name << "_rdy)," << endl;
+  os << "\t.next_layer_valid\t\t" << "(" << next_name << "_valid)," << endl;
+  os << "\t.next_layer_data\t\t" << "(" << next_name << "_data)" << endl;
+  os << ");" << endl;
+
+  // record the channel buffer name
+  if (buffer_depth != 0) {
+    channel_buffer_module_.push_back(make_pair(module_name, buffer_depth));
+  }
+}
+
+void VerilogCompiler::GenerateSkipChannelBuffer(std::ostream& os,
+    int layer_id, int blob_id) {
+  const Layer* layer = net_->layers_[layer_id];
+  os << "// Skip channel buffer of Eltwise Layer: "
+    << layer->layer_param().name() << endl;
+  const int num_channel = net_->bottom_blobs_shape_ptr_[layer_id][blob_id]->
+    at(1);
+  const string prev_connection = layer->layer_param().bottom(blob_id);
+  const string prev_name = interconnections_name_[
+    interconnections_to_idx_.find(prev_connection)->second];
+  const string next_name = prev_name + "_skip_channel_buffer";
+  stringstream module_name_stream;
+  module_name_stream << layer->layer_param().name() <<
+    "_skip_channel_buffer_" << blob_id;
+  const string module_name = module_name_stream.str();
+
+  os << "channel_buffer #(" << endl;
+  os << "\t.BIT_WIDTH\t\t" << "(" << layer_precision_->BlobBitWidth(
+      prev_connection) << ")," << endl;
+  // sized by InitBufferDepth, or by the buffer depth file
+  const int buffer_depth = ChannelBufferDepth(module_name,
+      inception_buffer_depth_);
+  os << "\t.BUFFER_DEPTH\t\t" << "(" << buffer_depth << ")," << endl;
   os << "\t.NUM_CHANNEL\t\t" << "(" << num_channel << ")" << endl;
   os << ") " << module_name << " (" << endl;
   os << "\t.clk\t\t\t\t" << "(clk)," << endl;
@@ -1104,7 +1623,7 @@ void VerilogCompiler::GenerateInceptionChannelBuffer(std::ostream& os,
   os << ");" << endl;
 
   // record the channel buffer name
-  if (inception_buffer_depth_ != 0) {
-    channel_buffer_module_.push_back(module_name);
+  if (buffer_depth != 0) {
+    channel_buffer_module_.push_back(make_pair(module_name, buffer_depth));
   }
 }
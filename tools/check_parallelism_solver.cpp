@@ -0,0 +1,156 @@
+/*
+ * Filename: check_parallelism_solver.cpp
+ * ---------------------------------------
+ * This file implements the regression check of the quotient-based parallelism
+ * solver (SolveParallelism) against the exhaustive search it replaces. For
+ * each CONV & FC layer of the given models, both searches are run over a sweep
+ * of pixel inference rates, with & without kernel unrolling as ConvNetAcc
+ * does, and under the dependency constraint of VerilogCompiler. Any different
+ * allocation is reported and fails the check.
+ */
+
+#include "header/caffe/net.hpp"
+#include "header/caffe/util/upgrade_proto.hpp"
+#include "header/systemc/parallelism_allocator.hpp"
+#include "header/parallelism_solver.hpp"
+#include "proto/caffe.pb.h"
+#include "proto/config.pb.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cmath>
+
+using namespace std;
+
+// pixel inference rates of the sweep
+static const int kPixelInferenceRates[] = {1, 2, 5, 10, 20, 50, 100, 200, 500,
+  1000, 2000, 5000};
+// nonlinear pipeline of VerilogCompiler
+static const int kNonlinPipeline = 1;
+
+/*
+ * Function: BruteForce
+ * ---------------------
+ * The exhaustive search over all (Pin, Pout, Pk), identical to the original
+ * ConvNetAcc::CalculateParallelsimBruteForce (min_out_iter = 1, no error bound)
+ * and VerilogCompiler::CalculateParallelsimBruteForce (K = 1, min_out_iter =
+ * 1 + nonlin_pipeline, error bound Nin * Nout).
+ */
+static pair<pair<int, int>, int> BruteForce(int Nin, int Nout, int K,
+    bool kernel_unrolling, double rate, int min_out_iter, double max_error) {
+  int Pin = 1, Pout = 1, Pk = 1;
+  double min = max_error;
+  for (int Pin_ = 1; Pin_ <= Nin; ++Pin_) {
+    for (int Pout_ = 1; Pout_ <= Nout; ++Pout_) {
+      if (ceil(static_cast<double>(Nout) / Pout_) < min_out_iter) {
+        continue;
+      }
+      // Pk = Kernel size if kernel unrolling option is disabled
+      for (int Pk_ = kernel_unrolling ? 1 : K; Pk_ <= K; ++Pk_) {
+        double calculated_rate = ceil(static_cast<double>(Nin) / Pin_) *
+          ceil(static_cast<double>(Nout) / Pout_) *
+          ceil(static_cast<double>(K) / Pk_);
+        if (abs(calculated_rate - rate) < min) {
+          min = abs(calculated_rate - rate);
+          Pin = Pin_;
+          Pout = Pout_;
+          Pk = Pk_;
+        }
+      }
+    }
+  }
+  return make_pair(make_pair(Pin, Pout), Pk);
+}
+
+// compares both searches on one layer, returns false on mismatch
+static bool Check(const ParallelismAllocator::LayerDim& layer, int K,
+    bool kernel_unrolling, double rate, int min_out_iter, double max_error) {
+  const pair<pair<int, int>, int> expected = BruteForce(layer.Nin, layer.Nout,
+      K, kernel_unrolling, rate, min_out_iter, max_error);
+  const pair<pair<int, int>, int> solved = SolveParallelism(layer.Nin,
+      layer.Nout, K, kernel_unrolling, rate, min_out_iter, max_error);
+  if (expected == solved) {
+    return true;
+  }
+  cout << "[MISMATCH]: " << layer.name << " Nin: " << layer.Nin << " Nout: "
+    << layer.Nout << " K: " << K << " kernel unrolling: " << kernel_unrolling
+    << " rate: " << rate << " min_out_iter: " << min_out_iter
+    << " exhaustive: (" << expected.first.first << ", "
+    << expected.first.second << ", " << expected.second << ") solver: ("
+    << solved.first.first << ", " << solved.first.second << ", "
+    << solved.second << ")" << endl;
+  return false;
+}
+
+/*
+ * Function: HasInputLayer
+ * ------------------------
+ * The accelerator is fed by the Input layer. The networks reading a Data layer
+ * (e.g. train_val.prototxt) are not supported by ConvNetAcc either.
+ */
+static bool HasInputLayer(const caffe::NetParameter& net_param) {
+  for (int layer_id = 0; layer_id < net_param.layer_size(); ++layer_id) {
+    if (net_param.layer(layer_id).type() == "Input") {
+      return true;
+    }
+  }
+  return false;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    cout << "Unexpected inline option!" << endl;
+    cout << "[Usage]: ./check_parallelism_solver.bin [model prototxt] ..."
+      << endl;
+    return 1;
+  }
+  const int num_rates = sizeof(kPixelInferenceRates) /
+    sizeof(kPixelInferenceRates[0]);
+  int num_checks = 0, num_mismatches = 0;
+  for (int arg = 1; arg < argc; ++arg) {
+    // the deprecated input fields are upgraded to the Input layer
+    caffe::NetParameter net_param;
+    caffe::ReadNetParamsFromTextFileOrDie(argv[arg], &net_param);
+    if (!HasInputLayer(net_param)) {
+      cout << argv[arg] << ": skipped without the Input layer" << endl;
+      continue;
+    }
+    config::ConfigParameter config_param;
+    config_param.set_model_file(argv[arg]);
+    config_param.set_bit_width(16);
+    const Net net(net_param);
+    const ParallelismAllocator allocator(net, config_param);
+    int model_checks = 0;
+    for (vector<ParallelismAllocator::LayerDim>::const_iterator iter =
+        allocator.layers().begin(); iter != allocator.layers().end(); ++iter) {
+      if (iter->Nout == 0) {
+        // POOL: no search
+        continue;
+      }
+      const double spatial_dim = static_cast<double>(iter->h) * iter->w;
+      const int K = iter->Kh * iter->Kw;
+      for (int i = 0; i < num_rates; ++i) {
+        const double layer_inference_rate = static_cast<double>(
+            allocator.input_spatial_dim()) * kPixelInferenceRates[i];
+        // ConvNetAcc: the pipeline stage is excluded from the pixel rate
+        double rate = layer_inference_rate / spatial_dim -
+          ParallelismAllocator::PIPELINE_STAGE;
+        if (rate <= 0) rate = 1;
+        const double no_bound = numeric_limits<double>::max();
+        num_mismatches += !Check(*iter, K, false, rate, 1, no_bound);
+        num_mismatches += !Check(*iter, K, true, rate, 1, no_bound);
+        // VerilogCompiler: no kernel unrolling & the dependency constraint
+        num_mismatches += !Check(*iter, 1, false, rate, 1 + kNonlinPipeline,
+            static_cast<double>(iter->Nin) * iter->Nout);
+        model_checks += 3;
+      }
+    }
+    cout << argv[arg] << ": " << model_checks << " allocations checked"
+      << endl;
+    num_checks += model_checks;
+  }
+  cout << num_checks << " allocations checked, " << num_mismatches
+    << " mismatches" << endl;
+  return (num_mismatches == 0) ? 0 : 1;
+}